@@ -3,6 +3,8 @@
 #include "Mesh.h"
 
 #include <pbat/fem/HyperElasticPotential.h>
+#include <pbat/physics/AsRigidAsPossibleEnergy.h>
+#include <pbat/physics/CorotationalEnergy.h>
 #include <pbat/physics/SaintVenantKirchhoffEnergy.h>
 #include <pbat/physics/StableNeoHookeanEnergy.h>
 #include <pybind11/eigen.h>
@@ -59,7 +61,12 @@ inline void HepApplyToMesh(int meshDims, int meshOrder, EElement meshElement, Fu
     });
 }
 
-enum class EHyperElasticEnergy { SaintVenantKirchhoff, StableNeoHookean };
+enum class EHyperElasticEnergy {
+    SaintVenantKirchhoff,
+    StableNeoHookean,
+    Corotational,
+    AsRigidAsPossible
+};
 
 class HyperElasticPotential
 {
@@ -93,6 +100,9 @@ class HyperElasticPotential
 
     void PrecomputeHessianSparsity();
 
+    void SetHessianStorage(pbat::fem::EHessianStorage eStorage);
+    pbat::fem::EHessianStorage HessianStorage() const;
+
     void ComputeElementElasticity(
         Eigen::Ref<VectorX const> const& x,
         bool bWithGradient,
@@ -102,6 +112,7 @@ class HyperElasticPotential
     Scalar Eval() const;
     VectorX ToVector() const;
     CSCMatrix ToMatrix() const;
+    MatrixX HessianProduct(Eigen::Ref<MatrixX const> const& x) const;
     std::tuple<Index, Index> Shape() const;
 
     VectorX const& mug() const;
@@ -138,6 +149,15 @@ void BindHyperElasticPotential(pybind11::module& m)
     pyb::enum_<EHyperElasticEnergy>(m, "HyperElasticEnergy")
         .value("SaintVenantKirchhoff", EHyperElasticEnergy::SaintVenantKirchhoff)
         .value("StableNeoHookean", EHyperElasticEnergy::StableNeoHookean)
+        .value("Corotational", EHyperElasticEnergy::Corotational)
+        .value("AsRigidAsPossible", EHyperElasticEnergy::AsRigidAsPossible)
+        .export_values();
+
+    pyb::enum_<pbat::fem::EHessianStorage>(m, "HessianStorage")
+        .value("Dense", pbat::fem::EHessianStorage::Dense)
+        .value("Packed", pbat::fem::EHessianStorage::Packed)
+        .value("PackedFloat", pbat::fem::EHessianStorage::PackedFloat)
+        .value("MatrixFree", pbat::fem::EHessianStorage::MatrixFree)
         .export_values();
 
     pyb::class_<HyperElasticPotential>(m, "HyperElasticPotential")
@@ -187,6 +207,15 @@ void BindHyperElasticPotential(pybind11::module& m)
             &HyperElasticPotential::PrecomputeHessianSparsity,
             "Precompute sparsity pattern of the hessian for reusable and efficient hessian "
             "construction.")
+        .def_property(
+            "hessian_storage",
+            &HyperElasticPotential::HessianStorage,
+            &HyperElasticPotential::SetHessianStorage,
+            "Hessian storage layout. Packed layouts accumulate quadrature point hessians into the "
+            "upper triangular part of element hessians, optionally in single precision. The "
+            "matrix-free layout only caches deformation gradients, and hessian-vector products "
+            "recompute quadrature point hessians on the fly. Setting the layout resets hessians "
+            "and any precomputed hessian sparsity.")
         .def(
             "compute_element_elasticity",
             &HyperElasticPotential::ComputeElementElasticity,
@@ -199,6 +228,11 @@ void BindHyperElasticPotential(pybind11::module& m)
         .def("eval", &HyperElasticPotential::Eval)
         .def("gradient", &HyperElasticPotential::ToVector)
         .def("hessian", &HyperElasticPotential::ToMatrix)
+        .def(
+            "apply",
+            &HyperElasticPotential::HessianProduct,
+            pyb::arg("x"),
+            "Computes the hessian-vector product(s) H*x without assembling H.")
         .def_property(
             "mug",
             [](HyperElasticPotential const& M) { return M.mug(); },
@@ -224,7 +258,7 @@ void BindHyperElasticPotential(pybind11::module& m)
             "Hg",
             [](HyperElasticPotential const& M) { return M.Hessians(); },
             "|#element nodes * dims|x|#elements nodes * dims * #quad.pts.| matrix of element hyper "
-            "elastic potential hessians at quadrature points")
+            "elastic potential hessians at quadrature points (only for dense hessian storage)")
         .def_property_readonly("shape", &HyperElasticPotential::Shape)
         .def("to_matrix", &HyperElasticPotential::ToMatrix);
 }
@@ -247,7 +281,9 @@ HyperElasticPotential::HyperElasticPotential(
     M.Apply([&]<pbat::fem::CMesh MeshType>(MeshType* mesh) {
         pbat::common::ForTypes<
             pbat::physics::SaintVenantKirchhoffEnergy<MeshType::kDims>,
-            pbat::physics::StableNeoHookeanEnergy<MeshType::kDims>>(
+            pbat::physics::StableNeoHookeanEnergy<MeshType::kDims>,
+            pbat::physics::CorotationalEnergy<MeshType::kDims>,
+            pbat::physics::AsRigidAsPossibleEnergy<MeshType::kDims>>(
             [&]<class HyperElasticEnergyType>() {
                 using HyperElasticPotentialType =
                     pbat::fem::HyperElasticPotential<MeshType, HyperElasticEnergyType>;
@@ -269,6 +305,24 @@ HyperElasticPotential::HyperElasticPotential(
                         new HyperElasticPotentialType(*mesh, eg, wg, GNeg, Y, nu);
                     mDims = HyperElasticPotentialType::kDims;
                 }
+                if (ePsi == EHyperElasticEnergy::Corotational and
+                    std::is_same_v<
+                        HyperElasticEnergyType,
+                        pbat::physics::CorotationalEnergy<MeshType::kDims>>)
+                {
+                    mHyperElasticPotential =
+                        new HyperElasticPotentialType(*mesh, eg, wg, GNeg, Y, nu);
+                    mDims = HyperElasticPotentialType::kDims;
+                }
+                if (ePsi == EHyperElasticEnergy::AsRigidAsPossible and
+                    std::is_same_v<
+                        HyperElasticEnergyType,
+                        pbat::physics::AsRigidAsPossibleEnergy<MeshType::kDims>>)
+                {
+                    mHyperElasticPotential =
+                        new HyperElasticPotentialType(*mesh, eg, wg, GNeg, Y, nu);
+                    mDims = HyperElasticPotentialType::kDims;
+                }
             });
     });
 }
@@ -291,7 +345,9 @@ HyperElasticPotential::HyperElasticPotential(
     M.Apply([&]<pbat::fem::CMesh MeshType>(MeshType* mesh) {
         pbat::common::ForTypes<
             pbat::physics::SaintVenantKirchhoffEnergy<MeshType::kDims>,
-            pbat::physics::StableNeoHookeanEnergy<MeshType::kDims>>(
+            pbat::physics::StableNeoHookeanEnergy<MeshType::kDims>,
+            pbat::physics::CorotationalEnergy<MeshType::kDims>,
+            pbat::physics::AsRigidAsPossibleEnergy<MeshType::kDims>>(
             [&]<class HyperElasticEnergyType>() {
                 using HyperElasticPotentialType =
                     pbat::fem::HyperElasticPotential<MeshType, HyperElasticEnergyType>;
@@ -313,6 +369,24 @@ HyperElasticPotential::HyperElasticPotential(
                         new HyperElasticPotentialType(*mesh, eg, wg, GNeg, Y, nu);
                     mDims = HyperElasticPotentialType::kDims;
                 }
+                if (ePsi == EHyperElasticEnergy::Corotational and
+                    std::is_same_v<
+                        HyperElasticEnergyType,
+                        pbat::physics::CorotationalEnergy<MeshType::kDims>>)
+                {
+                    mHyperElasticPotential =
+                        new HyperElasticPotentialType(*mesh, eg, wg, GNeg, Y, nu);
+                    mDims = HyperElasticPotentialType::kDims;
+                }
+                if (ePsi == EHyperElasticEnergy::AsRigidAsPossible and
+                    std::is_same_v<
+                        HyperElasticEnergyType,
+                        pbat::physics::AsRigidAsPossibleEnergy<MeshType::kDims>>)
+                {
+                    mHyperElasticPotential =
+                        new HyperElasticPotentialType(*mesh, eg, wg, GNeg, Y, nu);
+                    mDims = HyperElasticPotentialType::kDims;
+                }
             });
     });
 }
@@ -337,6 +411,22 @@ void HyperElasticPotential::PrecomputeHessianSparsity()
     });
 }
 
+void HyperElasticPotential::SetHessianStorage(pbat::fem::EHessianStorage eStorage)
+{
+    Apply([&]<class HyperElasticPotentialType>(HyperElasticPotentialType* hyperElasticPotential) {
+        hyperElasticPotential->SetHessianStorage(eStorage);
+    });
+}
+
+pbat::fem::EHessianStorage HyperElasticPotential::HessianStorage() const
+{
+    pbat::fem::EHessianStorage eStorage{};
+    Apply([&]<class HyperElasticPotentialType>(HyperElasticPotentialType* hyperElasticPotential) {
+        eStorage = hyperElasticPotential->eHessianStorage;
+    });
+    return eStorage;
+}
+
 void HyperElasticPotential::ComputeElementElasticity(
     Eigen::Ref<VectorX const> const& x,
     bool bWithGradient,
@@ -379,6 +469,16 @@ CSCMatrix HyperElasticPotential::ToMatrix() const
     return H;
 }
 
+MatrixX HyperElasticPotential::HessianProduct(Eigen::Ref<MatrixX const> const& x) const
+{
+    MatrixX y{};
+    Apply([&]<class HyperElasticPotentialType>(HyperElasticPotentialType* hyperElasticPotential) {
+        y.setZero(x.rows(), x.cols());
+        hyperElasticPotential->Apply(x, y);
+    });
+    return y;
+}
+
 std::tuple<Index, Index> HyperElasticPotential::Shape() const
 {
     Index rows{0}, cols{0};
@@ -496,7 +596,9 @@ void HyperElasticPotential::Apply(Func&& f) const
     HepApplyToMesh(mMeshDims, mMeshOrder, eMeshElement, [&]<pbat::fem::CMesh MeshType>() {
         pbat::common::ForTypes<
             pbat::physics::SaintVenantKirchhoffEnergy<MeshType::kDims>,
-            pbat::physics::StableNeoHookeanEnergy<MeshType::kDims>>(
+            pbat::physics::StableNeoHookeanEnergy<MeshType::kDims>,
+            pbat::physics::CorotationalEnergy<MeshType::kDims>,
+            pbat::physics::AsRigidAsPossibleEnergy<MeshType::kDims>>(
             [&]<class HyperElasticEnergyType>() {
                 using HyperElasticPotentialType =
                     pbat::fem::HyperElasticPotential<MeshType, HyperElasticEnergyType>;
@@ -518,6 +620,24 @@ void HyperElasticPotential::Apply(Func&& f) const
                         reinterpret_cast<HyperElasticPotentialType*>(mHyperElasticPotential);
                     f.template operator()<HyperElasticPotentialType>(hyperElasticPotential);
                 }
+                if (eHyperElasticEnergy == EHyperElasticEnergy::Corotational and
+                    std::is_same_v<
+                        HyperElasticEnergyType,
+                        pbat::physics::CorotationalEnergy<MeshType::kDims>>)
+                {
+                    HyperElasticPotentialType* hyperElasticPotential =
+                        reinterpret_cast<HyperElasticPotentialType*>(mHyperElasticPotential);
+                    f.template operator()<HyperElasticPotentialType>(hyperElasticPotential);
+                }
+                if (eHyperElasticEnergy == EHyperElasticEnergy::AsRigidAsPossible and
+                    std::is_same_v<
+                        HyperElasticEnergyType,
+                        pbat::physics::AsRigidAsPossibleEnergy<MeshType::kDims>>)
+                {
+                    HyperElasticPotentialType* hyperElasticPotential =
+                        reinterpret_cast<HyperElasticPotentialType*>(mHyperElasticPotential);
+                    f.template operator()<HyperElasticPotentialType>(hyperElasticPotential);
+                }
             });
     });
 }
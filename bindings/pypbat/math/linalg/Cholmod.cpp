@@ -21,7 +21,37 @@ void BindCholmod([[maybe_unused]] pybind11::module& m)
     std::string const className = "Cholmod";
     using CholmodType           = pbat::math::linalg::Cholmod;
     pyb::class_<CholmodType> chol(m, className.data());
-    chol.def(pyb::init<>());
+
+    pyb::enum_<CholmodType::EFactorization>(chol, "Factorization")
+        .value("Simplicial", CholmodType::EFactorization::Simplicial)
+        .value("Automatic", CholmodType::EFactorization::Automatic)
+        .value("Supernodal", CholmodType::EFactorization::Supernodal)
+        .export_values();
+
+    pyb::enum_<CholmodType::EOrdering>(chol, "Ordering")
+        .value("Automatic", CholmodType::EOrdering::Automatic)
+        .value("Natural", CholmodType::EOrdering::Natural)
+        .value("Amd", CholmodType::EOrdering::Amd)
+        .value("Metis", CholmodType::EOrdering::Metis)
+        .value("NestedDissection", CholmodType::EOrdering::NestedDissection)
+        .export_values();
+
+    pyb::enum_<CholmodType::EPrecision>(chol, "Precision")
+        .value("Double", CholmodType::EPrecision::Double)
+        .value("Single", CholmodType::EPrecision::Single)
+        .export_values();
+
+    pyb::class_<CholmodType::Settings>(chol, "Settings")
+        .def(pyb::init<>())
+        .def_readwrite("factorization", &CholmodType::Settings::eFactorization)
+        .def_readwrite("ordering", &CholmodType::Settings::eOrdering)
+        .def_readwrite("precision", &CholmodType::Settings::ePrecision)
+        .def_readwrite("n_threads", &CholmodType::Settings::nThreads);
+
+    chol.def(pyb::init<>())
+        .def(pyb::init<CholmodType::Settings const&>(), pyb::arg("settings"))
+        .def("configure", &CholmodType::Configure, pyb::arg("settings"))
+        .def_property_readonly("settings", &CholmodType::GetSettings);
 
     pyb::enum_<CholmodType::ESparseStorage>(chol, "SparseStorage")
         .value("SymmetricLowerTriangular", CholmodType::ESparseStorage::SymmetricLowerTriangular)
@@ -83,6 +113,23 @@ void BindCholmod([[maybe_unused]] pybind11::module& m)
                 },
                 pyb::arg("A"),
                 pyb::arg("storage"))
+            .def(
+                "refactorize",
+                [](CholmodType& llt, SparseMatrixType const& A) {
+                    bool const bFactorized =
+                        pbat::profiling::Profile("pbat.math.linalg.Cholmod.Refactorize", [&]() {
+                            return llt.Refactorize(A);
+                        });
+                    return bFactorized;
+                },
+                pyb::arg("A"))
+            .def(
+                "is_analyzed",
+                [](CholmodType const& llt,
+                   SparseMatrixType const& A,
+                   CholmodType::ESparseStorage storage) { return llt.IsAnalyzed(A, storage); },
+                pyb::arg("A"),
+                pyb::arg("storage"))
             .def(
                 "update",
                 [](CholmodType& llt, SparseMatrixType const& U) {
@@ -3,6 +3,7 @@
 #include "Cholmod.h"
 #include "Pardiso.h"
 #include "SimplicialLDLT.h"
+#include "SparseLdlt.h"
 
 #include <string>
 
@@ -17,6 +18,7 @@ void Bind(pybind11::module& m)
     BindCholmod(m);
     BindPardiso(m);
     BindSimplicialLDLT(m);
+    BindSparseLdlt(m);
 }
 
 } // namespace linalg
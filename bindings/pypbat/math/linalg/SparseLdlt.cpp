@@ -0,0 +1,125 @@
+#include "SparseLdlt.h"
+
+#include <pbat/Aliases.h>
+#include <pbat/common/ConstexprFor.h>
+#include <pbat/math/linalg/SparseLdlt.h>
+#include <pbat/profiling/Profiling.h>
+#include <pybind11/eigen.h>
+#include <string>
+
+namespace pbat {
+namespace py {
+namespace math {
+namespace linalg {
+
+void BindSparseLdlt(pybind11::module& m)
+{
+    namespace pyb = pybind11;
+
+    std::string const className = "SparseLdlt";
+    using LdltType              = pbat::math::linalg::SparseLdlt;
+    using EBisection            = pbat::graph::NestedDissectionOptions::EBisection;
+    pyb::class_<LdltType> ldlt(m, className.data());
+
+    pyb::enum_<EBisection>(ldlt, "Bisection")
+        .value("Default", EBisection::Default)
+        .value("LevelSet", EBisection::LevelSet)
+        .value("Metis", EBisection::Metis)
+        .export_values();
+
+    pyb::enum_<LdltType::EPrecision>(ldlt, "Precision")
+        .value("Double", LdltType::EPrecision::Double)
+        .value("Single", LdltType::EPrecision::Single)
+        .export_values();
+
+    pyb::class_<LdltType::Settings>(ldlt, "Settings")
+        .def(pyb::init<>())
+        .def_property(
+            "bisection",
+            [](LdltType::Settings const& settings) { return settings.ordering.eBisection; },
+            [](LdltType::Settings& settings, EBisection eBisection) {
+                settings.ordering.eBisection = eBisection;
+            })
+        .def_property(
+            "leaf_size",
+            [](LdltType::Settings const& settings) { return settings.ordering.leafSize; },
+            [](LdltType::Settings& settings, Index leafSize) {
+                settings.ordering.leafSize = leafSize;
+            })
+        .def_readwrite("precision", &LdltType::Settings::ePrecision)
+        .def_readwrite("parallel", &LdltType::Settings::bParallel)
+        .def_readwrite("pivot_tolerance", &LdltType::Settings::pivotTolerance)
+        .def_readwrite("min_panel_size", &LdltType::Settings::minPanelSize);
+
+    pyb::enum_<LdltType::ESparseStorage>(ldlt, "SparseStorage")
+        .value("SymmetricLowerTriangular", LdltType::ESparseStorage::SymmetricLowerTriangular)
+        .value("SymmetricUpperTriangular", LdltType::ESparseStorage::SymmetricUpperTriangular)
+        .export_values();
+
+    ldlt.def(pyb::init<>())
+        .def(pyb::init<LdltType::Settings const&>(), pyb::arg("settings"))
+        .def("configure", &LdltType::Configure, pyb::arg("settings"))
+        .def_property_readonly("settings", &LdltType::GetSettings)
+        .def_property_readonly(
+            "permutation",
+            [](LdltType const& llt) { return llt.Ordering().perm; },
+            "Fill-reducing ordering, i.e. perm[k] is the k^{th} eliminated row")
+        .def_property_readonly("nnz", &LdltType::NonZeros)
+        .def_property_readonly("D", &LdltType::D)
+        .def(
+            "solve",
+            [](LdltType const& llt, Eigen::Ref<MatrixX const> const& B) {
+                return pbat::profiling::Profile("pbat.math.linalg.SparseLdlt.Solve", [&]() {
+                    MatrixX X = llt.Solve(B);
+                    return X;
+                });
+            },
+            pyb::arg("B"));
+
+    ldlt.doc() =
+        "Sparse LDLT decomposition of symmetric matrix A with nested dissection ordering, without "
+        "external dependencies. If A is stored in compressed row format, then the storage "
+        "triangle refers to A's rows.";
+
+    common::ForTypes<CSCMatrix, CSRMatrix>([&]<class SparseMatrixType>() {
+        ldlt.def(
+                "analyze",
+                [](LdltType& llt, SparseMatrixType const& A, LdltType::ESparseStorage storage) {
+                    pbat::profiling::Profile("pbat.math.linalg.SparseLdlt.Analyze", [&]() {
+                        llt.Analyze(A, storage);
+                    });
+                },
+                pyb::arg("A"),
+                pyb::arg("storage") = LdltType::ESparseStorage::SymmetricLowerTriangular)
+            .def(
+                "factorize",
+                [](LdltType& llt, SparseMatrixType const& A, LdltType::ESparseStorage storage) {
+                    return pbat::profiling::Profile("pbat.math.linalg.SparseLdlt.Factorize", [&]() {
+                        return llt.Factorize(A, storage);
+                    });
+                },
+                pyb::arg("A"),
+                pyb::arg("storage") = LdltType::ESparseStorage::SymmetricLowerTriangular)
+            .def(
+                "compute",
+                [](LdltType& llt, SparseMatrixType const& A, LdltType::ESparseStorage storage) {
+                    return pbat::profiling::Profile("pbat.math.linalg.SparseLdlt.Compute", [&]() {
+                        return llt.Compute(A, storage);
+                    });
+                },
+                pyb::arg("A"),
+                pyb::arg("storage") = LdltType::ESparseStorage::SymmetricLowerTriangular)
+            .def(
+                "is_analyzed",
+                [](LdltType const& llt,
+                   SparseMatrixType const& A,
+                   LdltType::ESparseStorage storage) { return llt.IsAnalyzed(A, storage); },
+                pyb::arg("A"),
+                pyb::arg("storage") = LdltType::ESparseStorage::SymmetricLowerTriangular);
+    });
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace py
+} // namespace pbat
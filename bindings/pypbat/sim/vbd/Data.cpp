@@ -14,6 +14,7 @@ void BindData(pybind11::module& m)
 {
     namespace pyb = pybind11;
     using pbat::sim::vbd::Data;
+    using pbat::sim::vbd::EElasticEnergy;
     using pbat::sim::vbd::EInitializationStrategy;
 
     pyb::enum_<EInitializationStrategy>(m, "InitializationStrategy")
@@ -24,6 +25,12 @@ void BindData(pybind11::module& m)
         .value("AdaptivePbat", EInitializationStrategy::AdaptivePbat)
         .export_values();
 
+    pyb::enum_<EElasticEnergy>(m, "ElasticEnergy")
+        .value("StableNeoHookean", EElasticEnergy::StableNeoHookean)
+        .value("Corotational", EElasticEnergy::Corotational)
+        .value("AsRigidAsPossible", EElasticEnergy::AsRigidAsPossible)
+        .export_values();
+
     pyb::class_<Data>(m, "Data")
         .def(pyb::init<>())
         .def(
@@ -105,6 +112,12 @@ void BindData(pybind11::module& m)
             "with_hessian_determinant_zero",
             &Data::WithHessianDeterminantZeroUnder,
             pyb::arg("zero"))
+        .def(
+            "with_elastic_energy",
+            &Data::WithElasticEnergy,
+            pyb::arg("psie"),
+            "Sets the |#elements| per-element elastic energy models, i.e. cheaper corotational or "
+            "as-rigid-as-possible energies can be used as a material level of detail.")
         .def("construct", &Data::Construct, pyb::arg("validate") = true)
         .def_readwrite("X", &Data::X)
         .def_readwrite("E", &Data::E)
@@ -119,6 +132,7 @@ void BindData(pybind11::module& m)
         .def_readwrite("wg", &Data::wg)
         .def_readwrite("rhoe", &Data::rhoe)
         .def_readwrite("lame", &Data::lame)
+        .def_readwrite("psie", &Data::psie)
         .def_readwrite("GVGp", &Data::GVGp)
         .def_readwrite("GVGe", &Data::GVGe)
         .def_readwrite("GVGilocal", &Data::GVGilocal)
@@ -6,6 +6,7 @@
 #include <pbat/sim/vbd/multigrid/Hierarchy.h>
 #include <pybind11/eigen.h>
 #include <pybind11/stl.h>
+#include <string>
 
 namespace pbat {
 namespace py {
@@ -19,7 +20,25 @@ void BindHierarchy(pybind11::module& m)
     using pbat::py::fem::Mesh;
     using pbat::sim::vbd::Data;
     using pbat::sim::vbd::VolumeMesh;
+    using pbat::sim::vbd::multigrid::ECycle;
     using pbat::sim::vbd::multigrid::Hierarchy;
+    pyb::enum_<ECycle>(m, "Cycle")
+        .value("V", ECycle::V)
+        .value("W", ECycle::W)
+        .value("F", ECycle::F)
+        .export_values();
+
+    m.def(
+        "cycle",
+        &pbat::sim::vbd::multigrid::Cycle,
+        pyb::arg("type"),
+        pyb::arg("n_levels"),
+        "Computes the ordered level visits of a standard multigrid cycle, where level -1 is the "
+        "root and n_levels-1 the coarsest level.\n"
+        "Args:\n"
+        "type (Cycle): Cycle type.\n"
+        "n_levels (int): Number of coarse levels.\n");
+
     pyb::class_<Hierarchy>(m, "Hierarchy")
         .def(
             pyb::init([](Data& root,
@@ -52,6 +71,59 @@ void BindHierarchy(pybind11::module& m)
             "level is -1, the immediate coarse level is 0, etc. Defaults to None.\n"
             "siters (list[int] | None): |len(cycle)| list of iterations to spend on "
             "each visited level in the cycle. Defaults to None.\n")
+        .def(
+            pyb::init([](Data& root,
+                         Index nLevels,
+                         Eigen::Ref<IndexVectorX const> const& cycle,
+                         Eigen::Ref<IndexVectorX const> const& siters) {
+                return Hierarchy(std::move(root), nLevels, cycle, siters);
+            }),
+            pyb::arg("root"),
+            pyb::arg("n_levels"),
+            pyb::arg("cycle")  = IndexVectorX{},
+            pyb::arg("siters") = IndexVectorX{},
+            "Computes a geometric multigrid hierarchy from the full space root problem, using "
+            "automatically generated embedding voxel cages.\n"
+            "Args:\n"
+            "root (_pbat.sim.vbd.Data): The root problem, defined on the finest (i.e. "
+            "full-resolution) mesh.\n"
+            "n_levels (int): Maximum number of coarse levels.\n"
+            "cycle (list[int] | None): List of level transitions (l[i],l[i+1]), where the root "
+            "level is -1, the immediate coarse level is 0, etc. Defaults to None.\n"
+            "siters (list[int] | None): |len(cycle)| list of iterations to spend on "
+            "each visited level in the cycle. Defaults to None.\n")
+        .def(
+            "save",
+            [](Hierarchy const& H, std::string const& path) { H.Save(path); },
+            pyb::arg("path"),
+            "Writes this hierarchy's coarse levels, cycle and smoother iterations to a binary "
+            "file.\n"
+            "Args:\n"
+            "path (str): Output file path.\n")
+        .def_static(
+            "load",
+            [](Data& root, std::string const& path) {
+                return Hierarchy::Load(std::move(root), path);
+            },
+            pyb::arg("root"),
+            pyb::arg("path"),
+            "Loads a hierarchy written by save, which was constructed from the same root "
+            "problem.\n"
+            "Args:\n"
+            "root (_pbat.sim.vbd.Data): The root problem, defined on the finest (i.e. "
+            "full-resolution) mesh.\n"
+            "path (str): Input file path.\n")
+        .def(
+            "set_dirichlet_vertices",
+            &Hierarchy::SetDirichletVertices,
+            pyb::arg("dbc"),
+            "Pins the root level vertices dbc and releases all others, updating the root problem "
+            "and every coarse level together. Reused coarse factorizations receive one batched "
+            "low-rank update per level.\n"
+            "Args:\n"
+            "dbc (np.ndarray): Dirichlet constrained root level vertices.\n"
+            "Returns:\n"
+            "bool: True if every coarse level that reuses its factorization updated it.\n")
         .def_readwrite("data", &Hierarchy::data)
         .def_readwrite(
             "levels",
@@ -65,7 +137,51 @@ void BindHierarchy(pybind11::module& m)
         .def_readwrite(
             "siters",
             &Hierarchy::siters,
-            "|#cages+1| max smoother iterations at each level, starting from the root");
+            "|#level visits| max smoother iterations at each level visit in the cycle")
+        .def_readwrite("ncycles", &Hierarchy::ncycles, "Max number of cycles per time step")
+        .def_readwrite(
+            "rtol",
+            &Hierarchy::rtol,
+            "Cycling stops early once the root level's residual falls below rtol times its "
+            "residual at the start of the time step. Every time step runs ncycles cycles if rtol "
+            "<= 0.")
+        .def_readwrite(
+            "direct_coarse_solve",
+            &Hierarchy::bDirectCoarseSolve,
+            "Visits of the coarsest level solve its problem with Newton's method and sparse direct "
+            "linear solves, rather than smoothing it.")
+        .def_readwrite(
+            "reuse_coarse_factorization",
+            &Hierarchy::bReuseCoarseFactorization,
+            "Direct coarse solves reuse the coarsest level's factorization across Newton "
+            "iterations and time steps, for at most the level's max_factorization_reuses time "
+            "steps.")
+        .def_readwrite(
+            "hyper_reduction",
+            &Hierarchy::HR,
+            "Coarse level elastic energy hyper reduction. Coarse levels integrate all fine "
+            "elements if empty.")
+        .def_readwrite(
+            "activity_threshold",
+            &Hierarchy::rActivityThreshold,
+            "Root level vertices whose adjacent elements' Green strain rates are all below this "
+            "threshold are considered static and skipped by the root smoother. Strain rate "
+            "prioritized smoothing is disabled if <= 0.")
+        .def_readonly(
+            "strain_rates",
+            &Hierarchy::rStrainRates,
+            "|#fine elems| Frobenius norms of root level elements' Green strain rates over the "
+            "last time step")
+        .def_readonly(
+            "Aptr",
+            &Hierarchy::rAptr,
+            "|#partitions+1| pointers into Aadj. Empty if strain rate prioritized smoothing is "
+            "disabled.")
+        .def_readonly(
+            "Aadj",
+            &Hierarchy::rAadj,
+            "Active vertices of each root level parallel vertex partition, bucketed by "
+            "decreasing strain rate activity");
 }
 
 } // namespace multigrid
@@ -20,7 +20,11 @@ void BindHyperReduction(pybind11::module& m)
         .def(
             pyb::init<Hierarchy const&, Index>(),
             pyb::arg("hierarchy"),
-            pyb::arg("n_target_active_elements") = Index(-1));
+            pyb::arg("n_target_active_elements") = Index(-1))
+        .def_readwrite(
+            "Ep_max",
+            &HyperReduction::EpMax,
+            "Maximum allowable linear polynomial error in any cluster");
 }
 
 } // namespace multigrid
@@ -39,6 +39,31 @@ void BindLevel(pybind11::module& m)
             "cage (_pbat.fem.Mesh): Cage mesh.\n")
         .def("smooth", &Level::Smooth, pyb::arg("dt"), pyb::arg("iters"), pyb::arg("data"))
         .def("prolong", &Level::Prolong, pyb::arg("data"))
+        .def(
+            "solve",
+            &Level::Solve,
+            pyb::arg("dt"),
+            pyb::arg("iters"),
+            pyb::arg("data"),
+            "Minimizes this level's energy w.r.t. u with iters Newton iterations using sparse "
+            "direct linear solves, then prolongs u to data. Returns False, leaving data untouched, "
+            "if a linear system could not be solved.")
+        .def(
+            "reduce",
+            &Level::Reduce,
+            pyb::arg("data"),
+            pyb::arg("hyper_reduction"),
+            pyb::arg("l"),
+            "Hyper reduces this level's elastic energy using the l^{th} clustering level of "
+            "hyper_reduction.")
+        .def(
+            "set_dirichlet_vertices",
+            &Level::SetDirichletVertices,
+            pyb::arg("data"),
+            pyb::arg("is_dirichlet"),
+            "Sets the Dirichlet vertex mask, updating the reused factorization of the coarse "
+            "Hessian with batched low-rank updates/downdates of the changed vertices' penalty "
+            "terms. Returns True if the factorization remains valid.")
         .def_property(
             "X",
             [](Level const& l) { return l.mesh.X; },
@@ -98,7 +123,21 @@ void BindLevel(pybind11::module& m)
         .def_readwrite(
             "is_dirichlet_vertex",
             &Level::bIsDirichletVertex,
-            "Boolean mask identifying Dirichlet constrained vertices");
+            "Boolean mask identifying Dirichlet constrained vertices")
+        .def_readwrite(
+            "reuse_factorization",
+            &Level::bReuseFactorization,
+            "Reuse the coarse Hessian's factorization across Newton iterations and time steps, "
+            "i.e. modified Newton")
+        .def_readwrite(
+            "max_factorization_reuses",
+            &Level::nMaxFactorizationReuses,
+            "Maximum number of solves, e.g. time steps, after the factorizing one that may reuse "
+            "a factorization. Negative values reuse factorizations indefinitely.")
+        .def_readwrite(
+            "wgR",
+            &Level::wgR,
+            "|#fine elems| hyper reduced quadrature weights, 0 for inactive fine elements");
 }
 
 } // namespace multigrid
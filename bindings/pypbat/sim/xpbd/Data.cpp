@@ -19,6 +19,7 @@ void BindData(pybind11::module& m)
     pyb::enum_<EConstraint>(m, "Constraint")
         .value("StableNeoHookean", EConstraint::StableNeoHookean)
         .value("Collision", EConstraint::Collision)
+        .value("Corotational", EConstraint::Corotational)
         .export_values();
 
     pyb::class_<Data>(m, "Data")
@@ -90,6 +91,12 @@ void BindData(pybind11::module& m)
             pyb::arg("beta"),
             pyb::arg("constraint"),
             "Sets the constraint damping for the given constraint type.")
+        .def(
+            "with_elastic_constraints",
+            &Data::WithElasticConstraints,
+            pyb::arg("ET"),
+            "Sets the |#elements| per-tetrahedron elastic constraint types, i.e. "
+            "Constraint.StableNeoHookean or the cheaper Constraint.Corotational.")
         .def(
             "with_partitions",
             &Data::WithPartitions,
@@ -122,6 +129,7 @@ void BindData(pybind11::module& m)
         .def_readwrite("lame", &Data::lame)
         .def_readwrite("DmInv", &Data::DmInv)
         .def_readwrite("gammaSNH", &Data::gammaSNH)
+        .def_readwrite("ET", &Data::ET)
         .def_readwrite("muS", &Data::muS)
         .def_readwrite("muD", &Data::muD)
         .def_readwrite("alpha", &Data::alpha)
@@ -61,7 +61,7 @@ struct GaussLegendreQuadrature;
                 for xi in x:
                     xi.insert(0, 1 - sum(xi))
                 points = ",".join(
-                    [str(xi[j]) for j in range(d+1) for xi in x])
+                    [str(xi[j]) for xi in x for j in range(d+1)])
                 weights = ",".join([str(wi) for wi in w])
                 impl = f"""
 template <>
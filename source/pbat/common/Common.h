@@ -24,6 +24,7 @@ namespace pbat::common {
 #include "Hash.h"
 #include "Indexing.h"
 #include "Queue.h"
+#include "Serialization.h"
 #include "Stack.h"
 
 #endif // PBAT_COMMON_COMMON_H
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "Serialization.h"
+
+#include <doctest/doctest.h>
+#include <sstream>
+
+TEST_CASE("[common] Binary serialization")
+{
+    using namespace pbat;
+    std::stringstream ss{std::ios::in | std::ios::out | std::ios::binary};
+    MatrixX const A       = MatrixX::Random(3, 5);
+    IndexVectorX const v  = IndexVectorX::LinSpaced(7, 0, 6);
+    Matrix<4, 2> const B  = Matrix<4, 2>::Random();
+    Index const n         = 42;
+    Eigen::Vector<bool, Eigen::Dynamic> b(3);
+    b << true, false, true;
+    common::WriteBinary(ss, A);
+    common::WriteBinary(ss, v);
+    common::WriteBinary(ss, B);
+    common::WriteBinary(ss, n);
+    common::WriteBinary(ss, b);
+
+    MatrixX Ar{};
+    IndexVectorX vr{};
+    Matrix<4, 2> Br{};
+    Index nr{};
+    Eigen::Vector<bool, Eigen::Dynamic> br{};
+    common::ReadBinary(ss, Ar);
+    common::ReadBinary(ss, vr);
+    common::ReadBinary(ss, Br);
+    common::ReadBinary(ss, nr);
+    common::ReadBinary(ss, br);
+    CHECK(Ar == A);
+    CHECK(vr == v);
+    CHECK(Br == B);
+    CHECK_EQ(nr, n);
+    CHECK(br == b);
+    CHECK_THROWS(common::ReadBinary(ss, nr));
+}
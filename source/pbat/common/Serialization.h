@@ -0,0 +1,126 @@
+/**
+ * @file Serialization.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Binary (de)serialization of scalars and dense Eigen matrices
+ * @date 2025-02-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_COMMON_SERIALIZATION_H
+#define PBAT_COMMON_SERIALIZATION_H
+
+#include "pbat/Aliases.h"
+
+#include <cstdint>
+#include <exception>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+namespace pbat {
+namespace common {
+
+/**
+ * @brief Write a trivially copyable value to a binary stream
+ *
+ * @tparam T Trivially copyable type
+ * @param os Output stream
+ * @param value Value to write
+ */
+template <class T>
+requires std::is_trivially_copyable_v<T>
+void WriteBinary(std::ostream& os, T const& value)
+{
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Read a trivially copyable value from a binary stream
+ *
+ * @tparam T Trivially copyable type
+ * @param is Input stream
+ * @param value Value to read into
+ * @throw std::runtime_error if the stream could not be read
+ */
+template <class T>
+requires std::is_trivially_copyable_v<T>
+void ReadBinary(std::istream& is, T& value)
+{
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (not is)
+        throw std::runtime_error("Failed to read value from binary stream");
+}
+
+/**
+ * @brief Write a dense Eigen matrix (dimensions followed by its column-major coefficients) to a
+ * binary stream
+ *
+ * @tparam TDerived Eigen dense expression type
+ * @param os Output stream
+ * @param A Matrix to write
+ */
+template <class TDerived>
+void WriteBinary(std::ostream& os, Eigen::DenseBase<TDerived> const& A)
+{
+    using ScalarType = typename TDerived::Scalar;
+    using MatrixType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+    auto const rows  = static_cast<std::int64_t>(A.rows());
+    auto const cols  = static_cast<std::int64_t>(A.cols());
+    WriteBinary(os, rows);
+    WriteBinary(os, cols);
+    MatrixType const Acm = A;
+    os.write(
+        reinterpret_cast<char const*>(Acm.data()),
+        static_cast<std::streamsize>(sizeof(ScalarType) * static_cast<std::size_t>(Acm.size())));
+}
+
+/**
+ * @brief Read a dense Eigen matrix written by WriteBinary from a binary stream
+ *
+ * @tparam TDerived Eigen plain (i.e. resizable storage) matrix type
+ * @param is Input stream
+ * @param A Matrix to read into
+ * @throw std::runtime_error if the stream could not be read or if the stored dimensions are
+ * incompatible with A
+ */
+template <class TDerived>
+void ReadBinary(std::istream& is, Eigen::PlainObjectBase<TDerived>& A)
+{
+    using ScalarType = typename TDerived::Scalar;
+    using MatrixType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+    std::int64_t rows{}, cols{};
+    ReadBinary(is, rows);
+    ReadBinary(is, cols);
+    bool const bIsVectorCompatible = (rows == 1 or cols == 1 or rows * cols == 0);
+    bool const bHasValidDims =
+        rows >= 0 and cols >= 0 and
+        (TDerived::IsVectorAtCompileTime ?
+             bIsVectorCompatible :
+             ((TDerived::RowsAtCompileTime == Eigen::Dynamic or
+               rows == TDerived::RowsAtCompileTime) and
+              (TDerived::ColsAtCompileTime == Eigen::Dynamic or
+               cols == TDerived::ColsAtCompileTime)));
+    if (not bHasValidDims)
+        throw std::runtime_error("Invalid matrix dimensions in binary stream");
+    MatrixType Acm(static_cast<Eigen::Index>(rows), static_cast<Eigen::Index>(cols));
+    is.read(
+        reinterpret_cast<char*>(Acm.data()),
+        static_cast<std::streamsize>(sizeof(ScalarType) * static_cast<std::size_t>(Acm.size())));
+    if (not is)
+        throw std::runtime_error("Failed to read matrix coefficients from binary stream");
+    if constexpr (TDerived::IsVectorAtCompileTime)
+    {
+        A.resize(Acm.size());
+        A = Acm.reshaped(A.rows(), A.cols());
+    }
+    else
+    {
+        A = Acm;
+    }
+}
+
+} // namespace common
+} // namespace pbat
+
+#endif // PBAT_COMMON_SERIALIZATION_H
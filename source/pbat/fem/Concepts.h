@@ -86,6 +86,17 @@ concept CElement = requires(T t)
     } -> std::convertible_to<Matrix<T::kNodes, T::kDims>>;
 };
 
+/**
+ * @brief Affine (i.e. linear simplex) finite element
+ *
+ * Shape function gradients and jacobian determinants of affine elements are constant over each
+ * element, such that element quantities need not be stored per quadrature point.
+ *
+ * @tparam T Element type
+ */
+template <class T>
+concept CAffineElement = CElement<T> and (T::kOrder == 1) and T::bHasConstantJacobian;
+
 /**
  * @brief Finite element mesh
  *
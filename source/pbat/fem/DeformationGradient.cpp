@@ -85,4 +85,50 @@ TEST_CASE("[fem] DeformationGradient")
             CHECK_LE(FError, zero);
         });
     }
-}
\ No newline at end of file
+    SUBCASE("Sum factorized hexahedron")
+    {
+        // Sheared unit cube
+        Matrix<3, 8> V;
+        IndexMatrix<8, 1> C;
+        // clang-format off
+        V << 0., 1., 0., 1., 0., 1.5, 0., 1.5,
+             0., 0., 1., 1., 0., 0.,  1., 1.,
+             0., 0., 0., 0., 1., 1.,  1., 1.;
+        C << 0, 1, 2, 3, 4, 5, 6, 7;
+        // clang-format on
+        common::ForRange<1, 3>([&]<auto kOrder>() {
+            using ElementType               = fem::Hexahedron<kOrder>;
+            auto constexpr kDims            = 3;
+            auto constexpr kQuadratureOrder = kOrder + 1;
+            using MeshType                  = fem::Mesh<ElementType, kDims>;
+            using BasisType = fem::TensorProductBasis<ElementType, kQuadratureOrder>;
+            MeshType const M(V, C);
+            MatrixX const GNeg = fem::ShapeFunctionGradients<kQuadratureOrder>(M);
+            MatrixX Jinvg{};
+            auto const order = fem::InverseJacobiansAtQuadraturePoints<ElementType, kDims>(
+                IndexVectorX{},
+                M.E.cols(),
+                GNeg,
+                Jinvg);
+            CHECK_EQ(order, kQuadratureOrder);
+            Matrix<kDims, ElementType::kNodes> const x = Matrix<kDims, ElementType::kNodes>::Random();
+            auto const F =
+                fem::DeformationGradients<ElementType, kQuadratureOrder, kDims>(x, Jinvg);
+            Matrix<kDims, kDims * BasisType::kPoints> Fexpected{};
+            for (auto g = 0; g < BasisType::kPoints; ++g)
+                Fexpected.template middleCols<kDims>(g * kDims) =
+                    x * GNeg.block<ElementType::kNodes, kDims>(0, g * kDims);
+            Scalar const FError = (F - Fexpected).norm() / Fexpected.norm();
+            CHECK_LE(FError, 1e-10);
+            // Transpose satisfies <P, F(x)> = <F^T(P), x>
+            Matrix<kDims, kDims * BasisType::kPoints> const P =
+                Matrix<kDims, kDims * BasisType::kPoints>::Random();
+            auto const y =
+                fem::DeformationGradientsTranspose<ElementType, kQuadratureOrder, kDims>(P, Jinvg);
+            Scalar const adjointError =
+                std::abs(P.cwiseProduct(F).sum() - y.cwiseProduct(x).sum()) /
+                std::abs(P.cwiseProduct(F).sum());
+            CHECK_LE(adjointError, 1e-10);
+        });
+    }
+}
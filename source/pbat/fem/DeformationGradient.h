@@ -12,6 +12,7 @@
 #define PBAT_FEM_DEFORMATIONGRADIENT_H
 
 #include "Concepts.h"
+#include "SumFactorization.h"
 #include "pbat/Aliases.h"
 #include "pbat/math/linalg/mini/BinaryOperations.h"
 #include "pbat/math/linalg/mini/Concepts.h"
@@ -43,6 +44,95 @@ auto DeformationGradient(
     return x * GP;
 }
 
+/**
+ * @brief Computes the deformation gradients \f$ \mathbf{F}_g = \mathbf{x} \nabla_\xi
+ * \mathbf{N}(\xi_g) \mathbf{J}^{-1}_g \f$ at all of a tensor product element's quadrature points
+ * via sum factorization.
+ *
+ * Costs \f$ O(p^{d+1}) \f$ rather than \f$ O(p^{2d}) \f$ for evaluating every shape function
+ * gradient at every quadrature point. See TensorProductBasis.
+ *
+ * @tparam TElement Tensor product element type
+ * @tparam QuadratureOrder Gauss-Legendre quadrature order
+ * @tparam Dims Problem dimensionality
+ * @tparam TDerivedx Eigen matrix expression
+ * @tparam TDerivedJinv Eigen matrix expression
+ * @param x `|# rows| x |# element nodes|` nodal coefficients
+ * @param Jinv `|TElement::kDims| x |Dims * # quad.pts.|` inverse jacobians at the element's
+ * quadrature points (see InverseJacobiansAtQuadraturePoints())
+ * @return `|# rows| x |Dims * # quad.pts.|` deformation gradients, with \f$ \mathbf{F}_g \f$ in
+ * block column g
+ */
+template <
+    CTensorProductElement TElement,
+    int QuadratureOrder,
+    int Dims,
+    class TDerivedx,
+    class TDerivedJinv>
+auto DeformationGradients(
+    Eigen::MatrixBase<TDerivedx> const& x,
+    Eigen::MatrixBase<TDerivedJinv> const& Jinv)
+    -> Matrix<
+        TDerivedx::RowsAtCompileTime,
+        Dims * TensorProductBasis<TElement, QuadratureOrder>::kPoints>
+{
+    using BasisType        = TensorProductBasis<TElement, QuadratureOrder>;
+    auto constexpr kPoints = BasisType::kPoints;
+    auto const GxRef       = BasisType::ReferenceGradients(x);
+    Matrix<TDerivedx::RowsAtCompileTime, Dims * kPoints> F(x.rows(), Dims * kPoints);
+    for (auto g = 0; g < kPoints; ++g)
+    {
+        F.template middleCols<Dims>(g * Dims) =
+            GxRef.template middleCols<TElement::kDims>(g * TElement::kDims) *
+            Jinv.template block<TElement::kDims, Dims>(0, g * Dims);
+    }
+    return F;
+}
+
+/**
+ * @brief Transpose of DeformationGradients(), i.e. computes \f$ \mathbf{y}_i = \sum_g
+ * \mathbf{P}_g \mathbf{J}^{-T}_g \nabla_\xi N_i(\xi_g) \f$ via sum factorization.
+ *
+ * With \f$ \mathbf{P}_g \f$ the (weighted) stresses \f$ w_g \frac{\partial \Psi}{\partial
+ * \mathbf{F}} \f$ at quadrature points, this is the element gradient \f$ \frac{\partial
+ * \Psi}{\partial \mathbf{x}} \f$.
+ *
+ * @tparam TElement Tensor product element type
+ * @tparam QuadratureOrder Gauss-Legendre quadrature order
+ * @tparam Dims Problem dimensionality
+ * @tparam TDerivedP Eigen matrix expression
+ * @tparam TDerivedJinv Eigen matrix expression
+ * @param P `|# rows| x |Dims * # quad.pts.|` matrices at quadrature points, with \f$ \mathbf{P}_g
+ * \f$ in block column g
+ * @param Jinv `|TElement::kDims| x |Dims * # quad.pts.|` inverse jacobians at the element's
+ * quadrature points (see InverseJacobiansAtQuadraturePoints())
+ * @return `|# rows| x |# element nodes|` nodal contributions
+ */
+template <
+    CTensorProductElement TElement,
+    int QuadratureOrder,
+    int Dims,
+    class TDerivedP,
+    class TDerivedJinv>
+auto DeformationGradientsTranspose(
+    Eigen::MatrixBase<TDerivedP> const& P,
+    Eigen::MatrixBase<TDerivedJinv> const& Jinv)
+    -> Matrix<TDerivedP::RowsAtCompileTime, TElement::kNodes>
+{
+    using BasisType        = TensorProductBasis<TElement, QuadratureOrder>;
+    auto constexpr kPoints = BasisType::kPoints;
+    Matrix<TDerivedP::RowsAtCompileTime, TElement::kDims * kPoints> PRef(
+        P.rows(),
+        TElement::kDims * kPoints);
+    for (auto g = 0; g < kPoints; ++g)
+    {
+        PRef.template middleCols<TElement::kDims>(g * TElement::kDims) =
+            P.template middleCols<Dims>(g * Dims) *
+            Jinv.template block<TElement::kDims, Dims>(0, g * Dims).transpose();
+    }
+    return BasisType::IntegrateReferenceGradients(PRef);
+}
+
 /**
  * @brief Computes \f$ \frac{\partial \Psi}{\partial \mathbf{x}_i} \in \mathbb{R}^d \f$, i.e. the
  * gradient of a scalar function \f$ \Psi \f$ w.r.t. the \f$ i^{\text{th}}
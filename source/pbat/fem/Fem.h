@@ -21,6 +21,7 @@ namespace pbat::fem {
 #include "DeformationGradient.h"
 #include "DivergenceVector.h"
 #include "Gradient.h"
+#include "GridMesh.h"
 #include "Hexahedron.h"
 #include "HyperElasticPotential.h"
 #include "Jacobian.h"
@@ -29,9 +30,11 @@ namespace pbat::fem {
 #include "LoadVector.h"
 #include "MassMatrix.h"
 #include "Mesh.h"
+#include "MultiMaterialHyperElasticPotential.h"
 #include "QuadratureRules.h"
 #include "Quadrilateral.h"
 #include "ShapeFunctions.h"
+#include "SumFactorization.h"
 #include "Tetrahedron.h"
 #include "Triangle.h"
 
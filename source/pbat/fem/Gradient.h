@@ -209,22 +209,23 @@ inline void Gradient<TMesh>::Apply(
         throw std::invalid_argument(what);
     }
     // Compute gradient
+    // Every quadrature point only writes its own gradient components, hence quadrature points are
+    // processed in parallel without races
     auto constexpr kNodesPerElement     = ElementType::kNodes;
     auto const numberOfQuadraturePoints = eg.size();
     for (auto c = 0; c < x.cols(); ++c)
     {
-        for (auto g = 0; g < numberOfQuadraturePoints; ++g)
-        {
+        tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
             auto const e     = eg(g);
             auto const nodes = mesh.E.col(e);
             auto const xe    = x.col(c)(nodes);
             auto const Geg   = GNeg.block<kNodesPerElement, kDims>(0, g * kDims);
             for (auto d = 0; d < kDims; ++d)
             {
-                y(d * numberOfQuadraturePoints + g) +=
+                y(d * numberOfQuadraturePoints + g, c) +=
                     Geg(Eigen::placeholders::all, d).transpose() * xe;
             }
-        }
+        });
     }
 }
 
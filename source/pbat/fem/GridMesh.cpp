@@ -0,0 +1,140 @@
+#include "GridMesh.h"
+
+#include "HyperElasticPotential.h"
+#include "Jacobian.h"
+#include "LaplacianMatrix.h"
+#include "MassMatrix.h"
+#include "Mesh.h"
+#include "ShapeFunctions.h"
+
+#include <doctest/doctest.h>
+#include <pbat/physics/StableNeoHookeanEnergy.h>
+
+TEST_CASE("[fem] GridMesh")
+{
+    using namespace pbat;
+    Scalar constexpr zero = 1e-10;
+    auto constexpr kDims  = 3;
+    using GridMeshType    = fem::GridMesh<kDims>;
+    using ElementType     = GridMeshType::ElementType;
+    using MeshType        = fem::Mesh<ElementType, kDims>;
+    CHECK(fem::CMesh<GridMeshType>);
+    CHECK(fem::CGridMesh<GridMeshType>);
+    CHECK_FALSE(fem::CGridMesh<MeshType>);
+
+    Vector<kDims> const x0{-1., 0.5, 2.};
+    Vector<kDims> const h{0.5, 1., 0.25};
+    IndexVector<kDims> const n{3, 2, 2};
+    GridMeshType const grid(x0, h, n);
+    CHECK_EQ(grid.X.cols(), 4 * 3 * 3);
+    CHECK_EQ(grid.E.rows(), ElementType::kNodes);
+    CHECK_EQ(grid.E.cols(), 3 * 2 * 2);
+    // Local node a of cell (i,j,k) is node (i,j,k) + (a_0,a_1,a_2), at X_{ijk} + diag(h) Xi_a
+    for (auto k = 0; k < n(2); ++k)
+    {
+        for (auto j = 0; j < n(1); ++j)
+        {
+            for (auto i = 0; i < n(0); ++i)
+            {
+                auto const e = grid.Cell(IndexVector<kDims>{i, j, k});
+                for (auto a = 0; a < ElementType::kNodes; ++a)
+                {
+                    IndexVector<kDims> const offset{a & 1, (a >> 1) & 1, (a >> 2) & 1};
+                    IndexVector<kDims> const ijk = IndexVector<kDims>{i, j, k} + offset;
+                    CHECK_EQ(grid.E(a, e), grid.Node(ijk));
+                    Vector<kDims> const Xa = x0 + h.cwiseProduct(ijk.cast<Scalar>());
+                    CHECK_LE((grid.X.col(grid.E(a, e)) - Xa).norm(), zero);
+                }
+            }
+        }
+    }
+    CHECK_THROWS_AS(
+        GridMeshType(x0, Vector<kDims>{0.5, -1., 0.25}, n),
+        std::invalid_argument);
+
+    // Shared cell operators must match operators on the explicit mesh
+    MeshType const mesh(grid.X, IndexMatrixX(grid.E));
+    auto constexpr kQuadratureOrder = 2;
+    auto constexpr kDofs            = 3;
+    auto const numberOfDofs         = kDofs * grid.X.cols();
+    MatrixX const X                 = MatrixX::Random(numberOfDofs, 2);
+    auto const relativeError        = [](MatrixX const& A, MatrixX const& B) {
+        return (A - B).norm() / B.norm();
+    };
+    SUBCASE("MassMatrix")
+    {
+        MatrixX const detJe = fem::DeterminantOfJacobian<kQuadratureOrder>(grid);
+        fem::MassMatrix<GridMeshType, kQuadratureOrder> const M(grid, detJe, 2., kDofs);
+        CHECK(M.HasSharedElementMassMatrix());
+        CHECK_EQ(M.Me.cols(), ElementType::kNodes);
+        Matrix<ElementType::kNodes, ElementType::kNodes> const MeExpected =
+            2. * grid.CellMassMatrix<kQuadratureOrder>();
+        CHECK_LE(relativeError(M.Me, MeExpected), zero);
+        fem::MassMatrix<MeshType, kQuadratureOrder> const Mexplicit(mesh, detJe, 2., kDofs);
+        CSCMatrix const MExpected = Mexplicit.ToMatrix();
+        MatrixX MX                = MatrixX::Zero(numberOfDofs, 2);
+        M.Apply(X, MX);
+        CHECK_LE(relativeError(MX, MExpected * X), zero);
+        CHECK_LE(relativeError(MatrixX(M.ToMatrix()), MatrixX(MExpected)), zero);
+        CHECK_LE((M.ToLumpedMasses() - Mexplicit.ToLumpedMasses()).norm(), zero);
+    }
+    SUBCASE("SymmetricLaplacianMatrix")
+    {
+        MatrixX const GNeg = grid.CellShapeFunctionGradients<kQuadratureOrder>();
+        VectorX const wg   = fem::InnerProductWeights<kQuadratureOrder>(mesh).reshaped();
+        auto const kPoints = wg.size() / grid.E.cols();
+        IndexVectorX const eg =
+            IndexVectorX::LinSpaced(grid.E.cols(), Index(0), grid.E.cols() - 1)
+                .replicate(1, kPoints)
+                .transpose()
+                .reshaped();
+        fem::SymmetricLaplacianMatrix<GridMeshType> const L(grid, eg, wg, GNeg, kDofs);
+        CHECK_EQ(L.cellQuadraturePoints, kPoints);
+        CHECK(L.HasSharedElementLaplacian());
+        CHECK_LE(relativeError(L.deltag, grid.CellLaplacianMatrix<kQuadratureOrder>()), zero);
+        MatrixX const GNegExplicit = fem::ShapeFunctionGradients<kQuadratureOrder>(mesh);
+        fem::SymmetricLaplacianMatrix<MeshType> const Lexplicit(mesh, eg, wg, GNegExplicit, kDofs);
+        CSCMatrix const LExpected = Lexplicit.ToMatrix();
+        MatrixX LX                = MatrixX::Zero(numberOfDofs, 2);
+        L.Apply(X, LX);
+        CHECK_LE(relativeError(LX, LExpected * X), zero);
+        CHECK_LE(relativeError(MatrixX(L.ToMatrix()), MatrixX(LExpected)), zero);
+    }
+    SUBCASE("HyperElasticPotential")
+    {
+        using ElasticEnergyType = physics::StableNeoHookeanEnergy<kDims>;
+        Scalar constexpr Y      = 1e6;
+        Scalar constexpr nu     = 0.45;
+        MatrixX const GNeg      = grid.CellShapeFunctionGradients<kQuadratureOrder>();
+        VectorX const wg        = fem::InnerProductWeights<kQuadratureOrder>(mesh).reshaped();
+        auto const kPoints      = wg.size() / grid.E.cols();
+        IndexVectorX const eg =
+            IndexVectorX::LinSpaced(grid.E.cols(), Index(0), grid.E.cols() - 1)
+                .replicate(1, kPoints)
+                .transpose()
+                .reshaped();
+        fem::HyperElasticPotential<GridMeshType, ElasticEnergyType> U(grid, eg, wg, GNeg, Y, nu);
+        CHECK_EQ(U.cellQuadraturePoints, kPoints);
+        MatrixX const GNegExplicit = fem::ShapeFunctionGradients<kQuadratureOrder>(mesh);
+        fem::HyperElasticPotential<MeshType, ElasticEnergyType> Uexplicit(
+            mesh,
+            eg,
+            wg,
+            GNegExplicit,
+            Y,
+            nu);
+        VectorX const x = grid.X.reshaped() + 0.1 * VectorX::Random(numberOfDofs);
+        U.ComputeElementElasticity(x, true, true, false);
+        Uexplicit.ComputeElementElasticity(x, true, true, false);
+        CHECK_LE(std::abs(U.Eval() - Uexplicit.Eval()), zero * std::abs(Uexplicit.Eval()));
+        CHECK_LE(relativeError(U.ToVector(), Uexplicit.ToVector()), zero);
+        CSCMatrix const HExpected = Uexplicit.ToMatrix();
+        CHECK_LE(relativeError(MatrixX(U.ToMatrix()), MatrixX(HExpected)), zero);
+        U.SetHessianStorage(fem::EHessianStorage::MatrixFree);
+        CHECK_EQ(U.quadratureOrder, 0);
+        U.ComputeElementElasticity(x, true, true, false);
+        MatrixX HX = MatrixX::Zero(numberOfDofs, 2);
+        U.Apply(X, HX);
+        CHECK_LE(relativeError(HX, HExpected * X), zero);
+    }
+}
@@ -0,0 +1,506 @@
+/**
+ * @file GridMesh.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Structured (i.e. voxel) grid finite element mesh with implicit connectivity
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PBAT_FEM_GRIDMESH_H
+#define PBAT_FEM_GRIDMESH_H
+
+#include "Concepts.h"
+#include "Hexahedron.h"
+#include "Line.h"
+#include "Mesh.h"
+#include "Quadrilateral.h"
+
+#include <array>
+#include <exception>
+#include <fmt/core.h>
+#include <pbat/Aliases.h>
+#include <pbat/common/Eigen.h>
+#include <pbat/profiling/Profiling.h>
+#include <tbb/parallel_for.h>
+#include <type_traits>
+
+namespace pbat {
+namespace fem {
+
+namespace detail {
+
+template <int Dims>
+struct GridElement;
+
+template <>
+struct GridElement<1>
+{
+    using type = Line<1>;
+};
+
+template <>
+struct GridElement<2>
+{
+    using type = Quadrilateral<1>;
+};
+
+template <>
+struct GridElement<3>
+{
+    using type = Hexahedron<1>;
+};
+
+/**
+ * @brief Nullary functor computing the node \f$ (i+a_0, j+a_1, k+a_2) \f$ of local node \f$ a \f$
+ * of grid cell \f$ (i,j,k) \f$, with cells and nodes both indexed lexicographically
+ *
+ * @tparam Dims Grid dimensions
+ */
+template <int Dims>
+struct GridConnectivity
+{
+    static GridConnectivity Make(IndexVector<Dims> const& n)
+    {
+        GridConnectivity connectivity{};
+        for (auto d = 0; d < Dims; ++d)
+            connectivity.cells[static_cast<std::size_t>(d)] = n(d);
+        return connectivity;
+    }
+
+    Index operator()(Index a, Index e) const
+    {
+        Index node   = 0;
+        Index stride = 1;
+        for (auto d = 0; d < Dims; ++d)
+        {
+            auto const cd = static_cast<std::size_t>(d);
+            Index const i = e % cells[cd];
+            e /= cells[cd];
+            node += (i + ((a >> d) & 1)) * stride;
+            stride *= cells[cd] + 1;
+        }
+        return node;
+    }
+
+    std::array<Index, Dims> cells; ///< Number of cells along each axis
+};
+
+} // namespace detail
+
+/**
+ * @brief A regular grid of axis-aligned, geometrically identical linear cells (i.e. lines,
+ * quadrilaterals or hexahedra), such as the voxel grid embedding an asset.
+ *
+ * Satisfies concept CMesh, such that it can be used with any finite element operator. Element
+ * connectivity is never stored, but computed from cell and node multi-indices \f$ (i,j,k) \f$ on
+ * access to GridMesh::E. Since all cells are identical, they share a single reference mass,
+ * stiffness and shape function gradient stencil (see CellMassMatrix(),
+ * CellLaplacianMatrix() and CellShapeFunctionGradients()), which ApplyStencil() applies without
+ * any element or adjacency storage.
+ *
+ * MassMatrix, SymmetricLaplacianMatrix and HyperElasticPotential detect grid meshes, and then
+ * store (and apply) a single cell's data.
+ *
+ * @tparam Dims Grid dimensions
+ */
+template <int Dims>
+struct GridMesh
+{
+    static_assert(Dims >= 1 and Dims <= 3, "GridMesh only exists in 1, 2 or 3 dimensions");
+
+    using ElementType = typename detail::GridElement<Dims>::type; ///< Cell element type
+    using ConnectivityType =
+        Eigen::CwiseNullaryOp<detail::GridConnectivity<Dims>, IndexMatrixX>; ///< Implicit
+                                                                               ///< connectivity
+    static int constexpr kDims  = Dims;                ///< Embedding dimensions of the mesh
+    static int constexpr kOrder = ElementType::kOrder; ///< Shape function order
+
+    /**
+     * @brief Construct a grid of `n[0] x n[1] x n[2]` cells of extents `h`
+     *
+     * @param x0 Position of the grid's lowest corner
+     * @param h Cell extents
+     * @param n Number of cells along each axis
+     * @pre `(h.array() > 0).all()` and `(n.array() > 0).all()`
+     */
+    GridMesh(Vector<Dims> const& x0, Vector<Dims> const& h, IndexVector<Dims> const& n);
+
+    /**
+     * @brief Lexicographic index of cell \f$ (i,j,k) \f$
+     * @param ijk Cell multi-index
+     * @return Cell index
+     */
+    Index Cell(IndexVector<Dims> const& ijk) const;
+    /**
+     * @brief Lexicographic index of node \f$ (i,j,k) \f$
+     * @param ijk Node multi-index
+     * @return Node index
+     */
+    Index Node(IndexVector<Dims> const& ijk) const;
+
+    /**
+     * @brief Compute quadrature points in domain space on this mesh.
+     * @tparam QuadratureOrder Quadrature order
+     * @return `kDims x |# element quad.pts.|` matrix of quadrature points
+     */
+    template <int QuadratureOrder>
+    MatrixX QuadraturePoints() const;
+    /**
+     * @brief Obtain quadrature weights on the reference element of this mesh
+     * @tparam QuadratureOrder Quadrature order
+     * @return `|# element quad.pts.|` vector of quadrature weights
+     */
+    template <int QuadratureOrder>
+    Vector<ElementType::template QuadratureType<QuadratureOrder>::kPoints>
+    QuadratureWeights() const;
+
+    /**
+     * @brief Quadrature weights \f$ w_g |\mathbf{J}| \f$ of any cell
+     * @tparam QuadratureOrder Quadrature order
+     * @return `|# cell quad.pts.|` vector of quadrature weights
+     */
+    template <int QuadratureOrder>
+    Vector<ElementType::template QuadratureType<QuadratureOrder>::kPoints>
+    CellQuadratureWeights() const;
+    /**
+     * @brief Shape function gradients of any cell at its quadrature points
+     *
+     * Can be given as shared shape function gradients to SymmetricLaplacianMatrix and
+     * HyperElasticPotential.
+     *
+     * @tparam QuadratureOrder Quadrature order
+     * @return `|ElementType::kNodes| x |kDims * # cell quad.pts.|` shape function gradients
+     */
+    template <int QuadratureOrder>
+    MatrixX CellShapeFunctionGradients() const;
+    /**
+     * @brief Mass matrix \f$ \int_{\Omega_e} \phi_i \phi_j \f$ of any cell
+     * @tparam QuadratureOrder Quadrature order
+     * @return `|ElementType::kNodes| x |ElementType::kNodes|` cell mass matrix
+     */
+    template <int QuadratureOrder>
+    Matrix<ElementType::kNodes, ElementType::kNodes> CellMassMatrix() const;
+    /**
+     * @brief Symmetric laplacian \f$ -\int_{\Omega_e} \nabla \phi_i \cdot \nabla \phi_j \f$ of any
+     * cell
+     * @tparam QuadratureOrder Quadrature order
+     * @return `|ElementType::kNodes| x |ElementType::kNodes|` cell laplacian matrix
+     */
+    template <int QuadratureOrder>
+    Matrix<ElementType::kNodes, ElementType::kNodes> CellLaplacianMatrix() const;
+
+    /**
+     * @brief Applies the operator \f$ \sum_e \mathbf{P}_e^T \mathbf{K}_e \mathbf{P}_e \otimes
+     * \mathbf{I}_d \f$ assembled from the cell stencil \f$ \mathbf{K}_e \f$ shared by all cells,
+     * adding the result to y
+     *
+     * Nodes gather the products of their (at most \f$ 2^d \f$) incident cells, such that the
+     * parallel product is race-free and requires no adjacency storage.
+     *
+     * @tparam TDerivedK Eigen dense expression type
+     * @tparam TDerivedIn Eigen dense expression type
+     * @tparam TDerivedOut Eigen dense expression type
+     * @param Ke `|ElementType::kNodes| x |ElementType::kNodes|` cell stencil
+     * @param x `|# nodes * dims| x k` input
+     * @param y `|# nodes * dims| x k` output
+     * @param dims Dimensionality of image of FEM function space
+     */
+    template <class TDerivedK, class TDerivedIn, class TDerivedOut>
+    void ApplyStencil(
+        Eigen::MatrixBase<TDerivedK> const& Ke,
+        Eigen::MatrixBase<TDerivedIn> const& x,
+        Eigen::DenseBase<TDerivedOut>& y,
+        int dims = 1) const;
+
+    Vector<Dims> x0;      ///< Position of the grid's lowest corner
+    Vector<Dims> h;       ///< Cell extents
+    IndexVector<Dims> n;  ///< Number of cells along each axis
+    MatrixX X;            ///< `kDims x |# nodes|` nodal positions
+    ConnectivityType E;   ///< `|Element::Nodes| x |# elements|` implicit element nodal indices
+};
+
+namespace detail {
+
+template <class TMesh>
+struct IsGridMesh : std::false_type
+{
+};
+
+template <int Dims>
+struct IsGridMesh<GridMesh<Dims>> : std::true_type
+{
+};
+
+} // namespace detail
+
+/**
+ * @brief Structured grid mesh, i.e. GridMesh
+ * @tparam TMesh Mesh type
+ */
+template <class TMesh>
+concept CGridMesh = CMesh<TMesh> and detail::IsGridMesh<std::remove_cvref_t<TMesh>>::value;
+
+/**
+ * @brief Number of quadrature points per cell, if the shape function gradients GNeg hold a single
+ * grid cell's gradients at its quadrature points (see GridMesh::CellShapeFunctionGradients()),
+ * shared by all cells of the grid.
+ *
+ * Quadrature points must then be stored cell by cell, i.e. quadrature point g is local quadrature
+ * point `g % |# cell quad.pts.|` of cell `g / |# cell quad.pts.|`.
+ *
+ * @tparam TMesh Mesh type
+ * @param mesh Finite element mesh
+ * @param eg `|# quad.pts.|` elements of quadrature points, or empty if quadrature point g is in
+ * element g
+ * @param numberOfQuadraturePoints Number of quadrature points
+ * @param GNeg Shape function gradients
+ * @return Number of quadrature points per cell, or 0 if GNeg is not shared
+ */
+template <CMesh TMesh>
+Index NumberOfSharedCellQuadraturePoints(
+    TMesh const& mesh,
+    Eigen::Ref<IndexVectorX const> const& eg,
+    Index numberOfQuadraturePoints,
+    Eigen::Ref<MatrixX const> const& GNeg)
+{
+    if constexpr (not CGridMesh<TMesh>)
+    {
+        return Index{0};
+    }
+    else
+    {
+        auto const numberOfElements = mesh.E.cols();
+        auto const numberOfCellQuadraturePoints = GNeg.cols() / TMesh::kDims;
+        bool const bIsShared = GNeg.rows() == TMesh::ElementType::kNodes and
+                               numberOfCellQuadraturePoints > 0 and
+                               GNeg.cols() == TMesh::kDims * numberOfCellQuadraturePoints and
+                               numberOfCellQuadraturePoints * numberOfElements ==
+                                   numberOfQuadraturePoints;
+        if (not bIsShared)
+            return Index{0};
+        if (eg.size() != 0)
+        {
+            for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+                if (eg(g) != g / numberOfCellQuadraturePoints)
+                    return Index{0};
+        }
+        return numberOfCellQuadraturePoints;
+    }
+}
+
+template <int Dims>
+inline GridMesh<Dims>::GridMesh(
+    Vector<Dims> const& x0In,
+    Vector<Dims> const& hIn,
+    IndexVector<Dims> const& nIn)
+    : x0(x0In),
+      h(hIn),
+      n(nIn),
+      X(),
+      E(ElementType::kNodes,
+        (nIn.array() > 0).all() ? nIn.prod() : Index{0},
+        detail::GridConnectivity<Dims>::Make(nIn))
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.GridMesh.Construct");
+    if ((h.array() <= 0.).any() or (n.array() <= 0).any())
+    {
+        std::string const what = fmt::format(
+            "Expected positive cell extents and numbers of cells, but got min(h)={} and "
+            "min(n)={}",
+            h.minCoeff(),
+            n.minCoeff());
+        throw std::invalid_argument(what);
+    }
+    IndexVector<Dims> const nodes = n.array() + 1;
+    X.resize(Dims, nodes.prod());
+    tbb::parallel_for(Index{0}, Index{X.cols()}, [&](Index i) {
+        Index r = i;
+        for (auto d = 0; d < Dims; ++d)
+        {
+            X(d, i) = x0(d) + static_cast<Scalar>(r % nodes(d)) * h(d);
+            r /= nodes(d);
+        }
+    });
+}
+
+template <int Dims>
+inline Index GridMesh<Dims>::Cell(IndexVector<Dims> const& ijk) const
+{
+    Index e      = 0;
+    Index stride = 1;
+    for (auto d = 0; d < Dims; ++d)
+    {
+        e += ijk(d) * stride;
+        stride *= n(d);
+    }
+    return e;
+}
+
+template <int Dims>
+inline Index GridMesh<Dims>::Node(IndexVector<Dims> const& ijk) const
+{
+    Index i      = 0;
+    Index stride = 1;
+    for (auto d = 0; d < Dims; ++d)
+    {
+        i += ijk(d) * stride;
+        stride *= n(d) + 1;
+    }
+    return i;
+}
+
+template <int Dims>
+template <int QuadratureOrder>
+inline MatrixX GridMesh<Dims>::QuadraturePoints() const
+{
+    IndexMatrixX const C = E;
+    return detail::MeshQuadraturePoints<ElementType, kDims, QuadratureOrder>(X, C);
+}
+
+template <int Dims>
+template <int QuadratureOrder>
+inline Vector<GridMesh<Dims>::ElementType::template QuadratureType<QuadratureOrder>::kPoints>
+GridMesh<Dims>::QuadratureWeights() const
+{
+    return detail::MeshQuadratureWeights<ElementType, kDims, QuadratureOrder>();
+}
+
+template <int Dims>
+template <int QuadratureOrder>
+inline Vector<GridMesh<Dims>::ElementType::template QuadratureType<QuadratureOrder>::kPoints>
+GridMesh<Dims>::CellQuadratureWeights() const
+{
+    return QuadratureWeights<QuadratureOrder>() * h.prod();
+}
+
+template <int Dims>
+template <int QuadratureOrder>
+inline MatrixX GridMesh<Dims>::CellShapeFunctionGradients() const
+{
+    using QuadratureRuleType = typename ElementType::template QuadratureType<QuadratureOrder>;
+    auto constexpr kPoints   = QuadratureRuleType::kPoints;
+    auto const Xg            = common::ToEigen(QuadratureRuleType::points)
+                        .reshaped(QuadratureRuleType::kDims + 1, kPoints)
+                        .template bottomRows<ElementType::kDims>();
+    // Cells map the reference cell by X = x_e + diag(h) Xi, such that J^{-1} = diag(h)^{-1}
+    MatrixX GNe(ElementType::kNodes, kDims * kPoints);
+    for (auto g = 0; g < kPoints; ++g)
+    {
+        GNe.block<ElementType::kNodes, kDims>(0, g * kDims) =
+            ElementType::GradN(Xg.col(g)) * h.cwiseInverse().asDiagonal();
+    }
+    return GNe;
+}
+
+template <int Dims>
+template <int QuadratureOrder>
+inline Matrix<GridMesh<Dims>::ElementType::kNodes, GridMesh<Dims>::ElementType::kNodes>
+GridMesh<Dims>::CellMassMatrix() const
+{
+    using QuadratureRuleType = typename ElementType::template QuadratureType<QuadratureOrder>;
+    auto constexpr kPoints   = QuadratureRuleType::kPoints;
+    auto constexpr kNodes    = ElementType::kNodes;
+    auto const Xg            = common::ToEigen(QuadratureRuleType::points)
+                        .reshaped(QuadratureRuleType::kDims + 1, kPoints)
+                        .template bottomRows<ElementType::kDims>();
+    auto const wg                 = CellQuadratureWeights<QuadratureOrder>();
+    Matrix<kNodes, kNodes> Me     = Matrix<kNodes, kNodes>::Zero();
+    for (auto g = 0; g < kPoints; ++g)
+    {
+        Vector<kNodes> const Ng = ElementType::N(Xg.col(g));
+        Me += wg(g) * Ng * Ng.transpose();
+    }
+    return Me;
+}
+
+template <int Dims>
+template <int QuadratureOrder>
+inline Matrix<GridMesh<Dims>::ElementType::kNodes, GridMesh<Dims>::ElementType::kNodes>
+GridMesh<Dims>::CellLaplacianMatrix() const
+{
+    using QuadratureRuleType  = typename ElementType::template QuadratureType<QuadratureOrder>;
+    auto constexpr kPoints    = QuadratureRuleType::kPoints;
+    auto constexpr kNodes     = ElementType::kNodes;
+    auto const wg             = CellQuadratureWeights<QuadratureOrder>();
+    MatrixX const GNe         = CellShapeFunctionGradients<QuadratureOrder>();
+    Matrix<kNodes, kNodes> Le = Matrix<kNodes, kNodes>::Zero();
+    for (auto g = 0; g < kPoints; ++g)
+    {
+        auto const GP = GNe.block<kNodes, kDims>(0, g * kDims);
+        Le -= wg(g) * GP * GP.transpose();
+    }
+    return Le;
+}
+
+template <int Dims>
+template <class TDerivedK, class TDerivedIn, class TDerivedOut>
+inline void GridMesh<Dims>::ApplyStencil(
+    Eigen::MatrixBase<TDerivedK> const& Ke,
+    Eigen::MatrixBase<TDerivedIn> const& x,
+    Eigen::DenseBase<TDerivedOut>& y,
+    int dims) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.GridMesh.ApplyStencil");
+    auto constexpr kNodesPerElement = ElementType::kNodes;
+    auto const numberOfNodes        = X.cols();
+    auto const numberOfDofs         = dims * numberOfNodes;
+    bool const bAreInputsValid      = Ke.rows() == kNodesPerElement and
+                                 Ke.cols() == kNodesPerElement and dims >= 1 and
+                                 x.rows() == numberOfDofs and y.rows() == numberOfDofs and
+                                 x.cols() == y.cols();
+    if (not bAreInputsValid)
+    {
+        std::string const what = fmt::format(
+            "Expected {0}x{0} cell stencil, dims >= 1, and inputs and outputs with rows "
+            "|#nodes*dims|={1} and same number of columns, but got {2}x{3} stencil, dims={4}, and "
+            "x,y=({5},{6}), ({7},{8})",
+            kNodesPerElement,
+            numberOfDofs,
+            Ke.rows(),
+            Ke.cols(),
+            dims,
+            x.rows(),
+            x.cols(),
+            y.rows(),
+            y.cols());
+        throw std::invalid_argument(what);
+    }
+    Matrix<kNodesPerElement, kNodesPerElement> const K = Ke;
+    for (auto c = 0; c < x.cols(); ++c)
+    {
+        auto const xc = x.col(c).reshaped(dims, numberOfNodes);
+        auto yc       = y.col(c).reshaped(dims, numberOfNodes);
+        tbb::parallel_for(Index{0}, numberOfNodes, [&](Index i) {
+            IndexVector<Dims> ijk{};
+            Index r = i;
+            for (auto d = 0; d < Dims; ++d)
+            {
+                ijk(d) = r % (n(d) + 1);
+                r /= n(d) + 1;
+            }
+            // Node i is local node a of the cell whose lowest corner is (i,j,k) - (a_0,a_1,a_2)
+            for (auto a = 0; a < kNodesPerElement; ++a)
+            {
+                IndexVector<Dims> cell{};
+                bool bIsCellInGrid = true;
+                for (auto d = 0; d < Dims; ++d)
+                {
+                    cell(d) = ijk(d) - ((a >> d) & 1);
+                    bIsCellInGrid &= (cell(d) >= 0) and (cell(d) < n(d));
+                }
+                if (not bIsCellInGrid)
+                    continue;
+                auto const e = Cell(cell);
+                for (auto b = 0; b < kNodesPerElement; ++b)
+                    yc.col(i) += K(a, b) * xc.col(E(b, e));
+            }
+        });
+    }
+}
+
+} // namespace fem
+} // namespace pbat
+
+#endif // PBAT_FEM_GRIDMESH_H
@@ -1,14 +1,18 @@
 #include "HyperElasticPotential.h"
 
+#include "Hexahedron.h"
 #include "Jacobian.h"
 #include "Mesh.h"
 #include "ShapeFunctions.h"
 #include "Tetrahedron.h"
 
 #include <Eigen/Eigenvalues>
+#include <Eigen/Geometry>
 #include <doctest/doctest.h>
 #include <pbat/common/ConstexprFor.h>
 #include <pbat/math/LinearOperator.h>
+#include <pbat/physics/AsRigidAsPossibleEnergy.h>
+#include <pbat/physics/CorotationalEnergy.h>
 #include <pbat/physics/HyperElasticity.h>
 #include <pbat/physics/StableNeoHookeanEnergy.h>
 
@@ -82,6 +86,23 @@ TEST_CASE("[fem] HyperElasticPotential")
             (Htranslated - HMaterial).squaredNorm() / HMaterial.squaredNorm();
         CHECK_LE(hessianTranslationInvarianceError, zero);
 
+        // In-place assembly with precomputed sparsity matches triplet assembly
+        U.PrecomputeHessianSparsity();
+        CSCMatrix HinPlace = U.ToMatrix();
+        U.ComputeElementElasticity(x);
+        U.ToMatrix(HinPlace);
+        Scalar const inPlaceAssemblyError =
+            (HinPlace - HMaterial).squaredNorm() / HMaterial.squaredNorm();
+        CHECK_LE(inPlaceAssemblyError, zero);
+
+        // Block sparse assembly matches scalar assembly
+        auto HBlock = U.ToBlockMatrix();
+        U.ToBlockMatrix(HBlock);
+        CHECK_EQ(HBlock.OutputDimensions(), HMaterial.rows());
+        Scalar const blockAssemblyError =
+            (HBlock.ToMatrix() - HMaterial).squaredNorm() / HMaterial.squaredNorm();
+        CHECK_LE(blockAssemblyError, zero);
+
         // NOTE: Also invariant to rotations. We can likewise verify that the energy itself, and its
         // gradient are also invariant to translations and rotations, and are not invariant to
         // scaling, stretching, shearing, etc...
@@ -93,5 +114,191 @@ TEST_CASE("[fem] HyperElasticPotential")
         U.Apply(k * x + x, y);
         Scalar const linearityError = (y - yExpected).norm() / yExpected.norm();
         CHECK_LE(linearityError, zero);
+        MatrixX const XRhs = MatrixX::Random(x.size(), 3);
+        MatrixX YRhs       = MatrixX::Zero(x.size(), 3);
+        U.Apply(XRhs, YRhs);
+        Scalar const multipleRhsError = (YRhs - HMaterial * XRhs).norm() / YRhs.norm();
+        CHECK_LE(multipleRhsError, zero);
+
+        // Packed element hessians yield the same hessian, with less memory
+        for (auto eStorage : {fem::EHessianStorage::Packed, fem::EHessianStorage::PackedFloat})
+        {
+            U.SetHessianStorage(eStorage);
+            CHECK_EQ(U.Hg.size(), 0);
+            U.ComputeElementElasticity(x);
+            Scalar const Upacked = U.Eval();
+            CHECK_LE(std::abs(Upacked - UMaterial), zero);
+            VectorX const gradUPacked = U.ToVector();
+            CHECK_LE((gradUPacked - gradUMaterial).squaredNorm(), zero);
+            CSCMatrix const Hpacked = U.ToMatrix();
+            Scalar const packedHessianError =
+                (Hpacked - HMaterial).squaredNorm() / HMaterial.squaredNorm();
+            CHECK_LE(packedHessianError, zero);
+            U.PrecomputeHessianSparsity();
+            CSCMatrix HpackedInPlace = U.ToMatrix();
+            U.ToMatrix(HpackedInPlace);
+            Scalar const packedInPlaceAssemblyError =
+                (HpackedInPlace - HMaterial).squaredNorm() / HMaterial.squaredNorm();
+            CHECK_LE(packedInPlaceAssemblyError, zero);
+            Scalar const packedBlockAssemblyError =
+                (U.ToBlockMatrix().ToMatrix() - HMaterial).squaredNorm() / HMaterial.squaredNorm();
+            CHECK_LE(packedBlockAssemblyError, zero);
+            VectorX yPacked = VectorX::Zero(x.size());
+            U.Apply(k * x + x, yPacked);
+            Scalar const packedApplyError = (yPacked - yExpected).norm() / yExpected.norm();
+            CHECK_LE(packedApplyError, std::sqrt(zero));
+            auto const packedHessianSize =
+                (eStorage == fem::EHessianStorage::Packed) ? U.He.size() : U.Hef.size();
+            auto constexpr kDofsPerElement = ElasticPotentialType::kDofsPerElement;
+            CHECK_EQ(packedHessianSize, ElasticPotentialType::kPackedHessianSize * M.E.cols());
+            CHECK_LT(packedHessianSize, kDofsPerElement * kDofsPerElement * wg.size());
+        }
+
+        // Matrix-free hessian products match the assembled hessian
+        U.SetHessianStorage(fem::EHessianStorage::MatrixFree);
+        CHECK_EQ(U.Hg.size(), 0);
+        U.ComputeElementElasticity(x);
+        CHECK_EQ(U.Fg.cols(), wg.size());
+        CSCMatrix const HmatrixFree = U.ToMatrix();
+        Scalar const matrixFreeHessianError =
+            (HmatrixFree - HMaterial).squaredNorm() / HMaterial.squaredNorm();
+        CHECK_LE(matrixFreeHessianError, zero);
+        Scalar const matrixFreeBlockAssemblyError =
+            (U.ToBlockMatrix().ToMatrix() - HMaterial).squaredNorm() / HMaterial.squaredNorm();
+        CHECK_LE(matrixFreeBlockAssemblyError, zero);
+        VectorX const xDeformed = x + 0.1 * VectorX::Random(x.size());
+        U.ComputeElementElasticity(xDeformed, true, true, false);
+        CSCMatrix const HDeformed = U.ToMatrix();
+        VectorX yMatrixFree       = VectorX::Zero(x.size());
+        U.Apply(k * x + x, yMatrixFree);
+        VectorX const yMatrixFreeExpected = HDeformed * (k * x + x);
+        Scalar const matrixFreeApplyError =
+            (yMatrixFree - yMatrixFreeExpected).norm() / yMatrixFreeExpected.norm();
+        CHECK_LE(matrixFreeApplyError, zero);
+
+        U.SetHessianStorage(fem::EHessianStorage::Dense);
+        CHECK_EQ(U.Hg.cols(), ElasticPotentialType::kDofsPerElement * wg.size());
+        U.ComputeElementElasticity(xDeformed, true, true, false);
+        Scalar const matrixFreeVsDenseError =
+            (U.ToMatrix() - HDeformed).squaredNorm() / HDeformed.squaredNorm();
+        CHECK_LE(matrixFreeVsDenseError, zero);
+
+        // Hessians projected w.r.t. F are positive semi-definite and agree across storage layouts
+        VectorX const xInverted = x + 0.5 * VectorX::Random(x.size());
+        U.ComputeElementElasticity(xInverted, true, true, true);
+        CSCMatrix const HProjected = U.ToMatrix();
+        Eigen::SelfAdjointEigenSolver<MatrixX> projectedEigs(MatrixX{HProjected});
+        CHECK_GE(projectedEigs.eigenvalues().minCoeff(), -zero * HProjected.norm());
+        for (auto eStorage : {fem::EHessianStorage::Packed, fem::EHessianStorage::MatrixFree})
+        {
+            U.SetHessianStorage(eStorage);
+            U.ComputeElementElasticity(xInverted, true, true, true);
+            Scalar const projectedHessianError =
+                (U.ToMatrix() - HProjected).squaredNorm() / HProjected.squaredNorm();
+            CHECK_LE(projectedHessianError, zero);
+        }
+        U.SetHessianStorage(fem::EHessianStorage::Dense);
+        U.ComputeElementElasticity(xDeformed, true, true, false);
+
+        // Affine meshes need a single quadrature point per element, without element indirection
+        if constexpr (fem::CAffineElement<ElementType>)
+        {
+            VectorX const we  = fem::ElementInnerProductWeights(M);
+            MatrixX const GNe = fem::ElementShapeFunctionGradients(M);
+            CHECK_EQ(GNe.cols(), kDims * M.E.cols());
+            ElasticPotentialType UAffine(M, we, GNe, Y, nu);
+            CHECK_EQ(UAffine.eg.size(), 0);
+            for (auto eStorage : {fem::EHessianStorage::Dense, fem::EHessianStorage::Packed})
+            {
+                UAffine.SetHessianStorage(eStorage);
+                UAffine.ComputeElementElasticity(xDeformed, true, true, false);
+                Scalar const affineEnergyError =
+                    std::abs(UAffine.Eval() - U.Eval()) / std::abs(U.Eval());
+                CHECK_LE(affineEnergyError, zero);
+                Scalar const affineGradientError =
+                    (UAffine.ToVector() - U.ToVector()).norm() / U.ToVector().norm();
+                CHECK_LE(affineGradientError, zero);
+                Scalar const affineHessianError =
+                    (UAffine.ToMatrix() - HDeformed).squaredNorm() / HDeformed.squaredNorm();
+                CHECK_LE(affineHessianError, zero);
+            }
+        }
     });
+
+    // Corotational and ARAP energies are cheap material levels of detail, with rigid rest states
+    // and positive semi-definite hessians without projection
+    auto const checkLodEnergy = [&](auto Psi) {
+        using ElasticEnergyType    = decltype(Psi);
+        using MeshType             = fem::Mesh<fem::Tetrahedron<1>, 3>;
+        using ElasticPotentialType = fem::HyperElasticPotential<MeshType, ElasticEnergyType>;
+        MeshType const M(V, C);
+        VectorX const x   = M.X.reshaped();
+        VectorX const we  = fem::ElementInnerProductWeights(M);
+        MatrixX const GNe = fem::ElementShapeFunctionGradients(M);
+        ElasticPotentialType U(M, we, GNe, Y, nu);
+        Matrix<3, 3> const R   = Eigen::Quaternion<Scalar>::UnitRandom().toRotationMatrix();
+        VectorX const xRotated = (R * M.X).reshaped();
+        U.ComputeElementElasticity(xRotated, true, true, false);
+        CHECK_LE(std::abs(U.Eval()), zero);
+        CHECK_LE(U.ToVector().norm(), zero);
+        VectorX const xDeformed = x + 0.5 * VectorX::Random(x.size());
+        U.ComputeElementElasticity(xDeformed, true, true, false);
+        CSCMatrix const H = U.ToMatrix();
+        Eigen::SelfAdjointEigenSolver<MatrixX> eigs(MatrixX{H});
+        CHECK_GE(eigs.eigenvalues().minCoeff(), -zero * H.norm());
+        U.ComputeElementElasticity(xDeformed, true, true, true);
+        Scalar const projectionError = (U.ToMatrix() - H).squaredNorm() / H.squaredNorm();
+        CHECK_LE(projectionError, zero);
+    };
+    checkLodEnergy(physics::CorotationalEnergy<3>{});
+    checkLodEnergy(physics::AsRigidAsPossibleEnergy<3>{});
+
+    // Tensor product elements sum factorize matrix-free hessian products
+    {
+        MatrixX VH(3, 12);
+        IndexMatrixX CH(8, 2);
+        // clang-format off
+        VH << 0., 1., 0., 1., 0., 1., 0., 1., 2.5, 2., 2., 2.,
+              0., 0., 1., 1., 0., 0., 1., 1., 0.,  1., 0., 1.,
+              0., 0., 0., 0., 1., 1., 1., 1., 0.,  0., 1., 1.;
+        CH << 0, 1,
+              1, 8,
+              2, 3,
+              3, 9,
+              4, 5,
+              5, 10,
+              6, 7,
+              7, 11;
+        // clang-format on
+        common::ForRange<1, 3>([&]<auto kOrder>() {
+            auto constexpr kDims            = 3;
+            auto constexpr kQuadratureOrder = kOrder + 1;
+            using ElasticEnergyType         = physics::StableNeoHookeanEnergy<3>;
+            using ElementType               = fem::Hexahedron<kOrder>;
+            using MeshType                  = fem::Mesh<ElementType, kDims>;
+            using ElasticPotentialType = fem::HyperElasticPotential<MeshType, ElasticEnergyType>;
+            MeshType const M(VH, CH);
+            VectorX const x       = M.X.reshaped();
+            VectorX const wg      = fem::InnerProductWeights<kQuadratureOrder>(M).reshaped();
+            MatrixX const GNeg    = fem::ShapeFunctionGradients<kQuadratureOrder>(M);
+            IndexVectorX const eg = IndexVectorX::LinSpaced(M.E.cols(), Index(0), M.E.cols() - 1)
+                                        .replicate(1, wg.size() / M.E.cols())
+                                        .transpose()
+                                        .reshaped();
+            ElasticPotentialType U(M, eg, wg, GNeg, Y, nu);
+            VectorX const xDeformed = x + 0.1 * VectorX::Random(x.size());
+            U.ComputeElementElasticity(xDeformed, true, true, false);
+            CSCMatrix const H = U.ToMatrix();
+            U.SetHessianStorage(fem::EHessianStorage::MatrixFree);
+            CHECK_EQ(U.quadratureOrder, kQuadratureOrder);
+            U.ComputeElementElasticity(xDeformed, true, true, false);
+            Scalar const matrixFreeHessianError = (U.ToMatrix() - H).squaredNorm() / H.squaredNorm();
+            CHECK_LE(matrixFreeHessianError, zero);
+            MatrixX const X = MatrixX::Random(x.size(), 2);
+            MatrixX HX      = MatrixX::Zero(x.size(), 2);
+            U.Apply(X, HX);
+            Scalar const applyError = (HX - H * X).norm() / HX.norm();
+            CHECK_LE(applyError, zero);
+        });
+    }
 }
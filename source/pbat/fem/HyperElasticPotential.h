@@ -13,24 +13,46 @@
 
 #include "Concepts.h"
 #include "DeformationGradient.h"
+#include "GridMesh.h"
+#include "SumFactorization.h"
 #include "pbat/Aliases.h"
 #include "pbat/common/Eigen.h"
+#include "pbat/graph/Adjacency.h"
+#include "pbat/math/linalg/BlockSparseMatrix.h"
+#include "pbat/math/linalg/BlockSparsityPattern.h"
 #include "pbat/math/linalg/SparsityPattern.h"
 #include "pbat/math/linalg/mini/Eigen.h"
 #include "pbat/math/linalg/mini/Product.h"
+#include "pbat/physics/HyperElasticBatch.h"
 #include "pbat/physics/HyperElasticity.h"
+#include "pbat/physics/SpdProjection.h"
 #include "pbat/profiling/Profiling.h"
 
-#include <Eigen/SVD>
+#include <algorithm>
 #include <exception>
 #include <fmt/core.h>
+#include <ranges>
 #include <span>
 #include <string>
 #include <tbb/parallel_for.h>
+#include <type_traits>
 
 namespace pbat {
 namespace fem {
 
+/**
+ * @brief Storage layout of a HyperElasticPotential's hessian
+ */
+enum class EHessianStorage {
+    Dense,      ///< Dense element hessian at each quadrature point (default)
+    Packed,     ///< Packed upper triangular part of each element's hessian
+    PackedFloat, ///< Packed upper triangular part of each element's hessian in single precision
+    MatrixFree   ///< No stored hessians, Apply recomputes quadrature point hessians on the fly
+};
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+struct MultiMaterialHyperElasticPotential;
+
 /**
  * @brief Total hyper elastic potential \f$ U(\mathbf{x}) = \int_\Omega \Psi(\mathbf{F}) d\Omega \f$
  *
@@ -42,6 +64,10 @@ namespace fem {
  * \phi_g \f$ at quadrature points. This allows users to try out different quadrature rules
  * seamlessly.
  *
+ * On structured grids (see CGridMesh), the shape function gradients may be a single cell's
+ * (see GridMesh::CellShapeFunctionGradients()), shared by all cells whose quadrature points are
+ * then stored cell by cell.
+ *
  * @tparam TMesh Type satisfying concept CMesh
  * @tparam THyperElasticEnergy Type satisfying concept CHyperElasticEnergy
  */
@@ -58,6 +84,13 @@ struct HyperElasticPotential
         "Embedding dimensions of mesh must match dimensionality of hyper elastic energy.");
 
     static auto constexpr kDims = THyperElasticEnergy::kDims; ///< Number of spatial dimensions
+    static auto constexpr kDofsPerElement =
+        ElementType::kNodes * kDims; ///< Number of degrees of freedom per element
+    static auto constexpr kPackedHessianSize =
+        kDofsPerElement * (kDofsPerElement + 1) / 2; ///< Number of coefficients of a packed
+                                                     ///< element hessian
+    static auto constexpr kQuadraturePointBatchSize =
+        8; ///< Number of quadrature points whose energies are evaluated in one SIMD batch
 
     SelfType& operator=(SelfType const&) = delete;
 
@@ -157,7 +190,78 @@ struct HyperElasticPotential
         Eigen::DenseBase<TDerivedY> const& Y,
         Eigen::DenseBase<TDerivednu> const& nu);
     /**
-     * @brief Precomputes the sparsity pattern of the hessian matrix
+     * @brief Construct a new Hyper Elastic Potential object on an affine mesh, with a single
+     * quadrature point per element
+     *
+     * Affine elements have constant shape function gradients and deformation gradients, such that
+     * quadrature point g is element g, without any element indirection.
+     *
+     * @param mesh FEM mesh
+     * @param we \f$ |E| \f$ array of element inner product weights. See
+     * ElementInnerProductWeights().
+     * @param GNe Shape function gradients of elements. See ElementShapeFunctionGradients().
+     * @param Y Young's modulus
+     * @param nu Poisson's ratio
+     * @pre `we.size() == mesh.E.cols()` and `GNe.rows() == mesh.E.rows()`
+     */
+    HyperElasticPotential(
+        MeshType const& mesh,
+        Eigen::Ref<VectorX const> const& we,
+        Eigen::Ref<MatrixX const> const& GNe,
+        Scalar Y,
+        Scalar nu) requires CAffineElement<ElementType>;
+    /**
+     * @brief Construct a new Hyper Elastic Potential object on an affine mesh, with a single
+     * quadrature point per element
+     *
+     * @tparam TDerivedY Eigen dense expression type
+     * @tparam TDerivednu Eigen dense expression type
+     * @param mesh FEM mesh
+     * @param we \f$ |E| \f$ array of element inner product weights. See
+     * ElementInnerProductWeights().
+     * @param GNe Shape function gradients of elements. See ElementShapeFunctionGradients().
+     * @param Y \f$ |E| \f$ Young's moduli
+     * @param nu \f$ |E| \f$ Poisson's ratios
+     * @pre `we.size() == mesh.E.cols()` and `GNe.rows() == mesh.E.rows()`
+     * @pre `Y.size() == we.size()` and `nu.size() == we.size()`
+     */
+    template <class TDerivedY, class TDerivednu>
+    HyperElasticPotential(
+        MeshType const& mesh,
+        Eigen::Ref<VectorX const> const& we,
+        Eigen::Ref<MatrixX const> const& GNe,
+        Eigen::DenseBase<TDerivedY> const& Y,
+        Eigen::DenseBase<TDerivednu> const& nu) requires CAffineElement<ElementType>;
+    /**
+     * @brief Selects the hessian's storage layout
+     *
+     * Packed storage accumulates quadrature point hessians into the upper triangular part of
+     * their element's hessian, stored column by column, such that hessian memory no longer scales
+     * with the number of quadrature points per element.
+     *
+     * Matrix-free storage only caches deformation gradients at quadrature points, from which
+     * Apply recomputes the energy density's hessian and contracts it with the input's element
+     * DOFs.
+     *
+     * Resets the element hessians and any precomputed hessian sparsity, since its non-zero
+     * ordering depends on the storage layout.
+     *
+     * @param eStorage Hessian storage layout
+     */
+    void SetHessianStorage(EHessianStorage eStorage);
+    /**
+     * @brief Index of the upper triangular coefficient of (i,j) in a packed element hessian
+     *
+     * @param i Row index
+     * @param j Column index
+     * @return Index into a column of He or Hef
+     */
+    static constexpr Index PackedIndex(Index i, Index j)
+    {
+        return (i <= j) ? j * (j + 1) / 2 + i : i * (i + 1) / 2 + j;
+    }
+    /**
+     * @brief Precomputes the (scalar and block) sparsity patterns of the hessian matrix
      *
      * Enables parallel sparse hessian assembly in all future operations.
      */
@@ -169,8 +273,9 @@ struct HyperElasticPotential
      * @param x \f$ d \times n \f$ matrix of deformed nodal positions
      * @param bWithGradient Compute gradient
      * @param bWithHessian Compute hessian
-     * @param bUseSpdProjection Project per quadrature point hessians to nearest symmetric positive
-     * definite (SPD) matrix
+     * @param bUseSpdProjection Project the energy density's hessians w.r.t. the deformation
+     * gradient to the nearest symmetric positive semi-definite matrix (see physics::SpdHessian()),
+     * which yields positive semi-definite quadrature point hessians for any storage layout
      * @pre `x.rows() == mesh.X.rows() * mesh.kDims`
      */
     template <class TDerived>
@@ -189,6 +294,7 @@ struct HyperElasticPotential
      * @param x Input matrix
      * @param y Output matrix
      * @pre x.rows() == InputDimensions() and y.rows() == InputDimensions() and y.cols() == x.cols()
+     * @note Not thread-safe, since Apply() reuses this potential's scratch buffer
      */
     template <class TDerivedIn, class TDerivedOut>
     void Apply(Eigen::MatrixBase<TDerivedIn> const& x, Eigen::DenseBase<TDerivedOut>& y) const;
@@ -199,6 +305,29 @@ struct HyperElasticPotential
      * @return Sparse compressed column matrix representation of the hessian operator
      */
     CSCMatrix ToMatrix() const;
+    /**
+     * @brief Assembles the hessian matrix into H in-place, in parallel and without allocations
+     *
+     * @param H Sparse compressed column matrix with the precomputed hessian sparsity pattern, e.g.
+     * as returned by a previous call to ToMatrix()
+     * @pre PrecomputeHessianSparsity() has been called
+     */
+    void ToMatrix(CSCMatrix& H) const;
+    /**
+     * @brief Assembles the hessian matrix into block sparse row format with `kDims x kDims` nodal
+     * blocks
+     * @return Block sparse hessian matrix
+     */
+    math::linalg::BlockSparseMatrix<kDims> ToBlockMatrix() const;
+    /**
+     * @brief Assembles the block sparse hessian matrix into H in-place, in parallel and without
+     * allocations
+     *
+     * @param H Block sparse matrix with the precomputed hessian block sparsity pattern, e.g. as
+     * returned by a previous call to ToBlockMatrix()
+     * @pre PrecomputeHessianSparsity() has been called
+     */
+    void ToBlockMatrix(math::linalg::BlockSparseMatrix<kDims>& H) const;
 
     /**
      * @brief Transforms this per quadrature point gradient representation into the global gradient.
@@ -235,7 +364,8 @@ struct HyperElasticPotential
 
     MeshType const& mesh; ///< The finite element mesh
     Eigen::Ref<IndexVectorX const>
-        eg;                       ///< Maps quadrature point index g to its corresponding element e
+        eg; ///< Maps quadrature point index g to its corresponding element e. Empty for affine
+            ///< meshes with a single quadrature point per element, i.e. g is element g.
     Eigen::Ref<VectorX const> wg; ///< Vector of quadrature weights \f$ w \in \mathbb{R}^{|Q|} \f$
     Eigen::Ref<MatrixX const>
         GNeg; ///< `|ElementType::kNodes| x |MeshType::kDims * # element quadrature points *
@@ -246,10 +376,166 @@ struct HyperElasticPotential
                      ///< points
     MatrixX Hg;      ///< `|(ElementType::kNodes*kDims)| x |# quad.pts. *
                      ///< ElementType::kNodes*kDims|` element hessian matrices at quadrature points
+                     ///< (EHessianStorage::Dense only)
+    MatrixX He;      ///< `|kPackedHessianSize| x |# elements|` packed element hessians
+                     ///< (EHessianStorage::Packed only)
+    Eigen::MatrixXf Hef; ///< `|kPackedHessianSize| x |# elements|` single precision packed element
+                         ///< hessians (EHessianStorage::PackedFloat only)
     MatrixX Gg;      ///< `|ElementType::kNodes*kDims| x |#quad.pts.|` element gradient vectors at
                      ///< quadrature points
     VectorX Ug;      ///< `|# quad.pts.|` array of elastic potentials at quadrature points
     math::linalg::SparsityPattern GH; ///< Directed adjacency graph of hessian
+    math::linalg::BlockSparsityPattern<kDims> GHB; ///< Directed adjacency graph of hessian's
+                                                   ///< nodal blocks
+    EHessianStorage eHessianStorage;  ///< Hessian storage layout
+    IndexVectorX GEptr; ///< Element e's quadrature points are GEadj[GEptr[e]:GEptr[e+1]] (packed
+                        ///< storage only)
+    IndexVectorX GEadj; ///< Quadrature points of elements (packed storage only)
+    IndexVectorX GNptr; ///< Node i's hessian block contributions are GNadj[GNptr[i]:GNptr[i+1]]
+    IndexVectorX GNadj; ///< Block-local node indices `b*|# element nodes| + a` of nodes, where b
+                        ///< is a quadrature point (dense, matrix-free) or an element (packed, sum
+                        ///< factorized matrix-free)
+    mutable MatrixX yb; ///< `kDims x |# element nodes * # hessian blocks|` block-local products of
+                        ///< Apply(), cached across calls
+    MatrixX Fg; ///< `|kDims*kDims| x |# quad.pts.|` deformation gradients at quadrature points
+                ///< (EHessianStorage::MatrixFree only)
+    MatrixX Jinvg; ///< `|ElementType::kDims| x |MeshType::kDims * # quad.pts.|` inverse jacobians
+                   ///< at quadrature points (sum factorized EHessianStorage::MatrixFree only)
+    int quadratureOrder; ///< Detected Gauss-Legendre quadrature order of sum factorized
+                         ///< matrix-free hessian products, or 0
+    Index cellQuadraturePoints; ///< Number of quadrature points per grid cell if GNeg holds a
+                                ///< single cell's shape function gradients shared by all cells,
+                                ///< or 0 otherwise (see NumberOfSharedCellQuadraturePoints())
+    bool bIsMatrixFreeHessianSpdProjected; ///< Project recomputed hessians to SPD
+                                           ///< (EHessianStorage::MatrixFree only)
+
+  private:
+    template <CMesh TMeshOther, physics::CHyperElasticEnergy... THyperElasticEnergies>
+    friend struct MultiMaterialHyperElasticPotential;
+
+    /**
+     * @brief Recomputes the energy density's hessian w.r.t. the deformation gradient at
+     * quadrature point g from the cached deformation gradients
+     *
+     * @param g Quadrature point index
+     * @return `kDims^2 x kDims^2` hessian of the energy density
+     */
+    math::linalg::mini::SMatrix<Scalar, kDims * kDims, kDims * kDims>
+    MatrixFreeHessian(Index g) const;
+    /**
+     * @brief Element of quadrature point g
+     * @param g Quadrature point index
+     * @return Element index
+     */
+    Index QuadraturePointElement(Index g) const
+    {
+        if constexpr (CAffineElement<ElementType>)
+            return eg.size() == 0 ? g : eg(g);
+        else
+            return eg(g);
+    }
+    /**
+     * @brief Element of quadrature point g, where the quadrature point to element map is known at
+     * compile time
+     * @tparam kIsElementQuadrature True if quadrature point g is element g's single quadrature
+     * point, i.e. eg is empty
+     * @param g Quadrature point index
+     * @return Element index
+     */
+    template <bool kIsElementQuadrature>
+    Index QuadraturePointElement(Index g) const
+    {
+        if constexpr (kIsElementQuadrature)
+            return g;
+        else
+            return eg(g);
+    }
+    /**
+     * @brief Invoke f's call operator templated on whether quadrature points are in one-to-one
+     * correspondence with elements, so per quadrature point loops resolve their element lookup at
+     * compile time. Only affine elements can omit eg.
+     * @tparam Func Callable with a `template <bool kIsElementQuadrature> void operator()()`
+     * @param f Callable
+     */
+    template <class Func>
+    void DispatchQuadraturePointElements(Func&& f) const
+    {
+        if constexpr (CAffineElement<ElementType>)
+        {
+            if (eg.size() == 0)
+            {
+                f.template operator()<true>();
+                return;
+            }
+        }
+        f.template operator()<false>();
+    }
+    /**
+     * @brief Shape function gradients at quadrature point g
+     * @param g Quadrature point index
+     * @return `|# element nodes| x |MeshType::kDims|` block of GNeg
+     */
+    auto ShapeFunctionGradientsAt(Index g) const
+    {
+        if constexpr (CGridMesh<MeshType>)
+        {
+            auto const k = cellQuadraturePoints > 0 ? g % cellQuadraturePoints : g;
+            return GNeg.template block<ElementType::kNodes, MeshType::kDims>(
+                0,
+                k * MeshType::kDims);
+        }
+        else
+            return GNeg.template block<ElementType::kNodes, MeshType::kDims>(0, g * MeshType::kDims);
+    }
+    /**
+     * @brief Checks if the hessian is stored in packed element form
+     * @return True for EHessianStorage::Packed or EHessianStorage::PackedFloat
+     */
+    bool IsHessianPacked() const;
+    /**
+     * @brief Calls f with the range of (duplicate) hessian non-zeros, ordered as the non-zeros
+     * of PrecomputeHessianSparsity()
+     *
+     * Every hessian block (i.e. quadrature point for dense and matrix-free storage, element for
+     * packed storage) contributes its full column-major `kDofsPerElement x kDofsPerElement`
+     * matrix. Matrix-free hessian blocks are temporarily materialized.
+     *
+     * @tparam Func Callable with signature `void(auto&& nonZeros)`
+     * @param f Function to call
+     */
+    template <class Func>
+    void VisitHessianNonZeros(Func&& f) const;
+    /**
+     * @brief Number of hessian blocks
+     * @return |# quad.pts.| for dense and matrix-free storage, |# elements| for packed storage
+     */
+    Index NumberOfHessianBlocks() const;
+    /**
+     * @brief Element of hessian block b
+     * @param b Hessian block index
+     * @return Element index
+     */
+    Index HessianBlockElement(Index b) const;
+    /**
+     * @brief Computes the block sparsity pattern of the hessian's `kDims x kDims` nodal blocks
+     *
+     * Nodal block k is the nodal block (k % kNodes^2 % kNodes, k % kNodes^2 / kNodes) of
+     * hessian block k / kNodes^2.
+     *
+     * @return Block sparsity pattern
+     */
+    math::linalg::BlockSparsityPattern<kDims> ComputeHessianBlockSparsity() const;
+    /**
+     * @brief Nodal block k of the (duplicate) hessian non-zeros, as visited by
+     * VisitHessianNonZeros
+     *
+     * @tparam TNonZeroRange Random access range of hessian non-zeros
+     * @param nonZeros Hessian non-zeros
+     * @param k Nodal block index, ordered as in ComputeHessianBlockSparsity()
+     * @return `kDims x kDims` nodal block
+     */
+    template <class TNonZeroRange>
+    static Matrix<kDims, kDims> NodalHessianBlock(TNonZeroRange const& nonZeros, Index k);
 };
 
 template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
@@ -279,15 +565,64 @@ inline HyperElasticPotential<TMesh, THyperElasticEnergy>::HyperElasticPotential(
     Eigen::Ref<MatrixX const> const& GNeg,
     Eigen::DenseBase<TDerivedY> const& Y,
     Eigen::DenseBase<TDerivednu> const& nu)
-    : mesh(meshIn), eg(eg), wg(wg), GNeg(GNeg), mug(), lambdag(), Hg(), Gg(), Ug(), GH()
+    : mesh(meshIn),
+      eg(eg),
+      wg(wg),
+      GNeg(GNeg),
+      mug(),
+      lambdag(),
+      Hg(),
+      He(),
+      Hef(),
+      Gg(),
+      Ug(),
+      GH(),
+      GHB(),
+      eHessianStorage(EHessianStorage::Dense),
+      GEptr(),
+      GEadj(),
+      GNptr(),
+      GNadj(),
+      yb(),
+      Fg(),
+      Jinvg(),
+      quadratureOrder(0),
+      cellQuadraturePoints(NumberOfSharedCellQuadraturePoints(meshIn, eg, wg.size(), GNeg)),
+      bIsMatrixFreeHessianSpdProjected(true)
 {
     std::tie(mug, lambdag)              = physics::LameCoefficients(Y.reshaped(), nu.reshaped());
     auto const numberOfQuadraturePoints = wg.size();
-    auto constexpr kNodesPerElement     = ElementType::kNodes;
-    auto constexpr kDofsPerElement      = kNodesPerElement * kDims;
     Ug.setZero(numberOfQuadraturePoints);
     Gg.setZero(kDofsPerElement, numberOfQuadraturePoints);
-    Hg.setZero(kDofsPerElement, kDofsPerElement * numberOfQuadraturePoints);
+    SetHessianStorage(EHessianStorage::Dense);
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline HyperElasticPotential<TMesh, THyperElasticEnergy>::HyperElasticPotential(
+    MeshType const& meshIn,
+    Eigen::Ref<VectorX const> const& we,
+    Eigen::Ref<MatrixX const> const& GNe,
+    Scalar Y,
+    Scalar nu) requires CAffineElement<ElementType>
+    : HyperElasticPotential<TMesh, THyperElasticEnergy>(
+          meshIn,
+          we,
+          GNe,
+          VectorX::Constant(we.size(), Y),
+          VectorX::Constant(we.size(), nu))
+{
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+template <class TDerivedY, class TDerivednu>
+inline HyperElasticPotential<TMesh, THyperElasticEnergy>::HyperElasticPotential(
+    MeshType const& meshIn,
+    Eigen::Ref<VectorX const> const& we,
+    Eigen::Ref<MatrixX const> const& GNe,
+    Eigen::DenseBase<TDerivedY> const& Y,
+    Eigen::DenseBase<TDerivednu> const& nu) requires CAffineElement<ElementType>
+    : HyperElasticPotential<TMesh, THyperElasticEnergy>(meshIn, IndexVectorX{}, we, GNe, Y, nu)
+{
 }
 
 template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
@@ -348,108 +683,219 @@ inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::ComputeElementEla
         throw std::invalid_argument(what);
     }
 
+    bool const bIsHessianPacked     = IsHessianPacked();
+    bool const bIsHessianMatrixFree = eHessianStorage == EHessianStorage::MatrixFree;
+    bool const bWithStoredHessian   = bWithHessian and not bIsHessianMatrixFree;
     Ug.setZero();
     if (bWithGradient)
         Gg.setZero();
     if (bWithHessian)
-        Hg.setZero();
+    {
+        switch (eHessianStorage)
+        {
+            case EHessianStorage::Dense: Hg.setZero(); break;
+            case EHessianStorage::Packed: He.setZero(); break;
+            case EHessianStorage::PackedFloat: Hef.setZero(); break;
+            case EHessianStorage::MatrixFree: Fg.setZero(); break;
+        }
+    }
 
     ElasticEnergyType Psi{};
 
     // Compute element elastic energies and their derivatives
     auto const numberOfQuadraturePoints = wg.size();
     auto constexpr kNodesPerElement     = ElementType::kNodes;
-    auto constexpr kDofsPerElement      = kNodesPerElement * kDims;
     namespace mini                      = math::linalg::mini;
     using mini::FromEigen;
     using mini::ToEigen;
-    if (not bWithGradient and not bWithHessian)
-    {
-        tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
-            auto const e     = eg(g);
+    // Projecting hessians w.r.t. F, rather than w.r.t. element DOFs, preserves positive
+    // semi-definiteness through the (congruent) mapping to element DOFs, at a fraction of the cost
+    auto const hessianWrtF = [&](auto const& vecF, Index g) {
+        return bUseSpdProjection ? physics::SpdHessian(Psi, vecF, mug(g), lambdag(g)) :
+                                   Psi.hessian(vecF, mug(g), lambdag(g));
+    };
+    // Accumulates quadrature point hessians into packed element hessians. Parallelizing over
+    // elements makes accumulation race-free, since each quadrature point belongs to a single
+    // element.
+    auto const computePackedElementElasticity = [&](auto& Hpacked) {
+        using PackedScalar = typename std::remove_cvref_t<decltype(Hpacked)>::Scalar;
+        tbb::parallel_for(Index{0}, Index{mesh.E.cols()}, [&](Index e) {
             auto const nodes = mesh.E.col(e);
             auto const xe    = x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
-            auto const GPeg = GNeg.block<kNodesPerElement, MeshType::kDims>(0, g * MeshType::kDims);
-            Matrix<kDims, kDims> const F = xe * GPeg;
-            auto vecF                    = FromEigen(F);
-            auto psiF                    = Psi.eval(vecF, mug(g), lambdag(g));
-            Ug(g) += wg(g) * psiF;
+            auto hpe         = Hpacked.col(e);
+            for (auto k = GEptr(e); k < GEptr(e + 1); ++k)
+            {
+                auto const g = GEadj(k);
+                auto const GPeg  = ShapeFunctionGradientsAt(g);
+                Matrix<kDims, kDims> const F = xe * GPeg;
+                auto vecF                    = FromEigen(F);
+                mini::SVector<Scalar, kDims * kDims> gradPsiF;
+                auto psiF     = Psi.evalWithGrad(vecF, mug(g), lambdag(g), gradPsiF);
+                auto hessPsiF = hessianWrtF(vecF, g);
+                Ug(g) += wg(g) * psiF;
+                auto const GP = FromEigen(GPeg);
+                if (bWithGradient)
+                {
+                    auto GPsix = GradientWrtDofs<ElementType, kDims>(gradPsiF, GP);
+                    Gg.col(g) += wg(g) * ToEigen(GPsix);
+                }
+                auto HPsix = HessianWrtDofs<ElementType, kDims>(hessPsiF, GP);
+                for (Index j = 0; j < kDofsPerElement; ++j)
+                    for (Index i = 0; i <= j; ++i)
+                        hpe(PackedIndex(i, j)) += static_cast<PackedScalar>(wg(g) * HPsix(i, j));
+            }
         });
+    };
+    // Matrix-free hessians only need deformation gradients, which Apply uses to recompute
+    // quadrature point hessians on the fly
+    if (bWithHessian and bIsHessianMatrixFree and quadratureOrder > 0)
+    {
+        bIsMatrixFreeHessianSpdProjected = bUseSpdProjection;
+        if constexpr (CTensorProductElement<ElementType>)
+        {
+            DispatchSumFactorizedQuadratureOrder<ElementType>(
+                quadratureOrder,
+                [&]<auto QuadratureOrder>() {
+                    auto constexpr kPoints =
+                        TensorProductBasis<ElementType, QuadratureOrder>::kPoints;
+                    tbb::parallel_for(Index{0}, Index{mesh.E.cols()}, [&](Index e) {
+                        auto const nodes = mesh.E.col(e);
+                        auto const xe =
+                            x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
+                        auto const Jinve =
+                            Jinvg.middleCols<MeshType::kDims * kPoints>(
+                                e * kPoints * MeshType::kDims);
+                        Fg.middleCols<kPoints>(e * kPoints) =
+                            DeformationGradients<ElementType, QuadratureOrder, kDims>(xe, Jinve)
+                                .reshaped(kDims * kDims, kPoints);
+                    });
+                });
+        }
     }
-    else if (bWithGradient and not bWithHessian)
+    else if (bWithHessian and bIsHessianMatrixFree)
     {
-        tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
-            auto const e     = eg(g);
+        bIsMatrixFreeHessianSpdProjected = bUseSpdProjection;
+        DispatchQuadraturePointElements([&]<bool kIsElementQuadrature>() {
+            tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
+                auto const e     = QuadraturePointElement<kIsElementQuadrature>(g);
+                auto const nodes = mesh.E.col(e);
+                auto const xe =
+                    x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
+                auto const GPeg = ShapeFunctionGradientsAt(g);
+                Fg.col(g)       = (xe * GPeg).reshaped();
+            });
+        });
+    }
+    // Energies and gradients are evaluated in SIMD batches of consecutive quadrature points, whose
+    // deformation gradients are gathered in structure-of-arrays tiles. Lanes past the last
+    // quadrature point replicate it, and their results are discarded.
+    auto constexpr kBatch      = kQuadraturePointBatchSize;
+    auto const numberOfBatches = (numberOfQuadraturePoints + kBatch - 1) / kBatch;
+    using BatchedFType         = Matrix<kBatch, kDims * kDims>;
+    auto const gatherBatch = [&]<bool kIsElementQuadrature>(
+                                 Index b,
+                                 BatchedFType& FB,
+                                 Vector<kBatch>& muB,
+                                 Vector<kBatch>& lambdaB) {
+        for (auto l = 0; l < kBatch; ++l)
+        {
+            auto const g     = std::min<Index>(b * kBatch + l, numberOfQuadraturePoints - 1);
+            auto const e     = QuadraturePointElement<kIsElementQuadrature>(g);
             auto const nodes = mesh.E.col(e);
-            auto const xe    = x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
-            auto const GPeg = GNeg.block<kNodesPerElement, MeshType::kDims>(0, g * MeshType::kDims);
-            Matrix<kDims, kDims> const F = xe * GPeg;
-            auto vecF                    = FromEigen(F);
-            mini::SVector<Scalar, kDims * kDims> gradPsiF;
-            auto psiF = Psi.evalWithGrad(vecF, mug(g), lambdag(g), gradPsiF);
-            Ug(g) += wg(g) * psiF;
-            auto const GP = FromEigen(GPeg);
-            auto GPsix    = GradientWrtDofs<ElementType, kDims>(gradPsiF, GP);
-            Gg.col(g) += wg(g) * ToEigen(GPsix);
+            auto const xe = x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
+            Matrix<kDims, kDims> const F = xe * ShapeFunctionGradientsAt(g);
+            FB.row(l)                    = F.reshaped().transpose();
+            muB(l)                       = mug(g);
+            lambdaB(l)                   = lambdag(g);
+        }
+    };
+    if (not bWithGradient and not bWithStoredHessian)
+    {
+        DispatchQuadraturePointElements([&]<bool kIsElementQuadrature>() {
+            tbb::parallel_for(Index{0}, Index{numberOfBatches}, [&](Index b) {
+                BatchedFType FB;
+                Vector<kBatch> muB, lambdaB, psiB;
+                gatherBatch.template operator()<kIsElementQuadrature>(b, FB, muB, lambdaB);
+                physics::EvalBatch(Psi, FB, muB, lambdaB, psiB);
+                auto const gBegin = b * kBatch;
+                auto const gEnd   = std::min<Index>(gBegin + kBatch, numberOfQuadraturePoints);
+                for (auto g = gBegin; g < gEnd; ++g)
+                    Ug(g) += wg(g) * psiB(g - gBegin);
+            });
         });
     }
-    else if (not bWithGradient and bWithHessian)
+    else if (bWithGradient and not bWithStoredHessian)
     {
-        tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
-            auto const e     = eg(g);
-            auto const nodes = mesh.E.col(e);
-            auto const xe    = x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
-            auto const gradPhi =
-                GNeg.block<kNodesPerElement, MeshType::kDims>(0, g * MeshType::kDims);
-            Matrix<kDims, kDims> const F = xe * gradPhi;
-            auto vecF                    = FromEigen(F);
-            auto psiF                    = Psi.eval(vecF, mug(g), lambdag(g));
-            auto hessPsiF                = Psi.hessian(vecF, mug(g), lambdag(g));
-            Ug(g) += wg(g) * psiF;
-            auto const GP = FromEigen(gradPhi);
-            auto HPsix    = HessianWrtDofs<ElementType, kDims>(hessPsiF, GP);
-            auto heg      = Hg.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement);
-            heg += wg(g) * ToEigen(HPsix);
+        DispatchQuadraturePointElements([&]<bool kIsElementQuadrature>() {
+            tbb::parallel_for(Index{0}, Index{numberOfBatches}, [&](Index b) {
+                BatchedFType FB, gradPsiFB;
+                Vector<kBatch> muB, lambdaB, psiB;
+                gatherBatch.template operator()<kIsElementQuadrature>(b, FB, muB, lambdaB);
+                physics::EvalWithGradBatch(Psi, FB, muB, lambdaB, psiB, gradPsiFB);
+                auto const gBegin = b * kBatch;
+                auto const gEnd   = std::min<Index>(gBegin + kBatch, numberOfQuadraturePoints);
+                for (auto g = gBegin; g < gEnd; ++g)
+                {
+                    Ug(g) += wg(g) * psiB(g - gBegin);
+                    Vector<kDims * kDims> const gradPsiF = gradPsiFB.row(g - gBegin).transpose();
+                    auto const GPeg = ShapeFunctionGradientsAt(g);
+                    auto const GP   = FromEigen(GPeg);
+                    auto GPsix      = GradientWrtDofs<ElementType, kDims>(FromEigen(gradPsiF), GP);
+                    Gg.col(g) += wg(g) * ToEigen(GPsix);
+                }
+            });
         });
     }
-    else
+    else if (bIsHessianPacked)
     {
-        tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
-            auto const e     = eg(g);
-            auto const nodes = mesh.E.col(e);
-            auto const xe    = x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
-            auto const GPeg = GNeg.block<kNodesPerElement, MeshType::kDims>(0, g * MeshType::kDims);
-            Matrix<kDims, kDims> const F = xe * GPeg;
-            auto vecF                    = FromEigen(F);
-            mini::SVector<Scalar, kDims * kDims> gradPsiF;
-            mini::SMatrix<Scalar, kDims * kDims, kDims * kDims> hessPsiF;
-            auto psiF = Psi.evalWithGradAndHessian(vecF, mug(g), lambdag(g), gradPsiF, hessPsiF);
-            auto const GP = FromEigen(GPeg);
-            auto GPsix    = GradientWrtDofs<ElementType, kDims>(gradPsiF, GP);
-            auto HPsix    = HessianWrtDofs<ElementType, kDims>(hessPsiF, GP);
-            auto heg      = Hg.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement);
-            Ug(g) += wg(g) * psiF;
-            Gg.col(g) += wg(g) * ToEigen(GPsix);
-            heg += wg(g) * ToEigen(HPsix);
+        if (eHessianStorage == EHessianStorage::Packed)
+            computePackedElementElasticity(He);
+        else
+            computePackedElementElasticity(Hef);
+    }
+    else if (not bWithGradient and bWithStoredHessian)
+    {
+        DispatchQuadraturePointElements([&]<bool kIsElementQuadrature>() {
+            tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
+                auto const e     = QuadraturePointElement<kIsElementQuadrature>(g);
+                auto const nodes = mesh.E.col(e);
+                auto const xe =
+                    x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
+                auto const gradPhi  = ShapeFunctionGradientsAt(g);
+                Matrix<kDims, kDims> const F = xe * gradPhi;
+                auto vecF                    = FromEigen(F);
+                auto psiF                    = Psi.eval(vecF, mug(g), lambdag(g));
+                auto hessPsiF                = hessianWrtF(vecF, g);
+                Ug(g) += wg(g) * psiF;
+                auto const GP = FromEigen(gradPhi);
+                auto HPsix    = HessianWrtDofs<ElementType, kDims>(hessPsiF, GP);
+                auto heg      = Hg.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement);
+                heg += wg(g) * ToEigen(HPsix);
+            });
         });
     }
-    if (bWithHessian and bUseSpdProjection)
+    else
     {
-        tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
-            auto heg = Hg.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement);
-            Eigen::JacobiSVD<
-                Matrix<kDofsPerElement, kDofsPerElement>,
-                Eigen::ComputeFullU | Eigen::ComputeFullV>
-                SVD{};
-            SVD.compute(heg);
-            Vector<kDofsPerElement> sigma = SVD.singularValues();
-            for (auto s = sigma.size() - 1; s >= 0; --s)
-            {
-                if (sigma(s) >= 0.)
-                    break;
-                sigma(s) = -sigma(s);
-            }
-            heg = SVD.matrixU() * sigma.asDiagonal() * SVD.matrixV().transpose();
+        DispatchQuadraturePointElements([&]<bool kIsElementQuadrature>() {
+            tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
+                auto const e     = QuadraturePointElement<kIsElementQuadrature>(g);
+                auto const nodes = mesh.E.col(e);
+                auto const xe =
+                    x.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
+                auto const GPeg = ShapeFunctionGradientsAt(g);
+                Matrix<kDims, kDims> const F = xe * GPeg;
+                auto vecF                    = FromEigen(F);
+                mini::SVector<Scalar, kDims * kDims> gradPsiF;
+                auto psiF     = Psi.evalWithGrad(vecF, mug(g), lambdag(g), gradPsiF);
+                auto hessPsiF = hessianWrtF(vecF, g);
+                auto const GP = FromEigen(GPeg);
+                auto GPsix    = GradientWrtDofs<ElementType, kDims>(gradPsiF, GP);
+                auto HPsix    = HessianWrtDofs<ElementType, kDims>(hessPsiF, GP);
+                auto heg      = Hg.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement);
+                Ug(g) += wg(g) * psiF;
+                Gg.col(g) += wg(g) * ToEigen(GPsix);
+                heg += wg(g) * ToEigen(HPsix);
+            });
         });
     }
 }
@@ -476,21 +922,128 @@ inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::Apply(
         throw std::invalid_argument(what);
     }
 
-    auto constexpr kDofsPerElement      = kDims * ElementType::kNodes;
-    auto const numberOfQuadraturePoints = wg.size();
-    // NOTE: Outer loop could be parallelized over columns, and using graph coloring, inner loop
-    // could also be parallelized, if it's worth it.
-    for (auto c = 0; c < x.cols(); ++c)
-    {
-        for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+    // Hessian blocks compute their local products independently, and nodes then gather their
+    // blocks' contributions, such that both passes are race-free
+    auto constexpr kNodesPerElement  = ElementType::kNodes;
+    auto const numberOfNodes         = mesh.X.cols();
+    auto const numberOfHessianBlocks = NumberOfHessianBlocks();
+    yb.resize(kDims, kNodesPerElement * numberOfHessianBlocks);
+    auto const applyBlocks = [&](auto const& fBlockProduct) {
+        for (auto c = 0; c < x.cols(); ++c)
         {
-            auto const e     = eg(g);
-            auto const nodes = mesh.E.col(e);
-            auto const heg   = Hg.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement);
-            auto const xe =
-                x.col(c).reshaped(kDims, x.size() / kDims)(Eigen::placeholders::all, nodes);
-            auto ye = y.col(c).reshaped(kDims, y.size() / kDims)(Eigen::placeholders::all, nodes);
-            ye.reshaped() += heg * xe.reshaped();
+            auto const xc = x.col(c).reshaped(kDims, numberOfNodes);
+            tbb::parallel_for(Index{0}, numberOfHessianBlocks, [&](Index b) {
+                auto const nodes                 = mesh.E.col(HessianBlockElement(b));
+                Vector<kDofsPerElement> const xe = xc(Eigen::placeholders::all, nodes).reshaped();
+                yb.block<kDims, kNodesPerElement>(0, b * kNodesPerElement).reshaped() =
+                    fBlockProduct(b, xe);
+            });
+            auto yc = y.col(c).reshaped(kDims, numberOfNodes);
+            tbb::parallel_for(Index{0}, numberOfNodes, [&](Index i) {
+                for (auto k = GNptr(i); k < GNptr(i + 1); ++k)
+                    yc.col(i) += yb.col(GNadj(k));
+            });
+        }
+    };
+    // Packed element hessians are applied through their upper triangular part
+    auto const packedProduct = [&](auto const& Hpacked) {
+        return [&](Index e, Vector<kDofsPerElement> const& xe) {
+            auto const hpe               = Hpacked.col(e);
+            Vector<kDofsPerElement> yloc = Vector<kDofsPerElement>::Zero();
+            for (Index j = 0; j < kDofsPerElement; ++j)
+            {
+                for (Index i = 0; i < j; ++i)
+                {
+                    auto const hij = static_cast<Scalar>(hpe(PackedIndex(i, j)));
+                    yloc(i) += hij * xe(j);
+                    yloc(j) += hij * xe(i);
+                }
+                yloc(j) += static_cast<Scalar>(hpe(PackedIndex(j, j))) * xe(j);
+            }
+            return yloc;
+        };
+    };
+    switch (eHessianStorage)
+    {
+        case EHessianStorage::Dense:
+            applyBlocks([&](Index g, Vector<kDofsPerElement> const& xe) {
+                auto const heg =
+                    Hg.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement);
+                return Vector<kDofsPerElement>(heg * xe);
+            });
+            break;
+        case EHessianStorage::Packed: applyBlocks(packedProduct(He)); break;
+        case EHessianStorage::PackedFloat: applyBlocks(packedProduct(Hef)); break;
+        case EHessianStorage::MatrixFree: {
+            // Contract the energy density's hessian with the deformation gradient's directional
+            // derivative dF, i.e. y_e += w_g (dF/dx)^T (d^2 Psi / dF^2) dF, without forming
+            // element hessians
+            namespace mini = math::linalg::mini;
+            using mini::FromEigen;
+            using mini::ToEigen;
+            if constexpr (CTensorProductElement<ElementType>)
+            {
+                if (quadratureOrder > 0)
+                {
+                    // Hessian blocks are elements, whose directional derivatives dF and stress
+                    // contractions are sum factorized over all of their quadrature points
+                    DispatchSumFactorizedQuadratureOrder<ElementType>(
+                        quadratureOrder,
+                        [&]<auto QuadratureOrder>() {
+                            auto constexpr kPoints =
+                                TensorProductBasis<ElementType, QuadratureOrder>::kPoints;
+                            auto constexpr kJinvCols = MeshType::kDims * kPoints;
+                            // yb has room for |# quad.pts.| >= |# elements| blocks
+                            auto const numberOfElements = mesh.E.cols();
+                            for (auto c = 0; c < x.cols(); ++c)
+                            {
+                                auto const xc = x.col(c).reshaped(kDims, numberOfNodes);
+                                tbb::parallel_for(Index{0}, numberOfElements, [&](Index e) {
+                                    auto const nodes = mesh.E.col(e);
+                                    Matrix<kDims, kNodesPerElement> const xe =
+                                        xc(Eigen::placeholders::all, nodes);
+                                    auto const Jinve =
+                                        Jinvg.middleCols<kJinvCols>(e * kJinvCols);
+                                    Matrix<kDims, kDims * kPoints> dPe =
+                                        DeformationGradients<ElementType, QuadratureOrder, kDims>(
+                                            xe,
+                                            Jinve);
+                                    for (auto gl = 0; gl < kPoints; ++gl)
+                                    {
+                                        auto const g = e * kPoints + gl;
+                                        auto dFg     = dPe.template middleCols<kDims>(gl * kDims);
+                                        Vector<kDims * kDims> const dF = dFg.reshaped();
+                                        mini::SVector<Scalar, kDims * kDims> const dP =
+                                            MatrixFreeHessian(g) * FromEigen(dF);
+                                        Vector<kDims * kDims> const wdP = wg(g) * ToEigen(dP);
+                                        dFg = wdP.reshaped(kDims, kDims);
+                                    }
+                                    yb.block<kDims, kNodesPerElement>(0, e * kNodesPerElement) =
+                                        DeformationGradientsTranspose<
+                                            ElementType,
+                                            QuadratureOrder,
+                                            kDims>(dPe, Jinve);
+                                });
+                                auto yc = y.col(c).reshaped(kDims, numberOfNodes);
+                                tbb::parallel_for(Index{0}, numberOfNodes, [&](Index i) {
+                                    for (auto k = GNptr(i); k < GNptr(i + 1); ++k)
+                                        yc.col(i) += yb.col(GNadj(k));
+                                });
+                            }
+                        });
+                    break;
+                }
+            }
+            applyBlocks([&](Index g, Vector<kDofsPerElement> const& xe) {
+                auto const GPeg  = ShapeFunctionGradientsAt(g);
+                Vector<kDims * kDims> const dF =
+                    (xe.reshaped(kDims, kNodesPerElement) * GPeg).reshaped();
+                auto const hessPsiF                           = MatrixFreeHessian(g);
+                mini::SVector<Scalar, kDims * kDims> const dP = hessPsiF * FromEigen(dF);
+                auto dPsix = GradientWrtDofs<ElementType, kDims>(dP, FromEigen(GPeg));
+                return Vector<kDofsPerElement>(wg(g) * ToEigen(dPsix));
+            });
+            break;
         }
     }
 }
@@ -499,20 +1052,20 @@ template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
 inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::PrecomputeHessianSparsity()
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.fem.HyperElasticPotential.PrecomputeHessianSparsity");
-    auto const numberOfQuadraturePoints = wg.size();
-    auto const kNodesPerElement         = ElementType::kNodes;
-    auto const kDofsPerElement          = kNodesPerElement * kDims;
+    auto const numberOfHessianBlocks = NumberOfHessianBlocks();
+    auto const kNodesPerElement      = ElementType::kNodes;
     std::vector<Index> nonZeroRowIndices{};
     std::vector<Index> nonZeroColIndices{};
     nonZeroRowIndices.reserve(
-        static_cast<std::size_t>(kDofsPerElement * kDofsPerElement * numberOfQuadraturePoints));
+        static_cast<std::size_t>(kDofsPerElement * kDofsPerElement * numberOfHessianBlocks));
     nonZeroColIndices.reserve(
-        static_cast<std::size_t>(kDofsPerElement * kDofsPerElement * numberOfQuadraturePoints));
-    // Insert non-zero indices in the storage order of our Hg matrix of element hessians at
-    // quadrature points
-    for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+        static_cast<std::size_t>(kDofsPerElement * kDofsPerElement * numberOfHessianBlocks));
+    // Insert non-zero indices in the order of VisitHessianNonZeros, i.e. the storage order of our
+    // Hg matrix of element hessians at quadrature points for dense storage, or the unpacked
+    // element hessians for packed storage
+    for (auto b = 0; b < numberOfHessianBlocks; ++b)
     {
-        auto const e     = eg(g);
+        auto const e     = HessianBlockElement(b);
         auto const nodes = mesh.E.col(e);
         for (auto j = 0; j < kNodesPerElement; ++j)
         {
@@ -530,33 +1083,62 @@ inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::PrecomputeHessian
         }
     }
     GH.Compute(OutputDimensions(), InputDimensions(), nonZeroRowIndices, nonZeroColIndices);
+    GHB = ComputeHessianBlockSparsity();
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline auto HyperElasticPotential<TMesh, THyperElasticEnergy>::ComputeHessianBlockSparsity() const
+    -> math::linalg::BlockSparsityPattern<kDims>
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.HyperElasticPotential.ComputeHessianBlockSparsity");
+    auto constexpr kNodesPerElement  = ElementType::kNodes;
+    auto const numberOfHessianBlocks = NumberOfHessianBlocks();
+    auto const numberOfNodalBlocks   = kNodesPerElement * kNodesPerElement * numberOfHessianBlocks;
+    std::vector<Index> blockRowIndices(static_cast<std::size_t>(numberOfNodalBlocks));
+    std::vector<Index> blockColIndices(static_cast<std::size_t>(numberOfNodalBlocks));
+    tbb::parallel_for(Index{0}, numberOfHessianBlocks, [&](Index b) {
+        auto const nodes = mesh.E.col(HessianBlockElement(b));
+        auto k           = static_cast<std::size_t>(b * kNodesPerElement * kNodesPerElement);
+        for (auto j = 0; j < kNodesPerElement; ++j)
+        {
+            for (auto i = 0; i < kNodesPerElement; ++i, ++k)
+            {
+                blockRowIndices[k] = nodes(i);
+                blockColIndices[k] = nodes(j);
+            }
+        }
+    });
+    auto const numberOfNodes = mesh.X.cols();
+    return math::linalg::BlockSparsityPattern<kDims>(
+        numberOfNodes,
+        numberOfNodes,
+        blockRowIndices,
+        blockColIndices);
 }
 
 template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
 inline CSCMatrix HyperElasticPotential<TMesh, THyperElasticEnergy>::ToMatrix() const
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.fem.HyperElasticPotential.ToMatrix");
+    CSCMatrix H{};
     if (!GH.IsEmpty())
     {
-        using SpanType = std::span<Scalar const>;
-        using SizeType = typename SpanType::size_type;
-        return GH.ToMatrix(SpanType(Hg.data(), static_cast<SizeType>(Hg.size())));
+        VisitHessianNonZeros([&](auto&& nonZeros) { H = GH.ToMatrix(nonZeros); });
+        return H;
     }
-    else
-    {
-        // Construct hessian from triplets
-        using SparseIndex = typename CSCMatrix::StorageIndex;
-        using Triplet     = Eigen::Triplet<Scalar, SparseIndex>;
-        std::vector<Triplet> triplets{};
-        triplets.reserve(static_cast<std::size_t>(Hg.size()));
-        auto const numberOfQuadraturePoints = wg.size();
-        for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+    // Construct hessian from triplets
+    using SparseIndex = typename CSCMatrix::StorageIndex;
+    using Triplet     = Eigen::Triplet<Scalar, SparseIndex>;
+    auto constexpr kHessianBlockSize = kDofsPerElement * kDofsPerElement;
+    auto const numberOfHessianBlocks = NumberOfHessianBlocks();
+    std::vector<Triplet> triplets{};
+    triplets.reserve(static_cast<std::size_t>(kHessianBlockSize * numberOfHessianBlocks));
+    VisitHessianNonZeros([&](auto&& nonZeros) {
+        for (auto b = 0; b < numberOfHessianBlocks; ++b)
         {
-            auto const e         = eg(g);
-            auto const nodes     = mesh.E.col(e);
-            auto constexpr Hrows = ElementType::kNodes * kDims;
-            auto constexpr Hcols = Hrows;
-            auto const heg       = Hg.block<Hrows, Hcols>(0, g * Hcols);
+            auto const e     = HessianBlockElement(b);
+            auto const nodes = mesh.E.col(e);
+            auto k           = static_cast<std::size_t>(b * kHessianBlockSize);
             for (auto j = 0; j < ElementType::kNodes; ++j)
                 for (auto dj = 0; dj < kDims; ++dj)
                     for (auto i = 0; i < ElementType::kNodes; ++i)
@@ -564,13 +1146,146 @@ inline CSCMatrix HyperElasticPotential<TMesh, THyperElasticEnergy>::ToMatrix() c
                             triplets.push_back(Triplet{
                                 static_cast<SparseIndex>(kDims * nodes(i) + di),
                                 static_cast<SparseIndex>(kDims * nodes(j) + dj),
-                                heg(kDims * i + di, kDims * j + dj)});
+                                nonZeros[k++]});
         }
+    });
+    auto const n = InputDimensions();
+    H.resize(n, n);
+    H.setFromTriplets(triplets.begin(), triplets.end());
+    return H;
+}
 
-        auto const n = InputDimensions();
-        CSCMatrix H(n, n);
-        H.setFromTriplets(triplets.begin(), triplets.end());
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::ToMatrix(CSCMatrix& H) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.HyperElasticPotential.ToMatrixInPlace");
+    if (GH.IsEmpty())
+    {
+        throw std::invalid_argument(
+            "In-place hessian assembly requires the hessian's sparsity pattern, see "
+            "PrecomputeHessianSparsity()");
+    }
+    VisitHessianNonZeros([&](auto&& nonZeros) { GH.ToMatrix(nonZeros, H); });
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline auto HyperElasticPotential<TMesh, THyperElasticEnergy>::ToBlockMatrix() const
+    -> math::linalg::BlockSparseMatrix<kDims>
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.HyperElasticPotential.ToBlockMatrix");
+    auto const fAssemble = [this](math::linalg::BlockSparsityPattern<kDims> const& GP) {
+        math::linalg::BlockSparseMatrix<kDims> H{};
+        VisitHessianNonZeros([&](auto&& nonZeros) {
+            H = GP.ToMatrix([&](Index k) { return NodalHessianBlock(nonZeros, k); });
+        });
         return H;
+    };
+    return GHB.IsEmpty() ? fAssemble(ComputeHessianBlockSparsity()) : fAssemble(GHB);
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::ToBlockMatrix(
+    math::linalg::BlockSparseMatrix<kDims>& H) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.HyperElasticPotential.ToBlockMatrixInPlace");
+    if (GHB.IsEmpty())
+    {
+        throw std::invalid_argument(
+            "In-place block hessian assembly requires the hessian's sparsity pattern, see "
+            "PrecomputeHessianSparsity()");
+    }
+    VisitHessianNonZeros([&](auto&& nonZeros) {
+        GHB.ToMatrix([&](Index k) { return NodalHessianBlock(nonZeros, k); }, H);
+    });
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+template <class TNonZeroRange>
+inline auto HyperElasticPotential<TMesh, THyperElasticEnergy>::NodalHessianBlock(
+    TNonZeroRange const& nonZeros,
+    Index k) -> Matrix<kDims, kDims>
+{
+    auto constexpr kNodesPerElement  = ElementType::kNodes;
+    auto constexpr kNodalBlocks      = kNodesPerElement * kNodesPerElement;
+    auto constexpr kHessianBlockSize = kDofsPerElement * kDofsPerElement;
+    auto const b                     = k / kNodalBlocks;
+    auto const i                     = (k % kNodalBlocks) % kNodesPerElement;
+    auto const j                     = (k % kNodalBlocks) / kNodesPerElement;
+    Matrix<kDims, kDims> Hij{};
+    for (auto dj = 0; dj < kDims; ++dj)
+    {
+        for (auto di = 0; di < kDims; ++di)
+        {
+            auto const r = kDims * i + di;
+            auto const c = kDims * j + dj;
+            Hij(di, dj)  = nonZeros[static_cast<std::size_t>(
+                b * kHessianBlockSize + c * kDofsPerElement + r)];
+        }
+    }
+    return Hij;
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline void
+HyperElasticPotential<TMesh, THyperElasticEnergy>::SetHessianStorage(EHessianStorage eStorage)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.HyperElasticPotential.SetHessianStorage");
+    eHessianStorage                     = eStorage;
+    GH                                  = math::linalg::SparsityPattern{};
+    GHB                                 = math::linalg::BlockSparsityPattern<kDims>{};
+    auto const numberOfQuadraturePoints = wg.size();
+    auto const numberOfElements         = mesh.E.cols();
+    bool const bIsHessianDense          = eStorage == EHessianStorage::Dense;
+    Hg.setZero(kDofsPerElement, bIsHessianDense ? kDofsPerElement * numberOfQuadraturePoints : 0);
+    He.setZero(kPackedHessianSize, eStorage == EHessianStorage::Packed ? numberOfElements : 0);
+    Hef.setZero(
+        kPackedHessianSize,
+        eStorage == EHessianStorage::PackedFloat ? numberOfElements : 0);
+    Fg.setZero(
+        kDims * kDims,
+        eStorage == EHessianStorage::MatrixFree ? numberOfQuadraturePoints : 0);
+    bool bIsElementQuadrature{false};
+    DispatchQuadraturePointElements(
+        [&]<bool kIsElementQuadrature>() { bIsElementQuadrature = kIsElementQuadrature; });
+    if (IsHessianPacked() and bIsElementQuadrature)
+    {
+        GEptr = IndexVectorX::LinSpaced(numberOfElements + 1, Index{0}, numberOfElements);
+        GEadj = IndexVectorX::LinSpaced(numberOfElements, Index{0}, numberOfElements - 1);
+    }
+    else if (IsHessianPacked())
+    {
+        std::tie(GEptr, GEadj) = graph::MapToAdjacency(eg, numberOfElements);
+    }
+    else
+    {
+        GEptr.resize(0);
+        GEadj.resize(0);
+    }
+    // Node to hessian block adjacency for race-free parallel Apply
+    IndexVectorX nodes(ElementType::kNodes * NumberOfHessianBlocks());
+    for (auto b = 0; b < NumberOfHessianBlocks(); ++b)
+        nodes.segment<ElementType::kNodes>(b * ElementType::kNodes) =
+            mesh.E.col(HessianBlockElement(b));
+    std::tie(GNptr, GNadj) = graph::MapToAdjacency(nodes, mesh.X.cols());
+    // Tensor product elements sum factorize matrix-free hessian products element by element, if
+    // shape function gradients were computed at the elements' Gauss-Legendre quadrature points
+    quadratureOrder = 0;
+    Jinvg.resize(0, 0);
+    if constexpr (CTensorProductElement<ElementType>)
+    {
+        if (eStorage == EHessianStorage::MatrixFree and cellQuadraturePoints == 0)
+        {
+            quadratureOrder = InverseJacobiansAtQuadraturePoints<ElementType, MeshType::kDims>(
+                eg,
+                numberOfElements,
+                GNeg,
+                Jinvg);
+        }
+        if (quadratureOrder > 0)
+        {
+            IndexVectorX const elementNodes = mesh.E.reshaped();
+            std::tie(GNptr, GNadj) = graph::MapToAdjacency(elementNodes, mesh.X.cols());
+        }
     }
 }
 
@@ -583,14 +1298,16 @@ inline VectorX HyperElasticPotential<TMesh, THyperElasticEnergy>::ToVector() con
     auto const numberOfNodes            = mesh.X.cols();
     auto const n                        = InputDimensions();
     VectorX G                           = VectorX::Zero(n);
-    for (auto g = 0; g < numberOfQuadraturePoints; ++g)
-    {
-        auto const e     = eg(g);
-        auto const nodes = mesh.E.col(e);
-        auto const geg   = Gg.col(g).reshaped(kDims, kNodesPerElement);
-        auto gi          = G.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
-        gi += geg;
-    }
+    DispatchQuadraturePointElements([&]<bool kIsElementQuadrature>() {
+        for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+        {
+            auto const e     = QuadraturePointElement<kIsElementQuadrature>(g);
+            auto const nodes = mesh.E.col(e);
+            auto const geg   = Gg.col(g).reshaped(kDims, kNodesPerElement);
+            auto gi          = G.reshaped(kDims, numberOfNodes)(Eigen::placeholders::all, nodes);
+            gi += geg;
+        }
+    });
     return G;
 }
 
@@ -601,6 +1318,84 @@ inline Scalar HyperElasticPotential<TMesh, THyperElasticEnergy>::Eval() const
     return Ug.sum();
 }
 
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+template <class Func>
+inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::VisitHessianNonZeros(Func&& f) const
+{
+    auto const packedNonZeros = [](auto const& Hpacked) {
+        auto constexpr kHessianBlockSize = kDofsPerElement * kDofsPerElement;
+        return std::views::iota(Index{0}, kHessianBlockSize * Hpacked.cols()) |
+               std::views::transform([&Hpacked](Index k) {
+                   auto const e = k / kHessianBlockSize;
+                   auto const r = k % kHessianBlockSize;
+                   auto const i = r % kDofsPerElement;
+                   auto const j = r / kDofsPerElement;
+                   return static_cast<Scalar>(Hpacked(PackedIndex(i, j), e));
+               });
+    };
+    switch (eHessianStorage)
+    {
+        case EHessianStorage::Dense: {
+            using SpanType = std::span<Scalar const>;
+            using SizeType = typename SpanType::size_type;
+            f(SpanType(Hg.data(), static_cast<SizeType>(Hg.size())));
+            break;
+        }
+        case EHessianStorage::Packed: f(packedNonZeros(He)); break;
+        case EHessianStorage::PackedFloat: f(packedNonZeros(Hef)); break;
+        case EHessianStorage::MatrixFree: {
+            // Temporarily materialize the quadrature point hessians in the layout of Hg
+            namespace mini = math::linalg::mini;
+            auto constexpr kNodesPerElement     = ElementType::kNodes;
+            auto const numberOfQuadraturePoints = wg.size();
+            MatrixX HgMatrixFree(kDofsPerElement, kDofsPerElement * numberOfQuadraturePoints);
+            tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
+                auto const GPeg  = ShapeFunctionGradientsAt(g);
+                auto HPsix = HessianWrtDofs<ElementType, kDims>(
+                    MatrixFreeHessian(g),
+                    mini::FromEigen(GPeg));
+                HgMatrixFree.block<kDofsPerElement, kDofsPerElement>(0, g * kDofsPerElement) =
+                    wg(g) * mini::ToEigen(HPsix);
+            });
+            using SpanType = std::span<Scalar const>;
+            using SizeType = typename SpanType::size_type;
+            f(SpanType(HgMatrixFree.data(), static_cast<SizeType>(HgMatrixFree.size())));
+            break;
+        }
+    }
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline auto HyperElasticPotential<TMesh, THyperElasticEnergy>::MatrixFreeHessian(Index g) const
+    -> math::linalg::mini::SMatrix<Scalar, kDims * kDims, kDims * kDims>
+{
+    namespace mini = math::linalg::mini;
+    ElasticEnergyType Psi{};
+    Matrix<kDims, kDims> const F = Fg.col(g).reshaped(kDims, kDims);
+    auto const vecF              = mini::FromEigen(F);
+    return bIsMatrixFreeHessianSpdProjected ? physics::SpdHessian(Psi, vecF, mug(g), lambdag(g)) :
+                                              Psi.hessian(vecF, mug(g), lambdag(g));
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline bool HyperElasticPotential<TMesh, THyperElasticEnergy>::IsHessianPacked() const
+{
+    return eHessianStorage == EHessianStorage::Packed or
+           eHessianStorage == EHessianStorage::PackedFloat;
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline Index HyperElasticPotential<TMesh, THyperElasticEnergy>::NumberOfHessianBlocks() const
+{
+    return IsHessianPacked() ? mesh.E.cols() : wg.size();
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
+inline Index HyperElasticPotential<TMesh, THyperElasticEnergy>::HessianBlockElement(Index b) const
+{
+    return IsHessianPacked() ? b : QuadraturePointElement(b);
+}
+
 template <CMesh TMesh, physics::CHyperElasticEnergy THyperElasticEnergy>
 inline Index HyperElasticPotential<TMesh, THyperElasticEnergy>::InputDimensions() const
 {
@@ -620,7 +1415,9 @@ inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::CheckValidState()
 {
     auto const numberOfQuadraturePoints = wg.size();
     auto constexpr kExpectedGNegRows    = ElementType::kNodes;
-    auto const expectedGNegCols         = MeshType::kDims * numberOfQuadraturePoints;
+    auto const numberOfGNegPoints =
+        cellQuadraturePoints > 0 ? cellQuadraturePoints : numberOfQuadraturePoints;
+    auto const expectedGNegCols = MeshType::kDims * numberOfGNegPoints;
     bool const bShapeFunctionGradientsHaveCorrectDimensions =
         (GNeg.rows() == kExpectedGNegRows) and (GNeg.cols() == expectedGNegCols);
     if (not bShapeFunctionGradientsHaveCorrectDimensions)
@@ -634,6 +1431,20 @@ inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::CheckValidState()
             GNeg.cols());
         throw std::invalid_argument(what);
     }
+    bool const bHasElementQuadratureMap =
+        (eg.size() == numberOfQuadraturePoints) or
+        (CAffineElement<ElementType> and eg.size() == 0 and
+         numberOfQuadraturePoints == mesh.E.cols());
+    if (not bHasElementQuadratureMap)
+    {
+        std::string const what = fmt::format(
+            "Expected |#quad.pts.|={} quadrature point elements, or none for a single quadrature "
+            "point per affine element of the {} elements, but got {}",
+            numberOfQuadraturePoints,
+            mesh.E.cols(),
+            eg.size());
+        throw std::invalid_argument(what);
+    }
     bool const bLameCoefficientsHaveCorrectDimensions =
         (mug.size() == numberOfQuadraturePoints) and (lambdag.size() == numberOfQuadraturePoints);
     if (not bLameCoefficientsHaveCorrectDimensions)
@@ -646,6 +1457,18 @@ inline void HyperElasticPotential<TMesh, THyperElasticEnergy>::CheckValidState()
             lambdag.size());
         throw std::invalid_argument(what);
     }
+    bool const bHasPackedHessianAdjacency = (not IsHessianPacked()) or
+                                            (GEptr.size() == mesh.E.cols() + 1 and
+                                             GEadj.size() == numberOfQuadraturePoints);
+    if (not bHasPackedHessianAdjacency)
+    {
+        std::string const what = fmt::format(
+            "Expected element to quadrature point adjacency of packed hessian storage for {} "
+            "elements and {} quadrature points, see SetHessianStorage()",
+            mesh.E.cols(),
+            numberOfQuadraturePoints);
+        throw std::invalid_argument(what);
+    }
 }
 
 } // namespace fem
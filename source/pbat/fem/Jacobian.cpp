@@ -39,6 +39,20 @@ TEST_CASE("[fem] Jacobian")
             });
         });
     }
+    SUBCASE("Affine element inner product weights")
+    {
+        auto constexpr kDims = 3;
+        using Element        = fem::Tetrahedron<1>;
+        using Mesh           = fem::Mesh<Element, kDims>;
+        Mesh const mesh{V, C};
+        VectorX const we       = fem::ElementInnerProductWeights(mesh);
+        VectorX const weg      = fem::InnerProductWeights<2>(mesh).colwise().sum().transpose();
+        Scalar constexpr zero  = 1e-5; // Tabulated quadrature weights have ~6 significant digits
+        Scalar const weError   = (we - weg).norm();
+        Scalar const volumeErr = std::abs(we.sum() - Scalar(1));
+        CHECK_LE(weError, zero);
+        CHECK_LE(volumeErr, zero);
+    }
     SUBCASE("Computing map from domain to reference space")
     {
         common::ForRange<1, 4>([&]<auto PolynomialOrder>() {
@@ -144,6 +144,30 @@ MatrixX InnerProductWeights(TMesh const& mesh)
     return detJe;
 }
 
+/**
+ * @brief Computes per-element inner product weights \f$ w_e = \det(J^e) \sum_g w_g \f$ of affine
+ * elements, i.e. element measures, such that \f$ \int_\Omega \cdot d\Omega = \sum_e w_e \cdot
+ * \f$ for element-wise constant integrands.
+ *
+ * Quadrature weights are folded into a single scalar per element, since jacobians of affine
+ * elements are constant.
+ *
+ * @tparam TMesh Mesh type
+ * @param mesh FEM mesh
+ * @return `|# elements|` vector of element inner product weights
+ */
+template <CMesh TMesh>
+requires CAffineElement<typename TMesh::ElementType>
+VectorX ElementInnerProductWeights(TMesh const& mesh)
+{
+    using ElementType        = typename TMesh::ElementType;
+    using QuadratureRuleType = typename ElementType::template QuadratureType<1>;
+    Scalar const wsum        = common::ToEigen(QuadratureRuleType::weights).sum();
+    VectorX we               = DeterminantOfJacobian<1>(mesh).row(0).transpose();
+    we *= wsum;
+    return we;
+}
+
 /**
  * @brief Computes the inner product weights \f$ \mathbf{w}_{ge} \in \mathbb{R}^{|G^e| \times |E|}
  * \f$ such that \f$ \int_\Omega \cdot d\Omega = \sum_e \sum_g w_{ge} \cdot \f$.
@@ -1,5 +1,6 @@
 #include "LaplacianMatrix.h"
 
+#include "Hexahedron.h"
 #include "Jacobian.h"
 #include "Mesh.h"
 #include "ShapeFunctions.h"
@@ -89,6 +90,13 @@ TEST_CASE("[fem] LaplacianMatrix")
                 (yInputScaled - yOutputScaled).squaredNorm() / yOutputScaled.squaredNorm();
             CHECK_LE(yLinearityError, zero);
 
+            // Check multiple right-hand sides
+            MatrixX const X = MatrixX::Random(n, 3);
+            MatrixX Y       = MatrixX::Zero(n, 3);
+            matrixFreeLaplacian.Apply(X, Y);
+            Scalar const YError = (L * X - Y).squaredNorm();
+            CHECK_LE(YError, zero);
+
             // Laplacian of constant function should be 0
             VectorX const xconst = VectorX::Ones(n);
             VectorX yconst       = VectorX::Zero(n);
@@ -96,4 +104,45 @@ TEST_CASE("[fem] LaplacianMatrix")
             CHECK_LE(yconst.squaredNorm(), zero);
         }
     });
+
+    // Tensor product elements sum factorize Apply at Gauss-Legendre quadrature points
+    MatrixX VH(3, 12);
+    IndexMatrixX CH(8, 2);
+    // clang-format off
+    VH << 0., 1., 0., 1., 0., 1., 0., 1., 2.5, 2., 2., 2.,
+          0., 0., 1., 1., 0., 0., 1., 1., 0.,  1., 0., 1.,
+          0., 0., 0., 0., 1., 1., 1., 1., 0.,  0., 1., 1.;
+    CH << 0, 1,
+          1, 8,
+          2, 3,
+          3, 9,
+          4, 5,
+          5, 10,
+          6, 7,
+          7, 11;
+    // clang-format on
+    common::ForRange<1, 3>([&]<auto kOrder>() {
+        using Element                   = fem::Hexahedron<kOrder>;
+        using Mesh                      = fem::Mesh<Element, 3>;
+        auto constexpr kQuadratureOrder = kOrder + 1;
+        Mesh mesh(VH, CH);
+        VectorX const wg = fem::InnerProductWeights<kQuadratureOrder>(mesh).reshaped();
+        IndexVectorX const eg =
+            IndexVectorX::LinSpaced(mesh.E.cols(), Index(0), mesh.E.cols() - 1)
+                .replicate(1, wg.size() / mesh.E.cols())
+                .transpose()
+                .reshaped();
+        MatrixX const GNeg = fem::ShapeFunctionGradients<kQuadratureOrder>(mesh);
+        for (auto outDims = 1; outDims < 4; ++outDims)
+        {
+            fem::SymmetricLaplacianMatrix<Mesh> matrixFreeLaplacian(mesh, eg, wg, GNeg, outDims);
+            CHECK_EQ(matrixFreeLaplacian.quadratureOrder, kQuadratureOrder);
+            CSCMatrix const L = matrixFreeLaplacian.ToMatrix();
+            MatrixX const X   = MatrixX::Random(L.cols(), 2);
+            MatrixX Y         = MatrixX::Zero(L.rows(), 2);
+            matrixFreeLaplacian.Apply(X, Y);
+            Scalar const YError = (L * X - Y).norm() / Y.norm();
+            CHECK_LE(YError, 1e-10);
+        }
+    });
 }
\ No newline at end of file
@@ -12,11 +12,15 @@
 #define PBAT_FEM_LAPLACIAN_MATRIX_H
 
 #include "Concepts.h"
+#include "GridMesh.h"
+#include "SumFactorization.h"
 
+#include <cmath>
 #include <exception>
 #include <fmt/core.h>
 #include <pbat/Aliases.h>
 #include <pbat/common/Eigen.h>
+#include <pbat/graph/Adjacency.h>
 #include <pbat/profiling/Profiling.h>
 #include <tbb/parallel_for.h>
 
@@ -48,6 +52,15 @@ namespace fem {
  * matrix is actually \f$ L \otimes I_{d \times d} \f$ where \f$ d \f$ is the function's
  * dimensionality, but we need not store the duplicate entries.
  *
+ * If the shape function gradients of a mesh of tensor product elements (see
+ * CTensorProductElement) were computed at the elements' Gauss-Legendre quadrature points, Apply()
+ * sum factorizes element products rather than multiplying by dense quadrature point laplacians.
+ *
+ * On structured grids (see CGridMesh), `GNegg` may hold a single cell's shape function gradients
+ * (see GridMesh::CellShapeFunctionGradients()) shared by all cells, with quadrature points stored
+ * cell by cell. If all cells then also share their quadrature weights, a single cell laplacian is
+ * stored and applied by GridMesh::ApplyStencil().
+ *
  * @tparam TMesh Type satisfying concept CMesh
  */
 template <CMesh TMesh>
@@ -90,6 +103,7 @@ struct SymmetricLaplacianMatrix
      * @param y Output matrix
      * @pre x.rows() == InputDimensions() and y.rows() == OutputDimensions() and y.cols() ==
      * x.cols()
+     * @note Not thread-safe, since Apply() reuses this matrix's scratch buffer
      */
     template <class TDerivedIn, class TDerivedOut>
     void Apply(Eigen::MatrixBase<TDerivedIn> const& x, Eigen::DenseBase<TDerivedOut>& y) const;
@@ -121,6 +135,12 @@ struct SymmetricLaplacianMatrix
      * @brief Check if the state of this Laplacian matrix is valid
      */
     void CheckValidState() const;
+    /**
+     * @brief Checks if all elements share the single element laplacian deltag (structured grids
+     * of shared shape function gradients and quadrature weights only)
+     * @return true if deltag holds a single element laplacian shared by all elements
+     */
+    bool HasSharedElementLaplacian() const;
 
     MeshType const& mesh; ///< The finite element mesh
     Eigen::Ref<IndexVectorX const>
@@ -130,9 +150,36 @@ struct SymmetricLaplacianMatrix
         GNeg;       ///< `|# element nodes|x|# dims * # quad.pts. * # elements|`
                     ///< matrix of element shape function gradients at quadrature points
     MatrixX deltag; ///< `|# element nodes| x |# element nodes * # quad.pts.|` matrix of element
-                    ///< laplacians at quadrature points
+                    ///< laplacians at quadrature points, or the `|# element nodes| x |# element
+                    ///< nodes|` element laplacian if HasSharedElementLaplacian()
+    MatrixX Kg; ///< `|ElementType::kDims| x |ElementType::kDims * # quad.pts.|` reference space
+                ///< geometric factors \f$ -w_g \mathbf{J}^{-1}_g \mathbf{J}^{-T}_g \f$ at
+                ///< quadrature points (sum factorized Apply only)
+    int quadratureOrder; ///< Detected Gauss-Legendre quadrature order of sum factorized Apply, or
+                         ///< 0 if Apply uses deltag
+    Index cellQuadraturePoints; ///< Number of quadrature points per grid cell if GNeg holds a
+                                ///< single cell's shape function gradients shared by all cells,
+                                ///< or 0 otherwise (see NumberOfSharedCellQuadraturePoints())
     int dims; ///< Dimensionality of image of FEM function space, i.e. this Laplacian matrix is
               ///< actually \f$ L \otimes I_{d} \f$. Must have `dims >= 1`.
+    IndexVectorX GNptr; ///< Node i's quadrature point (element, if sum factorized) contributions
+                        ///< are GNadj[GNptr[i]:GNptr[i+1]]
+    IndexVectorX GNadj; ///< Local node indices `g*|# element nodes| + a` of nodes, where g is a
+                        ///< quadrature point (element, if sum factorized)
+    mutable MatrixX yb; ///< `dims x |# element nodes * # blocks|` quadrature point (element, if
+                        ///< sum factorized) local products of Apply(), cached across calls
+
+  private:
+    /**
+     * @brief Shape function gradients at quadrature point g
+     * @param g Quadrature point index
+     * @return `|# element nodes| x |MeshType::kDims|` block of GNeg
+     */
+    auto ShapeFunctionGradientsAt(Index g) const
+    {
+        auto const k = cellQuadraturePoints > 0 ? g % cellQuadraturePoints : g;
+        return GNeg.template block<ElementType::kNodes, MeshType::kDims>(0, k * MeshType::kDims);
+    }
 };
 
 template <CMesh TMesh>
@@ -142,9 +189,49 @@ inline SymmetricLaplacianMatrix<TMesh>::SymmetricLaplacianMatrix(
     Eigen::Ref<VectorX const> const& wg,
     Eigen::Ref<MatrixX const> const& GNeg,
     int dims)
-    : mesh(mesh), eg(eg), wg(wg), GNeg(GNeg), deltag(), dims(dims)
+    : mesh(mesh),
+      eg(eg),
+      wg(wg),
+      GNeg(GNeg),
+      deltag(),
+      Kg(),
+      quadratureOrder(0),
+      cellQuadraturePoints(NumberOfSharedCellQuadraturePoints(mesh, eg, wg.size(), GNeg)),
+      dims(dims),
+      GNptr(),
+      GNadj(),
+      yb()
 {
     ComputeElementLaplacians();
+    if (HasSharedElementLaplacian())
+        return;
+    if constexpr (CTensorProductElement<ElementType>)
+    {
+        auto constexpr kRefDims = ElementType::kDims;
+        auto constexpr kDims    = MeshType::kDims;
+        MatrixX Jinvg{};
+        quadratureOrder = cellQuadraturePoints > 0 ?
+                              0 :
+                              InverseJacobiansAtQuadraturePoints<ElementType, kDims>(
+                                  eg,
+                                  mesh.E.cols(),
+                                  GNeg,
+                                  Jinvg);
+        if (quadratureOrder > 0)
+        {
+            auto const numberOfQuadraturePoints = wg.size();
+            Kg.resize(kRefDims, kRefDims * numberOfQuadraturePoints);
+            tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
+                auto const Jinv = Jinvg.block<kRefDims, kDims>(0, g * kDims);
+                Kg.block<kRefDims, kRefDims>(0, g * kRefDims) = -wg(g) * Jinv * Jinv.transpose();
+            });
+            IndexVectorX const nodes = mesh.E.reshaped();
+            std::tie(GNptr, GNadj)   = graph::MapToAdjacency(nodes, mesh.X.cols());
+            return;
+        }
+    }
+    IndexVectorX const nodes = mesh.E(Eigen::placeholders::all, eg).reshaped();
+    std::tie(GNptr, GNadj)   = graph::MapToAdjacency(nodes, mesh.X.cols());
 }
 
 template <CMesh TMesh>
@@ -157,14 +244,21 @@ inline CSCMatrix SymmetricLaplacianMatrix<TMesh>::ToMatrix() const
     using Triplet     = Eigen::Triplet<Scalar, SparseIndex>;
 
     std::vector<Triplet> triplets{};
-    triplets.reserve(static_cast<std::size_t>(deltag.size() * dims));
-    auto const numberOfQuadraturePoints = wg.size();
+    auto constexpr kNodesPerElement     = ElementType::kNodes;
+    bool const bIsShared                = HasSharedElementLaplacian();
+    auto const numberOfQuadraturePoints = bIsShared ? mesh.E.cols() : wg.size();
+    triplets.reserve(static_cast<std::size_t>(
+        kNodesPerElement * kNodesPerElement * numberOfQuadraturePoints * dims));
     for (auto g = 0; g < numberOfQuadraturePoints; ++g)
     {
-        auto const e                    = eg(g);
-        auto const nodes                = mesh.E.col(e);
-        auto constexpr kNodesPerElement = ElementType::kNodes;
-        auto const Leg = deltag.block(0, g * kNodesPerElement, kNodesPerElement, kNodesPerElement);
+        // A shared element laplacian is summed over each element's quadrature points
+        auto const e     = bIsShared ? g : eg(g);
+        auto const nodes = mesh.E.col(e);
+        auto const Leg   = deltag.block(
+            0,
+            bIsShared ? Index{0} : g * kNodesPerElement,
+            kNodesPerElement,
+            kNodesPerElement);
         for (auto j = 0; j < Leg.cols(); ++j)
         {
             for (auto i = 0; i < Leg.rows(); ++i)
@@ -189,15 +283,31 @@ inline void SymmetricLaplacianMatrix<TMesh>::ComputeElementLaplacians()
     CheckValidState();
     // Compute element laplacians
     auto constexpr kNodesPerElement     = ElementType::kNodes;
-    auto constexpr kDims                = MeshType::kDims;
     auto const numberOfQuadraturePoints = wg.size();
+    // Identical grid cells with identical quadrature weights share their element laplacian
+    bool bAreCellWeightsShared = cellQuadraturePoints > 0;
+    for (auto g = cellQuadraturePoints; g < numberOfQuadraturePoints and bAreCellWeightsShared; ++g)
+    {
+        auto const w0 = wg(g % cellQuadraturePoints);
+        bAreCellWeightsShared &= std::abs(wg(g) - w0) <= Scalar(1e-10) * std::abs(w0);
+    }
+    if (bAreCellWeightsShared)
+    {
+        deltag.setZero(kNodesPerElement, kNodesPerElement);
+        for (auto g = 0; g < cellQuadraturePoints; ++g)
+        {
+            auto const GP = ShapeFunctionGradientsAt(g);
+            deltag -= wg(g) * GP * GP.transpose();
+        }
+        return;
+    }
     deltag.setZero(kNodesPerElement, kNodesPerElement * numberOfQuadraturePoints);
     tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
         auto Leg = deltag.block<kNodesPerElement, kNodesPerElement>(0, g * kNodesPerElement);
         // Use multivariable integration by parts (i.e. Green's identity), and retain only the
         // symmetric part, i.e.
         // Lij = -\int_{\Omega} \nabla \phi_i(X) \cdot \nabla \phi_j(X) \partial \Omega.
-        auto const GP = GNeg.block<kNodesPerElement, kDims>(0, g * kDims);
+        auto const GP = ShapeFunctionGradientsAt(g);
         Leg -= wg(g) * GP * GP.transpose();
     });
 }
@@ -207,7 +317,9 @@ inline void SymmetricLaplacianMatrix<TMesh>::CheckValidState() const
 {
     auto const numberOfQuadraturePoints = wg.size();
     auto constexpr kExpectedGNegRows    = ElementType::kNodes;
-    auto const expectedGNegCols         = MeshType::kDims * numberOfQuadraturePoints;
+    auto const numberOfGNegPoints =
+        cellQuadraturePoints > 0 ? cellQuadraturePoints : numberOfQuadraturePoints;
+    auto const expectedGNegCols = MeshType::kDims * numberOfGNegPoints;
     bool const bShapeFunctionGradientsHaveCorrectDimensions =
         (GNeg.rows() == kExpectedGNegRows) and (GNeg.cols() == expectedGNegCols);
     if (not bShapeFunctionGradientsHaveCorrectDimensions)
@@ -230,6 +342,12 @@ inline void SymmetricLaplacianMatrix<TMesh>::CheckValidState() const
     }
 }
 
+template <CMesh TMesh>
+inline bool SymmetricLaplacianMatrix<TMesh>::HasSharedElementLaplacian() const
+{
+    return cellQuadraturePoints > 0 and deltag.cols() == ElementType::kNodes;
+}
+
 template <CMesh TMesh>
 template <class TDerivedIn, class TDerivedOut>
 inline void SymmetricLaplacianMatrix<TMesh>::Apply(
@@ -254,21 +372,77 @@ inline void SymmetricLaplacianMatrix<TMesh>::Apply(
         throw std::invalid_argument(what);
     }
 
+    if constexpr (CGridMesh<MeshType>)
+    {
+        if (HasSharedElementLaplacian())
+        {
+            mesh.ApplyStencil(deltag, x, y, dims);
+            return;
+        }
+    }
+    // Quadrature points compute their local products independently, and nodes then gather their
+    // quadrature points' contributions, such that both passes are race-free
+    auto constexpr kNodesPerElement     = ElementType::kNodes;
     auto const numberOfQuadraturePoints = wg.size();
-    for (auto c = 0; c < x.cols(); ++c)
+    auto const numberOfNodes            = mesh.X.cols();
+    if constexpr (CTensorProductElement<ElementType>)
     {
-        for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+        if (quadratureOrder > 0)
         {
-            auto const e                    = eg(g);
-            auto const nodes                = mesh.E.col(e);
-            auto constexpr kNodesPerElement = ElementType::kNodes;
+            // Elements sum factorize L_e x_e = \sum_g \nabla_\xi N_g K_g \nabla_\xi N_g^T x_e
+            auto constexpr kRefDims     = ElementType::kDims;
+            auto const numberOfElements = mesh.E.cols();
+            yb.resize(dims, kNodesPerElement * numberOfElements);
+            DispatchSumFactorizedQuadratureOrder<ElementType>(
+                quadratureOrder,
+                [&]<auto QuadratureOrder>() {
+                    using BasisType        = TensorProductBasis<ElementType, QuadratureOrder>;
+                    auto constexpr kPoints = BasisType::kPoints;
+                    for (auto c = 0; c < x.cols(); ++c)
+                    {
+                        auto const xc = x.col(c).reshaped(dims, numberOfNodes);
+                        tbb::parallel_for(Index{0}, numberOfElements, [&](Index e) {
+                            auto const nodes = mesh.E.col(e);
+                            auto const xe    = xc(Eigen::placeholders::all, nodes);
+                            auto Gxe         = BasisType::ReferenceGradients(xe);
+                            for (auto g = 0; g < kPoints; ++g)
+                            {
+                                auto const Keg = Kg.block<kRefDims, kRefDims>(
+                                    0,
+                                    (e * kPoints + g) * kRefDims);
+                                Gxe.template middleCols<kRefDims>(g * kRefDims) *= Keg;
+                            }
+                            yb.block(0, e * kNodesPerElement, dims, kNodesPerElement) =
+                                BasisType::IntegrateReferenceGradients(Gxe);
+                        });
+                        auto yc = y.col(c).reshaped(dims, numberOfNodes);
+                        tbb::parallel_for(Index{0}, numberOfNodes, [&](Index i) {
+                            for (auto k = GNptr(i); k < GNptr(i + 1); ++k)
+                                yc.col(i) += yb.col(GNadj(k));
+                        });
+                    }
+                });
+            return;
+        }
+    }
+    yb.resize(dims, kNodesPerElement * numberOfQuadraturePoints);
+    for (auto c = 0; c < x.cols(); ++c)
+    {
+        auto const xc = x.col(c).reshaped(dims, numberOfNodes);
+        tbb::parallel_for(Index{0}, Index{numberOfQuadraturePoints}, [&](Index g) {
+            auto const e     = eg(g);
+            auto const nodes = mesh.E.col(e);
             auto const Leg =
                 deltag.block(0, g * kNodesPerElement, kNodesPerElement, kNodesPerElement);
-            auto ye = y.col(c).reshaped(dims, y.size() / dims)(Eigen::placeholders::all, nodes);
-            auto const xe =
-                x.col(c).reshaped(dims, x.size() / dims)(Eigen::placeholders::all, nodes);
-            ye += xe * Leg /*.transpose() technically, but Laplacian matrix is symmetric*/;
-        }
+            auto const xe = xc(Eigen::placeholders::all, nodes);
+            yb.block(0, g * kNodesPerElement, dims, kNodesPerElement) =
+                xe * Leg /*.transpose() technically, but Laplacian matrix is symmetric*/;
+        });
+        auto yc = y.col(c).reshaped(dims, numberOfNodes);
+        tbb::parallel_for(Index{0}, numberOfNodes, [&](Index i) {
+            for (auto k = GNptr(i); k < GNptr(i + 1); ++k)
+                yc.col(i) += yb.col(GNadj(k));
+        });
     }
 }
 
@@ -1,11 +1,13 @@
 #include "MassMatrix.h"
 
 #include "Jacobian.h"
+#include "Hexahedron.h"
 #include "Mesh.h"
 #include "Tetrahedron.h"
 
 #include <Eigen/Eigenvalues>
 #include <doctest/doctest.h>
+#include <exception>
 #include <pbat/common/ConstexprFor.h>
 #include <pbat/math/LinearOperator.h>
 
@@ -76,6 +78,13 @@ TEST_CASE("[fem] MassMatrix")
                 (yInputScaled - yOutputScaled).norm() / yOutputScaled.norm();
             CHECK_LE(yLinearityError, zero);
 
+            // Check multiple right-hand sides
+            MatrixX const X = MatrixX::Random(n, 3);
+            MatrixX Y       = MatrixX::Zero(n, 3);
+            matrixFreeMass.Apply(X, Y);
+            Scalar const YError = (M * X - Y).norm() / Y.norm();
+            CHECK_LE(YError, zero);
+
             // Check lumped mass
             VectorX lumpedMass = matrixFreeMass.ToLumpedMasses();
             CHECK_EQ(lumpedMass.size(), M.cols());
@@ -85,8 +94,69 @@ TEST_CASE("[fem] MassMatrix")
                 CHECK_LT(err, Scalar(1e-10));
             }
 
+            // Check block sparse mass matrix
+            if (outDims == 3)
+            {
+                auto const MB = matrixFreeMass.template ToBlockMatrix<3>();
+                Scalar const blockError = (MB.ToMatrix() - M).squaredNorm() / M.squaredNorm();
+                CHECK_LE(blockError, zero);
+                MatrixX YB = MatrixX::Zero(n, 3);
+                MB.Apply(X, YB);
+                Scalar const blockApplyError = (YB - Y).norm() / Y.norm();
+                CHECK_LE(blockApplyError, zero);
+            }
+            else
+            {
+                CHECK_THROWS_AS(matrixFreeMass.template ToBlockMatrix<3>(), std::invalid_argument);
+            }
+
+            // Affine elements accept element jacobian determinants
+            if constexpr (fem::CAffineElement<Element>)
+            {
+                MatrixX const detJ = detJe.row(0);
+                MassMatrix const affineMass(mesh, detJ, rho, outDims);
+                Scalar const affineError =
+                    (affineMass.ToMatrix() - M).squaredNorm() / M.squaredNorm();
+                CHECK_LE(affineError, zero);
+            }
+
             // TODO: We should probably check that the mass matrices actually have the
             // right values... But this is probably best done in a separate test.
         }
     });
+
+    // Tensor product elements' sum factorized products match their element mass matrices
+    MatrixX VH(3, 12);
+    IndexMatrixX CH(8, 2);
+    // clang-format off
+    VH << 0., 1., 0., 1., 0., 1., 0., 1., 2.5, 2., 2., 2.,
+          0., 0., 1., 1., 0., 0., 1., 1., 0.,  1., 0., 1.,
+          0., 0., 0., 0., 1., 1., 1., 1., 0.,  0., 1., 1.;
+    CH << 0, 1,
+          1, 8,
+          2, 3,
+          3, 9,
+          4, 5,
+          5, 10,
+          6, 7,
+          7, 11;
+    // clang-format on
+    common::ForRange<1, 3>([&]<auto kOrder>() {
+        using Element                   = fem::Hexahedron<kOrder>;
+        using Mesh                      = fem::Mesh<Element, 3>;
+        auto constexpr kQuadratureOrder = 2 * kOrder;
+        Mesh mesh(VH, CH);
+        MatrixX const detJe = fem::DeterminantOfJacobian<kQuadratureOrder>(mesh);
+        MatrixX const rhog  = MatrixX::Random(detJe.rows(), detJe.cols()).array() + 2.;
+        for (auto outDims = 1; outDims < 4; ++outDims)
+        {
+            fem::MassMatrix<Mesh, kQuadratureOrder> matrixFreeMass(mesh, detJe, rhog, outDims);
+            CSCMatrix const M = matrixFreeMass.ToMatrix();
+            MatrixX const X   = MatrixX::Random(M.cols(), 2);
+            MatrixX Y         = MatrixX::Zero(M.rows(), 2);
+            matrixFreeMass.Apply(X, Y);
+            Scalar const YError = (M * X - Y).norm() / Y.norm();
+            CHECK_LE(YError, 1e-10);
+        }
+    });
 }
\ No newline at end of file
@@ -12,15 +12,21 @@
 #define PBAT_FEM_MASS_MATRIX_H
 
 #include "Concepts.h"
+#include "GridMesh.h"
 #include "ShapeFunctions.h"
+#include "SumFactorization.h"
 
 #include <array>
+#include <cmath>
 #include <exception>
 #include <fmt/core.h>
 #include <pbat/Aliases.h>
 #include <pbat/common/Eigen.h>
+#include <pbat/graph/Adjacency.h>
+#include <pbat/math/linalg/BlockSparsityPattern.h>
 #include <pbat/profiling/Profiling.h>
 #include <tbb/parallel_for.h>
+#include <vector>
 
 namespace pbat {
 namespace fem {
@@ -29,6 +35,11 @@ namespace fem {
  * @brief A matrix-free representation of a finite element mass matrix \f$ \mathbf{M}_{ij} =
  * \int_\Omega \rho(X) \phi_i(X) \phi_j(X) \f$.
  *
+ * For tensor product elements (see CTensorProductElement), Apply() sum factorizes element
+ * products rather than multiplying by dense element mass matrices. On structured grids (see
+ * CGridMesh) of uniform mass density, all cells share a single element mass matrix, which is
+ * applied by GridMesh::ApplyStencil().
+ *
  * \note Link to my higher-level FEM crash course doc.
  *
  * @tparam TMesh Type satisfying concept CMesh
@@ -50,7 +61,7 @@ struct MassMatrix
      * @brief Construct a MassMatrix
      * @param mesh Finite element mesh
      * @param detJe `|# quad.pts.|x|# elements|` affine element jacobian determinants at quadrature
-     * points
+     * points, or `1x|# elements|` element jacobian determinants for affine elements
      * @param rho Uniform mass density
      * @param dims Dimensionality of image of FEM function space. Should have `dims >= 1`.
      */
@@ -65,7 +76,7 @@ struct MassMatrix
      * @tparam TDerived Eigen dense expression type
      * @param mesh Finite element mesh
      * @param detJe `|# quad.pts.|x|# elements|` affine element jacobian determinants at quadrature
-     * points
+     * points, or `1x|# elements|` element jacobian determinants for affine elements
      * @param rho `|# quad.pts.|x|# elements|` mass density per quadrature point
      * @param dims Dimensionality of image of FEM function space. Should have `dims >= 1`.
      */
@@ -87,6 +98,7 @@ struct MassMatrix
      * @param y Output vector/matrix
      * @pre `x.rows() == |#nodes*dims|` and `y.rows() == |#nodes*dims|` and `x.cols() == y.cols()`
      * and `dims >= 1`
+     * @note Not thread-safe, since Apply() reuses this operator's scratch buffer
      */
     template <class TDerivedIn, class TDerivedOut>
     void Apply(Eigen::MatrixBase<TDerivedIn> const& x, Eigen::DenseBase<TDerivedOut>& y) const;
@@ -97,6 +109,16 @@ struct MassMatrix
      * @return Sparse compressed column matrix representation of this mass matrix
      */
     CSCMatrix ToMatrix() const;
+    /**
+     * @brief Transforms this matrix-free mass matrix representation into block sparse row format
+     * with `Dims x Dims` nodal blocks \f$ m_{ij} \mathbf{I}_{d} \f$
+     *
+     * @tparam Dims Dimensionality of image of FEM function space
+     * @return Block sparse matrix representation of this mass matrix
+     * @pre `dims == Dims`
+     */
+    template <int Dims>
+    math::linalg::BlockSparseMatrix<Dims> ToBlockMatrix() const;
 
     /**
      * @brief Diagonalizes (via mass lumping) this mass matrix into vector representation.
@@ -129,16 +151,44 @@ struct MassMatrix
      * @brief Checks if this mass matrix is in a valid state.
      */
     void CheckValidState() const;
+    /**
+     * @brief Checks if all elements share the single element mass matrix Me (structured grids of
+     * uniform mass density only)
+     * @return true if Me holds a single element mass matrix shared by all elements
+     */
+    bool HasSharedElementMassMatrix() const;
 
     MeshType const& mesh;            ///< The finite element mesh
     Eigen::Ref<MatrixX const> detJe; ///< `|# element quadrature points| x |# elements|` matrix of
-                                     ///< jacobian determinants at element quadrature points
+                                     ///< jacobian determinants at element quadrature points, or
+                                     ///< `1 x |# elements|` for affine elements
     MatrixX Me; ///< `|# element nodes|x|# element nodes * # elements|` element mass matrices
                 ///< for 1-dimensional problems. For d-dimensional problems, these mass matrices
                 ///< should be Kroneckered with the \f$ d \f$-dimensional identity matrix 
-                ///< \f$ \mathbf{I}_d \f$.
+                ///< \f$ \mathbf{I}_d \f$. Holds a single `|# element nodes|x|# element nodes|`
+                ///< matrix if HasSharedElementMassMatrix().
+    MatrixX wrhog; ///< `|# element quadrature points| x |# elements|` quadrature weights
+                   ///< scaled by mass densities and jacobian determinants (tensor product
+                   ///< elements only)
     int dims; ///< Dimensionality of image of FEM function space, i.e. this mass matrix is actually
               ///< \f$ \mathbf{M} \otimes \mathbf{I}_{d} \f$. Should have `dims >= 1`.
+    IndexVectorX GNptr; ///< Node i's element-local contributions are GNadj[GNptr[i]:GNptr[i+1]]
+    IndexVectorX GNadj; ///< Element-local node indices `e*|# element nodes| + a` of nodes
+    mutable MatrixX ye; ///< `dims x |# element nodes * # elements|` element-local products of
+                        ///< Apply(), cached across calls
+
+  private:
+    /**
+     * @brief Element e's mass matrix
+     * @param e Element index
+     * @return `|# element nodes|x|# element nodes|` block of Me
+     */
+    auto ElementMassMatrix(Index e) const
+    {
+        auto constexpr kNodesPerElement = ElementType::kNodes;
+        auto const k                    = HasSharedElementMassMatrix() ? Index{0} : e;
+        return Me.template block<kNodesPerElement, kNodesPerElement>(0, k * kNodesPerElement);
+    }
 };
 
 template <CMesh TMesh, int QuadratureOrder>
@@ -162,9 +212,13 @@ inline MassMatrix<TMesh, QuadratureOrder>::MassMatrix(
     Eigen::Ref<MatrixX const> const& detJe,
     Eigen::DenseBase<TDerived> const& rho,
     int dims)
-    : mesh(mesh), detJe(detJe), Me(), dims(dims)
+    : mesh(mesh), detJe(detJe), Me(), wrhog(), dims(dims), GNptr(), GNadj(), ye()
 {
     ComputeElementMassMatrices(rho);
+    if (HasSharedElementMassMatrix())
+        return;
+    IndexVectorX const nodes = mesh.E.reshaped();
+    std::tie(GNptr, GNadj)   = graph::MapToAdjacency(nodes, mesh.X.cols());
 }
 
 template <CMesh TMesh, int QuadratureOrder>
@@ -190,21 +244,48 @@ inline void MassMatrix<TMesh, QuadratureOrder>::Apply(
         throw std::invalid_argument(what);
     }
 
-    auto const numberOfElements = mesh.E.cols();
-    // NOTE: Could parallelize over columns, if there are many.
-    for (auto c = 0; c < y.cols(); ++c)
+    if constexpr (CGridMesh<MeshType>)
     {
-        for (auto e = 0; e < numberOfElements; ++e)
+        if (HasSharedElementMassMatrix())
         {
-            auto const nodes = mesh.E.col(e).array();
-            auto const me =
-                Me.block<ElementType::kNodes, ElementType::kNodes>(0, e * ElementType::kNodes);
-            auto ye = y.col(c).reshaped(dims, y.size() / dims)(Eigen::placeholders::all, nodes);
-            auto const xe =
-                x.col(c).reshaped(dims, x.size() / dims)(Eigen::placeholders::all, nodes);
-            ye += xe * me /*.transpose() technically, but mass matrix is symmetric*/;
+            mesh.ApplyStencil(Me, x, y, dims);
+            return;
         }
     }
+    // Elements compute their local products independently, and nodes then gather their elements'
+    // contributions, such that both passes are race-free
+    auto constexpr kNodesPerElement = ElementType::kNodes;
+    auto const numberOfElements     = mesh.E.cols();
+    auto const numberOfNodes        = mesh.X.cols();
+    ye.resize(dims, kNodesPerElement * numberOfElements);
+    for (auto c = 0; c < y.cols(); ++c)
+    {
+        auto const xc = x.col(c).reshaped(dims, numberOfNodes);
+        tbb::parallel_for(Index{0}, numberOfElements, [&](Index e) {
+            auto const nodes = mesh.E.col(e).array();
+            auto const xe    = xc(Eigen::placeholders::all, nodes);
+            if constexpr (CTensorProductElement<ElementType>)
+            {
+                // M_e x_e = \sum_g w_g \rho_g |J_g| N(X_g) N(X_g)^T x_e, in O(p^{d+1})
+                using BasisType = TensorProductBasis<ElementType, QuadratureOrder>;
+                auto xg         = BasisType::Interpolate(xe);
+                xg *= wrhog.col(e).asDiagonal();
+                ye.block(0, e * kNodesPerElement, dims, kNodesPerElement) =
+                    BasisType::IntegrateValues(xg);
+            }
+            else
+            {
+                auto const me = ElementMassMatrix(e);
+                ye.block(0, e * kNodesPerElement, dims, kNodesPerElement) =
+                    xe * me /*.transpose() technically, but mass matrix is symmetric*/;
+            }
+        });
+        auto yc = y.col(c).reshaped(dims, numberOfNodes);
+        tbb::parallel_for(Index{0}, numberOfNodes, [&](Index i) {
+            for (auto k = GNptr(i); k < GNptr(i + 1); ++k)
+                yc.col(i) += ye.col(GNadj(k));
+        });
+    }
 }
 
 template <CMesh TMesh, int QuadratureOrder>
@@ -216,13 +297,13 @@ inline CSCMatrix MassMatrix<TMesh, QuadratureOrder>::ToMatrix() const
     using Triplet     = Eigen::Triplet<Scalar, SparseIndex>;
 
     std::vector<Triplet> triplets{};
-    triplets.reserve(static_cast<std::size_t>(Me.size() * dims));
     auto const numberOfElements = mesh.E.cols();
+    triplets.reserve(static_cast<std::size_t>(
+        ElementType::kNodes * ElementType::kNodes * numberOfElements * dims));
     for (auto e = 0; e < numberOfElements; ++e)
     {
         auto const nodes = mesh.E.col(e);
-        auto const me =
-            Me.block<ElementType::kNodes, ElementType::kNodes>(0, e * ElementType::kNodes);
+        auto const me    = ElementMassMatrix(e);
         for (auto j = 0; j < me.cols(); ++j)
         {
             for (auto i = 0; i < me.rows(); ++i)
@@ -242,6 +323,47 @@ inline CSCMatrix MassMatrix<TMesh, QuadratureOrder>::ToMatrix() const
     return Mmat;
 }
 
+template <CMesh TMesh, int QuadratureOrder>
+template <int Dims>
+inline auto MassMatrix<TMesh, QuadratureOrder>::ToBlockMatrix() const
+    -> math::linalg::BlockSparseMatrix<Dims>
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.MassMatrix.ToBlockMatrix");
+    CheckValidState();
+    if (dims != Dims)
+    {
+        std::string const what =
+            fmt::format("Expected block size equal to dims={}, but got {}", dims, Dims);
+        throw std::invalid_argument(what);
+    }
+    auto constexpr kNodesPerElement = ElementType::kNodes;
+    auto const numberOfElements     = mesh.E.cols();
+    auto const numberOfNodes        = mesh.X.cols();
+    // Element e's nodal block (i,j) is block k = e*kNodes^2 + j*kNodes + i
+    std::vector<Index> rows{}, cols{};
+    rows.reserve(static_cast<std::size_t>(kNodesPerElement * mesh.E.size()));
+    cols.reserve(static_cast<std::size_t>(kNodesPerElement * mesh.E.size()));
+    for (auto e = 0; e < numberOfElements; ++e)
+    {
+        for (auto j = 0; j < kNodesPerElement; ++j)
+        {
+            for (auto i = 0; i < kNodesPerElement; ++i)
+            {
+                rows.push_back(mesh.E(i, e));
+                cols.push_back(mesh.E(j, e));
+            }
+        }
+    }
+    math::linalg::BlockSparsityPattern<Dims> const GP(numberOfNodes, numberOfNodes, rows, cols);
+    return GP.ToMatrix([&](Index k) {
+        auto constexpr kNodalBlocks = kNodesPerElement * kNodesPerElement;
+        auto const e                = k / kNodalBlocks;
+        auto const i                = (k % kNodalBlocks) % kNodesPerElement;
+        auto const j                = (k % kNodalBlocks) / kNodesPerElement;
+        return (ElementMassMatrix(e)(i, j) * Matrix<Dims, Dims>::Identity()).eval();
+    });
+}
+
 template <CMesh TMesh, int QuadratureOrder>
 inline VectorX MassMatrix<TMesh, QuadratureOrder>::ToLumpedMasses() const
 {
@@ -251,8 +373,7 @@ inline VectorX MassMatrix<TMesh, QuadratureOrder>::ToLumpedMasses() const
     for (auto e = 0; e < numberOfElements; ++e)
     {
         auto const nodes = mesh.E.col(e);
-        auto const me =
-            Me.block<ElementType::kNodes, ElementType::kNodes>(0, e * ElementType::kNodes);
+        auto const me    = ElementMassMatrix(e);
         for (auto j = 0; j < me.cols(); ++j)
         {
             for (auto i = 0; i < me.rows(); ++i)
@@ -271,11 +392,13 @@ inline VectorX MassMatrix<TMesh, QuadratureOrder>::ToLumpedMasses() const
 template <CMesh TMesh, int QuadratureOrder>
 inline void MassMatrix<TMesh, QuadratureOrder>::CheckValidState() const
 {
-    auto const numberOfElements       = mesh.E.cols();
-    auto constexpr kExpectedDetJeRows = QuadratureRuleType::kPoints;
-    auto const expectedDetJeCols      = numberOfElements;
+    auto const numberOfElements        = mesh.E.cols();
+    auto constexpr kExpectedDetJeRows  = QuadratureRuleType::kPoints;
+    auto const expectedDetJeCols       = numberOfElements;
+    bool const bHasElementDeterminants = CAffineElement<ElementType> and detJe.rows() == 1;
     bool const bDeterminantsHaveCorrectDimensions =
-        (detJe.rows() == kExpectedDetJeRows) and (detJe.cols() == expectedDetJeCols);
+        (detJe.rows() == kExpectedDetJeRows or bHasElementDeterminants) and
+        (detJe.cols() == expectedDetJeCols);
     if (not bDeterminantsHaveCorrectDimensions)
     {
         std::string const what = fmt::format(
@@ -297,6 +420,15 @@ inline void MassMatrix<TMesh, QuadratureOrder>::CheckValidState() const
     }
 }
 
+template <CMesh TMesh, int QuadratureOrder>
+inline bool MassMatrix<TMesh, QuadratureOrder>::HasSharedElementMassMatrix() const
+{
+    if constexpr (CGridMesh<MeshType>)
+        return Me.cols() == ElementType::kNodes;
+    else
+        return false;
+}
+
 template <CMesh TMesh, int QuadratureOrder>
 template <class TDerived>
 inline void MassMatrix<TMesh, QuadratureOrder>::ComputeElementMassMatrices(
@@ -328,15 +460,65 @@ inline void MassMatrix<TMesh, QuadratureOrder>::ComputeElementMassMatrices(
     {
         NgOuterNg[static_cast<std::size_t>(g)] = wg(g) * (N.col(g) * N.col(g).transpose());
     }
-    // Compute element mass matrices
-    Me.setZero(kNodesPerElement, kNodesPerElement * numberOfElements);
-    tbb::parallel_for(Index{0}, Index{numberOfElements}, [&](Index e) {
-        auto me = Me.block<kNodesPerElement, kNodesPerElement>(0, e * kNodesPerElement);
-        for (auto g = 0; g < kQuadPtsPerElement; ++g)
+    // Geometrically identical grid cells of uniform mass density share their mass matrix
+    if constexpr (CGridMesh<MeshType>)
+    {
+        auto const rhoDetJ = [&](Index g, Index e) {
+            return rho(g, e) * detJe(detJe.rows() == 1 ? 0 : g, e);
+        };
+        bool bIsDensityUniform = true;
+        for (auto e = 1; e < numberOfElements and bIsDensityUniform; ++e)
+            for (auto g = 0; g < kQuadPtsPerElement; ++g)
+                bIsDensityUniform &= std::abs(rhoDetJ(g, e) - rhoDetJ(g, 0)) <=
+                                     Scalar(1e-10) * std::abs(rhoDetJ(g, 0));
+        if (bIsDensityUniform and numberOfElements > 0)
         {
-            me += (rho(g, e) * detJe(g, e)) * NgOuterNg[static_cast<std::size_t>(g)];
+            Me.setZero(kNodesPerElement, kNodesPerElement);
+            for (auto g = 0; g < kQuadPtsPerElement; ++g)
+                Me += rhoDetJ(g, 0) * NgOuterNg[static_cast<std::size_t>(g)];
+            wrhog.resize(0, 0);
+            return;
         }
-    });
+    }
+    // Sum factorized products only need weighted densities at quadrature points
+    if constexpr (CTensorProductElement<ElementType>)
+    {
+        wrhog.resize(kQuadPtsPerElement, numberOfElements);
+        for (auto e = 0; e < numberOfElements; ++e)
+            for (auto g = 0; g < kQuadPtsPerElement; ++g)
+                wrhog(g, e) = wg(g) * rho(g, e) * detJe(g, e);
+    }
+    // Compute element mass matrices
+    Me.setZero(kNodesPerElement, kNodesPerElement * numberOfElements);
+    if constexpr (CAffineElement<ElementType>)
+    {
+        // Jacobian determinants are constant over affine elements, such that element mass
+        // matrices of element-wise constant densities are scaled reference mass matrices
+        Matrix<kNodesPerElement, kNodesPerElement> Mref =
+            Matrix<kNodesPerElement, kNodesPerElement>::Zero();
+        for (auto const& NgNg : NgOuterNg)
+            Mref += NgNg;
+        tbb::parallel_for(Index{0}, Index{numberOfElements}, [&](Index e) {
+            auto me = Me.block<kNodesPerElement, kNodesPerElement>(0, e * kNodesPerElement);
+            if ((rho.col(e).array() == rho(0, e)).all())
+            {
+                me = (rho(0, e) * detJe(0, e)) * Mref;
+                return;
+            }
+            for (auto g = 0; g < kQuadPtsPerElement; ++g)
+                me += (rho(g, e) * detJe(0, e)) * NgOuterNg[static_cast<std::size_t>(g)];
+        });
+    }
+    else
+    {
+        tbb::parallel_for(Index{0}, Index{numberOfElements}, [&](Index e) {
+            auto me = Me.block<kNodesPerElement, kNodesPerElement>(0, e * kNodesPerElement);
+            for (auto g = 0; g < kQuadPtsPerElement; ++g)
+            {
+                me += (rho(g, e) * detJe(g, e)) * NgOuterNg[static_cast<std::size_t>(g)];
+            }
+        });
+    }
 }
 
 } // namespace fem
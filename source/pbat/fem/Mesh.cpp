@@ -61,12 +61,40 @@ TEST_CASE("[fem] Mesh")
             using Element                     = fem::Tetrahedron<kOrder>;
             using Mesh                        = fem::Mesh<Element, kDims>;
             auto const kExpectedNumberOfNodes = 14;
+            // Nodes are numbered in order of first visit, element by element
+            IndexMatrixX EExpected(Element::kNodes, 2);
+            // clang-format off
+            EExpected << 0, 10,
+                         1, 11,
+                         2,  0,
+                         3, 12,
+                         4,  3,
+                         5,  5,
+                         6, 13,
+                         7,  6,
+                         8,  8,
+                         9,  9;
+            // clang-format on
             Mesh M(V, C);
 
             CHECK(fem::CElement<Element>);
             CHECK(fem::CMesh<Mesh>);
             CHECK_EQ(M.E.cols(), C.cols());
             CHECK_EQ(M.X.cols(), kExpectedNumberOfNodes);
+            CHECK(M.E == EExpected);
+            auto const Xi = common::ToEigen(Element::Coordinates)
+                                .reshaped(Element::kDims, Element::kNodes)
+                                .cast<Scalar>() /
+                            kOrder;
+            for (auto c = 0; c < C.cols(); ++c)
+            {
+                Matrix<kDims, 4> const Xc = V(Eigen::placeholders::all, C.col(c));
+                for (auto i = 0; i < Element::kNodes; ++i)
+                {
+                    Vector<kDims> const XExpected = Xc * fem::Tetrahedron<1>::N(Xi.col(i));
+                    CHECK_LE((M.X.col(M.E(i, c)) - XExpected).squaredNorm(), 1e-15);
+                }
+            }
         }
     }
     SUBCASE("Hexahedral")
@@ -117,6 +145,15 @@ TEST_CASE("[fem] Mesh")
             CHECK(fem::CMesh<Mesh>);
             CHECK_EQ(M.E.cols(), C.cols());
             CHECK_EQ(M.X.cols(), kExpectedNumberOfNodes);
+            // The second cube shares the first cube's x=1 face, i.e. its x=0 face
+            IndexVectorX const firstCubeNodes = IndexVectorX::LinSpaced(Element::kNodes, 0, 26);
+            CHECK(M.E.col(0) == firstCubeNodes);
+            for (auto a = 0; a < Element::kNodes; a += 3)
+            {
+                CHECK_EQ(M.E(a, 1), M.E(a + 2, 0));
+                CHECK_EQ(M.E(a + 1, 1), 27 + 2 * (a / 3));
+                CHECK_EQ(M.E(a + 2, 1), 28 + 2 * (a / 3));
+            }
         }
     }
 }
@@ -15,14 +15,20 @@
 #include "Jacobian.h"
 
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
 #include <exception>
-#include <map>
 #include <numeric>
 #include <pbat/Aliases.h>
 #include <pbat/common/Eigen.h>
 #include <pbat/math/Rational.h>
 #include <pbat/profiling/Profiling.h>
-#include <ranges>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_scan.h>
+#include <tbb/parallel_sort.h>
+#include <utility>
+#include <vector>
 
 namespace pbat {
 namespace fem {
@@ -112,80 +118,42 @@ struct LinearMeshView
 };
 
 namespace detail {
+
+/**
+ * @brief Affine weights of an element's nodes w.r.t. its vertices
+ *
+ * Node i of the element is \f$ \sum_v \frac{W_{vi}}{p^d} X_v \f$, where \f$ X_v \f$ are the
+ * element's vertices, \f$ p \f$ is the element's order and \f$ d \f$ its dimensionality.
+ * Weights are evaluated once per element type in exact rational arithmetic, such that nodes of
+ * different elements can be identified by comparing integers.
+ *
+ * @tparam TElement Type satisfying concept CElement
+ * @return `|# affine element nodes| x |# element nodes|` integer affine weights
+ */
 template <CElement TElement>
-class NodalKey
+Eigen::Matrix<Index, TElement::AffineBaseType::kNodes, TElement::kNodes> NodalAffineWeights()
 {
-  public:
-    using SelfType                 = NodalKey<TElement>;
-    static int constexpr kVertices = TElement::AffineBaseType::kNodes;
-
-    NodalKey(
-        IndexVector<kVertices> const& cellVertices,
-        IndexVector<kVertices> const& sortOrder,
-        Eigen::Vector<math::Rational, kVertices> const& N)
-        : mCellVertices(cellVertices), mSortOrder(sortOrder), mN(N), mSize()
-    {
-        // Remove vertices whose corresponding shape function is zero
-        auto it = std::remove_if(mSortOrder.begin(), mSortOrder.end(), [this](Index o) {
-            return mN[o] == 0;
-        });
-        // Count number of non-zero shape functions into Size
-        mSize = static_cast<decltype(mSize)>(std::distance(mSortOrder.begin(), it));
-    }
-
-    bool operator==(SelfType const& rhs) const
+    using AffineElementType = typename TElement::AffineBaseType;
+    std::int64_t denominator{1};
+    for (auto d = 0; d < TElement::kDims; ++d)
+        denominator *= TElement::kOrder;
+    auto const nodalCoordinates = common::ToEigen(TElement::Coordinates)
+                                      .reshaped(TElement::kDims, TElement::kNodes)
+                                      .template cast<math::Rational>() /
+                                  TElement::kOrder;
+    Eigen::Matrix<Index, AffineElementType::kNodes, TElement::kNodes> W{};
+    for (auto i = 0; i < TElement::kNodes; ++i)
     {
-        // Sizes must match
-        if (mSize != rhs.mSize)
-            return false;
-        for (auto i = 0u; i < mSize; ++i)
+        auto N = AffineElementType::N(nodalCoordinates.col(i));
+        for (auto v = 0; v < AffineElementType::kNodes; ++v)
         {
-            // Vertices involved in affine map must match
-            Index const lhsVertex = mCellVertices[mSortOrder[i]];
-            Index const rhsVertex = rhs.mCellVertices[rhs.mSortOrder[i]];
-            if (lhsVertex != rhsVertex)
-                return false;
-            // Affine weights at matching vertices must match
-            math::Rational const lhsN = mN[mSortOrder[i]];
-            math::Rational const rhsN = rhs.mN[rhs.mSortOrder[i]];
-            if (lhsN != rhsN)
-                return false;
+            [[maybe_unused]] bool const bIsRebased = N(v).Rebase(denominator);
+            assert(bIsRebased);
+            W(v, i) = static_cast<Index>(N(v).a);
         }
-        // Everything matches, (*this) and rhs must represent same node
-        return true;
     }
-
-    bool operator<(SelfType const& rhs) const
-    {
-        // Sort by size first
-        if (mSize != rhs.mSize)
-            return mSize < rhs.mSize;
-        // Then sort by vertex indices
-        for (auto i = 0; i < mSize; ++i)
-        {
-            Index const lhsVertex = mCellVertices[mSortOrder[i]];
-            Index const rhsVertex = rhs.mCellVertices[rhs.mSortOrder[i]];
-            if (lhsVertex != rhsVertex)
-                return lhsVertex < rhsVertex;
-        }
-        // Then sort by coordinates
-        for (auto i = 0; i < mSize; ++i)
-        {
-            math::Rational const lhsN = mN[mSortOrder[i]];
-            math::Rational const rhsN = rhs.mN[rhs.mSortOrder[i]];
-            if (lhsN != rhsN)
-                return lhsN < rhsN;
-        }
-        // (*this) == rhs is true, so (*this) is not less than rhs
-        return false;
-    }
-
-  private:
-    IndexVector<kVertices> mCellVertices;        ///< Cell vertex indices
-    IndexVector<kVertices> mSortOrder;           ///< Ordering of the cell vertices
-    Eigen::Vector<math::Rational, kVertices> mN; ///< Node's affine shape function values
-    int mSize; ///< Number of non-zero affine shape function values
-};
+    return W;
+}
 
 } // namespace detail
 
@@ -214,59 +182,106 @@ Mesh<TElement, Dims>::Mesh(
         assert(C.rows() == kVerticesPerCell);
         assert(V.rows() == kDims);
 
-        using detail::NodalKey;
-        using NodeMap = std::map<NodalKey<ElementType>, Index>;
-
-        auto const numberOfCells    = C.cols();
-        auto const numberOfVertices = V.cols();
-
-        NodeMap nodeMap{};
-        std::vector<Vector<kDims>> nodes{};
-        nodes.reserve(static_cast<std::size_t>(numberOfVertices));
-
-        // Construct mesh topology, i.e. assign mesh nodes to elements,
-        // ensuring that adjacent elements share their common nodes.
-        E.resize(ElementType::kNodes, numberOfCells);
-        for (auto c = 0; c < numberOfCells; ++c)
-        {
-            IndexVector<kVerticesPerCell> const cellVertices = C.col(c);
-            Matrix<kDims, kVerticesPerCell> const Xc = V(Eigen::placeholders::all, cellVertices);
-
-            // Sort based on cell vertex index
-            IndexVector<kVerticesPerCell> sortOrder{};
-            std::iota(sortOrder.begin(), sortOrder.end(), 0);
-            std::ranges::sort(sortOrder, [&](Index i, Index j) {
-                return cellVertices[i] < cellVertices[j];
-            });
-            // Loop over nodes of element and create the node on first visit
-            auto const nodalCoordinates = common::ToEigen(ElementType::Coordinates)
-                                              .reshaped(ElementType::kDims, ElementType::kNodes)
-                                              .template cast<math::Rational>() /
-                                          ElementType::kOrder;
-            for (auto i = 0; i < nodalCoordinates.cols(); ++i)
-            {
-                // Use exact rational arithmetic to evaluate affine element shape functions at the
-                // node to get its exact affine coordinates
-                auto const Xi = nodalCoordinates.col(i);
-                auto const N  = AffineElementType::N(Xi);
-                NodalKey<ElementType> const key{cellVertices, sortOrder, N};
-                auto it                        = nodeMap.find(key);
-                bool const bNodeAlreadyCreated = it != nodeMap.end();
-                if (!bNodeAlreadyCreated)
+        auto constexpr kNodesPerElement = ElementType::kNodes;
+        auto const numberOfCells        = C.cols();
+        auto const numberOfSlots        = kNodesPerElement * numberOfCells;
+
+        // Element node i of cell c is identified by its affine support, i.e. the cell vertices
+        // with non-zero affine weights and their (integer) weights, sorted by vertex index.
+        // Adjacent elements share a node iff they produce the same support.
+        auto const W        = detail::NodalAffineWeights<ElementType>();
+        using NodalKey      = std::array<std::pair<Index, Index>, kVerticesPerCell>;
+        auto const nodalKey = [&](Index s) {
+            auto const c = s / kNodesPerElement;
+            auto const i = s % kNodesPerElement;
+            NodalKey key{};
+            key.fill({Index{-1}, Index{0}});
+            auto size = 0;
+            for (auto v = 0; v < kVerticesPerCell; ++v)
+                if (W(v, i) != 0)
+                    key[static_cast<std::size_t>(size++)] = {C(v, c), W(v, i)};
+            std::sort(key.begin(), key.begin() + size);
+            return key;
+        };
+
+        // Sort element nodes (i.e. slots s = c*kNodes + i) by support, then by slot, such that
+        // duplicate nodes are contiguous and each duplicate run starts with its first visit.
+        // Supports are computed once per slot, rather than once per comparison.
+        std::vector<NodalKey> keys(static_cast<std::size_t>(numberOfSlots));
+        tbb::parallel_for(Index{0}, numberOfSlots, [&](Index s) {
+            keys[static_cast<std::size_t>(s)] = nodalKey(s);
+        });
+        std::vector<Index> sorted(static_cast<std::size_t>(numberOfSlots));
+        std::iota(sorted.begin(), sorted.end(), Index{0});
+        tbb::parallel_sort(sorted.begin(), sorted.end(), [&](Index lhs, Index rhs) {
+            auto const& lhsKey = keys[static_cast<std::size_t>(lhs)];
+            auto const& rhsKey = keys[static_cast<std::size_t>(rhs)];
+            return lhsKey < rhsKey or (lhsKey == rhsKey and lhs < rhs);
+        });
+        std::vector<Index> isFirstVisit(static_cast<std::size_t>(numberOfSlots));
+        tbb::parallel_for(Index{0}, numberOfSlots, [&](Index k) {
+            auto const kk         = static_cast<std::size_t>(k);
+            bool const bIsRunHead = (k == 0) or (keys[static_cast<std::size_t>(sorted[kk - 1])] !=
+                                                 keys[static_cast<std::size_t>(sorted[kk])]);
+            isFirstVisit[static_cast<std::size_t>(sorted[kk])] = static_cast<Index>(bIsRunHead);
+        });
+        // Each element node's first visit is the head of its duplicate run, i.e. the last run head
+        // up to its sorted position
+        std::vector<Index> firstVisit(static_cast<std::size_t>(numberOfSlots));
+        tbb::parallel_scan(
+            tbb::blocked_range<std::size_t>(0, static_cast<std::size_t>(numberOfSlots)),
+            Index{0},
+            [&](tbb::blocked_range<std::size_t> const& r, Index head, bool bIsFinalScan) {
+                for (auto k = r.begin(); k < r.end(); ++k)
                 {
-                    auto const nodeIdx     = static_cast<Index>(nodes.size());
-                    Vector<kDims> const xi = Xc * N.template cast<Scalar>();
-                    nodes.push_back(xi);
-                    bool bInserted{};
-                    std::tie(it, bInserted) = nodeMap.insert({key, nodeIdx});
-                    assert(bInserted);
+                    auto const s = static_cast<std::size_t>(sorted[k]);
+                    if (isFirstVisit[s] != 0)
+                        head = static_cast<Index>(k);
+                    if (bIsFinalScan)
+                        firstVisit[s] = sorted[static_cast<std::size_t>(head)];
                 }
-                Index const node = it->second;
-                E(i, c)          = node;
-            }
-        }
-        // Collect node positions
-        X = common::ToEigen(nodes);
+                return head;
+            },
+            [](Index lhs, Index rhs) { return std::max(lhs, rhs); });
+
+        // Number nodes in order of first visit via parallel prefix sum over slots, as if elements
+        // created their nodes one after the other
+        std::vector<Index> nodeOf(static_cast<std::size_t>(numberOfSlots));
+        tbb::parallel_scan(
+            tbb::blocked_range<std::size_t>(0, static_cast<std::size_t>(numberOfSlots)),
+            Index{0},
+            [&](tbb::blocked_range<std::size_t> const& r, Index sum, bool bIsFinalScan) {
+                for (auto s = r.begin(); s < r.end(); ++s)
+                {
+                    sum += isFirstVisit[s];
+                    if (bIsFinalScan)
+                        nodeOf[s] = sum - 1;
+                }
+                return sum;
+            },
+            [](Index lhs, Index rhs) { return lhs + rhs; });
+        auto const numberOfNodes = numberOfSlots > 0 ? nodeOf.back() + 1 : Index{0};
+
+        // Construct mesh topology, i.e. assign mesh nodes to elements, and create nodes at their
+        // first visit
+        // Affine weights partition unity, i.e. each column of W sums to the common denominator
+        Scalar const denominator = static_cast<Scalar>(W.col(0).sum());
+        E.resize(kNodesPerElement, numberOfCells);
+        X.resize(kDims, numberOfNodes);
+        tbb::parallel_for(Index{0}, numberOfSlots, [&](Index s) {
+            auto const ss = static_cast<std::size_t>(s);
+            auto const c  = s / kNodesPerElement;
+            auto const i  = s % kNodesPerElement;
+            E(i, c)       = nodeOf[static_cast<std::size_t>(firstVisit[ss])];
+            if (isFirstVisit[ss] == 0)
+                return;
+            IndexVector<kVerticesPerCell> const cellVertices = C.col(c);
+            Matrix<kDims, kVerticesPerCell> const Xc = V(Eigen::placeholders::all, cellVertices);
+            Vector<kVerticesPerCell> N{};
+            for (auto v = 0; v < kVerticesPerCell; ++v)
+                N(v) = static_cast<Scalar>(W(v, i)) / denominator;
+            X.col(nodeOf[ss]) = Xc * N;
+        });
     }
 }
 
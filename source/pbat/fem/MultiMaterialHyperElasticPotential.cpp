@@ -0,0 +1,154 @@
+#include "MultiMaterialHyperElasticPotential.h"
+
+#include "Mesh.h"
+#include "ShapeFunctions.h"
+#include "Tetrahedron.h"
+
+#include <doctest/doctest.h>
+#include <pbat/common/ConstexprFor.h>
+#include <pbat/math/LinearOperator.h>
+#include <pbat/physics/CorotationalEnergy.h>
+#include <pbat/physics/SaintVenantKirchhoffEnergy.h>
+#include <pbat/physics/StableNeoHookeanEnergy.h>
+
+TEST_CASE("[fem] MultiMaterialHyperElasticPotential")
+{
+    using namespace pbat;
+    // Cube tetrahedral mesh
+    MatrixX V(3, 8);
+    IndexMatrixX C(4, 5);
+    // clang-format off
+    V << 0., 1., 0., 1., 0., 1., 0., 1.,
+            0., 0., 1., 1., 0., 0., 1., 1.,
+            0., 0., 0., 0., 1., 1., 1., 1.;
+    C << 0, 3, 5, 6, 0,
+            1, 2, 4, 7, 5,
+            3, 0, 6, 5, 3,
+            5, 6, 0, 3, 6;
+    // clang-format on
+    Scalar constexpr zero = 1e-10;
+    common::ForValues<1, 2>([&]<auto kOrder>() {
+        auto constexpr kDims            = 3;
+        auto constexpr kQuadratureOrder = 2;
+        using ElementType               = fem::Tetrahedron<kOrder>;
+        using MeshType                  = fem::Mesh<ElementType, kDims>;
+        using SoftEnergyType            = physics::StableNeoHookeanEnergy<kDims>;
+        using StiffEnergyType           = physics::SaintVenantKirchhoffEnergy<kDims>;
+        using RigidEnergyType           = physics::CorotationalEnergy<kDims>;
+        using ElasticPotentialType      = fem::MultiMaterialHyperElasticPotential<
+                 MeshType,
+                 SoftEnergyType,
+                 StiffEnergyType,
+                 RigidEnergyType>;
+
+        CHECK(math::CLinearOperator<ElasticPotentialType>);
+
+        MeshType const M(V, C);
+        MatrixX const wg      = fem::InnerProductWeights<kQuadratureOrder>(M).reshaped();
+        MatrixX const GNeg    = fem::ShapeFunctionGradients<kQuadratureOrder>(M);
+        IndexVectorX const eg = IndexVectorX::LinSpaced(M.E.cols(), Index(0), M.E.cols() - 1)
+                                    .replicate(1, wg.size() / M.E.cols())
+                                    .transpose()
+                                    .reshaped();
+        auto const nQuadPts = wg.size();
+        // Interleave materials, such that segments are non-contiguous in the input
+        IndexVectorX mg(nQuadPts);
+        for (auto g = 0; g < nQuadPts; ++g)
+            mg(g) = g % 3;
+        VectorX const Y =
+            1e6 * (VectorX::Ones(nQuadPts) + 0.5 * VectorX::Random(nQuadPts).cwiseAbs());
+        VectorX const nu = VectorX::Constant(nQuadPts, 0.45);
+        VectorX const x  = M.X.reshaped() + 0.1 * VectorX::Random(M.X.size());
+
+        ElasticPotentialType U(M, eg, wg, GNeg, mg, Y, nu);
+        CHECK_EQ(U.Sptr(ElasticPotentialType::kMaterials), nQuadPts);
+        for (auto k = 0; k < 3; ++k)
+            for (auto g = U.Sptr(k); g < U.Sptr(k + 1); ++g)
+                CHECK_EQ(mg(U.Gperm(g)), k);
+
+        // The multi-material potential is the sum of single material potentials whose quadrature
+        // weights vanish outside of their material
+        auto const materialWeights = [&](Index k) {
+            VectorX wk = wg;
+            for (auto g = 0; g < nQuadPts; ++g)
+                if (mg(g) != k)
+                    wk(g) = 0.;
+            return wk;
+        };
+        VectorX const w0 = materialWeights(0);
+        VectorX const w1 = materialWeights(1);
+        VectorX const w2 = materialWeights(2);
+        fem::HyperElasticPotential<MeshType, SoftEnergyType> U0(M, eg, w0, GNeg, x, Y, nu);
+        fem::HyperElasticPotential<MeshType, StiffEnergyType> U1(M, eg, w1, GNeg, x, Y, nu);
+        fem::HyperElasticPotential<MeshType, RigidEnergyType> U2(M, eg, w2, GNeg, x, Y, nu);
+        Scalar const UExpected       = U0.Eval() + U1.Eval() + U2.Eval();
+        VectorX const GExpected      = U0.ToVector() + U1.ToVector() + U2.ToVector();
+        CSCMatrix const HExpected    = U0.ToMatrix() + U1.ToMatrix() + U2.ToMatrix();
+        MatrixX const HExpectedDense = HExpected;
+
+        auto const checkPotential = [&]() {
+            U.ComputeElementElasticity(x);
+            Scalar const scale = std::max(std::abs(UExpected), Scalar(1));
+            CHECK_LE(std::abs(U.Eval() - UExpected), zero * scale);
+            CHECK_LE((U.ToVector() - GExpected).norm(), zero * std::max(GExpected.norm(), 1.));
+            Scalar const Hscale = std::max(HExpectedDense.norm(), Scalar(1));
+            MatrixX const H     = U.ToMatrix();
+            CHECK_LE((H - HExpectedDense).norm(), zero * Hscale);
+            // Shared sparsity pattern assembly
+            U.PrecomputeHessianSparsity();
+            CSCMatrix HinPlace = U.ToMatrix();
+            CHECK_LE((MatrixX(HinPlace) - HExpectedDense).norm(), zero * Hscale);
+            HinPlace.coeffs().setZero();
+            U.ToMatrix(HinPlace);
+            CHECK_LE((MatrixX(HinPlace) - HExpectedDense).norm(), zero * Hscale);
+            // Hessian-vector products
+            MatrixX const X = MatrixX::Random(U.InputDimensions(), 2);
+            MatrixX Y       = MatrixX::Zero(U.OutputDimensions(), 2);
+            U.Apply(X, Y);
+            CHECK_LE((Y - HExpectedDense * X).norm(), zero * Hscale * X.norm());
+        };
+        SUBCASE("Dense hessian storage") { checkPotential(); }
+        SUBCASE("Packed hessian storage")
+        {
+            U.SetHessianStorage(fem::EHessianStorage::Packed);
+            checkPotential();
+        }
+        SUBCASE("Matrix-free hessian storage")
+        {
+            U.SetHessianStorage(fem::EHessianStorage::MatrixFree);
+            checkPotential();
+        }
+        SUBCASE("Missing material")
+        {
+            IndexVectorX const mgSoft = IndexVectorX::Zero(nQuadPts);
+            ElasticPotentialType USoft(M, eg, wg, GNeg, mgSoft, Y, nu);
+            USoft.ComputeElementElasticity(x);
+            USoft.PrecomputeHessianSparsity();
+            fem::HyperElasticPotential<MeshType, SoftEnergyType> UExpectedSoft(
+                M,
+                eg,
+                wg,
+                GNeg,
+                x,
+                Y,
+                nu);
+            CHECK_EQ(USoft.template Segment<1>().wg.size(), 0);
+            CHECK_EQ(USoft.template Segment<2>().wg.size(), 0);
+            CHECK_LE(
+                std::abs(USoft.Eval() - UExpectedSoft.Eval()),
+                zero * std::max(std::abs(UExpectedSoft.Eval()), Scalar(1)));
+            MatrixX const HSoftExpected = UExpectedSoft.ToMatrix();
+            CHECK_LE(
+                (MatrixX(USoft.ToMatrix()) - HSoftExpected).norm(),
+                zero * std::max(HSoftExpected.norm(), Scalar(1)));
+        }
+        SUBCASE("Invalid material index")
+        {
+            IndexVectorX mgInvalid = mg;
+            mgInvalid(0)           = 3;
+            CHECK_THROWS_AS(
+                ElasticPotentialType(M, eg, wg, GNeg, mgInvalid, Y, nu),
+                std::invalid_argument);
+        }
+    });
+}
@@ -0,0 +1,489 @@
+/**
+ * @file MultiMaterialHyperElasticPotential.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Hyper elastic potential energy of heterogeneous materials
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PBAT_FEM_MULTI_MATERIAL_HYPER_ELASTIC_POTENTIAL_H
+#define PBAT_FEM_MULTI_MATERIAL_HYPER_ELASTIC_POTENTIAL_H
+
+#include "Concepts.h"
+#include "GridMesh.h"
+#include "HyperElasticPotential.h"
+#include "pbat/Aliases.h"
+#include "pbat/common/ConstexprFor.h"
+#include "pbat/math/linalg/SparsityPattern.h"
+#include "pbat/physics/HyperElasticity.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <fmt/core.h>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace pbat {
+namespace fem {
+
+/**
+ * @brief Total hyper elastic potential \f$ U(\mathbf{x}) = \sum_k \int_{\Omega_k}
+ * \Psi_k(\mathbf{F}) d\Omega \f$ of a mesh made of different hyper elastic energy densities
+ * \f$ \Psi_k \f$
+ *
+ * Quadrature points are grouped into contiguous segments of the same energy density at
+ * construction, such that each segment is a statically typed HyperElasticPotential, i.e.
+ * evaluation has no per quadrature point dispatch. All segments assemble into a single hessian
+ * sparsity pattern.
+ *
+ * Segments reference quadrature data owned by this potential, which can thus be neither copied
+ * nor moved.
+ *
+ * @tparam TMesh Type satisfying concept CMesh
+ * @tparam THyperElasticEnergies Types satisfying concept CHyperElasticEnergy
+ */
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+struct MultiMaterialHyperElasticPotential
+{
+  public:
+    using SelfType =
+        MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>; ///< Self type
+    using MeshType    = TMesh;                        ///< Mesh type
+    using ElementType = typename TMesh::ElementType; ///< FEM element type
+    /**
+     * @brief Hyper elastic potential of the K-th energy density's quadrature points
+     * @tparam K Energy density index
+     */
+    template <std::size_t K>
+    using SegmentType = HyperElasticPotential<
+        TMesh,
+        std::tuple_element_t<K, std::tuple<THyperElasticEnergies...>>>;
+
+    static auto constexpr kMaterials =
+        sizeof...(THyperElasticEnergies); ///< Number of energy densities
+    static_assert(kMaterials > 0, "At least one hyper elastic energy density is required.");
+    static auto constexpr kDims = MeshType::kDims; ///< Number of spatial dimensions
+    static auto constexpr kDofsPerElement =
+        ElementType::kNodes * kDims; ///< Number of degrees of freedom per element
+
+    /**
+     * @brief Construct a new Multi Material Hyper Elastic Potential object
+     *
+     * @param mesh FEM mesh
+     * @param eg \f$ |Q| \f$ array of element indices at quadrature points, or empty for affine
+     * meshes with a single quadrature point per element
+     * @param wg \f$ |Q| \f$ array of quadrature weights
+     * @param GNeg Shape function gradients at quadrature points. See ShapeFunctionGradients().
+     * @param mg \f$ |Q| \f$ array of energy density indices into THyperElasticEnergies
+     * @param Y \f$ |Q| \f$ Young's moduli
+     * @param nu \f$ |Q| \f$ Poisson's ratios
+     * @pre `0 <= mg(g) < kMaterials`
+     */
+    MultiMaterialHyperElasticPotential(
+        MeshType const& mesh,
+        Eigen::Ref<IndexVectorX const> const& eg,
+        Eigen::Ref<VectorX const> const& wg,
+        Eigen::Ref<MatrixX const> const& GNeg,
+        Eigen::Ref<IndexVectorX const> const& mg,
+        Eigen::Ref<VectorX const> const& Y,
+        Eigen::Ref<VectorX const> const& nu);
+
+    MultiMaterialHyperElasticPotential(SelfType const&) = delete;
+    MultiMaterialHyperElasticPotential(SelfType&&)      = delete;
+    SelfType& operator=(SelfType const&)                = delete;
+    SelfType& operator=(SelfType&&)                     = delete;
+
+    /**
+     * @brief Selects the hessian's storage layout of all segments
+     *
+     * Resets the precomputed hessian sparsity. See HyperElasticPotential::SetHessianStorage().
+     *
+     * @param eStorage Hessian storage layout
+     */
+    void SetHessianStorage(EHessianStorage eStorage);
+    /**
+     * @brief Precomputes the sparsity pattern of the hessian matrix shared by all segments
+     *
+     * Enables parallel sparse hessian assembly in all future operations.
+     */
+    void PrecomputeHessianSparsity();
+    /**
+     * @brief Computes the element elasticity and its derivatives of all segments at the given
+     * shape
+     *
+     * @tparam TDerived Eigen matrix expression type
+     * @param x \f$ d \times n \f$ matrix of deformed nodal positions
+     * @param bWithGradient Compute gradient
+     * @param bWithHessian Compute hessian
+     * @param bUseSpdProjection Project the energy densities' hessians to SPD
+     * @pre `x.rows() == mesh.X.rows() * mesh.kDims`
+     */
+    template <class TDerived>
+    void ComputeElementElasticity(
+        Eigen::MatrixBase<TDerived> const& x,
+        bool bWithGradient     = true,
+        bool bWithHessian      = true,
+        bool bUseSpdProjection = true);
+    /**
+     * @brief Applies the hessian matrix of this potential as a linear operator on x, adding result
+     * to y.
+     *
+     * @tparam TDerivedIn Input matrix type
+     * @tparam TDerivedOut Output matrix type
+     * @param x Input matrix
+     * @param y Output matrix
+     * @pre x.rows() == InputDimensions() and y.rows() == InputDimensions() and y.cols() == x.cols()
+     */
+    template <class TDerivedIn, class TDerivedOut>
+    void Apply(Eigen::MatrixBase<TDerivedIn> const& x, Eigen::DenseBase<TDerivedOut>& y) const;
+    /**
+     * @brief Assembles the hessian matrix of all segments in sparse compressed column format
+     * @return Sparse compressed column hessian matrix
+     */
+    CSCMatrix ToMatrix() const;
+    /**
+     * @brief Assembles the hessian matrix of all segments into H in-place, in parallel and without
+     * allocations
+     *
+     * @param H Sparse compressed column matrix with the precomputed hessian sparsity pattern, e.g.
+     * as returned by a previous call to ToMatrix()
+     * @pre PrecomputeHessianSparsity() has been called
+     */
+    void ToMatrix(CSCMatrix& H) const;
+    /**
+     * @brief Assembles the global gradient of all segments
+     * @return Global gradient
+     */
+    VectorX ToVector() const;
+    /**
+     * @brief Computes the total elastic potential
+     * @return Total elastic potential
+     */
+    Scalar Eval() const;
+    /**
+     * @brief Number of columns
+     * @return Number of columns
+     */
+    Index InputDimensions() const { return mesh.X.cols() * kDims; }
+    /**
+     * @brief Number of rows
+     * @return Number of rows
+     */
+    Index OutputDimensions() const { return InputDimensions(); }
+    /**
+     * @brief Hyper elastic potential of the K-th energy density's quadrature points
+     * @tparam K Energy density index
+     * @return K-th segment
+     */
+    template <std::size_t K>
+    SegmentType<K>& Segment()
+    {
+        return *std::get<K>(mSegments);
+    }
+    /**
+     * @brief Hyper elastic potential of the K-th energy density's quadrature points
+     * @tparam K Energy density index
+     * @return K-th segment
+     */
+    template <std::size_t K>
+    SegmentType<K> const& Segment() const
+    {
+        return *std::get<K>(mSegments);
+    }
+    /**
+     * @brief Calls f on every segment, in energy density order
+     *
+     * @tparam Func Callable with signature `void(auto& segment)`
+     * @param f Function to call
+     */
+    template <class Func>
+    void ForEachSegment(Func&& f);
+    /**
+     * @brief Calls f on every segment, in energy density order
+     *
+     * @tparam Func Callable with signature `void(auto const& segment)`
+     * @param f Function to call
+     */
+    template <class Func>
+    void ForEachSegment(Func&& f) const;
+
+    MeshType const& mesh; ///< The finite element mesh
+    IndexVectorX Sptr;    ///< Energy density k's quadrature points are Gperm[Sptr[k]:Sptr[k+1]]
+    IndexVectorX Gperm;   ///< Quadrature points sorted by energy density, such that segment
+                          ///< k's quadrature point g is quadrature point Gperm[Sptr[k]+g]
+    math::linalg::SparsityPattern GH; ///< Directed adjacency graph of the hessian of all segments
+
+  private:
+    /**
+     * @brief Calls f with the range of all segments' (duplicate) hessian non-zeros, ordered as the
+     * non-zeros of PrecomputeHessianSparsity()
+     *
+     * @tparam K Index of the next segment to visit
+     * @tparam Func Callable with signature `void(auto&& nonZeros)`
+     * @tparam TNonZeroRanges Non-zero ranges of segments 0,...,K-1
+     * @param f Function to call
+     * @param nonZeros Non-zero ranges of segments 0,...,K-1
+     */
+    template <std::size_t K, class Func, class... TNonZeroRanges>
+    void VisitHessianNonZeros(Func&& f, TNonZeroRanges const&... nonZeros) const;
+
+    std::array<IndexVectorX, kMaterials> egs; ///< Element indices of segments' quadrature points
+    std::array<VectorX, kMaterials> wgs;      ///< Quadrature weights of segments
+    std::array<MatrixX, kMaterials> GNegs; ///< Shape function gradients of segments' quadrature
+                                           ///< points
+    std::tuple<std::optional<HyperElasticPotential<TMesh, THyperElasticEnergies>>...>
+        mSegments; ///< Statically typed per energy density potentials
+};
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+inline MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::
+    MultiMaterialHyperElasticPotential(
+        MeshType const& meshIn,
+        Eigen::Ref<IndexVectorX const> const& eg,
+        Eigen::Ref<VectorX const> const& wg,
+        Eigen::Ref<MatrixX const> const& GNeg,
+        Eigen::Ref<IndexVectorX const> const& mg,
+        Eigen::Ref<VectorX const> const& Y,
+        Eigen::Ref<VectorX const> const& nu)
+    : mesh(meshIn), Sptr(), Gperm(), GH(), egs(), wgs(), GNegs(), mSegments()
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.MultiMaterialHyperElasticPotential.Construct");
+    auto const numberOfQuadraturePoints = wg.size();
+    bool const bHasQuadratureData = (mg.size() == numberOfQuadraturePoints) and
+                                    (Y.size() == numberOfQuadraturePoints) and
+                                    (nu.size() == numberOfQuadraturePoints) and
+                                    (eg.size() == numberOfQuadraturePoints or eg.size() == 0);
+    if (not bHasQuadratureData)
+    {
+        std::string const what = fmt::format(
+            "Expected |#quad.pts.|={} energy indices, Young's moduli, Poisson's ratios and "
+            "element indices (or none), but got mg.size()={}, Y.size()={}, nu.size()={}, "
+            "eg.size()={}",
+            numberOfQuadraturePoints,
+            mg.size(),
+            Y.size(),
+            nu.size(),
+            eg.size());
+        throw std::invalid_argument(what);
+    }
+    if (numberOfQuadraturePoints > 0 and
+        (mg.minCoeff() < 0 or mg.maxCoeff() >= static_cast<Index>(kMaterials)))
+    {
+        std::string const what = fmt::format(
+            "Expected energy indices in [0,{}), but got indices in [{},{}]",
+            kMaterials,
+            mg.minCoeff(),
+            mg.maxCoeff());
+        throw std::invalid_argument(what);
+    }
+    // Stable counting sort of quadrature points by energy density
+    Sptr.setZero(kMaterials + 1);
+    for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+        ++Sptr(mg(g) + 1);
+    for (auto k = 0; k < static_cast<Index>(kMaterials); ++k)
+        Sptr(k + 1) += Sptr(k);
+    Gperm.resize(numberOfQuadraturePoints);
+    IndexVectorX Sfree = Sptr.head<kMaterials>();
+    for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+        Gperm(Sfree(mg(g))++) = g;
+    // Gather segments' quadrature data. Shape function gradients shared by grid cells are expanded
+    // per quadrature point, since segments no longer hold whole cells.
+    auto const cellQuadraturePoints =
+        NumberOfSharedCellQuadraturePoints(mesh, eg, numberOfQuadraturePoints, GNeg);
+    common::ForRange<0, static_cast<int>(kMaterials)>([&]<auto K>() {
+        auto const gBegin          = Sptr(K);
+        auto const segmentSize     = Sptr(K + 1) - gBegin;
+        auto const Gk              = Gperm.segment(gBegin, segmentSize);
+        egs[K]                     = eg.size() == 0 ? IndexVectorX(Gk) : IndexVectorX(eg(Gk));
+        wgs[K]                     = wg(Gk);
+        GNegs[K].resize(ElementType::kNodes, kDims * segmentSize);
+        for (auto gk = 0; gk < segmentSize; ++gk)
+        {
+            auto const g = cellQuadraturePoints > 0 ? Gk(gk) % cellQuadraturePoints : Gk(gk);
+            GNegs[K].template block<ElementType::kNodes, kDims>(0, gk * kDims) =
+                GNeg.template block<ElementType::kNodes, kDims>(0, g * kDims);
+        }
+        VectorX const Yk  = Y(Gk);
+        VectorX const nuk = nu(Gk);
+        std::get<K>(mSegments).emplace(mesh, egs[K], wgs[K], GNegs[K], Yk, nuk);
+    });
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+template <class Func>
+inline void
+MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::ForEachSegment(Func&& f)
+{
+    std::apply([&](auto&... segments) { (f(*segments), ...); }, mSegments);
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+template <class Func>
+inline void
+MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::ForEachSegment(Func&& f) const
+{
+    std::apply([&](auto const&... segments) { (f(*segments), ...); }, mSegments);
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+inline void MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::SetHessianStorage(
+    EHessianStorage eStorage)
+{
+    GH = math::linalg::SparsityPattern{};
+    ForEachSegment([&](auto& segment) { segment.SetHessianStorage(eStorage); });
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+inline void
+MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::PrecomputeHessianSparsity()
+{
+    PBAT_PROFILE_NAMED_SCOPE(
+        "pbat.fem.MultiMaterialHyperElasticPotential.PrecomputeHessianSparsity");
+    auto constexpr kNodesPerElement = ElementType::kNodes;
+    Index numberOfHessianBlocks{0};
+    ForEachSegment([&](auto const& segment) {
+        numberOfHessianBlocks += segment.NumberOfHessianBlocks();
+    });
+    std::vector<Index> nonZeroRowIndices{};
+    std::vector<Index> nonZeroColIndices{};
+    nonZeroRowIndices.reserve(
+        static_cast<std::size_t>(kDofsPerElement * kDofsPerElement * numberOfHessianBlocks));
+    nonZeroColIndices.reserve(
+        static_cast<std::size_t>(kDofsPerElement * kDofsPerElement * numberOfHessianBlocks));
+    // Segments' non-zeros are laid out one after the other, each in the order of its own
+    // HyperElasticPotential::PrecomputeHessianSparsity()
+    ForEachSegment([&](auto const& segment) {
+        for (auto b = 0; b < segment.NumberOfHessianBlocks(); ++b)
+        {
+            auto const nodes = mesh.E.col(segment.HessianBlockElement(b));
+            for (auto j = 0; j < kNodesPerElement; ++j)
+                for (auto dj = 0; dj < kDims; ++dj)
+                    for (auto i = 0; i < kNodesPerElement; ++i)
+                        for (auto di = 0; di < kDims; ++di)
+                        {
+                            nonZeroRowIndices.push_back(kDims * nodes(i) + di);
+                            nonZeroColIndices.push_back(kDims * nodes(j) + dj);
+                        }
+        }
+    });
+    GH.Compute(OutputDimensions(), InputDimensions(), nonZeroRowIndices, nonZeroColIndices);
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+template <class TDerived>
+inline void
+MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::ComputeElementElasticity(
+    Eigen::MatrixBase<TDerived> const& x,
+    bool bWithGradient,
+    bool bWithHessian,
+    bool bUseSpdProjection)
+{
+    PBAT_PROFILE_NAMED_SCOPE(
+        "pbat.fem.MultiMaterialHyperElasticPotential.ComputeElementElasticity");
+    ForEachSegment([&](auto& segment) {
+        segment.ComputeElementElasticity(x, bWithGradient, bWithHessian, bUseSpdProjection);
+    });
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+template <class TDerivedIn, class TDerivedOut>
+inline void MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::Apply(
+    Eigen::MatrixBase<TDerivedIn> const& x,
+    Eigen::DenseBase<TDerivedOut>& y) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.MultiMaterialHyperElasticPotential.Apply");
+    ForEachSegment([&](auto const& segment) { segment.Apply(x, y); });
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+inline CSCMatrix
+MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::ToMatrix() const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.MultiMaterialHyperElasticPotential.ToMatrix");
+    CSCMatrix H(OutputDimensions(), InputDimensions());
+    if (not GH.IsEmpty())
+    {
+        VisitHessianNonZeros<0>([&](auto&& nonZeros) { H = GH.ToMatrix(nonZeros); });
+        return H;
+    }
+    ForEachSegment([&](auto const& segment) { H += segment.ToMatrix(); });
+    return H;
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+inline void
+MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::ToMatrix(CSCMatrix& H) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.MultiMaterialHyperElasticPotential.ToMatrixInPlace");
+    if (GH.IsEmpty())
+    {
+        throw std::invalid_argument(
+            "In-place hessian assembly requires the hessian's sparsity pattern, see "
+            "PrecomputeHessianSparsity()");
+    }
+    VisitHessianNonZeros<0>([&](auto&& nonZeros) { GH.ToMatrix(nonZeros, H); });
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+inline VectorX MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::ToVector() const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.MultiMaterialHyperElasticPotential.ToVector");
+    VectorX G = VectorX::Zero(InputDimensions());
+    ForEachSegment([&](auto const& segment) { G += segment.ToVector(); });
+    return G;
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+inline Scalar MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::Eval() const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.MultiMaterialHyperElasticPotential.Eval");
+    Scalar U{0};
+    ForEachSegment([&](auto const& segment) { U += segment.Eval(); });
+    return U;
+}
+
+template <CMesh TMesh, physics::CHyperElasticEnergy... THyperElasticEnergies>
+template <std::size_t K, class Func, class... TNonZeroRanges>
+inline void
+MultiMaterialHyperElasticPotential<TMesh, THyperElasticEnergies...>::VisitHessianNonZeros(
+    Func&& f,
+    TNonZeroRanges const&... nonZeros) const
+{
+    if constexpr (K < kMaterials)
+    {
+        Segment<K>().VisitHessianNonZeros([&](auto&& segmentNonZeros) {
+            VisitHessianNonZeros<K + 1>(f, nonZeros..., segmentNonZeros);
+        });
+    }
+    else
+    {
+        // Concatenate the segments' non-zero ranges
+        std::array<Index, kMaterials + 1> kptr{};
+        std::size_t s{0};
+        ((kptr[s + 1] = kptr[s] + static_cast<Index>(std::ranges::size(nonZeros)), ++s), ...);
+        f(std::views::iota(Index{0}, kptr.back()) | std::views::transform([&](Index k) {
+              Scalar value{0};
+              std::size_t sk{0};
+              ((k < kptr[sk + 1] ?
+                    (value = static_cast<Scalar>(
+                         nonZeros[static_cast<std::size_t>(k - kptr[sk])]),
+                     true) :
+                    (++sk, false)) or
+               ...);
+              return value;
+          }));
+    }
+}
+
+} // namespace fem
+} // namespace pbat
+
+#endif // PBAT_FEM_MULTI_MATERIAL_HYPER_ELASTIC_POTENTIAL_H
@@ -361,16 +361,58 @@ MatrixX ShapeFunctionGradients(TMesh const& mesh)
         auto constexpr kRowsJ           = MeshType::kDims;
         auto constexpr kColsJ           = AffineElementType::kNodes;
         Matrix<kRowsJ, kColsJ> const Ve = mesh.X(Eigen::placeholders::all, vertices);
-        for (auto g = 0; g < QuadratureRuleType::kPoints; ++g)
+        auto constexpr kStride          = MeshType::kDims * QuadratureRuleType::kPoints;
+        if constexpr (CAffineElement<ElementType>)
+        {
+            // Gradients are constant over affine elements, so solve for them only once
+            auto const GP = ShapeFunctionGradients<ElementType>(Xg.col(0), Ve);
+            GNe.block<kNodesPerElement, kStride>(0, e * kStride) =
+                GP.replicate(1, QuadratureRuleType::kPoints);
+        }
+        else
         {
-            auto const GP          = ShapeFunctionGradients<ElementType>(Xg.col(g), Ve);
-            auto constexpr kStride = MeshType::kDims * QuadratureRuleType::kPoints;
-            GNe.block<kNodesPerElement, MeshType::kDims>(0, e * kStride + g * MeshType::kDims) = GP;
+            for (auto g = 0; g < QuadratureRuleType::kPoints; ++g)
+            {
+                auto const GP = ShapeFunctionGradients<ElementType>(Xg.col(g), Ve);
+                GNe.block<kNodesPerElement, MeshType::kDims>(0, e * kStride + g * MeshType::kDims) =
+                    GP;
+            }
         }
     });
     return GNe;
 }
 
+/**
+ * @brief Computes nodal shape function gradients of affine elements, which are constant over each
+ * element
+ *
+ * Equivalent to, but |# quad.pts.| times smaller than, ShapeFunctionGradients() for any
+ * quadrature order. Use with ElementInnerProductWeights() and one quadrature point per element
+ * (i.e. quadrature point g is element g).
+ *
+ * @tparam TMesh Mesh type
+ * @param mesh FEM mesh
+ * @return `|# element nodes| x |# dims * # elements|` matrix of shape function gradients
+ */
+template <CMesh TMesh>
+requires CAffineElement<typename TMesh::ElementType>
+MatrixX ElementShapeFunctionGradients(TMesh const& mesh)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.fem.ElementShapeFunctionGradients");
+    using MeshType                  = TMesh;
+    using ElementType               = typename MeshType::ElementType;
+    auto constexpr kNodesPerElement = ElementType::kNodes;
+    auto const numberOfElements     = mesh.E.cols();
+    MatrixX GNe(kNodesPerElement, numberOfElements * MeshType::kDims);
+    tbb::parallel_for(Index{0}, Index{numberOfElements}, [&](Index e) {
+        Matrix<MeshType::kDims, kNodesPerElement> const Ve =
+            mesh.X(Eigen::placeholders::all, mesh.E.col(e));
+        GNe.block<kNodesPerElement, MeshType::kDims>(0, e * MeshType::kDims) =
+            ShapeFunctionGradients<ElementType>(Vector<ElementType::kDims>::Zero(), Ve);
+    });
+    return GNe;
+}
+
 /**
  * @brief Computes nodal shape function gradients at evaluation points Xg.
  * @tparam TDerivedE Eigen dense expression type for element indices
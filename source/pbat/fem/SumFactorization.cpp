@@ -0,0 +1,108 @@
+#include "SumFactorization.h"
+
+#include "Mesh.h"
+#include "ShapeFunctions.h"
+#include "Tetrahedron.h"
+
+#include <doctest/doctest.h>
+#include <pbat/common/ConstexprFor.h>
+
+TEST_CASE("[fem] SumFactorization")
+{
+    using namespace pbat;
+    Scalar constexpr zero = 1e-10;
+    auto const checkElement = [&]<class Element>() {
+        CHECK(fem::CTensorProductElement<Element>);
+        common::ForRange<1, fem::kMaxSumFactorizedQuadratureOrder<Element> + 1>(
+            [&]<auto QuadratureOrder>() {
+                using Basis              = fem::TensorProductBasis<Element, QuadratureOrder>;
+                using QuadratureRuleType = typename Basis::QuadratureRuleType;
+                auto const Xg            = common::ToEigen(QuadratureRuleType::points)
+                                    .reshaped(QuadratureRuleType::kDims + 1, Basis::kPoints)
+                                    .template bottomRows<Element::kDims>();
+                Matrix<3, Element::kNodes> const ue = Matrix<3, Element::kNodes>::Random();
+                Matrix<3, Basis::kPoints> const vg  = Matrix<3, Basis::kPoints>::Random();
+                Matrix<3, Element::kDims * Basis::kPoints> const Gg =
+                    Matrix<3, Element::kDims * Basis::kPoints>::Random();
+                // Tabulated shape functions are the reference
+                Matrix<3, Basis::kPoints> ugExpected{};
+                Matrix<3, Element::kDims * Basis::kPoints> GugExpected{};
+                Matrix<3, Element::kNodes> yvExpected = Matrix<3, Element::kNodes>::Zero();
+                Matrix<3, Element::kNodes> yGExpected = Matrix<3, Element::kNodes>::Zero();
+                for (auto g = 0; g < Basis::kPoints; ++g)
+                {
+                    Vector<Element::kNodes> const Ng                 = Element::N(Xg.col(g));
+                    Matrix<Element::kNodes, Element::kDims> const GP = Element::GradN(Xg.col(g));
+                    ugExpected.col(g)                                = ue * Ng;
+                    GugExpected.template block<3, Element::kDims>(0, g * Element::kDims) = ue * GP;
+                    yvExpected += vg.col(g) * Ng.transpose();
+                    yGExpected +=
+                        Gg.template block<3, Element::kDims>(0, g * Element::kDims) * GP.transpose();
+                }
+                Scalar const interpolationError =
+                    (Basis::Interpolate(ue) - ugExpected).norm() / ugExpected.norm();
+                Scalar const gradientError =
+                    (Basis::ReferenceGradients(ue) - GugExpected).norm() / GugExpected.norm();
+                Scalar const integrationError =
+                    (Basis::IntegrateValues(vg) - yvExpected).norm() / yvExpected.norm();
+                Scalar const gradientIntegrationError =
+                    (Basis::IntegrateReferenceGradients(Gg) - yGExpected).norm() /
+                    yGExpected.norm();
+                CHECK_LE(interpolationError, zero);
+                CHECK_LE(gradientError, zero);
+                CHECK_LE(integrationError, zero);
+                CHECK_LE(gradientIntegrationError, zero);
+            });
+    };
+    common::ForRange<1, 4>([&]<auto kOrder>() {
+        checkElement.template operator()<fem::Line<kOrder>>();
+        checkElement.template operator()<fem::Quadrilateral<kOrder>>();
+        checkElement.template operator()<fem::Hexahedron<kOrder>>();
+    });
+    CHECK_FALSE(fem::CTensorProductElement<fem::Tetrahedron<1>>);
+
+    SUBCASE("Inverse jacobians are recovered from shape function gradients")
+    {
+        // 2-Cube mesh, with a sheared second cube
+        MatrixX V(3, 12);
+        IndexMatrixX C(8, 2);
+        // clang-format off
+        V << 0., 1., 0., 1., 0., 1., 0., 1., 2.5, 2., 2., 2.,
+             0., 0., 1., 1., 0., 0., 1., 1., 0.,  1., 0., 1.,
+             0., 0., 0., 0., 1., 1., 1., 1., 0.,  0., 1., 1.;
+        C << 0, 1,
+             1, 8,
+             2, 3,
+             3, 9,
+             4, 5,
+             5, 10,
+             6, 7,
+             7, 11;
+        // clang-format on
+        common::ForRange<1, 3>([&]<auto kOrder>() {
+            using Element = fem::Hexahedron<kOrder>;
+            using Mesh    = fem::Mesh<Element, 3>;
+            Mesh const mesh(V, C);
+            auto constexpr kQuadratureOrder = kOrder + 1;
+            MatrixX const GNeg              = fem::ShapeFunctionGradients<kQuadratureOrder>(mesh);
+            MatrixX Jinvg{};
+            int const order = fem::InverseJacobiansAtQuadraturePoints<Element, Mesh::kDims>(
+                IndexVectorX{},
+                mesh.E.cols(),
+                GNeg,
+                Jinvg);
+            CHECK_EQ(order, kQuadratureOrder);
+            CHECK_EQ(Jinvg.cols(), GNeg.cols());
+            // Shape function gradients at other points are not sum factorizable
+            MatrixX GNegPerturbed = GNeg;
+            GNegPerturbed(0, 0) += 1.;
+            int const perturbedOrder = fem::InverseJacobiansAtQuadraturePoints<Element, Mesh::kDims>(
+                IndexVectorX{},
+                mesh.E.cols(),
+                GNegPerturbed,
+                Jinvg);
+            CHECK_EQ(perturbedOrder, 0);
+            CHECK_EQ(Jinvg.cols(), 0);
+        });
+    }
+}
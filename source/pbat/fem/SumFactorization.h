@@ -0,0 +1,495 @@
+/**
+ * @file SumFactorization.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Sum factorization kernels for tensor product (i.e. Line, Quadrilateral and Hexahedron)
+ * finite elements
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PBAT_FEM_SUMFACTORIZATION_H
+#define PBAT_FEM_SUMFACTORIZATION_H
+
+#include "Concepts.h"
+#include "Hexahedron.h"
+#include "Line.h"
+#include "Quadrilateral.h"
+
+#include <array>
+#include <pbat/Aliases.h>
+#include <pbat/common/ConstexprFor.h>
+#include <pbat/common/Eigen.h>
+#include <pbat/math/GaussQuadrature.h>
+#include <type_traits>
+
+namespace pbat {
+namespace fem {
+
+namespace detail {
+
+template <class T>
+struct IsTensorProductElement : std::false_type
+{
+};
+
+template <int Order>
+struct IsTensorProductElement<Line<Order>> : std::true_type
+{
+};
+
+template <int Order>
+struct IsTensorProductElement<Quadrilateral<Order>> : std::true_type
+{
+};
+
+template <int Order>
+struct IsTensorProductElement<Hexahedron<Order>> : std::true_type
+{
+};
+
+constexpr int Pow(int base, int exponent)
+{
+    int result = 1;
+    for (int i = 0; i < exponent; ++i)
+        result *= base;
+    return result;
+}
+
+/**
+ * @brief Tabulates 1D Lagrange shape functions (or their derivatives) on equispaced nodes \f$
+ * \frac{a}{p} \f$ at 1D Gauss-Legendre quadrature points
+ *
+ * @tparam Order Polynomial order \f$ p \f$
+ * @tparam QuadratureOrder Gauss-Legendre quadrature order
+ * @tparam bDerivative Tabulate shape function derivatives if true
+ * @return Column-major `|# 1D quad.pts.| x |Order+1|` matrix
+ */
+template <int Order, int QuadratureOrder, bool bDerivative>
+constexpr auto TabulateLineShapeFunctions()
+{
+    using QuadratureRuleType = math::GaussLegendreQuadrature<1, QuadratureOrder>;
+    auto constexpr kPoints   = QuadratureRuleType::kPoints;
+    auto constexpr kNodes    = Order + 1;
+    std::array<Scalar, kPoints * kNodes> B{};
+    auto const xi = [](int a) {
+        return static_cast<Scalar>(a) / static_cast<Scalar>(Order);
+    };
+    for (int g = 0; g < kPoints; ++g)
+    {
+        Scalar const X = QuadratureRuleType::points[2 * g + 1];
+        for (int a = 0; a < kNodes; ++a)
+        {
+            Scalar value{0};
+            if constexpr (not bDerivative)
+            {
+                value = Scalar(1);
+                for (int b = 0; b < kNodes; ++b)
+                    if (b != a)
+                        value *= (X - xi(b)) / (xi(a) - xi(b));
+            }
+            else
+            {
+                for (int c = 0; c < kNodes; ++c)
+                {
+                    if (c == a)
+                        continue;
+                    Scalar term = Scalar(1) / (xi(a) - xi(c));
+                    for (int b = 0; b < kNodes; ++b)
+                        if (b != a and b != c)
+                            term *= (X - xi(b)) / (xi(a) - xi(b));
+                    value += term;
+                }
+            }
+            B[static_cast<std::size_t>(a * kPoints + g)] = value;
+        }
+    }
+    return B;
+}
+
+/**
+ * @brief Maps each tabulated quadrature point of a tensor product Gauss-Legendre rule to its
+ * lexicographic tensor index \f$ i_0 + q i_1 + q^2 i_2 \f$ in the 1D rule's points
+ *
+ * @tparam Dims Reference dimensions
+ * @tparam QuadratureOrder Gauss-Legendre quadrature order
+ * @return `|# quad.pts.|` tensor indices
+ */
+template <int Dims, int QuadratureOrder>
+constexpr auto TabulateTensorQuadratureIndices()
+{
+    using QuadratureRuleType     = math::GaussLegendreQuadrature<Dims, QuadratureOrder>;
+    using LineQuadratureRuleType = math::GaussLegendreQuadrature<1, QuadratureOrder>;
+    auto constexpr kLinePoints   = LineQuadratureRuleType::kPoints;
+    std::array<int, QuadratureRuleType::kPoints> T{};
+    for (int g = 0; g < QuadratureRuleType::kPoints; ++g)
+    {
+        int t      = 0;
+        int stride = 1;
+        for (int d = 0; d < Dims; ++d)
+        {
+            Scalar const X = QuadratureRuleType::points[(Dims + 1) * g + 1 + d];
+            int closest    = 0;
+            Scalar dmin    = Scalar(2);
+            for (int i = 0; i < kLinePoints; ++i)
+            {
+                Scalar const dX = X - LineQuadratureRuleType::points[2 * i + 1];
+                Scalar const aX = dX < Scalar(0) ? -dX : dX;
+                if (aX < dmin)
+                {
+                    dmin    = aX;
+                    closest = i;
+                }
+            }
+            t += closest * stride;
+            stride *= kLinePoints;
+        }
+        T[static_cast<std::size_t>(g)] = t;
+    }
+    return T;
+}
+
+} // namespace detail
+
+/**
+ * @brief Tensor product finite element, i.e. whose shape functions are products of 1D Lagrange
+ * polynomials on equispaced nodes, ordered lexicographically, and whose quadrature rules are
+ * products of 1D Gauss-Legendre rules.
+ *
+ * Satisfied by Line, Quadrilateral and Hexahedron.
+ *
+ * @tparam T Element type
+ */
+template <class T>
+concept CTensorProductElement = CElement<T> and detail::IsTensorProductElement<T>::value;
+
+/**
+ * @brief Sum factorization of a tensor product element's shape functions at its tensor product
+ * quadrature points.
+ *
+ * Evaluating a \f$ p^\text{th} \f$ order element's \f$ (p+1)^d \f$ shape functions at its \f$
+ * q^d \f$ quadrature points costs \f$ O(p^d q^d) \f$, i.e. \f$ O(p^6) \f$ in 3D. Shape functions
+ * are products \f$ N_{abc}(\xi) = \phi_a(\xi_0) \phi_b(\xi_1) \phi_c(\xi_2) \f$ of 1D
+ * polynomials, such that the same evaluation factorizes into \f$ d \f$ successive contractions
+ * with the \f$ q \times (p+1) \f$ matrix of 1D shape functions (or their derivatives), which costs
+ * \f$ O(p^{d+1}) \f$, i.e. \f$ O(p^4) \f$ in 3D.
+ *
+ * Quadrature points are indexed in the order of the element's quadrature rule
+ * `TElement::QuadratureType<QuadratureOrder>`, such that kernels are interchangeable with
+ * tabulated TElement::N and TElement::GradN.
+ *
+ * @tparam TElement Tensor product element type
+ * @tparam QuadratureOrder Gauss-Legendre quadrature order
+ */
+template <CTensorProductElement TElement, int QuadratureOrder>
+struct TensorProductBasis
+{
+    using ElementType        = TElement; ///< Element type
+    using QuadratureRuleType = typename TElement::template QuadratureType<QuadratureOrder>;
+    using LineQuadratureRuleType = math::GaussLegendreQuadrature<1, QuadratureOrder>;
+
+    static int constexpr kDims       = TElement::kDims;  ///< Reference dimensions
+    static int constexpr kNodes      = TElement::kNodes; ///< Number of element nodes
+    static int constexpr kPoints     = QuadratureRuleType::kPoints; ///< Number of quad.pts.
+    static int constexpr kLineNodes  = TElement::kOrder + 1;        ///< Number of 1D nodes
+    static int constexpr kLinePoints = LineQuadratureRuleType::kPoints; ///< Number of 1D quad.pts.
+
+    static_assert(detail::Pow(kLineNodes, kDims) == kNodes);
+    static_assert(detail::Pow(kLinePoints, kDims) == kPoints);
+
+    /**
+     * @brief Column-major `kLinePoints x kLineNodes` 1D shape functions at 1D quadrature points
+     */
+    static constexpr std::array<Scalar, kLinePoints * kLineNodes> B =
+        detail::TabulateLineShapeFunctions<TElement::kOrder, QuadratureOrder, false>();
+    /**
+     * @brief Column-major `kLinePoints x kLineNodes` 1D shape function derivatives at 1D
+     * quadrature points
+     */
+    static constexpr std::array<Scalar, kLinePoints * kLineNodes> D =
+        detail::TabulateLineShapeFunctions<TElement::kOrder, QuadratureOrder, true>();
+    /**
+     * @brief Lexicographic tensor index of each quadrature point of QuadratureRuleType
+     */
+    static constexpr std::array<int, kPoints> T =
+        detail::TabulateTensorQuadratureIndices<kDims, QuadratureOrder>();
+
+    /**
+     * @brief Interpolates nodal coefficients at quadrature points, i.e. \f$ \mathbf{u}_g =
+     * \sum_i \mathbf{u}_i N_i(\xi_g) \f$
+     *
+     * @tparam TDerivedU Eigen dense expression type
+     * @param ue `|# rows| x |# element nodes|` nodal coefficients
+     * @return `|# rows| x |# quad.pts.|` interpolated values
+     */
+    template <class TDerivedU>
+    static Matrix<TDerivedU::RowsAtCompileTime, kPoints>
+    Interpolate(Eigen::MatrixBase<TDerivedU> const& ue);
+    /**
+     * @brief Computes reference space gradients \f$ \nabla_\xi \mathbf{u}(\xi_g) = \sum_i
+     * \mathbf{u}_i \nabla_\xi N_i(\xi_g)^T \f$ at quadrature points
+     *
+     * @tparam TDerivedU Eigen dense expression type
+     * @param ue `|# rows| x |# element nodes|` nodal coefficients
+     * @return `|# rows| x |kDims * # quad.pts.|` gradients, with gradient g in block column g
+     */
+    template <class TDerivedU>
+    static Matrix<TDerivedU::RowsAtCompileTime, kDims * kPoints>
+    ReferenceGradients(Eigen::MatrixBase<TDerivedU> const& ue);
+    /**
+     * @brief Transpose of Interpolate(), i.e. computes \f$ \mathbf{y}_i = \sum_g \mathbf{v}_g
+     * N_i(\xi_g) \f$
+     *
+     * @tparam TDerivedV Eigen dense expression type
+     * @param vg `|# rows| x |# quad.pts.|` values at quadrature points
+     * @return `|# rows| x |# element nodes|` nodal contributions
+     */
+    template <class TDerivedV>
+    static Matrix<TDerivedV::RowsAtCompileTime, kNodes>
+    IntegrateValues(Eigen::MatrixBase<TDerivedV> const& vg);
+    /**
+     * @brief Transpose of ReferenceGradients(), i.e. computes \f$ \mathbf{y}_i = \sum_g
+     * \mathbf{G}_g \nabla_\xi N_i(\xi_g) \f$
+     *
+     * @tparam TDerivedG Eigen dense expression type
+     * @param Gg `|# rows| x |kDims * # quad.pts.|` matrices at quadrature points, with matrix g in
+     * block column g
+     * @return `|# rows| x |# element nodes|` nodal contributions
+     */
+    template <class TDerivedG>
+    static Matrix<TDerivedG::RowsAtCompileTime, kNodes>
+    IntegrateReferenceGradients(Eigen::MatrixBase<TDerivedG> const& Gg);
+
+  private:
+    /**
+     * @brief Contracts every axis k of the lexicographic \f$ n^d \f$ tensor u with the 1D matrix
+     * \f$ \mathbf{A}_k \f$, i.e. applies \f$ \mathbf{A}_{d-1} \otimes \dots \otimes \mathbf{A}_0
+     * \f$ in \f$ O(m n^d) \f$
+     *
+     * Each contraction of the leading axis rotates it to the trailing axis, such that after \f$ d
+     * \f$ contractions, axes are back in lexicographic order.
+     *
+     * @tparam M Number of rows of 1D matrices
+     * @tparam N Number of columns of 1D matrices
+     * @tparam bTranspose Contract with the transpose of stored 1D matrices if true
+     * @param u Lexicographic \f$ n^d \f$ tensor
+     * @param k Axis to contract with the derivative matrix D, or -1 to contract all axes with B
+     * @return Lexicographic \f$ m^d \f$ tensor
+     */
+    template <int M, int N, bool bTranspose>
+    static Vector<detail::Pow(M, kDims)> Contract(Vector<detail::Pow(N, kDims)> const& u, int k)
+    {
+        using LineMatrixType = Matrix<kLinePoints, kLineNodes>;
+        Eigen::Map<LineMatrixType const> const Bl(B.data());
+        Eigen::Map<LineMatrixType const> const Dl(D.data());
+        auto constexpr kWorkSize = detail::Pow(M > N ? M : N, kDims);
+        Vector<kWorkSize> w{};
+        w.template head<detail::Pow(N, kDims)>() = u;
+        common::ForRange<0, kDims>([&]<auto s>() {
+            auto constexpr kRest = detail::Pow(N, kDims - 1 - s) * detail::Pow(M, s);
+            auto const& A        = (s == k) ? Dl : Bl;
+            auto const ws        = w.template head<N * kRest>().reshaped(N, kRest);
+            Matrix<kRest, M> t{};
+            if constexpr (bTranspose)
+                t = (A.transpose() * ws).transpose();
+            else
+                t = (A * ws).transpose();
+            w.template head<M * kRest>() = t.reshaped();
+        });
+        return w.template head<detail::Pow(M, kDims)>();
+    }
+};
+
+template <CTensorProductElement TElement, int QuadratureOrder>
+template <class TDerivedU>
+inline Matrix<TDerivedU::RowsAtCompileTime, TensorProductBasis<TElement, QuadratureOrder>::kPoints>
+TensorProductBasis<TElement, QuadratureOrder>::Interpolate(Eigen::MatrixBase<TDerivedU> const& ue)
+{
+    auto constexpr kRows = TDerivedU::RowsAtCompileTime;
+    Matrix<kRows, kPoints> ug(ue.rows(), kPoints);
+    for (auto r = 0; r < ue.rows(); ++r)
+    {
+        Vector<kPoints> const ut =
+            Contract<kLinePoints, kLineNodes, false>(ue.row(r).transpose(), -1);
+        for (auto g = 0; g < kPoints; ++g)
+            ug(r, g) = ut(T[static_cast<std::size_t>(g)]);
+    }
+    return ug;
+}
+
+template <CTensorProductElement TElement, int QuadratureOrder>
+template <class TDerivedU>
+inline Matrix<
+    TDerivedU::RowsAtCompileTime,
+    TensorProductBasis<TElement, QuadratureOrder>::kDims *
+        TensorProductBasis<TElement, QuadratureOrder>::kPoints>
+TensorProductBasis<TElement, QuadratureOrder>::ReferenceGradients(
+    Eigen::MatrixBase<TDerivedU> const& ue)
+{
+    auto constexpr kRows = TDerivedU::RowsAtCompileTime;
+    Matrix<kRows, kDims * kPoints> Gg(ue.rows(), kDims * kPoints);
+    for (auto r = 0; r < ue.rows(); ++r)
+    {
+        Vector<kNodes> const ur = ue.row(r).transpose();
+        for (auto k = 0; k < kDims; ++k)
+        {
+            Vector<kPoints> const gt = Contract<kLinePoints, kLineNodes, false>(ur, k);
+            for (auto g = 0; g < kPoints; ++g)
+                Gg(r, g * kDims + k) = gt(T[static_cast<std::size_t>(g)]);
+        }
+    }
+    return Gg;
+}
+
+template <CTensorProductElement TElement, int QuadratureOrder>
+template <class TDerivedV>
+inline Matrix<TDerivedV::RowsAtCompileTime, TensorProductBasis<TElement, QuadratureOrder>::kNodes>
+TensorProductBasis<TElement, QuadratureOrder>::IntegrateValues(
+    Eigen::MatrixBase<TDerivedV> const& vg)
+{
+    auto constexpr kRows = TDerivedV::RowsAtCompileTime;
+    Matrix<kRows, kNodes> ye(vg.rows(), kNodes);
+    Vector<kPoints> vt{};
+    for (auto r = 0; r < vg.rows(); ++r)
+    {
+        for (auto g = 0; g < kPoints; ++g)
+            vt(T[static_cast<std::size_t>(g)]) = vg(r, g);
+        ye.row(r) = Contract<kLineNodes, kLinePoints, true>(vt, -1).transpose();
+    }
+    return ye;
+}
+
+template <CTensorProductElement TElement, int QuadratureOrder>
+template <class TDerivedG>
+inline Matrix<TDerivedG::RowsAtCompileTime, TensorProductBasis<TElement, QuadratureOrder>::kNodes>
+TensorProductBasis<TElement, QuadratureOrder>::IntegrateReferenceGradients(
+    Eigen::MatrixBase<TDerivedG> const& Gg)
+{
+    auto constexpr kRows = TDerivedG::RowsAtCompileTime;
+    Matrix<kRows, kNodes> ye(Gg.rows(), kNodes);
+    ye.setZero();
+    Vector<kPoints> gt{};
+    for (auto r = 0; r < Gg.rows(); ++r)
+    {
+        for (auto k = 0; k < kDims; ++k)
+        {
+            for (auto g = 0; g < kPoints; ++g)
+                gt(T[static_cast<std::size_t>(g)]) = Gg(r, g * kDims + k);
+            ye.row(r) += Contract<kLineNodes, kLinePoints, true>(gt, k).transpose();
+        }
+    }
+    return ye;
+}
+
+/**
+ * @brief Largest quadrature order for which operators detect and sum factorize tensor product
+ * quadrature rules, i.e. twice the element's polynomial order
+ * @tparam TElement Tensor product element type
+ */
+template <CTensorProductElement TElement>
+inline int constexpr kMaxSumFactorizedQuadratureOrder = 2 * TElement::kOrder;
+
+/**
+ * @brief Calls `f.template operator()<QuadratureOrder>()` for the runtime quadrature order
+ * `order`
+ *
+ * @tparam TElement Tensor product element type
+ * @tparam F Callable type
+ * @param order Quadrature order in `[1, kMaxSumFactorizedQuadratureOrder<TElement>]`
+ * @param f Callable templated on the quadrature order
+ */
+template <CTensorProductElement TElement, class F>
+void DispatchSumFactorizedQuadratureOrder(int order, F&& f)
+{
+    common::ForRange<1, kMaxSumFactorizedQuadratureOrder<TElement> + 1>(
+        [&]<auto QuadratureOrder>() {
+            if (order == QuadratureOrder)
+                f.template operator()<QuadratureOrder>();
+        });
+}
+
+/**
+ * @brief Recovers the inverse jacobians \f$ \mathbf{J}^{-1}_g \f$ of element maps at quadrature
+ * points from physical shape function gradients \f$ \nabla N_i(X_g) = \mathbf{J}^{-T}_g
+ * \nabla_\xi N_i(\xi_g) \f$, if these were computed at the element's tensor product quadrature
+ * points (see ShapeFunctionGradients()), stored element by element.
+ *
+ * Sum factorized operators need only these \f$ d \times d \f$ matrices at quadrature points,
+ * rather than \f$ |\text{element nodes}| \times d \f$ shape function gradients.
+ *
+ * @tparam TElement Tensor product element type
+ * @tparam Dims Mesh dimensions
+ * @param eg `|# quad.pts.|` elements of quadrature points, or empty if quadrature point g is in
+ * element g
+ * @param numberOfElements Number of elements
+ * @param GNeg `|# element nodes| x |Dims * # quad.pts.|` shape function gradients at quadrature
+ * points
+ * @param Jinvg `|TElement::kDims| x |Dims * # quad.pts.|` output inverse jacobians, with \f$
+ * \mathbf{J}^{-1}_g \f$ in block column g
+ * @return The detected quadrature order, or 0 if GNeg was not computed at the elements' tensor
+ * product quadrature points, in which case Jinvg is empty
+ */
+template <CTensorProductElement TElement, int Dims>
+int InverseJacobiansAtQuadraturePoints(
+    Eigen::Ref<IndexVectorX const> const& eg,
+    Index numberOfElements,
+    Eigen::Ref<MatrixX const> const& GNeg,
+    MatrixX& Jinvg)
+{
+    auto constexpr kNodesPerElement     = TElement::kNodes;
+    auto const numberOfQuadraturePoints = GNeg.cols() / Dims;
+    Jinvg.resize(TElement::kDims, 0);
+    if (numberOfElements == 0 or GNeg.rows() != kNodesPerElement or
+        numberOfQuadraturePoints % numberOfElements != 0)
+        return 0;
+    auto const kPointsPerElement = numberOfQuadraturePoints / numberOfElements;
+    int detectedOrder            = 0;
+    common::ForRange<1, kMaxSumFactorizedQuadratureOrder<TElement> + 1>(
+        [&]<auto QuadratureOrder>() {
+            using QuadratureRuleType =
+                typename TElement::template QuadratureType<QuadratureOrder>;
+            auto constexpr kPoints = QuadratureRuleType::kPoints;
+            if (detectedOrder != 0 or kPoints != kPointsPerElement)
+                return;
+            // Quadrature points must be stored element by element
+            if (eg.size() != 0)
+            {
+                for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+                    if (eg(g) != g / kPoints)
+                        return;
+            }
+            // Physical gradients must factor into reference gradients at the rule's points
+            auto const Xg = common::ToEigen(QuadratureRuleType::points)
+                                .reshaped(QuadratureRuleType::kDims + 1, kPoints)
+                                .template bottomRows<TElement::kDims>();
+            std::array<Matrix<kNodesPerElement, TElement::kDims>, kPoints> GPref{};
+            std::array<Matrix<TElement::kDims, kNodesPerElement>, kPoints> GPrefInv{};
+            for (auto g = 0; g < kPoints; ++g)
+            {
+                auto const gs = static_cast<std::size_t>(g);
+                GPref[gs]     = TElement::GradN(Xg.col(g));
+                GPrefInv[gs]  = (GPref[gs].transpose() * GPref[gs]).inverse() * GPref[gs].transpose();
+            }
+            MatrixX Jinv(TElement::kDims, Dims * numberOfQuadraturePoints);
+            Scalar constexpr kRelativeTolerance = 1e-8;
+            for (auto g = 0; g < numberOfQuadraturePoints; ++g)
+            {
+                auto const gs   = static_cast<std::size_t>(g % kPoints);
+                auto const GPeg = GNeg.block<kNodesPerElement, Dims>(0, g * Dims);
+                auto Jinveg     = Jinv.block<TElement::kDims, Dims>(0, g * Dims);
+                Jinveg          = GPrefInv[gs] * GPeg;
+                Scalar const residual = (GPref[gs] * Jinveg - GPeg).norm();
+                if (residual > kRelativeTolerance * GPeg.norm())
+                    return;
+            }
+            Jinvg         = std::move(Jinv);
+            detectedOrder = QuadratureOrder;
+        });
+    return detectedOrder;
+}
+
+} // namespace fem
+} // namespace pbat
+
+#endif // PBAT_FEM_SUMFACTORIZATION_H
@@ -11,7 +11,9 @@
 #include "pbat/profiling/Profiling.h"
 #include "pbat/sim/vbd/Kernels.h"
 
+#include <algorithm>
 #include <cuda/api.hpp>
+#include <exception>
 // #include <thrust/async/copy.h>
 #include <thrust/async/for_each.h>
 #include <thrust/execution_policy.h>
@@ -58,6 +60,15 @@ Integrator::Integrator(Data const& data)
       mStream(common::Device(common::EDeviceSelectionPreference::HighestComputeCapability)
                   .create_stream(/*synchronize_with_default_stream=*/false))
 {
+    bool const bIsStableNeoHookean = std::all_of(data.psie.begin(), data.psie.end(), [](auto psie) {
+        return psie == pbat::sim::vbd::EElasticEnergy::StableNeoHookean;
+    });
+    if (not bIsStableNeoHookean)
+    {
+        throw std::invalid_argument(
+            "GPU VBD only supports the Stable Neo-Hookean elastic energy, but data.psie holds "
+            "other elastic energy models");
+    }
     common::ToBuffer(data.x, x);
     mPositionsAtT = x;
     common::ToBuffer(data.E, T);
@@ -8,6 +8,8 @@
 #include "pbat/profiling/Profiling.h"
 #include "pbat/sim/xpbd/Kernels.h"
 
+#include <algorithm>
+#include <exception>
 #include <thrust/async/for_each.h>
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
@@ -46,6 +48,15 @@ Integrator::Integrator(Data const& data)
       Smax{},
       mActiveSetUpdateFrequency{static_cast<GpuIndex>(data.mActiveSetUpdateFrequency)}
 {
+    bool const bIsStableNeoHookean = std::all_of(data.ET.begin(), data.ET.end(), [](auto ET) {
+        return ET == EConstraint::StableNeoHookean;
+    });
+    if (not bIsStableNeoHookean)
+    {
+        throw std::invalid_argument(
+            "GPU XPBD only supports Stable Neo-Hookean elastic constraints, but data.ET holds "
+            "other elastic constraint types");
+    }
     // Initialize particle data
     common::ToBuffer(data.x, x);
     xt = x;
@@ -20,6 +20,12 @@ class Integrator
     using EInitializationStrategy = pbat::sim::vbd::EInitializationStrategy;
     using Data                    = pbat::sim::vbd::Data;
 
+    /**
+     * @brief Construct a GPU VBD integrator
+     * @param data Simulation data, whose elements must all use the Stable Neo-Hookean elastic
+     * energy
+     * @throw std::invalid_argument if data.psie holds other elastic energy models
+     */
     PBAT_API
     Integrator(Data const& data);
 
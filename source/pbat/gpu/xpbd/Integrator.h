@@ -25,9 +25,10 @@ class Integrator
 
     // Constructors
     /**
-     * @brief
-     * @param V
-     * @param T
+     * @brief Construct a GPU XPBD integrator
+     * @param data Simulation data, whose elements must all use Stable Neo-Hookean elastic
+     * constraints
+     * @throw std::invalid_argument if data.ET holds other elastic constraint types
      */
     PBAT_API Integrator(Data const& data);
     Integrator(Integrator const&)            = delete;
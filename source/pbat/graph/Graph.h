@@ -20,6 +20,7 @@ namespace pbat::graph {
 #include "Color.h"
 #include "Enums.h"
 #include "Mesh.h"
+#include "NestedDissection.h"
 #include "Partition.h"
 
 #endif // PBAT_GRAPH_GRAPH_H
\ No newline at end of file
@@ -0,0 +1,513 @@
+#include "NestedDissection.h"
+
+#include "Partition.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <Eigen/OrderingMethods>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pbat {
+namespace graph {
+namespace detail {
+
+class NestedDissector
+{
+  public:
+    NestedDissector(
+        Eigen::Ref<IndexVectorX const> const& ptr,
+        Eigen::Ref<IndexVectorX const> const& adj,
+        NestedDissectionOptions opts);
+
+    NestedDissection Run();
+
+  private:
+    enum ESide : std::int8_t { A = 0, B = 1, S = 2 };
+    /**
+     * @brief Recursively dissects the subgraph at positions [b,e) of the ordering
+     * @return Index of the dissection tree node
+     */
+    Index Dissect(Index b, Index e);
+    /**
+     * @brief Marks vertices at positions [b,e) of the ordering as the current subgraph
+     */
+    void Enter(Index b, Index e);
+    bool IsInSubgraph(Index v) const { return mToken[static_cast<std::size_t>(v)] == mCurrent; }
+    Index Degree(Index v) const;
+    /**
+     * @brief Breadth-first search from root within the current subgraph
+     * @return Number of levels
+     */
+    Index Bfs(Index root, std::vector<Index>& queue);
+    /**
+     * @brief Splits disconnected subgraphs into balanced groups of connected components
+     * @return true if the subgraph at [b,e) is disconnected
+     */
+    bool SplitComponents(Index b, Index e);
+    bool BisectLevelSet(Index b, Index e);
+    bool BisectMetis(Index b, Index e);
+    void OrderLeaf(Index b, Index e);
+
+    Eigen::Ref<IndexVectorX const> mPtr;
+    Eigen::Ref<IndexVectorX const> mAdj;
+    NestedDissectionOptions mOpts;
+    std::vector<Index> mOrder;
+    std::vector<Index> mToken;
+    std::vector<Index> mLevel;
+    std::vector<std::int8_t> mSide;
+    std::vector<Index> mQueue;
+    std::vector<std::array<Index, 4>> mNodes;
+    std::vector<std::array<Index, 2>> mChildren;
+    Index mCurrent;
+    Index mTokens;
+};
+
+NestedDissector::NestedDissector(
+    Eigen::Ref<IndexVectorX const> const& ptr,
+    Eigen::Ref<IndexVectorX const> const& adj,
+    NestedDissectionOptions opts)
+    : mPtr(ptr),
+      mAdj(adj),
+      mOpts(opts),
+      mOrder(),
+      mToken(),
+      mLevel(),
+      mSide(),
+      mQueue(),
+      mNodes(),
+      mChildren(),
+      mCurrent(-1),
+      mTokens(0)
+{
+    auto const n = static_cast<std::size_t>(ptr.size() - 1);
+    mOrder.resize(n);
+    for (std::size_t v = 0; v < n; ++v)
+        mOrder[v] = static_cast<Index>(v);
+    mToken.assign(n, Index(-1));
+    mLevel.assign(n, Index(-1));
+    mSide.assign(n, A);
+    mQueue.reserve(n);
+}
+
+NestedDissection NestedDissector::Run()
+{
+    auto const n = static_cast<Index>(mOrder.size());
+    Dissect(0, n);
+    NestedDissection ND{};
+    ND.perm.resize(n);
+    ND.iperm.resize(n);
+    for (Index k = 0; k < n; ++k)
+    {
+        ND.perm(k)           = mOrder[static_cast<std::size_t>(k)];
+        ND.iperm(ND.perm(k)) = k;
+    }
+    auto const nNodes = static_cast<Index>(mNodes.size());
+    ND.nodes.resize(4, nNodes);
+    ND.children.resize(2, nNodes);
+    for (Index t = 0; t < nNodes; ++t)
+    {
+        auto const& node     = mNodes[static_cast<std::size_t>(t)];
+        auto const& children = mChildren[static_cast<std::size_t>(t)];
+        ND.nodes.col(t) << node[0], node[1], node[2], node[3];
+        ND.children.col(t) << children[0], children[1];
+    }
+    return ND;
+}
+
+Index NestedDissector::Dissect(Index b, Index e)
+{
+    auto const t = static_cast<Index>(mNodes.size());
+    mNodes.push_back({b, b, b, e});
+    mChildren.push_back({Index(-1), Index(-1)});
+    if (e - b <= std::max(mOpts.leafSize, Index(1)))
+    {
+        OrderLeaf(b, e);
+        return t;
+    }
+    Enter(b, e);
+    bool bIsBisected = SplitComponents(b, e);
+    if (not bIsBisected)
+    {
+        using EBisection = NestedDissectionOptions::EBisection;
+        bool bUseMetis   = mOpts.eBisection == EBisection::Metis;
+#ifdef PBAT_USE_METIS
+        bUseMetis = bUseMetis or mOpts.eBisection == EBisection::Default;
+#endif // PBAT_USE_METIS
+        if (bUseMetis)
+            bIsBisected = BisectMetis(b, e);
+        if (not bIsBisected)
+            bIsBisected = BisectLevelSet(b, e);
+    }
+    if (not bIsBisected)
+    {
+        OrderLeaf(b, e);
+        return t;
+    }
+    // Order A, then B, then the separator S
+    auto const begin = mOrder.begin() + b;
+    auto const end   = mOrder.begin() + e;
+    auto const mid = std::stable_partition(begin, end, [this](Index v) {
+        return mSide[static_cast<std::size_t>(v)] == A;
+    });
+    auto const sep = std::stable_partition(mid, end, [this](Index v) {
+        return mSide[static_cast<std::size_t>(v)] == B;
+    });
+    Index const m = b + static_cast<Index>(mid - begin);
+    Index const s = b + static_cast<Index>(sep - begin);
+    // mNodes may reallocate during recursion, so only index into it afterwards
+    Index const left  = Dissect(b, m);
+    Index const right = Dissect(m, s);
+    mNodes[static_cast<std::size_t>(t)]    = {b, m, s, e};
+    mChildren[static_cast<std::size_t>(t)] = {left, right};
+    return t;
+}
+
+void NestedDissector::Enter(Index b, Index e)
+{
+    mCurrent = mTokens++;
+    for (Index k = b; k < e; ++k)
+        mToken[static_cast<std::size_t>(mOrder[static_cast<std::size_t>(k)])] = mCurrent;
+}
+
+Index NestedDissector::Degree(Index v) const
+{
+    Index d{0};
+    for (Index k = mPtr(v); k < mPtr(v + 1); ++k)
+        d += IsInSubgraph(mAdj(k));
+    return d;
+}
+
+Index NestedDissector::Bfs(Index root, std::vector<Index>& queue)
+{
+    queue.clear();
+    queue.push_back(root);
+    mLevel[static_cast<std::size_t>(root)] = 0;
+    Index nLevels{1};
+    for (std::size_t q = 0; q < queue.size(); ++q)
+    {
+        Index const v  = queue[q];
+        Index const lv = mLevel[static_cast<std::size_t>(v)];
+        for (Index k = mPtr(v); k < mPtr(v + 1); ++k)
+        {
+            Index const u = mAdj(k);
+            if (not IsInSubgraph(u) or mLevel[static_cast<std::size_t>(u)] >= 0)
+                continue;
+            mLevel[static_cast<std::size_t>(u)] = lv + 1;
+            nLevels                             = std::max(nLevels, lv + 2);
+            queue.push_back(u);
+        }
+    }
+    return nLevels;
+}
+
+bool NestedDissector::SplitComponents(Index b, Index e)
+{
+    for (Index k = b; k < e; ++k)
+        mLevel[static_cast<std::size_t>(mOrder[static_cast<std::size_t>(k)])] = Index(-1);
+    std::array<Index, 2> nSide{0, 0};
+    Index nComponents{0};
+    for (Index k = b; k < e; ++k)
+    {
+        Index const root = mOrder[static_cast<std::size_t>(k)];
+        if (mLevel[static_cast<std::size_t>(root)] >= 0)
+            continue;
+        Bfs(root, mQueue);
+        // Greedily balance components between A and B
+        std::int8_t const side = nSide[A] <= nSide[B] ? A : B;
+        for (Index v : mQueue)
+            mSide[static_cast<std::size_t>(v)] = side;
+        nSide[static_cast<std::size_t>(side)] += static_cast<Index>(mQueue.size());
+        ++nComponents;
+    }
+    return nComponents > 1;
+}
+
+bool NestedDissector::BisectLevelSet(Index b, Index e)
+{
+    // Find a pseudo-peripheral vertex, i.e. a root of a (nearly) maximal depth level structure
+    for (Index k = b; k < e; ++k)
+        mLevel[static_cast<std::size_t>(mOrder[static_cast<std::size_t>(k)])] = Index(-1);
+    Index root    = mOrder[static_cast<std::size_t>(b)];
+    Index nLevels = Bfs(root, mQueue);
+    std::vector<Index> candidate{};
+    candidate.reserve(mQueue.size());
+    for (auto iter = 0; iter < 8; ++iter)
+    {
+        Index next{-1};
+        Index minDegree{std::numeric_limits<Index>::max()};
+        for (auto q = mQueue.rbegin(); q != mQueue.rend(); ++q)
+        {
+            if (mLevel[static_cast<std::size_t>(*q)] != nLevels - 1)
+                break;
+            Index const d = Degree(*q);
+            if (d < minDegree)
+            {
+                minDegree = d;
+                next      = *q;
+            }
+        }
+        for (Index v : mQueue)
+            mLevel[static_cast<std::size_t>(v)] = Index(-1);
+        Index const nNextLevels = Bfs(next, candidate);
+        if (nNextLevels <= nLevels)
+        {
+            for (Index v : candidate)
+                mLevel[static_cast<std::size_t>(v)] = Index(-1);
+            Bfs(root, mQueue);
+            break;
+        }
+        root    = next;
+        nLevels = nNextLevels;
+        std::swap(candidate, mQueue);
+    }
+    if (nLevels < 3)
+        return false;
+    // Select the level that splits the vertices in half as separator
+    std::vector<Index> counts(static_cast<std::size_t>(nLevels), Index(0));
+    for (Index v : mQueue)
+        ++counts[static_cast<std::size_t>(mLevel[static_cast<std::size_t>(v)])];
+    Index const half = (e - b) / 2;
+    Index separator{1};
+    for (Index cumulative{counts[0]}; separator < nLevels - 2; ++separator)
+    {
+        cumulative += counts[static_cast<std::size_t>(separator)];
+        if (cumulative >= half)
+            break;
+    }
+    for (Index v : mQueue)
+    {
+        Index const l                      = mLevel[static_cast<std::size_t>(v)];
+        mSide[static_cast<std::size_t>(v)] = l < separator ? A : (l > separator ? B : S);
+    }
+    // Thin the separator by moving vertices without neighbours in B to A
+    for (Index v : mQueue)
+    {
+        if (mSide[static_cast<std::size_t>(v)] != S)
+            continue;
+        bool bTouchesB{false};
+        for (Index k = mPtr(v); k < mPtr(v + 1) and not bTouchesB; ++k)
+        {
+            Index const u = mAdj(k);
+            bTouchesB     = IsInSubgraph(u) and mSide[static_cast<std::size_t>(u)] == B;
+        }
+        if (not bTouchesB)
+            mSide[static_cast<std::size_t>(v)] = A;
+    }
+    return true;
+}
+
+bool NestedDissector::BisectMetis(Index b, Index e)
+{
+    // Build the subgraph's local adjacency, reusing mLevel as global to local vertex map
+    Index const n = e - b;
+    for (Index k = b; k < e; ++k)
+        mLevel[static_cast<std::size_t>(mOrder[static_cast<std::size_t>(k)])] = k - b;
+    IndexVectorX ptr(n + 1);
+    std::vector<Index> adj{};
+    ptr(0) = 0;
+    for (Index i = 0; i < n; ++i)
+    {
+        Index const v = mOrder[static_cast<std::size_t>(b + i)];
+        for (Index k = mPtr(v); k < mPtr(v + 1); ++k)
+            if (IsInSubgraph(mAdj(k)))
+                adj.push_back(mLevel[static_cast<std::size_t>(mAdj(k))]);
+        ptr(i + 1) = static_cast<Index>(adj.size());
+    }
+    auto const nEdges = static_cast<Index>(adj.size());
+    IndexVectorX const p = Partition(
+        ptr,
+        Eigen::Map<IndexVectorX const>(adj.data(), nEdges),
+        IndexVectorX::Ones(nEdges),
+        2);
+    // Turn the edge separator into a vertex separator by taking the smaller boundary
+    std::array<Index, 2> nBoundary{0, 0};
+    std::array<Index, 2> nPart{0, 0};
+    for (Index i = 0; i < n; ++i)
+    {
+        ++nPart[static_cast<std::size_t>(p(i))];
+        for (Index k = ptr(i); k < ptr(i + 1); ++k)
+        {
+            if (p(adj[static_cast<std::size_t>(k)]) != p(i))
+            {
+                ++nBoundary[static_cast<std::size_t>(p(i))];
+                break;
+            }
+        }
+    }
+    if (nPart[0] == 0 or nPart[1] == 0)
+        return false;
+    Index const s = nBoundary[0] <= nBoundary[1] ? 0 : 1;
+    if (nPart[static_cast<std::size_t>(s)] == nBoundary[static_cast<std::size_t>(s)])
+        return false;
+    for (Index i = 0; i < n; ++i)
+    {
+        Index const v  = mOrder[static_cast<std::size_t>(b + i)];
+        bool bBoundary = false;
+        for (Index k = ptr(i); k < ptr(i + 1) and not bBoundary; ++k)
+            bBoundary = p(adj[static_cast<std::size_t>(k)]) != p(i);
+        mSide[static_cast<std::size_t>(v)] =
+            (p(i) == s and bBoundary) ? S : static_cast<std::int8_t>(p(i));
+    }
+    return true;
+}
+
+void NestedDissector::OrderLeaf(Index b, Index e)
+{
+    Index const n = e - b;
+    if (n < 3)
+        return;
+    Enter(b, e);
+    for (Index k = b; k < e; ++k)
+        mLevel[static_cast<std::size_t>(mOrder[static_cast<std::size_t>(k)])] = k - b;
+    using SparseMatrixType = Eigen::SparseMatrix<Scalar, Eigen::ColMajor, Index>;
+    std::vector<Eigen::Triplet<Scalar, Index>> triplets{};
+    for (Index i = 0; i < n; ++i)
+    {
+        Index const v = mOrder[static_cast<std::size_t>(b + i)];
+        triplets.emplace_back(i, i, Scalar(1));
+        for (Index k = mPtr(v); k < mPtr(v + 1); ++k)
+            if (IsInSubgraph(mAdj(k)))
+                triplets.emplace_back(mLevel[static_cast<std::size_t>(mAdj(k))], i, Scalar(1));
+    }
+    SparseMatrixType G(n, n);
+    G.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic, Index> P{};
+    Eigen::AMDOrdering<Index> amd{};
+    amd(G, P);
+    // P maps new positions to old positions, i.e. the k^{th} eliminated vertex is P(k)
+    std::vector<Index> const leaf(mOrder.begin() + b, mOrder.begin() + e);
+    for (Index k = 0; k < n; ++k)
+        mOrder[static_cast<std::size_t>(b + k)] = leaf[static_cast<std::size_t>(P.indices()(k))];
+}
+
+} // namespace detail
+
+NestedDissection NestedDissectionOrdering(
+    Eigen::Ref<IndexVectorX const> const& ptr,
+    Eigen::Ref<IndexVectorX const> const& adj,
+    NestedDissectionOptions opts)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.graph.NestedDissectionOrdering");
+    if (ptr.size() < 1)
+    {
+        throw std::invalid_argument(
+            "NestedDissectionOrdering() expects an adjacency list with offset pointers of size "
+            "|# vertices| + 1");
+    }
+#ifndef PBAT_USE_METIS
+    if (opts.eBisection == NestedDissectionOptions::EBisection::Metis)
+    {
+        throw std::runtime_error(
+            "NestedDissectionOrdering() with METIS bisection requires building with METIS");
+    }
+#endif // PBAT_USE_METIS
+    detail::NestedDissector dissector(ptr, adj, opts);
+    return dissector.Run();
+}
+
+} // namespace graph
+} // namespace pbat
+
+#include <doctest/doctest.h>
+
+TEST_CASE("[graph] NestedDissection")
+{
+    using namespace pbat;
+    // Regular grid graph with 4-neighbourhoods, plus a disconnected path
+    Index constexpr nx = 23;
+    Index constexpr ny = 17;
+    Index constexpr np = 9;
+    Index constexpr n  = nx * ny + np;
+    std::vector<std::vector<Index>> neighbours(static_cast<std::size_t>(n));
+    auto const connect = [&](Index u, Index v) {
+        neighbours[static_cast<std::size_t>(u)].push_back(v);
+        neighbours[static_cast<std::size_t>(v)].push_back(u);
+    };
+    for (Index j = 0; j < ny; ++j)
+    {
+        for (Index i = 0; i < nx; ++i)
+        {
+            Index const v = j * nx + i;
+            if (i + 1 < nx)
+                connect(v, v + 1);
+            if (j + 1 < ny)
+                connect(v, v + nx);
+        }
+    }
+    for (Index v = nx * ny; v + 1 < n; ++v)
+        connect(v, v + 1);
+    IndexVectorX ptr(n + 1);
+    ptr(0) = 0;
+    for (Index v = 0; v < n; ++v)
+        ptr(v + 1) = ptr(v) + static_cast<Index>(neighbours[static_cast<std::size_t>(v)].size());
+    IndexVectorX adj(ptr(n));
+    for (Index v = 0; v < n; ++v)
+        for (std::size_t k = 0; k < neighbours[static_cast<std::size_t>(v)].size(); ++k)
+            adj(ptr(v) + static_cast<Index>(k)) = neighbours[static_cast<std::size_t>(v)][k];
+
+    graph::NestedDissectionOptions opts{};
+    opts.eBisection = graph::NestedDissectionOptions::EBisection::LevelSet;
+    opts.leafSize   = 16;
+    graph::NestedDissection const ND = graph::NestedDissectionOrdering(ptr, adj, opts);
+    // Act
+    REQUIRE_EQ(ND.perm.size(), n);
+    REQUIRE_EQ(ND.iperm.size(), n);
+    REQUIRE_EQ(ND.nodes.rows(), 4);
+    REQUIRE_EQ(ND.children.cols(), ND.nodes.cols());
+    // Assert
+    // The ordering is a permutation
+    for (Index k = 0; k < n; ++k)
+        CHECK_EQ(ND.iperm(ND.perm(k)), k);
+    // The root orders the whole graph
+    CHECK_EQ(ND.nodes(0, 0), 0);
+    CHECK_EQ(ND.nodes(3, 0), n);
+    Index nInternalNodes{0};
+    for (Index t = 0; t < ND.nodes.cols(); ++t)
+    {
+        Index const b = ND.nodes(0, t);
+        Index const m = ND.nodes(1, t);
+        Index const s = ND.nodes(2, t);
+        Index const e = ND.nodes(3, t);
+        CHECK_LE(b, m);
+        CHECK_LE(m, s);
+        CHECK_LE(s, e);
+        bool const bIsLeaf = ND.children(0, t) < 0;
+        CHECK_EQ(bIsLeaf, ND.children(1, t) < 0);
+        if (bIsLeaf)
+        {
+            CHECK_EQ(m, b);
+            CHECK_EQ(s, b);
+            continue;
+        }
+        ++nInternalNodes;
+        Index const left  = ND.children(0, t);
+        Index const right = ND.children(1, t);
+        CHECK_EQ(ND.nodes(0, left), b);
+        CHECK_EQ(ND.nodes(3, left), m);
+        CHECK_EQ(ND.nodes(0, right), m);
+        CHECK_EQ(ND.nodes(3, right), s);
+        // No edge connects sibling subtrees
+        bool bAreSiblingsConnected{false};
+        for (Index k = b; k < m; ++k)
+        {
+            Index const v = ND.perm(k);
+            for (Index a = ptr(v); a < ptr(v + 1); ++a)
+            {
+                Index const ku = ND.iperm(adj(a));
+                bAreSiblingsConnected |= (ku >= m and ku < s);
+            }
+        }
+        CHECK_FALSE(bAreSiblingsConnected);
+    }
+    CHECK_GT(nInternalNodes, 0);
+#ifndef PBAT_USE_METIS
+    opts.eBisection = graph::NestedDissectionOptions::EBisection::Metis;
+    CHECK_THROWS_AS(graph::NestedDissectionOrdering(ptr, adj, opts), std::runtime_error);
+#endif // PBAT_USE_METIS
+}
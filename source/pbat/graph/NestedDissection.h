@@ -0,0 +1,74 @@
+/**
+ * @file NestedDissection.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Nested dissection fill-reducing ordering
+ * @date 2025-02-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_GRAPH_NESTEDDISSECTION_H
+#define PBAT_GRAPH_NESTEDDISSECTION_H
+
+#include "pbat/Aliases.h"
+
+namespace pbat {
+namespace graph {
+
+/**
+ * @brief Options for nested dissection
+ */
+struct NestedDissectionOptions
+{
+    /**
+     * @brief Graph bisection strategy
+     */
+    enum class EBisection {
+        Default,  ///< METIS if the library was built with it, level set bisection otherwise
+        LevelSet, ///< Breadth-first level set bisection from a pseudo-peripheral vertex
+        Metis     ///< METIS edge bisection (see Partition()), turned into a vertex separator
+    } eBisection{EBisection::Default}; ///< Graph bisection strategy
+    Index leafSize{256}; ///< Subgraphs with at most leafSize vertices are not dissected further,
+                         ///< but ordered by approximate minimum degree
+};
+
+/**
+ * @brief Nested dissection ordering and its dissection tree
+ *
+ * Node t of the dissection tree orders its subgraph's vertices into positions
+ * [begin(t), end(t)). An internal node's children occupy [begin(t), mid(t)) and [mid(t), sep(t)),
+ * followed by the vertex separator [sep(t), end(t)) that disconnects them. A leaf has no children,
+ * i.e. `begin(t) == mid(t) == sep(t)`. The root is node 0.
+ *
+ * Since no edge connects the subgraphs of sibling nodes, eliminating vertices in this order
+ * creates no fill between siblings, such that sibling subtrees can be eliminated independently.
+ */
+struct NestedDissection
+{
+    IndexVectorX perm;  ///< `|# vertices|` elimination order, i.e. perm[k] is the k-th vertex
+    IndexVectorX iperm; ///< `|# vertices|` inverse of perm, i.e. iperm[perm[k]] = k
+    IndexMatrixX nodes; ///< `4 x |# tree nodes|` matrix of (begin, mid, sep, end) position ranges
+    IndexMatrixX children; ///< `2 x |# tree nodes|` matrix of child node indices, or -1 for leaves
+};
+
+/**
+ * @brief Computes a nested dissection ordering of an undirected graph
+ *
+ * Recursively splits the graph by vertex separators, ordering separators after the subgraphs
+ * they separate @cite george1973nested.
+ *
+ * @param ptr Offset pointers of adjacency list
+ * @param adj Indices of adjacency list
+ * @param opts Nested dissection options
+ * @return Nested dissection ordering and its dissection tree
+ * @pre The adjacency list is symmetric and has no self-loops
+ */
+NestedDissection NestedDissectionOrdering(
+    Eigen::Ref<IndexVectorX const> const& ptr,
+    Eigen::Ref<IndexVectorX const> const& adj,
+    NestedDissectionOptions opts = NestedDissectionOptions{});
+
+} // namespace graph
+} // namespace pbat
+
+#endif // PBAT_GRAPH_NESTEDDISSECTION_H
@@ -2,7 +2,9 @@
 
 #include "Concepts.h"
 
+#include <cmath>
 #include <doctest/doctest.h>
+#include <pbat/common/Eigen.h>
 #include <pbat/common/ConstexprFor.h>
 
 TEST_CASE("[math] GaussQuadrature")
@@ -13,6 +15,27 @@ TEST_CASE("[math] GaussQuadrature")
         ForRange<1, 10>([]<auto Order> {
             CHECK(pm::CPolynomialQuadratureRule<pm::GaussLegendreQuadrature<Dims, Order>>);
             CHECK(pm::CFixedPointQuadratureRule<pm::GaussLegendreQuadrature<Dims, Order>>);
+            // Points are stored point by point, in affine coordinates, and integrate
+            // polynomials of degree 2*Order-1 exactly along each dimension
+            using QuadratureRuleType = pm::GaussLegendreQuadrature<Dims, Order>;
+            auto const Xg            = ToEigen(QuadratureRuleType::points)
+                                .reshaped(QuadratureRuleType::kDims + 1, QuadratureRuleType::kPoints);
+            auto const wg = ToEigen(QuadratureRuleType::weights);
+            bool const bArePointsInUnitBox =
+                (Xg.bottomRows(Dims).array() > 0.).all() and (Xg.bottomRows(Dims).array() < 1.).all();
+            CHECK(bArePointsInUnitBox);
+            pbat::Scalar const affineError =
+                (Xg.row(0) + Xg.bottomRows(Dims).colwise().sum()).array().abs().maxCoeff() - 1.;
+            CHECK_LE(std::abs(affineError), 1e-10);
+            for (auto d = 0; d < Dims; ++d)
+            {
+                for (auto k = 0; k < 2 * Order; ++k)
+                {
+                    pbat::Scalar const integral = wg.dot(Xg.row(1 + d).array().pow(k).matrix().transpose());
+                    pbat::Scalar const expected = 1. / static_cast<pbat::Scalar>(k + 1);
+                    CHECK_LE(std::abs(integral - expected), 1e-8);
+                }
+            }
         });
     });
 }
\ No newline at end of file
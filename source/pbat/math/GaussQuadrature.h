@@ -72,8 +72,7 @@ struct GaussLegendreQuadrature<1, 1>
     inline static std::uint8_t constexpr kOrder                              = 1;
     inline static int constexpr kPoints                                      = 1;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.500000000000000,
-        0.500000000000000};
+        0.500000000000000, 0.500000000000000};
     inline static std::array<Scalar, kPoints> constexpr weights = {1.00000000000000};
 };
 
@@ -83,8 +82,9 @@ struct GaussLegendreQuadrature<1, 2>
     inline static std::uint8_t constexpr kDims  = 1;
     inline static std::uint8_t constexpr kOrder = 2;
     inline static int constexpr kPoints         = 2;
-    inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points =
-        {0.788675134594087, 0.211324865405913, 0.211324865405913, 0.788675134594087};
+    inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
+        0.788675134594087, 0.211324865405913,
+        0.211324865405913, 0.788675134594087};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.500000000000000,
         0.500000000000000};
@@ -97,12 +97,9 @@ struct GaussLegendreQuadrature<1, 3>
     inline static std::uint8_t constexpr kOrder                              = 3;
     inline static int constexpr kPoints                                      = 3;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.887298334619118,
-        0.500000000000000,
-        0.112701665380882,
-        0.112701665380882,
-        0.500000000000000,
-        0.887298334619118};
+        0.887298334619118, 0.112701665380882,
+        0.500000000000000, 0.500000000000000,
+        0.112701665380882, 0.887298334619118};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.277777777777374,
         0.444444444445253,
@@ -116,14 +113,10 @@ struct GaussLegendreQuadrature<1, 4>
     inline static std::uint8_t constexpr kOrder                              = 4;
     inline static int constexpr kPoints                                      = 4;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.930568155796209,
-        0.669990521791988,
-        0.330009478208012,
-        0.0694318442037911,
-        0.0694318442037911,
-        0.330009478208012,
-        0.669990521791988,
-        0.930568155796209};
+        0.930568155796209, 0.0694318442037911,
+        0.669990521791988, 0.330009478208012,
+        0.330009478208012, 0.669990521791988,
+        0.0694318442037911, 0.930568155796209};
     inline static std::array<Scalar, kPoints> constexpr weights =
         {0.173927422569250, 0.326072577430750, 0.326072577430750, 0.173927422569250};
 };
@@ -135,16 +128,11 @@ struct GaussLegendreQuadrature<1, 5>
     inline static std::uint8_t constexpr kOrder                              = 5;
     inline static int constexpr kPoints                                      = 5;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.953089922968502,
-        0.769234655053879,
-        0.500000000000000,
-        0.230765344946121,
-        0.0469100770314981,
-        0.0469100770314981,
-        0.230765344946121,
-        0.500000000000000,
-        0.769234655053879,
-        0.953089922968502};
+        0.953089922968502, 0.0469100770314981,
+        0.769234655053879, 0.230765344946121,
+        0.500000000000000, 0.500000000000000,
+        0.230765344946121, 0.769234655053879,
+        0.0469100770314981, 0.953089922968502};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.118463442528082,
         0.239314335249219,
@@ -160,18 +148,12 @@ struct GaussLegendreQuadrature<1, 6>
     inline static std::uint8_t constexpr kOrder                              = 6;
     inline static int constexpr kPoints                                      = 6;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.966234757102939,
-        0.830604693233909,
-        0.619309593041180,
-        0.380690406958820,
-        0.169395306766091,
-        0.0337652428970614,
-        0.0337652428970614,
-        0.169395306766091,
-        0.380690406958820,
-        0.619309593041180,
-        0.830604693233909,
-        0.966234757102939};
+        0.966234757102939, 0.0337652428970614,
+        0.830604693233909, 0.169395306766091,
+        0.619309593041180, 0.380690406958820,
+        0.380690406958820, 0.619309593041180,
+        0.169395306766091, 0.830604693233909,
+        0.0337652428970614, 0.966234757102939};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0856622461897132,
         0.180380786523529,
@@ -188,20 +170,13 @@ struct GaussLegendreQuadrature<1, 7>
     inline static std::uint8_t constexpr kOrder                              = 7;
     inline static int constexpr kPoints                                      = 7;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.974553956169984,
-        0.870765592801035,
-        0.702922575688717,
-        0.500000000000000,
-        0.297077424311283,
-        0.129234407198965,
-        0.0254460438300157,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984};
+        0.974553956169984, 0.0254460438300157,
+        0.870765592801035, 0.129234407198965,
+        0.702922575688717, 0.297077424311283,
+        0.500000000000000, 0.500000000000000,
+        0.297077424311283, 0.702922575688717,
+        0.129234407198965, 0.870765592801035,
+        0.0254460438300157, 0.974553956169984};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0647424830849559,
         0.139852695743684,
@@ -219,22 +194,14 @@ struct GaussLegendreQuadrature<1, 8>
     inline static std::uint8_t constexpr kOrder                              = 8;
     inline static int constexpr kPoints                                      = 8;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.980144928249501,
-        0.898333238706982,
-        0.762766204956279,
-        0.591717321247415,
-        0.408282678752585,
-        0.237233795043721,
-        0.101666761293018,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501};
+        0.980144928249501, 0.0198550717504986,
+        0.898333238706982, 0.101666761293018,
+        0.762766204956279, 0.237233795043721,
+        0.591717321247415, 0.408282678752585,
+        0.408282678752585, 0.591717321247415,
+        0.237233795043721, 0.762766204956279,
+        0.101666761293018, 0.898333238706982,
+        0.0198550717504986, 0.980144928249501};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0506142681447272,
         0.111190517226532,
@@ -253,24 +220,15 @@ struct GaussLegendreQuadrature<1, 9>
     inline static std::uint8_t constexpr kOrder                              = 9;
     inline static int constexpr kPoints                                      = 9;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.984080119753344,
-        0.918015553663281,
-        0.806685716350330,
-        0.662126711702513,
-        0.500000000000000,
-        0.337873288297487,
-        0.193314283649670,
-        0.0819844463367190,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344};
+        0.984080119753344, 0.0159198802466562,
+        0.918015553663281, 0.0819844463367190,
+        0.806685716350330, 0.193314283649670,
+        0.662126711702513, 0.337873288297487,
+        0.500000000000000, 0.500000000000000,
+        0.337873288297487, 0.662126711702513,
+        0.193314283649670, 0.806685716350330,
+        0.0819844463367190, 0.918015553663281,
+        0.0159198802466562, 0.984080119753344};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0406371941808175,
         0.0903240803472727,
@@ -290,11 +248,16 @@ struct GaussLegendreQuadrature<1, 10>
     inline static std::uint8_t constexpr kOrder                              = 10;
     inline static int constexpr kPoints                                      = 10;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.986953264258773,  0.932531683345587,  0.839704784149944,  0.716697697063864,
-        0.574437169490920,  0.425562830509080,  0.283302302936136,  0.160295215850056,
-        0.0674683166544128, 0.0130467357412272, 0.0130467357412272, 0.0674683166544128,
-        0.160295215850056,  0.283302302936136,  0.425562830509080,  0.574437169490920,
-        0.716697697063864,  0.839704784149944,  0.932531683345587,  0.986953264258773};
+        0.986953264258773, 0.0130467357412272,
+        0.932531683345587, 0.0674683166544128,
+        0.839704784149944, 0.160295215850056,
+        0.716697697063864, 0.283302302936136,
+        0.574437169490920, 0.425562830509080,
+        0.425562830509080, 0.574437169490920,
+        0.283302302936136, 0.716697697063864,
+        0.160295215850056, 0.839704784149944,
+        0.0674683166544128, 0.932531683345587,
+        0.0130467357412272, 0.986953264258773};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0333356721544078,
         0.0747256745753475,
@@ -315,9 +278,7 @@ struct GaussLegendreQuadrature<2, 1>
     inline static std::uint8_t constexpr kOrder                              = 1;
     inline static int constexpr kPoints                                      = 1;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0,
-        0.500000000000000,
-        0.500000000000000};
+        0, 0.500000000000000, 0.500000000000000};
     inline static std::array<Scalar, kPoints> constexpr weights = {1.00000000000000};
 };
 
@@ -328,18 +289,10 @@ struct GaussLegendreQuadrature<2, 2>
     inline static std::uint8_t constexpr kOrder                              = 2;
     inline static int constexpr kPoints                                      = 4;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.577350269188173,
-        0,
-        0,
-        -0.577350269188173,
-        0.211324865405913,
-        0.211324865405913,
-        0.788675134594087,
-        0.788675134594087,
-        0.211324865405913,
-        0.788675134594087,
-        0.211324865405913,
-        0.788675134594087};
+        0.577350269188173, 0.211324865405913, 0.211324865405913,
+        0, 0.211324865405913, 0.788675134594087,
+        0, 0.788675134594087, 0.211324865405913,
+        -0.577350269188173, 0.788675134594087, 0.788675134594087};
     inline static std::array<Scalar, kPoints> constexpr weights =
         {0.250000000000000, 0.250000000000000, 0.250000000000000, 0.250000000000000};
 };
@@ -351,33 +304,15 @@ struct GaussLegendreQuadrature<2, 3>
     inline static std::uint8_t constexpr kOrder                              = 3;
     inline static int constexpr kPoints                                      = 9;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.774596669238235,
-        0.387298334619118,
-        0,
-        0.387298334619118,
-        0,
-        -0.387298334619118,
-        0,
-        -0.387298334619118,
-        -0.774596669238235,
-        0.112701665380882,
-        0.112701665380882,
-        0.112701665380882,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.887298334619118,
-        0.887298334619118,
-        0.887298334619118,
-        0.112701665380882,
-        0.500000000000000,
-        0.887298334619118,
-        0.112701665380882,
-        0.500000000000000,
-        0.887298334619118,
-        0.112701665380882,
-        0.500000000000000,
-        0.887298334619118};
+        0.774596669238235, 0.112701665380882, 0.112701665380882,
+        0.387298334619118, 0.112701665380882, 0.500000000000000,
+        0, 0.112701665380882, 0.887298334619118,
+        0.387298334619118, 0.500000000000000, 0.112701665380882,
+        0, 0.500000000000000, 0.500000000000000,
+        -0.387298334619118, 0.500000000000000, 0.887298334619118,
+        0, 0.887298334619118, 0.112701665380882,
+        -0.387298334619118, 0.887298334619118, 0.500000000000000,
+        -0.774596669238235, 0.887298334619118, 0.887298334619118};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0771604938269359,
         0.123456790123502,
@@ -397,54 +332,22 @@ struct GaussLegendreQuadrature<2, 4>
     inline static std::uint8_t constexpr kOrder                              = 4;
     inline static int constexpr kPoints                                      = 16;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.861136311592418,
-        0.600558677588197,
-        0.260577634004221,
-        0,
-        0.600558677588197,
-        0.339981043583975,
-        0,
-        -0.260577634004221,
-        0.260577634004221,
-        0,
-        -0.339981043583975,
-        -0.600558677588197,
-        0,
-        -0.260577634004221,
-        -0.600558677588197,
-        -0.861136311592418,
-        0.0694318442037911,
-        0.0694318442037911,
-        0.0694318442037911,
-        0.0694318442037911,
-        0.330009478208012,
-        0.330009478208012,
-        0.330009478208012,
-        0.330009478208012,
-        0.669990521791988,
-        0.669990521791988,
-        0.669990521791988,
-        0.669990521791988,
-        0.930568155796209,
-        0.930568155796209,
-        0.930568155796209,
-        0.930568155796209,
-        0.0694318442037911,
-        0.330009478208012,
-        0.669990521791988,
-        0.930568155796209,
-        0.0694318442037911,
-        0.330009478208012,
-        0.669990521791988,
-        0.930568155796209,
-        0.0694318442037911,
-        0.330009478208012,
-        0.669990521791988,
-        0.930568155796209,
-        0.0694318442037911,
-        0.330009478208012,
-        0.669990521791988,
-        0.930568155796209};
+        0.861136311592418, 0.0694318442037911, 0.0694318442037911,
+        0.600558677588197, 0.0694318442037911, 0.330009478208012,
+        0.260577634004221, 0.0694318442037911, 0.669990521791988,
+        0, 0.0694318442037911, 0.930568155796209,
+        0.600558677588197, 0.330009478208012, 0.0694318442037911,
+        0.339981043583975, 0.330009478208012, 0.330009478208012,
+        0, 0.330009478208012, 0.669990521791988,
+        -0.260577634004221, 0.330009478208012, 0.930568155796209,
+        0.260577634004221, 0.669990521791988, 0.0694318442037911,
+        0, 0.669990521791988, 0.330009478208012,
+        -0.339981043583975, 0.669990521791988, 0.669990521791988,
+        -0.600558677588197, 0.669990521791988, 0.930568155796209,
+        0, 0.930568155796209, 0.0694318442037911,
+        -0.260577634004221, 0.930568155796209, 0.330009478208012,
+        -0.600558677588197, 0.930568155796209, 0.669990521791988,
+        -0.861136311592418, 0.930568155796209, 0.930568155796209};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0302507483215824,
         0.0567129629630425,
@@ -471,81 +374,31 @@ struct GaussLegendreQuadrature<2, 5>
     inline static std::uint8_t constexpr kOrder                              = 5;
     inline static int constexpr kPoints                                      = 25;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.906179845937004,
-        0.722324578022381,
-        0.453089922968502,
-        0.183855267914623,
-        0,
-        0.722324578022381,
-        0.538469310107757,
-        0.269234655053879,
-        0,
-        -0.183855267914623,
-        0.453089922968502,
-        0.269234655053879,
-        0,
-        -0.269234655053879,
-        -0.453089922968502,
-        0.183855267914623,
-        0,
-        -0.269234655053879,
-        -0.538469310107757,
-        -0.722324578022381,
-        0,
-        -0.183855267914623,
-        -0.453089922968502,
-        -0.722324578022381,
-        -0.906179845937004,
-        0.0469100770314981,
-        0.0469100770314981,
-        0.0469100770314981,
-        0.0469100770314981,
-        0.0469100770314981,
-        0.230765344946121,
-        0.230765344946121,
-        0.230765344946121,
-        0.230765344946121,
-        0.230765344946121,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.769234655053879,
-        0.769234655053879,
-        0.769234655053879,
-        0.769234655053879,
-        0.769234655053879,
-        0.953089922968502,
-        0.953089922968502,
-        0.953089922968502,
-        0.953089922968502,
-        0.953089922968502,
-        0.0469100770314981,
-        0.230765344946121,
-        0.500000000000000,
-        0.769234655053879,
-        0.953089922968502,
-        0.0469100770314981,
-        0.230765344946121,
-        0.500000000000000,
-        0.769234655053879,
-        0.953089922968502,
-        0.0469100770314981,
-        0.230765344946121,
-        0.500000000000000,
-        0.769234655053879,
-        0.953089922968502,
-        0.0469100770314981,
-        0.230765344946121,
-        0.500000000000000,
-        0.769234655053879,
-        0.953089922968502,
-        0.0469100770314981,
-        0.230765344946121,
-        0.500000000000000,
-        0.769234655053879,
-        0.953089922968502};
+        0.906179845937004, 0.0469100770314981, 0.0469100770314981,
+        0.722324578022381, 0.0469100770314981, 0.230765344946121,
+        0.453089922968502, 0.0469100770314981, 0.500000000000000,
+        0.183855267914623, 0.0469100770314981, 0.769234655053879,
+        0, 0.0469100770314981, 0.953089922968502,
+        0.722324578022381, 0.230765344946121, 0.0469100770314981,
+        0.538469310107757, 0.230765344946121, 0.230765344946121,
+        0.269234655053879, 0.230765344946121, 0.500000000000000,
+        0, 0.230765344946121, 0.769234655053879,
+        -0.183855267914623, 0.230765344946121, 0.953089922968502,
+        0.453089922968502, 0.500000000000000, 0.0469100770314981,
+        0.269234655053879, 0.500000000000000, 0.230765344946121,
+        0, 0.500000000000000, 0.500000000000000,
+        -0.269234655053879, 0.500000000000000, 0.769234655053879,
+        -0.453089922968502, 0.500000000000000, 0.953089922968502,
+        0.183855267914623, 0.769234655053879, 0.0469100770314981,
+        0, 0.769234655053879, 0.230765344946121,
+        -0.269234655053879, 0.769234655053879, 0.500000000000000,
+        -0.538469310107757, 0.769234655053879, 0.769234655053879,
+        -0.722324578022381, 0.769234655053879, 0.953089922968502,
+        0, 0.953089922968502, 0.0469100770314981,
+        -0.183855267914623, 0.953089922968502, 0.230765344946121,
+        -0.453089922968502, 0.953089922968502, 0.500000000000000,
+        -0.722324578022381, 0.953089922968502, 0.769234655053879,
+        -0.906179845937004, 0.953089922968502, 0.953089922968502};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0140335872156042, 0.0283499999999420, 0.0336962680969896, 0.0283499999999420,
         0.0140335872156042, 0.0283499999999420, 0.0572713510557755, 0.0680716331377839,
@@ -563,114 +416,42 @@ struct GaussLegendreQuadrature<2, 6>
     inline static std::uint8_t constexpr kOrder                              = 6;
     inline static int constexpr kPoints                                      = 36;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.932469514205877,
-        0.796839450336847,
-        0.585544350144119,
-        0.346925164061759,
-        0.135630063869030,
-        0,
-        0.796839450336847,
-        0.661209386467817,
-        0.449914286275089,
-        0.211295100192729,
-        0,
-        -0.135630063869030,
-        0.585544350144119,
-        0.449914286275089,
-        0.238619186082360,
-        0,
-        -0.211295100192729,
-        -0.346925164061759,
-        0.346925164061759,
-        0.211295100192729,
-        0,
-        -0.238619186082360,
-        -0.449914286275089,
-        -0.585544350144119,
-        0.135630063869030,
-        0,
-        -0.211295100192729,
-        -0.449914286275089,
-        -0.661209386467817,
-        -0.796839450336847,
-        0,
-        -0.135630063869030,
-        -0.346925164061759,
-        -0.585544350144119,
-        -0.796839450336847,
-        -0.932469514205877,
-        0.0337652428970614,
-        0.0337652428970614,
-        0.0337652428970614,
-        0.0337652428970614,
-        0.0337652428970614,
-        0.0337652428970614,
-        0.169395306766091,
-        0.169395306766091,
-        0.169395306766091,
-        0.169395306766091,
-        0.169395306766091,
-        0.169395306766091,
-        0.380690406958820,
-        0.380690406958820,
-        0.380690406958820,
-        0.380690406958820,
-        0.380690406958820,
-        0.380690406958820,
-        0.619309593041180,
-        0.619309593041180,
-        0.619309593041180,
-        0.619309593041180,
-        0.619309593041180,
-        0.619309593041180,
-        0.830604693233909,
-        0.830604693233909,
-        0.830604693233909,
-        0.830604693233909,
-        0.830604693233909,
-        0.830604693233909,
-        0.966234757102939,
-        0.966234757102939,
-        0.966234757102939,
-        0.966234757102939,
-        0.966234757102939,
-        0.966234757102939,
-        0.0337652428970614,
-        0.169395306766091,
-        0.380690406958820,
-        0.619309593041180,
-        0.830604693233909,
-        0.966234757102939,
-        0.0337652428970614,
-        0.169395306766091,
-        0.380690406958820,
-        0.619309593041180,
-        0.830604693233909,
-        0.966234757102939,
-        0.0337652428970614,
-        0.169395306766091,
-        0.380690406958820,
-        0.619309593041180,
-        0.830604693233909,
-        0.966234757102939,
-        0.0337652428970614,
-        0.169395306766091,
-        0.380690406958820,
-        0.619309593041180,
-        0.830604693233909,
-        0.966234757102939,
-        0.0337652428970614,
-        0.169395306766091,
-        0.380690406958820,
-        0.619309593041180,
-        0.830604693233909,
-        0.966234757102939,
-        0.0337652428970614,
-        0.169395306766091,
-        0.380690406958820,
-        0.619309593041180,
-        0.830604693233909,
-        0.966234757102939};
+        0.932469514205877, 0.0337652428970614, 0.0337652428970614,
+        0.796839450336847, 0.0337652428970614, 0.169395306766091,
+        0.585544350144119, 0.0337652428970614, 0.380690406958820,
+        0.346925164061759, 0.0337652428970614, 0.619309593041180,
+        0.135630063869030, 0.0337652428970614, 0.830604693233909,
+        0, 0.0337652428970614, 0.966234757102939,
+        0.796839450336847, 0.169395306766091, 0.0337652428970614,
+        0.661209386467817, 0.169395306766091, 0.169395306766091,
+        0.449914286275089, 0.169395306766091, 0.380690406958820,
+        0.211295100192729, 0.169395306766091, 0.619309593041180,
+        0, 0.169395306766091, 0.830604693233909,
+        -0.135630063869030, 0.169395306766091, 0.966234757102939,
+        0.585544350144119, 0.380690406958820, 0.0337652428970614,
+        0.449914286275089, 0.380690406958820, 0.169395306766091,
+        0.238619186082360, 0.380690406958820, 0.380690406958820,
+        0, 0.380690406958820, 0.619309593041180,
+        -0.211295100192729, 0.380690406958820, 0.830604693233909,
+        -0.346925164061759, 0.380690406958820, 0.966234757102939,
+        0.346925164061759, 0.619309593041180, 0.0337652428970614,
+        0.211295100192729, 0.619309593041180, 0.169395306766091,
+        0, 0.619309593041180, 0.380690406958820,
+        -0.238619186082360, 0.619309593041180, 0.619309593041180,
+        -0.449914286275089, 0.619309593041180, 0.830604693233909,
+        -0.585544350144119, 0.619309593041180, 0.966234757102939,
+        0.135630063869030, 0.830604693233909, 0.0337652428970614,
+        0, 0.830604693233909, 0.169395306766091,
+        -0.211295100192729, 0.830604693233909, 0.380690406958820,
+        -0.449914286275089, 0.830604693233909, 0.619309593041180,
+        -0.661209386467817, 0.830604693233909, 0.830604693233909,
+        -0.796839450336847, 0.830604693233909, 0.966234757102939,
+        0, 0.966234757102939, 0.0337652428970614,
+        -0.135630063869030, 0.966234757102939, 0.169395306766091,
+        -0.346925164061759, 0.966234757102939, 0.380690406958820,
+        -0.585544350144119, 0.966234757102939, 0.619309593041180,
+        -0.796839450336847, 0.966234757102939, 0.830604693233909,
+        -0.932469514205877, 0.966234757102939, 0.966234757102939};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.00733802042226703, 0.0154518233430726,  0.0200412793294391,  0.0200412793294391,
         0.0154518233430726,  0.00733802042226703, 0.0154518233430726,  0.0325372281468468,
@@ -690,153 +471,55 @@ struct GaussLegendreQuadrature<2, 7>
     inline static std::uint8_t constexpr kOrder                              = 7;
     inline static int constexpr kPoints                                      = 49;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.949107912339969,
-        0.845319548971020,
-        0.677476531858701,
-        0.474553956169984,
-        0.271631380481267,
-        0.103788363368949,
-        0,
-        0.845319548971020,
-        0.741531185602071,
-        0.573688168489753,
-        0.370765592801035,
-        0.167843017112318,
-        0,
-        -0.103788363368949,
-        0.677476531858701,
-        0.573688168489753,
-        0.405845151377434,
-        0.202922575688717,
-        0,
-        -0.167843017112318,
-        -0.271631380481267,
-        0.474553956169984,
-        0.370765592801035,
-        0.202922575688717,
-        0,
-        -0.202922575688717,
-        -0.370765592801035,
-        -0.474553956169984,
-        0.271631380481267,
-        0.167843017112318,
-        0,
-        -0.202922575688717,
-        -0.405845151377434,
-        -0.573688168489753,
-        -0.677476531858701,
-        0.103788363368949,
-        0,
-        -0.167843017112318,
-        -0.370765592801035,
-        -0.573688168489753,
-        -0.741531185602071,
-        -0.845319548971020,
-        0,
-        -0.103788363368949,
-        -0.271631380481267,
-        -0.474553956169984,
-        -0.677476531858701,
-        -0.845319548971020,
-        -0.949107912339969,
-        0.0254460438300157,
-        0.0254460438300157,
-        0.0254460438300157,
-        0.0254460438300157,
-        0.0254460438300157,
-        0.0254460438300157,
-        0.0254460438300157,
-        0.129234407198965,
-        0.129234407198965,
-        0.129234407198965,
-        0.129234407198965,
-        0.129234407198965,
-        0.129234407198965,
-        0.129234407198965,
-        0.297077424311283,
-        0.297077424311283,
-        0.297077424311283,
-        0.297077424311283,
-        0.297077424311283,
-        0.297077424311283,
-        0.297077424311283,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.702922575688717,
-        0.702922575688717,
-        0.702922575688717,
-        0.702922575688717,
-        0.702922575688717,
-        0.702922575688717,
-        0.702922575688717,
-        0.870765592801035,
-        0.870765592801035,
-        0.870765592801035,
-        0.870765592801035,
-        0.870765592801035,
-        0.870765592801035,
-        0.870765592801035,
-        0.974553956169984,
-        0.974553956169984,
-        0.974553956169984,
-        0.974553956169984,
-        0.974553956169984,
-        0.974553956169984,
-        0.974553956169984,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984,
-        0.0254460438300157,
-        0.129234407198965,
-        0.297077424311283,
-        0.500000000000000,
-        0.702922575688717,
-        0.870765592801035,
-        0.974553956169984};
+        0.949107912339969, 0.0254460438300157, 0.0254460438300157,
+        0.845319548971020, 0.0254460438300157, 0.129234407198965,
+        0.677476531858701, 0.0254460438300157, 0.297077424311283,
+        0.474553956169984, 0.0254460438300157, 0.500000000000000,
+        0.271631380481267, 0.0254460438300157, 0.702922575688717,
+        0.103788363368949, 0.0254460438300157, 0.870765592801035,
+        0, 0.0254460438300157, 0.974553956169984,
+        0.845319548971020, 0.129234407198965, 0.0254460438300157,
+        0.741531185602071, 0.129234407198965, 0.129234407198965,
+        0.573688168489753, 0.129234407198965, 0.297077424311283,
+        0.370765592801035, 0.129234407198965, 0.500000000000000,
+        0.167843017112318, 0.129234407198965, 0.702922575688717,
+        0, 0.129234407198965, 0.870765592801035,
+        -0.103788363368949, 0.129234407198965, 0.974553956169984,
+        0.677476531858701, 0.297077424311283, 0.0254460438300157,
+        0.573688168489753, 0.297077424311283, 0.129234407198965,
+        0.405845151377434, 0.297077424311283, 0.297077424311283,
+        0.202922575688717, 0.297077424311283, 0.500000000000000,
+        0, 0.297077424311283, 0.702922575688717,
+        -0.167843017112318, 0.297077424311283, 0.870765592801035,
+        -0.271631380481267, 0.297077424311283, 0.974553956169984,
+        0.474553956169984, 0.500000000000000, 0.0254460438300157,
+        0.370765592801035, 0.500000000000000, 0.129234407198965,
+        0.202922575688717, 0.500000000000000, 0.297077424311283,
+        0, 0.500000000000000, 0.500000000000000,
+        -0.202922575688717, 0.500000000000000, 0.702922575688717,
+        -0.370765592801035, 0.500000000000000, 0.870765592801035,
+        -0.474553956169984, 0.500000000000000, 0.974553956169984,
+        0.271631380481267, 0.702922575688717, 0.0254460438300157,
+        0.167843017112318, 0.702922575688717, 0.129234407198965,
+        0, 0.702922575688717, 0.297077424311283,
+        -0.202922575688717, 0.702922575688717, 0.500000000000000,
+        -0.405845151377434, 0.702922575688717, 0.702922575688717,
+        -0.573688168489753, 0.702922575688717, 0.870765592801035,
+        -0.677476531858701, 0.702922575688717, 0.974553956169984,
+        0.103788363368949, 0.870765592801035, 0.0254460438300157,
+        0, 0.870765592801035, 0.129234407198965,
+        -0.167843017112318, 0.870765592801035, 0.297077424311283,
+        -0.370765592801035, 0.870765592801035, 0.500000000000000,
+        -0.573688168489753, 0.870765592801035, 0.702922575688717,
+        -0.741531185602071, 0.870765592801035, 0.870765592801035,
+        -0.845319548971020, 0.870765592801035, 0.974553956169984,
+        0, 0.974553956169984, 0.0254460438300157,
+        -0.103788363368949, 0.974553956169984, 0.129234407198965,
+        -0.271631380481267, 0.974553956169984, 0.297077424311283,
+        -0.474553956169984, 0.974553956169984, 0.500000000000000,
+        -0.677476531858701, 0.974553956169984, 0.702922575688717,
+        -0.845319548971020, 0.974553956169984, 0.870765592801035,
+        -0.949107912339969, 0.974553956169984, 0.974553956169984};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.00419158911600580, 0.00905441078857096, 0.0123603127930579,  0.0135298576895689,
         0.0123603127930579,  0.00905441078857096, 0.00419158911600580, 0.00905441078857096,
@@ -860,198 +543,70 @@ struct GaussLegendreQuadrature<2, 8>
     inline static std::uint8_t constexpr kOrder                              = 8;
     inline static int constexpr kPoints                                      = 64;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.960289856499003,
-        0.878478166956484,
-        0.742911133205780,
-        0.571862249496917,
-        0.388427607002086,
-        0.217378723293223,
-        0.0818116895425192,
-        0,
-        0.878478166956484,
-        0.796666477413964,
-        0.661099443663261,
-        0.490050559954398,
-        0.306615917459567,
-        0.135567033750704,
-        0,
-        -0.0818116895425192,
-        0.742911133205780,
-        0.661099443663261,
-        0.525532409912557,
-        0.354483526203694,
-        0.171048883708863,
-        0,
-        -0.135567033750704,
-        -0.217378723293223,
-        0.571862249496917,
-        0.490050559954398,
-        0.354483526203694,
-        0.183434642494831,
-        0,
-        -0.171048883708863,
-        -0.306615917459567,
-        -0.388427607002086,
-        0.388427607002086,
-        0.306615917459567,
-        0.171048883708863,
-        0,
-        -0.183434642494831,
-        -0.354483526203694,
-        -0.490050559954398,
-        -0.571862249496917,
-        0.217378723293223,
-        0.135567033750704,
-        0,
-        -0.171048883708863,
-        -0.354483526203694,
-        -0.525532409912557,
-        -0.661099443663261,
-        -0.742911133205780,
-        0.0818116895425192,
-        0,
-        -0.135567033750704,
-        -0.306615917459567,
-        -0.490050559954398,
-        -0.661099443663261,
-        -0.796666477413964,
-        -0.878478166956484,
-        0,
-        -0.0818116895425192,
-        -0.217378723293223,
-        -0.388427607002086,
-        -0.571862249496917,
-        -0.742911133205780,
-        -0.878478166956484,
-        -0.960289856499003,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.0198550717504986,
-        0.101666761293018,
-        0.101666761293018,
-        0.101666761293018,
-        0.101666761293018,
-        0.101666761293018,
-        0.101666761293018,
-        0.101666761293018,
-        0.101666761293018,
-        0.237233795043721,
-        0.237233795043721,
-        0.237233795043721,
-        0.237233795043721,
-        0.237233795043721,
-        0.237233795043721,
-        0.237233795043721,
-        0.237233795043721,
-        0.408282678752585,
-        0.408282678752585,
-        0.408282678752585,
-        0.408282678752585,
-        0.408282678752585,
-        0.408282678752585,
-        0.408282678752585,
-        0.408282678752585,
-        0.591717321247415,
-        0.591717321247415,
-        0.591717321247415,
-        0.591717321247415,
-        0.591717321247415,
-        0.591717321247415,
-        0.591717321247415,
-        0.591717321247415,
-        0.762766204956279,
-        0.762766204956279,
-        0.762766204956279,
-        0.762766204956279,
-        0.762766204956279,
-        0.762766204956279,
-        0.762766204956279,
-        0.762766204956279,
-        0.898333238706982,
-        0.898333238706982,
-        0.898333238706982,
-        0.898333238706982,
-        0.898333238706982,
-        0.898333238706982,
-        0.898333238706982,
-        0.898333238706982,
-        0.980144928249501,
-        0.980144928249501,
-        0.980144928249501,
-        0.980144928249501,
-        0.980144928249501,
-        0.980144928249501,
-        0.980144928249501,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501,
-        0.0198550717504986,
-        0.101666761293018,
-        0.237233795043721,
-        0.408282678752585,
-        0.591717321247415,
-        0.762766204956279,
-        0.898333238706982,
-        0.980144928249501};
+        0.960289856499003, 0.0198550717504986, 0.0198550717504986,
+        0.878478166956484, 0.0198550717504986, 0.101666761293018,
+        0.742911133205780, 0.0198550717504986, 0.237233795043721,
+        0.571862249496917, 0.0198550717504986, 0.408282678752585,
+        0.388427607002086, 0.0198550717504986, 0.591717321247415,
+        0.217378723293223, 0.0198550717504986, 0.762766204956279,
+        0.0818116895425192, 0.0198550717504986, 0.898333238706982,
+        0, 0.0198550717504986, 0.980144928249501,
+        0.878478166956484, 0.101666761293018, 0.0198550717504986,
+        0.796666477413964, 0.101666761293018, 0.101666761293018,
+        0.661099443663261, 0.101666761293018, 0.237233795043721,
+        0.490050559954398, 0.101666761293018, 0.408282678752585,
+        0.306615917459567, 0.101666761293018, 0.591717321247415,
+        0.135567033750704, 0.101666761293018, 0.762766204956279,
+        0, 0.101666761293018, 0.898333238706982,
+        -0.0818116895425192, 0.101666761293018, 0.980144928249501,
+        0.742911133205780, 0.237233795043721, 0.0198550717504986,
+        0.661099443663261, 0.237233795043721, 0.101666761293018,
+        0.525532409912557, 0.237233795043721, 0.237233795043721,
+        0.354483526203694, 0.237233795043721, 0.408282678752585,
+        0.171048883708863, 0.237233795043721, 0.591717321247415,
+        0, 0.237233795043721, 0.762766204956279,
+        -0.135567033750704, 0.237233795043721, 0.898333238706982,
+        -0.217378723293223, 0.237233795043721, 0.980144928249501,
+        0.571862249496917, 0.408282678752585, 0.0198550717504986,
+        0.490050559954398, 0.408282678752585, 0.101666761293018,
+        0.354483526203694, 0.408282678752585, 0.237233795043721,
+        0.183434642494831, 0.408282678752585, 0.408282678752585,
+        0, 0.408282678752585, 0.591717321247415,
+        -0.171048883708863, 0.408282678752585, 0.762766204956279,
+        -0.306615917459567, 0.408282678752585, 0.898333238706982,
+        -0.388427607002086, 0.408282678752585, 0.980144928249501,
+        0.388427607002086, 0.591717321247415, 0.0198550717504986,
+        0.306615917459567, 0.591717321247415, 0.101666761293018,
+        0.171048883708863, 0.591717321247415, 0.237233795043721,
+        0, 0.591717321247415, 0.408282678752585,
+        -0.183434642494831, 0.591717321247415, 0.591717321247415,
+        -0.354483526203694, 0.591717321247415, 0.762766204956279,
+        -0.490050559954398, 0.591717321247415, 0.898333238706982,
+        -0.571862249496917, 0.591717321247415, 0.980144928249501,
+        0.217378723293223, 0.762766204956279, 0.0198550717504986,
+        0.135567033750704, 0.762766204956279, 0.101666761293018,
+        0, 0.762766204956279, 0.237233795043721,
+        -0.171048883708863, 0.762766204956279, 0.408282678752585,
+        -0.354483526203694, 0.762766204956279, 0.591717321247415,
+        -0.525532409912557, 0.762766204956279, 0.762766204956279,
+        -0.661099443663261, 0.762766204956279, 0.898333238706982,
+        -0.742911133205780, 0.762766204956279, 0.980144928249501,
+        0.0818116895425192, 0.898333238706982, 0.0198550717504986,
+        0, 0.898333238706982, 0.101666761293018,
+        -0.135567033750704, 0.898333238706982, 0.237233795043721,
+        -0.306615917459567, 0.898333238706982, 0.408282678752585,
+        -0.490050559954398, 0.898333238706982, 0.591717321247415,
+        -0.661099443663261, 0.898333238706982, 0.762766204956279,
+        -0.796666477413964, 0.898333238706982, 0.898333238706982,
+        -0.878478166956484, 0.898333238706982, 0.980144928249501,
+        0, 0.980144928249501, 0.0198550717504986,
+        -0.0818116895425192, 0.980144928249501, 0.101666761293018,
+        -0.217378723293223, 0.980144928249501, 0.237233795043721,
+        -0.388427607002086, 0.980144928249501, 0.408282678752585,
+        -0.571862249496917, 0.980144928249501, 0.591717321247415,
+        -0.742911133205780, 0.980144928249501, 0.762766204956279,
+        -0.878478166956484, 0.980144928249501, 0.898333238706982,
+        -0.960289856499003, 0.980144928249501, 0.980144928249501};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.00256180413982635, 0.00562782665405462, 0.00793901614659223, 0.00917848713186740,
         0.00917848713186740, 0.00793901614659223, 0.00562782665405462, 0.00256180413982635,
@@ -1078,249 +633,87 @@ struct GaussLegendreQuadrature<2, 9>
     inline static std::uint8_t constexpr kOrder                              = 9;
     inline static int constexpr kPoints                                      = 81;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.968160239506688,
-        0.902095673416625,
-        0.790765836103674,
-        0.646206831455856,
-        0.484080119753344,
-        0.321953408050831,
-        0.177394403403014,
-        0.0660645660900627,
-        0,
-        0.902095673416625,
-        0.836031107326562,
-        0.724701270013611,
-        0.580142265365794,
-        0.418015553663281,
-        0.255888841960768,
-        0.111329837312951,
-        0,
-        -0.0660645660900627,
-        0.790765836103674,
-        0.724701270013611,
-        0.613371432700660,
-        0.468812428052843,
-        0.306685716350330,
-        0.144559004647817,
-        0,
-        -0.111329837312951,
-        -0.177394403403014,
-        0.646206831455856,
-        0.580142265365794,
-        0.468812428052843,
-        0.324253423405025,
-        0.162126711702513,
-        0,
-        -0.144559004647817,
-        -0.255888841960768,
-        -0.321953408050831,
-        0.484080119753344,
-        0.418015553663281,
-        0.306685716350330,
-        0.162126711702513,
-        0,
-        -0.162126711702513,
-        -0.306685716350330,
-        -0.418015553663281,
-        -0.484080119753344,
-        0.321953408050831,
-        0.255888841960768,
-        0.144559004647817,
-        0,
-        -0.162126711702513,
-        -0.324253423405025,
-        -0.468812428052843,
-        -0.580142265365794,
-        -0.646206831455856,
-        0.177394403403014,
-        0.111329837312951,
-        0,
-        -0.144559004647817,
-        -0.306685716350330,
-        -0.468812428052843,
-        -0.613371432700660,
-        -0.724701270013611,
-        -0.790765836103674,
-        0.0660645660900627,
-        0,
-        -0.111329837312951,
-        -0.255888841960768,
-        -0.418015553663281,
-        -0.580142265365794,
-        -0.724701270013611,
-        -0.836031107326562,
-        -0.902095673416625,
-        0,
-        -0.0660645660900627,
-        -0.177394403403014,
-        -0.321953408050831,
-        -0.484080119753344,
-        -0.646206831455856,
-        -0.790765836103674,
-        -0.902095673416625,
-        -0.968160239506688,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.0819844463367190,
-        0.193314283649670,
-        0.193314283649670,
-        0.193314283649670,
-        0.193314283649670,
-        0.193314283649670,
-        0.193314283649670,
-        0.193314283649670,
-        0.193314283649670,
-        0.193314283649670,
-        0.337873288297487,
-        0.337873288297487,
-        0.337873288297487,
-        0.337873288297487,
-        0.337873288297487,
-        0.337873288297487,
-        0.337873288297487,
-        0.337873288297487,
-        0.337873288297487,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.500000000000000,
-        0.662126711702513,
-        0.662126711702513,
-        0.662126711702513,
-        0.662126711702513,
-        0.662126711702513,
-        0.662126711702513,
-        0.662126711702513,
-        0.662126711702513,
-        0.662126711702513,
-        0.806685716350330,
-        0.806685716350330,
-        0.806685716350330,
-        0.806685716350330,
-        0.806685716350330,
-        0.806685716350330,
-        0.806685716350330,
-        0.806685716350330,
-        0.806685716350330,
-        0.918015553663281,
-        0.918015553663281,
-        0.918015553663281,
-        0.918015553663281,
-        0.918015553663281,
-        0.918015553663281,
-        0.918015553663281,
-        0.918015553663281,
-        0.918015553663281,
-        0.984080119753344,
-        0.984080119753344,
-        0.984080119753344,
-        0.984080119753344,
-        0.984080119753344,
-        0.984080119753344,
-        0.984080119753344,
-        0.984080119753344,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344,
-        0.0159198802466562,
-        0.0819844463367190,
-        0.193314283649670,
-        0.337873288297487,
-        0.500000000000000,
-        0.662126711702513,
-        0.806685716350330,
-        0.918015553663281,
-        0.984080119753344};
+        0.968160239506688, 0.0159198802466562, 0.0159198802466562,
+        0.902095673416625, 0.0159198802466562, 0.0819844463367190,
+        0.790765836103674, 0.0159198802466562, 0.193314283649670,
+        0.646206831455856, 0.0159198802466562, 0.337873288297487,
+        0.484080119753344, 0.0159198802466562, 0.500000000000000,
+        0.321953408050831, 0.0159198802466562, 0.662126711702513,
+        0.177394403403014, 0.0159198802466562, 0.806685716350330,
+        0.0660645660900627, 0.0159198802466562, 0.918015553663281,
+        0, 0.0159198802466562, 0.984080119753344,
+        0.902095673416625, 0.0819844463367190, 0.0159198802466562,
+        0.836031107326562, 0.0819844463367190, 0.0819844463367190,
+        0.724701270013611, 0.0819844463367190, 0.193314283649670,
+        0.580142265365794, 0.0819844463367190, 0.337873288297487,
+        0.418015553663281, 0.0819844463367190, 0.500000000000000,
+        0.255888841960768, 0.0819844463367190, 0.662126711702513,
+        0.111329837312951, 0.0819844463367190, 0.806685716350330,
+        0, 0.0819844463367190, 0.918015553663281,
+        -0.0660645660900627, 0.0819844463367190, 0.984080119753344,
+        0.790765836103674, 0.193314283649670, 0.0159198802466562,
+        0.724701270013611, 0.193314283649670, 0.0819844463367190,
+        0.613371432700660, 0.193314283649670, 0.193314283649670,
+        0.468812428052843, 0.193314283649670, 0.337873288297487,
+        0.306685716350330, 0.193314283649670, 0.500000000000000,
+        0.144559004647817, 0.193314283649670, 0.662126711702513,
+        0, 0.193314283649670, 0.806685716350330,
+        -0.111329837312951, 0.193314283649670, 0.918015553663281,
+        -0.177394403403014, 0.193314283649670, 0.984080119753344,
+        0.646206831455856, 0.337873288297487, 0.0159198802466562,
+        0.580142265365794, 0.337873288297487, 0.0819844463367190,
+        0.468812428052843, 0.337873288297487, 0.193314283649670,
+        0.324253423405025, 0.337873288297487, 0.337873288297487,
+        0.162126711702513, 0.337873288297487, 0.500000000000000,
+        0, 0.337873288297487, 0.662126711702513,
+        -0.144559004647817, 0.337873288297487, 0.806685716350330,
+        -0.255888841960768, 0.337873288297487, 0.918015553663281,
+        -0.321953408050831, 0.337873288297487, 0.984080119753344,
+        0.484080119753344, 0.500000000000000, 0.0159198802466562,
+        0.418015553663281, 0.500000000000000, 0.0819844463367190,
+        0.306685716350330, 0.500000000000000, 0.193314283649670,
+        0.162126711702513, 0.500000000000000, 0.337873288297487,
+        0, 0.500000000000000, 0.500000000000000,
+        -0.162126711702513, 0.500000000000000, 0.662126711702513,
+        -0.306685716350330, 0.500000000000000, 0.806685716350330,
+        -0.418015553663281, 0.500000000000000, 0.918015553663281,
+        -0.484080119753344, 0.500000000000000, 0.984080119753344,
+        0.321953408050831, 0.662126711702513, 0.0159198802466562,
+        0.255888841960768, 0.662126711702513, 0.0819844463367190,
+        0.144559004647817, 0.662126711702513, 0.193314283649670,
+        0, 0.662126711702513, 0.337873288297487,
+        -0.162126711702513, 0.662126711702513, 0.500000000000000,
+        -0.324253423405025, 0.662126711702513, 0.662126711702513,
+        -0.468812428052843, 0.662126711702513, 0.806685716350330,
+        -0.580142265365794, 0.662126711702513, 0.918015553663281,
+        -0.646206831455856, 0.662126711702513, 0.984080119753344,
+        0.177394403403014, 0.806685716350330, 0.0159198802466562,
+        0.111329837312951, 0.806685716350330, 0.0819844463367190,
+        0, 0.806685716350330, 0.193314283649670,
+        -0.144559004647817, 0.806685716350330, 0.337873288297487,
+        -0.306685716350330, 0.806685716350330, 0.500000000000000,
+        -0.468812428052843, 0.806685716350330, 0.662126711702513,
+        -0.613371432700660, 0.806685716350330, 0.806685716350330,
+        -0.724701270013611, 0.806685716350330, 0.918015553663281,
+        -0.790765836103674, 0.806685716350330, 0.984080119753344,
+        0.0660645660900627, 0.918015553663281, 0.0159198802466562,
+        0, 0.918015553663281, 0.0819844463367190,
+        -0.111329837312951, 0.918015553663281, 0.193314283649670,
+        -0.255888841960768, 0.918015553663281, 0.337873288297487,
+        -0.418015553663281, 0.918015553663281, 0.500000000000000,
+        -0.580142265365794, 0.918015553663281, 0.662126711702513,
+        -0.724701270013611, 0.918015553663281, 0.806685716350330,
+        -0.836031107326562, 0.918015553663281, 0.918015553663281,
+        -0.902095673416625, 0.918015553663281, 0.984080119753344,
+        0, 0.984080119753344, 0.0159198802466562,
+        -0.0660645660900627, 0.984080119753344, 0.0819844463367190,
+        -0.177394403403014, 0.984080119753344, 0.193314283649670,
+        -0.321953408050831, 0.984080119753344, 0.337873288297487,
+        -0.484080119753344, 0.984080119753344, 0.500000000000000,
+        -0.646206831455856, 0.984080119753344, 0.662126711702513,
+        -0.790765836103674, 0.984080119753344, 0.806685716350330,
+        -0.902095673416625, 0.984080119753344, 0.918015553663281,
+        -0.968160239506688, 0.984080119753344, 0.984080119753344};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.00165138155088946, 0.00367051719227588, 0.00529524373762829, 0.00634645441075507,
         0.00671000039764614, 0.00634645441075507, 0.00529524373762829, 0.00367051719227588,
@@ -1352,306 +745,106 @@ struct GaussLegendreQuadrature<2, 10>
     inline static std::uint8_t constexpr kOrder                              = 10;
     inline static int constexpr kPoints                                      = 100;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.973906528517546,
-        0.919484947604360,
-        0.826658048408717,
-        0.703650961322637,
-        0.561390433749693,
-        0.412516094767852,
-        0.270255567194909,
-        0.147248480108829,
-        0.0544215809131856,
-        0,
-        0.919484947604360,
-        0.865063366691174,
-        0.772236467495532,
-        0.649229380409452,
-        0.506968852836508,
-        0.358094513854667,
-        0.215833986281723,
-        0.0928268991956429,
-        0,
-        -0.0544215809131856,
-        0.826658048408717,
-        0.772236467495532,
-        0.679409568299889,
-        0.556402481213809,
-        0.414141953640865,
-        0.265267614659024,
-        0.123007087086080,
-        0,
-        -0.0928268991956429,
-        -0.147248480108829,
-        0.703650961322637,
-        0.649229380409452,
-        0.556402481213809,
-        0.433395394127729,
-        0.291134866554785,
-        0.142260527572944,
-        0,
-        -0.123007087086080,
-        -0.215833986281723,
-        -0.270255567194909,
-        0.561390433749693,
-        0.506968852836508,
-        0.414141953640865,
-        0.291134866554785,
-        0.148874338981841,
-        0,
-        -0.142260527572944,
-        -0.265267614659024,
-        -0.358094513854667,
-        -0.412516094767852,
-        0.412516094767852,
-        0.358094513854667,
-        0.265267614659024,
-        0.142260527572944,
-        0,
-        -0.148874338981841,
-        -0.291134866554785,
-        -0.414141953640865,
-        -0.506968852836508,
-        -0.561390433749693,
-        0.270255567194909,
-        0.215833986281723,
-        0.123007087086080,
-        0,
-        -0.142260527572944,
-        -0.291134866554785,
-        -0.433395394127729,
-        -0.556402481213809,
-        -0.649229380409452,
-        -0.703650961322637,
-        0.147248480108829,
-        0.0928268991956429,
-        0,
-        -0.123007087086080,
-        -0.265267614659024,
-        -0.414141953640865,
-        -0.556402481213809,
-        -0.679409568299889,
-        -0.772236467495532,
-        -0.826658048408717,
-        0.0544215809131856,
-        0,
-        -0.0928268991956429,
-        -0.215833986281723,
-        -0.358094513854667,
-        -0.506968852836508,
-        -0.649229380409452,
-        -0.772236467495532,
-        -0.865063366691174,
-        -0.919484947604360,
-        0,
-        -0.0544215809131856,
-        -0.147248480108829,
-        -0.270255567194909,
-        -0.412516094767852,
-        -0.561390433749693,
-        -0.703650961322637,
-        -0.826658048408717,
-        -0.919484947604360,
-        -0.973906528517546,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.0674683166544128,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.160295215850056,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.283302302936136,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.425562830509080,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.574437169490920,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.716697697063864,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.839704784149944,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.932531683345587,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773,
-        0.0130467357412272,
-        0.0674683166544128,
-        0.160295215850056,
-        0.283302302936136,
-        0.425562830509080,
-        0.574437169490920,
-        0.716697697063864,
-        0.839704784149944,
-        0.932531683345587,
-        0.986953264258773};
+        0.973906528517546, 0.0130467357412272, 0.0130467357412272,
+        0.919484947604360, 0.0130467357412272, 0.0674683166544128,
+        0.826658048408717, 0.0130467357412272, 0.160295215850056,
+        0.703650961322637, 0.0130467357412272, 0.283302302936136,
+        0.561390433749693, 0.0130467357412272, 0.425562830509080,
+        0.412516094767852, 0.0130467357412272, 0.574437169490920,
+        0.270255567194909, 0.0130467357412272, 0.716697697063864,
+        0.147248480108829, 0.0130467357412272, 0.839704784149944,
+        0.0544215809131856, 0.0130467357412272, 0.932531683345587,
+        0, 0.0130467357412272, 0.986953264258773,
+        0.919484947604360, 0.0674683166544128, 0.0130467357412272,
+        0.865063366691174, 0.0674683166544128, 0.0674683166544128,
+        0.772236467495532, 0.0674683166544128, 0.160295215850056,
+        0.649229380409452, 0.0674683166544128, 0.283302302936136,
+        0.506968852836508, 0.0674683166544128, 0.425562830509080,
+        0.358094513854667, 0.0674683166544128, 0.574437169490920,
+        0.215833986281723, 0.0674683166544128, 0.716697697063864,
+        0.0928268991956429, 0.0674683166544128, 0.839704784149944,
+        0, 0.0674683166544128, 0.932531683345587,
+        -0.0544215809131856, 0.0674683166544128, 0.986953264258773,
+        0.826658048408717, 0.160295215850056, 0.0130467357412272,
+        0.772236467495532, 0.160295215850056, 0.0674683166544128,
+        0.679409568299889, 0.160295215850056, 0.160295215850056,
+        0.556402481213809, 0.160295215850056, 0.283302302936136,
+        0.414141953640865, 0.160295215850056, 0.425562830509080,
+        0.265267614659024, 0.160295215850056, 0.574437169490920,
+        0.123007087086080, 0.160295215850056, 0.716697697063864,
+        0, 0.160295215850056, 0.839704784149944,
+        -0.0928268991956429, 0.160295215850056, 0.932531683345587,
+        -0.147248480108829, 0.160295215850056, 0.986953264258773,
+        0.703650961322637, 0.283302302936136, 0.0130467357412272,
+        0.649229380409452, 0.283302302936136, 0.0674683166544128,
+        0.556402481213809, 0.283302302936136, 0.160295215850056,
+        0.433395394127729, 0.283302302936136, 0.283302302936136,
+        0.291134866554785, 0.283302302936136, 0.425562830509080,
+        0.142260527572944, 0.283302302936136, 0.574437169490920,
+        0, 0.283302302936136, 0.716697697063864,
+        -0.123007087086080, 0.283302302936136, 0.839704784149944,
+        -0.215833986281723, 0.283302302936136, 0.932531683345587,
+        -0.270255567194909, 0.283302302936136, 0.986953264258773,
+        0.561390433749693, 0.425562830509080, 0.0130467357412272,
+        0.506968852836508, 0.425562830509080, 0.0674683166544128,
+        0.414141953640865, 0.425562830509080, 0.160295215850056,
+        0.291134866554785, 0.425562830509080, 0.283302302936136,
+        0.148874338981841, 0.425562830509080, 0.425562830509080,
+        0, 0.425562830509080, 0.574437169490920,
+        -0.142260527572944, 0.425562830509080, 0.716697697063864,
+        -0.265267614659024, 0.425562830509080, 0.839704784149944,
+        -0.358094513854667, 0.425562830509080, 0.932531683345587,
+        -0.412516094767852, 0.425562830509080, 0.986953264258773,
+        0.412516094767852, 0.574437169490920, 0.0130467357412272,
+        0.358094513854667, 0.574437169490920, 0.0674683166544128,
+        0.265267614659024, 0.574437169490920, 0.160295215850056,
+        0.142260527572944, 0.574437169490920, 0.283302302936136,
+        0, 0.574437169490920, 0.425562830509080,
+        -0.148874338981841, 0.574437169490920, 0.574437169490920,
+        -0.291134866554785, 0.574437169490920, 0.716697697063864,
+        -0.414141953640865, 0.574437169490920, 0.839704784149944,
+        -0.506968852836508, 0.574437169490920, 0.932531683345587,
+        -0.561390433749693, 0.574437169490920, 0.986953264258773,
+        0.270255567194909, 0.716697697063864, 0.0130467357412272,
+        0.215833986281723, 0.716697697063864, 0.0674683166544128,
+        0.123007087086080, 0.716697697063864, 0.160295215850056,
+        0, 0.716697697063864, 0.283302302936136,
+        -0.142260527572944, 0.716697697063864, 0.425562830509080,
+        -0.291134866554785, 0.716697697063864, 0.574437169490920,
+        -0.433395394127729, 0.716697697063864, 0.716697697063864,
+        -0.556402481213809, 0.716697697063864, 0.839704784149944,
+        -0.649229380409452, 0.716697697063864, 0.932531683345587,
+        -0.703650961322637, 0.716697697063864, 0.986953264258773,
+        0.147248480108829, 0.839704784149944, 0.0130467357412272,
+        0.0928268991956429, 0.839704784149944, 0.0674683166544128,
+        0, 0.839704784149944, 0.160295215850056,
+        -0.123007087086080, 0.839704784149944, 0.283302302936136,
+        -0.265267614659024, 0.839704784149944, 0.425562830509080,
+        -0.414141953640865, 0.839704784149944, 0.574437169490920,
+        -0.556402481213809, 0.839704784149944, 0.716697697063864,
+        -0.679409568299889, 0.839704784149944, 0.839704784149944,
+        -0.772236467495532, 0.839704784149944, 0.932531683345587,
+        -0.826658048408717, 0.839704784149944, 0.986953264258773,
+        0.0544215809131856, 0.932531683345587, 0.0130467357412272,
+        0, 0.932531683345587, 0.0674683166544128,
+        -0.0928268991956429, 0.932531683345587, 0.160295215850056,
+        -0.215833986281723, 0.932531683345587, 0.283302302936136,
+        -0.358094513854667, 0.932531683345587, 0.425562830509080,
+        -0.506968852836508, 0.932531683345587, 0.574437169490920,
+        -0.649229380409452, 0.932531683345587, 0.716697697063864,
+        -0.772236467495532, 0.932531683345587, 0.839704784149944,
+        -0.865063366691174, 0.932531683345587, 0.932531683345587,
+        -0.919484947604360, 0.932531683345587, 0.986953264258773,
+        0, 0.986953264258773, 0.0130467357412272,
+        -0.0544215809131856, 0.986953264258773, 0.0674683166544128,
+        -0.147248480108829, 0.986953264258773, 0.160295215850056,
+        -0.270255567194909, 0.986953264258773, 0.283302302936136,
+        -0.412516094767852, 0.986953264258773, 0.425562830509080,
+        -0.561390433749693, 0.986953264258773, 0.574437169490920,
+        -0.703650961322637, 0.986953264258773, 0.716697697063864,
+        -0.826658048408717, 0.986953264258773, 0.839704784149944,
+        -0.919484947604360, 0.986953264258773, 0.932531683345587,
+        -0.973906528517546, 0.986953264258773, 0.986953264258773};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.00111126703798616, 0.00249103058916075, 0.00365169557717529, 0.00448809353852918,
         0.00492574933439800, 0.00492574933439800, 0.00448809353852918, 0.00365169557717529,
@@ -1686,8 +879,8 @@ struct GaussLegendreQuadrature<3, 1>
     inline static std::uint8_t constexpr kDims  = 3;
     inline static std::uint8_t constexpr kOrder = 1;
     inline static int constexpr kPoints         = 1;
-    inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points =
-        {-0.500000000000000, 0.500000000000000, 0.500000000000000, 0.500000000000000};
+    inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
+        -0.500000000000000, 0.500000000000000, 0.500000000000000, 0.500000000000000};
     inline static std::array<Scalar, kPoints> constexpr weights = {1.00000000000000};
 };
 
@@ -1698,14 +891,14 @@ struct GaussLegendreQuadrature<3, 2>
     inline static std::uint8_t constexpr kOrder                              = 2;
     inline static int constexpr kPoints                                      = 8;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.366025403782260,  -0.211324865405913, -0.211324865405913, -0.788675134594087,
-        -0.211324865405913, -0.788675134594087, -0.788675134594087, -1.36602540378226,
-        0.211324865405913,  0.211324865405913,  0.211324865405913,  0.211324865405913,
-        0.788675134594087,  0.788675134594087,  0.788675134594087,  0.788675134594087,
-        0.211324865405913,  0.211324865405913,  0.788675134594087,  0.788675134594087,
-        0.211324865405913,  0.211324865405913,  0.788675134594087,  0.788675134594087,
-        0.211324865405913,  0.788675134594087,  0.211324865405913,  0.788675134594087,
-        0.211324865405913,  0.788675134594087,  0.211324865405913,  0.788675134594087};
+        0.366025403782260, 0.211324865405913, 0.211324865405913, 0.211324865405913,
+        -0.211324865405913, 0.211324865405913, 0.211324865405913, 0.788675134594087,
+        -0.211324865405913, 0.211324865405913, 0.788675134594087, 0.211324865405913,
+        -0.788675134594087, 0.211324865405913, 0.788675134594087, 0.788675134594087,
+        -0.211324865405913, 0.788675134594087, 0.211324865405913, 0.211324865405913,
+        -0.788675134594087, 0.788675134594087, 0.211324865405913, 0.788675134594087,
+        -0.788675134594087, 0.788675134594087, 0.788675134594087, 0.211324865405913,
+        -1.36602540378226, 0.788675134594087, 0.788675134594087, 0.788675134594087};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.125000000000000,
         0.125000000000000,
@@ -1724,33 +917,33 @@ struct GaussLegendreQuadrature<3, 3>
     inline static std::uint8_t constexpr kOrder                              = 3;
     inline static int constexpr kPoints                                      = 27;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.661895003857353,  0.274596669238235,  -0.112701665380882, 0.274596669238235,
-        -0.112701665380882, -0.500000000000000, -0.112701665380882, -0.500000000000000,
-        -0.887298334619118, 0.274596669238235,  -0.112701665380882, -0.500000000000000,
-        -0.112701665380882, -0.500000000000000, -0.887298334619118, -0.500000000000000,
-        -0.887298334619118, -1.27459666923824,  -0.112701665380882, -0.500000000000000,
-        -0.887298334619118, -0.500000000000000, -0.887298334619118, -1.27459666923824,
-        -0.887298334619118, -1.27459666923824,  -1.66189500385735,  0.112701665380882,
-        0.112701665380882,  0.112701665380882,  0.112701665380882,  0.112701665380882,
-        0.112701665380882,  0.112701665380882,  0.112701665380882,  0.112701665380882,
-        0.500000000000000,  0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,  0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,  0.887298334619118,  0.887298334619118,  0.887298334619118,
-        0.887298334619118,  0.887298334619118,  0.887298334619118,  0.887298334619118,
-        0.887298334619118,  0.887298334619118,  0.112701665380882,  0.112701665380882,
-        0.112701665380882,  0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.887298334619118,  0.887298334619118,  0.887298334619118,  0.112701665380882,
-        0.112701665380882,  0.112701665380882,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,  0.887298334619118,  0.887298334619118,  0.887298334619118,
-        0.112701665380882,  0.112701665380882,  0.112701665380882,  0.500000000000000,
-        0.500000000000000,  0.500000000000000,  0.887298334619118,  0.887298334619118,
-        0.887298334619118,  0.112701665380882,  0.500000000000000,  0.887298334619118,
-        0.112701665380882,  0.500000000000000,  0.887298334619118,  0.112701665380882,
-        0.500000000000000,  0.887298334619118,  0.112701665380882,  0.500000000000000,
-        0.887298334619118,  0.112701665380882,  0.500000000000000,  0.887298334619118,
-        0.112701665380882,  0.500000000000000,  0.887298334619118,  0.112701665380882,
-        0.500000000000000,  0.887298334619118,  0.112701665380882,  0.500000000000000,
-        0.887298334619118,  0.112701665380882,  0.500000000000000,  0.887298334619118};
+        0.661895003857353, 0.112701665380882, 0.112701665380882, 0.112701665380882,
+        0.274596669238235, 0.112701665380882, 0.112701665380882, 0.500000000000000,
+        -0.112701665380882, 0.112701665380882, 0.112701665380882, 0.887298334619118,
+        0.274596669238235, 0.112701665380882, 0.500000000000000, 0.112701665380882,
+        -0.112701665380882, 0.112701665380882, 0.500000000000000, 0.500000000000000,
+        -0.500000000000000, 0.112701665380882, 0.500000000000000, 0.887298334619118,
+        -0.112701665380882, 0.112701665380882, 0.887298334619118, 0.112701665380882,
+        -0.500000000000000, 0.112701665380882, 0.887298334619118, 0.500000000000000,
+        -0.887298334619118, 0.112701665380882, 0.887298334619118, 0.887298334619118,
+        0.274596669238235, 0.500000000000000, 0.112701665380882, 0.112701665380882,
+        -0.112701665380882, 0.500000000000000, 0.112701665380882, 0.500000000000000,
+        -0.500000000000000, 0.500000000000000, 0.112701665380882, 0.887298334619118,
+        -0.112701665380882, 0.500000000000000, 0.500000000000000, 0.112701665380882,
+        -0.500000000000000, 0.500000000000000, 0.500000000000000, 0.500000000000000,
+        -0.887298334619118, 0.500000000000000, 0.500000000000000, 0.887298334619118,
+        -0.500000000000000, 0.500000000000000, 0.887298334619118, 0.112701665380882,
+        -0.887298334619118, 0.500000000000000, 0.887298334619118, 0.500000000000000,
+        -1.27459666923824, 0.500000000000000, 0.887298334619118, 0.887298334619118,
+        -0.112701665380882, 0.887298334619118, 0.112701665380882, 0.112701665380882,
+        -0.500000000000000, 0.887298334619118, 0.112701665380882, 0.500000000000000,
+        -0.887298334619118, 0.887298334619118, 0.112701665380882, 0.887298334619118,
+        -0.500000000000000, 0.887298334619118, 0.500000000000000, 0.112701665380882,
+        -0.887298334619118, 0.887298334619118, 0.500000000000000, 0.500000000000000,
+        -1.27459666923824, 0.887298334619118, 0.500000000000000, 0.887298334619118,
+        -0.887298334619118, 0.887298334619118, 0.887298334619118, 0.112701665380882,
+        -1.27459666923824, 0.887298334619118, 0.887298334619118, 0.500000000000000,
+        -1.66189500385735, 0.887298334619118, 0.887298334619118, 0.887298334619118};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.0214334705074510, 0.0342935528120339, 0.0214334705074510, 0.0342935528120339,
         0.0548696844994339, 0.0342935528120339, 0.0214334705074510, 0.0342935528120339,
@@ -1768,70 +961,70 @@ struct GaussLegendreQuadrature<3, 4>
     inline static std::uint8_t constexpr kOrder                              = 4;
     inline static int constexpr kPoints                                      = 64;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.791704467388627,   0.531126833384405,   0.191145789800430,   -0.0694318442037911,
-        0.531126833384405,   0.270549199380184,   -0.0694318442037911, -0.330009478208012,
-        0.191145789800430,   -0.0694318442037911, -0.409412887787767,  -0.669990521791988,
-        -0.0694318442037911, -0.330009478208012,  -0.669990521791988,  -0.930568155796209,
-        0.531126833384405,   0.270549199380184,   -0.0694318442037911, -0.330009478208012,
-        0.270549199380184,   0.00997156537596311, -0.330009478208012,  -0.590587112212233,
-        -0.0694318442037911, -0.330009478208012,  -0.669990521791988,  -0.930568155796209,
-        -0.330009478208012,  -0.590587112212233,  -0.930568155796209,  -1.19114578980043,
-        0.191145789800430,   -0.0694318442037911, -0.409412887787767,  -0.669990521791988,
-        -0.0694318442037911, -0.330009478208012,  -0.669990521791988,  -0.930568155796209,
-        -0.409412887787767,  -0.669990521791988,  -1.00997156537596,   -1.27054919938018,
-        -0.669990521791988,  -0.930568155796209,  -1.27054919938018,   -1.53112683338441,
-        -0.0694318442037911, -0.330009478208012,  -0.669990521791988,  -0.930568155796209,
-        -0.330009478208012,  -0.590587112212233,  -0.930568155796209,  -1.19114578980043,
-        -0.669990521791988,  -0.930568155796209,  -1.27054919938018,   -1.53112683338441,
-        -0.930568155796209,  -1.19114578980043,   -1.53112683338441,   -1.79170446738863,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.0694318442037911,  0.0694318442037911,  0.0694318442037911,  0.0694318442037911,
-        0.330009478208012,   0.330009478208012,   0.330009478208012,   0.330009478208012,
-        0.669990521791988,   0.669990521791988,   0.669990521791988,   0.669990521791988,
-        0.930568155796209,   0.930568155796209,   0.930568155796209,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209,
-        0.0694318442037911,  0.330009478208012,   0.669990521791988,   0.930568155796209};
+        0.791704467388627, 0.0694318442037911, 0.0694318442037911, 0.0694318442037911,
+        0.531126833384405, 0.0694318442037911, 0.0694318442037911, 0.330009478208012,
+        0.191145789800430, 0.0694318442037911, 0.0694318442037911, 0.669990521791988,
+        -0.0694318442037911, 0.0694318442037911, 0.0694318442037911, 0.930568155796209,
+        0.531126833384405, 0.0694318442037911, 0.330009478208012, 0.0694318442037911,
+        0.270549199380184, 0.0694318442037911, 0.330009478208012, 0.330009478208012,
+        -0.0694318442037911, 0.0694318442037911, 0.330009478208012, 0.669990521791988,
+        -0.330009478208012, 0.0694318442037911, 0.330009478208012, 0.930568155796209,
+        0.191145789800430, 0.0694318442037911, 0.669990521791988, 0.0694318442037911,
+        -0.0694318442037911, 0.0694318442037911, 0.669990521791988, 0.330009478208012,
+        -0.409412887787767, 0.0694318442037911, 0.669990521791988, 0.669990521791988,
+        -0.669990521791988, 0.0694318442037911, 0.669990521791988, 0.930568155796209,
+        -0.0694318442037911, 0.0694318442037911, 0.930568155796209, 0.0694318442037911,
+        -0.330009478208012, 0.0694318442037911, 0.930568155796209, 0.330009478208012,
+        -0.669990521791988, 0.0694318442037911, 0.930568155796209, 0.669990521791988,
+        -0.930568155796209, 0.0694318442037911, 0.930568155796209, 0.930568155796209,
+        0.531126833384405, 0.330009478208012, 0.0694318442037911, 0.0694318442037911,
+        0.270549199380184, 0.330009478208012, 0.0694318442037911, 0.330009478208012,
+        -0.0694318442037911, 0.330009478208012, 0.0694318442037911, 0.669990521791988,
+        -0.330009478208012, 0.330009478208012, 0.0694318442037911, 0.930568155796209,
+        0.270549199380184, 0.330009478208012, 0.330009478208012, 0.0694318442037911,
+        0.00997156537596311, 0.330009478208012, 0.330009478208012, 0.330009478208012,
+        -0.330009478208012, 0.330009478208012, 0.330009478208012, 0.669990521791988,
+        -0.590587112212233, 0.330009478208012, 0.330009478208012, 0.930568155796209,
+        -0.0694318442037911, 0.330009478208012, 0.669990521791988, 0.0694318442037911,
+        -0.330009478208012, 0.330009478208012, 0.669990521791988, 0.330009478208012,
+        -0.669990521791988, 0.330009478208012, 0.669990521791988, 0.669990521791988,
+        -0.930568155796209, 0.330009478208012, 0.669990521791988, 0.930568155796209,
+        -0.330009478208012, 0.330009478208012, 0.930568155796209, 0.0694318442037911,
+        -0.590587112212233, 0.330009478208012, 0.930568155796209, 0.330009478208012,
+        -0.930568155796209, 0.330009478208012, 0.930568155796209, 0.669990521791988,
+        -1.19114578980043, 0.330009478208012, 0.930568155796209, 0.930568155796209,
+        0.191145789800430, 0.669990521791988, 0.0694318442037911, 0.0694318442037911,
+        -0.0694318442037911, 0.669990521791988, 0.0694318442037911, 0.330009478208012,
+        -0.409412887787767, 0.669990521791988, 0.0694318442037911, 0.669990521791988,
+        -0.669990521791988, 0.669990521791988, 0.0694318442037911, 0.930568155796209,
+        -0.0694318442037911, 0.669990521791988, 0.330009478208012, 0.0694318442037911,
+        -0.330009478208012, 0.669990521791988, 0.330009478208012, 0.330009478208012,
+        -0.669990521791988, 0.669990521791988, 0.330009478208012, 0.669990521791988,
+        -0.930568155796209, 0.669990521791988, 0.330009478208012, 0.930568155796209,
+        -0.409412887787767, 0.669990521791988, 0.669990521791988, 0.0694318442037911,
+        -0.669990521791988, 0.669990521791988, 0.669990521791988, 0.330009478208012,
+        -1.00997156537596, 0.669990521791988, 0.669990521791988, 0.669990521791988,
+        -1.27054919938018, 0.669990521791988, 0.669990521791988, 0.930568155796209,
+        -0.669990521791988, 0.669990521791988, 0.930568155796209, 0.0694318442037911,
+        -0.930568155796209, 0.669990521791988, 0.930568155796209, 0.330009478208012,
+        -1.27054919938018, 0.669990521791988, 0.930568155796209, 0.669990521791988,
+        -1.53112683338441, 0.669990521791988, 0.930568155796209, 0.930568155796209,
+        -0.0694318442037911, 0.930568155796209, 0.0694318442037911, 0.0694318442037911,
+        -0.330009478208012, 0.930568155796209, 0.0694318442037911, 0.330009478208012,
+        -0.669990521791988, 0.930568155796209, 0.0694318442037911, 0.669990521791988,
+        -0.930568155796209, 0.930568155796209, 0.0694318442037911, 0.930568155796209,
+        -0.330009478208012, 0.930568155796209, 0.330009478208012, 0.0694318442037911,
+        -0.590587112212233, 0.930568155796209, 0.330009478208012, 0.330009478208012,
+        -0.930568155796209, 0.930568155796209, 0.330009478208012, 0.669990521791988,
+        -1.19114578980043, 0.930568155796209, 0.330009478208012, 0.930568155796209,
+        -0.669990521791988, 0.930568155796209, 0.669990521791988, 0.0694318442037911,
+        -0.930568155796209, 0.930568155796209, 0.669990521791988, 0.330009478208012,
+        -1.27054919938018, 0.930568155796209, 0.669990521791988, 0.669990521791988,
+        -1.53112683338441, 0.930568155796209, 0.669990521791988, 0.930568155796209,
+        -0.930568155796209, 0.930568155796209, 0.930568155796209, 0.0694318442037911,
+        -1.19114578980043, 0.930568155796209, 0.930568155796209, 0.330009478208012,
+        -1.53112683338441, 0.930568155796209, 0.930568155796209, 0.669990521791988,
+        -1.79170446738863, 0.930568155796209, 0.930568155796209, 0.930568155796209};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.00526143468636388, 0.00986393947442731, 0.00986393947442731, 0.00526143468636388,
         0.00986393947442731, 0.0184925420070939,  0.0184925420070939,  0.00986393947442731,
@@ -1858,131 +1051,131 @@ struct GaussLegendreQuadrature<3, 5>
     inline static std::uint8_t constexpr kOrder                              = 5;
     inline static int constexpr kPoints                                      = 125;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.859269768905506,   0.675414500990883,  0.406179845937004,  0.136945190883125,
-        -0.0469100770314981, 0.675414500990883,  0.491559233076259,  0.222324578022381,
-        -0.0469100770314981, -0.230765344946121, 0.406179845937004,  0.222324578022381,
-        -0.0469100770314981, -0.316144732085377, -0.500000000000000, 0.136945190883125,
-        -0.0469100770314981, -0.316144732085377, -0.585379387139255, -0.769234655053879,
-        -0.0469100770314981, -0.230765344946121, -0.500000000000000, -0.769234655053879,
-        -0.953089922968502,  0.675414500990883,  0.491559233076259,  0.222324578022381,
-        -0.0469100770314981, -0.230765344946121, 0.491559233076259,  0.307703965161636,
-        0.0384693101077573,  -0.230765344946121, -0.414620612860745, 0.222324578022381,
-        0.0384693101077573,  -0.230765344946121, -0.500000000000000, -0.683855267914623,
-        -0.0469100770314981, -0.230765344946121, -0.500000000000000, -0.769234655053879,
-        -0.953089922968502,  -0.230765344946121, -0.414620612860745, -0.683855267914623,
-        -0.953089922968502,  -1.13694519088313,  0.406179845937004,  0.222324578022381,
-        -0.0469100770314981, -0.316144732085377, -0.500000000000000, 0.222324578022381,
-        0.0384693101077573,  -0.230765344946121, -0.500000000000000, -0.683855267914623,
-        -0.0469100770314981, -0.230765344946121, -0.500000000000000, -0.769234655053879,
-        -0.953089922968502,  -0.316144732085377, -0.500000000000000, -0.769234655053879,
-        -1.03846931010776,   -1.22232457802238,  -0.500000000000000, -0.683855267914623,
-        -0.953089922968502,  -1.22232457802238,  -1.40617984593700,  0.136945190883125,
-        -0.0469100770314981, -0.316144732085377, -0.585379387139255, -0.769234655053879,
-        -0.0469100770314981, -0.230765344946121, -0.500000000000000, -0.769234655053879,
-        -0.953089922968502,  -0.316144732085377, -0.500000000000000, -0.769234655053879,
-        -1.03846931010776,   -1.22232457802238,  -0.585379387139255, -0.769234655053879,
-        -1.03846931010776,   -1.30770396516164,  -1.49155923307626,  -0.769234655053879,
-        -0.953089922968502,  -1.22232457802238,  -1.49155923307626,  -1.67541450099088,
-        -0.0469100770314981, -0.230765344946121, -0.500000000000000, -0.769234655053879,
-        -0.953089922968502,  -0.230765344946121, -0.414620612860745, -0.683855267914623,
-        -0.953089922968502,  -1.13694519088313,  -0.500000000000000, -0.683855267914623,
-        -0.953089922968502,  -1.22232457802238,  -1.40617984593700,  -0.769234655053879,
-        -0.953089922968502,  -1.22232457802238,  -1.49155923307626,  -1.67541450099088,
-        -0.953089922968502,  -1.13694519088313,  -1.40617984593700,  -1.67541450099088,
-        -1.85926976890551,   0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.230765344946121,  0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.769234655053879,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.953089922968502,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.0469100770314981, 0.0469100770314981,
-        0.0469100770314981,  0.0469100770314981, 0.0469100770314981, 0.230765344946121,
-        0.230765344946121,   0.230765344946121,  0.230765344946121,  0.230765344946121,
-        0.500000000000000,   0.500000000000000,  0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.769234655053879,  0.769234655053879,  0.769234655053879,
-        0.769234655053879,   0.769234655053879,  0.953089922968502,  0.953089922968502,
-        0.953089922968502,   0.953089922968502,  0.953089922968502,  0.0469100770314981,
-        0.230765344946121,   0.500000000000000,  0.769234655053879,  0.953089922968502,
-        0.0469100770314981,  0.230765344946121,  0.500000000000000,  0.769234655053879,
-        0.953089922968502,   0.0469100770314981, 0.230765344946121,  0.500000000000000,
-        0.769234655053879,   0.953089922968502,  0.0469100770314981, 0.230765344946121,
-        0.500000000000000,   0.769234655053879,  0.953089922968502,  0.0469100770314981,
-        0.230765344946121,   0.500000000000000,  0.769234655053879,  0.953089922968502,
-        0.0469100770314981,  0.230765344946121,  0.500000000000000,  0.769234655053879,
-        0.953089922968502,   0.0469100770314981, 0.230765344946121,  0.500000000000000,
-        0.769234655053879,   0.953089922968502,  0.0469100770314981, 0.230765344946121,
-        0.500000000000000,   0.769234655053879,  0.953089922968502,  0.0469100770314981,
-        0.230765344946121,   0.500000000000000,  0.769234655053879,  0.953089922968502,
-        0.0469100770314981,  0.230765344946121,  0.500000000000000,  0.769234655053879,
-        0.953089922968502,   0.0469100770314981, 0.230765344946121,  0.500000000000000,
-        0.769234655053879,   0.953089922968502,  0.0469100770314981, 0.230765344946121,
-        0.500000000000000,   0.769234655053879,  0.953089922968502,  0.0469100770314981,
-        0.230765344946121,   0.500000000000000,  0.769234655053879,  0.953089922968502,
-        0.0469100770314981,  0.230765344946121,  0.500000000000000,  0.769234655053879,
-        0.953089922968502,   0.0469100770314981, 0.230765344946121,  0.500000000000000,
-        0.769234655053879,   0.953089922968502,  0.0469100770314981, 0.230765344946121,
-        0.500000000000000,   0.769234655053879,  0.953089922968502,  0.0469100770314981,
-        0.230765344946121,   0.500000000000000,  0.769234655053879,  0.953089922968502,
-        0.0469100770314981,  0.230765344946121,  0.500000000000000,  0.769234655053879,
-        0.953089922968502,   0.0469100770314981, 0.230765344946121,  0.500000000000000,
-        0.769234655053879,   0.953089922968502,  0.0469100770314981, 0.230765344946121,
-        0.500000000000000,   0.769234655053879,  0.953089922968502,  0.0469100770314981,
-        0.230765344946121,   0.500000000000000,  0.769234655053879,  0.953089922968502,
-        0.0469100770314981,  0.230765344946121,  0.500000000000000,  0.769234655053879,
-        0.953089922968502,   0.0469100770314981, 0.230765344946121,  0.500000000000000,
-        0.769234655053879,   0.953089922968502,  0.0469100770314981, 0.230765344946121,
-        0.500000000000000,   0.769234655053879,  0.953089922968502,  0.0469100770314981,
-        0.230765344946121,   0.500000000000000,  0.769234655053879,  0.953089922968502};
+        0.859269768905506, 0.0469100770314981, 0.0469100770314981, 0.0469100770314981,
+        0.675414500990883, 0.0469100770314981, 0.0469100770314981, 0.230765344946121,
+        0.406179845937004, 0.0469100770314981, 0.0469100770314981, 0.500000000000000,
+        0.136945190883125, 0.0469100770314981, 0.0469100770314981, 0.769234655053879,
+        -0.0469100770314981, 0.0469100770314981, 0.0469100770314981, 0.953089922968502,
+        0.675414500990883, 0.0469100770314981, 0.230765344946121, 0.0469100770314981,
+        0.491559233076259, 0.0469100770314981, 0.230765344946121, 0.230765344946121,
+        0.222324578022381, 0.0469100770314981, 0.230765344946121, 0.500000000000000,
+        -0.0469100770314981, 0.0469100770314981, 0.230765344946121, 0.769234655053879,
+        -0.230765344946121, 0.0469100770314981, 0.230765344946121, 0.953089922968502,
+        0.406179845937004, 0.0469100770314981, 0.500000000000000, 0.0469100770314981,
+        0.222324578022381, 0.0469100770314981, 0.500000000000000, 0.230765344946121,
+        -0.0469100770314981, 0.0469100770314981, 0.500000000000000, 0.500000000000000,
+        -0.316144732085377, 0.0469100770314981, 0.500000000000000, 0.769234655053879,
+        -0.500000000000000, 0.0469100770314981, 0.500000000000000, 0.953089922968502,
+        0.136945190883125, 0.0469100770314981, 0.769234655053879, 0.0469100770314981,
+        -0.0469100770314981, 0.0469100770314981, 0.769234655053879, 0.230765344946121,
+        -0.316144732085377, 0.0469100770314981, 0.769234655053879, 0.500000000000000,
+        -0.585379387139255, 0.0469100770314981, 0.769234655053879, 0.769234655053879,
+        -0.769234655053879, 0.0469100770314981, 0.769234655053879, 0.953089922968502,
+        -0.0469100770314981, 0.0469100770314981, 0.953089922968502, 0.0469100770314981,
+        -0.230765344946121, 0.0469100770314981, 0.953089922968502, 0.230765344946121,
+        -0.500000000000000, 0.0469100770314981, 0.953089922968502, 0.500000000000000,
+        -0.769234655053879, 0.0469100770314981, 0.953089922968502, 0.769234655053879,
+        -0.953089922968502, 0.0469100770314981, 0.953089922968502, 0.953089922968502,
+        0.675414500990883, 0.230765344946121, 0.0469100770314981, 0.0469100770314981,
+        0.491559233076259, 0.230765344946121, 0.0469100770314981, 0.230765344946121,
+        0.222324578022381, 0.230765344946121, 0.0469100770314981, 0.500000000000000,
+        -0.0469100770314981, 0.230765344946121, 0.0469100770314981, 0.769234655053879,
+        -0.230765344946121, 0.230765344946121, 0.0469100770314981, 0.953089922968502,
+        0.491559233076259, 0.230765344946121, 0.230765344946121, 0.0469100770314981,
+        0.307703965161636, 0.230765344946121, 0.230765344946121, 0.230765344946121,
+        0.0384693101077573, 0.230765344946121, 0.230765344946121, 0.500000000000000,
+        -0.230765344946121, 0.230765344946121, 0.230765344946121, 0.769234655053879,
+        -0.414620612860745, 0.230765344946121, 0.230765344946121, 0.953089922968502,
+        0.222324578022381, 0.230765344946121, 0.500000000000000, 0.0469100770314981,
+        0.0384693101077573, 0.230765344946121, 0.500000000000000, 0.230765344946121,
+        -0.230765344946121, 0.230765344946121, 0.500000000000000, 0.500000000000000,
+        -0.500000000000000, 0.230765344946121, 0.500000000000000, 0.769234655053879,
+        -0.683855267914623, 0.230765344946121, 0.500000000000000, 0.953089922968502,
+        -0.0469100770314981, 0.230765344946121, 0.769234655053879, 0.0469100770314981,
+        -0.230765344946121, 0.230765344946121, 0.769234655053879, 0.230765344946121,
+        -0.500000000000000, 0.230765344946121, 0.769234655053879, 0.500000000000000,
+        -0.769234655053879, 0.230765344946121, 0.769234655053879, 0.769234655053879,
+        -0.953089922968502, 0.230765344946121, 0.769234655053879, 0.953089922968502,
+        -0.230765344946121, 0.230765344946121, 0.953089922968502, 0.0469100770314981,
+        -0.414620612860745, 0.230765344946121, 0.953089922968502, 0.230765344946121,
+        -0.683855267914623, 0.230765344946121, 0.953089922968502, 0.500000000000000,
+        -0.953089922968502, 0.230765344946121, 0.953089922968502, 0.769234655053879,
+        -1.13694519088313, 0.230765344946121, 0.953089922968502, 0.953089922968502,
+        0.406179845937004, 0.500000000000000, 0.0469100770314981, 0.0469100770314981,
+        0.222324578022381, 0.500000000000000, 0.0469100770314981, 0.230765344946121,
+        -0.0469100770314981, 0.500000000000000, 0.0469100770314981, 0.500000000000000,
+        -0.316144732085377, 0.500000000000000, 0.0469100770314981, 0.769234655053879,
+        -0.500000000000000, 0.500000000000000, 0.0469100770314981, 0.953089922968502,
+        0.222324578022381, 0.500000000000000, 0.230765344946121, 0.0469100770314981,
+        0.0384693101077573, 0.500000000000000, 0.230765344946121, 0.230765344946121,
+        -0.230765344946121, 0.500000000000000, 0.230765344946121, 0.500000000000000,
+        -0.500000000000000, 0.500000000000000, 0.230765344946121, 0.769234655053879,
+        -0.683855267914623, 0.500000000000000, 0.230765344946121, 0.953089922968502,
+        -0.0469100770314981, 0.500000000000000, 0.500000000000000, 0.0469100770314981,
+        -0.230765344946121, 0.500000000000000, 0.500000000000000, 0.230765344946121,
+        -0.500000000000000, 0.500000000000000, 0.500000000000000, 0.500000000000000,
+        -0.769234655053879, 0.500000000000000, 0.500000000000000, 0.769234655053879,
+        -0.953089922968502, 0.500000000000000, 0.500000000000000, 0.953089922968502,
+        -0.316144732085377, 0.500000000000000, 0.769234655053879, 0.0469100770314981,
+        -0.500000000000000, 0.500000000000000, 0.769234655053879, 0.230765344946121,
+        -0.769234655053879, 0.500000000000000, 0.769234655053879, 0.500000000000000,
+        -1.03846931010776, 0.500000000000000, 0.769234655053879, 0.769234655053879,
+        -1.22232457802238, 0.500000000000000, 0.769234655053879, 0.953089922968502,
+        -0.500000000000000, 0.500000000000000, 0.953089922968502, 0.0469100770314981,
+        -0.683855267914623, 0.500000000000000, 0.953089922968502, 0.230765344946121,
+        -0.953089922968502, 0.500000000000000, 0.953089922968502, 0.500000000000000,
+        -1.22232457802238, 0.500000000000000, 0.953089922968502, 0.769234655053879,
+        -1.40617984593700, 0.500000000000000, 0.953089922968502, 0.953089922968502,
+        0.136945190883125, 0.769234655053879, 0.0469100770314981, 0.0469100770314981,
+        -0.0469100770314981, 0.769234655053879, 0.0469100770314981, 0.230765344946121,
+        -0.316144732085377, 0.769234655053879, 0.0469100770314981, 0.500000000000000,
+        -0.585379387139255, 0.769234655053879, 0.0469100770314981, 0.769234655053879,
+        -0.769234655053879, 0.769234655053879, 0.0469100770314981, 0.953089922968502,
+        -0.0469100770314981, 0.769234655053879, 0.230765344946121, 0.0469100770314981,
+        -0.230765344946121, 0.769234655053879, 0.230765344946121, 0.230765344946121,
+        -0.500000000000000, 0.769234655053879, 0.230765344946121, 0.500000000000000,
+        -0.769234655053879, 0.769234655053879, 0.230765344946121, 0.769234655053879,
+        -0.953089922968502, 0.769234655053879, 0.230765344946121, 0.953089922968502,
+        -0.316144732085377, 0.769234655053879, 0.500000000000000, 0.0469100770314981,
+        -0.500000000000000, 0.769234655053879, 0.500000000000000, 0.230765344946121,
+        -0.769234655053879, 0.769234655053879, 0.500000000000000, 0.500000000000000,
+        -1.03846931010776, 0.769234655053879, 0.500000000000000, 0.769234655053879,
+        -1.22232457802238, 0.769234655053879, 0.500000000000000, 0.953089922968502,
+        -0.585379387139255, 0.769234655053879, 0.769234655053879, 0.0469100770314981,
+        -0.769234655053879, 0.769234655053879, 0.769234655053879, 0.230765344946121,
+        -1.03846931010776, 0.769234655053879, 0.769234655053879, 0.500000000000000,
+        -1.30770396516164, 0.769234655053879, 0.769234655053879, 0.769234655053879,
+        -1.49155923307626, 0.769234655053879, 0.769234655053879, 0.953089922968502,
+        -0.769234655053879, 0.769234655053879, 0.953089922968502, 0.0469100770314981,
+        -0.953089922968502, 0.769234655053879, 0.953089922968502, 0.230765344946121,
+        -1.22232457802238, 0.769234655053879, 0.953089922968502, 0.500000000000000,
+        -1.49155923307626, 0.769234655053879, 0.953089922968502, 0.769234655053879,
+        -1.67541450099088, 0.769234655053879, 0.953089922968502, 0.953089922968502,
+        -0.0469100770314981, 0.953089922968502, 0.0469100770314981, 0.0469100770314981,
+        -0.230765344946121, 0.953089922968502, 0.0469100770314981, 0.230765344946121,
+        -0.500000000000000, 0.953089922968502, 0.0469100770314981, 0.500000000000000,
+        -0.769234655053879, 0.953089922968502, 0.0469100770314981, 0.769234655053879,
+        -0.953089922968502, 0.953089922968502, 0.0469100770314981, 0.953089922968502,
+        -0.230765344946121, 0.953089922968502, 0.230765344946121, 0.0469100770314981,
+        -0.414620612860745, 0.953089922968502, 0.230765344946121, 0.230765344946121,
+        -0.683855267914623, 0.953089922968502, 0.230765344946121, 0.500000000000000,
+        -0.953089922968502, 0.953089922968502, 0.230765344946121, 0.769234655053879,
+        -1.13694519088313, 0.953089922968502, 0.230765344946121, 0.953089922968502,
+        -0.500000000000000, 0.953089922968502, 0.500000000000000, 0.0469100770314981,
+        -0.683855267914623, 0.953089922968502, 0.500000000000000, 0.230765344946121,
+        -0.953089922968502, 0.953089922968502, 0.500000000000000, 0.500000000000000,
+        -1.22232457802238, 0.953089922968502, 0.500000000000000, 0.769234655053879,
+        -1.40617984593700, 0.953089922968502, 0.500000000000000, 0.953089922968502,
+        -0.769234655053879, 0.953089922968502, 0.769234655053879, 0.0469100770314981,
+        -0.953089922968502, 0.953089922968502, 0.769234655053879, 0.230765344946121,
+        -1.22232457802238, 0.953089922968502, 0.769234655053879, 0.500000000000000,
+        -1.49155923307626, 0.953089922968502, 0.769234655053879, 0.769234655053879,
+        -1.67541450099088, 0.953089922968502, 0.769234655053879, 0.953089922968502,
+        -0.953089922968502, 0.953089922968502, 0.953089922968502, 0.0469100770314981,
+        -1.13694519088313, 0.953089922968502, 0.953089922968502, 0.230765344946121,
+        -1.40617984593700, 0.953089922968502, 0.953089922968502, 0.500000000000000,
+        -1.67541450099088, 0.953089922968502, 0.953089922968502, 0.769234655053879,
+        -1.85926976890551, 0.953089922968502, 0.953089922968502, 0.953089922968502};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.00166246705257855, 0.00335843859566425, 0.00399177591911858, 0.00335843859566425,
         0.00166246705257855, 0.00335843859566425, 0.00678456140430147, 0.00806400000001054,
@@ -2025,222 +1218,222 @@ struct GaussLegendreQuadrature<3, 6>
     inline static std::uint8_t constexpr kOrder                              = 6;
     inline static int constexpr kPoints                                      = 216;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.898704271308816,   0.763074207439786,   0.551779107247057,   0.313159921164697,
-        0.101864820971969,   -0.0337652428970614, 0.763074207439786,   0.627444143570756,
-        0.416149043378027,   0.177529857295667,   -0.0337652428970614, -0.169395306766091,
-        0.551779107247057,   0.416149043378027,   0.204853943185299,   -0.0337652428970614,
-        -0.245060343089790,  -0.380690406958820,  0.313159921164697,   0.177529857295667,
-        -0.0337652428970614, -0.272384428979422,  -0.483679529172150,  -0.619309593041180,
-        0.101864820971969,   -0.0337652428970614, -0.245060343089790,  -0.483679529172150,
-        -0.694974629364879,  -0.830604693233909,  -0.0337652428970614, -0.169395306766091,
-        -0.380690406958820,  -0.619309593041180,  -0.830604693233909,  -0.966234757102939,
-        0.763074207439786,   0.627444143570756,   0.416149043378027,   0.177529857295667,
-        -0.0337652428970614, -0.169395306766091,  0.627444143570756,   0.491814079701726,
-        0.280518979508997,   0.0418997934266372,  -0.169395306766091,  -0.305025370635121,
-        0.416149043378027,   0.280518979508997,   0.0692238793162687,  -0.169395306766091,
-        -0.380690406958820,  -0.516320470827850,  0.177529857295667,   0.0418997934266372,
-        -0.169395306766091,  -0.408014492848451,  -0.619309593041180,  -0.754939656910210,
-        -0.0337652428970614, -0.169395306766091,  -0.380690406958820,  -0.619309593041180,
-        -0.830604693233909,  -0.966234757102939,  -0.169395306766091,  -0.305025370635121,
-        -0.516320470827850,  -0.754939656910210,  -0.966234757102939,  -1.10186482097197,
-        0.551779107247057,   0.416149043378027,   0.204853943185299,   -0.0337652428970614,
-        -0.245060343089790,  -0.380690406958820,  0.416149043378027,   0.280518979508997,
-        0.0692238793162687,  -0.169395306766091,  -0.380690406958820,  -0.516320470827850,
-        0.204853943185299,   0.0692238793162687,  -0.142071220876460,  -0.380690406958820,
-        -0.591985507151549,  -0.727615571020578,  -0.0337652428970614, -0.169395306766091,
-        -0.380690406958820,  -0.619309593041180,  -0.830604693233909,  -0.966234757102939,
-        -0.245060343089790,  -0.380690406958820,  -0.591985507151549,  -0.830604693233909,
-        -1.04189979342664,   -1.17752985729567,   -0.380690406958820,  -0.516320470827850,
-        -0.727615571020578,  -0.966234757102939,  -1.17752985729567,   -1.31315992116470,
-        0.313159921164697,   0.177529857295667,   -0.0337652428970614, -0.272384428979422,
-        -0.483679529172150,  -0.619309593041180,  0.177529857295667,   0.0418997934266372,
-        -0.169395306766091,  -0.408014492848451,  -0.619309593041180,  -0.754939656910210,
-        -0.0337652428970614, -0.169395306766091,  -0.380690406958820,  -0.619309593041180,
-        -0.830604693233909,  -0.966234757102939,  -0.272384428979422,  -0.408014492848451,
-        -0.619309593041180,  -0.857928779123540,  -1.06922387931627,   -1.20485394318530,
-        -0.483679529172150,  -0.619309593041180,  -0.830604693233909,  -1.06922387931627,
-        -1.28051897950900,   -1.41614904337803,   -0.619309593041180,  -0.754939656910210,
-        -0.966234757102939,  -1.20485394318530,   -1.41614904337803,   -1.55177910724706,
-        0.101864820971969,   -0.0337652428970614, -0.245060343089790,  -0.483679529172150,
-        -0.694974629364879,  -0.830604693233909,  -0.0337652428970614, -0.169395306766091,
-        -0.380690406958820,  -0.619309593041180,  -0.830604693233909,  -0.966234757102939,
-        -0.245060343089790,  -0.380690406958820,  -0.591985507151549,  -0.830604693233909,
-        -1.04189979342664,   -1.17752985729567,   -0.483679529172150,  -0.619309593041180,
-        -0.830604693233909,  -1.06922387931627,   -1.28051897950900,   -1.41614904337803,
-        -0.694974629364879,  -0.830604693233909,  -1.04189979342664,   -1.28051897950900,
-        -1.49181407970173,   -1.62744414357076,   -0.830604693233909,  -0.966234757102939,
-        -1.17752985729567,   -1.41614904337803,   -1.62744414357076,   -1.76307420743979,
-        -0.0337652428970614, -0.169395306766091,  -0.380690406958820,  -0.619309593041180,
-        -0.830604693233909,  -0.966234757102939,  -0.169395306766091,  -0.305025370635121,
-        -0.516320470827850,  -0.754939656910210,  -0.966234757102939,  -1.10186482097197,
-        -0.380690406958820,  -0.516320470827850,  -0.727615571020578,  -0.966234757102939,
-        -1.17752985729567,   -1.31315992116470,   -0.619309593041180,  -0.754939656910210,
-        -0.966234757102939,  -1.20485394318530,   -1.41614904337803,   -1.55177910724706,
-        -0.830604693233909,  -0.966234757102939,  -1.17752985729567,   -1.41614904337803,
-        -1.62744414357076,   -1.76307420743979,   -0.966234757102939,  -1.10186482097197,
-        -1.31315992116470,   -1.55177910724706,   -1.76307420743979,   -1.89870427130882,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.0337652428970614,  0.0337652428970614,  0.0337652428970614,  0.0337652428970614,
-        0.0337652428970614,  0.0337652428970614,  0.169395306766091,   0.169395306766091,
-        0.169395306766091,   0.169395306766091,   0.169395306766091,   0.169395306766091,
-        0.380690406958820,   0.380690406958820,   0.380690406958820,   0.380690406958820,
-        0.380690406958820,   0.380690406958820,   0.619309593041180,   0.619309593041180,
-        0.619309593041180,   0.619309593041180,   0.619309593041180,   0.619309593041180,
-        0.830604693233909,   0.830604693233909,   0.830604693233909,   0.830604693233909,
-        0.830604693233909,   0.830604693233909,   0.966234757102939,   0.966234757102939,
-        0.966234757102939,   0.966234757102939,   0.966234757102939,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939,
-        0.0337652428970614,  0.169395306766091,   0.380690406958820,   0.619309593041180,
-        0.830604693233909,   0.966234757102939,   0.0337652428970614,  0.169395306766091,
-        0.380690406958820,   0.619309593041180,   0.830604693233909,   0.966234757102939};
+        0.898704271308816, 0.0337652428970614, 0.0337652428970614, 0.0337652428970614,
+        0.763074207439786, 0.0337652428970614, 0.0337652428970614, 0.169395306766091,
+        0.551779107247057, 0.0337652428970614, 0.0337652428970614, 0.380690406958820,
+        0.313159921164697, 0.0337652428970614, 0.0337652428970614, 0.619309593041180,
+        0.101864820971969, 0.0337652428970614, 0.0337652428970614, 0.830604693233909,
+        -0.0337652428970614, 0.0337652428970614, 0.0337652428970614, 0.966234757102939,
+        0.763074207439786, 0.0337652428970614, 0.169395306766091, 0.0337652428970614,
+        0.627444143570756, 0.0337652428970614, 0.169395306766091, 0.169395306766091,
+        0.416149043378027, 0.0337652428970614, 0.169395306766091, 0.380690406958820,
+        0.177529857295667, 0.0337652428970614, 0.169395306766091, 0.619309593041180,
+        -0.0337652428970614, 0.0337652428970614, 0.169395306766091, 0.830604693233909,
+        -0.169395306766091, 0.0337652428970614, 0.169395306766091, 0.966234757102939,
+        0.551779107247057, 0.0337652428970614, 0.380690406958820, 0.0337652428970614,
+        0.416149043378027, 0.0337652428970614, 0.380690406958820, 0.169395306766091,
+        0.204853943185299, 0.0337652428970614, 0.380690406958820, 0.380690406958820,
+        -0.0337652428970614, 0.0337652428970614, 0.380690406958820, 0.619309593041180,
+        -0.245060343089790, 0.0337652428970614, 0.380690406958820, 0.830604693233909,
+        -0.380690406958820, 0.0337652428970614, 0.380690406958820, 0.966234757102939,
+        0.313159921164697, 0.0337652428970614, 0.619309593041180, 0.0337652428970614,
+        0.177529857295667, 0.0337652428970614, 0.619309593041180, 0.169395306766091,
+        -0.0337652428970614, 0.0337652428970614, 0.619309593041180, 0.380690406958820,
+        -0.272384428979422, 0.0337652428970614, 0.619309593041180, 0.619309593041180,
+        -0.483679529172150, 0.0337652428970614, 0.619309593041180, 0.830604693233909,
+        -0.619309593041180, 0.0337652428970614, 0.619309593041180, 0.966234757102939,
+        0.101864820971969, 0.0337652428970614, 0.830604693233909, 0.0337652428970614,
+        -0.0337652428970614, 0.0337652428970614, 0.830604693233909, 0.169395306766091,
+        -0.245060343089790, 0.0337652428970614, 0.830604693233909, 0.380690406958820,
+        -0.483679529172150, 0.0337652428970614, 0.830604693233909, 0.619309593041180,
+        -0.694974629364879, 0.0337652428970614, 0.830604693233909, 0.830604693233909,
+        -0.830604693233909, 0.0337652428970614, 0.830604693233909, 0.966234757102939,
+        -0.0337652428970614, 0.0337652428970614, 0.966234757102939, 0.0337652428970614,
+        -0.169395306766091, 0.0337652428970614, 0.966234757102939, 0.169395306766091,
+        -0.380690406958820, 0.0337652428970614, 0.966234757102939, 0.380690406958820,
+        -0.619309593041180, 0.0337652428970614, 0.966234757102939, 0.619309593041180,
+        -0.830604693233909, 0.0337652428970614, 0.966234757102939, 0.830604693233909,
+        -0.966234757102939, 0.0337652428970614, 0.966234757102939, 0.966234757102939,
+        0.763074207439786, 0.169395306766091, 0.0337652428970614, 0.0337652428970614,
+        0.627444143570756, 0.169395306766091, 0.0337652428970614, 0.169395306766091,
+        0.416149043378027, 0.169395306766091, 0.0337652428970614, 0.380690406958820,
+        0.177529857295667, 0.169395306766091, 0.0337652428970614, 0.619309593041180,
+        -0.0337652428970614, 0.169395306766091, 0.0337652428970614, 0.830604693233909,
+        -0.169395306766091, 0.169395306766091, 0.0337652428970614, 0.966234757102939,
+        0.627444143570756, 0.169395306766091, 0.169395306766091, 0.0337652428970614,
+        0.491814079701726, 0.169395306766091, 0.169395306766091, 0.169395306766091,
+        0.280518979508997, 0.169395306766091, 0.169395306766091, 0.380690406958820,
+        0.0418997934266372, 0.169395306766091, 0.169395306766091, 0.619309593041180,
+        -0.169395306766091, 0.169395306766091, 0.169395306766091, 0.830604693233909,
+        -0.305025370635121, 0.169395306766091, 0.169395306766091, 0.966234757102939,
+        0.416149043378027, 0.169395306766091, 0.380690406958820, 0.0337652428970614,
+        0.280518979508997, 0.169395306766091, 0.380690406958820, 0.169395306766091,
+        0.0692238793162687, 0.169395306766091, 0.380690406958820, 0.380690406958820,
+        -0.169395306766091, 0.169395306766091, 0.380690406958820, 0.619309593041180,
+        -0.380690406958820, 0.169395306766091, 0.380690406958820, 0.830604693233909,
+        -0.516320470827850, 0.169395306766091, 0.380690406958820, 0.966234757102939,
+        0.177529857295667, 0.169395306766091, 0.619309593041180, 0.0337652428970614,
+        0.0418997934266372, 0.169395306766091, 0.619309593041180, 0.169395306766091,
+        -0.169395306766091, 0.169395306766091, 0.619309593041180, 0.380690406958820,
+        -0.408014492848451, 0.169395306766091, 0.619309593041180, 0.619309593041180,
+        -0.619309593041180, 0.169395306766091, 0.619309593041180, 0.830604693233909,
+        -0.754939656910210, 0.169395306766091, 0.619309593041180, 0.966234757102939,
+        -0.0337652428970614, 0.169395306766091, 0.830604693233909, 0.0337652428970614,
+        -0.169395306766091, 0.169395306766091, 0.830604693233909, 0.169395306766091,
+        -0.380690406958820, 0.169395306766091, 0.830604693233909, 0.380690406958820,
+        -0.619309593041180, 0.169395306766091, 0.830604693233909, 0.619309593041180,
+        -0.830604693233909, 0.169395306766091, 0.830604693233909, 0.830604693233909,
+        -0.966234757102939, 0.169395306766091, 0.830604693233909, 0.966234757102939,
+        -0.169395306766091, 0.169395306766091, 0.966234757102939, 0.0337652428970614,
+        -0.305025370635121, 0.169395306766091, 0.966234757102939, 0.169395306766091,
+        -0.516320470827850, 0.169395306766091, 0.966234757102939, 0.380690406958820,
+        -0.754939656910210, 0.169395306766091, 0.966234757102939, 0.619309593041180,
+        -0.966234757102939, 0.169395306766091, 0.966234757102939, 0.830604693233909,
+        -1.10186482097197, 0.169395306766091, 0.966234757102939, 0.966234757102939,
+        0.551779107247057, 0.380690406958820, 0.0337652428970614, 0.0337652428970614,
+        0.416149043378027, 0.380690406958820, 0.0337652428970614, 0.169395306766091,
+        0.204853943185299, 0.380690406958820, 0.0337652428970614, 0.380690406958820,
+        -0.0337652428970614, 0.380690406958820, 0.0337652428970614, 0.619309593041180,
+        -0.245060343089790, 0.380690406958820, 0.0337652428970614, 0.830604693233909,
+        -0.380690406958820, 0.380690406958820, 0.0337652428970614, 0.966234757102939,
+        0.416149043378027, 0.380690406958820, 0.169395306766091, 0.0337652428970614,
+        0.280518979508997, 0.380690406958820, 0.169395306766091, 0.169395306766091,
+        0.0692238793162687, 0.380690406958820, 0.169395306766091, 0.380690406958820,
+        -0.169395306766091, 0.380690406958820, 0.169395306766091, 0.619309593041180,
+        -0.380690406958820, 0.380690406958820, 0.169395306766091, 0.830604693233909,
+        -0.516320470827850, 0.380690406958820, 0.169395306766091, 0.966234757102939,
+        0.204853943185299, 0.380690406958820, 0.380690406958820, 0.0337652428970614,
+        0.0692238793162687, 0.380690406958820, 0.380690406958820, 0.169395306766091,
+        -0.142071220876460, 0.380690406958820, 0.380690406958820, 0.380690406958820,
+        -0.380690406958820, 0.380690406958820, 0.380690406958820, 0.619309593041180,
+        -0.591985507151549, 0.380690406958820, 0.380690406958820, 0.830604693233909,
+        -0.727615571020578, 0.380690406958820, 0.380690406958820, 0.966234757102939,
+        -0.0337652428970614, 0.380690406958820, 0.619309593041180, 0.0337652428970614,
+        -0.169395306766091, 0.380690406958820, 0.619309593041180, 0.169395306766091,
+        -0.380690406958820, 0.380690406958820, 0.619309593041180, 0.380690406958820,
+        -0.619309593041180, 0.380690406958820, 0.619309593041180, 0.619309593041180,
+        -0.830604693233909, 0.380690406958820, 0.619309593041180, 0.830604693233909,
+        -0.966234757102939, 0.380690406958820, 0.619309593041180, 0.966234757102939,
+        -0.245060343089790, 0.380690406958820, 0.830604693233909, 0.0337652428970614,
+        -0.380690406958820, 0.380690406958820, 0.830604693233909, 0.169395306766091,
+        -0.591985507151549, 0.380690406958820, 0.830604693233909, 0.380690406958820,
+        -0.830604693233909, 0.380690406958820, 0.830604693233909, 0.619309593041180,
+        -1.04189979342664, 0.380690406958820, 0.830604693233909, 0.830604693233909,
+        -1.17752985729567, 0.380690406958820, 0.830604693233909, 0.966234757102939,
+        -0.380690406958820, 0.380690406958820, 0.966234757102939, 0.0337652428970614,
+        -0.516320470827850, 0.380690406958820, 0.966234757102939, 0.169395306766091,
+        -0.727615571020578, 0.380690406958820, 0.966234757102939, 0.380690406958820,
+        -0.966234757102939, 0.380690406958820, 0.966234757102939, 0.619309593041180,
+        -1.17752985729567, 0.380690406958820, 0.966234757102939, 0.830604693233909,
+        -1.31315992116470, 0.380690406958820, 0.966234757102939, 0.966234757102939,
+        0.313159921164697, 0.619309593041180, 0.0337652428970614, 0.0337652428970614,
+        0.177529857295667, 0.619309593041180, 0.0337652428970614, 0.169395306766091,
+        -0.0337652428970614, 0.619309593041180, 0.0337652428970614, 0.380690406958820,
+        -0.272384428979422, 0.619309593041180, 0.0337652428970614, 0.619309593041180,
+        -0.483679529172150, 0.619309593041180, 0.0337652428970614, 0.830604693233909,
+        -0.619309593041180, 0.619309593041180, 0.0337652428970614, 0.966234757102939,
+        0.177529857295667, 0.619309593041180, 0.169395306766091, 0.0337652428970614,
+        0.0418997934266372, 0.619309593041180, 0.169395306766091, 0.169395306766091,
+        -0.169395306766091, 0.619309593041180, 0.169395306766091, 0.380690406958820,
+        -0.408014492848451, 0.619309593041180, 0.169395306766091, 0.619309593041180,
+        -0.619309593041180, 0.619309593041180, 0.169395306766091, 0.830604693233909,
+        -0.754939656910210, 0.619309593041180, 0.169395306766091, 0.966234757102939,
+        -0.0337652428970614, 0.619309593041180, 0.380690406958820, 0.0337652428970614,
+        -0.169395306766091, 0.619309593041180, 0.380690406958820, 0.169395306766091,
+        -0.380690406958820, 0.619309593041180, 0.380690406958820, 0.380690406958820,
+        -0.619309593041180, 0.619309593041180, 0.380690406958820, 0.619309593041180,
+        -0.830604693233909, 0.619309593041180, 0.380690406958820, 0.830604693233909,
+        -0.966234757102939, 0.619309593041180, 0.380690406958820, 0.966234757102939,
+        -0.272384428979422, 0.619309593041180, 0.619309593041180, 0.0337652428970614,
+        -0.408014492848451, 0.619309593041180, 0.619309593041180, 0.169395306766091,
+        -0.619309593041180, 0.619309593041180, 0.619309593041180, 0.380690406958820,
+        -0.857928779123540, 0.619309593041180, 0.619309593041180, 0.619309593041180,
+        -1.06922387931627, 0.619309593041180, 0.619309593041180, 0.830604693233909,
+        -1.20485394318530, 0.619309593041180, 0.619309593041180, 0.966234757102939,
+        -0.483679529172150, 0.619309593041180, 0.830604693233909, 0.0337652428970614,
+        -0.619309593041180, 0.619309593041180, 0.830604693233909, 0.169395306766091,
+        -0.830604693233909, 0.619309593041180, 0.830604693233909, 0.380690406958820,
+        -1.06922387931627, 0.619309593041180, 0.830604693233909, 0.619309593041180,
+        -1.28051897950900, 0.619309593041180, 0.830604693233909, 0.830604693233909,
+        -1.41614904337803, 0.619309593041180, 0.830604693233909, 0.966234757102939,
+        -0.619309593041180, 0.619309593041180, 0.966234757102939, 0.0337652428970614,
+        -0.754939656910210, 0.619309593041180, 0.966234757102939, 0.169395306766091,
+        -0.966234757102939, 0.619309593041180, 0.966234757102939, 0.380690406958820,
+        -1.20485394318530, 0.619309593041180, 0.966234757102939, 0.619309593041180,
+        -1.41614904337803, 0.619309593041180, 0.966234757102939, 0.830604693233909,
+        -1.55177910724706, 0.619309593041180, 0.966234757102939, 0.966234757102939,
+        0.101864820971969, 0.830604693233909, 0.0337652428970614, 0.0337652428970614,
+        -0.0337652428970614, 0.830604693233909, 0.0337652428970614, 0.169395306766091,
+        -0.245060343089790, 0.830604693233909, 0.0337652428970614, 0.380690406958820,
+        -0.483679529172150, 0.830604693233909, 0.0337652428970614, 0.619309593041180,
+        -0.694974629364879, 0.830604693233909, 0.0337652428970614, 0.830604693233909,
+        -0.830604693233909, 0.830604693233909, 0.0337652428970614, 0.966234757102939,
+        -0.0337652428970614, 0.830604693233909, 0.169395306766091, 0.0337652428970614,
+        -0.169395306766091, 0.830604693233909, 0.169395306766091, 0.169395306766091,
+        -0.380690406958820, 0.830604693233909, 0.169395306766091, 0.380690406958820,
+        -0.619309593041180, 0.830604693233909, 0.169395306766091, 0.619309593041180,
+        -0.830604693233909, 0.830604693233909, 0.169395306766091, 0.830604693233909,
+        -0.966234757102939, 0.830604693233909, 0.169395306766091, 0.966234757102939,
+        -0.245060343089790, 0.830604693233909, 0.380690406958820, 0.0337652428970614,
+        -0.380690406958820, 0.830604693233909, 0.380690406958820, 0.169395306766091,
+        -0.591985507151549, 0.830604693233909, 0.380690406958820, 0.380690406958820,
+        -0.830604693233909, 0.830604693233909, 0.380690406958820, 0.619309593041180,
+        -1.04189979342664, 0.830604693233909, 0.380690406958820, 0.830604693233909,
+        -1.17752985729567, 0.830604693233909, 0.380690406958820, 0.966234757102939,
+        -0.483679529172150, 0.830604693233909, 0.619309593041180, 0.0337652428970614,
+        -0.619309593041180, 0.830604693233909, 0.619309593041180, 0.169395306766091,
+        -0.830604693233909, 0.830604693233909, 0.619309593041180, 0.380690406958820,
+        -1.06922387931627, 0.830604693233909, 0.619309593041180, 0.619309593041180,
+        -1.28051897950900, 0.830604693233909, 0.619309593041180, 0.830604693233909,
+        -1.41614904337803, 0.830604693233909, 0.619309593041180, 0.966234757102939,
+        -0.694974629364879, 0.830604693233909, 0.830604693233909, 0.0337652428970614,
+        -0.830604693233909, 0.830604693233909, 0.830604693233909, 0.169395306766091,
+        -1.04189979342664, 0.830604693233909, 0.830604693233909, 0.380690406958820,
+        -1.28051897950900, 0.830604693233909, 0.830604693233909, 0.619309593041180,
+        -1.49181407970173, 0.830604693233909, 0.830604693233909, 0.830604693233909,
+        -1.62744414357076, 0.830604693233909, 0.830604693233909, 0.966234757102939,
+        -0.830604693233909, 0.830604693233909, 0.966234757102939, 0.0337652428970614,
+        -0.966234757102939, 0.830604693233909, 0.966234757102939, 0.169395306766091,
+        -1.17752985729567, 0.830604693233909, 0.966234757102939, 0.380690406958820,
+        -1.41614904337803, 0.830604693233909, 0.966234757102939, 0.619309593041180,
+        -1.62744414357076, 0.830604693233909, 0.966234757102939, 0.830604693233909,
+        -1.76307420743979, 0.830604693233909, 0.966234757102939, 0.966234757102939,
+        -0.0337652428970614, 0.966234757102939, 0.0337652428970614, 0.0337652428970614,
+        -0.169395306766091, 0.966234757102939, 0.0337652428970614, 0.169395306766091,
+        -0.380690406958820, 0.966234757102939, 0.0337652428970614, 0.380690406958820,
+        -0.619309593041180, 0.966234757102939, 0.0337652428970614, 0.619309593041180,
+        -0.830604693233909, 0.966234757102939, 0.0337652428970614, 0.830604693233909,
+        -0.966234757102939, 0.966234757102939, 0.0337652428970614, 0.966234757102939,
+        -0.169395306766091, 0.966234757102939, 0.169395306766091, 0.0337652428970614,
+        -0.305025370635121, 0.966234757102939, 0.169395306766091, 0.169395306766091,
+        -0.516320470827850, 0.966234757102939, 0.169395306766091, 0.380690406958820,
+        -0.754939656910210, 0.966234757102939, 0.169395306766091, 0.619309593041180,
+        -0.966234757102939, 0.966234757102939, 0.169395306766091, 0.830604693233909,
+        -1.10186482097197, 0.966234757102939, 0.169395306766091, 0.966234757102939,
+        -0.380690406958820, 0.966234757102939, 0.380690406958820, 0.0337652428970614,
+        -0.516320470827850, 0.966234757102939, 0.380690406958820, 0.169395306766091,
+        -0.727615571020578, 0.966234757102939, 0.380690406958820, 0.380690406958820,
+        -0.966234757102939, 0.966234757102939, 0.380690406958820, 0.619309593041180,
+        -1.17752985729567, 0.966234757102939, 0.380690406958820, 0.830604693233909,
+        -1.31315992116470, 0.966234757102939, 0.380690406958820, 0.966234757102939,
+        -0.619309593041180, 0.966234757102939, 0.619309593041180, 0.0337652428970614,
+        -0.754939656910210, 0.966234757102939, 0.619309593041180, 0.169395306766091,
+        -0.966234757102939, 0.966234757102939, 0.619309593041180, 0.380690406958820,
+        -1.20485394318530, 0.966234757102939, 0.619309593041180, 0.619309593041180,
+        -1.41614904337803, 0.966234757102939, 0.619309593041180, 0.830604693233909,
+        -1.55177910724706, 0.966234757102939, 0.619309593041180, 0.966234757102939,
+        -0.830604693233909, 0.966234757102939, 0.830604693233909, 0.0337652428970614,
+        -0.966234757102939, 0.966234757102939, 0.830604693233909, 0.169395306766091,
+        -1.17752985729567, 0.966234757102939, 0.830604693233909, 0.380690406958820,
+        -1.41614904337803, 0.966234757102939, 0.830604693233909, 0.619309593041180,
+        -1.62744414357076, 0.966234757102939, 0.830604693233909, 0.830604693233909,
+        -1.76307420743979, 0.966234757102939, 0.830604693233909, 0.966234757102939,
+        -0.966234757102939, 0.966234757102939, 0.966234757102939, 0.0337652428970614,
+        -1.10186482097197, 0.966234757102939, 0.966234757102939, 0.169395306766091,
+        -1.31315992116470, 0.966234757102939, 0.966234757102939, 0.380690406958820,
+        -1.55177910724706, 0.966234757102939, 0.966234757102939, 0.619309593041180,
+        -1.76307420743979, 0.966234757102939, 0.966234757102939, 0.830604693233909,
+        -1.89870427130882, 0.966234757102939, 0.966234757102939, 0.966234757102939};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.000628591311957382, 0.00132363789529424,  0.00171678100387522,  0.00171678100387522,
         0.00132363789529424,  0.000628591311957382, 0.00132363789529424,  0.00278721204784605,
@@ -2305,349 +1498,349 @@ struct GaussLegendreQuadrature<3, 7>
     inline static std::uint8_t constexpr kOrder                              = 7;
     inline static int constexpr kPoints                                      = 343;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.923661868509953,   0.819873505141004,   0.652030488028686,   0.449107912339969,
-        0.246185336651251,   0.0783423195389332,  -0.0254460438300157, 0.819873505141004,
-        0.716085141772055,   0.548242124659737,   0.345319548971020,   0.142396973282302,
-        -0.0254460438300157, -0.129234407198965,  0.652030488028686,   0.548242124659737,
-        0.380399107547419,   0.177476531858701,   -0.0254460438300157, -0.193289060942334,
-        -0.297077424311283,  0.449107912339969,   0.345319548971020,   0.177476531858701,
-        -0.0254460438300157, -0.228368619518733,  -0.396211636631051,  -0.500000000000000,
-        0.246185336651251,   0.142396973282302,   -0.0254460438300157, -0.228368619518733,
-        -0.431291195207450,  -0.599134212319768,  -0.702922575688717,  0.0783423195389332,
-        -0.0254460438300157, -0.193289060942334,  -0.396211636631051,  -0.599134212319768,
-        -0.766977229432086,  -0.870765592801035,  -0.0254460438300157, -0.129234407198965,
-        -0.297077424311283,  -0.500000000000000,  -0.702922575688717,  -0.870765592801035,
-        -0.974553956169984,  0.819873505141004,   0.716085141772055,   0.548242124659737,
-        0.345319548971020,   0.142396973282302,   -0.0254460438300157, -0.129234407198965,
-        0.716085141772055,   0.612296778403106,   0.444453761290788,   0.241531185602071,
-        0.0386086099133536,  -0.129234407198965,  -0.233022770567914,  0.548242124659737,
-        0.444453761290788,   0.276610744178470,   0.0736881684897526,  -0.129234407198965,
-        -0.297077424311283,  -0.400865787680232,  0.345319548971020,   0.241531185602071,
-        0.0736881684897526,  -0.129234407198965,  -0.332156982887682,  -0.500000000000000,
-        -0.603788363368949,  0.142396973282302,   0.0386086099133536,  -0.129234407198965,
-        -0.332156982887682,  -0.535079558576399,  -0.702922575688717,  -0.806710939057666,
-        -0.0254460438300157, -0.129234407198965,  -0.297077424311283,  -0.500000000000000,
-        -0.702922575688717,  -0.870765592801035,  -0.974553956169984,  -0.129234407198965,
-        -0.233022770567914,  -0.400865787680232,  -0.603788363368949,  -0.806710939057666,
-        -0.974553956169984,  -1.07834231953893,   0.652030488028686,   0.548242124659737,
-        0.380399107547419,   0.177476531858701,   -0.0254460438300157, -0.193289060942334,
-        -0.297077424311283,  0.548242124659737,   0.444453761290788,   0.276610744178470,
-        0.0736881684897526,  -0.129234407198965,  -0.297077424311283,  -0.400865787680232,
-        0.380399107547419,   0.276610744178470,   0.108767727066152,   -0.0941548486225656,
-        -0.297077424311283,  -0.464920441423601,  -0.568708804792550,  0.177476531858701,
-        0.0736881684897526,  -0.0941548486225656, -0.297077424311283,  -0.500000000000000,
-        -0.667843017112318,  -0.771631380481267,  -0.0254460438300157, -0.129234407198965,
-        -0.297077424311283,  -0.500000000000000,  -0.702922575688717,  -0.870765592801035,
-        -0.974553956169984,  -0.193289060942334,  -0.297077424311283,  -0.464920441423601,
-        -0.667843017112318,  -0.870765592801035,  -1.03860860991335,   -1.14239697328230,
-        -0.297077424311283,  -0.400865787680232,  -0.568708804792550,  -0.771631380481267,
-        -0.974553956169984,  -1.14239697328230,   -1.24618533665125,   0.449107912339969,
-        0.345319548971020,   0.177476531858701,   -0.0254460438300157, -0.228368619518733,
-        -0.396211636631051,  -0.500000000000000,  0.345319548971020,   0.241531185602071,
-        0.0736881684897526,  -0.129234407198965,  -0.332156982887682,  -0.500000000000000,
-        -0.603788363368949,  0.177476531858701,   0.0736881684897526,  -0.0941548486225656,
-        -0.297077424311283,  -0.500000000000000,  -0.667843017112318,  -0.771631380481267,
-        -0.0254460438300157, -0.129234407198965,  -0.297077424311283,  -0.500000000000000,
-        -0.702922575688717,  -0.870765592801035,  -0.974553956169984,  -0.228368619518733,
-        -0.332156982887682,  -0.500000000000000,  -0.702922575688717,  -0.905845151377434,
-        -1.07368816848975,   -1.17747653185870,   -0.396211636631051,  -0.500000000000000,
-        -0.667843017112318,  -0.870765592801035,  -1.07368816848975,   -1.24153118560207,
-        -1.34531954897102,   -0.500000000000000,  -0.603788363368949,  -0.771631380481267,
-        -0.974553956169984,  -1.17747653185870,   -1.34531954897102,   -1.44910791233997,
-        0.246185336651251,   0.142396973282302,   -0.0254460438300157, -0.228368619518733,
-        -0.431291195207450,  -0.599134212319768,  -0.702922575688717,  0.142396973282302,
-        0.0386086099133536,  -0.129234407198965,  -0.332156982887682,  -0.535079558576399,
-        -0.702922575688717,  -0.806710939057666,  -0.0254460438300157, -0.129234407198965,
-        -0.297077424311283,  -0.500000000000000,  -0.702922575688717,  -0.870765592801035,
-        -0.974553956169984,  -0.228368619518733,  -0.332156982887682,  -0.500000000000000,
-        -0.702922575688717,  -0.905845151377434,  -1.07368816848975,   -1.17747653185870,
-        -0.431291195207450,  -0.535079558576399,  -0.702922575688717,  -0.905845151377434,
-        -1.10876772706615,   -1.27661074417847,   -1.38039910754742,   -0.599134212319768,
-        -0.702922575688717,  -0.870765592801035,  -1.07368816848975,   -1.27661074417847,
-        -1.44445376129079,   -1.54824212465974,   -0.702922575688717,  -0.806710939057666,
-        -0.974553956169984,  -1.17747653185870,   -1.38039910754742,   -1.54824212465974,
-        -1.65203048802869,   0.0783423195389332,  -0.0254460438300157, -0.193289060942334,
-        -0.396211636631051,  -0.599134212319768,  -0.766977229432086,  -0.870765592801035,
-        -0.0254460438300157, -0.129234407198965,  -0.297077424311283,  -0.500000000000000,
-        -0.702922575688717,  -0.870765592801035,  -0.974553956169984,  -0.193289060942334,
-        -0.297077424311283,  -0.464920441423601,  -0.667843017112318,  -0.870765592801035,
-        -1.03860860991335,   -1.14239697328230,   -0.396211636631051,  -0.500000000000000,
-        -0.667843017112318,  -0.870765592801035,  -1.07368816848975,   -1.24153118560207,
-        -1.34531954897102,   -0.599134212319768,  -0.702922575688717,  -0.870765592801035,
-        -1.07368816848975,   -1.27661074417847,   -1.44445376129079,   -1.54824212465974,
-        -0.766977229432086,  -0.870765592801035,  -1.03860860991335,   -1.24153118560207,
-        -1.44445376129079,   -1.61229677840311,   -1.71608514177206,   -0.870765592801035,
-        -0.974553956169984,  -1.14239697328230,   -1.34531954897102,   -1.54824212465974,
-        -1.71608514177206,   -1.81987350514100,   -0.0254460438300157, -0.129234407198965,
-        -0.297077424311283,  -0.500000000000000,  -0.702922575688717,  -0.870765592801035,
-        -0.974553956169984,  -0.129234407198965,  -0.233022770567914,  -0.400865787680232,
-        -0.603788363368949,  -0.806710939057666,  -0.974553956169984,  -1.07834231953893,
-        -0.297077424311283,  -0.400865787680232,  -0.568708804792550,  -0.771631380481267,
-        -0.974553956169984,  -1.14239697328230,   -1.24618533665125,   -0.500000000000000,
-        -0.603788363368949,  -0.771631380481267,  -0.974553956169984,  -1.17747653185870,
-        -1.34531954897102,   -1.44910791233997,   -0.702922575688717,  -0.806710939057666,
-        -0.974553956169984,  -1.17747653185870,   -1.38039910754742,   -1.54824212465974,
-        -1.65203048802869,   -0.870765592801035,  -0.974553956169984,  -1.14239697328230,
-        -1.34531954897102,   -1.54824212465974,   -1.71608514177206,   -1.81987350514100,
-        -0.974553956169984,  -1.07834231953893,   -1.24618533665125,   -1.44910791233997,
-        -1.65203048802869,   -1.81987350514100,   -1.92366186850995,   0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.0254460438300157,
-        0.0254460438300157,  0.0254460438300157,  0.0254460438300157,  0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.129234407198965,   0.129234407198965,
-        0.129234407198965,   0.129234407198965,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.297077424311283,   0.297077424311283,   0.297077424311283,
-        0.297077424311283,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,   0.500000000000000,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.702922575688717,
-        0.702922575688717,   0.702922575688717,   0.702922575688717,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.870765592801035,   0.870765592801035,
-        0.870765592801035,   0.870765592801035,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.974553956169984,   0.974553956169984,   0.974553956169984,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984,
-        0.0254460438300157,  0.129234407198965,   0.297077424311283,   0.500000000000000,
-        0.702922575688717,   0.870765592801035,   0.974553956169984,   0.0254460438300157,
-        0.129234407198965,   0.297077424311283,   0.500000000000000,   0.702922575688717,
-        0.870765592801035,   0.974553956169984,   0.0254460438300157,  0.129234407198965,
-        0.297077424311283,   0.500000000000000,   0.702922575688717,   0.870765592801035,
-        0.974553956169984,   0.0254460438300157,  0.129234407198965,   0.297077424311283,
-        0.500000000000000,   0.702922575688717,   0.870765592801035,   0.974553956169984};
+        0.923661868509953, 0.0254460438300157, 0.0254460438300157, 0.0254460438300157,
+        0.819873505141004, 0.0254460438300157, 0.0254460438300157, 0.129234407198965,
+        0.652030488028686, 0.0254460438300157, 0.0254460438300157, 0.297077424311283,
+        0.449107912339969, 0.0254460438300157, 0.0254460438300157, 0.500000000000000,
+        0.246185336651251, 0.0254460438300157, 0.0254460438300157, 0.702922575688717,
+        0.0783423195389332, 0.0254460438300157, 0.0254460438300157, 0.870765592801035,
+        -0.0254460438300157, 0.0254460438300157, 0.0254460438300157, 0.974553956169984,
+        0.819873505141004, 0.0254460438300157, 0.129234407198965, 0.0254460438300157,
+        0.716085141772055, 0.0254460438300157, 0.129234407198965, 0.129234407198965,
+        0.548242124659737, 0.0254460438300157, 0.129234407198965, 0.297077424311283,
+        0.345319548971020, 0.0254460438300157, 0.129234407198965, 0.500000000000000,
+        0.142396973282302, 0.0254460438300157, 0.129234407198965, 0.702922575688717,
+        -0.0254460438300157, 0.0254460438300157, 0.129234407198965, 0.870765592801035,
+        -0.129234407198965, 0.0254460438300157, 0.129234407198965, 0.974553956169984,
+        0.652030488028686, 0.0254460438300157, 0.297077424311283, 0.0254460438300157,
+        0.548242124659737, 0.0254460438300157, 0.297077424311283, 0.129234407198965,
+        0.380399107547419, 0.0254460438300157, 0.297077424311283, 0.297077424311283,
+        0.177476531858701, 0.0254460438300157, 0.297077424311283, 0.500000000000000,
+        -0.0254460438300157, 0.0254460438300157, 0.297077424311283, 0.702922575688717,
+        -0.193289060942334, 0.0254460438300157, 0.297077424311283, 0.870765592801035,
+        -0.297077424311283, 0.0254460438300157, 0.297077424311283, 0.974553956169984,
+        0.449107912339969, 0.0254460438300157, 0.500000000000000, 0.0254460438300157,
+        0.345319548971020, 0.0254460438300157, 0.500000000000000, 0.129234407198965,
+        0.177476531858701, 0.0254460438300157, 0.500000000000000, 0.297077424311283,
+        -0.0254460438300157, 0.0254460438300157, 0.500000000000000, 0.500000000000000,
+        -0.228368619518733, 0.0254460438300157, 0.500000000000000, 0.702922575688717,
+        -0.396211636631051, 0.0254460438300157, 0.500000000000000, 0.870765592801035,
+        -0.500000000000000, 0.0254460438300157, 0.500000000000000, 0.974553956169984,
+        0.246185336651251, 0.0254460438300157, 0.702922575688717, 0.0254460438300157,
+        0.142396973282302, 0.0254460438300157, 0.702922575688717, 0.129234407198965,
+        -0.0254460438300157, 0.0254460438300157, 0.702922575688717, 0.297077424311283,
+        -0.228368619518733, 0.0254460438300157, 0.702922575688717, 0.500000000000000,
+        -0.431291195207450, 0.0254460438300157, 0.702922575688717, 0.702922575688717,
+        -0.599134212319768, 0.0254460438300157, 0.702922575688717, 0.870765592801035,
+        -0.702922575688717, 0.0254460438300157, 0.702922575688717, 0.974553956169984,
+        0.0783423195389332, 0.0254460438300157, 0.870765592801035, 0.0254460438300157,
+        -0.0254460438300157, 0.0254460438300157, 0.870765592801035, 0.129234407198965,
+        -0.193289060942334, 0.0254460438300157, 0.870765592801035, 0.297077424311283,
+        -0.396211636631051, 0.0254460438300157, 0.870765592801035, 0.500000000000000,
+        -0.599134212319768, 0.0254460438300157, 0.870765592801035, 0.702922575688717,
+        -0.766977229432086, 0.0254460438300157, 0.870765592801035, 0.870765592801035,
+        -0.870765592801035, 0.0254460438300157, 0.870765592801035, 0.974553956169984,
+        -0.0254460438300157, 0.0254460438300157, 0.974553956169984, 0.0254460438300157,
+        -0.129234407198965, 0.0254460438300157, 0.974553956169984, 0.129234407198965,
+        -0.297077424311283, 0.0254460438300157, 0.974553956169984, 0.297077424311283,
+        -0.500000000000000, 0.0254460438300157, 0.974553956169984, 0.500000000000000,
+        -0.702922575688717, 0.0254460438300157, 0.974553956169984, 0.702922575688717,
+        -0.870765592801035, 0.0254460438300157, 0.974553956169984, 0.870765592801035,
+        -0.974553956169984, 0.0254460438300157, 0.974553956169984, 0.974553956169984,
+        0.819873505141004, 0.129234407198965, 0.0254460438300157, 0.0254460438300157,
+        0.716085141772055, 0.129234407198965, 0.0254460438300157, 0.129234407198965,
+        0.548242124659737, 0.129234407198965, 0.0254460438300157, 0.297077424311283,
+        0.345319548971020, 0.129234407198965, 0.0254460438300157, 0.500000000000000,
+        0.142396973282302, 0.129234407198965, 0.0254460438300157, 0.702922575688717,
+        -0.0254460438300157, 0.129234407198965, 0.0254460438300157, 0.870765592801035,
+        -0.129234407198965, 0.129234407198965, 0.0254460438300157, 0.974553956169984,
+        0.716085141772055, 0.129234407198965, 0.129234407198965, 0.0254460438300157,
+        0.612296778403106, 0.129234407198965, 0.129234407198965, 0.129234407198965,
+        0.444453761290788, 0.129234407198965, 0.129234407198965, 0.297077424311283,
+        0.241531185602071, 0.129234407198965, 0.129234407198965, 0.500000000000000,
+        0.0386086099133536, 0.129234407198965, 0.129234407198965, 0.702922575688717,
+        -0.129234407198965, 0.129234407198965, 0.129234407198965, 0.870765592801035,
+        -0.233022770567914, 0.129234407198965, 0.129234407198965, 0.974553956169984,
+        0.548242124659737, 0.129234407198965, 0.297077424311283, 0.0254460438300157,
+        0.444453761290788, 0.129234407198965, 0.297077424311283, 0.129234407198965,
+        0.276610744178470, 0.129234407198965, 0.297077424311283, 0.297077424311283,
+        0.0736881684897526, 0.129234407198965, 0.297077424311283, 0.500000000000000,
+        -0.129234407198965, 0.129234407198965, 0.297077424311283, 0.702922575688717,
+        -0.297077424311283, 0.129234407198965, 0.297077424311283, 0.870765592801035,
+        -0.400865787680232, 0.129234407198965, 0.297077424311283, 0.974553956169984,
+        0.345319548971020, 0.129234407198965, 0.500000000000000, 0.0254460438300157,
+        0.241531185602071, 0.129234407198965, 0.500000000000000, 0.129234407198965,
+        0.0736881684897526, 0.129234407198965, 0.500000000000000, 0.297077424311283,
+        -0.129234407198965, 0.129234407198965, 0.500000000000000, 0.500000000000000,
+        -0.332156982887682, 0.129234407198965, 0.500000000000000, 0.702922575688717,
+        -0.500000000000000, 0.129234407198965, 0.500000000000000, 0.870765592801035,
+        -0.603788363368949, 0.129234407198965, 0.500000000000000, 0.974553956169984,
+        0.142396973282302, 0.129234407198965, 0.702922575688717, 0.0254460438300157,
+        0.0386086099133536, 0.129234407198965, 0.702922575688717, 0.129234407198965,
+        -0.129234407198965, 0.129234407198965, 0.702922575688717, 0.297077424311283,
+        -0.332156982887682, 0.129234407198965, 0.702922575688717, 0.500000000000000,
+        -0.535079558576399, 0.129234407198965, 0.702922575688717, 0.702922575688717,
+        -0.702922575688717, 0.129234407198965, 0.702922575688717, 0.870765592801035,
+        -0.806710939057666, 0.129234407198965, 0.702922575688717, 0.974553956169984,
+        -0.0254460438300157, 0.129234407198965, 0.870765592801035, 0.0254460438300157,
+        -0.129234407198965, 0.129234407198965, 0.870765592801035, 0.129234407198965,
+        -0.297077424311283, 0.129234407198965, 0.870765592801035, 0.297077424311283,
+        -0.500000000000000, 0.129234407198965, 0.870765592801035, 0.500000000000000,
+        -0.702922575688717, 0.129234407198965, 0.870765592801035, 0.702922575688717,
+        -0.870765592801035, 0.129234407198965, 0.870765592801035, 0.870765592801035,
+        -0.974553956169984, 0.129234407198965, 0.870765592801035, 0.974553956169984,
+        -0.129234407198965, 0.129234407198965, 0.974553956169984, 0.0254460438300157,
+        -0.233022770567914, 0.129234407198965, 0.974553956169984, 0.129234407198965,
+        -0.400865787680232, 0.129234407198965, 0.974553956169984, 0.297077424311283,
+        -0.603788363368949, 0.129234407198965, 0.974553956169984, 0.500000000000000,
+        -0.806710939057666, 0.129234407198965, 0.974553956169984, 0.702922575688717,
+        -0.974553956169984, 0.129234407198965, 0.974553956169984, 0.870765592801035,
+        -1.07834231953893, 0.129234407198965, 0.974553956169984, 0.974553956169984,
+        0.652030488028686, 0.297077424311283, 0.0254460438300157, 0.0254460438300157,
+        0.548242124659737, 0.297077424311283, 0.0254460438300157, 0.129234407198965,
+        0.380399107547419, 0.297077424311283, 0.0254460438300157, 0.297077424311283,
+        0.177476531858701, 0.297077424311283, 0.0254460438300157, 0.500000000000000,
+        -0.0254460438300157, 0.297077424311283, 0.0254460438300157, 0.702922575688717,
+        -0.193289060942334, 0.297077424311283, 0.0254460438300157, 0.870765592801035,
+        -0.297077424311283, 0.297077424311283, 0.0254460438300157, 0.974553956169984,
+        0.548242124659737, 0.297077424311283, 0.129234407198965, 0.0254460438300157,
+        0.444453761290788, 0.297077424311283, 0.129234407198965, 0.129234407198965,
+        0.276610744178470, 0.297077424311283, 0.129234407198965, 0.297077424311283,
+        0.0736881684897526, 0.297077424311283, 0.129234407198965, 0.500000000000000,
+        -0.129234407198965, 0.297077424311283, 0.129234407198965, 0.702922575688717,
+        -0.297077424311283, 0.297077424311283, 0.129234407198965, 0.870765592801035,
+        -0.400865787680232, 0.297077424311283, 0.129234407198965, 0.974553956169984,
+        0.380399107547419, 0.297077424311283, 0.297077424311283, 0.0254460438300157,
+        0.276610744178470, 0.297077424311283, 0.297077424311283, 0.129234407198965,
+        0.108767727066152, 0.297077424311283, 0.297077424311283, 0.297077424311283,
+        -0.0941548486225656, 0.297077424311283, 0.297077424311283, 0.500000000000000,
+        -0.297077424311283, 0.297077424311283, 0.297077424311283, 0.702922575688717,
+        -0.464920441423601, 0.297077424311283, 0.297077424311283, 0.870765592801035,
+        -0.568708804792550, 0.297077424311283, 0.297077424311283, 0.974553956169984,
+        0.177476531858701, 0.297077424311283, 0.500000000000000, 0.0254460438300157,
+        0.0736881684897526, 0.297077424311283, 0.500000000000000, 0.129234407198965,
+        -0.0941548486225656, 0.297077424311283, 0.500000000000000, 0.297077424311283,
+        -0.297077424311283, 0.297077424311283, 0.500000000000000, 0.500000000000000,
+        -0.500000000000000, 0.297077424311283, 0.500000000000000, 0.702922575688717,
+        -0.667843017112318, 0.297077424311283, 0.500000000000000, 0.870765592801035,
+        -0.771631380481267, 0.297077424311283, 0.500000000000000, 0.974553956169984,
+        -0.0254460438300157, 0.297077424311283, 0.702922575688717, 0.0254460438300157,
+        -0.129234407198965, 0.297077424311283, 0.702922575688717, 0.129234407198965,
+        -0.297077424311283, 0.297077424311283, 0.702922575688717, 0.297077424311283,
+        -0.500000000000000, 0.297077424311283, 0.702922575688717, 0.500000000000000,
+        -0.702922575688717, 0.297077424311283, 0.702922575688717, 0.702922575688717,
+        -0.870765592801035, 0.297077424311283, 0.702922575688717, 0.870765592801035,
+        -0.974553956169984, 0.297077424311283, 0.702922575688717, 0.974553956169984,
+        -0.193289060942334, 0.297077424311283, 0.870765592801035, 0.0254460438300157,
+        -0.297077424311283, 0.297077424311283, 0.870765592801035, 0.129234407198965,
+        -0.464920441423601, 0.297077424311283, 0.870765592801035, 0.297077424311283,
+        -0.667843017112318, 0.297077424311283, 0.870765592801035, 0.500000000000000,
+        -0.870765592801035, 0.297077424311283, 0.870765592801035, 0.702922575688717,
+        -1.03860860991335, 0.297077424311283, 0.870765592801035, 0.870765592801035,
+        -1.14239697328230, 0.297077424311283, 0.870765592801035, 0.974553956169984,
+        -0.297077424311283, 0.297077424311283, 0.974553956169984, 0.0254460438300157,
+        -0.400865787680232, 0.297077424311283, 0.974553956169984, 0.129234407198965,
+        -0.568708804792550, 0.297077424311283, 0.974553956169984, 0.297077424311283,
+        -0.771631380481267, 0.297077424311283, 0.974553956169984, 0.500000000000000,
+        -0.974553956169984, 0.297077424311283, 0.974553956169984, 0.702922575688717,
+        -1.14239697328230, 0.297077424311283, 0.974553956169984, 0.870765592801035,
+        -1.24618533665125, 0.297077424311283, 0.974553956169984, 0.974553956169984,
+        0.449107912339969, 0.500000000000000, 0.0254460438300157, 0.0254460438300157,
+        0.345319548971020, 0.500000000000000, 0.0254460438300157, 0.129234407198965,
+        0.177476531858701, 0.500000000000000, 0.0254460438300157, 0.297077424311283,
+        -0.0254460438300157, 0.500000000000000, 0.0254460438300157, 0.500000000000000,
+        -0.228368619518733, 0.500000000000000, 0.0254460438300157, 0.702922575688717,
+        -0.396211636631051, 0.500000000000000, 0.0254460438300157, 0.870765592801035,
+        -0.500000000000000, 0.500000000000000, 0.0254460438300157, 0.974553956169984,
+        0.345319548971020, 0.500000000000000, 0.129234407198965, 0.0254460438300157,
+        0.241531185602071, 0.500000000000000, 0.129234407198965, 0.129234407198965,
+        0.0736881684897526, 0.500000000000000, 0.129234407198965, 0.297077424311283,
+        -0.129234407198965, 0.500000000000000, 0.129234407198965, 0.500000000000000,
+        -0.332156982887682, 0.500000000000000, 0.129234407198965, 0.702922575688717,
+        -0.500000000000000, 0.500000000000000, 0.129234407198965, 0.870765592801035,
+        -0.603788363368949, 0.500000000000000, 0.129234407198965, 0.974553956169984,
+        0.177476531858701, 0.500000000000000, 0.297077424311283, 0.0254460438300157,
+        0.0736881684897526, 0.500000000000000, 0.297077424311283, 0.129234407198965,
+        -0.0941548486225656, 0.500000000000000, 0.297077424311283, 0.297077424311283,
+        -0.297077424311283, 0.500000000000000, 0.297077424311283, 0.500000000000000,
+        -0.500000000000000, 0.500000000000000, 0.297077424311283, 0.702922575688717,
+        -0.667843017112318, 0.500000000000000, 0.297077424311283, 0.870765592801035,
+        -0.771631380481267, 0.500000000000000, 0.297077424311283, 0.974553956169984,
+        -0.0254460438300157, 0.500000000000000, 0.500000000000000, 0.0254460438300157,
+        -0.129234407198965, 0.500000000000000, 0.500000000000000, 0.129234407198965,
+        -0.297077424311283, 0.500000000000000, 0.500000000000000, 0.297077424311283,
+        -0.500000000000000, 0.500000000000000, 0.500000000000000, 0.500000000000000,
+        -0.702922575688717, 0.500000000000000, 0.500000000000000, 0.702922575688717,
+        -0.870765592801035, 0.500000000000000, 0.500000000000000, 0.870765592801035,
+        -0.974553956169984, 0.500000000000000, 0.500000000000000, 0.974553956169984,
+        -0.228368619518733, 0.500000000000000, 0.702922575688717, 0.0254460438300157,
+        -0.332156982887682, 0.500000000000000, 0.702922575688717, 0.129234407198965,
+        -0.500000000000000, 0.500000000000000, 0.702922575688717, 0.297077424311283,
+        -0.702922575688717, 0.500000000000000, 0.702922575688717, 0.500000000000000,
+        -0.905845151377434, 0.500000000000000, 0.702922575688717, 0.702922575688717,
+        -1.07368816848975, 0.500000000000000, 0.702922575688717, 0.870765592801035,
+        -1.17747653185870, 0.500000000000000, 0.702922575688717, 0.974553956169984,
+        -0.396211636631051, 0.500000000000000, 0.870765592801035, 0.0254460438300157,
+        -0.500000000000000, 0.500000000000000, 0.870765592801035, 0.129234407198965,
+        -0.667843017112318, 0.500000000000000, 0.870765592801035, 0.297077424311283,
+        -0.870765592801035, 0.500000000000000, 0.870765592801035, 0.500000000000000,
+        -1.07368816848975, 0.500000000000000, 0.870765592801035, 0.702922575688717,
+        -1.24153118560207, 0.500000000000000, 0.870765592801035, 0.870765592801035,
+        -1.34531954897102, 0.500000000000000, 0.870765592801035, 0.974553956169984,
+        -0.500000000000000, 0.500000000000000, 0.974553956169984, 0.0254460438300157,
+        -0.603788363368949, 0.500000000000000, 0.974553956169984, 0.129234407198965,
+        -0.771631380481267, 0.500000000000000, 0.974553956169984, 0.297077424311283,
+        -0.974553956169984, 0.500000000000000, 0.974553956169984, 0.500000000000000,
+        -1.17747653185870, 0.500000000000000, 0.974553956169984, 0.702922575688717,
+        -1.34531954897102, 0.500000000000000, 0.974553956169984, 0.870765592801035,
+        -1.44910791233997, 0.500000000000000, 0.974553956169984, 0.974553956169984,
+        0.246185336651251, 0.702922575688717, 0.0254460438300157, 0.0254460438300157,
+        0.142396973282302, 0.702922575688717, 0.0254460438300157, 0.129234407198965,
+        -0.0254460438300157, 0.702922575688717, 0.0254460438300157, 0.297077424311283,
+        -0.228368619518733, 0.702922575688717, 0.0254460438300157, 0.500000000000000,
+        -0.431291195207450, 0.702922575688717, 0.0254460438300157, 0.702922575688717,
+        -0.599134212319768, 0.702922575688717, 0.0254460438300157, 0.870765592801035,
+        -0.702922575688717, 0.702922575688717, 0.0254460438300157, 0.974553956169984,
+        0.142396973282302, 0.702922575688717, 0.129234407198965, 0.0254460438300157,
+        0.0386086099133536, 0.702922575688717, 0.129234407198965, 0.129234407198965,
+        -0.129234407198965, 0.702922575688717, 0.129234407198965, 0.297077424311283,
+        -0.332156982887682, 0.702922575688717, 0.129234407198965, 0.500000000000000,
+        -0.535079558576399, 0.702922575688717, 0.129234407198965, 0.702922575688717,
+        -0.702922575688717, 0.702922575688717, 0.129234407198965, 0.870765592801035,
+        -0.806710939057666, 0.702922575688717, 0.129234407198965, 0.974553956169984,
+        -0.0254460438300157, 0.702922575688717, 0.297077424311283, 0.0254460438300157,
+        -0.129234407198965, 0.702922575688717, 0.297077424311283, 0.129234407198965,
+        -0.297077424311283, 0.702922575688717, 0.297077424311283, 0.297077424311283,
+        -0.500000000000000, 0.702922575688717, 0.297077424311283, 0.500000000000000,
+        -0.702922575688717, 0.702922575688717, 0.297077424311283, 0.702922575688717,
+        -0.870765592801035, 0.702922575688717, 0.297077424311283, 0.870765592801035,
+        -0.974553956169984, 0.702922575688717, 0.297077424311283, 0.974553956169984,
+        -0.228368619518733, 0.702922575688717, 0.500000000000000, 0.0254460438300157,
+        -0.332156982887682, 0.702922575688717, 0.500000000000000, 0.129234407198965,
+        -0.500000000000000, 0.702922575688717, 0.500000000000000, 0.297077424311283,
+        -0.702922575688717, 0.702922575688717, 0.500000000000000, 0.500000000000000,
+        -0.905845151377434, 0.702922575688717, 0.500000000000000, 0.702922575688717,
+        -1.07368816848975, 0.702922575688717, 0.500000000000000, 0.870765592801035,
+        -1.17747653185870, 0.702922575688717, 0.500000000000000, 0.974553956169984,
+        -0.431291195207450, 0.702922575688717, 0.702922575688717, 0.0254460438300157,
+        -0.535079558576399, 0.702922575688717, 0.702922575688717, 0.129234407198965,
+        -0.702922575688717, 0.702922575688717, 0.702922575688717, 0.297077424311283,
+        -0.905845151377434, 0.702922575688717, 0.702922575688717, 0.500000000000000,
+        -1.10876772706615, 0.702922575688717, 0.702922575688717, 0.702922575688717,
+        -1.27661074417847, 0.702922575688717, 0.702922575688717, 0.870765592801035,
+        -1.38039910754742, 0.702922575688717, 0.702922575688717, 0.974553956169984,
+        -0.599134212319768, 0.702922575688717, 0.870765592801035, 0.0254460438300157,
+        -0.702922575688717, 0.702922575688717, 0.870765592801035, 0.129234407198965,
+        -0.870765592801035, 0.702922575688717, 0.870765592801035, 0.297077424311283,
+        -1.07368816848975, 0.702922575688717, 0.870765592801035, 0.500000000000000,
+        -1.27661074417847, 0.702922575688717, 0.870765592801035, 0.702922575688717,
+        -1.44445376129079, 0.702922575688717, 0.870765592801035, 0.870765592801035,
+        -1.54824212465974, 0.702922575688717, 0.870765592801035, 0.974553956169984,
+        -0.702922575688717, 0.702922575688717, 0.974553956169984, 0.0254460438300157,
+        -0.806710939057666, 0.702922575688717, 0.974553956169984, 0.129234407198965,
+        -0.974553956169984, 0.702922575688717, 0.974553956169984, 0.297077424311283,
+        -1.17747653185870, 0.702922575688717, 0.974553956169984, 0.500000000000000,
+        -1.38039910754742, 0.702922575688717, 0.974553956169984, 0.702922575688717,
+        -1.54824212465974, 0.702922575688717, 0.974553956169984, 0.870765592801035,
+        -1.65203048802869, 0.702922575688717, 0.974553956169984, 0.974553956169984,
+        0.0783423195389332, 0.870765592801035, 0.0254460438300157, 0.0254460438300157,
+        -0.0254460438300157, 0.870765592801035, 0.0254460438300157, 0.129234407198965,
+        -0.193289060942334, 0.870765592801035, 0.0254460438300157, 0.297077424311283,
+        -0.396211636631051, 0.870765592801035, 0.0254460438300157, 0.500000000000000,
+        -0.599134212319768, 0.870765592801035, 0.0254460438300157, 0.702922575688717,
+        -0.766977229432086, 0.870765592801035, 0.0254460438300157, 0.870765592801035,
+        -0.870765592801035, 0.870765592801035, 0.0254460438300157, 0.974553956169984,
+        -0.0254460438300157, 0.870765592801035, 0.129234407198965, 0.0254460438300157,
+        -0.129234407198965, 0.870765592801035, 0.129234407198965, 0.129234407198965,
+        -0.297077424311283, 0.870765592801035, 0.129234407198965, 0.297077424311283,
+        -0.500000000000000, 0.870765592801035, 0.129234407198965, 0.500000000000000,
+        -0.702922575688717, 0.870765592801035, 0.129234407198965, 0.702922575688717,
+        -0.870765592801035, 0.870765592801035, 0.129234407198965, 0.870765592801035,
+        -0.974553956169984, 0.870765592801035, 0.129234407198965, 0.974553956169984,
+        -0.193289060942334, 0.870765592801035, 0.297077424311283, 0.0254460438300157,
+        -0.297077424311283, 0.870765592801035, 0.297077424311283, 0.129234407198965,
+        -0.464920441423601, 0.870765592801035, 0.297077424311283, 0.297077424311283,
+        -0.667843017112318, 0.870765592801035, 0.297077424311283, 0.500000000000000,
+        -0.870765592801035, 0.870765592801035, 0.297077424311283, 0.702922575688717,
+        -1.03860860991335, 0.870765592801035, 0.297077424311283, 0.870765592801035,
+        -1.14239697328230, 0.870765592801035, 0.297077424311283, 0.974553956169984,
+        -0.396211636631051, 0.870765592801035, 0.500000000000000, 0.0254460438300157,
+        -0.500000000000000, 0.870765592801035, 0.500000000000000, 0.129234407198965,
+        -0.667843017112318, 0.870765592801035, 0.500000000000000, 0.297077424311283,
+        -0.870765592801035, 0.870765592801035, 0.500000000000000, 0.500000000000000,
+        -1.07368816848975, 0.870765592801035, 0.500000000000000, 0.702922575688717,
+        -1.24153118560207, 0.870765592801035, 0.500000000000000, 0.870765592801035,
+        -1.34531954897102, 0.870765592801035, 0.500000000000000, 0.974553956169984,
+        -0.599134212319768, 0.870765592801035, 0.702922575688717, 0.0254460438300157,
+        -0.702922575688717, 0.870765592801035, 0.702922575688717, 0.129234407198965,
+        -0.870765592801035, 0.870765592801035, 0.702922575688717, 0.297077424311283,
+        -1.07368816848975, 0.870765592801035, 0.702922575688717, 0.500000000000000,
+        -1.27661074417847, 0.870765592801035, 0.702922575688717, 0.702922575688717,
+        -1.44445376129079, 0.870765592801035, 0.702922575688717, 0.870765592801035,
+        -1.54824212465974, 0.870765592801035, 0.702922575688717, 0.974553956169984,
+        -0.766977229432086, 0.870765592801035, 0.870765592801035, 0.0254460438300157,
+        -0.870765592801035, 0.870765592801035, 0.870765592801035, 0.129234407198965,
+        -1.03860860991335, 0.870765592801035, 0.870765592801035, 0.297077424311283,
+        -1.24153118560207, 0.870765592801035, 0.870765592801035, 0.500000000000000,
+        -1.44445376129079, 0.870765592801035, 0.870765592801035, 0.702922575688717,
+        -1.61229677840311, 0.870765592801035, 0.870765592801035, 0.870765592801035,
+        -1.71608514177206, 0.870765592801035, 0.870765592801035, 0.974553956169984,
+        -0.870765592801035, 0.870765592801035, 0.974553956169984, 0.0254460438300157,
+        -0.974553956169984, 0.870765592801035, 0.974553956169984, 0.129234407198965,
+        -1.14239697328230, 0.870765592801035, 0.974553956169984, 0.297077424311283,
+        -1.34531954897102, 0.870765592801035, 0.974553956169984, 0.500000000000000,
+        -1.54824212465974, 0.870765592801035, 0.974553956169984, 0.702922575688717,
+        -1.71608514177206, 0.870765592801035, 0.974553956169984, 0.870765592801035,
+        -1.81987350514100, 0.870765592801035, 0.974553956169984, 0.974553956169984,
+        -0.0254460438300157, 0.974553956169984, 0.0254460438300157, 0.0254460438300157,
+        -0.129234407198965, 0.974553956169984, 0.0254460438300157, 0.129234407198965,
+        -0.297077424311283, 0.974553956169984, 0.0254460438300157, 0.297077424311283,
+        -0.500000000000000, 0.974553956169984, 0.0254460438300157, 0.500000000000000,
+        -0.702922575688717, 0.974553956169984, 0.0254460438300157, 0.702922575688717,
+        -0.870765592801035, 0.974553956169984, 0.0254460438300157, 0.870765592801035,
+        -0.974553956169984, 0.974553956169984, 0.0254460438300157, 0.974553956169984,
+        -0.129234407198965, 0.974553956169984, 0.129234407198965, 0.0254460438300157,
+        -0.233022770567914, 0.974553956169984, 0.129234407198965, 0.129234407198965,
+        -0.400865787680232, 0.974553956169984, 0.129234407198965, 0.297077424311283,
+        -0.603788363368949, 0.974553956169984, 0.129234407198965, 0.500000000000000,
+        -0.806710939057666, 0.974553956169984, 0.129234407198965, 0.702922575688717,
+        -0.974553956169984, 0.974553956169984, 0.129234407198965, 0.870765592801035,
+        -1.07834231953893, 0.974553956169984, 0.129234407198965, 0.974553956169984,
+        -0.297077424311283, 0.974553956169984, 0.297077424311283, 0.0254460438300157,
+        -0.400865787680232, 0.974553956169984, 0.297077424311283, 0.129234407198965,
+        -0.568708804792550, 0.974553956169984, 0.297077424311283, 0.297077424311283,
+        -0.771631380481267, 0.974553956169984, 0.297077424311283, 0.500000000000000,
+        -0.974553956169984, 0.974553956169984, 0.297077424311283, 0.702922575688717,
+        -1.14239697328230, 0.974553956169984, 0.297077424311283, 0.870765592801035,
+        -1.24618533665125, 0.974553956169984, 0.297077424311283, 0.974553956169984,
+        -0.500000000000000, 0.974553956169984, 0.500000000000000, 0.0254460438300157,
+        -0.603788363368949, 0.974553956169984, 0.500000000000000, 0.129234407198965,
+        -0.771631380481267, 0.974553956169984, 0.500000000000000, 0.297077424311283,
+        -0.974553956169984, 0.974553956169984, 0.500000000000000, 0.500000000000000,
+        -1.17747653185870, 0.974553956169984, 0.500000000000000, 0.702922575688717,
+        -1.34531954897102, 0.974553956169984, 0.500000000000000, 0.870765592801035,
+        -1.44910791233997, 0.974553956169984, 0.500000000000000, 0.974553956169984,
+        -0.702922575688717, 0.974553956169984, 0.702922575688717, 0.0254460438300157,
+        -0.806710939057666, 0.974553956169984, 0.702922575688717, 0.129234407198965,
+        -0.974553956169984, 0.974553956169984, 0.702922575688717, 0.297077424311283,
+        -1.17747653185870, 0.974553956169984, 0.702922575688717, 0.500000000000000,
+        -1.38039910754742, 0.974553956169984, 0.702922575688717, 0.702922575688717,
+        -1.54824212465974, 0.974553956169984, 0.702922575688717, 0.870765592801035,
+        -1.65203048802869, 0.974553956169984, 0.702922575688717, 0.974553956169984,
+        -0.870765592801035, 0.974553956169984, 0.870765592801035, 0.0254460438300157,
+        -0.974553956169984, 0.974553956169984, 0.870765592801035, 0.129234407198965,
+        -1.14239697328230, 0.974553956169984, 0.870765592801035, 0.297077424311283,
+        -1.34531954897102, 0.974553956169984, 0.870765592801035, 0.500000000000000,
+        -1.54824212465974, 0.974553956169984, 0.870765592801035, 0.702922575688717,
+        -1.71608514177206, 0.974553956169984, 0.870765592801035, 0.870765592801035,
+        -1.81987350514100, 0.974553956169984, 0.870765592801035, 0.974553956169984,
+        -0.974553956169984, 0.974553956169984, 0.974553956169984, 0.0254460438300157,
+        -1.07834231953893, 0.974553956169984, 0.974553956169984, 0.129234407198965,
+        -1.24618533665125, 0.974553956169984, 0.974553956169984, 0.297077424311283,
+        -1.44910791233997, 0.974553956169984, 0.974553956169984, 0.500000000000000,
+        -1.65203048802869, 0.974553956169984, 0.974553956169984, 0.702922575688717,
+        -1.81987350514100, 0.974553956169984, 0.974553956169984, 0.870765592801035,
+        -1.92366186850995, 0.974553956169984, 0.974553956169984, 0.974553956169984};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.000271373887442091, 0.000586205037323298, 0.000800237341929313, 0.000875956582608773,
         0.000800237341929313, 0.000586205037323298, 0.000271373887442091, 0.000586205037323298,
@@ -2744,518 +1937,518 @@ struct GaussLegendreQuadrature<3, 8>
     inline static std::uint8_t constexpr kOrder                              = 8;
     inline static int constexpr kPoints                                      = 512;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.940434784748504,   0.858623095205985,   0.723056061455281,   0.552007177746418,
-        0.368572535251587,   0.197523651542724,   0.0619566177920206,  -0.0198550717504986,
-        0.858623095205985,   0.776811405663466,   0.641244371912762,   0.470195488203899,
-        0.286760845709068,   0.115711962000205,   -0.0198550717504986, -0.101666761293018,
-        0.723056061455281,   0.641244371912762,   0.505677338162059,   0.334628454453195,
-        0.151193811958365,   -0.0198550717504986, -0.155422105501202,  -0.237233795043721,
-        0.552007177746418,   0.470195488203899,   0.334628454453195,   0.163579570744332,
-        -0.0198550717504986, -0.190903955459362,  -0.326470989210065,  -0.408282678752585,
-        0.368572535251587,   0.286760845709068,   0.151193811958365,   -0.0198550717504986,
-        -0.203289714245329,  -0.374338597954193,  -0.509905631704896,  -0.591717321247415,
-        0.197523651542724,   0.115711962000205,   -0.0198550717504986, -0.190903955459362,
-        -0.374338597954193,  -0.545387481663056,  -0.680954515413760,  -0.762766204956279,
-        0.0619566177920206,  -0.0198550717504986, -0.155422105501202,  -0.326470989210065,
-        -0.509905631704896,  -0.680954515413760,  -0.816521549164463,  -0.898333238706982,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        0.858623095205985,   0.776811405663466,   0.641244371912762,   0.470195488203899,
-        0.286760845709068,   0.115711962000205,   -0.0198550717504986, -0.101666761293018,
-        0.776811405663466,   0.694999716120947,   0.559432682370243,   0.388383798661380,
-        0.204949156166549,   0.0339002724576858,  -0.101666761293018,  -0.183478450835537,
-        0.641244371912762,   0.559432682370243,   0.423865648619540,   0.252816764910676,
-        0.0693821224158455,  -0.101666761293018,  -0.237233795043721,  -0.319045484586240,
-        0.470195488203899,   0.388383798661380,   0.252816764910676,   0.0817678812018130,
-        -0.101666761293018,  -0.272715645001881,  -0.408282678752585,  -0.490094368295104,
-        0.286760845709068,   0.204949156166549,   0.0693821224158455,  -0.101666761293018,
-        -0.285101403787849,  -0.456150287496712,  -0.591717321247415,  -0.673529010789935,
-        0.115711962000205,   0.0339002724576858,  -0.101666761293018,  -0.272715645001881,
-        -0.456150287496712,  -0.627199171205575,  -0.762766204956279,  -0.844577894498798,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        -0.101666761293018,  -0.183478450835537,  -0.319045484586240,  -0.490094368295104,
-        -0.673529010789935,  -0.844577894498798,  -0.980144928249501,  -1.06195661779202,
-        0.723056061455281,   0.641244371912762,   0.505677338162059,   0.334628454453195,
-        0.151193811958365,   -0.0198550717504986, -0.155422105501202,  -0.237233795043721,
-        0.641244371912762,   0.559432682370243,   0.423865648619540,   0.252816764910676,
-        0.0693821224158455,  -0.101666761293018,  -0.237233795043721,  -0.319045484586240,
-        0.505677338162059,   0.423865648619540,   0.288298614868836,   0.117249731159973,
-        -0.0661849113348580, -0.237233795043721,  -0.372800828794425,  -0.454612518336944,
-        0.334628454453195,   0.252816764910676,   0.117249731159973,   -0.0537991525488906,
-        -0.237233795043721,  -0.408282678752585,  -0.543849712503288,  -0.625661402045807,
-        0.151193811958365,   0.0693821224158455,  -0.0661849113348580, -0.237233795043721,
-        -0.420668437538552,  -0.591717321247415,  -0.727284354998119,  -0.809096044540638,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        -0.155422105501202,  -0.237233795043721,  -0.372800828794425,  -0.543849712503288,
-        -0.727284354998119,  -0.898333238706982,  -1.03390027245769,   -1.11571196200020,
-        -0.237233795043721,  -0.319045484586240,  -0.454612518336944,  -0.625661402045807,
-        -0.809096044540638,  -0.980144928249501,  -1.11571196200020,   -1.19752365154272,
-        0.552007177746418,   0.470195488203899,   0.334628454453195,   0.163579570744332,
-        -0.0198550717504986, -0.190903955459362,  -0.326470989210065,  -0.408282678752585,
-        0.470195488203899,   0.388383798661380,   0.252816764910676,   0.0817678812018130,
-        -0.101666761293018,  -0.272715645001881,  -0.408282678752585,  -0.490094368295104,
-        0.334628454453195,   0.252816764910676,   0.117249731159973,   -0.0537991525488906,
-        -0.237233795043721,  -0.408282678752585,  -0.543849712503288,  -0.625661402045807,
-        0.163579570744332,   0.0817678812018130,  -0.0537991525488906, -0.224848036257754,
-        -0.408282678752585,  -0.579331562461448,  -0.714898596212151,  -0.796710285754671,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        -0.190903955459362,  -0.272715645001881,  -0.408282678752585,  -0.579331562461448,
-        -0.762766204956279,  -0.933815088665142,  -1.06938212241585,   -1.15119381195836,
-        -0.326470989210065,  -0.408282678752585,  -0.543849712503288,  -0.714898596212151,
-        -0.898333238706982,  -1.06938212241585,   -1.20494915616655,   -1.28676084570907,
-        -0.408282678752585,  -0.490094368295104,  -0.625661402045807,  -0.796710285754671,
-        -0.980144928249501,  -1.15119381195836,   -1.28676084570907,   -1.36857253525159,
-        0.368572535251587,   0.286760845709068,   0.151193811958365,   -0.0198550717504986,
-        -0.203289714245329,  -0.374338597954193,  -0.509905631704896,  -0.591717321247415,
-        0.286760845709068,   0.204949156166549,   0.0693821224158455,  -0.101666761293018,
-        -0.285101403787849,  -0.456150287496712,  -0.591717321247415,  -0.673529010789935,
-        0.151193811958365,   0.0693821224158455,  -0.0661849113348580, -0.237233795043721,
-        -0.420668437538552,  -0.591717321247415,  -0.727284354998119,  -0.809096044540638,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        -0.203289714245329,  -0.285101403787849,  -0.420668437538552,  -0.591717321247415,
-        -0.775151963742246,  -0.946200847451109,  -1.08176788120181,   -1.16357957074433,
-        -0.374338597954193,  -0.456150287496712,  -0.591717321247415,  -0.762766204956279,
-        -0.946200847451109,  -1.11724973115997,   -1.25281676491068,   -1.33462845445320,
-        -0.509905631704896,  -0.591717321247415,  -0.727284354998119,  -0.898333238706982,
-        -1.08176788120181,   -1.25281676491068,   -1.38838379866138,   -1.47019548820390,
-        -0.591717321247415,  -0.673529010789935,  -0.809096044540638,  -0.980144928249501,
-        -1.16357957074433,   -1.33462845445320,   -1.47019548820390,   -1.55200717774642,
-        0.197523651542724,   0.115711962000205,   -0.0198550717504986, -0.190903955459362,
-        -0.374338597954193,  -0.545387481663056,  -0.680954515413760,  -0.762766204956279,
-        0.115711962000205,   0.0339002724576858,  -0.101666761293018,  -0.272715645001881,
-        -0.456150287496712,  -0.627199171205575,  -0.762766204956279,  -0.844577894498798,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        -0.190903955459362,  -0.272715645001881,  -0.408282678752585,  -0.579331562461448,
-        -0.762766204956279,  -0.933815088665142,  -1.06938212241585,   -1.15119381195836,
-        -0.374338597954193,  -0.456150287496712,  -0.591717321247415,  -0.762766204956279,
-        -0.946200847451109,  -1.11724973115997,   -1.25281676491068,   -1.33462845445320,
-        -0.545387481663056,  -0.627199171205575,  -0.762766204956279,  -0.933815088665142,
-        -1.11724973115997,   -1.28829861486884,   -1.42386564861954,   -1.50567733816206,
-        -0.680954515413760,  -0.762766204956279,  -0.898333238706982,  -1.06938212241585,
-        -1.25281676491068,   -1.42386564861954,   -1.55943268237024,   -1.64124437191276,
-        -0.762766204956279,  -0.844577894498798,  -0.980144928249501,  -1.15119381195836,
-        -1.33462845445320,   -1.50567733816206,   -1.64124437191276,   -1.72305606145528,
-        0.0619566177920206,  -0.0198550717504986, -0.155422105501202,  -0.326470989210065,
-        -0.509905631704896,  -0.680954515413760,  -0.816521549164463,  -0.898333238706982,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        -0.155422105501202,  -0.237233795043721,  -0.372800828794425,  -0.543849712503288,
-        -0.727284354998119,  -0.898333238706982,  -1.03390027245769,   -1.11571196200020,
-        -0.326470989210065,  -0.408282678752585,  -0.543849712503288,  -0.714898596212151,
-        -0.898333238706982,  -1.06938212241585,   -1.20494915616655,   -1.28676084570907,
-        -0.509905631704896,  -0.591717321247415,  -0.727284354998119,  -0.898333238706982,
-        -1.08176788120181,   -1.25281676491068,   -1.38838379866138,   -1.47019548820390,
-        -0.680954515413760,  -0.762766204956279,  -0.898333238706982,  -1.06938212241585,
-        -1.25281676491068,   -1.42386564861954,   -1.55943268237024,   -1.64124437191276,
-        -0.816521549164463,  -0.898333238706982,  -1.03390027245769,   -1.20494915616655,
-        -1.38838379866138,   -1.55943268237024,   -1.69499971612095,   -1.77681140566347,
-        -0.898333238706982,  -0.980144928249501,  -1.11571196200020,   -1.28676084570907,
-        -1.47019548820390,   -1.64124437191276,   -1.77681140566347,   -1.85862309520599,
-        -0.0198550717504986, -0.101666761293018,  -0.237233795043721,  -0.408282678752585,
-        -0.591717321247415,  -0.762766204956279,  -0.898333238706982,  -0.980144928249501,
-        -0.101666761293018,  -0.183478450835537,  -0.319045484586240,  -0.490094368295104,
-        -0.673529010789935,  -0.844577894498798,  -0.980144928249501,  -1.06195661779202,
-        -0.237233795043721,  -0.319045484586240,  -0.454612518336944,  -0.625661402045807,
-        -0.809096044540638,  -0.980144928249501,  -1.11571196200020,   -1.19752365154272,
-        -0.408282678752585,  -0.490094368295104,  -0.625661402045807,  -0.796710285754671,
-        -0.980144928249501,  -1.15119381195836,   -1.28676084570907,   -1.36857253525159,
-        -0.591717321247415,  -0.673529010789935,  -0.809096044540638,  -0.980144928249501,
-        -1.16357957074433,   -1.33462845445320,   -1.47019548820390,   -1.55200717774642,
-        -0.762766204956279,  -0.844577894498798,  -0.980144928249501,  -1.15119381195836,
-        -1.33462845445320,   -1.50567733816206,   -1.64124437191276,   -1.72305606145528,
-        -0.898333238706982,  -0.980144928249501,  -1.11571196200020,   -1.28676084570907,
-        -1.47019548820390,   -1.64124437191276,   -1.77681140566347,   -1.85862309520599,
-        -0.980144928249501,  -1.06195661779202,   -1.19752365154272,   -1.36857253525159,
-        -1.55200717774642,   -1.72305606145528,   -1.85862309520599,   -1.94043478474850,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.0198550717504986,  0.0198550717504986,  0.0198550717504986,  0.0198550717504986,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.101666761293018,   0.101666761293018,   0.101666761293018,   0.101666761293018,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.237233795043721,   0.237233795043721,   0.237233795043721,   0.237233795043721,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.408282678752585,   0.408282678752585,   0.408282678752585,   0.408282678752585,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.591717321247415,   0.591717321247415,   0.591717321247415,   0.591717321247415,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.762766204956279,   0.762766204956279,   0.762766204956279,   0.762766204956279,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.898333238706982,   0.898333238706982,   0.898333238706982,   0.898333238706982,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.980144928249501,   0.980144928249501,   0.980144928249501,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501,
-        0.0198550717504986,  0.101666761293018,   0.237233795043721,   0.408282678752585,
-        0.591717321247415,   0.762766204956279,   0.898333238706982,   0.980144928249501};
+        0.940434784748504, 0.0198550717504986, 0.0198550717504986, 0.0198550717504986,
+        0.858623095205985, 0.0198550717504986, 0.0198550717504986, 0.101666761293018,
+        0.723056061455281, 0.0198550717504986, 0.0198550717504986, 0.237233795043721,
+        0.552007177746418, 0.0198550717504986, 0.0198550717504986, 0.408282678752585,
+        0.368572535251587, 0.0198550717504986, 0.0198550717504986, 0.591717321247415,
+        0.197523651542724, 0.0198550717504986, 0.0198550717504986, 0.762766204956279,
+        0.0619566177920206, 0.0198550717504986, 0.0198550717504986, 0.898333238706982,
+        -0.0198550717504986, 0.0198550717504986, 0.0198550717504986, 0.980144928249501,
+        0.858623095205985, 0.0198550717504986, 0.101666761293018, 0.0198550717504986,
+        0.776811405663466, 0.0198550717504986, 0.101666761293018, 0.101666761293018,
+        0.641244371912762, 0.0198550717504986, 0.101666761293018, 0.237233795043721,
+        0.470195488203899, 0.0198550717504986, 0.101666761293018, 0.408282678752585,
+        0.286760845709068, 0.0198550717504986, 0.101666761293018, 0.591717321247415,
+        0.115711962000205, 0.0198550717504986, 0.101666761293018, 0.762766204956279,
+        -0.0198550717504986, 0.0198550717504986, 0.101666761293018, 0.898333238706982,
+        -0.101666761293018, 0.0198550717504986, 0.101666761293018, 0.980144928249501,
+        0.723056061455281, 0.0198550717504986, 0.237233795043721, 0.0198550717504986,
+        0.641244371912762, 0.0198550717504986, 0.237233795043721, 0.101666761293018,
+        0.505677338162059, 0.0198550717504986, 0.237233795043721, 0.237233795043721,
+        0.334628454453195, 0.0198550717504986, 0.237233795043721, 0.408282678752585,
+        0.151193811958365, 0.0198550717504986, 0.237233795043721, 0.591717321247415,
+        -0.0198550717504986, 0.0198550717504986, 0.237233795043721, 0.762766204956279,
+        -0.155422105501202, 0.0198550717504986, 0.237233795043721, 0.898333238706982,
+        -0.237233795043721, 0.0198550717504986, 0.237233795043721, 0.980144928249501,
+        0.552007177746418, 0.0198550717504986, 0.408282678752585, 0.0198550717504986,
+        0.470195488203899, 0.0198550717504986, 0.408282678752585, 0.101666761293018,
+        0.334628454453195, 0.0198550717504986, 0.408282678752585, 0.237233795043721,
+        0.163579570744332, 0.0198550717504986, 0.408282678752585, 0.408282678752585,
+        -0.0198550717504986, 0.0198550717504986, 0.408282678752585, 0.591717321247415,
+        -0.190903955459362, 0.0198550717504986, 0.408282678752585, 0.762766204956279,
+        -0.326470989210065, 0.0198550717504986, 0.408282678752585, 0.898333238706982,
+        -0.408282678752585, 0.0198550717504986, 0.408282678752585, 0.980144928249501,
+        0.368572535251587, 0.0198550717504986, 0.591717321247415, 0.0198550717504986,
+        0.286760845709068, 0.0198550717504986, 0.591717321247415, 0.101666761293018,
+        0.151193811958365, 0.0198550717504986, 0.591717321247415, 0.237233795043721,
+        -0.0198550717504986, 0.0198550717504986, 0.591717321247415, 0.408282678752585,
+        -0.203289714245329, 0.0198550717504986, 0.591717321247415, 0.591717321247415,
+        -0.374338597954193, 0.0198550717504986, 0.591717321247415, 0.762766204956279,
+        -0.509905631704896, 0.0198550717504986, 0.591717321247415, 0.898333238706982,
+        -0.591717321247415, 0.0198550717504986, 0.591717321247415, 0.980144928249501,
+        0.197523651542724, 0.0198550717504986, 0.762766204956279, 0.0198550717504986,
+        0.115711962000205, 0.0198550717504986, 0.762766204956279, 0.101666761293018,
+        -0.0198550717504986, 0.0198550717504986, 0.762766204956279, 0.237233795043721,
+        -0.190903955459362, 0.0198550717504986, 0.762766204956279, 0.408282678752585,
+        -0.374338597954193, 0.0198550717504986, 0.762766204956279, 0.591717321247415,
+        -0.545387481663056, 0.0198550717504986, 0.762766204956279, 0.762766204956279,
+        -0.680954515413760, 0.0198550717504986, 0.762766204956279, 0.898333238706982,
+        -0.762766204956279, 0.0198550717504986, 0.762766204956279, 0.980144928249501,
+        0.0619566177920206, 0.0198550717504986, 0.898333238706982, 0.0198550717504986,
+        -0.0198550717504986, 0.0198550717504986, 0.898333238706982, 0.101666761293018,
+        -0.155422105501202, 0.0198550717504986, 0.898333238706982, 0.237233795043721,
+        -0.326470989210065, 0.0198550717504986, 0.898333238706982, 0.408282678752585,
+        -0.509905631704896, 0.0198550717504986, 0.898333238706982, 0.591717321247415,
+        -0.680954515413760, 0.0198550717504986, 0.898333238706982, 0.762766204956279,
+        -0.816521549164463, 0.0198550717504986, 0.898333238706982, 0.898333238706982,
+        -0.898333238706982, 0.0198550717504986, 0.898333238706982, 0.980144928249501,
+        -0.0198550717504986, 0.0198550717504986, 0.980144928249501, 0.0198550717504986,
+        -0.101666761293018, 0.0198550717504986, 0.980144928249501, 0.101666761293018,
+        -0.237233795043721, 0.0198550717504986, 0.980144928249501, 0.237233795043721,
+        -0.408282678752585, 0.0198550717504986, 0.980144928249501, 0.408282678752585,
+        -0.591717321247415, 0.0198550717504986, 0.980144928249501, 0.591717321247415,
+        -0.762766204956279, 0.0198550717504986, 0.980144928249501, 0.762766204956279,
+        -0.898333238706982, 0.0198550717504986, 0.980144928249501, 0.898333238706982,
+        -0.980144928249501, 0.0198550717504986, 0.980144928249501, 0.980144928249501,
+        0.858623095205985, 0.101666761293018, 0.0198550717504986, 0.0198550717504986,
+        0.776811405663466, 0.101666761293018, 0.0198550717504986, 0.101666761293018,
+        0.641244371912762, 0.101666761293018, 0.0198550717504986, 0.237233795043721,
+        0.470195488203899, 0.101666761293018, 0.0198550717504986, 0.408282678752585,
+        0.286760845709068, 0.101666761293018, 0.0198550717504986, 0.591717321247415,
+        0.115711962000205, 0.101666761293018, 0.0198550717504986, 0.762766204956279,
+        -0.0198550717504986, 0.101666761293018, 0.0198550717504986, 0.898333238706982,
+        -0.101666761293018, 0.101666761293018, 0.0198550717504986, 0.980144928249501,
+        0.776811405663466, 0.101666761293018, 0.101666761293018, 0.0198550717504986,
+        0.694999716120947, 0.101666761293018, 0.101666761293018, 0.101666761293018,
+        0.559432682370243, 0.101666761293018, 0.101666761293018, 0.237233795043721,
+        0.388383798661380, 0.101666761293018, 0.101666761293018, 0.408282678752585,
+        0.204949156166549, 0.101666761293018, 0.101666761293018, 0.591717321247415,
+        0.0339002724576858, 0.101666761293018, 0.101666761293018, 0.762766204956279,
+        -0.101666761293018, 0.101666761293018, 0.101666761293018, 0.898333238706982,
+        -0.183478450835537, 0.101666761293018, 0.101666761293018, 0.980144928249501,
+        0.641244371912762, 0.101666761293018, 0.237233795043721, 0.0198550717504986,
+        0.559432682370243, 0.101666761293018, 0.237233795043721, 0.101666761293018,
+        0.423865648619540, 0.101666761293018, 0.237233795043721, 0.237233795043721,
+        0.252816764910676, 0.101666761293018, 0.237233795043721, 0.408282678752585,
+        0.0693821224158455, 0.101666761293018, 0.237233795043721, 0.591717321247415,
+        -0.101666761293018, 0.101666761293018, 0.237233795043721, 0.762766204956279,
+        -0.237233795043721, 0.101666761293018, 0.237233795043721, 0.898333238706982,
+        -0.319045484586240, 0.101666761293018, 0.237233795043721, 0.980144928249501,
+        0.470195488203899, 0.101666761293018, 0.408282678752585, 0.0198550717504986,
+        0.388383798661380, 0.101666761293018, 0.408282678752585, 0.101666761293018,
+        0.252816764910676, 0.101666761293018, 0.408282678752585, 0.237233795043721,
+        0.0817678812018130, 0.101666761293018, 0.408282678752585, 0.408282678752585,
+        -0.101666761293018, 0.101666761293018, 0.408282678752585, 0.591717321247415,
+        -0.272715645001881, 0.101666761293018, 0.408282678752585, 0.762766204956279,
+        -0.408282678752585, 0.101666761293018, 0.408282678752585, 0.898333238706982,
+        -0.490094368295104, 0.101666761293018, 0.408282678752585, 0.980144928249501,
+        0.286760845709068, 0.101666761293018, 0.591717321247415, 0.0198550717504986,
+        0.204949156166549, 0.101666761293018, 0.591717321247415, 0.101666761293018,
+        0.0693821224158455, 0.101666761293018, 0.591717321247415, 0.237233795043721,
+        -0.101666761293018, 0.101666761293018, 0.591717321247415, 0.408282678752585,
+        -0.285101403787849, 0.101666761293018, 0.591717321247415, 0.591717321247415,
+        -0.456150287496712, 0.101666761293018, 0.591717321247415, 0.762766204956279,
+        -0.591717321247415, 0.101666761293018, 0.591717321247415, 0.898333238706982,
+        -0.673529010789935, 0.101666761293018, 0.591717321247415, 0.980144928249501,
+        0.115711962000205, 0.101666761293018, 0.762766204956279, 0.0198550717504986,
+        0.0339002724576858, 0.101666761293018, 0.762766204956279, 0.101666761293018,
+        -0.101666761293018, 0.101666761293018, 0.762766204956279, 0.237233795043721,
+        -0.272715645001881, 0.101666761293018, 0.762766204956279, 0.408282678752585,
+        -0.456150287496712, 0.101666761293018, 0.762766204956279, 0.591717321247415,
+        -0.627199171205575, 0.101666761293018, 0.762766204956279, 0.762766204956279,
+        -0.762766204956279, 0.101666761293018, 0.762766204956279, 0.898333238706982,
+        -0.844577894498798, 0.101666761293018, 0.762766204956279, 0.980144928249501,
+        -0.0198550717504986, 0.101666761293018, 0.898333238706982, 0.0198550717504986,
+        -0.101666761293018, 0.101666761293018, 0.898333238706982, 0.101666761293018,
+        -0.237233795043721, 0.101666761293018, 0.898333238706982, 0.237233795043721,
+        -0.408282678752585, 0.101666761293018, 0.898333238706982, 0.408282678752585,
+        -0.591717321247415, 0.101666761293018, 0.898333238706982, 0.591717321247415,
+        -0.762766204956279, 0.101666761293018, 0.898333238706982, 0.762766204956279,
+        -0.898333238706982, 0.101666761293018, 0.898333238706982, 0.898333238706982,
+        -0.980144928249501, 0.101666761293018, 0.898333238706982, 0.980144928249501,
+        -0.101666761293018, 0.101666761293018, 0.980144928249501, 0.0198550717504986,
+        -0.183478450835537, 0.101666761293018, 0.980144928249501, 0.101666761293018,
+        -0.319045484586240, 0.101666761293018, 0.980144928249501, 0.237233795043721,
+        -0.490094368295104, 0.101666761293018, 0.980144928249501, 0.408282678752585,
+        -0.673529010789935, 0.101666761293018, 0.980144928249501, 0.591717321247415,
+        -0.844577894498798, 0.101666761293018, 0.980144928249501, 0.762766204956279,
+        -0.980144928249501, 0.101666761293018, 0.980144928249501, 0.898333238706982,
+        -1.06195661779202, 0.101666761293018, 0.980144928249501, 0.980144928249501,
+        0.723056061455281, 0.237233795043721, 0.0198550717504986, 0.0198550717504986,
+        0.641244371912762, 0.237233795043721, 0.0198550717504986, 0.101666761293018,
+        0.505677338162059, 0.237233795043721, 0.0198550717504986, 0.237233795043721,
+        0.334628454453195, 0.237233795043721, 0.0198550717504986, 0.408282678752585,
+        0.151193811958365, 0.237233795043721, 0.0198550717504986, 0.591717321247415,
+        -0.0198550717504986, 0.237233795043721, 0.0198550717504986, 0.762766204956279,
+        -0.155422105501202, 0.237233795043721, 0.0198550717504986, 0.898333238706982,
+        -0.237233795043721, 0.237233795043721, 0.0198550717504986, 0.980144928249501,
+        0.641244371912762, 0.237233795043721, 0.101666761293018, 0.0198550717504986,
+        0.559432682370243, 0.237233795043721, 0.101666761293018, 0.101666761293018,
+        0.423865648619540, 0.237233795043721, 0.101666761293018, 0.237233795043721,
+        0.252816764910676, 0.237233795043721, 0.101666761293018, 0.408282678752585,
+        0.0693821224158455, 0.237233795043721, 0.101666761293018, 0.591717321247415,
+        -0.101666761293018, 0.237233795043721, 0.101666761293018, 0.762766204956279,
+        -0.237233795043721, 0.237233795043721, 0.101666761293018, 0.898333238706982,
+        -0.319045484586240, 0.237233795043721, 0.101666761293018, 0.980144928249501,
+        0.505677338162059, 0.237233795043721, 0.237233795043721, 0.0198550717504986,
+        0.423865648619540, 0.237233795043721, 0.237233795043721, 0.101666761293018,
+        0.288298614868836, 0.237233795043721, 0.237233795043721, 0.237233795043721,
+        0.117249731159973, 0.237233795043721, 0.237233795043721, 0.408282678752585,
+        -0.0661849113348580, 0.237233795043721, 0.237233795043721, 0.591717321247415,
+        -0.237233795043721, 0.237233795043721, 0.237233795043721, 0.762766204956279,
+        -0.372800828794425, 0.237233795043721, 0.237233795043721, 0.898333238706982,
+        -0.454612518336944, 0.237233795043721, 0.237233795043721, 0.980144928249501,
+        0.334628454453195, 0.237233795043721, 0.408282678752585, 0.0198550717504986,
+        0.252816764910676, 0.237233795043721, 0.408282678752585, 0.101666761293018,
+        0.117249731159973, 0.237233795043721, 0.408282678752585, 0.237233795043721,
+        -0.0537991525488906, 0.237233795043721, 0.408282678752585, 0.408282678752585,
+        -0.237233795043721, 0.237233795043721, 0.408282678752585, 0.591717321247415,
+        -0.408282678752585, 0.237233795043721, 0.408282678752585, 0.762766204956279,
+        -0.543849712503288, 0.237233795043721, 0.408282678752585, 0.898333238706982,
+        -0.625661402045807, 0.237233795043721, 0.408282678752585, 0.980144928249501,
+        0.151193811958365, 0.237233795043721, 0.591717321247415, 0.0198550717504986,
+        0.0693821224158455, 0.237233795043721, 0.591717321247415, 0.101666761293018,
+        -0.0661849113348580, 0.237233795043721, 0.591717321247415, 0.237233795043721,
+        -0.237233795043721, 0.237233795043721, 0.591717321247415, 0.408282678752585,
+        -0.420668437538552, 0.237233795043721, 0.591717321247415, 0.591717321247415,
+        -0.591717321247415, 0.237233795043721, 0.591717321247415, 0.762766204956279,
+        -0.727284354998119, 0.237233795043721, 0.591717321247415, 0.898333238706982,
+        -0.809096044540638, 0.237233795043721, 0.591717321247415, 0.980144928249501,
+        -0.0198550717504986, 0.237233795043721, 0.762766204956279, 0.0198550717504986,
+        -0.101666761293018, 0.237233795043721, 0.762766204956279, 0.101666761293018,
+        -0.237233795043721, 0.237233795043721, 0.762766204956279, 0.237233795043721,
+        -0.408282678752585, 0.237233795043721, 0.762766204956279, 0.408282678752585,
+        -0.591717321247415, 0.237233795043721, 0.762766204956279, 0.591717321247415,
+        -0.762766204956279, 0.237233795043721, 0.762766204956279, 0.762766204956279,
+        -0.898333238706982, 0.237233795043721, 0.762766204956279, 0.898333238706982,
+        -0.980144928249501, 0.237233795043721, 0.762766204956279, 0.980144928249501,
+        -0.155422105501202, 0.237233795043721, 0.898333238706982, 0.0198550717504986,
+        -0.237233795043721, 0.237233795043721, 0.898333238706982, 0.101666761293018,
+        -0.372800828794425, 0.237233795043721, 0.898333238706982, 0.237233795043721,
+        -0.543849712503288, 0.237233795043721, 0.898333238706982, 0.408282678752585,
+        -0.727284354998119, 0.237233795043721, 0.898333238706982, 0.591717321247415,
+        -0.898333238706982, 0.237233795043721, 0.898333238706982, 0.762766204956279,
+        -1.03390027245769, 0.237233795043721, 0.898333238706982, 0.898333238706982,
+        -1.11571196200020, 0.237233795043721, 0.898333238706982, 0.980144928249501,
+        -0.237233795043721, 0.237233795043721, 0.980144928249501, 0.0198550717504986,
+        -0.319045484586240, 0.237233795043721, 0.980144928249501, 0.101666761293018,
+        -0.454612518336944, 0.237233795043721, 0.980144928249501, 0.237233795043721,
+        -0.625661402045807, 0.237233795043721, 0.980144928249501, 0.408282678752585,
+        -0.809096044540638, 0.237233795043721, 0.980144928249501, 0.591717321247415,
+        -0.980144928249501, 0.237233795043721, 0.980144928249501, 0.762766204956279,
+        -1.11571196200020, 0.237233795043721, 0.980144928249501, 0.898333238706982,
+        -1.19752365154272, 0.237233795043721, 0.980144928249501, 0.980144928249501,
+        0.552007177746418, 0.408282678752585, 0.0198550717504986, 0.0198550717504986,
+        0.470195488203899, 0.408282678752585, 0.0198550717504986, 0.101666761293018,
+        0.334628454453195, 0.408282678752585, 0.0198550717504986, 0.237233795043721,
+        0.163579570744332, 0.408282678752585, 0.0198550717504986, 0.408282678752585,
+        -0.0198550717504986, 0.408282678752585, 0.0198550717504986, 0.591717321247415,
+        -0.190903955459362, 0.408282678752585, 0.0198550717504986, 0.762766204956279,
+        -0.326470989210065, 0.408282678752585, 0.0198550717504986, 0.898333238706982,
+        -0.408282678752585, 0.408282678752585, 0.0198550717504986, 0.980144928249501,
+        0.470195488203899, 0.408282678752585, 0.101666761293018, 0.0198550717504986,
+        0.388383798661380, 0.408282678752585, 0.101666761293018, 0.101666761293018,
+        0.252816764910676, 0.408282678752585, 0.101666761293018, 0.237233795043721,
+        0.0817678812018130, 0.408282678752585, 0.101666761293018, 0.408282678752585,
+        -0.101666761293018, 0.408282678752585, 0.101666761293018, 0.591717321247415,
+        -0.272715645001881, 0.408282678752585, 0.101666761293018, 0.762766204956279,
+        -0.408282678752585, 0.408282678752585, 0.101666761293018, 0.898333238706982,
+        -0.490094368295104, 0.408282678752585, 0.101666761293018, 0.980144928249501,
+        0.334628454453195, 0.408282678752585, 0.237233795043721, 0.0198550717504986,
+        0.252816764910676, 0.408282678752585, 0.237233795043721, 0.101666761293018,
+        0.117249731159973, 0.408282678752585, 0.237233795043721, 0.237233795043721,
+        -0.0537991525488906, 0.408282678752585, 0.237233795043721, 0.408282678752585,
+        -0.237233795043721, 0.408282678752585, 0.237233795043721, 0.591717321247415,
+        -0.408282678752585, 0.408282678752585, 0.237233795043721, 0.762766204956279,
+        -0.543849712503288, 0.408282678752585, 0.237233795043721, 0.898333238706982,
+        -0.625661402045807, 0.408282678752585, 0.237233795043721, 0.980144928249501,
+        0.163579570744332, 0.408282678752585, 0.408282678752585, 0.0198550717504986,
+        0.0817678812018130, 0.408282678752585, 0.408282678752585, 0.101666761293018,
+        -0.0537991525488906, 0.408282678752585, 0.408282678752585, 0.237233795043721,
+        -0.224848036257754, 0.408282678752585, 0.408282678752585, 0.408282678752585,
+        -0.408282678752585, 0.408282678752585, 0.408282678752585, 0.591717321247415,
+        -0.579331562461448, 0.408282678752585, 0.408282678752585, 0.762766204956279,
+        -0.714898596212151, 0.408282678752585, 0.408282678752585, 0.898333238706982,
+        -0.796710285754671, 0.408282678752585, 0.408282678752585, 0.980144928249501,
+        -0.0198550717504986, 0.408282678752585, 0.591717321247415, 0.0198550717504986,
+        -0.101666761293018, 0.408282678752585, 0.591717321247415, 0.101666761293018,
+        -0.237233795043721, 0.408282678752585, 0.591717321247415, 0.237233795043721,
+        -0.408282678752585, 0.408282678752585, 0.591717321247415, 0.408282678752585,
+        -0.591717321247415, 0.408282678752585, 0.591717321247415, 0.591717321247415,
+        -0.762766204956279, 0.408282678752585, 0.591717321247415, 0.762766204956279,
+        -0.898333238706982, 0.408282678752585, 0.591717321247415, 0.898333238706982,
+        -0.980144928249501, 0.408282678752585, 0.591717321247415, 0.980144928249501,
+        -0.190903955459362, 0.408282678752585, 0.762766204956279, 0.0198550717504986,
+        -0.272715645001881, 0.408282678752585, 0.762766204956279, 0.101666761293018,
+        -0.408282678752585, 0.408282678752585, 0.762766204956279, 0.237233795043721,
+        -0.579331562461448, 0.408282678752585, 0.762766204956279, 0.408282678752585,
+        -0.762766204956279, 0.408282678752585, 0.762766204956279, 0.591717321247415,
+        -0.933815088665142, 0.408282678752585, 0.762766204956279, 0.762766204956279,
+        -1.06938212241585, 0.408282678752585, 0.762766204956279, 0.898333238706982,
+        -1.15119381195836, 0.408282678752585, 0.762766204956279, 0.980144928249501,
+        -0.326470989210065, 0.408282678752585, 0.898333238706982, 0.0198550717504986,
+        -0.408282678752585, 0.408282678752585, 0.898333238706982, 0.101666761293018,
+        -0.543849712503288, 0.408282678752585, 0.898333238706982, 0.237233795043721,
+        -0.714898596212151, 0.408282678752585, 0.898333238706982, 0.408282678752585,
+        -0.898333238706982, 0.408282678752585, 0.898333238706982, 0.591717321247415,
+        -1.06938212241585, 0.408282678752585, 0.898333238706982, 0.762766204956279,
+        -1.20494915616655, 0.408282678752585, 0.898333238706982, 0.898333238706982,
+        -1.28676084570907, 0.408282678752585, 0.898333238706982, 0.980144928249501,
+        -0.408282678752585, 0.408282678752585, 0.980144928249501, 0.0198550717504986,
+        -0.490094368295104, 0.408282678752585, 0.980144928249501, 0.101666761293018,
+        -0.625661402045807, 0.408282678752585, 0.980144928249501, 0.237233795043721,
+        -0.796710285754671, 0.408282678752585, 0.980144928249501, 0.408282678752585,
+        -0.980144928249501, 0.408282678752585, 0.980144928249501, 0.591717321247415,
+        -1.15119381195836, 0.408282678752585, 0.980144928249501, 0.762766204956279,
+        -1.28676084570907, 0.408282678752585, 0.980144928249501, 0.898333238706982,
+        -1.36857253525159, 0.408282678752585, 0.980144928249501, 0.980144928249501,
+        0.368572535251587, 0.591717321247415, 0.0198550717504986, 0.0198550717504986,
+        0.286760845709068, 0.591717321247415, 0.0198550717504986, 0.101666761293018,
+        0.151193811958365, 0.591717321247415, 0.0198550717504986, 0.237233795043721,
+        -0.0198550717504986, 0.591717321247415, 0.0198550717504986, 0.408282678752585,
+        -0.203289714245329, 0.591717321247415, 0.0198550717504986, 0.591717321247415,
+        -0.374338597954193, 0.591717321247415, 0.0198550717504986, 0.762766204956279,
+        -0.509905631704896, 0.591717321247415, 0.0198550717504986, 0.898333238706982,
+        -0.591717321247415, 0.591717321247415, 0.0198550717504986, 0.980144928249501,
+        0.286760845709068, 0.591717321247415, 0.101666761293018, 0.0198550717504986,
+        0.204949156166549, 0.591717321247415, 0.101666761293018, 0.101666761293018,
+        0.0693821224158455, 0.591717321247415, 0.101666761293018, 0.237233795043721,
+        -0.101666761293018, 0.591717321247415, 0.101666761293018, 0.408282678752585,
+        -0.285101403787849, 0.591717321247415, 0.101666761293018, 0.591717321247415,
+        -0.456150287496712, 0.591717321247415, 0.101666761293018, 0.762766204956279,
+        -0.591717321247415, 0.591717321247415, 0.101666761293018, 0.898333238706982,
+        -0.673529010789935, 0.591717321247415, 0.101666761293018, 0.980144928249501,
+        0.151193811958365, 0.591717321247415, 0.237233795043721, 0.0198550717504986,
+        0.0693821224158455, 0.591717321247415, 0.237233795043721, 0.101666761293018,
+        -0.0661849113348580, 0.591717321247415, 0.237233795043721, 0.237233795043721,
+        -0.237233795043721, 0.591717321247415, 0.237233795043721, 0.408282678752585,
+        -0.420668437538552, 0.591717321247415, 0.237233795043721, 0.591717321247415,
+        -0.591717321247415, 0.591717321247415, 0.237233795043721, 0.762766204956279,
+        -0.727284354998119, 0.591717321247415, 0.237233795043721, 0.898333238706982,
+        -0.809096044540638, 0.591717321247415, 0.237233795043721, 0.980144928249501,
+        -0.0198550717504986, 0.591717321247415, 0.408282678752585, 0.0198550717504986,
+        -0.101666761293018, 0.591717321247415, 0.408282678752585, 0.101666761293018,
+        -0.237233795043721, 0.591717321247415, 0.408282678752585, 0.237233795043721,
+        -0.408282678752585, 0.591717321247415, 0.408282678752585, 0.408282678752585,
+        -0.591717321247415, 0.591717321247415, 0.408282678752585, 0.591717321247415,
+        -0.762766204956279, 0.591717321247415, 0.408282678752585, 0.762766204956279,
+        -0.898333238706982, 0.591717321247415, 0.408282678752585, 0.898333238706982,
+        -0.980144928249501, 0.591717321247415, 0.408282678752585, 0.980144928249501,
+        -0.203289714245329, 0.591717321247415, 0.591717321247415, 0.0198550717504986,
+        -0.285101403787849, 0.591717321247415, 0.591717321247415, 0.101666761293018,
+        -0.420668437538552, 0.591717321247415, 0.591717321247415, 0.237233795043721,
+        -0.591717321247415, 0.591717321247415, 0.591717321247415, 0.408282678752585,
+        -0.775151963742246, 0.591717321247415, 0.591717321247415, 0.591717321247415,
+        -0.946200847451109, 0.591717321247415, 0.591717321247415, 0.762766204956279,
+        -1.08176788120181, 0.591717321247415, 0.591717321247415, 0.898333238706982,
+        -1.16357957074433, 0.591717321247415, 0.591717321247415, 0.980144928249501,
+        -0.374338597954193, 0.591717321247415, 0.762766204956279, 0.0198550717504986,
+        -0.456150287496712, 0.591717321247415, 0.762766204956279, 0.101666761293018,
+        -0.591717321247415, 0.591717321247415, 0.762766204956279, 0.237233795043721,
+        -0.762766204956279, 0.591717321247415, 0.762766204956279, 0.408282678752585,
+        -0.946200847451109, 0.591717321247415, 0.762766204956279, 0.591717321247415,
+        -1.11724973115997, 0.591717321247415, 0.762766204956279, 0.762766204956279,
+        -1.25281676491068, 0.591717321247415, 0.762766204956279, 0.898333238706982,
+        -1.33462845445320, 0.591717321247415, 0.762766204956279, 0.980144928249501,
+        -0.509905631704896, 0.591717321247415, 0.898333238706982, 0.0198550717504986,
+        -0.591717321247415, 0.591717321247415, 0.898333238706982, 0.101666761293018,
+        -0.727284354998119, 0.591717321247415, 0.898333238706982, 0.237233795043721,
+        -0.898333238706982, 0.591717321247415, 0.898333238706982, 0.408282678752585,
+        -1.08176788120181, 0.591717321247415, 0.898333238706982, 0.591717321247415,
+        -1.25281676491068, 0.591717321247415, 0.898333238706982, 0.762766204956279,
+        -1.38838379866138, 0.591717321247415, 0.898333238706982, 0.898333238706982,
+        -1.47019548820390, 0.591717321247415, 0.898333238706982, 0.980144928249501,
+        -0.591717321247415, 0.591717321247415, 0.980144928249501, 0.0198550717504986,
+        -0.673529010789935, 0.591717321247415, 0.980144928249501, 0.101666761293018,
+        -0.809096044540638, 0.591717321247415, 0.980144928249501, 0.237233795043721,
+        -0.980144928249501, 0.591717321247415, 0.980144928249501, 0.408282678752585,
+        -1.16357957074433, 0.591717321247415, 0.980144928249501, 0.591717321247415,
+        -1.33462845445320, 0.591717321247415, 0.980144928249501, 0.762766204956279,
+        -1.47019548820390, 0.591717321247415, 0.980144928249501, 0.898333238706982,
+        -1.55200717774642, 0.591717321247415, 0.980144928249501, 0.980144928249501,
+        0.197523651542724, 0.762766204956279, 0.0198550717504986, 0.0198550717504986,
+        0.115711962000205, 0.762766204956279, 0.0198550717504986, 0.101666761293018,
+        -0.0198550717504986, 0.762766204956279, 0.0198550717504986, 0.237233795043721,
+        -0.190903955459362, 0.762766204956279, 0.0198550717504986, 0.408282678752585,
+        -0.374338597954193, 0.762766204956279, 0.0198550717504986, 0.591717321247415,
+        -0.545387481663056, 0.762766204956279, 0.0198550717504986, 0.762766204956279,
+        -0.680954515413760, 0.762766204956279, 0.0198550717504986, 0.898333238706982,
+        -0.762766204956279, 0.762766204956279, 0.0198550717504986, 0.980144928249501,
+        0.115711962000205, 0.762766204956279, 0.101666761293018, 0.0198550717504986,
+        0.0339002724576858, 0.762766204956279, 0.101666761293018, 0.101666761293018,
+        -0.101666761293018, 0.762766204956279, 0.101666761293018, 0.237233795043721,
+        -0.272715645001881, 0.762766204956279, 0.101666761293018, 0.408282678752585,
+        -0.456150287496712, 0.762766204956279, 0.101666761293018, 0.591717321247415,
+        -0.627199171205575, 0.762766204956279, 0.101666761293018, 0.762766204956279,
+        -0.762766204956279, 0.762766204956279, 0.101666761293018, 0.898333238706982,
+        -0.844577894498798, 0.762766204956279, 0.101666761293018, 0.980144928249501,
+        -0.0198550717504986, 0.762766204956279, 0.237233795043721, 0.0198550717504986,
+        -0.101666761293018, 0.762766204956279, 0.237233795043721, 0.101666761293018,
+        -0.237233795043721, 0.762766204956279, 0.237233795043721, 0.237233795043721,
+        -0.408282678752585, 0.762766204956279, 0.237233795043721, 0.408282678752585,
+        -0.591717321247415, 0.762766204956279, 0.237233795043721, 0.591717321247415,
+        -0.762766204956279, 0.762766204956279, 0.237233795043721, 0.762766204956279,
+        -0.898333238706982, 0.762766204956279, 0.237233795043721, 0.898333238706982,
+        -0.980144928249501, 0.762766204956279, 0.237233795043721, 0.980144928249501,
+        -0.190903955459362, 0.762766204956279, 0.408282678752585, 0.0198550717504986,
+        -0.272715645001881, 0.762766204956279, 0.408282678752585, 0.101666761293018,
+        -0.408282678752585, 0.762766204956279, 0.408282678752585, 0.237233795043721,
+        -0.579331562461448, 0.762766204956279, 0.408282678752585, 0.408282678752585,
+        -0.762766204956279, 0.762766204956279, 0.408282678752585, 0.591717321247415,
+        -0.933815088665142, 0.762766204956279, 0.408282678752585, 0.762766204956279,
+        -1.06938212241585, 0.762766204956279, 0.408282678752585, 0.898333238706982,
+        -1.15119381195836, 0.762766204956279, 0.408282678752585, 0.980144928249501,
+        -0.374338597954193, 0.762766204956279, 0.591717321247415, 0.0198550717504986,
+        -0.456150287496712, 0.762766204956279, 0.591717321247415, 0.101666761293018,
+        -0.591717321247415, 0.762766204956279, 0.591717321247415, 0.237233795043721,
+        -0.762766204956279, 0.762766204956279, 0.591717321247415, 0.408282678752585,
+        -0.946200847451109, 0.762766204956279, 0.591717321247415, 0.591717321247415,
+        -1.11724973115997, 0.762766204956279, 0.591717321247415, 0.762766204956279,
+        -1.25281676491068, 0.762766204956279, 0.591717321247415, 0.898333238706982,
+        -1.33462845445320, 0.762766204956279, 0.591717321247415, 0.980144928249501,
+        -0.545387481663056, 0.762766204956279, 0.762766204956279, 0.0198550717504986,
+        -0.627199171205575, 0.762766204956279, 0.762766204956279, 0.101666761293018,
+        -0.762766204956279, 0.762766204956279, 0.762766204956279, 0.237233795043721,
+        -0.933815088665142, 0.762766204956279, 0.762766204956279, 0.408282678752585,
+        -1.11724973115997, 0.762766204956279, 0.762766204956279, 0.591717321247415,
+        -1.28829861486884, 0.762766204956279, 0.762766204956279, 0.762766204956279,
+        -1.42386564861954, 0.762766204956279, 0.762766204956279, 0.898333238706982,
+        -1.50567733816206, 0.762766204956279, 0.762766204956279, 0.980144928249501,
+        -0.680954515413760, 0.762766204956279, 0.898333238706982, 0.0198550717504986,
+        -0.762766204956279, 0.762766204956279, 0.898333238706982, 0.101666761293018,
+        -0.898333238706982, 0.762766204956279, 0.898333238706982, 0.237233795043721,
+        -1.06938212241585, 0.762766204956279, 0.898333238706982, 0.408282678752585,
+        -1.25281676491068, 0.762766204956279, 0.898333238706982, 0.591717321247415,
+        -1.42386564861954, 0.762766204956279, 0.898333238706982, 0.762766204956279,
+        -1.55943268237024, 0.762766204956279, 0.898333238706982, 0.898333238706982,
+        -1.64124437191276, 0.762766204956279, 0.898333238706982, 0.980144928249501,
+        -0.762766204956279, 0.762766204956279, 0.980144928249501, 0.0198550717504986,
+        -0.844577894498798, 0.762766204956279, 0.980144928249501, 0.101666761293018,
+        -0.980144928249501, 0.762766204956279, 0.980144928249501, 0.237233795043721,
+        -1.15119381195836, 0.762766204956279, 0.980144928249501, 0.408282678752585,
+        -1.33462845445320, 0.762766204956279, 0.980144928249501, 0.591717321247415,
+        -1.50567733816206, 0.762766204956279, 0.980144928249501, 0.762766204956279,
+        -1.64124437191276, 0.762766204956279, 0.980144928249501, 0.898333238706982,
+        -1.72305606145528, 0.762766204956279, 0.980144928249501, 0.980144928249501,
+        0.0619566177920206, 0.898333238706982, 0.0198550717504986, 0.0198550717504986,
+        -0.0198550717504986, 0.898333238706982, 0.0198550717504986, 0.101666761293018,
+        -0.155422105501202, 0.898333238706982, 0.0198550717504986, 0.237233795043721,
+        -0.326470989210065, 0.898333238706982, 0.0198550717504986, 0.408282678752585,
+        -0.509905631704896, 0.898333238706982, 0.0198550717504986, 0.591717321247415,
+        -0.680954515413760, 0.898333238706982, 0.0198550717504986, 0.762766204956279,
+        -0.816521549164463, 0.898333238706982, 0.0198550717504986, 0.898333238706982,
+        -0.898333238706982, 0.898333238706982, 0.0198550717504986, 0.980144928249501,
+        -0.0198550717504986, 0.898333238706982, 0.101666761293018, 0.0198550717504986,
+        -0.101666761293018, 0.898333238706982, 0.101666761293018, 0.101666761293018,
+        -0.237233795043721, 0.898333238706982, 0.101666761293018, 0.237233795043721,
+        -0.408282678752585, 0.898333238706982, 0.101666761293018, 0.408282678752585,
+        -0.591717321247415, 0.898333238706982, 0.101666761293018, 0.591717321247415,
+        -0.762766204956279, 0.898333238706982, 0.101666761293018, 0.762766204956279,
+        -0.898333238706982, 0.898333238706982, 0.101666761293018, 0.898333238706982,
+        -0.980144928249501, 0.898333238706982, 0.101666761293018, 0.980144928249501,
+        -0.155422105501202, 0.898333238706982, 0.237233795043721, 0.0198550717504986,
+        -0.237233795043721, 0.898333238706982, 0.237233795043721, 0.101666761293018,
+        -0.372800828794425, 0.898333238706982, 0.237233795043721, 0.237233795043721,
+        -0.543849712503288, 0.898333238706982, 0.237233795043721, 0.408282678752585,
+        -0.727284354998119, 0.898333238706982, 0.237233795043721, 0.591717321247415,
+        -0.898333238706982, 0.898333238706982, 0.237233795043721, 0.762766204956279,
+        -1.03390027245769, 0.898333238706982, 0.237233795043721, 0.898333238706982,
+        -1.11571196200020, 0.898333238706982, 0.237233795043721, 0.980144928249501,
+        -0.326470989210065, 0.898333238706982, 0.408282678752585, 0.0198550717504986,
+        -0.408282678752585, 0.898333238706982, 0.408282678752585, 0.101666761293018,
+        -0.543849712503288, 0.898333238706982, 0.408282678752585, 0.237233795043721,
+        -0.714898596212151, 0.898333238706982, 0.408282678752585, 0.408282678752585,
+        -0.898333238706982, 0.898333238706982, 0.408282678752585, 0.591717321247415,
+        -1.06938212241585, 0.898333238706982, 0.408282678752585, 0.762766204956279,
+        -1.20494915616655, 0.898333238706982, 0.408282678752585, 0.898333238706982,
+        -1.28676084570907, 0.898333238706982, 0.408282678752585, 0.980144928249501,
+        -0.509905631704896, 0.898333238706982, 0.591717321247415, 0.0198550717504986,
+        -0.591717321247415, 0.898333238706982, 0.591717321247415, 0.101666761293018,
+        -0.727284354998119, 0.898333238706982, 0.591717321247415, 0.237233795043721,
+        -0.898333238706982, 0.898333238706982, 0.591717321247415, 0.408282678752585,
+        -1.08176788120181, 0.898333238706982, 0.591717321247415, 0.591717321247415,
+        -1.25281676491068, 0.898333238706982, 0.591717321247415, 0.762766204956279,
+        -1.38838379866138, 0.898333238706982, 0.591717321247415, 0.898333238706982,
+        -1.47019548820390, 0.898333238706982, 0.591717321247415, 0.980144928249501,
+        -0.680954515413760, 0.898333238706982, 0.762766204956279, 0.0198550717504986,
+        -0.762766204956279, 0.898333238706982, 0.762766204956279, 0.101666761293018,
+        -0.898333238706982, 0.898333238706982, 0.762766204956279, 0.237233795043721,
+        -1.06938212241585, 0.898333238706982, 0.762766204956279, 0.408282678752585,
+        -1.25281676491068, 0.898333238706982, 0.762766204956279, 0.591717321247415,
+        -1.42386564861954, 0.898333238706982, 0.762766204956279, 0.762766204956279,
+        -1.55943268237024, 0.898333238706982, 0.762766204956279, 0.898333238706982,
+        -1.64124437191276, 0.898333238706982, 0.762766204956279, 0.980144928249501,
+        -0.816521549164463, 0.898333238706982, 0.898333238706982, 0.0198550717504986,
+        -0.898333238706982, 0.898333238706982, 0.898333238706982, 0.101666761293018,
+        -1.03390027245769, 0.898333238706982, 0.898333238706982, 0.237233795043721,
+        -1.20494915616655, 0.898333238706982, 0.898333238706982, 0.408282678752585,
+        -1.38838379866138, 0.898333238706982, 0.898333238706982, 0.591717321247415,
+        -1.55943268237024, 0.898333238706982, 0.898333238706982, 0.762766204956279,
+        -1.69499971612095, 0.898333238706982, 0.898333238706982, 0.898333238706982,
+        -1.77681140566347, 0.898333238706982, 0.898333238706982, 0.980144928249501,
+        -0.898333238706982, 0.898333238706982, 0.980144928249501, 0.0198550717504986,
+        -0.980144928249501, 0.898333238706982, 0.980144928249501, 0.101666761293018,
+        -1.11571196200020, 0.898333238706982, 0.980144928249501, 0.237233795043721,
+        -1.28676084570907, 0.898333238706982, 0.980144928249501, 0.408282678752585,
+        -1.47019548820390, 0.898333238706982, 0.980144928249501, 0.591717321247415,
+        -1.64124437191276, 0.898333238706982, 0.980144928249501, 0.762766204956279,
+        -1.77681140566347, 0.898333238706982, 0.980144928249501, 0.898333238706982,
+        -1.85862309520599, 0.898333238706982, 0.980144928249501, 0.980144928249501,
+        -0.0198550717504986, 0.980144928249501, 0.0198550717504986, 0.0198550717504986,
+        -0.101666761293018, 0.980144928249501, 0.0198550717504986, 0.101666761293018,
+        -0.237233795043721, 0.980144928249501, 0.0198550717504986, 0.237233795043721,
+        -0.408282678752585, 0.980144928249501, 0.0198550717504986, 0.408282678752585,
+        -0.591717321247415, 0.980144928249501, 0.0198550717504986, 0.591717321247415,
+        -0.762766204956279, 0.980144928249501, 0.0198550717504986, 0.762766204956279,
+        -0.898333238706982, 0.980144928249501, 0.0198550717504986, 0.898333238706982,
+        -0.980144928249501, 0.980144928249501, 0.0198550717504986, 0.980144928249501,
+        -0.101666761293018, 0.980144928249501, 0.101666761293018, 0.0198550717504986,
+        -0.183478450835537, 0.980144928249501, 0.101666761293018, 0.101666761293018,
+        -0.319045484586240, 0.980144928249501, 0.101666761293018, 0.237233795043721,
+        -0.490094368295104, 0.980144928249501, 0.101666761293018, 0.408282678752585,
+        -0.673529010789935, 0.980144928249501, 0.101666761293018, 0.591717321247415,
+        -0.844577894498798, 0.980144928249501, 0.101666761293018, 0.762766204956279,
+        -0.980144928249501, 0.980144928249501, 0.101666761293018, 0.898333238706982,
+        -1.06195661779202, 0.980144928249501, 0.101666761293018, 0.980144928249501,
+        -0.237233795043721, 0.980144928249501, 0.237233795043721, 0.0198550717504986,
+        -0.319045484586240, 0.980144928249501, 0.237233795043721, 0.101666761293018,
+        -0.454612518336944, 0.980144928249501, 0.237233795043721, 0.237233795043721,
+        -0.625661402045807, 0.980144928249501, 0.237233795043721, 0.408282678752585,
+        -0.809096044540638, 0.980144928249501, 0.237233795043721, 0.591717321247415,
+        -0.980144928249501, 0.980144928249501, 0.237233795043721, 0.762766204956279,
+        -1.11571196200020, 0.980144928249501, 0.237233795043721, 0.898333238706982,
+        -1.19752365154272, 0.980144928249501, 0.237233795043721, 0.980144928249501,
+        -0.408282678752585, 0.980144928249501, 0.408282678752585, 0.0198550717504986,
+        -0.490094368295104, 0.980144928249501, 0.408282678752585, 0.101666761293018,
+        -0.625661402045807, 0.980144928249501, 0.408282678752585, 0.237233795043721,
+        -0.796710285754671, 0.980144928249501, 0.408282678752585, 0.408282678752585,
+        -0.980144928249501, 0.980144928249501, 0.408282678752585, 0.591717321247415,
+        -1.15119381195836, 0.980144928249501, 0.408282678752585, 0.762766204956279,
+        -1.28676084570907, 0.980144928249501, 0.408282678752585, 0.898333238706982,
+        -1.36857253525159, 0.980144928249501, 0.408282678752585, 0.980144928249501,
+        -0.591717321247415, 0.980144928249501, 0.591717321247415, 0.0198550717504986,
+        -0.673529010789935, 0.980144928249501, 0.591717321247415, 0.101666761293018,
+        -0.809096044540638, 0.980144928249501, 0.591717321247415, 0.237233795043721,
+        -0.980144928249501, 0.980144928249501, 0.591717321247415, 0.408282678752585,
+        -1.16357957074433, 0.980144928249501, 0.591717321247415, 0.591717321247415,
+        -1.33462845445320, 0.980144928249501, 0.591717321247415, 0.762766204956279,
+        -1.47019548820390, 0.980144928249501, 0.591717321247415, 0.898333238706982,
+        -1.55200717774642, 0.980144928249501, 0.591717321247415, 0.980144928249501,
+        -0.762766204956279, 0.980144928249501, 0.762766204956279, 0.0198550717504986,
+        -0.844577894498798, 0.980144928249501, 0.762766204956279, 0.101666761293018,
+        -0.980144928249501, 0.980144928249501, 0.762766204956279, 0.237233795043721,
+        -1.15119381195836, 0.980144928249501, 0.762766204956279, 0.408282678752585,
+        -1.33462845445320, 0.980144928249501, 0.762766204956279, 0.591717321247415,
+        -1.50567733816206, 0.980144928249501, 0.762766204956279, 0.762766204956279,
+        -1.64124437191276, 0.980144928249501, 0.762766204956279, 0.898333238706982,
+        -1.72305606145528, 0.980144928249501, 0.762766204956279, 0.980144928249501,
+        -0.898333238706982, 0.980144928249501, 0.898333238706982, 0.0198550717504986,
+        -0.980144928249501, 0.980144928249501, 0.898333238706982, 0.101666761293018,
+        -1.11571196200020, 0.980144928249501, 0.898333238706982, 0.237233795043721,
+        -1.28676084570907, 0.980144928249501, 0.898333238706982, 0.408282678752585,
+        -1.47019548820390, 0.980144928249501, 0.898333238706982, 0.591717321247415,
+        -1.64124437191276, 0.980144928249501, 0.898333238706982, 0.762766204956279,
+        -1.77681140566347, 0.980144928249501, 0.898333238706982, 0.898333238706982,
+        -1.85862309520599, 0.980144928249501, 0.898333238706982, 0.980144928249501,
+        -0.980144928249501, 0.980144928249501, 0.980144928249501, 0.0198550717504986,
+        -1.06195661779202, 0.980144928249501, 0.980144928249501, 0.101666761293018,
+        -1.19752365154272, 0.980144928249501, 0.980144928249501, 0.237233795043721,
+        -1.36857253525159, 0.980144928249501, 0.980144928249501, 0.408282678752585,
+        -1.55200717774642, 0.980144928249501, 0.980144928249501, 0.591717321247415,
+        -1.72305606145528, 0.980144928249501, 0.980144928249501, 0.762766204956279,
+        -1.85862309520599, 0.980144928249501, 0.980144928249501, 0.898333238706982,
+        -1.94043478474850, 0.980144928249501, 0.980144928249501, 0.980144928249501};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         0.000129663841667443, 0.000284848327340364, 0.000401827492048938, 0.000464562408855265,
         0.000464562408855265, 0.000401827492048938, 0.000284848327340364, 0.000129663841667443,
@@ -3394,735 +2587,735 @@ struct GaussLegendreQuadrature<3, 9>
     inline static std::uint8_t constexpr kOrder                              = 9;
     inline static int constexpr kPoints                                      = 729;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.952240359260031,   0.886175793169969,   0.774845955857018,  0.630286951209200,
-        0.468160239506688,   0.306033527804175,   0.161474523156357,  0.0501446858434065,
-        -0.0159198802466562, 0.886175793169969,   0.820111227079906,  0.708781389766955,
-        0.564222385119137,   0.402095673416625,   0.239968961714112,  0.0954099570662947,
-        -0.0159198802466562, -0.0819844463367190, 0.774845955857018,  0.708781389766955,
-        0.597451552454004,   0.452892547806186,   0.290765836103674,  0.128639124401161,
-        -0.0159198802466562, -0.127249717559607,  -0.193314283649670, 0.630286951209200,
-        0.564222385119137,   0.452892547806186,   0.308333543158369,  0.146206831455856,
-        -0.0159198802466562, -0.160478884894474,  -0.271808722207425, -0.337873288297487,
-        0.468160239506688,   0.402095673416625,   0.290765836103674,  0.146206831455856,
-        -0.0159198802466562, -0.178046591949169,  -0.322605596596986, -0.433935433909937,
-        -0.500000000000000,  0.306033527804175,   0.239968961714112,  0.128639124401161,
-        -0.0159198802466562, -0.178046591949169,  -0.340173303651682, -0.484732308299499,
-        -0.596062145612450,  -0.662126711702513,  0.161474523156357,  0.0954099570662947,
-        -0.0159198802466562, -0.160478884894474,  -0.322605596596986, -0.484732308299499,
-        -0.629291312947316,  -0.740621150260267,  -0.806685716350330, 0.0501446858434065,
-        -0.0159198802466562, -0.127249717559607,  -0.271808722207425, -0.433935433909937,
-        -0.596062145612450,  -0.740621150260267,  -0.851950987573218, -0.918015553663281,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  0.886175793169969,   0.820111227079906,  0.708781389766955,
-        0.564222385119137,   0.402095673416625,   0.239968961714112,  0.0954099570662947,
-        -0.0159198802466562, -0.0819844463367190, 0.820111227079906,  0.754046660989843,
-        0.642716823676892,   0.498157819029075,   0.336031107326562,  0.173904395624049,
-        0.0293453909762320,  -0.0819844463367190, -0.148049012426782, 0.708781389766955,
-        0.642716823676892,   0.531386986363941,   0.386827981716124,  0.224701270013611,
-        0.0625745583110984,  -0.0819844463367190, -0.193314283649670, -0.259378849739733,
-        0.564222385119137,   0.498157819029075,   0.386827981716124,  0.242268977068306,
-        0.0801422653657937,  -0.0819844463367190, -0.226543450984536, -0.337873288297487,
-        -0.403937854387550,  0.402095673416625,   0.336031107326562,  0.224701270013611,
-        0.0801422653657937,  -0.0819844463367190, -0.244111158039232, -0.388670162687049,
-        -0.500000000000000,  -0.566064566090063,  0.239968961714112,  0.173904395624049,
-        0.0625745583110984,  -0.0819844463367190, -0.244111158039232, -0.406237869741744,
-        -0.550796874389562,  -0.662126711702513,  -0.728191277792575, 0.0954099570662947,
-        0.0293453909762320,  -0.0819844463367190, -0.226543450984536, -0.388670162687049,
-        -0.550796874389562,  -0.695355879037379,  -0.806685716350330, -0.872750282440393,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.0819844463367190, -0.148049012426782, -0.259378849739733,
-        -0.403937854387550,  -0.566064566090063,  -0.728191277792575, -0.872750282440393,
-        -0.984080119753344,  -1.05014468584341,   0.774845955857018,  0.708781389766955,
-        0.597451552454004,   0.452892547806186,   0.290765836103674,  0.128639124401161,
-        -0.0159198802466562, -0.127249717559607,  -0.193314283649670, 0.708781389766955,
-        0.642716823676892,   0.531386986363941,   0.386827981716124,  0.224701270013611,
-        0.0625745583110984,  -0.0819844463367190, -0.193314283649670, -0.259378849739733,
-        0.597451552454004,   0.531386986363941,   0.420057149050990,  0.275498144403173,
-        0.113371432700660,   -0.0487552790018526, -0.193314283649670, -0.304644120962621,
-        -0.370708687052684,  0.452892547806186,   0.386827981716124,  0.275498144403173,
-        0.130939139755355,   -0.0311875719471573, -0.193314283649670, -0.337873288297487,
-        -0.449203125610438,  -0.515267691700501,  0.290765836103674,  0.224701270013611,
-        0.113371432700660,   -0.0311875719471573, -0.193314283649670, -0.355440995352183,
-        -0.500000000000000,  -0.611329837312951,  -0.677394403403014, 0.128639124401161,
-        0.0625745583110984,  -0.0487552790018526, -0.193314283649670, -0.355440995352183,
-        -0.517567707054695,  -0.662126711702513,  -0.773456549015464, -0.839521115105526,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.127249717559607,  -0.193314283649670, -0.304644120962621,
-        -0.449203125610438,  -0.611329837312951,  -0.773456549015464, -0.918015553663281,
-        -1.02934539097623,   -1.09540995706629,   -0.193314283649670, -0.259378849739733,
-        -0.370708687052684,  -0.515267691700501,  -0.677394403403014, -0.839521115105526,
-        -0.984080119753344,  -1.09540995706629,   -1.16147452315636,  0.630286951209200,
-        0.564222385119137,   0.452892547806186,   0.308333543158369,  0.146206831455856,
-        -0.0159198802466562, -0.160478884894474,  -0.271808722207425, -0.337873288297487,
-        0.564222385119137,   0.498157819029075,   0.386827981716124,  0.242268977068306,
-        0.0801422653657937,  -0.0819844463367190, -0.226543450984536, -0.337873288297487,
-        -0.403937854387550,  0.452892547806186,   0.386827981716124,  0.275498144403173,
-        0.130939139755355,   -0.0311875719471573, -0.193314283649670, -0.337873288297487,
-        -0.449203125610438,  -0.515267691700501,  0.308333543158369,  0.242268977068306,
-        0.130939139755355,   -0.0136198648924619, -0.175746576594975, -0.337873288297487,
-        -0.482432292945305,  -0.593762130258256,  -0.659826696348318, 0.146206831455856,
-        0.0801422653657937,  -0.0311875719471573, -0.175746576594975, -0.337873288297487,
-        -0.500000000000000,  -0.644559004647817,  -0.755888841960768, -0.821953408050831,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.160478884894474,  -0.226543450984536, -0.337873288297487,
-        -0.482432292945305,  -0.644559004647817,  -0.806685716350330, -0.951244720998147,
-        -1.06257455831110,   -1.12863912440116,   -0.271808722207425, -0.337873288297487,
-        -0.449203125610438,  -0.593762130258256,  -0.755888841960768, -0.918015553663281,
-        -1.06257455831110,   -1.17390439562405,   -1.23996896171411,  -0.337873288297487,
-        -0.403937854387550,  -0.515267691700501,  -0.659826696348318, -0.821953408050831,
-        -0.984080119753344,  -1.12863912440116,   -1.23996896171411,  -1.30603352780417,
-        0.468160239506688,   0.402095673416625,   0.290765836103674,  0.146206831455856,
-        -0.0159198802466562, -0.178046591949169,  -0.322605596596986, -0.433935433909937,
-        -0.500000000000000,  0.402095673416625,   0.336031107326562,  0.224701270013611,
-        0.0801422653657937,  -0.0819844463367190, -0.244111158039232, -0.388670162687049,
-        -0.500000000000000,  -0.566064566090063,  0.290765836103674,  0.224701270013611,
-        0.113371432700660,   -0.0311875719471573, -0.193314283649670, -0.355440995352183,
-        -0.500000000000000,  -0.611329837312951,  -0.677394403403014, 0.146206831455856,
-        0.0801422653657937,  -0.0311875719471573, -0.175746576594975, -0.337873288297487,
-        -0.500000000000000,  -0.644559004647817,  -0.755888841960768, -0.821953408050831,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.178046591949169,  -0.244111158039232, -0.355440995352183,
-        -0.500000000000000,  -0.662126711702513,  -0.824253423405025, -0.968812428052843,
-        -1.08014226536579,   -1.14620683145586,   -0.322605596596986, -0.388670162687049,
-        -0.500000000000000,  -0.644559004647817,  -0.806685716350330, -0.968812428052843,
-        -1.11337143270066,   -1.22470127001361,   -1.29076583610367,  -0.433935433909937,
-        -0.500000000000000,  -0.611329837312951,  -0.755888841960768, -0.918015553663281,
-        -1.08014226536579,   -1.22470127001361,   -1.33603110732656,  -1.40209567341662,
-        -0.500000000000000,  -0.566064566090063,  -0.677394403403014, -0.821953408050831,
-        -0.984080119753344,  -1.14620683145586,   -1.29076583610367,  -1.40209567341662,
-        -1.46816023950669,   0.306033527804175,   0.239968961714112,  0.128639124401161,
-        -0.0159198802466562, -0.178046591949169,  -0.340173303651682, -0.484732308299499,
-        -0.596062145612450,  -0.662126711702513,  0.239968961714112,  0.173904395624049,
-        0.0625745583110984,  -0.0819844463367190, -0.244111158039232, -0.406237869741744,
-        -0.550796874389562,  -0.662126711702513,  -0.728191277792575, 0.128639124401161,
-        0.0625745583110984,  -0.0487552790018526, -0.193314283649670, -0.355440995352183,
-        -0.517567707054695,  -0.662126711702513,  -0.773456549015464, -0.839521115105526,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.178046591949169,  -0.244111158039232, -0.355440995352183,
-        -0.500000000000000,  -0.662126711702513,  -0.824253423405025, -0.968812428052843,
-        -1.08014226536579,   -1.14620683145586,   -0.340173303651682, -0.406237869741744,
-        -0.517567707054695,  -0.662126711702513,  -0.824253423405025, -0.986380135107538,
-        -1.13093913975536,   -1.24226897706831,   -1.30833354315837,  -0.484732308299499,
-        -0.550796874389562,  -0.662126711702513,  -0.806685716350330, -0.968812428052843,
-        -1.13093913975536,   -1.27549814440317,   -1.38682798171612,  -1.45289254780619,
-        -0.596062145612450,  -0.662126711702513,  -0.773456549015464, -0.918015553663281,
-        -1.08014226536579,   -1.24226897706831,   -1.38682798171612,  -1.49815781902907,
-        -1.56422238511914,   -0.662126711702513,  -0.728191277792575, -0.839521115105526,
-        -0.984080119753344,  -1.14620683145586,   -1.30833354315837,  -1.45289254780619,
-        -1.56422238511914,   -1.63028695120920,   0.161474523156357,  0.0954099570662947,
-        -0.0159198802466562, -0.160478884894474,  -0.322605596596986, -0.484732308299499,
-        -0.629291312947316,  -0.740621150260267,  -0.806685716350330, 0.0954099570662947,
-        0.0293453909762320,  -0.0819844463367190, -0.226543450984536, -0.388670162687049,
-        -0.550796874389562,  -0.695355879037379,  -0.806685716350330, -0.872750282440393,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.160478884894474,  -0.226543450984536, -0.337873288297487,
-        -0.482432292945305,  -0.644559004647817,  -0.806685716350330, -0.951244720998147,
-        -1.06257455831110,   -1.12863912440116,   -0.322605596596986, -0.388670162687049,
-        -0.500000000000000,  -0.644559004647817,  -0.806685716350330, -0.968812428052843,
-        -1.11337143270066,   -1.22470127001361,   -1.29076583610367,  -0.484732308299499,
-        -0.550796874389562,  -0.662126711702513,  -0.806685716350330, -0.968812428052843,
-        -1.13093913975536,   -1.27549814440317,   -1.38682798171612,  -1.45289254780619,
-        -0.629291312947316,  -0.695355879037379,  -0.806685716350330, -0.951244720998147,
-        -1.11337143270066,   -1.27549814440317,   -1.42005714905099,  -1.53138698636394,
-        -1.59745155245400,   -0.740621150260267,  -0.806685716350330, -0.918015553663281,
-        -1.06257455831110,   -1.22470127001361,   -1.38682798171612,  -1.53138698636394,
-        -1.64271682367689,   -1.70878138976695,   -0.806685716350330, -0.872750282440393,
-        -0.984080119753344,  -1.12863912440116,   -1.29076583610367,  -1.45289254780619,
-        -1.59745155245400,   -1.70878138976695,   -1.77484595585702,  0.0501446858434065,
-        -0.0159198802466562, -0.127249717559607,  -0.271808722207425, -0.433935433909937,
-        -0.596062145612450,  -0.740621150260267,  -0.851950987573218, -0.918015553663281,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.127249717559607,  -0.193314283649670, -0.304644120962621,
-        -0.449203125610438,  -0.611329837312951,  -0.773456549015464, -0.918015553663281,
-        -1.02934539097623,   -1.09540995706629,   -0.271808722207425, -0.337873288297487,
-        -0.449203125610438,  -0.593762130258256,  -0.755888841960768, -0.918015553663281,
-        -1.06257455831110,   -1.17390439562405,   -1.23996896171411,  -0.433935433909937,
-        -0.500000000000000,  -0.611329837312951,  -0.755888841960768, -0.918015553663281,
-        -1.08014226536579,   -1.22470127001361,   -1.33603110732656,  -1.40209567341662,
-        -0.596062145612450,  -0.662126711702513,  -0.773456549015464, -0.918015553663281,
-        -1.08014226536579,   -1.24226897706831,   -1.38682798171612,  -1.49815781902907,
-        -1.56422238511914,   -0.740621150260267,  -0.806685716350330, -0.918015553663281,
-        -1.06257455831110,   -1.22470127001361,   -1.38682798171612,  -1.53138698636394,
-        -1.64271682367689,   -1.70878138976695,   -0.851950987573218, -0.918015553663281,
-        -1.02934539097623,   -1.17390439562405,   -1.33603110732656,  -1.49815781902907,
-        -1.64271682367689,   -1.75404666098984,   -1.82011122707991,  -0.918015553663281,
-        -0.984080119753344,  -1.09540995706629,   -1.23996896171411,  -1.40209567341662,
-        -1.56422238511914,   -1.70878138976695,   -1.82011122707991,  -1.88617579316997,
-        -0.0159198802466562, -0.0819844463367190, -0.193314283649670, -0.337873288297487,
-        -0.500000000000000,  -0.662126711702513,  -0.806685716350330, -0.918015553663281,
-        -0.984080119753344,  -0.0819844463367190, -0.148049012426782, -0.259378849739733,
-        -0.403937854387550,  -0.566064566090063,  -0.728191277792575, -0.872750282440393,
-        -0.984080119753344,  -1.05014468584341,   -0.193314283649670, -0.259378849739733,
-        -0.370708687052684,  -0.515267691700501,  -0.677394403403014, -0.839521115105526,
-        -0.984080119753344,  -1.09540995706629,   -1.16147452315636,  -0.337873288297487,
-        -0.403937854387550,  -0.515267691700501,  -0.659826696348318, -0.821953408050831,
-        -0.984080119753344,  -1.12863912440116,   -1.23996896171411,  -1.30603352780417,
-        -0.500000000000000,  -0.566064566090063,  -0.677394403403014, -0.821953408050831,
-        -0.984080119753344,  -1.14620683145586,   -1.29076583610367,  -1.40209567341662,
-        -1.46816023950669,   -0.662126711702513,  -0.728191277792575, -0.839521115105526,
-        -0.984080119753344,  -1.14620683145586,   -1.30833354315837,  -1.45289254780619,
-        -1.56422238511914,   -1.63028695120920,   -0.806685716350330, -0.872750282440393,
-        -0.984080119753344,  -1.12863912440116,   -1.29076583610367,  -1.45289254780619,
-        -1.59745155245400,   -1.70878138976695,   -1.77484595585702,  -0.918015553663281,
-        -0.984080119753344,  -1.09540995706629,   -1.23996896171411,  -1.40209567341662,
-        -1.56422238511914,   -1.70878138976695,   -1.82011122707991,  -1.88617579316997,
-        -0.984080119753344,  -1.05014468584341,   -1.16147452315636,  -1.30603352780417,
-        -1.46816023950669,   -1.63028695120920,   -1.77484595585702,  -1.88617579316997,
-        -1.95224035926003,   0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0159198802466562,
-        0.0159198802466562,  0.0159198802466562,  0.0159198802466562, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.0819844463367190,  0.0819844463367190,  0.0819844463367190, 0.0819844463367190,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.193314283649670,   0.193314283649670,  0.193314283649670,
-        0.193314283649670,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.337873288297487,  0.337873288297487,
-        0.337873288297487,   0.337873288297487,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.500000000000000,
-        0.500000000000000,   0.500000000000000,   0.500000000000000,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.662126711702513,   0.662126711702513,   0.662126711702513,  0.662126711702513,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.806685716350330,   0.806685716350330,  0.806685716350330,
-        0.806685716350330,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.918015553663281,  0.918015553663281,
-        0.918015553663281,   0.918015553663281,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.984080119753344,
-        0.984080119753344,   0.984080119753344,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344,
-        0.0159198802466562,  0.0819844463367190,  0.193314283649670,  0.337873288297487,
-        0.500000000000000,   0.662126711702513,   0.806685716350330,  0.918015553663281,
-        0.984080119753344,   0.0159198802466562,  0.0819844463367190, 0.193314283649670,
-        0.337873288297487,   0.500000000000000,   0.662126711702513,  0.806685716350330,
-        0.918015553663281,   0.984080119753344,   0.0159198802466562, 0.0819844463367190,
-        0.193314283649670,   0.337873288297487,   0.500000000000000,  0.662126711702513,
-        0.806685716350330,   0.918015553663281,   0.984080119753344,  0.0159198802466562,
-        0.0819844463367190,  0.193314283649670,   0.337873288297487,  0.500000000000000,
-        0.662126711702513,   0.806685716350330,   0.918015553663281,  0.984080119753344};
+        0.952240359260031, 0.0159198802466562, 0.0159198802466562, 0.0159198802466562,
+        0.886175793169969, 0.0159198802466562, 0.0159198802466562, 0.0819844463367190,
+        0.774845955857018, 0.0159198802466562, 0.0159198802466562, 0.193314283649670,
+        0.630286951209200, 0.0159198802466562, 0.0159198802466562, 0.337873288297487,
+        0.468160239506688, 0.0159198802466562, 0.0159198802466562, 0.500000000000000,
+        0.306033527804175, 0.0159198802466562, 0.0159198802466562, 0.662126711702513,
+        0.161474523156357, 0.0159198802466562, 0.0159198802466562, 0.806685716350330,
+        0.0501446858434065, 0.0159198802466562, 0.0159198802466562, 0.918015553663281,
+        -0.0159198802466562, 0.0159198802466562, 0.0159198802466562, 0.984080119753344,
+        0.886175793169969, 0.0159198802466562, 0.0819844463367190, 0.0159198802466562,
+        0.820111227079906, 0.0159198802466562, 0.0819844463367190, 0.0819844463367190,
+        0.708781389766955, 0.0159198802466562, 0.0819844463367190, 0.193314283649670,
+        0.564222385119137, 0.0159198802466562, 0.0819844463367190, 0.337873288297487,
+        0.402095673416625, 0.0159198802466562, 0.0819844463367190, 0.500000000000000,
+        0.239968961714112, 0.0159198802466562, 0.0819844463367190, 0.662126711702513,
+        0.0954099570662947, 0.0159198802466562, 0.0819844463367190, 0.806685716350330,
+        -0.0159198802466562, 0.0159198802466562, 0.0819844463367190, 0.918015553663281,
+        -0.0819844463367190, 0.0159198802466562, 0.0819844463367190, 0.984080119753344,
+        0.774845955857018, 0.0159198802466562, 0.193314283649670, 0.0159198802466562,
+        0.708781389766955, 0.0159198802466562, 0.193314283649670, 0.0819844463367190,
+        0.597451552454004, 0.0159198802466562, 0.193314283649670, 0.193314283649670,
+        0.452892547806186, 0.0159198802466562, 0.193314283649670, 0.337873288297487,
+        0.290765836103674, 0.0159198802466562, 0.193314283649670, 0.500000000000000,
+        0.128639124401161, 0.0159198802466562, 0.193314283649670, 0.662126711702513,
+        -0.0159198802466562, 0.0159198802466562, 0.193314283649670, 0.806685716350330,
+        -0.127249717559607, 0.0159198802466562, 0.193314283649670, 0.918015553663281,
+        -0.193314283649670, 0.0159198802466562, 0.193314283649670, 0.984080119753344,
+        0.630286951209200, 0.0159198802466562, 0.337873288297487, 0.0159198802466562,
+        0.564222385119137, 0.0159198802466562, 0.337873288297487, 0.0819844463367190,
+        0.452892547806186, 0.0159198802466562, 0.337873288297487, 0.193314283649670,
+        0.308333543158369, 0.0159198802466562, 0.337873288297487, 0.337873288297487,
+        0.146206831455856, 0.0159198802466562, 0.337873288297487, 0.500000000000000,
+        -0.0159198802466562, 0.0159198802466562, 0.337873288297487, 0.662126711702513,
+        -0.160478884894474, 0.0159198802466562, 0.337873288297487, 0.806685716350330,
+        -0.271808722207425, 0.0159198802466562, 0.337873288297487, 0.918015553663281,
+        -0.337873288297487, 0.0159198802466562, 0.337873288297487, 0.984080119753344,
+        0.468160239506688, 0.0159198802466562, 0.500000000000000, 0.0159198802466562,
+        0.402095673416625, 0.0159198802466562, 0.500000000000000, 0.0819844463367190,
+        0.290765836103674, 0.0159198802466562, 0.500000000000000, 0.193314283649670,
+        0.146206831455856, 0.0159198802466562, 0.500000000000000, 0.337873288297487,
+        -0.0159198802466562, 0.0159198802466562, 0.500000000000000, 0.500000000000000,
+        -0.178046591949169, 0.0159198802466562, 0.500000000000000, 0.662126711702513,
+        -0.322605596596986, 0.0159198802466562, 0.500000000000000, 0.806685716350330,
+        -0.433935433909937, 0.0159198802466562, 0.500000000000000, 0.918015553663281,
+        -0.500000000000000, 0.0159198802466562, 0.500000000000000, 0.984080119753344,
+        0.306033527804175, 0.0159198802466562, 0.662126711702513, 0.0159198802466562,
+        0.239968961714112, 0.0159198802466562, 0.662126711702513, 0.0819844463367190,
+        0.128639124401161, 0.0159198802466562, 0.662126711702513, 0.193314283649670,
+        -0.0159198802466562, 0.0159198802466562, 0.662126711702513, 0.337873288297487,
+        -0.178046591949169, 0.0159198802466562, 0.662126711702513, 0.500000000000000,
+        -0.340173303651682, 0.0159198802466562, 0.662126711702513, 0.662126711702513,
+        -0.484732308299499, 0.0159198802466562, 0.662126711702513, 0.806685716350330,
+        -0.596062145612450, 0.0159198802466562, 0.662126711702513, 0.918015553663281,
+        -0.662126711702513, 0.0159198802466562, 0.662126711702513, 0.984080119753344,
+        0.161474523156357, 0.0159198802466562, 0.806685716350330, 0.0159198802466562,
+        0.0954099570662947, 0.0159198802466562, 0.806685716350330, 0.0819844463367190,
+        -0.0159198802466562, 0.0159198802466562, 0.806685716350330, 0.193314283649670,
+        -0.160478884894474, 0.0159198802466562, 0.806685716350330, 0.337873288297487,
+        -0.322605596596986, 0.0159198802466562, 0.806685716350330, 0.500000000000000,
+        -0.484732308299499, 0.0159198802466562, 0.806685716350330, 0.662126711702513,
+        -0.629291312947316, 0.0159198802466562, 0.806685716350330, 0.806685716350330,
+        -0.740621150260267, 0.0159198802466562, 0.806685716350330, 0.918015553663281,
+        -0.806685716350330, 0.0159198802466562, 0.806685716350330, 0.984080119753344,
+        0.0501446858434065, 0.0159198802466562, 0.918015553663281, 0.0159198802466562,
+        -0.0159198802466562, 0.0159198802466562, 0.918015553663281, 0.0819844463367190,
+        -0.127249717559607, 0.0159198802466562, 0.918015553663281, 0.193314283649670,
+        -0.271808722207425, 0.0159198802466562, 0.918015553663281, 0.337873288297487,
+        -0.433935433909937, 0.0159198802466562, 0.918015553663281, 0.500000000000000,
+        -0.596062145612450, 0.0159198802466562, 0.918015553663281, 0.662126711702513,
+        -0.740621150260267, 0.0159198802466562, 0.918015553663281, 0.806685716350330,
+        -0.851950987573218, 0.0159198802466562, 0.918015553663281, 0.918015553663281,
+        -0.918015553663281, 0.0159198802466562, 0.918015553663281, 0.984080119753344,
+        -0.0159198802466562, 0.0159198802466562, 0.984080119753344, 0.0159198802466562,
+        -0.0819844463367190, 0.0159198802466562, 0.984080119753344, 0.0819844463367190,
+        -0.193314283649670, 0.0159198802466562, 0.984080119753344, 0.193314283649670,
+        -0.337873288297487, 0.0159198802466562, 0.984080119753344, 0.337873288297487,
+        -0.500000000000000, 0.0159198802466562, 0.984080119753344, 0.500000000000000,
+        -0.662126711702513, 0.0159198802466562, 0.984080119753344, 0.662126711702513,
+        -0.806685716350330, 0.0159198802466562, 0.984080119753344, 0.806685716350330,
+        -0.918015553663281, 0.0159198802466562, 0.984080119753344, 0.918015553663281,
+        -0.984080119753344, 0.0159198802466562, 0.984080119753344, 0.984080119753344,
+        0.886175793169969, 0.0819844463367190, 0.0159198802466562, 0.0159198802466562,
+        0.820111227079906, 0.0819844463367190, 0.0159198802466562, 0.0819844463367190,
+        0.708781389766955, 0.0819844463367190, 0.0159198802466562, 0.193314283649670,
+        0.564222385119137, 0.0819844463367190, 0.0159198802466562, 0.337873288297487,
+        0.402095673416625, 0.0819844463367190, 0.0159198802466562, 0.500000000000000,
+        0.239968961714112, 0.0819844463367190, 0.0159198802466562, 0.662126711702513,
+        0.0954099570662947, 0.0819844463367190, 0.0159198802466562, 0.806685716350330,
+        -0.0159198802466562, 0.0819844463367190, 0.0159198802466562, 0.918015553663281,
+        -0.0819844463367190, 0.0819844463367190, 0.0159198802466562, 0.984080119753344,
+        0.820111227079906, 0.0819844463367190, 0.0819844463367190, 0.0159198802466562,
+        0.754046660989843, 0.0819844463367190, 0.0819844463367190, 0.0819844463367190,
+        0.642716823676892, 0.0819844463367190, 0.0819844463367190, 0.193314283649670,
+        0.498157819029075, 0.0819844463367190, 0.0819844463367190, 0.337873288297487,
+        0.336031107326562, 0.0819844463367190, 0.0819844463367190, 0.500000000000000,
+        0.173904395624049, 0.0819844463367190, 0.0819844463367190, 0.662126711702513,
+        0.0293453909762320, 0.0819844463367190, 0.0819844463367190, 0.806685716350330,
+        -0.0819844463367190, 0.0819844463367190, 0.0819844463367190, 0.918015553663281,
+        -0.148049012426782, 0.0819844463367190, 0.0819844463367190, 0.984080119753344,
+        0.708781389766955, 0.0819844463367190, 0.193314283649670, 0.0159198802466562,
+        0.642716823676892, 0.0819844463367190, 0.193314283649670, 0.0819844463367190,
+        0.531386986363941, 0.0819844463367190, 0.193314283649670, 0.193314283649670,
+        0.386827981716124, 0.0819844463367190, 0.193314283649670, 0.337873288297487,
+        0.224701270013611, 0.0819844463367190, 0.193314283649670, 0.500000000000000,
+        0.0625745583110984, 0.0819844463367190, 0.193314283649670, 0.662126711702513,
+        -0.0819844463367190, 0.0819844463367190, 0.193314283649670, 0.806685716350330,
+        -0.193314283649670, 0.0819844463367190, 0.193314283649670, 0.918015553663281,
+        -0.259378849739733, 0.0819844463367190, 0.193314283649670, 0.984080119753344,
+        0.564222385119137, 0.0819844463367190, 0.337873288297487, 0.0159198802466562,
+        0.498157819029075, 0.0819844463367190, 0.337873288297487, 0.0819844463367190,
+        0.386827981716124, 0.0819844463367190, 0.337873288297487, 0.193314283649670,
+        0.242268977068306, 0.0819844463367190, 0.337873288297487, 0.337873288297487,
+        0.0801422653657937, 0.0819844463367190, 0.337873288297487, 0.500000000000000,
+        -0.0819844463367190, 0.0819844463367190, 0.337873288297487, 0.662126711702513,
+        -0.226543450984536, 0.0819844463367190, 0.337873288297487, 0.806685716350330,
+        -0.337873288297487, 0.0819844463367190, 0.337873288297487, 0.918015553663281,
+        -0.403937854387550, 0.0819844463367190, 0.337873288297487, 0.984080119753344,
+        0.402095673416625, 0.0819844463367190, 0.500000000000000, 0.0159198802466562,
+        0.336031107326562, 0.0819844463367190, 0.500000000000000, 0.0819844463367190,
+        0.224701270013611, 0.0819844463367190, 0.500000000000000, 0.193314283649670,
+        0.0801422653657937, 0.0819844463367190, 0.500000000000000, 0.337873288297487,
+        -0.0819844463367190, 0.0819844463367190, 0.500000000000000, 0.500000000000000,
+        -0.244111158039232, 0.0819844463367190, 0.500000000000000, 0.662126711702513,
+        -0.388670162687049, 0.0819844463367190, 0.500000000000000, 0.806685716350330,
+        -0.500000000000000, 0.0819844463367190, 0.500000000000000, 0.918015553663281,
+        -0.566064566090063, 0.0819844463367190, 0.500000000000000, 0.984080119753344,
+        0.239968961714112, 0.0819844463367190, 0.662126711702513, 0.0159198802466562,
+        0.173904395624049, 0.0819844463367190, 0.662126711702513, 0.0819844463367190,
+        0.0625745583110984, 0.0819844463367190, 0.662126711702513, 0.193314283649670,
+        -0.0819844463367190, 0.0819844463367190, 0.662126711702513, 0.337873288297487,
+        -0.244111158039232, 0.0819844463367190, 0.662126711702513, 0.500000000000000,
+        -0.406237869741744, 0.0819844463367190, 0.662126711702513, 0.662126711702513,
+        -0.550796874389562, 0.0819844463367190, 0.662126711702513, 0.806685716350330,
+        -0.662126711702513, 0.0819844463367190, 0.662126711702513, 0.918015553663281,
+        -0.728191277792575, 0.0819844463367190, 0.662126711702513, 0.984080119753344,
+        0.0954099570662947, 0.0819844463367190, 0.806685716350330, 0.0159198802466562,
+        0.0293453909762320, 0.0819844463367190, 0.806685716350330, 0.0819844463367190,
+        -0.0819844463367190, 0.0819844463367190, 0.806685716350330, 0.193314283649670,
+        -0.226543450984536, 0.0819844463367190, 0.806685716350330, 0.337873288297487,
+        -0.388670162687049, 0.0819844463367190, 0.806685716350330, 0.500000000000000,
+        -0.550796874389562, 0.0819844463367190, 0.806685716350330, 0.662126711702513,
+        -0.695355879037379, 0.0819844463367190, 0.806685716350330, 0.806685716350330,
+        -0.806685716350330, 0.0819844463367190, 0.806685716350330, 0.918015553663281,
+        -0.872750282440393, 0.0819844463367190, 0.806685716350330, 0.984080119753344,
+        -0.0159198802466562, 0.0819844463367190, 0.918015553663281, 0.0159198802466562,
+        -0.0819844463367190, 0.0819844463367190, 0.918015553663281, 0.0819844463367190,
+        -0.193314283649670, 0.0819844463367190, 0.918015553663281, 0.193314283649670,
+        -0.337873288297487, 0.0819844463367190, 0.918015553663281, 0.337873288297487,
+        -0.500000000000000, 0.0819844463367190, 0.918015553663281, 0.500000000000000,
+        -0.662126711702513, 0.0819844463367190, 0.918015553663281, 0.662126711702513,
+        -0.806685716350330, 0.0819844463367190, 0.918015553663281, 0.806685716350330,
+        -0.918015553663281, 0.0819844463367190, 0.918015553663281, 0.918015553663281,
+        -0.984080119753344, 0.0819844463367190, 0.918015553663281, 0.984080119753344,
+        -0.0819844463367190, 0.0819844463367190, 0.984080119753344, 0.0159198802466562,
+        -0.148049012426782, 0.0819844463367190, 0.984080119753344, 0.0819844463367190,
+        -0.259378849739733, 0.0819844463367190, 0.984080119753344, 0.193314283649670,
+        -0.403937854387550, 0.0819844463367190, 0.984080119753344, 0.337873288297487,
+        -0.566064566090063, 0.0819844463367190, 0.984080119753344, 0.500000000000000,
+        -0.728191277792575, 0.0819844463367190, 0.984080119753344, 0.662126711702513,
+        -0.872750282440393, 0.0819844463367190, 0.984080119753344, 0.806685716350330,
+        -0.984080119753344, 0.0819844463367190, 0.984080119753344, 0.918015553663281,
+        -1.05014468584341, 0.0819844463367190, 0.984080119753344, 0.984080119753344,
+        0.774845955857018, 0.193314283649670, 0.0159198802466562, 0.0159198802466562,
+        0.708781389766955, 0.193314283649670, 0.0159198802466562, 0.0819844463367190,
+        0.597451552454004, 0.193314283649670, 0.0159198802466562, 0.193314283649670,
+        0.452892547806186, 0.193314283649670, 0.0159198802466562, 0.337873288297487,
+        0.290765836103674, 0.193314283649670, 0.0159198802466562, 0.500000000000000,
+        0.128639124401161, 0.193314283649670, 0.0159198802466562, 0.662126711702513,
+        -0.0159198802466562, 0.193314283649670, 0.0159198802466562, 0.806685716350330,
+        -0.127249717559607, 0.193314283649670, 0.0159198802466562, 0.918015553663281,
+        -0.193314283649670, 0.193314283649670, 0.0159198802466562, 0.984080119753344,
+        0.708781389766955, 0.193314283649670, 0.0819844463367190, 0.0159198802466562,
+        0.642716823676892, 0.193314283649670, 0.0819844463367190, 0.0819844463367190,
+        0.531386986363941, 0.193314283649670, 0.0819844463367190, 0.193314283649670,
+        0.386827981716124, 0.193314283649670, 0.0819844463367190, 0.337873288297487,
+        0.224701270013611, 0.193314283649670, 0.0819844463367190, 0.500000000000000,
+        0.0625745583110984, 0.193314283649670, 0.0819844463367190, 0.662126711702513,
+        -0.0819844463367190, 0.193314283649670, 0.0819844463367190, 0.806685716350330,
+        -0.193314283649670, 0.193314283649670, 0.0819844463367190, 0.918015553663281,
+        -0.259378849739733, 0.193314283649670, 0.0819844463367190, 0.984080119753344,
+        0.597451552454004, 0.193314283649670, 0.193314283649670, 0.0159198802466562,
+        0.531386986363941, 0.193314283649670, 0.193314283649670, 0.0819844463367190,
+        0.420057149050990, 0.193314283649670, 0.193314283649670, 0.193314283649670,
+        0.275498144403173, 0.193314283649670, 0.193314283649670, 0.337873288297487,
+        0.113371432700660, 0.193314283649670, 0.193314283649670, 0.500000000000000,
+        -0.0487552790018526, 0.193314283649670, 0.193314283649670, 0.662126711702513,
+        -0.193314283649670, 0.193314283649670, 0.193314283649670, 0.806685716350330,
+        -0.304644120962621, 0.193314283649670, 0.193314283649670, 0.918015553663281,
+        -0.370708687052684, 0.193314283649670, 0.193314283649670, 0.984080119753344,
+        0.452892547806186, 0.193314283649670, 0.337873288297487, 0.0159198802466562,
+        0.386827981716124, 0.193314283649670, 0.337873288297487, 0.0819844463367190,
+        0.275498144403173, 0.193314283649670, 0.337873288297487, 0.193314283649670,
+        0.130939139755355, 0.193314283649670, 0.337873288297487, 0.337873288297487,
+        -0.0311875719471573, 0.193314283649670, 0.337873288297487, 0.500000000000000,
+        -0.193314283649670, 0.193314283649670, 0.337873288297487, 0.662126711702513,
+        -0.337873288297487, 0.193314283649670, 0.337873288297487, 0.806685716350330,
+        -0.449203125610438, 0.193314283649670, 0.337873288297487, 0.918015553663281,
+        -0.515267691700501, 0.193314283649670, 0.337873288297487, 0.984080119753344,
+        0.290765836103674, 0.193314283649670, 0.500000000000000, 0.0159198802466562,
+        0.224701270013611, 0.193314283649670, 0.500000000000000, 0.0819844463367190,
+        0.113371432700660, 0.193314283649670, 0.500000000000000, 0.193314283649670,
+        -0.0311875719471573, 0.193314283649670, 0.500000000000000, 0.337873288297487,
+        -0.193314283649670, 0.193314283649670, 0.500000000000000, 0.500000000000000,
+        -0.355440995352183, 0.193314283649670, 0.500000000000000, 0.662126711702513,
+        -0.500000000000000, 0.193314283649670, 0.500000000000000, 0.806685716350330,
+        -0.611329837312951, 0.193314283649670, 0.500000000000000, 0.918015553663281,
+        -0.677394403403014, 0.193314283649670, 0.500000000000000, 0.984080119753344,
+        0.128639124401161, 0.193314283649670, 0.662126711702513, 0.0159198802466562,
+        0.0625745583110984, 0.193314283649670, 0.662126711702513, 0.0819844463367190,
+        -0.0487552790018526, 0.193314283649670, 0.662126711702513, 0.193314283649670,
+        -0.193314283649670, 0.193314283649670, 0.662126711702513, 0.337873288297487,
+        -0.355440995352183, 0.193314283649670, 0.662126711702513, 0.500000000000000,
+        -0.517567707054695, 0.193314283649670, 0.662126711702513, 0.662126711702513,
+        -0.662126711702513, 0.193314283649670, 0.662126711702513, 0.806685716350330,
+        -0.773456549015464, 0.193314283649670, 0.662126711702513, 0.918015553663281,
+        -0.839521115105526, 0.193314283649670, 0.662126711702513, 0.984080119753344,
+        -0.0159198802466562, 0.193314283649670, 0.806685716350330, 0.0159198802466562,
+        -0.0819844463367190, 0.193314283649670, 0.806685716350330, 0.0819844463367190,
+        -0.193314283649670, 0.193314283649670, 0.806685716350330, 0.193314283649670,
+        -0.337873288297487, 0.193314283649670, 0.806685716350330, 0.337873288297487,
+        -0.500000000000000, 0.193314283649670, 0.806685716350330, 0.500000000000000,
+        -0.662126711702513, 0.193314283649670, 0.806685716350330, 0.662126711702513,
+        -0.806685716350330, 0.193314283649670, 0.806685716350330, 0.806685716350330,
+        -0.918015553663281, 0.193314283649670, 0.806685716350330, 0.918015553663281,
+        -0.984080119753344, 0.193314283649670, 0.806685716350330, 0.984080119753344,
+        -0.127249717559607, 0.193314283649670, 0.918015553663281, 0.0159198802466562,
+        -0.193314283649670, 0.193314283649670, 0.918015553663281, 0.0819844463367190,
+        -0.304644120962621, 0.193314283649670, 0.918015553663281, 0.193314283649670,
+        -0.449203125610438, 0.193314283649670, 0.918015553663281, 0.337873288297487,
+        -0.611329837312951, 0.193314283649670, 0.918015553663281, 0.500000000000000,
+        -0.773456549015464, 0.193314283649670, 0.918015553663281, 0.662126711702513,
+        -0.918015553663281, 0.193314283649670, 0.918015553663281, 0.806685716350330,
+        -1.02934539097623, 0.193314283649670, 0.918015553663281, 0.918015553663281,
+        -1.09540995706629, 0.193314283649670, 0.918015553663281, 0.984080119753344,
+        -0.193314283649670, 0.193314283649670, 0.984080119753344, 0.0159198802466562,
+        -0.259378849739733, 0.193314283649670, 0.984080119753344, 0.0819844463367190,
+        -0.370708687052684, 0.193314283649670, 0.984080119753344, 0.193314283649670,
+        -0.515267691700501, 0.193314283649670, 0.984080119753344, 0.337873288297487,
+        -0.677394403403014, 0.193314283649670, 0.984080119753344, 0.500000000000000,
+        -0.839521115105526, 0.193314283649670, 0.984080119753344, 0.662126711702513,
+        -0.984080119753344, 0.193314283649670, 0.984080119753344, 0.806685716350330,
+        -1.09540995706629, 0.193314283649670, 0.984080119753344, 0.918015553663281,
+        -1.16147452315636, 0.193314283649670, 0.984080119753344, 0.984080119753344,
+        0.630286951209200, 0.337873288297487, 0.0159198802466562, 0.0159198802466562,
+        0.564222385119137, 0.337873288297487, 0.0159198802466562, 0.0819844463367190,
+        0.452892547806186, 0.337873288297487, 0.0159198802466562, 0.193314283649670,
+        0.308333543158369, 0.337873288297487, 0.0159198802466562, 0.337873288297487,
+        0.146206831455856, 0.337873288297487, 0.0159198802466562, 0.500000000000000,
+        -0.0159198802466562, 0.337873288297487, 0.0159198802466562, 0.662126711702513,
+        -0.160478884894474, 0.337873288297487, 0.0159198802466562, 0.806685716350330,
+        -0.271808722207425, 0.337873288297487, 0.0159198802466562, 0.918015553663281,
+        -0.337873288297487, 0.337873288297487, 0.0159198802466562, 0.984080119753344,
+        0.564222385119137, 0.337873288297487, 0.0819844463367190, 0.0159198802466562,
+        0.498157819029075, 0.337873288297487, 0.0819844463367190, 0.0819844463367190,
+        0.386827981716124, 0.337873288297487, 0.0819844463367190, 0.193314283649670,
+        0.242268977068306, 0.337873288297487, 0.0819844463367190, 0.337873288297487,
+        0.0801422653657937, 0.337873288297487, 0.0819844463367190, 0.500000000000000,
+        -0.0819844463367190, 0.337873288297487, 0.0819844463367190, 0.662126711702513,
+        -0.226543450984536, 0.337873288297487, 0.0819844463367190, 0.806685716350330,
+        -0.337873288297487, 0.337873288297487, 0.0819844463367190, 0.918015553663281,
+        -0.403937854387550, 0.337873288297487, 0.0819844463367190, 0.984080119753344,
+        0.452892547806186, 0.337873288297487, 0.193314283649670, 0.0159198802466562,
+        0.386827981716124, 0.337873288297487, 0.193314283649670, 0.0819844463367190,
+        0.275498144403173, 0.337873288297487, 0.193314283649670, 0.193314283649670,
+        0.130939139755355, 0.337873288297487, 0.193314283649670, 0.337873288297487,
+        -0.0311875719471573, 0.337873288297487, 0.193314283649670, 0.500000000000000,
+        -0.193314283649670, 0.337873288297487, 0.193314283649670, 0.662126711702513,
+        -0.337873288297487, 0.337873288297487, 0.193314283649670, 0.806685716350330,
+        -0.449203125610438, 0.337873288297487, 0.193314283649670, 0.918015553663281,
+        -0.515267691700501, 0.337873288297487, 0.193314283649670, 0.984080119753344,
+        0.308333543158369, 0.337873288297487, 0.337873288297487, 0.0159198802466562,
+        0.242268977068306, 0.337873288297487, 0.337873288297487, 0.0819844463367190,
+        0.130939139755355, 0.337873288297487, 0.337873288297487, 0.193314283649670,
+        -0.0136198648924619, 0.337873288297487, 0.337873288297487, 0.337873288297487,
+        -0.175746576594975, 0.337873288297487, 0.337873288297487, 0.500000000000000,
+        -0.337873288297487, 0.337873288297487, 0.337873288297487, 0.662126711702513,
+        -0.482432292945305, 0.337873288297487, 0.337873288297487, 0.806685716350330,
+        -0.593762130258256, 0.337873288297487, 0.337873288297487, 0.918015553663281,
+        -0.659826696348318, 0.337873288297487, 0.337873288297487, 0.984080119753344,
+        0.146206831455856, 0.337873288297487, 0.500000000000000, 0.0159198802466562,
+        0.0801422653657937, 0.337873288297487, 0.500000000000000, 0.0819844463367190,
+        -0.0311875719471573, 0.337873288297487, 0.500000000000000, 0.193314283649670,
+        -0.175746576594975, 0.337873288297487, 0.500000000000000, 0.337873288297487,
+        -0.337873288297487, 0.337873288297487, 0.500000000000000, 0.500000000000000,
+        -0.500000000000000, 0.337873288297487, 0.500000000000000, 0.662126711702513,
+        -0.644559004647817, 0.337873288297487, 0.500000000000000, 0.806685716350330,
+        -0.755888841960768, 0.337873288297487, 0.500000000000000, 0.918015553663281,
+        -0.821953408050831, 0.337873288297487, 0.500000000000000, 0.984080119753344,
+        -0.0159198802466562, 0.337873288297487, 0.662126711702513, 0.0159198802466562,
+        -0.0819844463367190, 0.337873288297487, 0.662126711702513, 0.0819844463367190,
+        -0.193314283649670, 0.337873288297487, 0.662126711702513, 0.193314283649670,
+        -0.337873288297487, 0.337873288297487, 0.662126711702513, 0.337873288297487,
+        -0.500000000000000, 0.337873288297487, 0.662126711702513, 0.500000000000000,
+        -0.662126711702513, 0.337873288297487, 0.662126711702513, 0.662126711702513,
+        -0.806685716350330, 0.337873288297487, 0.662126711702513, 0.806685716350330,
+        -0.918015553663281, 0.337873288297487, 0.662126711702513, 0.918015553663281,
+        -0.984080119753344, 0.337873288297487, 0.662126711702513, 0.984080119753344,
+        -0.160478884894474, 0.337873288297487, 0.806685716350330, 0.0159198802466562,
+        -0.226543450984536, 0.337873288297487, 0.806685716350330, 0.0819844463367190,
+        -0.337873288297487, 0.337873288297487, 0.806685716350330, 0.193314283649670,
+        -0.482432292945305, 0.337873288297487, 0.806685716350330, 0.337873288297487,
+        -0.644559004647817, 0.337873288297487, 0.806685716350330, 0.500000000000000,
+        -0.806685716350330, 0.337873288297487, 0.806685716350330, 0.662126711702513,
+        -0.951244720998147, 0.337873288297487, 0.806685716350330, 0.806685716350330,
+        -1.06257455831110, 0.337873288297487, 0.806685716350330, 0.918015553663281,
+        -1.12863912440116, 0.337873288297487, 0.806685716350330, 0.984080119753344,
+        -0.271808722207425, 0.337873288297487, 0.918015553663281, 0.0159198802466562,
+        -0.337873288297487, 0.337873288297487, 0.918015553663281, 0.0819844463367190,
+        -0.449203125610438, 0.337873288297487, 0.918015553663281, 0.193314283649670,
+        -0.593762130258256, 0.337873288297487, 0.918015553663281, 0.337873288297487,
+        -0.755888841960768, 0.337873288297487, 0.918015553663281, 0.500000000000000,
+        -0.918015553663281, 0.337873288297487, 0.918015553663281, 0.662126711702513,
+        -1.06257455831110, 0.337873288297487, 0.918015553663281, 0.806685716350330,
+        -1.17390439562405, 0.337873288297487, 0.918015553663281, 0.918015553663281,
+        -1.23996896171411, 0.337873288297487, 0.918015553663281, 0.984080119753344,
+        -0.337873288297487, 0.337873288297487, 0.984080119753344, 0.0159198802466562,
+        -0.403937854387550, 0.337873288297487, 0.984080119753344, 0.0819844463367190,
+        -0.515267691700501, 0.337873288297487, 0.984080119753344, 0.193314283649670,
+        -0.659826696348318, 0.337873288297487, 0.984080119753344, 0.337873288297487,
+        -0.821953408050831, 0.337873288297487, 0.984080119753344, 0.500000000000000,
+        -0.984080119753344, 0.337873288297487, 0.984080119753344, 0.662126711702513,
+        -1.12863912440116, 0.337873288297487, 0.984080119753344, 0.806685716350330,
+        -1.23996896171411, 0.337873288297487, 0.984080119753344, 0.918015553663281,
+        -1.30603352780417, 0.337873288297487, 0.984080119753344, 0.984080119753344,
+        0.468160239506688, 0.500000000000000, 0.0159198802466562, 0.0159198802466562,
+        0.402095673416625, 0.500000000000000, 0.0159198802466562, 0.0819844463367190,
+        0.290765836103674, 0.500000000000000, 0.0159198802466562, 0.193314283649670,
+        0.146206831455856, 0.500000000000000, 0.0159198802466562, 0.337873288297487,
+        -0.0159198802466562, 0.500000000000000, 0.0159198802466562, 0.500000000000000,
+        -0.178046591949169, 0.500000000000000, 0.0159198802466562, 0.662126711702513,
+        -0.322605596596986, 0.500000000000000, 0.0159198802466562, 0.806685716350330,
+        -0.433935433909937, 0.500000000000000, 0.0159198802466562, 0.918015553663281,
+        -0.500000000000000, 0.500000000000000, 0.0159198802466562, 0.984080119753344,
+        0.402095673416625, 0.500000000000000, 0.0819844463367190, 0.0159198802466562,
+        0.336031107326562, 0.500000000000000, 0.0819844463367190, 0.0819844463367190,
+        0.224701270013611, 0.500000000000000, 0.0819844463367190, 0.193314283649670,
+        0.0801422653657937, 0.500000000000000, 0.0819844463367190, 0.337873288297487,
+        -0.0819844463367190, 0.500000000000000, 0.0819844463367190, 0.500000000000000,
+        -0.244111158039232, 0.500000000000000, 0.0819844463367190, 0.662126711702513,
+        -0.388670162687049, 0.500000000000000, 0.0819844463367190, 0.806685716350330,
+        -0.500000000000000, 0.500000000000000, 0.0819844463367190, 0.918015553663281,
+        -0.566064566090063, 0.500000000000000, 0.0819844463367190, 0.984080119753344,
+        0.290765836103674, 0.500000000000000, 0.193314283649670, 0.0159198802466562,
+        0.224701270013611, 0.500000000000000, 0.193314283649670, 0.0819844463367190,
+        0.113371432700660, 0.500000000000000, 0.193314283649670, 0.193314283649670,
+        -0.0311875719471573, 0.500000000000000, 0.193314283649670, 0.337873288297487,
+        -0.193314283649670, 0.500000000000000, 0.193314283649670, 0.500000000000000,
+        -0.355440995352183, 0.500000000000000, 0.193314283649670, 0.662126711702513,
+        -0.500000000000000, 0.500000000000000, 0.193314283649670, 0.806685716350330,
+        -0.611329837312951, 0.500000000000000, 0.193314283649670, 0.918015553663281,
+        -0.677394403403014, 0.500000000000000, 0.193314283649670, 0.984080119753344,
+        0.146206831455856, 0.500000000000000, 0.337873288297487, 0.0159198802466562,
+        0.0801422653657937, 0.500000000000000, 0.337873288297487, 0.0819844463367190,
+        -0.0311875719471573, 0.500000000000000, 0.337873288297487, 0.193314283649670,
+        -0.175746576594975, 0.500000000000000, 0.337873288297487, 0.337873288297487,
+        -0.337873288297487, 0.500000000000000, 0.337873288297487, 0.500000000000000,
+        -0.500000000000000, 0.500000000000000, 0.337873288297487, 0.662126711702513,
+        -0.644559004647817, 0.500000000000000, 0.337873288297487, 0.806685716350330,
+        -0.755888841960768, 0.500000000000000, 0.337873288297487, 0.918015553663281,
+        -0.821953408050831, 0.500000000000000, 0.337873288297487, 0.984080119753344,
+        -0.0159198802466562, 0.500000000000000, 0.500000000000000, 0.0159198802466562,
+        -0.0819844463367190, 0.500000000000000, 0.500000000000000, 0.0819844463367190,
+        -0.193314283649670, 0.500000000000000, 0.500000000000000, 0.193314283649670,
+        -0.337873288297487, 0.500000000000000, 0.500000000000000, 0.337873288297487,
+        -0.500000000000000, 0.500000000000000, 0.500000000000000, 0.500000000000000,
+        -0.662126711702513, 0.500000000000000, 0.500000000000000, 0.662126711702513,
+        -0.806685716350330, 0.500000000000000, 0.500000000000000, 0.806685716350330,
+        -0.918015553663281, 0.500000000000000, 0.500000000000000, 0.918015553663281,
+        -0.984080119753344, 0.500000000000000, 0.500000000000000, 0.984080119753344,
+        -0.178046591949169, 0.500000000000000, 0.662126711702513, 0.0159198802466562,
+        -0.244111158039232, 0.500000000000000, 0.662126711702513, 0.0819844463367190,
+        -0.355440995352183, 0.500000000000000, 0.662126711702513, 0.193314283649670,
+        -0.500000000000000, 0.500000000000000, 0.662126711702513, 0.337873288297487,
+        -0.662126711702513, 0.500000000000000, 0.662126711702513, 0.500000000000000,
+        -0.824253423405025, 0.500000000000000, 0.662126711702513, 0.662126711702513,
+        -0.968812428052843, 0.500000000000000, 0.662126711702513, 0.806685716350330,
+        -1.08014226536579, 0.500000000000000, 0.662126711702513, 0.918015553663281,
+        -1.14620683145586, 0.500000000000000, 0.662126711702513, 0.984080119753344,
+        -0.322605596596986, 0.500000000000000, 0.806685716350330, 0.0159198802466562,
+        -0.388670162687049, 0.500000000000000, 0.806685716350330, 0.0819844463367190,
+        -0.500000000000000, 0.500000000000000, 0.806685716350330, 0.193314283649670,
+        -0.644559004647817, 0.500000000000000, 0.806685716350330, 0.337873288297487,
+        -0.806685716350330, 0.500000000000000, 0.806685716350330, 0.500000000000000,
+        -0.968812428052843, 0.500000000000000, 0.806685716350330, 0.662126711702513,
+        -1.11337143270066, 0.500000000000000, 0.806685716350330, 0.806685716350330,
+        -1.22470127001361, 0.500000000000000, 0.806685716350330, 0.918015553663281,
+        -1.29076583610367, 0.500000000000000, 0.806685716350330, 0.984080119753344,
+        -0.433935433909937, 0.500000000000000, 0.918015553663281, 0.0159198802466562,
+        -0.500000000000000, 0.500000000000000, 0.918015553663281, 0.0819844463367190,
+        -0.611329837312951, 0.500000000000000, 0.918015553663281, 0.193314283649670,
+        -0.755888841960768, 0.500000000000000, 0.918015553663281, 0.337873288297487,
+        -0.918015553663281, 0.500000000000000, 0.918015553663281, 0.500000000000000,
+        -1.08014226536579, 0.500000000000000, 0.918015553663281, 0.662126711702513,
+        -1.22470127001361, 0.500000000000000, 0.918015553663281, 0.806685716350330,
+        -1.33603110732656, 0.500000000000000, 0.918015553663281, 0.918015553663281,
+        -1.40209567341662, 0.500000000000000, 0.918015553663281, 0.984080119753344,
+        -0.500000000000000, 0.500000000000000, 0.984080119753344, 0.0159198802466562,
+        -0.566064566090063, 0.500000000000000, 0.984080119753344, 0.0819844463367190,
+        -0.677394403403014, 0.500000000000000, 0.984080119753344, 0.193314283649670,
+        -0.821953408050831, 0.500000000000000, 0.984080119753344, 0.337873288297487,
+        -0.984080119753344, 0.500000000000000, 0.984080119753344, 0.500000000000000,
+        -1.14620683145586, 0.500000000000000, 0.984080119753344, 0.662126711702513,
+        -1.29076583610367, 0.500000000000000, 0.984080119753344, 0.806685716350330,
+        -1.40209567341662, 0.500000000000000, 0.984080119753344, 0.918015553663281,
+        -1.46816023950669, 0.500000000000000, 0.984080119753344, 0.984080119753344,
+        0.306033527804175, 0.662126711702513, 0.0159198802466562, 0.0159198802466562,
+        0.239968961714112, 0.662126711702513, 0.0159198802466562, 0.0819844463367190,
+        0.128639124401161, 0.662126711702513, 0.0159198802466562, 0.193314283649670,
+        -0.0159198802466562, 0.662126711702513, 0.0159198802466562, 0.337873288297487,
+        -0.178046591949169, 0.662126711702513, 0.0159198802466562, 0.500000000000000,
+        -0.340173303651682, 0.662126711702513, 0.0159198802466562, 0.662126711702513,
+        -0.484732308299499, 0.662126711702513, 0.0159198802466562, 0.806685716350330,
+        -0.596062145612450, 0.662126711702513, 0.0159198802466562, 0.918015553663281,
+        -0.662126711702513, 0.662126711702513, 0.0159198802466562, 0.984080119753344,
+        0.239968961714112, 0.662126711702513, 0.0819844463367190, 0.0159198802466562,
+        0.173904395624049, 0.662126711702513, 0.0819844463367190, 0.0819844463367190,
+        0.0625745583110984, 0.662126711702513, 0.0819844463367190, 0.193314283649670,
+        -0.0819844463367190, 0.662126711702513, 0.0819844463367190, 0.337873288297487,
+        -0.244111158039232, 0.662126711702513, 0.0819844463367190, 0.500000000000000,
+        -0.406237869741744, 0.662126711702513, 0.0819844463367190, 0.662126711702513,
+        -0.550796874389562, 0.662126711702513, 0.0819844463367190, 0.806685716350330,
+        -0.662126711702513, 0.662126711702513, 0.0819844463367190, 0.918015553663281,
+        -0.728191277792575, 0.662126711702513, 0.0819844463367190, 0.984080119753344,
+        0.128639124401161, 0.662126711702513, 0.193314283649670, 0.0159198802466562,
+        0.0625745583110984, 0.662126711702513, 0.193314283649670, 0.0819844463367190,
+        -0.0487552790018526, 0.662126711702513, 0.193314283649670, 0.193314283649670,
+        -0.193314283649670, 0.662126711702513, 0.193314283649670, 0.337873288297487,
+        -0.355440995352183, 0.662126711702513, 0.193314283649670, 0.500000000000000,
+        -0.517567707054695, 0.662126711702513, 0.193314283649670, 0.662126711702513,
+        -0.662126711702513, 0.662126711702513, 0.193314283649670, 0.806685716350330,
+        -0.773456549015464, 0.662126711702513, 0.193314283649670, 0.918015553663281,
+        -0.839521115105526, 0.662126711702513, 0.193314283649670, 0.984080119753344,
+        -0.0159198802466562, 0.662126711702513, 0.337873288297487, 0.0159198802466562,
+        -0.0819844463367190, 0.662126711702513, 0.337873288297487, 0.0819844463367190,
+        -0.193314283649670, 0.662126711702513, 0.337873288297487, 0.193314283649670,
+        -0.337873288297487, 0.662126711702513, 0.337873288297487, 0.337873288297487,
+        -0.500000000000000, 0.662126711702513, 0.337873288297487, 0.500000000000000,
+        -0.662126711702513, 0.662126711702513, 0.337873288297487, 0.662126711702513,
+        -0.806685716350330, 0.662126711702513, 0.337873288297487, 0.806685716350330,
+        -0.918015553663281, 0.662126711702513, 0.337873288297487, 0.918015553663281,
+        -0.984080119753344, 0.662126711702513, 0.337873288297487, 0.984080119753344,
+        -0.178046591949169, 0.662126711702513, 0.500000000000000, 0.0159198802466562,
+        -0.244111158039232, 0.662126711702513, 0.500000000000000, 0.0819844463367190,
+        -0.355440995352183, 0.662126711702513, 0.500000000000000, 0.193314283649670,
+        -0.500000000000000, 0.662126711702513, 0.500000000000000, 0.337873288297487,
+        -0.662126711702513, 0.662126711702513, 0.500000000000000, 0.500000000000000,
+        -0.824253423405025, 0.662126711702513, 0.500000000000000, 0.662126711702513,
+        -0.968812428052843, 0.662126711702513, 0.500000000000000, 0.806685716350330,
+        -1.08014226536579, 0.662126711702513, 0.500000000000000, 0.918015553663281,
+        -1.14620683145586, 0.662126711702513, 0.500000000000000, 0.984080119753344,
+        -0.340173303651682, 0.662126711702513, 0.662126711702513, 0.0159198802466562,
+        -0.406237869741744, 0.662126711702513, 0.662126711702513, 0.0819844463367190,
+        -0.517567707054695, 0.662126711702513, 0.662126711702513, 0.193314283649670,
+        -0.662126711702513, 0.662126711702513, 0.662126711702513, 0.337873288297487,
+        -0.824253423405025, 0.662126711702513, 0.662126711702513, 0.500000000000000,
+        -0.986380135107538, 0.662126711702513, 0.662126711702513, 0.662126711702513,
+        -1.13093913975536, 0.662126711702513, 0.662126711702513, 0.806685716350330,
+        -1.24226897706831, 0.662126711702513, 0.662126711702513, 0.918015553663281,
+        -1.30833354315837, 0.662126711702513, 0.662126711702513, 0.984080119753344,
+        -0.484732308299499, 0.662126711702513, 0.806685716350330, 0.0159198802466562,
+        -0.550796874389562, 0.662126711702513, 0.806685716350330, 0.0819844463367190,
+        -0.662126711702513, 0.662126711702513, 0.806685716350330, 0.193314283649670,
+        -0.806685716350330, 0.662126711702513, 0.806685716350330, 0.337873288297487,
+        -0.968812428052843, 0.662126711702513, 0.806685716350330, 0.500000000000000,
+        -1.13093913975536, 0.662126711702513, 0.806685716350330, 0.662126711702513,
+        -1.27549814440317, 0.662126711702513, 0.806685716350330, 0.806685716350330,
+        -1.38682798171612, 0.662126711702513, 0.806685716350330, 0.918015553663281,
+        -1.45289254780619, 0.662126711702513, 0.806685716350330, 0.984080119753344,
+        -0.596062145612450, 0.662126711702513, 0.918015553663281, 0.0159198802466562,
+        -0.662126711702513, 0.662126711702513, 0.918015553663281, 0.0819844463367190,
+        -0.773456549015464, 0.662126711702513, 0.918015553663281, 0.193314283649670,
+        -0.918015553663281, 0.662126711702513, 0.918015553663281, 0.337873288297487,
+        -1.08014226536579, 0.662126711702513, 0.918015553663281, 0.500000000000000,
+        -1.24226897706831, 0.662126711702513, 0.918015553663281, 0.662126711702513,
+        -1.38682798171612, 0.662126711702513, 0.918015553663281, 0.806685716350330,
+        -1.49815781902907, 0.662126711702513, 0.918015553663281, 0.918015553663281,
+        -1.56422238511914, 0.662126711702513, 0.918015553663281, 0.984080119753344,
+        -0.662126711702513, 0.662126711702513, 0.984080119753344, 0.0159198802466562,
+        -0.728191277792575, 0.662126711702513, 0.984080119753344, 0.0819844463367190,
+        -0.839521115105526, 0.662126711702513, 0.984080119753344, 0.193314283649670,
+        -0.984080119753344, 0.662126711702513, 0.984080119753344, 0.337873288297487,
+        -1.14620683145586, 0.662126711702513, 0.984080119753344, 0.500000000000000,
+        -1.30833354315837, 0.662126711702513, 0.984080119753344, 0.662126711702513,
+        -1.45289254780619, 0.662126711702513, 0.984080119753344, 0.806685716350330,
+        -1.56422238511914, 0.662126711702513, 0.984080119753344, 0.918015553663281,
+        -1.63028695120920, 0.662126711702513, 0.984080119753344, 0.984080119753344,
+        0.161474523156357, 0.806685716350330, 0.0159198802466562, 0.0159198802466562,
+        0.0954099570662947, 0.806685716350330, 0.0159198802466562, 0.0819844463367190,
+        -0.0159198802466562, 0.806685716350330, 0.0159198802466562, 0.193314283649670,
+        -0.160478884894474, 0.806685716350330, 0.0159198802466562, 0.337873288297487,
+        -0.322605596596986, 0.806685716350330, 0.0159198802466562, 0.500000000000000,
+        -0.484732308299499, 0.806685716350330, 0.0159198802466562, 0.662126711702513,
+        -0.629291312947316, 0.806685716350330, 0.0159198802466562, 0.806685716350330,
+        -0.740621150260267, 0.806685716350330, 0.0159198802466562, 0.918015553663281,
+        -0.806685716350330, 0.806685716350330, 0.0159198802466562, 0.984080119753344,
+        0.0954099570662947, 0.806685716350330, 0.0819844463367190, 0.0159198802466562,
+        0.0293453909762320, 0.806685716350330, 0.0819844463367190, 0.0819844463367190,
+        -0.0819844463367190, 0.806685716350330, 0.0819844463367190, 0.193314283649670,
+        -0.226543450984536, 0.806685716350330, 0.0819844463367190, 0.337873288297487,
+        -0.388670162687049, 0.806685716350330, 0.0819844463367190, 0.500000000000000,
+        -0.550796874389562, 0.806685716350330, 0.0819844463367190, 0.662126711702513,
+        -0.695355879037379, 0.806685716350330, 0.0819844463367190, 0.806685716350330,
+        -0.806685716350330, 0.806685716350330, 0.0819844463367190, 0.918015553663281,
+        -0.872750282440393, 0.806685716350330, 0.0819844463367190, 0.984080119753344,
+        -0.0159198802466562, 0.806685716350330, 0.193314283649670, 0.0159198802466562,
+        -0.0819844463367190, 0.806685716350330, 0.193314283649670, 0.0819844463367190,
+        -0.193314283649670, 0.806685716350330, 0.193314283649670, 0.193314283649670,
+        -0.337873288297487, 0.806685716350330, 0.193314283649670, 0.337873288297487,
+        -0.500000000000000, 0.806685716350330, 0.193314283649670, 0.500000000000000,
+        -0.662126711702513, 0.806685716350330, 0.193314283649670, 0.662126711702513,
+        -0.806685716350330, 0.806685716350330, 0.193314283649670, 0.806685716350330,
+        -0.918015553663281, 0.806685716350330, 0.193314283649670, 0.918015553663281,
+        -0.984080119753344, 0.806685716350330, 0.193314283649670, 0.984080119753344,
+        -0.160478884894474, 0.806685716350330, 0.337873288297487, 0.0159198802466562,
+        -0.226543450984536, 0.806685716350330, 0.337873288297487, 0.0819844463367190,
+        -0.337873288297487, 0.806685716350330, 0.337873288297487, 0.193314283649670,
+        -0.482432292945305, 0.806685716350330, 0.337873288297487, 0.337873288297487,
+        -0.644559004647817, 0.806685716350330, 0.337873288297487, 0.500000000000000,
+        -0.806685716350330, 0.806685716350330, 0.337873288297487, 0.662126711702513,
+        -0.951244720998147, 0.806685716350330, 0.337873288297487, 0.806685716350330,
+        -1.06257455831110, 0.806685716350330, 0.337873288297487, 0.918015553663281,
+        -1.12863912440116, 0.806685716350330, 0.337873288297487, 0.984080119753344,
+        -0.322605596596986, 0.806685716350330, 0.500000000000000, 0.0159198802466562,
+        -0.388670162687049, 0.806685716350330, 0.500000000000000, 0.0819844463367190,
+        -0.500000000000000, 0.806685716350330, 0.500000000000000, 0.193314283649670,
+        -0.644559004647817, 0.806685716350330, 0.500000000000000, 0.337873288297487,
+        -0.806685716350330, 0.806685716350330, 0.500000000000000, 0.500000000000000,
+        -0.968812428052843, 0.806685716350330, 0.500000000000000, 0.662126711702513,
+        -1.11337143270066, 0.806685716350330, 0.500000000000000, 0.806685716350330,
+        -1.22470127001361, 0.806685716350330, 0.500000000000000, 0.918015553663281,
+        -1.29076583610367, 0.806685716350330, 0.500000000000000, 0.984080119753344,
+        -0.484732308299499, 0.806685716350330, 0.662126711702513, 0.0159198802466562,
+        -0.550796874389562, 0.806685716350330, 0.662126711702513, 0.0819844463367190,
+        -0.662126711702513, 0.806685716350330, 0.662126711702513, 0.193314283649670,
+        -0.806685716350330, 0.806685716350330, 0.662126711702513, 0.337873288297487,
+        -0.968812428052843, 0.806685716350330, 0.662126711702513, 0.500000000000000,
+        -1.13093913975536, 0.806685716350330, 0.662126711702513, 0.662126711702513,
+        -1.27549814440317, 0.806685716350330, 0.662126711702513, 0.806685716350330,
+        -1.38682798171612, 0.806685716350330, 0.662126711702513, 0.918015553663281,
+        -1.45289254780619, 0.806685716350330, 0.662126711702513, 0.984080119753344,
+        -0.629291312947316, 0.806685716350330, 0.806685716350330, 0.0159198802466562,
+        -0.695355879037379, 0.806685716350330, 0.806685716350330, 0.0819844463367190,
+        -0.806685716350330, 0.806685716350330, 0.806685716350330, 0.193314283649670,
+        -0.951244720998147, 0.806685716350330, 0.806685716350330, 0.337873288297487,
+        -1.11337143270066, 0.806685716350330, 0.806685716350330, 0.500000000000000,
+        -1.27549814440317, 0.806685716350330, 0.806685716350330, 0.662126711702513,
+        -1.42005714905099, 0.806685716350330, 0.806685716350330, 0.806685716350330,
+        -1.53138698636394, 0.806685716350330, 0.806685716350330, 0.918015553663281,
+        -1.59745155245400, 0.806685716350330, 0.806685716350330, 0.984080119753344,
+        -0.740621150260267, 0.806685716350330, 0.918015553663281, 0.0159198802466562,
+        -0.806685716350330, 0.806685716350330, 0.918015553663281, 0.0819844463367190,
+        -0.918015553663281, 0.806685716350330, 0.918015553663281, 0.193314283649670,
+        -1.06257455831110, 0.806685716350330, 0.918015553663281, 0.337873288297487,
+        -1.22470127001361, 0.806685716350330, 0.918015553663281, 0.500000000000000,
+        -1.38682798171612, 0.806685716350330, 0.918015553663281, 0.662126711702513,
+        -1.53138698636394, 0.806685716350330, 0.918015553663281, 0.806685716350330,
+        -1.64271682367689, 0.806685716350330, 0.918015553663281, 0.918015553663281,
+        -1.70878138976695, 0.806685716350330, 0.918015553663281, 0.984080119753344,
+        -0.806685716350330, 0.806685716350330, 0.984080119753344, 0.0159198802466562,
+        -0.872750282440393, 0.806685716350330, 0.984080119753344, 0.0819844463367190,
+        -0.984080119753344, 0.806685716350330, 0.984080119753344, 0.193314283649670,
+        -1.12863912440116, 0.806685716350330, 0.984080119753344, 0.337873288297487,
+        -1.29076583610367, 0.806685716350330, 0.984080119753344, 0.500000000000000,
+        -1.45289254780619, 0.806685716350330, 0.984080119753344, 0.662126711702513,
+        -1.59745155245400, 0.806685716350330, 0.984080119753344, 0.806685716350330,
+        -1.70878138976695, 0.806685716350330, 0.984080119753344, 0.918015553663281,
+        -1.77484595585702, 0.806685716350330, 0.984080119753344, 0.984080119753344,
+        0.0501446858434065, 0.918015553663281, 0.0159198802466562, 0.0159198802466562,
+        -0.0159198802466562, 0.918015553663281, 0.0159198802466562, 0.0819844463367190,
+        -0.127249717559607, 0.918015553663281, 0.0159198802466562, 0.193314283649670,
+        -0.271808722207425, 0.918015553663281, 0.0159198802466562, 0.337873288297487,
+        -0.433935433909937, 0.918015553663281, 0.0159198802466562, 0.500000000000000,
+        -0.596062145612450, 0.918015553663281, 0.0159198802466562, 0.662126711702513,
+        -0.740621150260267, 0.918015553663281, 0.0159198802466562, 0.806685716350330,
+        -0.851950987573218, 0.918015553663281, 0.0159198802466562, 0.918015553663281,
+        -0.918015553663281, 0.918015553663281, 0.0159198802466562, 0.984080119753344,
+        -0.0159198802466562, 0.918015553663281, 0.0819844463367190, 0.0159198802466562,
+        -0.0819844463367190, 0.918015553663281, 0.0819844463367190, 0.0819844463367190,
+        -0.193314283649670, 0.918015553663281, 0.0819844463367190, 0.193314283649670,
+        -0.337873288297487, 0.918015553663281, 0.0819844463367190, 0.337873288297487,
+        -0.500000000000000, 0.918015553663281, 0.0819844463367190, 0.500000000000000,
+        -0.662126711702513, 0.918015553663281, 0.0819844463367190, 0.662126711702513,
+        -0.806685716350330, 0.918015553663281, 0.0819844463367190, 0.806685716350330,
+        -0.918015553663281, 0.918015553663281, 0.0819844463367190, 0.918015553663281,
+        -0.984080119753344, 0.918015553663281, 0.0819844463367190, 0.984080119753344,
+        -0.127249717559607, 0.918015553663281, 0.193314283649670, 0.0159198802466562,
+        -0.193314283649670, 0.918015553663281, 0.193314283649670, 0.0819844463367190,
+        -0.304644120962621, 0.918015553663281, 0.193314283649670, 0.193314283649670,
+        -0.449203125610438, 0.918015553663281, 0.193314283649670, 0.337873288297487,
+        -0.611329837312951, 0.918015553663281, 0.193314283649670, 0.500000000000000,
+        -0.773456549015464, 0.918015553663281, 0.193314283649670, 0.662126711702513,
+        -0.918015553663281, 0.918015553663281, 0.193314283649670, 0.806685716350330,
+        -1.02934539097623, 0.918015553663281, 0.193314283649670, 0.918015553663281,
+        -1.09540995706629, 0.918015553663281, 0.193314283649670, 0.984080119753344,
+        -0.271808722207425, 0.918015553663281, 0.337873288297487, 0.0159198802466562,
+        -0.337873288297487, 0.918015553663281, 0.337873288297487, 0.0819844463367190,
+        -0.449203125610438, 0.918015553663281, 0.337873288297487, 0.193314283649670,
+        -0.593762130258256, 0.918015553663281, 0.337873288297487, 0.337873288297487,
+        -0.755888841960768, 0.918015553663281, 0.337873288297487, 0.500000000000000,
+        -0.918015553663281, 0.918015553663281, 0.337873288297487, 0.662126711702513,
+        -1.06257455831110, 0.918015553663281, 0.337873288297487, 0.806685716350330,
+        -1.17390439562405, 0.918015553663281, 0.337873288297487, 0.918015553663281,
+        -1.23996896171411, 0.918015553663281, 0.337873288297487, 0.984080119753344,
+        -0.433935433909937, 0.918015553663281, 0.500000000000000, 0.0159198802466562,
+        -0.500000000000000, 0.918015553663281, 0.500000000000000, 0.0819844463367190,
+        -0.611329837312951, 0.918015553663281, 0.500000000000000, 0.193314283649670,
+        -0.755888841960768, 0.918015553663281, 0.500000000000000, 0.337873288297487,
+        -0.918015553663281, 0.918015553663281, 0.500000000000000, 0.500000000000000,
+        -1.08014226536579, 0.918015553663281, 0.500000000000000, 0.662126711702513,
+        -1.22470127001361, 0.918015553663281, 0.500000000000000, 0.806685716350330,
+        -1.33603110732656, 0.918015553663281, 0.500000000000000, 0.918015553663281,
+        -1.40209567341662, 0.918015553663281, 0.500000000000000, 0.984080119753344,
+        -0.596062145612450, 0.918015553663281, 0.662126711702513, 0.0159198802466562,
+        -0.662126711702513, 0.918015553663281, 0.662126711702513, 0.0819844463367190,
+        -0.773456549015464, 0.918015553663281, 0.662126711702513, 0.193314283649670,
+        -0.918015553663281, 0.918015553663281, 0.662126711702513, 0.337873288297487,
+        -1.08014226536579, 0.918015553663281, 0.662126711702513, 0.500000000000000,
+        -1.24226897706831, 0.918015553663281, 0.662126711702513, 0.662126711702513,
+        -1.38682798171612, 0.918015553663281, 0.662126711702513, 0.806685716350330,
+        -1.49815781902907, 0.918015553663281, 0.662126711702513, 0.918015553663281,
+        -1.56422238511914, 0.918015553663281, 0.662126711702513, 0.984080119753344,
+        -0.740621150260267, 0.918015553663281, 0.806685716350330, 0.0159198802466562,
+        -0.806685716350330, 0.918015553663281, 0.806685716350330, 0.0819844463367190,
+        -0.918015553663281, 0.918015553663281, 0.806685716350330, 0.193314283649670,
+        -1.06257455831110, 0.918015553663281, 0.806685716350330, 0.337873288297487,
+        -1.22470127001361, 0.918015553663281, 0.806685716350330, 0.500000000000000,
+        -1.38682798171612, 0.918015553663281, 0.806685716350330, 0.662126711702513,
+        -1.53138698636394, 0.918015553663281, 0.806685716350330, 0.806685716350330,
+        -1.64271682367689, 0.918015553663281, 0.806685716350330, 0.918015553663281,
+        -1.70878138976695, 0.918015553663281, 0.806685716350330, 0.984080119753344,
+        -0.851950987573218, 0.918015553663281, 0.918015553663281, 0.0159198802466562,
+        -0.918015553663281, 0.918015553663281, 0.918015553663281, 0.0819844463367190,
+        -1.02934539097623, 0.918015553663281, 0.918015553663281, 0.193314283649670,
+        -1.17390439562405, 0.918015553663281, 0.918015553663281, 0.337873288297487,
+        -1.33603110732656, 0.918015553663281, 0.918015553663281, 0.500000000000000,
+        -1.49815781902907, 0.918015553663281, 0.918015553663281, 0.662126711702513,
+        -1.64271682367689, 0.918015553663281, 0.918015553663281, 0.806685716350330,
+        -1.75404666098984, 0.918015553663281, 0.918015553663281, 0.918015553663281,
+        -1.82011122707991, 0.918015553663281, 0.918015553663281, 0.984080119753344,
+        -0.918015553663281, 0.918015553663281, 0.984080119753344, 0.0159198802466562,
+        -0.984080119753344, 0.918015553663281, 0.984080119753344, 0.0819844463367190,
+        -1.09540995706629, 0.918015553663281, 0.984080119753344, 0.193314283649670,
+        -1.23996896171411, 0.918015553663281, 0.984080119753344, 0.337873288297487,
+        -1.40209567341662, 0.918015553663281, 0.984080119753344, 0.500000000000000,
+        -1.56422238511914, 0.918015553663281, 0.984080119753344, 0.662126711702513,
+        -1.70878138976695, 0.918015553663281, 0.984080119753344, 0.806685716350330,
+        -1.82011122707991, 0.918015553663281, 0.984080119753344, 0.918015553663281,
+        -1.88617579316997, 0.918015553663281, 0.984080119753344, 0.984080119753344,
+        -0.0159198802466562, 0.984080119753344, 0.0159198802466562, 0.0159198802466562,
+        -0.0819844463367190, 0.984080119753344, 0.0159198802466562, 0.0819844463367190,
+        -0.193314283649670, 0.984080119753344, 0.0159198802466562, 0.193314283649670,
+        -0.337873288297487, 0.984080119753344, 0.0159198802466562, 0.337873288297487,
+        -0.500000000000000, 0.984080119753344, 0.0159198802466562, 0.500000000000000,
+        -0.662126711702513, 0.984080119753344, 0.0159198802466562, 0.662126711702513,
+        -0.806685716350330, 0.984080119753344, 0.0159198802466562, 0.806685716350330,
+        -0.918015553663281, 0.984080119753344, 0.0159198802466562, 0.918015553663281,
+        -0.984080119753344, 0.984080119753344, 0.0159198802466562, 0.984080119753344,
+        -0.0819844463367190, 0.984080119753344, 0.0819844463367190, 0.0159198802466562,
+        -0.148049012426782, 0.984080119753344, 0.0819844463367190, 0.0819844463367190,
+        -0.259378849739733, 0.984080119753344, 0.0819844463367190, 0.193314283649670,
+        -0.403937854387550, 0.984080119753344, 0.0819844463367190, 0.337873288297487,
+        -0.566064566090063, 0.984080119753344, 0.0819844463367190, 0.500000000000000,
+        -0.728191277792575, 0.984080119753344, 0.0819844463367190, 0.662126711702513,
+        -0.872750282440393, 0.984080119753344, 0.0819844463367190, 0.806685716350330,
+        -0.984080119753344, 0.984080119753344, 0.0819844463367190, 0.918015553663281,
+        -1.05014468584341, 0.984080119753344, 0.0819844463367190, 0.984080119753344,
+        -0.193314283649670, 0.984080119753344, 0.193314283649670, 0.0159198802466562,
+        -0.259378849739733, 0.984080119753344, 0.193314283649670, 0.0819844463367190,
+        -0.370708687052684, 0.984080119753344, 0.193314283649670, 0.193314283649670,
+        -0.515267691700501, 0.984080119753344, 0.193314283649670, 0.337873288297487,
+        -0.677394403403014, 0.984080119753344, 0.193314283649670, 0.500000000000000,
+        -0.839521115105526, 0.984080119753344, 0.193314283649670, 0.662126711702513,
+        -0.984080119753344, 0.984080119753344, 0.193314283649670, 0.806685716350330,
+        -1.09540995706629, 0.984080119753344, 0.193314283649670, 0.918015553663281,
+        -1.16147452315636, 0.984080119753344, 0.193314283649670, 0.984080119753344,
+        -0.337873288297487, 0.984080119753344, 0.337873288297487, 0.0159198802466562,
+        -0.403937854387550, 0.984080119753344, 0.337873288297487, 0.0819844463367190,
+        -0.515267691700501, 0.984080119753344, 0.337873288297487, 0.193314283649670,
+        -0.659826696348318, 0.984080119753344, 0.337873288297487, 0.337873288297487,
+        -0.821953408050831, 0.984080119753344, 0.337873288297487, 0.500000000000000,
+        -0.984080119753344, 0.984080119753344, 0.337873288297487, 0.662126711702513,
+        -1.12863912440116, 0.984080119753344, 0.337873288297487, 0.806685716350330,
+        -1.23996896171411, 0.984080119753344, 0.337873288297487, 0.918015553663281,
+        -1.30603352780417, 0.984080119753344, 0.337873288297487, 0.984080119753344,
+        -0.500000000000000, 0.984080119753344, 0.500000000000000, 0.0159198802466562,
+        -0.566064566090063, 0.984080119753344, 0.500000000000000, 0.0819844463367190,
+        -0.677394403403014, 0.984080119753344, 0.500000000000000, 0.193314283649670,
+        -0.821953408050831, 0.984080119753344, 0.500000000000000, 0.337873288297487,
+        -0.984080119753344, 0.984080119753344, 0.500000000000000, 0.500000000000000,
+        -1.14620683145586, 0.984080119753344, 0.500000000000000, 0.662126711702513,
+        -1.29076583610367, 0.984080119753344, 0.500000000000000, 0.806685716350330,
+        -1.40209567341662, 0.984080119753344, 0.500000000000000, 0.918015553663281,
+        -1.46816023950669, 0.984080119753344, 0.500000000000000, 0.984080119753344,
+        -0.662126711702513, 0.984080119753344, 0.662126711702513, 0.0159198802466562,
+        -0.728191277792575, 0.984080119753344, 0.662126711702513, 0.0819844463367190,
+        -0.839521115105526, 0.984080119753344, 0.662126711702513, 0.193314283649670,
+        -0.984080119753344, 0.984080119753344, 0.662126711702513, 0.337873288297487,
+        -1.14620683145586, 0.984080119753344, 0.662126711702513, 0.500000000000000,
+        -1.30833354315837, 0.984080119753344, 0.662126711702513, 0.662126711702513,
+        -1.45289254780619, 0.984080119753344, 0.662126711702513, 0.806685716350330,
+        -1.56422238511914, 0.984080119753344, 0.662126711702513, 0.918015553663281,
+        -1.63028695120920, 0.984080119753344, 0.662126711702513, 0.984080119753344,
+        -0.806685716350330, 0.984080119753344, 0.806685716350330, 0.0159198802466562,
+        -0.872750282440393, 0.984080119753344, 0.806685716350330, 0.0819844463367190,
+        -0.984080119753344, 0.984080119753344, 0.806685716350330, 0.193314283649670,
+        -1.12863912440116, 0.984080119753344, 0.806685716350330, 0.337873288297487,
+        -1.29076583610367, 0.984080119753344, 0.806685716350330, 0.500000000000000,
+        -1.45289254780619, 0.984080119753344, 0.806685716350330, 0.662126711702513,
+        -1.59745155245400, 0.984080119753344, 0.806685716350330, 0.806685716350330,
+        -1.70878138976695, 0.984080119753344, 0.806685716350330, 0.918015553663281,
+        -1.77484595585702, 0.984080119753344, 0.806685716350330, 0.984080119753344,
+        -0.918015553663281, 0.984080119753344, 0.918015553663281, 0.0159198802466562,
+        -0.984080119753344, 0.984080119753344, 0.918015553663281, 0.0819844463367190,
+        -1.09540995706629, 0.984080119753344, 0.918015553663281, 0.193314283649670,
+        -1.23996896171411, 0.984080119753344, 0.918015553663281, 0.337873288297487,
+        -1.40209567341662, 0.984080119753344, 0.918015553663281, 0.500000000000000,
+        -1.56422238511914, 0.984080119753344, 0.918015553663281, 0.662126711702513,
+        -1.70878138976695, 0.984080119753344, 0.918015553663281, 0.806685716350330,
+        -1.82011122707991, 0.984080119753344, 0.918015553663281, 0.918015553663281,
+        -1.88617579316997, 0.984080119753344, 0.918015553663281, 0.984080119753344,
+        -0.984080119753344, 0.984080119753344, 0.984080119753344, 0.0159198802466562,
+        -1.05014468584341, 0.984080119753344, 0.984080119753344, 0.0819844463367190,
+        -1.16147452315636, 0.984080119753344, 0.984080119753344, 0.193314283649670,
+        -1.30603352780417, 0.984080119753344, 0.984080119753344, 0.337873288297487,
+        -1.46816023950669, 0.984080119753344, 0.984080119753344, 0.500000000000000,
+        -1.63028695120920, 0.984080119753344, 0.984080119753344, 0.662126711702513,
+        -1.77484595585702, 0.984080119753344, 0.984080119753344, 0.806685716350330,
+        -1.88617579316997, 0.984080119753344, 0.984080119753344, 0.918015553663281,
+        -1.95224035926003, 0.984080119753344, 0.984080119753344, 0.984080119753344};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         6.71075127501147e-5,  0.000149159519886544, 0.000215183848000758, 0.000257902100249559,
         0.000272675589112509, 0.000257902100249559, 0.000215183848000758, 0.000149159519886544,
@@ -4316,1006 +3509,1006 @@ struct GaussLegendreQuadrature<3, 10>
     inline static std::uint8_t constexpr kOrder                              = 10;
     inline static int constexpr kPoints                                      = 1000;
     inline static std::array<Scalar, (kDims + 1) * kPoints> constexpr points = {
-        0.960859792776318,   0.906438211863133,   0.813611312667490,   0.690604225581410,
-        0.548343698008466,   0.399469359026625,   0.257208831453681,   0.134201744367601,
-        0.0413748451719584,  -0.0130467357412272, 0.906438211863133,   0.852016630949947,
-        0.759189731754304,   0.636182644668224,   0.493922117095281,   0.345047778113440,
-        0.202787250540496,   0.0797801634544157,  -0.0130467357412272, -0.0674683166544128,
-        0.813611312667490,   0.759189731754304,   0.666362832558661,   0.543355745472581,
-        0.401095217899638,   0.252220878917797,   0.109960351344853,   -0.0130467357412272,
-        -0.105873634936870,  -0.160295215850056,  0.690604225581410,   0.636182644668224,
-        0.543355745472581,   0.420348658386501,   0.278088130813558,   0.129213791831717,
-        -0.0130467357412272, -0.136053822827307,  -0.228880722022950,  -0.283302302936136,
-        0.548343698008466,   0.493922117095281,   0.401095217899638,   0.278088130813558,
-        0.135827603240614,   -0.0130467357412272, -0.155307263314171,  -0.278314350400251,
-        -0.371141249595894,  -0.425562830509080,  0.399469359026625,   0.345047778113440,
-        0.252220878917797,   0.129213791831717,   -0.0130467357412272, -0.161921074723068,
-        -0.304181602296012,  -0.427188689382092,  -0.520015588577735,  -0.574437169490920,
-        0.257208831453681,   0.202787250540496,   0.109960351344853,   -0.0130467357412272,
-        -0.155307263314171,  -0.304181602296012,  -0.446442129868956,  -0.569449216955036,
-        -0.662276116150679,  -0.716697697063864,  0.134201744367601,   0.0797801634544157,
-        -0.0130467357412272, -0.136053822827307,  -0.278314350400251,  -0.427188689382092,
-        -0.569449216955036,  -0.692456304041116,  -0.785283203236759,  -0.839704784149944,
-        0.0413748451719584,  -0.0130467357412272, -0.105873634936870,  -0.228880722022950,
-        -0.371141249595894,  -0.520015588577735,  -0.662276116150679,  -0.785283203236759,
-        -0.878110102432402,  -0.932531683345587,  -0.0130467357412272, -0.0674683166544128,
-        -0.160295215850056,  -0.283302302936136,  -0.425562830509080,  -0.574437169490920,
-        -0.716697697063864,  -0.839704784149944,  -0.932531683345587,  -0.986953264258773,
-        0.906438211863133,   0.852016630949947,   0.759189731754304,   0.636182644668224,
-        0.493922117095281,   0.345047778113440,   0.202787250540496,   0.0797801634544157,
-        -0.0130467357412272, -0.0674683166544128, 0.852016630949947,   0.797595050036762,
-        0.704768150841119,   0.581761063755039,   0.439500536182095,   0.290626197200254,
-        0.148365669627310,   0.0253585825412301,  -0.0674683166544128, -0.121889897567598,
-        0.759189731754304,   0.704768150841119,   0.611941251645476,   0.488934164559396,
-        0.346673636986452,   0.197799298004611,   0.0555387704316672,  -0.0674683166544128,
-        -0.160295215850056,  -0.214716796763241,  0.636182644668224,   0.581761063755039,
-        0.488934164559396,   0.365927077473316,   0.223666549900372,   0.0747922109185311,
-        -0.0674683166544128, -0.190475403740493,  -0.283302302936136,  -0.337723883849321,
-        0.493922117095281,   0.439500536182095,   0.346673636986452,   0.223666549900372,
-        0.0814060223274282,  -0.0674683166544128, -0.209728844227357,  -0.332735931313437,
-        -0.425562830509080,  -0.479984411422265,  0.345047778113440,   0.290626197200254,
-        0.197799298004611,   0.0747922109185311,  -0.0674683166544128, -0.216342655636254,
-        -0.358603183209198,  -0.481610270295278,  -0.574437169490920,  -0.628858750404106,
-        0.202787250540496,   0.148365669627310,   0.0555387704316672,  -0.0674683166544128,
-        -0.209728844227357,  -0.358603183209198,  -0.500863710782141,  -0.623870797868221,
-        -0.716697697063864,  -0.771119277977050,  0.0797801634544157,  0.0253585825412301,
-        -0.0674683166544128, -0.190475403740493,  -0.332735931313437,  -0.481610270295278,
-        -0.623870797868221,  -0.746877884954301,  -0.839704784149944,  -0.894126365063130,
-        -0.0130467357412272, -0.0674683166544128, -0.160295215850056,  -0.283302302936136,
-        -0.425562830509080,  -0.574437169490920,  -0.716697697063864,  -0.839704784149944,
-        -0.932531683345587,  -0.986953264258773,  -0.0674683166544128, -0.121889897567598,
-        -0.214716796763241,  -0.337723883849321,  -0.479984411422265,  -0.628858750404106,
-        -0.771119277977050,  -0.894126365063130,  -0.986953264258773,  -1.04137484517196,
-        0.813611312667490,   0.759189731754304,   0.666362832558661,   0.543355745472581,
-        0.401095217899638,   0.252220878917797,   0.109960351344853,   -0.0130467357412272,
-        -0.105873634936870,  -0.160295215850056,  0.759189731754304,   0.704768150841119,
-        0.611941251645476,   0.488934164559396,   0.346673636986452,   0.197799298004611,
-        0.0555387704316672,  -0.0674683166544128, -0.160295215850056,  -0.214716796763241,
-        0.666362832558661,   0.611941251645476,   0.519114352449833,   0.396107265363753,
-        0.253846737790809,   0.104972398808968,   -0.0372881287639757, -0.160295215850056,
-        -0.253122115045699,  -0.307543695958884,  0.543355745472581,   0.488934164559396,
-        0.396107265363753,   0.273100178277673,   0.130839650704729,   -0.0180346882771119,
-        -0.160295215850056,  -0.283302302936136,  -0.376129202131779,  -0.430550783044964,
-        0.401095217899638,   0.346673636986452,   0.253846737790809,   0.130839650704729,
-        -0.0114208768682147, -0.160295215850056,  -0.302555743423000,  -0.425562830509080,
-        -0.518389729704722,  -0.572811310617908,  0.252220878917797,   0.197799298004611,
-        0.104972398808968,   -0.0180346882771119, -0.160295215850056,  -0.309169554831897,
-        -0.451430082404841,  -0.574437169490920,  -0.667264068686563,  -0.721685649599749,
-        0.109960351344853,   0.0555387704316672,  -0.0372881287639757, -0.160295215850056,
-        -0.302555743423000,  -0.451430082404841,  -0.593690609977784,  -0.716697697063864,
-        -0.809524596259507,  -0.863946177172693,  -0.0130467357412272, -0.0674683166544128,
-        -0.160295215850056,  -0.283302302936136,  -0.425562830509080,  -0.574437169490920,
-        -0.716697697063864,  -0.839704784149944,  -0.932531683345587,  -0.986953264258773,
-        -0.105873634936870,  -0.160295215850056,  -0.253122115045699,  -0.376129202131779,
-        -0.518389729704722,  -0.667264068686563,  -0.809524596259507,  -0.932531683345587,
-        -1.02535858254123,   -1.07978016345442,   -0.160295215850056,  -0.214716796763241,
-        -0.307543695958884,  -0.430550783044964,  -0.572811310617908,  -0.721685649599749,
-        -0.863946177172693,  -0.986953264258773,  -1.07978016345442,   -1.13420174436760,
-        0.690604225581410,   0.636182644668224,   0.543355745472581,   0.420348658386501,
-        0.278088130813558,   0.129213791831717,   -0.0130467357412272, -0.136053822827307,
-        -0.228880722022950,  -0.283302302936136,  0.636182644668224,   0.581761063755039,
-        0.488934164559396,   0.365927077473316,   0.223666549900372,   0.0747922109185311,
-        -0.0674683166544128, -0.190475403740493,  -0.283302302936136,  -0.337723883849321,
-        0.543355745472581,   0.488934164559396,   0.396107265363753,   0.273100178277673,
-        0.130839650704729,   -0.0180346882771119, -0.160295215850056,  -0.283302302936136,
-        -0.376129202131779,  -0.430550783044964,  0.420348658386501,   0.365927077473316,
-        0.273100178277673,   0.150093091191593,   0.00783256361864915, -0.141041775363192,
-        -0.283302302936136,  -0.406309390022216,  -0.499136289217859,  -0.553557870131044,
-        0.278088130813558,   0.223666549900372,   0.130839650704729,   0.00783256361864915,
-        -0.134427963954295,  -0.283302302936136,  -0.425562830509080,  -0.548569917595159,
-        -0.641396816790802,  -0.695818397703988,  0.129213791831717,   0.0747922109185311,
-        -0.0180346882771119, -0.141041775363192,  -0.283302302936136,  -0.432176641917977,
-        -0.574437169490920,  -0.697444256577000,  -0.790271155772643,  -0.844692736685829,
-        -0.0130467357412272, -0.0674683166544128, -0.160295215850056,  -0.283302302936136,
-        -0.425562830509080,  -0.574437169490920,  -0.716697697063864,  -0.839704784149944,
-        -0.932531683345587,  -0.986953264258773,  -0.136053822827307,  -0.190475403740493,
-        -0.283302302936136,  -0.406309390022216,  -0.548569917595159,  -0.697444256577000,
-        -0.839704784149944,  -0.962711871236024,  -1.05553877043167,   -1.10996035134485,
-        -0.228880722022950,  -0.283302302936136,  -0.376129202131779,  -0.499136289217859,
-        -0.641396816790802,  -0.790271155772643,  -0.932531683345587,  -1.05553877043167,
-        -1.14836566962731,   -1.20278725054050,   -0.283302302936136,  -0.337723883849321,
-        -0.430550783044964,  -0.553557870131044,  -0.695818397703988,  -0.844692736685829,
-        -0.986953264258773,  -1.10996035134485,   -1.20278725054050,   -1.25720883145368,
-        0.548343698008466,   0.493922117095281,   0.401095217899638,   0.278088130813558,
-        0.135827603240614,   -0.0130467357412272, -0.155307263314171,  -0.278314350400251,
-        -0.371141249595894,  -0.425562830509080,  0.493922117095281,   0.439500536182095,
-        0.346673636986452,   0.223666549900372,   0.0814060223274282,  -0.0674683166544128,
-        -0.209728844227357,  -0.332735931313437,  -0.425562830509080,  -0.479984411422265,
-        0.401095217899638,   0.346673636986452,   0.253846737790809,   0.130839650704729,
-        -0.0114208768682147, -0.160295215850056,  -0.302555743423000,  -0.425562830509080,
-        -0.518389729704722,  -0.572811310617908,  0.278088130813558,   0.223666549900372,
-        0.130839650704729,   0.00783256361864915, -0.134427963954295,  -0.283302302936136,
-        -0.425562830509080,  -0.548569917595159,  -0.641396816790802,  -0.695818397703988,
-        0.135827603240614,   0.0814060223274282,  -0.0114208768682147, -0.134427963954295,
-        -0.276688491527239,  -0.425562830509080,  -0.567823358082023,  -0.690830445168103,
-        -0.783657344363746,  -0.838078925276932,  -0.0130467357412272, -0.0674683166544128,
-        -0.160295215850056,  -0.283302302936136,  -0.425562830509080,  -0.574437169490920,
-        -0.716697697063864,  -0.839704784149944,  -0.932531683345587,  -0.986953264258773,
-        -0.155307263314171,  -0.209728844227357,  -0.302555743423000,  -0.425562830509080,
-        -0.567823358082023,  -0.716697697063864,  -0.858958224636808,  -0.981965311722888,
-        -1.07479221091853,   -1.12921379183172,   -0.278314350400251,  -0.332735931313437,
-        -0.425562830509080,  -0.548569917595159,  -0.690830445168103,  -0.839704784149944,
-        -0.981965311722888,  -1.10497239880897,   -1.19779929800461,   -1.25222087891780,
-        -0.371141249595894,  -0.425562830509080,  -0.518389729704722,  -0.641396816790802,
-        -0.783657344363746,  -0.932531683345587,  -1.07479221091853,   -1.19779929800461,
-        -1.29062619720025,   -1.34504777811344,   -0.425562830509080,  -0.479984411422265,
-        -0.572811310617908,  -0.695818397703988,  -0.838078925276932,  -0.986953264258773,
-        -1.12921379183172,   -1.25222087891780,   -1.34504777811344,   -1.39946935902663,
-        0.399469359026625,   0.345047778113440,   0.252220878917797,   0.129213791831717,
-        -0.0130467357412272, -0.161921074723068,  -0.304181602296012,  -0.427188689382092,
-        -0.520015588577735,  -0.574437169490920,  0.345047778113440,   0.290626197200254,
-        0.197799298004611,   0.0747922109185311,  -0.0674683166544128, -0.216342655636254,
-        -0.358603183209198,  -0.481610270295278,  -0.574437169490920,  -0.628858750404106,
-        0.252220878917797,   0.197799298004611,   0.104972398808968,   -0.0180346882771119,
-        -0.160295215850056,  -0.309169554831897,  -0.451430082404841,  -0.574437169490920,
-        -0.667264068686563,  -0.721685649599749,  0.129213791831717,   0.0747922109185311,
-        -0.0180346882771119, -0.141041775363192,  -0.283302302936136,  -0.432176641917977,
-        -0.574437169490920,  -0.697444256577000,  -0.790271155772643,  -0.844692736685829,
-        -0.0130467357412272, -0.0674683166544128, -0.160295215850056,  -0.283302302936136,
-        -0.425562830509080,  -0.574437169490920,  -0.716697697063864,  -0.839704784149944,
-        -0.932531683345587,  -0.986953264258773,  -0.161921074723068,  -0.216342655636254,
-        -0.309169554831897,  -0.432176641917977,  -0.574437169490920,  -0.723311508472761,
-        -0.865572036045705,  -0.988579123131785,  -1.08140602232743,   -1.13582760324061,
-        -0.304181602296012,  -0.358603183209198,  -0.451430082404841,  -0.574437169490920,
-        -0.716697697063864,  -0.865572036045705,  -1.00783256361865,   -1.13083965070473,
-        -1.22366654990037,   -1.27808813081356,   -0.427188689382092,  -0.481610270295278,
-        -0.574437169490920,  -0.697444256577000,  -0.839704784149944,  -0.988579123131785,
-        -1.13083965070473,   -1.25384673779081,   -1.34667363698645,   -1.40109521789964,
-        -0.520015588577735,  -0.574437169490920,  -0.667264068686563,  -0.790271155772643,
-        -0.932531683345587,  -1.08140602232743,   -1.22366654990037,   -1.34667363698645,
-        -1.43950053618209,   -1.49392211709528,   -0.574437169490920,  -0.628858750404106,
-        -0.721685649599749,  -0.844692736685829,  -0.986953264258773,  -1.13582760324061,
-        -1.27808813081356,   -1.40109521789964,   -1.49392211709528,   -1.54834369800847,
-        0.257208831453681,   0.202787250540496,   0.109960351344853,   -0.0130467357412272,
-        -0.155307263314171,  -0.304181602296012,  -0.446442129868956,  -0.569449216955036,
-        -0.662276116150679,  -0.716697697063864,  0.202787250540496,   0.148365669627310,
-        0.0555387704316672,  -0.0674683166544128, -0.209728844227357,  -0.358603183209198,
-        -0.500863710782141,  -0.623870797868221,  -0.716697697063864,  -0.771119277977050,
-        0.109960351344853,   0.0555387704316672,  -0.0372881287639757, -0.160295215850056,
-        -0.302555743423000,  -0.451430082404841,  -0.593690609977784,  -0.716697697063864,
-        -0.809524596259507,  -0.863946177172693,  -0.0130467357412272, -0.0674683166544128,
-        -0.160295215850056,  -0.283302302936136,  -0.425562830509080,  -0.574437169490920,
-        -0.716697697063864,  -0.839704784149944,  -0.932531683345587,  -0.986953264258773,
-        -0.155307263314171,  -0.209728844227357,  -0.302555743423000,  -0.425562830509080,
-        -0.567823358082023,  -0.716697697063864,  -0.858958224636808,  -0.981965311722888,
-        -1.07479221091853,   -1.12921379183172,   -0.304181602296012,  -0.358603183209198,
-        -0.451430082404841,  -0.574437169490920,  -0.716697697063864,  -0.865572036045705,
-        -1.00783256361865,   -1.13083965070473,   -1.22366654990037,   -1.27808813081356,
-        -0.446442129868956,  -0.500863710782141,  -0.593690609977784,  -0.716697697063864,
-        -0.858958224636808,  -1.00783256361865,   -1.15009309119159,   -1.27310017827767,
-        -1.36592707747332,   -1.42034865838650,   -0.569449216955036,  -0.623870797868221,
-        -0.716697697063864,  -0.839704784149944,  -0.981965311722888,  -1.13083965070473,
-        -1.27310017827767,   -1.39610726536375,   -1.48893416455940,   -1.54335574547258,
-        -0.662276116150679,  -0.716697697063864,  -0.809524596259507,  -0.932531683345587,
-        -1.07479221091853,   -1.22366654990037,   -1.36592707747332,   -1.48893416455940,
-        -1.58176106375504,   -1.63618264466822,   -0.716697697063864,  -0.771119277977050,
-        -0.863946177172693,  -0.986953264258773,  -1.12921379183172,   -1.27808813081356,
-        -1.42034865838650,   -1.54335574547258,   -1.63618264466822,   -1.69060422558141,
-        0.134201744367601,   0.0797801634544157,  -0.0130467357412272, -0.136053822827307,
-        -0.278314350400251,  -0.427188689382092,  -0.569449216955036,  -0.692456304041116,
-        -0.785283203236759,  -0.839704784149944,  0.0797801634544157,  0.0253585825412301,
-        -0.0674683166544128, -0.190475403740493,  -0.332735931313437,  -0.481610270295278,
-        -0.623870797868221,  -0.746877884954301,  -0.839704784149944,  -0.894126365063130,
-        -0.0130467357412272, -0.0674683166544128, -0.160295215850056,  -0.283302302936136,
-        -0.425562830509080,  -0.574437169490920,  -0.716697697063864,  -0.839704784149944,
-        -0.932531683345587,  -0.986953264258773,  -0.136053822827307,  -0.190475403740493,
-        -0.283302302936136,  -0.406309390022216,  -0.548569917595159,  -0.697444256577000,
-        -0.839704784149944,  -0.962711871236024,  -1.05553877043167,   -1.10996035134485,
-        -0.278314350400251,  -0.332735931313437,  -0.425562830509080,  -0.548569917595159,
-        -0.690830445168103,  -0.839704784149944,  -0.981965311722888,  -1.10497239880897,
-        -1.19779929800461,   -1.25222087891780,   -0.427188689382092,  -0.481610270295278,
-        -0.574437169490920,  -0.697444256577000,  -0.839704784149944,  -0.988579123131785,
-        -1.13083965070473,   -1.25384673779081,   -1.34667363698645,   -1.40109521789964,
-        -0.569449216955036,  -0.623870797868221,  -0.716697697063864,  -0.839704784149944,
-        -0.981965311722888,  -1.13083965070473,   -1.27310017827767,   -1.39610726536375,
-        -1.48893416455940,   -1.54335574547258,   -0.692456304041116,  -0.746877884954301,
-        -0.839704784149944,  -0.962711871236024,  -1.10497239880897,   -1.25384673779081,
-        -1.39610726536375,   -1.51911435244983,   -1.61194125164548,   -1.66636283255866,
-        -0.785283203236759,  -0.839704784149944,  -0.932531683345587,  -1.05553877043167,
-        -1.19779929800461,   -1.34667363698645,   -1.48893416455940,   -1.61194125164548,
-        -1.70476815084112,   -1.75918973175430,   -0.839704784149944,  -0.894126365063130,
-        -0.986953264258773,  -1.10996035134485,   -1.25222087891780,   -1.40109521789964,
-        -1.54335574547258,   -1.66636283255866,   -1.75918973175430,   -1.81361131266749,
-        0.0413748451719584,  -0.0130467357412272, -0.105873634936870,  -0.228880722022950,
-        -0.371141249595894,  -0.520015588577735,  -0.662276116150679,  -0.785283203236759,
-        -0.878110102432402,  -0.932531683345587,  -0.0130467357412272, -0.0674683166544128,
-        -0.160295215850056,  -0.283302302936136,  -0.425562830509080,  -0.574437169490920,
-        -0.716697697063864,  -0.839704784149944,  -0.932531683345587,  -0.986953264258773,
-        -0.105873634936870,  -0.160295215850056,  -0.253122115045699,  -0.376129202131779,
-        -0.518389729704722,  -0.667264068686563,  -0.809524596259507,  -0.932531683345587,
-        -1.02535858254123,   -1.07978016345442,   -0.228880722022950,  -0.283302302936136,
-        -0.376129202131779,  -0.499136289217859,  -0.641396816790802,  -0.790271155772643,
-        -0.932531683345587,  -1.05553877043167,   -1.14836566962731,   -1.20278725054050,
-        -0.371141249595894,  -0.425562830509080,  -0.518389729704722,  -0.641396816790802,
-        -0.783657344363746,  -0.932531683345587,  -1.07479221091853,   -1.19779929800461,
-        -1.29062619720025,   -1.34504777811344,   -0.520015588577735,  -0.574437169490920,
-        -0.667264068686563,  -0.790271155772643,  -0.932531683345587,  -1.08140602232743,
-        -1.22366654990037,   -1.34667363698645,   -1.43950053618209,   -1.49392211709528,
-        -0.662276116150679,  -0.716697697063864,  -0.809524596259507,  -0.932531683345587,
-        -1.07479221091853,   -1.22366654990037,   -1.36592707747332,   -1.48893416455940,
-        -1.58176106375504,   -1.63618264466822,   -0.785283203236759,  -0.839704784149944,
-        -0.932531683345587,  -1.05553877043167,   -1.19779929800461,   -1.34667363698645,
-        -1.48893416455940,   -1.61194125164548,   -1.70476815084112,   -1.75918973175430,
-        -0.878110102432402,  -0.932531683345587,  -1.02535858254123,   -1.14836566962731,
-        -1.29062619720025,   -1.43950053618209,   -1.58176106375504,   -1.70476815084112,
-        -1.79759505003676,   -1.85201663094995,   -0.932531683345587,  -0.986953264258773,
-        -1.07978016345442,   -1.20278725054050,   -1.34504777811344,   -1.49392211709528,
-        -1.63618264466822,   -1.75918973175430,   -1.85201663094995,   -1.90643821186313,
-        -0.0130467357412272, -0.0674683166544128, -0.160295215850056,  -0.283302302936136,
-        -0.425562830509080,  -0.574437169490920,  -0.716697697063864,  -0.839704784149944,
-        -0.932531683345587,  -0.986953264258773,  -0.0674683166544128, -0.121889897567598,
-        -0.214716796763241,  -0.337723883849321,  -0.479984411422265,  -0.628858750404106,
-        -0.771119277977050,  -0.894126365063130,  -0.986953264258773,  -1.04137484517196,
-        -0.160295215850056,  -0.214716796763241,  -0.307543695958884,  -0.430550783044964,
-        -0.572811310617908,  -0.721685649599749,  -0.863946177172693,  -0.986953264258773,
-        -1.07978016345442,   -1.13420174436760,   -0.283302302936136,  -0.337723883849321,
-        -0.430550783044964,  -0.553557870131044,  -0.695818397703988,  -0.844692736685829,
-        -0.986953264258773,  -1.10996035134485,   -1.20278725054050,   -1.25720883145368,
-        -0.425562830509080,  -0.479984411422265,  -0.572811310617908,  -0.695818397703988,
-        -0.838078925276932,  -0.986953264258773,  -1.12921379183172,   -1.25222087891780,
-        -1.34504777811344,   -1.39946935902663,   -0.574437169490920,  -0.628858750404106,
-        -0.721685649599749,  -0.844692736685829,  -0.986953264258773,  -1.13582760324061,
-        -1.27808813081356,   -1.40109521789964,   -1.49392211709528,   -1.54834369800847,
-        -0.716697697063864,  -0.771119277977050,  -0.863946177172693,  -0.986953264258773,
-        -1.12921379183172,   -1.27808813081356,   -1.42034865838650,   -1.54335574547258,
-        -1.63618264466822,   -1.69060422558141,   -0.839704784149944,  -0.894126365063130,
-        -0.986953264258773,  -1.10996035134485,   -1.25222087891780,   -1.40109521789964,
-        -1.54335574547258,   -1.66636283255866,   -1.75918973175430,   -1.81361131266749,
-        -0.932531683345587,  -0.986953264258773,  -1.07978016345442,   -1.20278725054050,
-        -1.34504777811344,   -1.49392211709528,   -1.63618264466822,   -1.75918973175430,
-        -1.85201663094995,   -1.90643821186313,   -0.986953264258773,  -1.04137484517196,
-        -1.13420174436760,   -1.25720883145368,   -1.39946935902663,   -1.54834369800847,
-        -1.69060422558141,   -1.81361131266749,   -1.90643821186313,   -1.96085979277632,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0130467357412272,  0.0130467357412272,
-        0.0130467357412272,  0.0130467357412272,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.0674683166544128,  0.0674683166544128,  0.0674683166544128,  0.0674683166544128,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.160295215850056,   0.160295215850056,
-        0.160295215850056,   0.160295215850056,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.283302302936136,   0.283302302936136,   0.283302302936136,   0.283302302936136,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.425562830509080,   0.425562830509080,
-        0.425562830509080,   0.425562830509080,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.574437169490920,   0.574437169490920,   0.574437169490920,   0.574437169490920,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.716697697063864,   0.716697697063864,
-        0.716697697063864,   0.716697697063864,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.839704784149944,   0.839704784149944,   0.839704784149944,   0.839704784149944,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.932531683345587,   0.932531683345587,
-        0.932531683345587,   0.932531683345587,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.986953264258773,   0.986953264258773,   0.986953264258773,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773,
-        0.0130467357412272,  0.0674683166544128,  0.160295215850056,   0.283302302936136,
-        0.425562830509080,   0.574437169490920,   0.716697697063864,   0.839704784149944,
-        0.932531683345587,   0.986953264258773,   0.0130467357412272,  0.0674683166544128,
-        0.160295215850056,   0.283302302936136,   0.425562830509080,   0.574437169490920,
-        0.716697697063864,   0.839704784149944,   0.932531683345587,   0.986953264258773};
+        0.960859792776318, 0.0130467357412272, 0.0130467357412272, 0.0130467357412272,
+        0.906438211863133, 0.0130467357412272, 0.0130467357412272, 0.0674683166544128,
+        0.813611312667490, 0.0130467357412272, 0.0130467357412272, 0.160295215850056,
+        0.690604225581410, 0.0130467357412272, 0.0130467357412272, 0.283302302936136,
+        0.548343698008466, 0.0130467357412272, 0.0130467357412272, 0.425562830509080,
+        0.399469359026625, 0.0130467357412272, 0.0130467357412272, 0.574437169490920,
+        0.257208831453681, 0.0130467357412272, 0.0130467357412272, 0.716697697063864,
+        0.134201744367601, 0.0130467357412272, 0.0130467357412272, 0.839704784149944,
+        0.0413748451719584, 0.0130467357412272, 0.0130467357412272, 0.932531683345587,
+        -0.0130467357412272, 0.0130467357412272, 0.0130467357412272, 0.986953264258773,
+        0.906438211863133, 0.0130467357412272, 0.0674683166544128, 0.0130467357412272,
+        0.852016630949947, 0.0130467357412272, 0.0674683166544128, 0.0674683166544128,
+        0.759189731754304, 0.0130467357412272, 0.0674683166544128, 0.160295215850056,
+        0.636182644668224, 0.0130467357412272, 0.0674683166544128, 0.283302302936136,
+        0.493922117095281, 0.0130467357412272, 0.0674683166544128, 0.425562830509080,
+        0.345047778113440, 0.0130467357412272, 0.0674683166544128, 0.574437169490920,
+        0.202787250540496, 0.0130467357412272, 0.0674683166544128, 0.716697697063864,
+        0.0797801634544157, 0.0130467357412272, 0.0674683166544128, 0.839704784149944,
+        -0.0130467357412272, 0.0130467357412272, 0.0674683166544128, 0.932531683345587,
+        -0.0674683166544128, 0.0130467357412272, 0.0674683166544128, 0.986953264258773,
+        0.813611312667490, 0.0130467357412272, 0.160295215850056, 0.0130467357412272,
+        0.759189731754304, 0.0130467357412272, 0.160295215850056, 0.0674683166544128,
+        0.666362832558661, 0.0130467357412272, 0.160295215850056, 0.160295215850056,
+        0.543355745472581, 0.0130467357412272, 0.160295215850056, 0.283302302936136,
+        0.401095217899638, 0.0130467357412272, 0.160295215850056, 0.425562830509080,
+        0.252220878917797, 0.0130467357412272, 0.160295215850056, 0.574437169490920,
+        0.109960351344853, 0.0130467357412272, 0.160295215850056, 0.716697697063864,
+        -0.0130467357412272, 0.0130467357412272, 0.160295215850056, 0.839704784149944,
+        -0.105873634936870, 0.0130467357412272, 0.160295215850056, 0.932531683345587,
+        -0.160295215850056, 0.0130467357412272, 0.160295215850056, 0.986953264258773,
+        0.690604225581410, 0.0130467357412272, 0.283302302936136, 0.0130467357412272,
+        0.636182644668224, 0.0130467357412272, 0.283302302936136, 0.0674683166544128,
+        0.543355745472581, 0.0130467357412272, 0.283302302936136, 0.160295215850056,
+        0.420348658386501, 0.0130467357412272, 0.283302302936136, 0.283302302936136,
+        0.278088130813558, 0.0130467357412272, 0.283302302936136, 0.425562830509080,
+        0.129213791831717, 0.0130467357412272, 0.283302302936136, 0.574437169490920,
+        -0.0130467357412272, 0.0130467357412272, 0.283302302936136, 0.716697697063864,
+        -0.136053822827307, 0.0130467357412272, 0.283302302936136, 0.839704784149944,
+        -0.228880722022950, 0.0130467357412272, 0.283302302936136, 0.932531683345587,
+        -0.283302302936136, 0.0130467357412272, 0.283302302936136, 0.986953264258773,
+        0.548343698008466, 0.0130467357412272, 0.425562830509080, 0.0130467357412272,
+        0.493922117095281, 0.0130467357412272, 0.425562830509080, 0.0674683166544128,
+        0.401095217899638, 0.0130467357412272, 0.425562830509080, 0.160295215850056,
+        0.278088130813558, 0.0130467357412272, 0.425562830509080, 0.283302302936136,
+        0.135827603240614, 0.0130467357412272, 0.425562830509080, 0.425562830509080,
+        -0.0130467357412272, 0.0130467357412272, 0.425562830509080, 0.574437169490920,
+        -0.155307263314171, 0.0130467357412272, 0.425562830509080, 0.716697697063864,
+        -0.278314350400251, 0.0130467357412272, 0.425562830509080, 0.839704784149944,
+        -0.371141249595894, 0.0130467357412272, 0.425562830509080, 0.932531683345587,
+        -0.425562830509080, 0.0130467357412272, 0.425562830509080, 0.986953264258773,
+        0.399469359026625, 0.0130467357412272, 0.574437169490920, 0.0130467357412272,
+        0.345047778113440, 0.0130467357412272, 0.574437169490920, 0.0674683166544128,
+        0.252220878917797, 0.0130467357412272, 0.574437169490920, 0.160295215850056,
+        0.129213791831717, 0.0130467357412272, 0.574437169490920, 0.283302302936136,
+        -0.0130467357412272, 0.0130467357412272, 0.574437169490920, 0.425562830509080,
+        -0.161921074723068, 0.0130467357412272, 0.574437169490920, 0.574437169490920,
+        -0.304181602296012, 0.0130467357412272, 0.574437169490920, 0.716697697063864,
+        -0.427188689382092, 0.0130467357412272, 0.574437169490920, 0.839704784149944,
+        -0.520015588577735, 0.0130467357412272, 0.574437169490920, 0.932531683345587,
+        -0.574437169490920, 0.0130467357412272, 0.574437169490920, 0.986953264258773,
+        0.257208831453681, 0.0130467357412272, 0.716697697063864, 0.0130467357412272,
+        0.202787250540496, 0.0130467357412272, 0.716697697063864, 0.0674683166544128,
+        0.109960351344853, 0.0130467357412272, 0.716697697063864, 0.160295215850056,
+        -0.0130467357412272, 0.0130467357412272, 0.716697697063864, 0.283302302936136,
+        -0.155307263314171, 0.0130467357412272, 0.716697697063864, 0.425562830509080,
+        -0.304181602296012, 0.0130467357412272, 0.716697697063864, 0.574437169490920,
+        -0.446442129868956, 0.0130467357412272, 0.716697697063864, 0.716697697063864,
+        -0.569449216955036, 0.0130467357412272, 0.716697697063864, 0.839704784149944,
+        -0.662276116150679, 0.0130467357412272, 0.716697697063864, 0.932531683345587,
+        -0.716697697063864, 0.0130467357412272, 0.716697697063864, 0.986953264258773,
+        0.134201744367601, 0.0130467357412272, 0.839704784149944, 0.0130467357412272,
+        0.0797801634544157, 0.0130467357412272, 0.839704784149944, 0.0674683166544128,
+        -0.0130467357412272, 0.0130467357412272, 0.839704784149944, 0.160295215850056,
+        -0.136053822827307, 0.0130467357412272, 0.839704784149944, 0.283302302936136,
+        -0.278314350400251, 0.0130467357412272, 0.839704784149944, 0.425562830509080,
+        -0.427188689382092, 0.0130467357412272, 0.839704784149944, 0.574437169490920,
+        -0.569449216955036, 0.0130467357412272, 0.839704784149944, 0.716697697063864,
+        -0.692456304041116, 0.0130467357412272, 0.839704784149944, 0.839704784149944,
+        -0.785283203236759, 0.0130467357412272, 0.839704784149944, 0.932531683345587,
+        -0.839704784149944, 0.0130467357412272, 0.839704784149944, 0.986953264258773,
+        0.0413748451719584, 0.0130467357412272, 0.932531683345587, 0.0130467357412272,
+        -0.0130467357412272, 0.0130467357412272, 0.932531683345587, 0.0674683166544128,
+        -0.105873634936870, 0.0130467357412272, 0.932531683345587, 0.160295215850056,
+        -0.228880722022950, 0.0130467357412272, 0.932531683345587, 0.283302302936136,
+        -0.371141249595894, 0.0130467357412272, 0.932531683345587, 0.425562830509080,
+        -0.520015588577735, 0.0130467357412272, 0.932531683345587, 0.574437169490920,
+        -0.662276116150679, 0.0130467357412272, 0.932531683345587, 0.716697697063864,
+        -0.785283203236759, 0.0130467357412272, 0.932531683345587, 0.839704784149944,
+        -0.878110102432402, 0.0130467357412272, 0.932531683345587, 0.932531683345587,
+        -0.932531683345587, 0.0130467357412272, 0.932531683345587, 0.986953264258773,
+        -0.0130467357412272, 0.0130467357412272, 0.986953264258773, 0.0130467357412272,
+        -0.0674683166544128, 0.0130467357412272, 0.986953264258773, 0.0674683166544128,
+        -0.160295215850056, 0.0130467357412272, 0.986953264258773, 0.160295215850056,
+        -0.283302302936136, 0.0130467357412272, 0.986953264258773, 0.283302302936136,
+        -0.425562830509080, 0.0130467357412272, 0.986953264258773, 0.425562830509080,
+        -0.574437169490920, 0.0130467357412272, 0.986953264258773, 0.574437169490920,
+        -0.716697697063864, 0.0130467357412272, 0.986953264258773, 0.716697697063864,
+        -0.839704784149944, 0.0130467357412272, 0.986953264258773, 0.839704784149944,
+        -0.932531683345587, 0.0130467357412272, 0.986953264258773, 0.932531683345587,
+        -0.986953264258773, 0.0130467357412272, 0.986953264258773, 0.986953264258773,
+        0.906438211863133, 0.0674683166544128, 0.0130467357412272, 0.0130467357412272,
+        0.852016630949947, 0.0674683166544128, 0.0130467357412272, 0.0674683166544128,
+        0.759189731754304, 0.0674683166544128, 0.0130467357412272, 0.160295215850056,
+        0.636182644668224, 0.0674683166544128, 0.0130467357412272, 0.283302302936136,
+        0.493922117095281, 0.0674683166544128, 0.0130467357412272, 0.425562830509080,
+        0.345047778113440, 0.0674683166544128, 0.0130467357412272, 0.574437169490920,
+        0.202787250540496, 0.0674683166544128, 0.0130467357412272, 0.716697697063864,
+        0.0797801634544157, 0.0674683166544128, 0.0130467357412272, 0.839704784149944,
+        -0.0130467357412272, 0.0674683166544128, 0.0130467357412272, 0.932531683345587,
+        -0.0674683166544128, 0.0674683166544128, 0.0130467357412272, 0.986953264258773,
+        0.852016630949947, 0.0674683166544128, 0.0674683166544128, 0.0130467357412272,
+        0.797595050036762, 0.0674683166544128, 0.0674683166544128, 0.0674683166544128,
+        0.704768150841119, 0.0674683166544128, 0.0674683166544128, 0.160295215850056,
+        0.581761063755039, 0.0674683166544128, 0.0674683166544128, 0.283302302936136,
+        0.439500536182095, 0.0674683166544128, 0.0674683166544128, 0.425562830509080,
+        0.290626197200254, 0.0674683166544128, 0.0674683166544128, 0.574437169490920,
+        0.148365669627310, 0.0674683166544128, 0.0674683166544128, 0.716697697063864,
+        0.0253585825412301, 0.0674683166544128, 0.0674683166544128, 0.839704784149944,
+        -0.0674683166544128, 0.0674683166544128, 0.0674683166544128, 0.932531683345587,
+        -0.121889897567598, 0.0674683166544128, 0.0674683166544128, 0.986953264258773,
+        0.759189731754304, 0.0674683166544128, 0.160295215850056, 0.0130467357412272,
+        0.704768150841119, 0.0674683166544128, 0.160295215850056, 0.0674683166544128,
+        0.611941251645476, 0.0674683166544128, 0.160295215850056, 0.160295215850056,
+        0.488934164559396, 0.0674683166544128, 0.160295215850056, 0.283302302936136,
+        0.346673636986452, 0.0674683166544128, 0.160295215850056, 0.425562830509080,
+        0.197799298004611, 0.0674683166544128, 0.160295215850056, 0.574437169490920,
+        0.0555387704316672, 0.0674683166544128, 0.160295215850056, 0.716697697063864,
+        -0.0674683166544128, 0.0674683166544128, 0.160295215850056, 0.839704784149944,
+        -0.160295215850056, 0.0674683166544128, 0.160295215850056, 0.932531683345587,
+        -0.214716796763241, 0.0674683166544128, 0.160295215850056, 0.986953264258773,
+        0.636182644668224, 0.0674683166544128, 0.283302302936136, 0.0130467357412272,
+        0.581761063755039, 0.0674683166544128, 0.283302302936136, 0.0674683166544128,
+        0.488934164559396, 0.0674683166544128, 0.283302302936136, 0.160295215850056,
+        0.365927077473316, 0.0674683166544128, 0.283302302936136, 0.283302302936136,
+        0.223666549900372, 0.0674683166544128, 0.283302302936136, 0.425562830509080,
+        0.0747922109185311, 0.0674683166544128, 0.283302302936136, 0.574437169490920,
+        -0.0674683166544128, 0.0674683166544128, 0.283302302936136, 0.716697697063864,
+        -0.190475403740493, 0.0674683166544128, 0.283302302936136, 0.839704784149944,
+        -0.283302302936136, 0.0674683166544128, 0.283302302936136, 0.932531683345587,
+        -0.337723883849321, 0.0674683166544128, 0.283302302936136, 0.986953264258773,
+        0.493922117095281, 0.0674683166544128, 0.425562830509080, 0.0130467357412272,
+        0.439500536182095, 0.0674683166544128, 0.425562830509080, 0.0674683166544128,
+        0.346673636986452, 0.0674683166544128, 0.425562830509080, 0.160295215850056,
+        0.223666549900372, 0.0674683166544128, 0.425562830509080, 0.283302302936136,
+        0.0814060223274282, 0.0674683166544128, 0.425562830509080, 0.425562830509080,
+        -0.0674683166544128, 0.0674683166544128, 0.425562830509080, 0.574437169490920,
+        -0.209728844227357, 0.0674683166544128, 0.425562830509080, 0.716697697063864,
+        -0.332735931313437, 0.0674683166544128, 0.425562830509080, 0.839704784149944,
+        -0.425562830509080, 0.0674683166544128, 0.425562830509080, 0.932531683345587,
+        -0.479984411422265, 0.0674683166544128, 0.425562830509080, 0.986953264258773,
+        0.345047778113440, 0.0674683166544128, 0.574437169490920, 0.0130467357412272,
+        0.290626197200254, 0.0674683166544128, 0.574437169490920, 0.0674683166544128,
+        0.197799298004611, 0.0674683166544128, 0.574437169490920, 0.160295215850056,
+        0.0747922109185311, 0.0674683166544128, 0.574437169490920, 0.283302302936136,
+        -0.0674683166544128, 0.0674683166544128, 0.574437169490920, 0.425562830509080,
+        -0.216342655636254, 0.0674683166544128, 0.574437169490920, 0.574437169490920,
+        -0.358603183209198, 0.0674683166544128, 0.574437169490920, 0.716697697063864,
+        -0.481610270295278, 0.0674683166544128, 0.574437169490920, 0.839704784149944,
+        -0.574437169490920, 0.0674683166544128, 0.574437169490920, 0.932531683345587,
+        -0.628858750404106, 0.0674683166544128, 0.574437169490920, 0.986953264258773,
+        0.202787250540496, 0.0674683166544128, 0.716697697063864, 0.0130467357412272,
+        0.148365669627310, 0.0674683166544128, 0.716697697063864, 0.0674683166544128,
+        0.0555387704316672, 0.0674683166544128, 0.716697697063864, 0.160295215850056,
+        -0.0674683166544128, 0.0674683166544128, 0.716697697063864, 0.283302302936136,
+        -0.209728844227357, 0.0674683166544128, 0.716697697063864, 0.425562830509080,
+        -0.358603183209198, 0.0674683166544128, 0.716697697063864, 0.574437169490920,
+        -0.500863710782141, 0.0674683166544128, 0.716697697063864, 0.716697697063864,
+        -0.623870797868221, 0.0674683166544128, 0.716697697063864, 0.839704784149944,
+        -0.716697697063864, 0.0674683166544128, 0.716697697063864, 0.932531683345587,
+        -0.771119277977050, 0.0674683166544128, 0.716697697063864, 0.986953264258773,
+        0.0797801634544157, 0.0674683166544128, 0.839704784149944, 0.0130467357412272,
+        0.0253585825412301, 0.0674683166544128, 0.839704784149944, 0.0674683166544128,
+        -0.0674683166544128, 0.0674683166544128, 0.839704784149944, 0.160295215850056,
+        -0.190475403740493, 0.0674683166544128, 0.839704784149944, 0.283302302936136,
+        -0.332735931313437, 0.0674683166544128, 0.839704784149944, 0.425562830509080,
+        -0.481610270295278, 0.0674683166544128, 0.839704784149944, 0.574437169490920,
+        -0.623870797868221, 0.0674683166544128, 0.839704784149944, 0.716697697063864,
+        -0.746877884954301, 0.0674683166544128, 0.839704784149944, 0.839704784149944,
+        -0.839704784149944, 0.0674683166544128, 0.839704784149944, 0.932531683345587,
+        -0.894126365063130, 0.0674683166544128, 0.839704784149944, 0.986953264258773,
+        -0.0130467357412272, 0.0674683166544128, 0.932531683345587, 0.0130467357412272,
+        -0.0674683166544128, 0.0674683166544128, 0.932531683345587, 0.0674683166544128,
+        -0.160295215850056, 0.0674683166544128, 0.932531683345587, 0.160295215850056,
+        -0.283302302936136, 0.0674683166544128, 0.932531683345587, 0.283302302936136,
+        -0.425562830509080, 0.0674683166544128, 0.932531683345587, 0.425562830509080,
+        -0.574437169490920, 0.0674683166544128, 0.932531683345587, 0.574437169490920,
+        -0.716697697063864, 0.0674683166544128, 0.932531683345587, 0.716697697063864,
+        -0.839704784149944, 0.0674683166544128, 0.932531683345587, 0.839704784149944,
+        -0.932531683345587, 0.0674683166544128, 0.932531683345587, 0.932531683345587,
+        -0.986953264258773, 0.0674683166544128, 0.932531683345587, 0.986953264258773,
+        -0.0674683166544128, 0.0674683166544128, 0.986953264258773, 0.0130467357412272,
+        -0.121889897567598, 0.0674683166544128, 0.986953264258773, 0.0674683166544128,
+        -0.214716796763241, 0.0674683166544128, 0.986953264258773, 0.160295215850056,
+        -0.337723883849321, 0.0674683166544128, 0.986953264258773, 0.283302302936136,
+        -0.479984411422265, 0.0674683166544128, 0.986953264258773, 0.425562830509080,
+        -0.628858750404106, 0.0674683166544128, 0.986953264258773, 0.574437169490920,
+        -0.771119277977050, 0.0674683166544128, 0.986953264258773, 0.716697697063864,
+        -0.894126365063130, 0.0674683166544128, 0.986953264258773, 0.839704784149944,
+        -0.986953264258773, 0.0674683166544128, 0.986953264258773, 0.932531683345587,
+        -1.04137484517196, 0.0674683166544128, 0.986953264258773, 0.986953264258773,
+        0.813611312667490, 0.160295215850056, 0.0130467357412272, 0.0130467357412272,
+        0.759189731754304, 0.160295215850056, 0.0130467357412272, 0.0674683166544128,
+        0.666362832558661, 0.160295215850056, 0.0130467357412272, 0.160295215850056,
+        0.543355745472581, 0.160295215850056, 0.0130467357412272, 0.283302302936136,
+        0.401095217899638, 0.160295215850056, 0.0130467357412272, 0.425562830509080,
+        0.252220878917797, 0.160295215850056, 0.0130467357412272, 0.574437169490920,
+        0.109960351344853, 0.160295215850056, 0.0130467357412272, 0.716697697063864,
+        -0.0130467357412272, 0.160295215850056, 0.0130467357412272, 0.839704784149944,
+        -0.105873634936870, 0.160295215850056, 0.0130467357412272, 0.932531683345587,
+        -0.160295215850056, 0.160295215850056, 0.0130467357412272, 0.986953264258773,
+        0.759189731754304, 0.160295215850056, 0.0674683166544128, 0.0130467357412272,
+        0.704768150841119, 0.160295215850056, 0.0674683166544128, 0.0674683166544128,
+        0.611941251645476, 0.160295215850056, 0.0674683166544128, 0.160295215850056,
+        0.488934164559396, 0.160295215850056, 0.0674683166544128, 0.283302302936136,
+        0.346673636986452, 0.160295215850056, 0.0674683166544128, 0.425562830509080,
+        0.197799298004611, 0.160295215850056, 0.0674683166544128, 0.574437169490920,
+        0.0555387704316672, 0.160295215850056, 0.0674683166544128, 0.716697697063864,
+        -0.0674683166544128, 0.160295215850056, 0.0674683166544128, 0.839704784149944,
+        -0.160295215850056, 0.160295215850056, 0.0674683166544128, 0.932531683345587,
+        -0.214716796763241, 0.160295215850056, 0.0674683166544128, 0.986953264258773,
+        0.666362832558661, 0.160295215850056, 0.160295215850056, 0.0130467357412272,
+        0.611941251645476, 0.160295215850056, 0.160295215850056, 0.0674683166544128,
+        0.519114352449833, 0.160295215850056, 0.160295215850056, 0.160295215850056,
+        0.396107265363753, 0.160295215850056, 0.160295215850056, 0.283302302936136,
+        0.253846737790809, 0.160295215850056, 0.160295215850056, 0.425562830509080,
+        0.104972398808968, 0.160295215850056, 0.160295215850056, 0.574437169490920,
+        -0.0372881287639757, 0.160295215850056, 0.160295215850056, 0.716697697063864,
+        -0.160295215850056, 0.160295215850056, 0.160295215850056, 0.839704784149944,
+        -0.253122115045699, 0.160295215850056, 0.160295215850056, 0.932531683345587,
+        -0.307543695958884, 0.160295215850056, 0.160295215850056, 0.986953264258773,
+        0.543355745472581, 0.160295215850056, 0.283302302936136, 0.0130467357412272,
+        0.488934164559396, 0.160295215850056, 0.283302302936136, 0.0674683166544128,
+        0.396107265363753, 0.160295215850056, 0.283302302936136, 0.160295215850056,
+        0.273100178277673, 0.160295215850056, 0.283302302936136, 0.283302302936136,
+        0.130839650704729, 0.160295215850056, 0.283302302936136, 0.425562830509080,
+        -0.0180346882771119, 0.160295215850056, 0.283302302936136, 0.574437169490920,
+        -0.160295215850056, 0.160295215850056, 0.283302302936136, 0.716697697063864,
+        -0.283302302936136, 0.160295215850056, 0.283302302936136, 0.839704784149944,
+        -0.376129202131779, 0.160295215850056, 0.283302302936136, 0.932531683345587,
+        -0.430550783044964, 0.160295215850056, 0.283302302936136, 0.986953264258773,
+        0.401095217899638, 0.160295215850056, 0.425562830509080, 0.0130467357412272,
+        0.346673636986452, 0.160295215850056, 0.425562830509080, 0.0674683166544128,
+        0.253846737790809, 0.160295215850056, 0.425562830509080, 0.160295215850056,
+        0.130839650704729, 0.160295215850056, 0.425562830509080, 0.283302302936136,
+        -0.0114208768682147, 0.160295215850056, 0.425562830509080, 0.425562830509080,
+        -0.160295215850056, 0.160295215850056, 0.425562830509080, 0.574437169490920,
+        -0.302555743423000, 0.160295215850056, 0.425562830509080, 0.716697697063864,
+        -0.425562830509080, 0.160295215850056, 0.425562830509080, 0.839704784149944,
+        -0.518389729704722, 0.160295215850056, 0.425562830509080, 0.932531683345587,
+        -0.572811310617908, 0.160295215850056, 0.425562830509080, 0.986953264258773,
+        0.252220878917797, 0.160295215850056, 0.574437169490920, 0.0130467357412272,
+        0.197799298004611, 0.160295215850056, 0.574437169490920, 0.0674683166544128,
+        0.104972398808968, 0.160295215850056, 0.574437169490920, 0.160295215850056,
+        -0.0180346882771119, 0.160295215850056, 0.574437169490920, 0.283302302936136,
+        -0.160295215850056, 0.160295215850056, 0.574437169490920, 0.425562830509080,
+        -0.309169554831897, 0.160295215850056, 0.574437169490920, 0.574437169490920,
+        -0.451430082404841, 0.160295215850056, 0.574437169490920, 0.716697697063864,
+        -0.574437169490920, 0.160295215850056, 0.574437169490920, 0.839704784149944,
+        -0.667264068686563, 0.160295215850056, 0.574437169490920, 0.932531683345587,
+        -0.721685649599749, 0.160295215850056, 0.574437169490920, 0.986953264258773,
+        0.109960351344853, 0.160295215850056, 0.716697697063864, 0.0130467357412272,
+        0.0555387704316672, 0.160295215850056, 0.716697697063864, 0.0674683166544128,
+        -0.0372881287639757, 0.160295215850056, 0.716697697063864, 0.160295215850056,
+        -0.160295215850056, 0.160295215850056, 0.716697697063864, 0.283302302936136,
+        -0.302555743423000, 0.160295215850056, 0.716697697063864, 0.425562830509080,
+        -0.451430082404841, 0.160295215850056, 0.716697697063864, 0.574437169490920,
+        -0.593690609977784, 0.160295215850056, 0.716697697063864, 0.716697697063864,
+        -0.716697697063864, 0.160295215850056, 0.716697697063864, 0.839704784149944,
+        -0.809524596259507, 0.160295215850056, 0.716697697063864, 0.932531683345587,
+        -0.863946177172693, 0.160295215850056, 0.716697697063864, 0.986953264258773,
+        -0.0130467357412272, 0.160295215850056, 0.839704784149944, 0.0130467357412272,
+        -0.0674683166544128, 0.160295215850056, 0.839704784149944, 0.0674683166544128,
+        -0.160295215850056, 0.160295215850056, 0.839704784149944, 0.160295215850056,
+        -0.283302302936136, 0.160295215850056, 0.839704784149944, 0.283302302936136,
+        -0.425562830509080, 0.160295215850056, 0.839704784149944, 0.425562830509080,
+        -0.574437169490920, 0.160295215850056, 0.839704784149944, 0.574437169490920,
+        -0.716697697063864, 0.160295215850056, 0.839704784149944, 0.716697697063864,
+        -0.839704784149944, 0.160295215850056, 0.839704784149944, 0.839704784149944,
+        -0.932531683345587, 0.160295215850056, 0.839704784149944, 0.932531683345587,
+        -0.986953264258773, 0.160295215850056, 0.839704784149944, 0.986953264258773,
+        -0.105873634936870, 0.160295215850056, 0.932531683345587, 0.0130467357412272,
+        -0.160295215850056, 0.160295215850056, 0.932531683345587, 0.0674683166544128,
+        -0.253122115045699, 0.160295215850056, 0.932531683345587, 0.160295215850056,
+        -0.376129202131779, 0.160295215850056, 0.932531683345587, 0.283302302936136,
+        -0.518389729704722, 0.160295215850056, 0.932531683345587, 0.425562830509080,
+        -0.667264068686563, 0.160295215850056, 0.932531683345587, 0.574437169490920,
+        -0.809524596259507, 0.160295215850056, 0.932531683345587, 0.716697697063864,
+        -0.932531683345587, 0.160295215850056, 0.932531683345587, 0.839704784149944,
+        -1.02535858254123, 0.160295215850056, 0.932531683345587, 0.932531683345587,
+        -1.07978016345442, 0.160295215850056, 0.932531683345587, 0.986953264258773,
+        -0.160295215850056, 0.160295215850056, 0.986953264258773, 0.0130467357412272,
+        -0.214716796763241, 0.160295215850056, 0.986953264258773, 0.0674683166544128,
+        -0.307543695958884, 0.160295215850056, 0.986953264258773, 0.160295215850056,
+        -0.430550783044964, 0.160295215850056, 0.986953264258773, 0.283302302936136,
+        -0.572811310617908, 0.160295215850056, 0.986953264258773, 0.425562830509080,
+        -0.721685649599749, 0.160295215850056, 0.986953264258773, 0.574437169490920,
+        -0.863946177172693, 0.160295215850056, 0.986953264258773, 0.716697697063864,
+        -0.986953264258773, 0.160295215850056, 0.986953264258773, 0.839704784149944,
+        -1.07978016345442, 0.160295215850056, 0.986953264258773, 0.932531683345587,
+        -1.13420174436760, 0.160295215850056, 0.986953264258773, 0.986953264258773,
+        0.690604225581410, 0.283302302936136, 0.0130467357412272, 0.0130467357412272,
+        0.636182644668224, 0.283302302936136, 0.0130467357412272, 0.0674683166544128,
+        0.543355745472581, 0.283302302936136, 0.0130467357412272, 0.160295215850056,
+        0.420348658386501, 0.283302302936136, 0.0130467357412272, 0.283302302936136,
+        0.278088130813558, 0.283302302936136, 0.0130467357412272, 0.425562830509080,
+        0.129213791831717, 0.283302302936136, 0.0130467357412272, 0.574437169490920,
+        -0.0130467357412272, 0.283302302936136, 0.0130467357412272, 0.716697697063864,
+        -0.136053822827307, 0.283302302936136, 0.0130467357412272, 0.839704784149944,
+        -0.228880722022950, 0.283302302936136, 0.0130467357412272, 0.932531683345587,
+        -0.283302302936136, 0.283302302936136, 0.0130467357412272, 0.986953264258773,
+        0.636182644668224, 0.283302302936136, 0.0674683166544128, 0.0130467357412272,
+        0.581761063755039, 0.283302302936136, 0.0674683166544128, 0.0674683166544128,
+        0.488934164559396, 0.283302302936136, 0.0674683166544128, 0.160295215850056,
+        0.365927077473316, 0.283302302936136, 0.0674683166544128, 0.283302302936136,
+        0.223666549900372, 0.283302302936136, 0.0674683166544128, 0.425562830509080,
+        0.0747922109185311, 0.283302302936136, 0.0674683166544128, 0.574437169490920,
+        -0.0674683166544128, 0.283302302936136, 0.0674683166544128, 0.716697697063864,
+        -0.190475403740493, 0.283302302936136, 0.0674683166544128, 0.839704784149944,
+        -0.283302302936136, 0.283302302936136, 0.0674683166544128, 0.932531683345587,
+        -0.337723883849321, 0.283302302936136, 0.0674683166544128, 0.986953264258773,
+        0.543355745472581, 0.283302302936136, 0.160295215850056, 0.0130467357412272,
+        0.488934164559396, 0.283302302936136, 0.160295215850056, 0.0674683166544128,
+        0.396107265363753, 0.283302302936136, 0.160295215850056, 0.160295215850056,
+        0.273100178277673, 0.283302302936136, 0.160295215850056, 0.283302302936136,
+        0.130839650704729, 0.283302302936136, 0.160295215850056, 0.425562830509080,
+        -0.0180346882771119, 0.283302302936136, 0.160295215850056, 0.574437169490920,
+        -0.160295215850056, 0.283302302936136, 0.160295215850056, 0.716697697063864,
+        -0.283302302936136, 0.283302302936136, 0.160295215850056, 0.839704784149944,
+        -0.376129202131779, 0.283302302936136, 0.160295215850056, 0.932531683345587,
+        -0.430550783044964, 0.283302302936136, 0.160295215850056, 0.986953264258773,
+        0.420348658386501, 0.283302302936136, 0.283302302936136, 0.0130467357412272,
+        0.365927077473316, 0.283302302936136, 0.283302302936136, 0.0674683166544128,
+        0.273100178277673, 0.283302302936136, 0.283302302936136, 0.160295215850056,
+        0.150093091191593, 0.283302302936136, 0.283302302936136, 0.283302302936136,
+        0.00783256361864915, 0.283302302936136, 0.283302302936136, 0.425562830509080,
+        -0.141041775363192, 0.283302302936136, 0.283302302936136, 0.574437169490920,
+        -0.283302302936136, 0.283302302936136, 0.283302302936136, 0.716697697063864,
+        -0.406309390022216, 0.283302302936136, 0.283302302936136, 0.839704784149944,
+        -0.499136289217859, 0.283302302936136, 0.283302302936136, 0.932531683345587,
+        -0.553557870131044, 0.283302302936136, 0.283302302936136, 0.986953264258773,
+        0.278088130813558, 0.283302302936136, 0.425562830509080, 0.0130467357412272,
+        0.223666549900372, 0.283302302936136, 0.425562830509080, 0.0674683166544128,
+        0.130839650704729, 0.283302302936136, 0.425562830509080, 0.160295215850056,
+        0.00783256361864915, 0.283302302936136, 0.425562830509080, 0.283302302936136,
+        -0.134427963954295, 0.283302302936136, 0.425562830509080, 0.425562830509080,
+        -0.283302302936136, 0.283302302936136, 0.425562830509080, 0.574437169490920,
+        -0.425562830509080, 0.283302302936136, 0.425562830509080, 0.716697697063864,
+        -0.548569917595159, 0.283302302936136, 0.425562830509080, 0.839704784149944,
+        -0.641396816790802, 0.283302302936136, 0.425562830509080, 0.932531683345587,
+        -0.695818397703988, 0.283302302936136, 0.425562830509080, 0.986953264258773,
+        0.129213791831717, 0.283302302936136, 0.574437169490920, 0.0130467357412272,
+        0.0747922109185311, 0.283302302936136, 0.574437169490920, 0.0674683166544128,
+        -0.0180346882771119, 0.283302302936136, 0.574437169490920, 0.160295215850056,
+        -0.141041775363192, 0.283302302936136, 0.574437169490920, 0.283302302936136,
+        -0.283302302936136, 0.283302302936136, 0.574437169490920, 0.425562830509080,
+        -0.432176641917977, 0.283302302936136, 0.574437169490920, 0.574437169490920,
+        -0.574437169490920, 0.283302302936136, 0.574437169490920, 0.716697697063864,
+        -0.697444256577000, 0.283302302936136, 0.574437169490920, 0.839704784149944,
+        -0.790271155772643, 0.283302302936136, 0.574437169490920, 0.932531683345587,
+        -0.844692736685829, 0.283302302936136, 0.574437169490920, 0.986953264258773,
+        -0.0130467357412272, 0.283302302936136, 0.716697697063864, 0.0130467357412272,
+        -0.0674683166544128, 0.283302302936136, 0.716697697063864, 0.0674683166544128,
+        -0.160295215850056, 0.283302302936136, 0.716697697063864, 0.160295215850056,
+        -0.283302302936136, 0.283302302936136, 0.716697697063864, 0.283302302936136,
+        -0.425562830509080, 0.283302302936136, 0.716697697063864, 0.425562830509080,
+        -0.574437169490920, 0.283302302936136, 0.716697697063864, 0.574437169490920,
+        -0.716697697063864, 0.283302302936136, 0.716697697063864, 0.716697697063864,
+        -0.839704784149944, 0.283302302936136, 0.716697697063864, 0.839704784149944,
+        -0.932531683345587, 0.283302302936136, 0.716697697063864, 0.932531683345587,
+        -0.986953264258773, 0.283302302936136, 0.716697697063864, 0.986953264258773,
+        -0.136053822827307, 0.283302302936136, 0.839704784149944, 0.0130467357412272,
+        -0.190475403740493, 0.283302302936136, 0.839704784149944, 0.0674683166544128,
+        -0.283302302936136, 0.283302302936136, 0.839704784149944, 0.160295215850056,
+        -0.406309390022216, 0.283302302936136, 0.839704784149944, 0.283302302936136,
+        -0.548569917595159, 0.283302302936136, 0.839704784149944, 0.425562830509080,
+        -0.697444256577000, 0.283302302936136, 0.839704784149944, 0.574437169490920,
+        -0.839704784149944, 0.283302302936136, 0.839704784149944, 0.716697697063864,
+        -0.962711871236024, 0.283302302936136, 0.839704784149944, 0.839704784149944,
+        -1.05553877043167, 0.283302302936136, 0.839704784149944, 0.932531683345587,
+        -1.10996035134485, 0.283302302936136, 0.839704784149944, 0.986953264258773,
+        -0.228880722022950, 0.283302302936136, 0.932531683345587, 0.0130467357412272,
+        -0.283302302936136, 0.283302302936136, 0.932531683345587, 0.0674683166544128,
+        -0.376129202131779, 0.283302302936136, 0.932531683345587, 0.160295215850056,
+        -0.499136289217859, 0.283302302936136, 0.932531683345587, 0.283302302936136,
+        -0.641396816790802, 0.283302302936136, 0.932531683345587, 0.425562830509080,
+        -0.790271155772643, 0.283302302936136, 0.932531683345587, 0.574437169490920,
+        -0.932531683345587, 0.283302302936136, 0.932531683345587, 0.716697697063864,
+        -1.05553877043167, 0.283302302936136, 0.932531683345587, 0.839704784149944,
+        -1.14836566962731, 0.283302302936136, 0.932531683345587, 0.932531683345587,
+        -1.20278725054050, 0.283302302936136, 0.932531683345587, 0.986953264258773,
+        -0.283302302936136, 0.283302302936136, 0.986953264258773, 0.0130467357412272,
+        -0.337723883849321, 0.283302302936136, 0.986953264258773, 0.0674683166544128,
+        -0.430550783044964, 0.283302302936136, 0.986953264258773, 0.160295215850056,
+        -0.553557870131044, 0.283302302936136, 0.986953264258773, 0.283302302936136,
+        -0.695818397703988, 0.283302302936136, 0.986953264258773, 0.425562830509080,
+        -0.844692736685829, 0.283302302936136, 0.986953264258773, 0.574437169490920,
+        -0.986953264258773, 0.283302302936136, 0.986953264258773, 0.716697697063864,
+        -1.10996035134485, 0.283302302936136, 0.986953264258773, 0.839704784149944,
+        -1.20278725054050, 0.283302302936136, 0.986953264258773, 0.932531683345587,
+        -1.25720883145368, 0.283302302936136, 0.986953264258773, 0.986953264258773,
+        0.548343698008466, 0.425562830509080, 0.0130467357412272, 0.0130467357412272,
+        0.493922117095281, 0.425562830509080, 0.0130467357412272, 0.0674683166544128,
+        0.401095217899638, 0.425562830509080, 0.0130467357412272, 0.160295215850056,
+        0.278088130813558, 0.425562830509080, 0.0130467357412272, 0.283302302936136,
+        0.135827603240614, 0.425562830509080, 0.0130467357412272, 0.425562830509080,
+        -0.0130467357412272, 0.425562830509080, 0.0130467357412272, 0.574437169490920,
+        -0.155307263314171, 0.425562830509080, 0.0130467357412272, 0.716697697063864,
+        -0.278314350400251, 0.425562830509080, 0.0130467357412272, 0.839704784149944,
+        -0.371141249595894, 0.425562830509080, 0.0130467357412272, 0.932531683345587,
+        -0.425562830509080, 0.425562830509080, 0.0130467357412272, 0.986953264258773,
+        0.493922117095281, 0.425562830509080, 0.0674683166544128, 0.0130467357412272,
+        0.439500536182095, 0.425562830509080, 0.0674683166544128, 0.0674683166544128,
+        0.346673636986452, 0.425562830509080, 0.0674683166544128, 0.160295215850056,
+        0.223666549900372, 0.425562830509080, 0.0674683166544128, 0.283302302936136,
+        0.0814060223274282, 0.425562830509080, 0.0674683166544128, 0.425562830509080,
+        -0.0674683166544128, 0.425562830509080, 0.0674683166544128, 0.574437169490920,
+        -0.209728844227357, 0.425562830509080, 0.0674683166544128, 0.716697697063864,
+        -0.332735931313437, 0.425562830509080, 0.0674683166544128, 0.839704784149944,
+        -0.425562830509080, 0.425562830509080, 0.0674683166544128, 0.932531683345587,
+        -0.479984411422265, 0.425562830509080, 0.0674683166544128, 0.986953264258773,
+        0.401095217899638, 0.425562830509080, 0.160295215850056, 0.0130467357412272,
+        0.346673636986452, 0.425562830509080, 0.160295215850056, 0.0674683166544128,
+        0.253846737790809, 0.425562830509080, 0.160295215850056, 0.160295215850056,
+        0.130839650704729, 0.425562830509080, 0.160295215850056, 0.283302302936136,
+        -0.0114208768682147, 0.425562830509080, 0.160295215850056, 0.425562830509080,
+        -0.160295215850056, 0.425562830509080, 0.160295215850056, 0.574437169490920,
+        -0.302555743423000, 0.425562830509080, 0.160295215850056, 0.716697697063864,
+        -0.425562830509080, 0.425562830509080, 0.160295215850056, 0.839704784149944,
+        -0.518389729704722, 0.425562830509080, 0.160295215850056, 0.932531683345587,
+        -0.572811310617908, 0.425562830509080, 0.160295215850056, 0.986953264258773,
+        0.278088130813558, 0.425562830509080, 0.283302302936136, 0.0130467357412272,
+        0.223666549900372, 0.425562830509080, 0.283302302936136, 0.0674683166544128,
+        0.130839650704729, 0.425562830509080, 0.283302302936136, 0.160295215850056,
+        0.00783256361864915, 0.425562830509080, 0.283302302936136, 0.283302302936136,
+        -0.134427963954295, 0.425562830509080, 0.283302302936136, 0.425562830509080,
+        -0.283302302936136, 0.425562830509080, 0.283302302936136, 0.574437169490920,
+        -0.425562830509080, 0.425562830509080, 0.283302302936136, 0.716697697063864,
+        -0.548569917595159, 0.425562830509080, 0.283302302936136, 0.839704784149944,
+        -0.641396816790802, 0.425562830509080, 0.283302302936136, 0.932531683345587,
+        -0.695818397703988, 0.425562830509080, 0.283302302936136, 0.986953264258773,
+        0.135827603240614, 0.425562830509080, 0.425562830509080, 0.0130467357412272,
+        0.0814060223274282, 0.425562830509080, 0.425562830509080, 0.0674683166544128,
+        -0.0114208768682147, 0.425562830509080, 0.425562830509080, 0.160295215850056,
+        -0.134427963954295, 0.425562830509080, 0.425562830509080, 0.283302302936136,
+        -0.276688491527239, 0.425562830509080, 0.425562830509080, 0.425562830509080,
+        -0.425562830509080, 0.425562830509080, 0.425562830509080, 0.574437169490920,
+        -0.567823358082023, 0.425562830509080, 0.425562830509080, 0.716697697063864,
+        -0.690830445168103, 0.425562830509080, 0.425562830509080, 0.839704784149944,
+        -0.783657344363746, 0.425562830509080, 0.425562830509080, 0.932531683345587,
+        -0.838078925276932, 0.425562830509080, 0.425562830509080, 0.986953264258773,
+        -0.0130467357412272, 0.425562830509080, 0.574437169490920, 0.0130467357412272,
+        -0.0674683166544128, 0.425562830509080, 0.574437169490920, 0.0674683166544128,
+        -0.160295215850056, 0.425562830509080, 0.574437169490920, 0.160295215850056,
+        -0.283302302936136, 0.425562830509080, 0.574437169490920, 0.283302302936136,
+        -0.425562830509080, 0.425562830509080, 0.574437169490920, 0.425562830509080,
+        -0.574437169490920, 0.425562830509080, 0.574437169490920, 0.574437169490920,
+        -0.716697697063864, 0.425562830509080, 0.574437169490920, 0.716697697063864,
+        -0.839704784149944, 0.425562830509080, 0.574437169490920, 0.839704784149944,
+        -0.932531683345587, 0.425562830509080, 0.574437169490920, 0.932531683345587,
+        -0.986953264258773, 0.425562830509080, 0.574437169490920, 0.986953264258773,
+        -0.155307263314171, 0.425562830509080, 0.716697697063864, 0.0130467357412272,
+        -0.209728844227357, 0.425562830509080, 0.716697697063864, 0.0674683166544128,
+        -0.302555743423000, 0.425562830509080, 0.716697697063864, 0.160295215850056,
+        -0.425562830509080, 0.425562830509080, 0.716697697063864, 0.283302302936136,
+        -0.567823358082023, 0.425562830509080, 0.716697697063864, 0.425562830509080,
+        -0.716697697063864, 0.425562830509080, 0.716697697063864, 0.574437169490920,
+        -0.858958224636808, 0.425562830509080, 0.716697697063864, 0.716697697063864,
+        -0.981965311722888, 0.425562830509080, 0.716697697063864, 0.839704784149944,
+        -1.07479221091853, 0.425562830509080, 0.716697697063864, 0.932531683345587,
+        -1.12921379183172, 0.425562830509080, 0.716697697063864, 0.986953264258773,
+        -0.278314350400251, 0.425562830509080, 0.839704784149944, 0.0130467357412272,
+        -0.332735931313437, 0.425562830509080, 0.839704784149944, 0.0674683166544128,
+        -0.425562830509080, 0.425562830509080, 0.839704784149944, 0.160295215850056,
+        -0.548569917595159, 0.425562830509080, 0.839704784149944, 0.283302302936136,
+        -0.690830445168103, 0.425562830509080, 0.839704784149944, 0.425562830509080,
+        -0.839704784149944, 0.425562830509080, 0.839704784149944, 0.574437169490920,
+        -0.981965311722888, 0.425562830509080, 0.839704784149944, 0.716697697063864,
+        -1.10497239880897, 0.425562830509080, 0.839704784149944, 0.839704784149944,
+        -1.19779929800461, 0.425562830509080, 0.839704784149944, 0.932531683345587,
+        -1.25222087891780, 0.425562830509080, 0.839704784149944, 0.986953264258773,
+        -0.371141249595894, 0.425562830509080, 0.932531683345587, 0.0130467357412272,
+        -0.425562830509080, 0.425562830509080, 0.932531683345587, 0.0674683166544128,
+        -0.518389729704722, 0.425562830509080, 0.932531683345587, 0.160295215850056,
+        -0.641396816790802, 0.425562830509080, 0.932531683345587, 0.283302302936136,
+        -0.783657344363746, 0.425562830509080, 0.932531683345587, 0.425562830509080,
+        -0.932531683345587, 0.425562830509080, 0.932531683345587, 0.574437169490920,
+        -1.07479221091853, 0.425562830509080, 0.932531683345587, 0.716697697063864,
+        -1.19779929800461, 0.425562830509080, 0.932531683345587, 0.839704784149944,
+        -1.29062619720025, 0.425562830509080, 0.932531683345587, 0.932531683345587,
+        -1.34504777811344, 0.425562830509080, 0.932531683345587, 0.986953264258773,
+        -0.425562830509080, 0.425562830509080, 0.986953264258773, 0.0130467357412272,
+        -0.479984411422265, 0.425562830509080, 0.986953264258773, 0.0674683166544128,
+        -0.572811310617908, 0.425562830509080, 0.986953264258773, 0.160295215850056,
+        -0.695818397703988, 0.425562830509080, 0.986953264258773, 0.283302302936136,
+        -0.838078925276932, 0.425562830509080, 0.986953264258773, 0.425562830509080,
+        -0.986953264258773, 0.425562830509080, 0.986953264258773, 0.574437169490920,
+        -1.12921379183172, 0.425562830509080, 0.986953264258773, 0.716697697063864,
+        -1.25222087891780, 0.425562830509080, 0.986953264258773, 0.839704784149944,
+        -1.34504777811344, 0.425562830509080, 0.986953264258773, 0.932531683345587,
+        -1.39946935902663, 0.425562830509080, 0.986953264258773, 0.986953264258773,
+        0.399469359026625, 0.574437169490920, 0.0130467357412272, 0.0130467357412272,
+        0.345047778113440, 0.574437169490920, 0.0130467357412272, 0.0674683166544128,
+        0.252220878917797, 0.574437169490920, 0.0130467357412272, 0.160295215850056,
+        0.129213791831717, 0.574437169490920, 0.0130467357412272, 0.283302302936136,
+        -0.0130467357412272, 0.574437169490920, 0.0130467357412272, 0.425562830509080,
+        -0.161921074723068, 0.574437169490920, 0.0130467357412272, 0.574437169490920,
+        -0.304181602296012, 0.574437169490920, 0.0130467357412272, 0.716697697063864,
+        -0.427188689382092, 0.574437169490920, 0.0130467357412272, 0.839704784149944,
+        -0.520015588577735, 0.574437169490920, 0.0130467357412272, 0.932531683345587,
+        -0.574437169490920, 0.574437169490920, 0.0130467357412272, 0.986953264258773,
+        0.345047778113440, 0.574437169490920, 0.0674683166544128, 0.0130467357412272,
+        0.290626197200254, 0.574437169490920, 0.0674683166544128, 0.0674683166544128,
+        0.197799298004611, 0.574437169490920, 0.0674683166544128, 0.160295215850056,
+        0.0747922109185311, 0.574437169490920, 0.0674683166544128, 0.283302302936136,
+        -0.0674683166544128, 0.574437169490920, 0.0674683166544128, 0.425562830509080,
+        -0.216342655636254, 0.574437169490920, 0.0674683166544128, 0.574437169490920,
+        -0.358603183209198, 0.574437169490920, 0.0674683166544128, 0.716697697063864,
+        -0.481610270295278, 0.574437169490920, 0.0674683166544128, 0.839704784149944,
+        -0.574437169490920, 0.574437169490920, 0.0674683166544128, 0.932531683345587,
+        -0.628858750404106, 0.574437169490920, 0.0674683166544128, 0.986953264258773,
+        0.252220878917797, 0.574437169490920, 0.160295215850056, 0.0130467357412272,
+        0.197799298004611, 0.574437169490920, 0.160295215850056, 0.0674683166544128,
+        0.104972398808968, 0.574437169490920, 0.160295215850056, 0.160295215850056,
+        -0.0180346882771119, 0.574437169490920, 0.160295215850056, 0.283302302936136,
+        -0.160295215850056, 0.574437169490920, 0.160295215850056, 0.425562830509080,
+        -0.309169554831897, 0.574437169490920, 0.160295215850056, 0.574437169490920,
+        -0.451430082404841, 0.574437169490920, 0.160295215850056, 0.716697697063864,
+        -0.574437169490920, 0.574437169490920, 0.160295215850056, 0.839704784149944,
+        -0.667264068686563, 0.574437169490920, 0.160295215850056, 0.932531683345587,
+        -0.721685649599749, 0.574437169490920, 0.160295215850056, 0.986953264258773,
+        0.129213791831717, 0.574437169490920, 0.283302302936136, 0.0130467357412272,
+        0.0747922109185311, 0.574437169490920, 0.283302302936136, 0.0674683166544128,
+        -0.0180346882771119, 0.574437169490920, 0.283302302936136, 0.160295215850056,
+        -0.141041775363192, 0.574437169490920, 0.283302302936136, 0.283302302936136,
+        -0.283302302936136, 0.574437169490920, 0.283302302936136, 0.425562830509080,
+        -0.432176641917977, 0.574437169490920, 0.283302302936136, 0.574437169490920,
+        -0.574437169490920, 0.574437169490920, 0.283302302936136, 0.716697697063864,
+        -0.697444256577000, 0.574437169490920, 0.283302302936136, 0.839704784149944,
+        -0.790271155772643, 0.574437169490920, 0.283302302936136, 0.932531683345587,
+        -0.844692736685829, 0.574437169490920, 0.283302302936136, 0.986953264258773,
+        -0.0130467357412272, 0.574437169490920, 0.425562830509080, 0.0130467357412272,
+        -0.0674683166544128, 0.574437169490920, 0.425562830509080, 0.0674683166544128,
+        -0.160295215850056, 0.574437169490920, 0.425562830509080, 0.160295215850056,
+        -0.283302302936136, 0.574437169490920, 0.425562830509080, 0.283302302936136,
+        -0.425562830509080, 0.574437169490920, 0.425562830509080, 0.425562830509080,
+        -0.574437169490920, 0.574437169490920, 0.425562830509080, 0.574437169490920,
+        -0.716697697063864, 0.574437169490920, 0.425562830509080, 0.716697697063864,
+        -0.839704784149944, 0.574437169490920, 0.425562830509080, 0.839704784149944,
+        -0.932531683345587, 0.574437169490920, 0.425562830509080, 0.932531683345587,
+        -0.986953264258773, 0.574437169490920, 0.425562830509080, 0.986953264258773,
+        -0.161921074723068, 0.574437169490920, 0.574437169490920, 0.0130467357412272,
+        -0.216342655636254, 0.574437169490920, 0.574437169490920, 0.0674683166544128,
+        -0.309169554831897, 0.574437169490920, 0.574437169490920, 0.160295215850056,
+        -0.432176641917977, 0.574437169490920, 0.574437169490920, 0.283302302936136,
+        -0.574437169490920, 0.574437169490920, 0.574437169490920, 0.425562830509080,
+        -0.723311508472761, 0.574437169490920, 0.574437169490920, 0.574437169490920,
+        -0.865572036045705, 0.574437169490920, 0.574437169490920, 0.716697697063864,
+        -0.988579123131785, 0.574437169490920, 0.574437169490920, 0.839704784149944,
+        -1.08140602232743, 0.574437169490920, 0.574437169490920, 0.932531683345587,
+        -1.13582760324061, 0.574437169490920, 0.574437169490920, 0.986953264258773,
+        -0.304181602296012, 0.574437169490920, 0.716697697063864, 0.0130467357412272,
+        -0.358603183209198, 0.574437169490920, 0.716697697063864, 0.0674683166544128,
+        -0.451430082404841, 0.574437169490920, 0.716697697063864, 0.160295215850056,
+        -0.574437169490920, 0.574437169490920, 0.716697697063864, 0.283302302936136,
+        -0.716697697063864, 0.574437169490920, 0.716697697063864, 0.425562830509080,
+        -0.865572036045705, 0.574437169490920, 0.716697697063864, 0.574437169490920,
+        -1.00783256361865, 0.574437169490920, 0.716697697063864, 0.716697697063864,
+        -1.13083965070473, 0.574437169490920, 0.716697697063864, 0.839704784149944,
+        -1.22366654990037, 0.574437169490920, 0.716697697063864, 0.932531683345587,
+        -1.27808813081356, 0.574437169490920, 0.716697697063864, 0.986953264258773,
+        -0.427188689382092, 0.574437169490920, 0.839704784149944, 0.0130467357412272,
+        -0.481610270295278, 0.574437169490920, 0.839704784149944, 0.0674683166544128,
+        -0.574437169490920, 0.574437169490920, 0.839704784149944, 0.160295215850056,
+        -0.697444256577000, 0.574437169490920, 0.839704784149944, 0.283302302936136,
+        -0.839704784149944, 0.574437169490920, 0.839704784149944, 0.425562830509080,
+        -0.988579123131785, 0.574437169490920, 0.839704784149944, 0.574437169490920,
+        -1.13083965070473, 0.574437169490920, 0.839704784149944, 0.716697697063864,
+        -1.25384673779081, 0.574437169490920, 0.839704784149944, 0.839704784149944,
+        -1.34667363698645, 0.574437169490920, 0.839704784149944, 0.932531683345587,
+        -1.40109521789964, 0.574437169490920, 0.839704784149944, 0.986953264258773,
+        -0.520015588577735, 0.574437169490920, 0.932531683345587, 0.0130467357412272,
+        -0.574437169490920, 0.574437169490920, 0.932531683345587, 0.0674683166544128,
+        -0.667264068686563, 0.574437169490920, 0.932531683345587, 0.160295215850056,
+        -0.790271155772643, 0.574437169490920, 0.932531683345587, 0.283302302936136,
+        -0.932531683345587, 0.574437169490920, 0.932531683345587, 0.425562830509080,
+        -1.08140602232743, 0.574437169490920, 0.932531683345587, 0.574437169490920,
+        -1.22366654990037, 0.574437169490920, 0.932531683345587, 0.716697697063864,
+        -1.34667363698645, 0.574437169490920, 0.932531683345587, 0.839704784149944,
+        -1.43950053618209, 0.574437169490920, 0.932531683345587, 0.932531683345587,
+        -1.49392211709528, 0.574437169490920, 0.932531683345587, 0.986953264258773,
+        -0.574437169490920, 0.574437169490920, 0.986953264258773, 0.0130467357412272,
+        -0.628858750404106, 0.574437169490920, 0.986953264258773, 0.0674683166544128,
+        -0.721685649599749, 0.574437169490920, 0.986953264258773, 0.160295215850056,
+        -0.844692736685829, 0.574437169490920, 0.986953264258773, 0.283302302936136,
+        -0.986953264258773, 0.574437169490920, 0.986953264258773, 0.425562830509080,
+        -1.13582760324061, 0.574437169490920, 0.986953264258773, 0.574437169490920,
+        -1.27808813081356, 0.574437169490920, 0.986953264258773, 0.716697697063864,
+        -1.40109521789964, 0.574437169490920, 0.986953264258773, 0.839704784149944,
+        -1.49392211709528, 0.574437169490920, 0.986953264258773, 0.932531683345587,
+        -1.54834369800847, 0.574437169490920, 0.986953264258773, 0.986953264258773,
+        0.257208831453681, 0.716697697063864, 0.0130467357412272, 0.0130467357412272,
+        0.202787250540496, 0.716697697063864, 0.0130467357412272, 0.0674683166544128,
+        0.109960351344853, 0.716697697063864, 0.0130467357412272, 0.160295215850056,
+        -0.0130467357412272, 0.716697697063864, 0.0130467357412272, 0.283302302936136,
+        -0.155307263314171, 0.716697697063864, 0.0130467357412272, 0.425562830509080,
+        -0.304181602296012, 0.716697697063864, 0.0130467357412272, 0.574437169490920,
+        -0.446442129868956, 0.716697697063864, 0.0130467357412272, 0.716697697063864,
+        -0.569449216955036, 0.716697697063864, 0.0130467357412272, 0.839704784149944,
+        -0.662276116150679, 0.716697697063864, 0.0130467357412272, 0.932531683345587,
+        -0.716697697063864, 0.716697697063864, 0.0130467357412272, 0.986953264258773,
+        0.202787250540496, 0.716697697063864, 0.0674683166544128, 0.0130467357412272,
+        0.148365669627310, 0.716697697063864, 0.0674683166544128, 0.0674683166544128,
+        0.0555387704316672, 0.716697697063864, 0.0674683166544128, 0.160295215850056,
+        -0.0674683166544128, 0.716697697063864, 0.0674683166544128, 0.283302302936136,
+        -0.209728844227357, 0.716697697063864, 0.0674683166544128, 0.425562830509080,
+        -0.358603183209198, 0.716697697063864, 0.0674683166544128, 0.574437169490920,
+        -0.500863710782141, 0.716697697063864, 0.0674683166544128, 0.716697697063864,
+        -0.623870797868221, 0.716697697063864, 0.0674683166544128, 0.839704784149944,
+        -0.716697697063864, 0.716697697063864, 0.0674683166544128, 0.932531683345587,
+        -0.771119277977050, 0.716697697063864, 0.0674683166544128, 0.986953264258773,
+        0.109960351344853, 0.716697697063864, 0.160295215850056, 0.0130467357412272,
+        0.0555387704316672, 0.716697697063864, 0.160295215850056, 0.0674683166544128,
+        -0.0372881287639757, 0.716697697063864, 0.160295215850056, 0.160295215850056,
+        -0.160295215850056, 0.716697697063864, 0.160295215850056, 0.283302302936136,
+        -0.302555743423000, 0.716697697063864, 0.160295215850056, 0.425562830509080,
+        -0.451430082404841, 0.716697697063864, 0.160295215850056, 0.574437169490920,
+        -0.593690609977784, 0.716697697063864, 0.160295215850056, 0.716697697063864,
+        -0.716697697063864, 0.716697697063864, 0.160295215850056, 0.839704784149944,
+        -0.809524596259507, 0.716697697063864, 0.160295215850056, 0.932531683345587,
+        -0.863946177172693, 0.716697697063864, 0.160295215850056, 0.986953264258773,
+        -0.0130467357412272, 0.716697697063864, 0.283302302936136, 0.0130467357412272,
+        -0.0674683166544128, 0.716697697063864, 0.283302302936136, 0.0674683166544128,
+        -0.160295215850056, 0.716697697063864, 0.283302302936136, 0.160295215850056,
+        -0.283302302936136, 0.716697697063864, 0.283302302936136, 0.283302302936136,
+        -0.425562830509080, 0.716697697063864, 0.283302302936136, 0.425562830509080,
+        -0.574437169490920, 0.716697697063864, 0.283302302936136, 0.574437169490920,
+        -0.716697697063864, 0.716697697063864, 0.283302302936136, 0.716697697063864,
+        -0.839704784149944, 0.716697697063864, 0.283302302936136, 0.839704784149944,
+        -0.932531683345587, 0.716697697063864, 0.283302302936136, 0.932531683345587,
+        -0.986953264258773, 0.716697697063864, 0.283302302936136, 0.986953264258773,
+        -0.155307263314171, 0.716697697063864, 0.425562830509080, 0.0130467357412272,
+        -0.209728844227357, 0.716697697063864, 0.425562830509080, 0.0674683166544128,
+        -0.302555743423000, 0.716697697063864, 0.425562830509080, 0.160295215850056,
+        -0.425562830509080, 0.716697697063864, 0.425562830509080, 0.283302302936136,
+        -0.567823358082023, 0.716697697063864, 0.425562830509080, 0.425562830509080,
+        -0.716697697063864, 0.716697697063864, 0.425562830509080, 0.574437169490920,
+        -0.858958224636808, 0.716697697063864, 0.425562830509080, 0.716697697063864,
+        -0.981965311722888, 0.716697697063864, 0.425562830509080, 0.839704784149944,
+        -1.07479221091853, 0.716697697063864, 0.425562830509080, 0.932531683345587,
+        -1.12921379183172, 0.716697697063864, 0.425562830509080, 0.986953264258773,
+        -0.304181602296012, 0.716697697063864, 0.574437169490920, 0.0130467357412272,
+        -0.358603183209198, 0.716697697063864, 0.574437169490920, 0.0674683166544128,
+        -0.451430082404841, 0.716697697063864, 0.574437169490920, 0.160295215850056,
+        -0.574437169490920, 0.716697697063864, 0.574437169490920, 0.283302302936136,
+        -0.716697697063864, 0.716697697063864, 0.574437169490920, 0.425562830509080,
+        -0.865572036045705, 0.716697697063864, 0.574437169490920, 0.574437169490920,
+        -1.00783256361865, 0.716697697063864, 0.574437169490920, 0.716697697063864,
+        -1.13083965070473, 0.716697697063864, 0.574437169490920, 0.839704784149944,
+        -1.22366654990037, 0.716697697063864, 0.574437169490920, 0.932531683345587,
+        -1.27808813081356, 0.716697697063864, 0.574437169490920, 0.986953264258773,
+        -0.446442129868956, 0.716697697063864, 0.716697697063864, 0.0130467357412272,
+        -0.500863710782141, 0.716697697063864, 0.716697697063864, 0.0674683166544128,
+        -0.593690609977784, 0.716697697063864, 0.716697697063864, 0.160295215850056,
+        -0.716697697063864, 0.716697697063864, 0.716697697063864, 0.283302302936136,
+        -0.858958224636808, 0.716697697063864, 0.716697697063864, 0.425562830509080,
+        -1.00783256361865, 0.716697697063864, 0.716697697063864, 0.574437169490920,
+        -1.15009309119159, 0.716697697063864, 0.716697697063864, 0.716697697063864,
+        -1.27310017827767, 0.716697697063864, 0.716697697063864, 0.839704784149944,
+        -1.36592707747332, 0.716697697063864, 0.716697697063864, 0.932531683345587,
+        -1.42034865838650, 0.716697697063864, 0.716697697063864, 0.986953264258773,
+        -0.569449216955036, 0.716697697063864, 0.839704784149944, 0.0130467357412272,
+        -0.623870797868221, 0.716697697063864, 0.839704784149944, 0.0674683166544128,
+        -0.716697697063864, 0.716697697063864, 0.839704784149944, 0.160295215850056,
+        -0.839704784149944, 0.716697697063864, 0.839704784149944, 0.283302302936136,
+        -0.981965311722888, 0.716697697063864, 0.839704784149944, 0.425562830509080,
+        -1.13083965070473, 0.716697697063864, 0.839704784149944, 0.574437169490920,
+        -1.27310017827767, 0.716697697063864, 0.839704784149944, 0.716697697063864,
+        -1.39610726536375, 0.716697697063864, 0.839704784149944, 0.839704784149944,
+        -1.48893416455940, 0.716697697063864, 0.839704784149944, 0.932531683345587,
+        -1.54335574547258, 0.716697697063864, 0.839704784149944, 0.986953264258773,
+        -0.662276116150679, 0.716697697063864, 0.932531683345587, 0.0130467357412272,
+        -0.716697697063864, 0.716697697063864, 0.932531683345587, 0.0674683166544128,
+        -0.809524596259507, 0.716697697063864, 0.932531683345587, 0.160295215850056,
+        -0.932531683345587, 0.716697697063864, 0.932531683345587, 0.283302302936136,
+        -1.07479221091853, 0.716697697063864, 0.932531683345587, 0.425562830509080,
+        -1.22366654990037, 0.716697697063864, 0.932531683345587, 0.574437169490920,
+        -1.36592707747332, 0.716697697063864, 0.932531683345587, 0.716697697063864,
+        -1.48893416455940, 0.716697697063864, 0.932531683345587, 0.839704784149944,
+        -1.58176106375504, 0.716697697063864, 0.932531683345587, 0.932531683345587,
+        -1.63618264466822, 0.716697697063864, 0.932531683345587, 0.986953264258773,
+        -0.716697697063864, 0.716697697063864, 0.986953264258773, 0.0130467357412272,
+        -0.771119277977050, 0.716697697063864, 0.986953264258773, 0.0674683166544128,
+        -0.863946177172693, 0.716697697063864, 0.986953264258773, 0.160295215850056,
+        -0.986953264258773, 0.716697697063864, 0.986953264258773, 0.283302302936136,
+        -1.12921379183172, 0.716697697063864, 0.986953264258773, 0.425562830509080,
+        -1.27808813081356, 0.716697697063864, 0.986953264258773, 0.574437169490920,
+        -1.42034865838650, 0.716697697063864, 0.986953264258773, 0.716697697063864,
+        -1.54335574547258, 0.716697697063864, 0.986953264258773, 0.839704784149944,
+        -1.63618264466822, 0.716697697063864, 0.986953264258773, 0.932531683345587,
+        -1.69060422558141, 0.716697697063864, 0.986953264258773, 0.986953264258773,
+        0.134201744367601, 0.839704784149944, 0.0130467357412272, 0.0130467357412272,
+        0.0797801634544157, 0.839704784149944, 0.0130467357412272, 0.0674683166544128,
+        -0.0130467357412272, 0.839704784149944, 0.0130467357412272, 0.160295215850056,
+        -0.136053822827307, 0.839704784149944, 0.0130467357412272, 0.283302302936136,
+        -0.278314350400251, 0.839704784149944, 0.0130467357412272, 0.425562830509080,
+        -0.427188689382092, 0.839704784149944, 0.0130467357412272, 0.574437169490920,
+        -0.569449216955036, 0.839704784149944, 0.0130467357412272, 0.716697697063864,
+        -0.692456304041116, 0.839704784149944, 0.0130467357412272, 0.839704784149944,
+        -0.785283203236759, 0.839704784149944, 0.0130467357412272, 0.932531683345587,
+        -0.839704784149944, 0.839704784149944, 0.0130467357412272, 0.986953264258773,
+        0.0797801634544157, 0.839704784149944, 0.0674683166544128, 0.0130467357412272,
+        0.0253585825412301, 0.839704784149944, 0.0674683166544128, 0.0674683166544128,
+        -0.0674683166544128, 0.839704784149944, 0.0674683166544128, 0.160295215850056,
+        -0.190475403740493, 0.839704784149944, 0.0674683166544128, 0.283302302936136,
+        -0.332735931313437, 0.839704784149944, 0.0674683166544128, 0.425562830509080,
+        -0.481610270295278, 0.839704784149944, 0.0674683166544128, 0.574437169490920,
+        -0.623870797868221, 0.839704784149944, 0.0674683166544128, 0.716697697063864,
+        -0.746877884954301, 0.839704784149944, 0.0674683166544128, 0.839704784149944,
+        -0.839704784149944, 0.839704784149944, 0.0674683166544128, 0.932531683345587,
+        -0.894126365063130, 0.839704784149944, 0.0674683166544128, 0.986953264258773,
+        -0.0130467357412272, 0.839704784149944, 0.160295215850056, 0.0130467357412272,
+        -0.0674683166544128, 0.839704784149944, 0.160295215850056, 0.0674683166544128,
+        -0.160295215850056, 0.839704784149944, 0.160295215850056, 0.160295215850056,
+        -0.283302302936136, 0.839704784149944, 0.160295215850056, 0.283302302936136,
+        -0.425562830509080, 0.839704784149944, 0.160295215850056, 0.425562830509080,
+        -0.574437169490920, 0.839704784149944, 0.160295215850056, 0.574437169490920,
+        -0.716697697063864, 0.839704784149944, 0.160295215850056, 0.716697697063864,
+        -0.839704784149944, 0.839704784149944, 0.160295215850056, 0.839704784149944,
+        -0.932531683345587, 0.839704784149944, 0.160295215850056, 0.932531683345587,
+        -0.986953264258773, 0.839704784149944, 0.160295215850056, 0.986953264258773,
+        -0.136053822827307, 0.839704784149944, 0.283302302936136, 0.0130467357412272,
+        -0.190475403740493, 0.839704784149944, 0.283302302936136, 0.0674683166544128,
+        -0.283302302936136, 0.839704784149944, 0.283302302936136, 0.160295215850056,
+        -0.406309390022216, 0.839704784149944, 0.283302302936136, 0.283302302936136,
+        -0.548569917595159, 0.839704784149944, 0.283302302936136, 0.425562830509080,
+        -0.697444256577000, 0.839704784149944, 0.283302302936136, 0.574437169490920,
+        -0.839704784149944, 0.839704784149944, 0.283302302936136, 0.716697697063864,
+        -0.962711871236024, 0.839704784149944, 0.283302302936136, 0.839704784149944,
+        -1.05553877043167, 0.839704784149944, 0.283302302936136, 0.932531683345587,
+        -1.10996035134485, 0.839704784149944, 0.283302302936136, 0.986953264258773,
+        -0.278314350400251, 0.839704784149944, 0.425562830509080, 0.0130467357412272,
+        -0.332735931313437, 0.839704784149944, 0.425562830509080, 0.0674683166544128,
+        -0.425562830509080, 0.839704784149944, 0.425562830509080, 0.160295215850056,
+        -0.548569917595159, 0.839704784149944, 0.425562830509080, 0.283302302936136,
+        -0.690830445168103, 0.839704784149944, 0.425562830509080, 0.425562830509080,
+        -0.839704784149944, 0.839704784149944, 0.425562830509080, 0.574437169490920,
+        -0.981965311722888, 0.839704784149944, 0.425562830509080, 0.716697697063864,
+        -1.10497239880897, 0.839704784149944, 0.425562830509080, 0.839704784149944,
+        -1.19779929800461, 0.839704784149944, 0.425562830509080, 0.932531683345587,
+        -1.25222087891780, 0.839704784149944, 0.425562830509080, 0.986953264258773,
+        -0.427188689382092, 0.839704784149944, 0.574437169490920, 0.0130467357412272,
+        -0.481610270295278, 0.839704784149944, 0.574437169490920, 0.0674683166544128,
+        -0.574437169490920, 0.839704784149944, 0.574437169490920, 0.160295215850056,
+        -0.697444256577000, 0.839704784149944, 0.574437169490920, 0.283302302936136,
+        -0.839704784149944, 0.839704784149944, 0.574437169490920, 0.425562830509080,
+        -0.988579123131785, 0.839704784149944, 0.574437169490920, 0.574437169490920,
+        -1.13083965070473, 0.839704784149944, 0.574437169490920, 0.716697697063864,
+        -1.25384673779081, 0.839704784149944, 0.574437169490920, 0.839704784149944,
+        -1.34667363698645, 0.839704784149944, 0.574437169490920, 0.932531683345587,
+        -1.40109521789964, 0.839704784149944, 0.574437169490920, 0.986953264258773,
+        -0.569449216955036, 0.839704784149944, 0.716697697063864, 0.0130467357412272,
+        -0.623870797868221, 0.839704784149944, 0.716697697063864, 0.0674683166544128,
+        -0.716697697063864, 0.839704784149944, 0.716697697063864, 0.160295215850056,
+        -0.839704784149944, 0.839704784149944, 0.716697697063864, 0.283302302936136,
+        -0.981965311722888, 0.839704784149944, 0.716697697063864, 0.425562830509080,
+        -1.13083965070473, 0.839704784149944, 0.716697697063864, 0.574437169490920,
+        -1.27310017827767, 0.839704784149944, 0.716697697063864, 0.716697697063864,
+        -1.39610726536375, 0.839704784149944, 0.716697697063864, 0.839704784149944,
+        -1.48893416455940, 0.839704784149944, 0.716697697063864, 0.932531683345587,
+        -1.54335574547258, 0.839704784149944, 0.716697697063864, 0.986953264258773,
+        -0.692456304041116, 0.839704784149944, 0.839704784149944, 0.0130467357412272,
+        -0.746877884954301, 0.839704784149944, 0.839704784149944, 0.0674683166544128,
+        -0.839704784149944, 0.839704784149944, 0.839704784149944, 0.160295215850056,
+        -0.962711871236024, 0.839704784149944, 0.839704784149944, 0.283302302936136,
+        -1.10497239880897, 0.839704784149944, 0.839704784149944, 0.425562830509080,
+        -1.25384673779081, 0.839704784149944, 0.839704784149944, 0.574437169490920,
+        -1.39610726536375, 0.839704784149944, 0.839704784149944, 0.716697697063864,
+        -1.51911435244983, 0.839704784149944, 0.839704784149944, 0.839704784149944,
+        -1.61194125164548, 0.839704784149944, 0.839704784149944, 0.932531683345587,
+        -1.66636283255866, 0.839704784149944, 0.839704784149944, 0.986953264258773,
+        -0.785283203236759, 0.839704784149944, 0.932531683345587, 0.0130467357412272,
+        -0.839704784149944, 0.839704784149944, 0.932531683345587, 0.0674683166544128,
+        -0.932531683345587, 0.839704784149944, 0.932531683345587, 0.160295215850056,
+        -1.05553877043167, 0.839704784149944, 0.932531683345587, 0.283302302936136,
+        -1.19779929800461, 0.839704784149944, 0.932531683345587, 0.425562830509080,
+        -1.34667363698645, 0.839704784149944, 0.932531683345587, 0.574437169490920,
+        -1.48893416455940, 0.839704784149944, 0.932531683345587, 0.716697697063864,
+        -1.61194125164548, 0.839704784149944, 0.932531683345587, 0.839704784149944,
+        -1.70476815084112, 0.839704784149944, 0.932531683345587, 0.932531683345587,
+        -1.75918973175430, 0.839704784149944, 0.932531683345587, 0.986953264258773,
+        -0.839704784149944, 0.839704784149944, 0.986953264258773, 0.0130467357412272,
+        -0.894126365063130, 0.839704784149944, 0.986953264258773, 0.0674683166544128,
+        -0.986953264258773, 0.839704784149944, 0.986953264258773, 0.160295215850056,
+        -1.10996035134485, 0.839704784149944, 0.986953264258773, 0.283302302936136,
+        -1.25222087891780, 0.839704784149944, 0.986953264258773, 0.425562830509080,
+        -1.40109521789964, 0.839704784149944, 0.986953264258773, 0.574437169490920,
+        -1.54335574547258, 0.839704784149944, 0.986953264258773, 0.716697697063864,
+        -1.66636283255866, 0.839704784149944, 0.986953264258773, 0.839704784149944,
+        -1.75918973175430, 0.839704784149944, 0.986953264258773, 0.932531683345587,
+        -1.81361131266749, 0.839704784149944, 0.986953264258773, 0.986953264258773,
+        0.0413748451719584, 0.932531683345587, 0.0130467357412272, 0.0130467357412272,
+        -0.0130467357412272, 0.932531683345587, 0.0130467357412272, 0.0674683166544128,
+        -0.105873634936870, 0.932531683345587, 0.0130467357412272, 0.160295215850056,
+        -0.228880722022950, 0.932531683345587, 0.0130467357412272, 0.283302302936136,
+        -0.371141249595894, 0.932531683345587, 0.0130467357412272, 0.425562830509080,
+        -0.520015588577735, 0.932531683345587, 0.0130467357412272, 0.574437169490920,
+        -0.662276116150679, 0.932531683345587, 0.0130467357412272, 0.716697697063864,
+        -0.785283203236759, 0.932531683345587, 0.0130467357412272, 0.839704784149944,
+        -0.878110102432402, 0.932531683345587, 0.0130467357412272, 0.932531683345587,
+        -0.932531683345587, 0.932531683345587, 0.0130467357412272, 0.986953264258773,
+        -0.0130467357412272, 0.932531683345587, 0.0674683166544128, 0.0130467357412272,
+        -0.0674683166544128, 0.932531683345587, 0.0674683166544128, 0.0674683166544128,
+        -0.160295215850056, 0.932531683345587, 0.0674683166544128, 0.160295215850056,
+        -0.283302302936136, 0.932531683345587, 0.0674683166544128, 0.283302302936136,
+        -0.425562830509080, 0.932531683345587, 0.0674683166544128, 0.425562830509080,
+        -0.574437169490920, 0.932531683345587, 0.0674683166544128, 0.574437169490920,
+        -0.716697697063864, 0.932531683345587, 0.0674683166544128, 0.716697697063864,
+        -0.839704784149944, 0.932531683345587, 0.0674683166544128, 0.839704784149944,
+        -0.932531683345587, 0.932531683345587, 0.0674683166544128, 0.932531683345587,
+        -0.986953264258773, 0.932531683345587, 0.0674683166544128, 0.986953264258773,
+        -0.105873634936870, 0.932531683345587, 0.160295215850056, 0.0130467357412272,
+        -0.160295215850056, 0.932531683345587, 0.160295215850056, 0.0674683166544128,
+        -0.253122115045699, 0.932531683345587, 0.160295215850056, 0.160295215850056,
+        -0.376129202131779, 0.932531683345587, 0.160295215850056, 0.283302302936136,
+        -0.518389729704722, 0.932531683345587, 0.160295215850056, 0.425562830509080,
+        -0.667264068686563, 0.932531683345587, 0.160295215850056, 0.574437169490920,
+        -0.809524596259507, 0.932531683345587, 0.160295215850056, 0.716697697063864,
+        -0.932531683345587, 0.932531683345587, 0.160295215850056, 0.839704784149944,
+        -1.02535858254123, 0.932531683345587, 0.160295215850056, 0.932531683345587,
+        -1.07978016345442, 0.932531683345587, 0.160295215850056, 0.986953264258773,
+        -0.228880722022950, 0.932531683345587, 0.283302302936136, 0.0130467357412272,
+        -0.283302302936136, 0.932531683345587, 0.283302302936136, 0.0674683166544128,
+        -0.376129202131779, 0.932531683345587, 0.283302302936136, 0.160295215850056,
+        -0.499136289217859, 0.932531683345587, 0.283302302936136, 0.283302302936136,
+        -0.641396816790802, 0.932531683345587, 0.283302302936136, 0.425562830509080,
+        -0.790271155772643, 0.932531683345587, 0.283302302936136, 0.574437169490920,
+        -0.932531683345587, 0.932531683345587, 0.283302302936136, 0.716697697063864,
+        -1.05553877043167, 0.932531683345587, 0.283302302936136, 0.839704784149944,
+        -1.14836566962731, 0.932531683345587, 0.283302302936136, 0.932531683345587,
+        -1.20278725054050, 0.932531683345587, 0.283302302936136, 0.986953264258773,
+        -0.371141249595894, 0.932531683345587, 0.425562830509080, 0.0130467357412272,
+        -0.425562830509080, 0.932531683345587, 0.425562830509080, 0.0674683166544128,
+        -0.518389729704722, 0.932531683345587, 0.425562830509080, 0.160295215850056,
+        -0.641396816790802, 0.932531683345587, 0.425562830509080, 0.283302302936136,
+        -0.783657344363746, 0.932531683345587, 0.425562830509080, 0.425562830509080,
+        -0.932531683345587, 0.932531683345587, 0.425562830509080, 0.574437169490920,
+        -1.07479221091853, 0.932531683345587, 0.425562830509080, 0.716697697063864,
+        -1.19779929800461, 0.932531683345587, 0.425562830509080, 0.839704784149944,
+        -1.29062619720025, 0.932531683345587, 0.425562830509080, 0.932531683345587,
+        -1.34504777811344, 0.932531683345587, 0.425562830509080, 0.986953264258773,
+        -0.520015588577735, 0.932531683345587, 0.574437169490920, 0.0130467357412272,
+        -0.574437169490920, 0.932531683345587, 0.574437169490920, 0.0674683166544128,
+        -0.667264068686563, 0.932531683345587, 0.574437169490920, 0.160295215850056,
+        -0.790271155772643, 0.932531683345587, 0.574437169490920, 0.283302302936136,
+        -0.932531683345587, 0.932531683345587, 0.574437169490920, 0.425562830509080,
+        -1.08140602232743, 0.932531683345587, 0.574437169490920, 0.574437169490920,
+        -1.22366654990037, 0.932531683345587, 0.574437169490920, 0.716697697063864,
+        -1.34667363698645, 0.932531683345587, 0.574437169490920, 0.839704784149944,
+        -1.43950053618209, 0.932531683345587, 0.574437169490920, 0.932531683345587,
+        -1.49392211709528, 0.932531683345587, 0.574437169490920, 0.986953264258773,
+        -0.662276116150679, 0.932531683345587, 0.716697697063864, 0.0130467357412272,
+        -0.716697697063864, 0.932531683345587, 0.716697697063864, 0.0674683166544128,
+        -0.809524596259507, 0.932531683345587, 0.716697697063864, 0.160295215850056,
+        -0.932531683345587, 0.932531683345587, 0.716697697063864, 0.283302302936136,
+        -1.07479221091853, 0.932531683345587, 0.716697697063864, 0.425562830509080,
+        -1.22366654990037, 0.932531683345587, 0.716697697063864, 0.574437169490920,
+        -1.36592707747332, 0.932531683345587, 0.716697697063864, 0.716697697063864,
+        -1.48893416455940, 0.932531683345587, 0.716697697063864, 0.839704784149944,
+        -1.58176106375504, 0.932531683345587, 0.716697697063864, 0.932531683345587,
+        -1.63618264466822, 0.932531683345587, 0.716697697063864, 0.986953264258773,
+        -0.785283203236759, 0.932531683345587, 0.839704784149944, 0.0130467357412272,
+        -0.839704784149944, 0.932531683345587, 0.839704784149944, 0.0674683166544128,
+        -0.932531683345587, 0.932531683345587, 0.839704784149944, 0.160295215850056,
+        -1.05553877043167, 0.932531683345587, 0.839704784149944, 0.283302302936136,
+        -1.19779929800461, 0.932531683345587, 0.839704784149944, 0.425562830509080,
+        -1.34667363698645, 0.932531683345587, 0.839704784149944, 0.574437169490920,
+        -1.48893416455940, 0.932531683345587, 0.839704784149944, 0.716697697063864,
+        -1.61194125164548, 0.932531683345587, 0.839704784149944, 0.839704784149944,
+        -1.70476815084112, 0.932531683345587, 0.839704784149944, 0.932531683345587,
+        -1.75918973175430, 0.932531683345587, 0.839704784149944, 0.986953264258773,
+        -0.878110102432402, 0.932531683345587, 0.932531683345587, 0.0130467357412272,
+        -0.932531683345587, 0.932531683345587, 0.932531683345587, 0.0674683166544128,
+        -1.02535858254123, 0.932531683345587, 0.932531683345587, 0.160295215850056,
+        -1.14836566962731, 0.932531683345587, 0.932531683345587, 0.283302302936136,
+        -1.29062619720025, 0.932531683345587, 0.932531683345587, 0.425562830509080,
+        -1.43950053618209, 0.932531683345587, 0.932531683345587, 0.574437169490920,
+        -1.58176106375504, 0.932531683345587, 0.932531683345587, 0.716697697063864,
+        -1.70476815084112, 0.932531683345587, 0.932531683345587, 0.839704784149944,
+        -1.79759505003676, 0.932531683345587, 0.932531683345587, 0.932531683345587,
+        -1.85201663094995, 0.932531683345587, 0.932531683345587, 0.986953264258773,
+        -0.932531683345587, 0.932531683345587, 0.986953264258773, 0.0130467357412272,
+        -0.986953264258773, 0.932531683345587, 0.986953264258773, 0.0674683166544128,
+        -1.07978016345442, 0.932531683345587, 0.986953264258773, 0.160295215850056,
+        -1.20278725054050, 0.932531683345587, 0.986953264258773, 0.283302302936136,
+        -1.34504777811344, 0.932531683345587, 0.986953264258773, 0.425562830509080,
+        -1.49392211709528, 0.932531683345587, 0.986953264258773, 0.574437169490920,
+        -1.63618264466822, 0.932531683345587, 0.986953264258773, 0.716697697063864,
+        -1.75918973175430, 0.932531683345587, 0.986953264258773, 0.839704784149944,
+        -1.85201663094995, 0.932531683345587, 0.986953264258773, 0.932531683345587,
+        -1.90643821186313, 0.932531683345587, 0.986953264258773, 0.986953264258773,
+        -0.0130467357412272, 0.986953264258773, 0.0130467357412272, 0.0130467357412272,
+        -0.0674683166544128, 0.986953264258773, 0.0130467357412272, 0.0674683166544128,
+        -0.160295215850056, 0.986953264258773, 0.0130467357412272, 0.160295215850056,
+        -0.283302302936136, 0.986953264258773, 0.0130467357412272, 0.283302302936136,
+        -0.425562830509080, 0.986953264258773, 0.0130467357412272, 0.425562830509080,
+        -0.574437169490920, 0.986953264258773, 0.0130467357412272, 0.574437169490920,
+        -0.716697697063864, 0.986953264258773, 0.0130467357412272, 0.716697697063864,
+        -0.839704784149944, 0.986953264258773, 0.0130467357412272, 0.839704784149944,
+        -0.932531683345587, 0.986953264258773, 0.0130467357412272, 0.932531683345587,
+        -0.986953264258773, 0.986953264258773, 0.0130467357412272, 0.986953264258773,
+        -0.0674683166544128, 0.986953264258773, 0.0674683166544128, 0.0130467357412272,
+        -0.121889897567598, 0.986953264258773, 0.0674683166544128, 0.0674683166544128,
+        -0.214716796763241, 0.986953264258773, 0.0674683166544128, 0.160295215850056,
+        -0.337723883849321, 0.986953264258773, 0.0674683166544128, 0.283302302936136,
+        -0.479984411422265, 0.986953264258773, 0.0674683166544128, 0.425562830509080,
+        -0.628858750404106, 0.986953264258773, 0.0674683166544128, 0.574437169490920,
+        -0.771119277977050, 0.986953264258773, 0.0674683166544128, 0.716697697063864,
+        -0.894126365063130, 0.986953264258773, 0.0674683166544128, 0.839704784149944,
+        -0.986953264258773, 0.986953264258773, 0.0674683166544128, 0.932531683345587,
+        -1.04137484517196, 0.986953264258773, 0.0674683166544128, 0.986953264258773,
+        -0.160295215850056, 0.986953264258773, 0.160295215850056, 0.0130467357412272,
+        -0.214716796763241, 0.986953264258773, 0.160295215850056, 0.0674683166544128,
+        -0.307543695958884, 0.986953264258773, 0.160295215850056, 0.160295215850056,
+        -0.430550783044964, 0.986953264258773, 0.160295215850056, 0.283302302936136,
+        -0.572811310617908, 0.986953264258773, 0.160295215850056, 0.425562830509080,
+        -0.721685649599749, 0.986953264258773, 0.160295215850056, 0.574437169490920,
+        -0.863946177172693, 0.986953264258773, 0.160295215850056, 0.716697697063864,
+        -0.986953264258773, 0.986953264258773, 0.160295215850056, 0.839704784149944,
+        -1.07978016345442, 0.986953264258773, 0.160295215850056, 0.932531683345587,
+        -1.13420174436760, 0.986953264258773, 0.160295215850056, 0.986953264258773,
+        -0.283302302936136, 0.986953264258773, 0.283302302936136, 0.0130467357412272,
+        -0.337723883849321, 0.986953264258773, 0.283302302936136, 0.0674683166544128,
+        -0.430550783044964, 0.986953264258773, 0.283302302936136, 0.160295215850056,
+        -0.553557870131044, 0.986953264258773, 0.283302302936136, 0.283302302936136,
+        -0.695818397703988, 0.986953264258773, 0.283302302936136, 0.425562830509080,
+        -0.844692736685829, 0.986953264258773, 0.283302302936136, 0.574437169490920,
+        -0.986953264258773, 0.986953264258773, 0.283302302936136, 0.716697697063864,
+        -1.10996035134485, 0.986953264258773, 0.283302302936136, 0.839704784149944,
+        -1.20278725054050, 0.986953264258773, 0.283302302936136, 0.932531683345587,
+        -1.25720883145368, 0.986953264258773, 0.283302302936136, 0.986953264258773,
+        -0.425562830509080, 0.986953264258773, 0.425562830509080, 0.0130467357412272,
+        -0.479984411422265, 0.986953264258773, 0.425562830509080, 0.0674683166544128,
+        -0.572811310617908, 0.986953264258773, 0.425562830509080, 0.160295215850056,
+        -0.695818397703988, 0.986953264258773, 0.425562830509080, 0.283302302936136,
+        -0.838078925276932, 0.986953264258773, 0.425562830509080, 0.425562830509080,
+        -0.986953264258773, 0.986953264258773, 0.425562830509080, 0.574437169490920,
+        -1.12921379183172, 0.986953264258773, 0.425562830509080, 0.716697697063864,
+        -1.25222087891780, 0.986953264258773, 0.425562830509080, 0.839704784149944,
+        -1.34504777811344, 0.986953264258773, 0.425562830509080, 0.932531683345587,
+        -1.39946935902663, 0.986953264258773, 0.425562830509080, 0.986953264258773,
+        -0.574437169490920, 0.986953264258773, 0.574437169490920, 0.0130467357412272,
+        -0.628858750404106, 0.986953264258773, 0.574437169490920, 0.0674683166544128,
+        -0.721685649599749, 0.986953264258773, 0.574437169490920, 0.160295215850056,
+        -0.844692736685829, 0.986953264258773, 0.574437169490920, 0.283302302936136,
+        -0.986953264258773, 0.986953264258773, 0.574437169490920, 0.425562830509080,
+        -1.13582760324061, 0.986953264258773, 0.574437169490920, 0.574437169490920,
+        -1.27808813081356, 0.986953264258773, 0.574437169490920, 0.716697697063864,
+        -1.40109521789964, 0.986953264258773, 0.574437169490920, 0.839704784149944,
+        -1.49392211709528, 0.986953264258773, 0.574437169490920, 0.932531683345587,
+        -1.54834369800847, 0.986953264258773, 0.574437169490920, 0.986953264258773,
+        -0.716697697063864, 0.986953264258773, 0.716697697063864, 0.0130467357412272,
+        -0.771119277977050, 0.986953264258773, 0.716697697063864, 0.0674683166544128,
+        -0.863946177172693, 0.986953264258773, 0.716697697063864, 0.160295215850056,
+        -0.986953264258773, 0.986953264258773, 0.716697697063864, 0.283302302936136,
+        -1.12921379183172, 0.986953264258773, 0.716697697063864, 0.425562830509080,
+        -1.27808813081356, 0.986953264258773, 0.716697697063864, 0.574437169490920,
+        -1.42034865838650, 0.986953264258773, 0.716697697063864, 0.716697697063864,
+        -1.54335574547258, 0.986953264258773, 0.716697697063864, 0.839704784149944,
+        -1.63618264466822, 0.986953264258773, 0.716697697063864, 0.932531683345587,
+        -1.69060422558141, 0.986953264258773, 0.716697697063864, 0.986953264258773,
+        -0.839704784149944, 0.986953264258773, 0.839704784149944, 0.0130467357412272,
+        -0.894126365063130, 0.986953264258773, 0.839704784149944, 0.0674683166544128,
+        -0.986953264258773, 0.986953264258773, 0.839704784149944, 0.160295215850056,
+        -1.10996035134485, 0.986953264258773, 0.839704784149944, 0.283302302936136,
+        -1.25222087891780, 0.986953264258773, 0.839704784149944, 0.425562830509080,
+        -1.40109521789964, 0.986953264258773, 0.839704784149944, 0.574437169490920,
+        -1.54335574547258, 0.986953264258773, 0.839704784149944, 0.716697697063864,
+        -1.66636283255866, 0.986953264258773, 0.839704784149944, 0.839704784149944,
+        -1.75918973175430, 0.986953264258773, 0.839704784149944, 0.932531683345587,
+        -1.81361131266749, 0.986953264258773, 0.839704784149944, 0.986953264258773,
+        -0.932531683345587, 0.986953264258773, 0.932531683345587, 0.0130467357412272,
+        -0.986953264258773, 0.986953264258773, 0.932531683345587, 0.0674683166544128,
+        -1.07978016345442, 0.986953264258773, 0.932531683345587, 0.160295215850056,
+        -1.20278725054050, 0.986953264258773, 0.932531683345587, 0.283302302936136,
+        -1.34504777811344, 0.986953264258773, 0.932531683345587, 0.425562830509080,
+        -1.49392211709528, 0.986953264258773, 0.932531683345587, 0.574437169490920,
+        -1.63618264466822, 0.986953264258773, 0.932531683345587, 0.716697697063864,
+        -1.75918973175430, 0.986953264258773, 0.932531683345587, 0.839704784149944,
+        -1.85201663094995, 0.986953264258773, 0.932531683345587, 0.932531683345587,
+        -1.90643821186313, 0.986953264258773, 0.932531683345587, 0.986953264258773,
+        -0.986953264258773, 0.986953264258773, 0.986953264258773, 0.0130467357412272,
+        -1.04137484517196, 0.986953264258773, 0.986953264258773, 0.0674683166544128,
+        -1.13420174436760, 0.986953264258773, 0.986953264258773, 0.160295215850056,
+        -1.25720883145368, 0.986953264258773, 0.986953264258773, 0.283302302936136,
+        -1.39946935902663, 0.986953264258773, 0.986953264258773, 0.425562830509080,
+        -1.54834369800847, 0.986953264258773, 0.986953264258773, 0.574437169490920,
+        -1.69060422558141, 0.986953264258773, 0.986953264258773, 0.716697697063864,
+        -1.81361131266749, 0.986953264258773, 0.986953264258773, 0.839704784149944,
+        -1.90643821186313, 0.986953264258773, 0.986953264258773, 0.932531683345587,
+        -1.96085979277632, 0.986953264258773, 0.986953264258773, 0.986953264258773};
     inline static std::array<Scalar, kPoints> constexpr weights = {
         3.70448336543065e-5,  8.30401790468641e-5,  0.000121731726568416, 0.000149613614798725,
         0.000164203164926284, 0.000164203164926284, 0.000149613614798725, 0.000121731726568416,
@@ -0,0 +1,96 @@
+#include "BlockSparseMatrix.h"
+
+#include "SelectionMatrix.h"
+
+#include <doctest/doctest.h>
+#include <exception>
+#include <random>
+#include <vector>
+
+TEST_CASE("[math][linalg] BlockSparseMatrix")
+{
+    using namespace pbat;
+    using math::linalg::BlockSparseMatrix;
+    using SparseIndex = typename CSCMatrix::StorageIndex;
+    using Triplet     = Eigen::Triplet<Scalar, SparseIndex>;
+    Scalar constexpr zero = 1e-12;
+
+    auto const fRandomMatrix = [](Index nRows, Index nCols, Index nTriplets) {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<Index> rowDist(0, nRows - 1);
+        std::uniform_int_distribution<Index> colDist(0, nCols - 1);
+        std::uniform_real_distribution<Scalar> valueDist(-1., 1.);
+        std::vector<Triplet> triplets{};
+        for (auto t = 0; t < nTriplets; ++t)
+            triplets.push_back(Triplet{
+                static_cast<SparseIndex>(rowDist(gen)),
+                static_cast<SparseIndex>(colDist(gen)),
+                valueDist(gen)});
+        CSCMatrix A(nRows, nCols);
+        A.setFromTriplets(triplets.begin(), triplets.end());
+        return A;
+    };
+
+    SUBCASE("3x3 blocks")
+    {
+        // Arrange
+        CSCMatrix const A = fRandomMatrix(3 * 31, 3 * 17, 400);
+        MatrixX const x   = MatrixX::Random(A.cols(), 2);
+        // Act
+        BlockSparseMatrix<3> const Ab(A);
+        CSCMatrix const Ar = Ab.ToMatrix();
+        MatrixX y          = MatrixX::Zero(A.rows(), 2);
+        Ab.Apply(x, y);
+        // Assert
+        CHECK_EQ(Ab.BlockRows(), 31);
+        CHECK_EQ(Ab.BlockCols(), 17);
+        CHECK_EQ(Ab.OutputDimensions(), A.rows());
+        CHECK_EQ(Ab.InputDimensions(), A.cols());
+        Scalar const roundTripError = (MatrixX(Ar) - MatrixX(A)).norm();
+        CHECK_LE(roundTripError, zero);
+        MatrixX const yExpected = A * x;
+        Scalar const applyError = (y - yExpected).norm() / yExpected.norm();
+        CHECK_LE(applyError, zero);
+    }
+    SUBCASE("2x2 blocks")
+    {
+        // Arrange
+        CSCMatrix const A = fRandomMatrix(2 * 23, 2 * 23, 300);
+        VectorX const x   = VectorX::Random(A.cols());
+        // Act
+        BlockSparseMatrix<2> const Ab(A);
+        VectorX y = VectorX::Zero(A.rows());
+        Ab.Apply(x, y);
+        // Assert
+        Scalar const roundTripError = (MatrixX(Ab.ToMatrix()) - MatrixX(A)).norm();
+        CHECK_LE(roundTripError, zero);
+        VectorX const yExpected = A * x;
+        Scalar const applyError = (y - yExpected).norm() / yExpected.norm();
+        CHECK_LE(applyError, zero);
+    }
+    SUBCASE("Block selection matrix")
+    {
+        // Arrange
+        IndexVectorX C(4);
+        C << 3, 0, 3, 1;
+        auto constexpr kDims = 3;
+        Index const n        = 5;
+        // Act
+        BlockSparseMatrix<kDims> const S = math::linalg::BlockSelectionMatrix<kDims>(C, n);
+        // Assert
+        MatrixX const Ss = math::linalg::SelectionMatrix(C, n);
+        MatrixX Sexpected = MatrixX::Zero(kDims * n, kDims * C.size());
+        for (auto i = 0; i < Ss.rows(); ++i)
+            for (auto j = 0; j < Ss.cols(); ++j)
+                Sexpected.block<kDims, kDims>(kDims * i, kDims * j) =
+                    Ss(i, j) * Matrix<kDims, kDims>::Identity();
+        CHECK_EQ(S.NonZeroBlocks(), C.size());
+        Scalar const error = (MatrixX(S.ToMatrix()) - Sexpected).norm();
+        CHECK_LE(error, zero);
+    }
+    SUBCASE("Invalid dimensions are rejected")
+    {
+        CSCMatrix const A(4, 6);
+        CHECK_THROWS_AS(BlockSparseMatrix<3>{A}, std::invalid_argument);
+    }
+}
@@ -0,0 +1,300 @@
+/**
+ * @file BlockSparseMatrix.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Block compressed sparse row matrix with fixed size square blocks
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PBAT_MATH_LINALG_BLOCK_SPARSE_MATRIX_H
+#define PBAT_MATH_LINALG_BLOCK_SPARSE_MATRIX_H
+
+#include "pbat/Aliases.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <algorithm>
+#include <exception>
+#include <fmt/core.h>
+#include <iterator>
+#include <string>
+#include <tbb/parallel_for.h>
+#include <utility>
+#include <vector>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Block compressed sparse row (BSR) matrix with fixed size `BlockSize x BlockSize` blocks
+ *
+ * Vector-valued FEM operators couple all \f$ d \f$ coordinates of pairs of nodes, such that
+ * storing one column index per \f$ d \times d \f$ block, rather than per scalar non-zero, divides
+ * index memory by \f$ d^2 \f$ and lets matrix-vector products operate on fixed size blocks. Block
+ * rows are independent, such that Apply is parallel and race-free.
+ *
+ * BlockSparseMatrix satisfies the CLinearOperator concept, and converts to and from CSCMatrix,
+ * e.g. for direct solvers.
+ *
+ * @tparam BlockSize Number of rows and columns of blocks
+ */
+template <int BlockSize>
+class BlockSparseMatrix
+{
+  public:
+    static_assert(BlockSize > 0, "Block size must be positive");
+    static auto constexpr kBlockSize = BlockSize; ///< Number of rows and columns of blocks
+    using StorageIndex               = typename CSCMatrix::StorageIndex; ///< Index type of blocks
+    using IndexVectorType = Eigen::Vector<StorageIndex, Eigen::Dynamic>; ///< Index array type
+    using BlockType       = Matrix<kBlockSize, kBlockSize>;              ///< Block type
+
+    BlockSparseMatrix() = default;
+    /**
+     * @brief Construct an empty (i.e. without non-zero blocks) block sparse matrix
+     *
+     * @param nBlockRows Number of block rows
+     * @param nBlockCols Number of block columns
+     */
+    BlockSparseMatrix(Index nBlockRows, Index nBlockCols);
+    /**
+     * @brief Construct a block sparse matrix from its block compressed sparse row storage
+     *
+     * @param nBlockCols Number of block columns
+     * @param ptr `|# block rows + 1|` block row offsets
+     * @param adj `|# non-zero blocks|` block column indices, sorted within each block row
+     * @param B `kBlockSize x |kBlockSize * # non-zero blocks|` non-zero blocks
+     */
+    BlockSparseMatrix(Index nBlockCols, IndexVectorType ptr, IndexVectorType adj, MatrixX B);
+    /**
+     * @brief Construct a block sparse matrix from a scalar compressed sparse matrix
+     *
+     * Any block containing at least one stored coefficient of A becomes a non-zero block.
+     *
+     * @param A Compressed sparse matrix whose dimensions are multiples of kBlockSize
+     */
+    explicit BlockSparseMatrix(CSCMatrix const& A);
+
+    /**
+     * @brief Computes y += A*x, in parallel over block rows
+     *
+     * @tparam TDerivedIn Input matrix type
+     * @tparam TDerivedOut Output matrix type
+     * @param x Input matrix
+     * @param y Output matrix
+     * @pre x.rows() == InputDimensions() and y.rows() == OutputDimensions() and y.cols() ==
+     * x.cols()
+     */
+    template <class TDerivedIn, class TDerivedOut>
+    void Apply(Eigen::MatrixBase<TDerivedIn> const& x, Eigen::DenseBase<TDerivedOut>& y) const;
+    /**
+     * @brief Expands this block sparse matrix into a scalar compressed column matrix
+     * @return Compressed sparse column matrix with all coefficients of non-zero blocks
+     */
+    CSCMatrix ToMatrix() const;
+
+    /**
+     * @brief Number of block rows
+     * @return Number of block rows
+     */
+    Index BlockRows() const { return ptr.size() > 0 ? ptr.size() - 1 : 0; }
+    /**
+     * @brief Number of block columns
+     * @return Number of block columns
+     */
+    Index BlockCols() const { return mBlockCols; }
+    /**
+     * @brief Number of non-zero blocks
+     * @return Number of non-zero blocks
+     */
+    Index NonZeroBlocks() const { return adj.size(); }
+    /**
+     * @brief Number of scalar columns
+     * @return Number of scalar columns
+     */
+    Index InputDimensions() const { return kBlockSize * BlockCols(); }
+    /**
+     * @brief Number of scalar rows
+     * @return Number of scalar rows
+     */
+    Index OutputDimensions() const { return kBlockSize * BlockRows(); }
+    /**
+     * @brief Non-zero block k
+     * @param k Non-zero block index
+     * @return Block view
+     */
+    auto Block(Index k) { return B.template block<kBlockSize, kBlockSize>(0, k * kBlockSize); }
+    /**
+     * @brief Non-zero block k
+     * @param k Non-zero block index
+     * @return Block view
+     */
+    auto Block(Index k) const
+    {
+        return B.template block<kBlockSize, kBlockSize>(0, k * kBlockSize);
+    }
+
+    IndexVectorType ptr; ///< Block row i's non-zero blocks are adj[ptr[i]:ptr[i+1]]
+    IndexVectorType adj; ///< Block column indices of non-zero blocks
+    MatrixX B;           ///< `kBlockSize x |kBlockSize * # non-zero blocks|` non-zero blocks
+
+  private:
+    Index mBlockCols{0}; ///< Number of block columns
+};
+
+template <int BlockSize>
+inline BlockSparseMatrix<BlockSize>::BlockSparseMatrix(Index nBlockRows, Index nBlockCols)
+    : ptr(IndexVectorType::Zero(nBlockRows + 1)),
+      adj(),
+      B(kBlockSize, 0),
+      mBlockCols(nBlockCols)
+{
+}
+
+template <int BlockSize>
+inline BlockSparseMatrix<BlockSize>::BlockSparseMatrix(
+    Index nBlockCols,
+    IndexVectorType ptrIn,
+    IndexVectorType adjIn,
+    MatrixX BIn)
+    : ptr(std::move(ptrIn)), adj(std::move(adjIn)), B(std::move(BIn)), mBlockCols(nBlockCols)
+{
+    bool const bIsValid = ptr.size() > 0 and ptr(ptr.size() - 1) == adj.size() and
+                          B.rows() == kBlockSize and B.cols() == kBlockSize * adj.size();
+    if (not bIsValid)
+    {
+        std::string const what = fmt::format(
+            "Expected block row offsets ending in |# non-zero blocks|={} and {}x{} non-zero "
+            "blocks, but got ptr.size()={} and B.shape={}x{}",
+            adj.size(),
+            kBlockSize,
+            kBlockSize * adj.size(),
+            ptr.size(),
+            B.rows(),
+            B.cols());
+        throw std::invalid_argument(what);
+    }
+}
+
+template <int BlockSize>
+inline BlockSparseMatrix<BlockSize>::BlockSparseMatrix(CSCMatrix const& A)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockSparseMatrix.FromCSCMatrix");
+    if (A.rows() % kBlockSize != 0 or A.cols() % kBlockSize != 0)
+    {
+        std::string const what = fmt::format(
+            "Expected matrix dimensions to be multiples of the block size {}, but got {}x{}",
+            kBlockSize,
+            A.rows(),
+            A.cols());
+        throw std::invalid_argument(what);
+    }
+    using RowMajorMatrix = Eigen::SparseMatrix<Scalar, Eigen::RowMajor, StorageIndex>;
+    RowMajorMatrix const Ar = A;
+    Index const nBlockRows  = A.rows() / kBlockSize;
+    mBlockCols              = A.cols() / kBlockSize;
+    // Count unique block columns of each block row, then fill the blocks
+    std::vector<std::vector<StorageIndex>> blockCols(static_cast<std::size_t>(nBlockRows));
+    tbb::parallel_for(Index{0}, nBlockRows, [&](Index bi) {
+        auto& cols = blockCols[static_cast<std::size_t>(bi)];
+        for (auto i = bi * kBlockSize; i < (bi + 1) * kBlockSize; ++i)
+            for (typename RowMajorMatrix::InnerIterator it(Ar, i); it; ++it)
+                cols.push_back(static_cast<StorageIndex>(it.col() / kBlockSize));
+        std::sort(cols.begin(), cols.end());
+        cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+    });
+    ptr.resize(nBlockRows + 1);
+    ptr(0) = 0;
+    for (Index bi = 0; bi < nBlockRows; ++bi)
+        ptr(bi + 1) =
+            ptr(bi) + static_cast<StorageIndex>(blockCols[static_cast<std::size_t>(bi)].size());
+    adj.resize(ptr(nBlockRows));
+    B.setZero(kBlockSize, kBlockSize * adj.size());
+    tbb::parallel_for(Index{0}, nBlockRows, [&](Index bi) {
+        auto const& cols = blockCols[static_cast<std::size_t>(bi)];
+        std::copy(cols.begin(), cols.end(), adj.data() + ptr(bi));
+        for (auto i = bi * kBlockSize; i < (bi + 1) * kBlockSize; ++i)
+        {
+            for (typename RowMajorMatrix::InnerIterator it(Ar, i); it; ++it)
+            {
+                auto const bj = static_cast<StorageIndex>(it.col() / kBlockSize);
+                auto const k  = ptr(bi) + std::distance(
+                                             cols.begin(),
+                                             std::lower_bound(cols.begin(), cols.end(), bj));
+                B(i - bi * kBlockSize, k * kBlockSize + it.col() % kBlockSize) = it.value();
+            }
+        }
+    });
+}
+
+template <int BlockSize>
+template <class TDerivedIn, class TDerivedOut>
+inline void BlockSparseMatrix<BlockSize>::Apply(
+    Eigen::MatrixBase<TDerivedIn> const& x,
+    Eigen::DenseBase<TDerivedOut>& y) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockSparseMatrix.Apply");
+    if (x.rows() != InputDimensions() or y.rows() != OutputDimensions() or x.cols() != y.cols())
+    {
+        std::string const what = fmt::format(
+            "Expected input with {} rows and output with {} rows and same number of columns, but "
+            "got dimensions x,y=({},{}), ({},{})",
+            InputDimensions(),
+            OutputDimensions(),
+            x.rows(),
+            x.cols(),
+            y.rows(),
+            y.cols());
+        throw std::invalid_argument(what);
+    }
+    for (auto c = 0; c < x.cols(); ++c)
+    {
+        tbb::parallel_for(Index{0}, BlockRows(), [&](Index bi) {
+            Vector<kBlockSize> yi = Vector<kBlockSize>::Zero();
+            for (auto k = ptr(bi); k < ptr(bi + 1); ++k)
+                yi += Block(k) * x.col(c).template segment<kBlockSize>(adj(k) * kBlockSize);
+            y.col(c).template segment<kBlockSize>(bi * kBlockSize) += yi;
+        });
+    }
+}
+
+template <int BlockSize>
+inline CSCMatrix BlockSparseMatrix<BlockSize>::ToMatrix() const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockSparseMatrix.ToMatrix");
+    // Block rows directly map to compressed scalar rows
+    using RowMajorMatrix = Eigen::SparseMatrix<Scalar, Eigen::RowMajor, StorageIndex>;
+    auto const nBlockRows = BlockRows();
+    RowMajorMatrix Ar(OutputDimensions(), InputDimensions());
+    Ar.resizeNonZeros(kBlockSize * kBlockSize * NonZeroBlocks());
+    StorageIndex* outer = Ar.outerIndexPtr();
+    StorageIndex* inner = Ar.innerIndexPtr();
+    Scalar* values      = Ar.valuePtr();
+    tbb::parallel_for(Index{0}, nBlockRows, [&](Index bi) {
+        auto const nBlocks = ptr(bi + 1) - ptr(bi);
+        for (auto di = 0; di < kBlockSize; ++di)
+        {
+            auto const i = bi * kBlockSize + di;
+            auto u       = kBlockSize * (kBlockSize * ptr(bi) + di * nBlocks);
+            outer[i]     = static_cast<StorageIndex>(u);
+            for (auto k = ptr(bi); k < ptr(bi + 1); ++k)
+            {
+                for (auto dj = 0; dj < kBlockSize; ++dj, ++u)
+                {
+                    inner[u]  = static_cast<StorageIndex>(adj(k) * kBlockSize + dj);
+                    values[u] = B(di, k * kBlockSize + dj);
+                }
+            }
+        }
+    });
+    outer[OutputDimensions()] =
+        static_cast<StorageIndex>(kBlockSize * kBlockSize * NonZeroBlocks());
+    return CSCMatrix(Ar);
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_BLOCK_SPARSE_MATRIX_H
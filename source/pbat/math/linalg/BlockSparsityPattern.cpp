@@ -0,0 +1,61 @@
+#include "BlockSparsityPattern.h"
+
+#include <doctest/doctest.h>
+#include <random>
+#include <vector>
+
+TEST_CASE("[math][linalg] BlockSparsityPattern")
+{
+    using namespace pbat;
+    using SparseIndex = typename CSCMatrix::StorageIndex;
+    using Triplet     = Eigen::Triplet<Scalar, SparseIndex>;
+    // Arrange
+    auto constexpr kBlockSize = 3;
+    using BlockType           = Matrix<kBlockSize, kBlockSize>;
+    Index const nBlockRows    = 19;
+    Index const nBlockCols    = 13;
+    Index const nBlocks       = 250;
+    std::mt19937 gen{7};
+    std::uniform_int_distribution<Index> rowDist(0, nBlockRows - 1);
+    std::uniform_int_distribution<Index> colDist(0, nBlockCols - 1);
+    std::vector<Index> rows(static_cast<std::size_t>(nBlocks));
+    std::vector<Index> cols(static_cast<std::size_t>(nBlocks));
+    for (auto k = 0; k < nBlocks; ++k)
+    {
+        rows[static_cast<std::size_t>(k)] = rowDist(gen);
+        cols[static_cast<std::size_t>(k)] = colDist(gen);
+    }
+    MatrixX const blocks = MatrixX::Random(kBlockSize, kBlockSize * nBlocks);
+    auto const fBlock    = [&](Index k) {
+        return BlockType(blocks.block<kBlockSize, kBlockSize>(0, k * kBlockSize));
+    };
+    std::vector<Triplet> triplets{};
+    for (auto k = 0; k < nBlocks; ++k)
+        for (auto j = 0; j < kBlockSize; ++j)
+            for (auto i = 0; i < kBlockSize; ++i)
+                triplets.push_back(Triplet{
+                    static_cast<SparseIndex>(kBlockSize * rows[static_cast<std::size_t>(k)] + i),
+                    static_cast<SparseIndex>(kBlockSize * cols[static_cast<std::size_t>(k)] + j),
+                    fBlock(k)(i, j)});
+    CSCMatrix Aexpected(kBlockSize * nBlockRows, kBlockSize * nBlockCols);
+    Aexpected.setFromTriplets(triplets.begin(), triplets.end());
+    // Act
+    math::linalg::BlockSparsityPattern<kBlockSize> const GP(nBlockRows, nBlockCols, rows, cols);
+    math::linalg::BlockSparseMatrix<kBlockSize> A = GP.ToMatrix(fBlock);
+    // Assert
+    Scalar constexpr zero = 1e-12;
+    CHECK_FALSE(GP.IsEmpty());
+    CHECK_EQ(A.BlockRows(), nBlockRows);
+    CHECK_EQ(A.BlockCols(), nBlockCols);
+    Scalar const error = (MatrixX(A.ToMatrix()) - MatrixX(Aexpected)).norm();
+    CHECK_LE(error, zero);
+    // Block columns of every block row are sorted and unique
+    for (auto bi = 0; bi < A.BlockRows(); ++bi)
+        for (auto k = A.ptr(bi) + 1; k < A.ptr(bi + 1); ++k)
+            CHECK_LT(A.adj(k - 1), A.adj(k));
+    // In-place re-assembly overwrites previous values
+    A.B.setConstant(Scalar(3));
+    GP.ToMatrix(fBlock, A);
+    Scalar const inPlaceError = (MatrixX(A.ToMatrix()) - MatrixX(Aexpected)).norm();
+    CHECK_LE(inPlaceError, zero);
+}
@@ -0,0 +1,199 @@
+/**
+ * @file BlockSparsityPattern.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Precomputed sparsity pattern for parallel assembly of block sparse matrices
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PBAT_MATH_LINALG_BLOCK_SPARSITY_PATTERN_H
+#define PBAT_MATH_LINALG_BLOCK_SPARSITY_PATTERN_H
+
+#include "BlockSparseMatrix.h"
+#include "SparsityPattern.h"
+
+#include <exception>
+#include <fmt/core.h>
+#include <pbat/Aliases.h>
+#include <pbat/common/Concepts.h>
+#include <pbat/profiling/Profiling.h>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Sparsity pattern of a BlockSparseMatrix, assembled from (duplicate) blocks
+ *
+ * The block pattern is the (scalar) SparsityPattern of the transposed block graph, whose
+ * compressed columns are exactly our compressed block rows, such that unique non-zero u is
+ * non-zero block u of the assembled BlockSparseMatrix.
+ *
+ * @tparam BlockSize Number of rows and columns of blocks
+ */
+template <int BlockSize>
+class BlockSparsityPattern
+{
+  public:
+    using BlockSparseMatrixType = BlockSparseMatrix<BlockSize>; ///< Assembled matrix type
+    using BlockType             = typename BlockSparseMatrixType::BlockType; ///< Block type
+
+    BlockSparsityPattern() = default;
+    /**
+     * @brief Construct the block sparsity pattern of (duplicate) blocks at (rows[k], cols[k])
+     *
+     * @tparam TRowIndexRange Contiguous range of block row indices
+     * @tparam TColIndexRange Contiguous range of block column indices
+     * @param nBlockRows Number of block rows
+     * @param nBlockCols Number of block columns
+     * @param blockRowIndices Block row indices of (duplicate) blocks
+     * @param blockColIndices Block column indices of (duplicate) blocks
+     */
+    template <
+        common::CContiguousIndexRange TRowIndexRange,
+        common::CContiguousIndexRange TColIndexRange>
+    BlockSparsityPattern(
+        Index nBlockRows,
+        Index nBlockCols,
+        TRowIndexRange&& blockRowIndices,
+        TColIndexRange&& blockColIndices);
+    /**
+     * @brief Compute the block sparsity pattern of (duplicate) blocks at (rows[k], cols[k])
+     *
+     * @tparam TRowIndexRange Contiguous range of block row indices
+     * @tparam TColIndexRange Contiguous range of block column indices
+     * @param nBlockRows Number of block rows
+     * @param nBlockCols Number of block columns
+     * @param blockRowIndices Block row indices of (duplicate) blocks
+     * @param blockColIndices Block column indices of (duplicate) blocks
+     */
+    template <
+        common::CContiguousIndexRange TRowIndexRange,
+        common::CContiguousIndexRange TColIndexRange>
+    void Compute(
+        Index nBlockRows,
+        Index nBlockCols,
+        TRowIndexRange&& blockRowIndices,
+        TColIndexRange&& blockColIndices);
+    /**
+     * @brief Assembles (duplicate) blocks into a block sparse matrix with this sparsity pattern
+     *
+     * @tparam FBlock Callable with signature `BlockType(Index k)` returning (duplicate) block k
+     * @param fBlock (Duplicate) block accessor, ordered as the indices passed to Compute
+     * @return Assembled block sparse matrix
+     */
+    template <class FBlock>
+    BlockSparseMatrixType ToMatrix(FBlock&& fBlock) const;
+    /**
+     * @brief Assembles (duplicate) blocks into a caller-owned block sparse matrix with this
+     * sparsity pattern, in-place and in parallel
+     *
+     * @tparam FBlock Callable with signature `BlockType(Index k)` returning (duplicate) block k
+     * @param fBlock (Duplicate) block accessor, ordered as the indices passed to Compute
+     * @param A Block sparse matrix with this sparsity pattern, e.g. as returned by ToMatrix
+     */
+    template <class FBlock>
+    void ToMatrix(FBlock&& fBlock, BlockSparseMatrixType& A) const;
+    /**
+     * @brief Checks if this block sparsity pattern has not been computed
+     * @return True if empty
+     */
+    bool IsEmpty() const { return GP.IsEmpty(); }
+
+  private:
+    SparsityPattern GP; ///< Sparsity pattern of the transposed block graph
+};
+
+template <int BlockSize>
+template <
+    common::CContiguousIndexRange TRowIndexRange,
+    common::CContiguousIndexRange TColIndexRange>
+inline BlockSparsityPattern<BlockSize>::BlockSparsityPattern(
+    Index nBlockRows,
+    Index nBlockCols,
+    TRowIndexRange&& blockRowIndices,
+    TColIndexRange&& blockColIndices)
+{
+    Compute(
+        nBlockRows,
+        nBlockCols,
+        std::forward<TRowIndexRange>(blockRowIndices),
+        std::forward<TColIndexRange>(blockColIndices));
+}
+
+template <int BlockSize>
+template <
+    common::CContiguousIndexRange TRowIndexRange,
+    common::CContiguousIndexRange TColIndexRange>
+inline void BlockSparsityPattern<BlockSize>::Compute(
+    Index nBlockRows,
+    Index nBlockCols,
+    TRowIndexRange&& blockRowIndices,
+    TColIndexRange&& blockColIndices)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockSparsityPattern.Compute");
+    GP.Compute(
+        nBlockCols,
+        nBlockRows,
+        std::forward<TColIndexRange>(blockColIndices),
+        std::forward<TRowIndexRange>(blockRowIndices));
+}
+
+template <int BlockSize>
+template <class FBlock>
+inline auto BlockSparsityPattern<BlockSize>::ToMatrix(FBlock&& fBlock) const
+    -> BlockSparseMatrixType
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockSparsityPattern.ToMatrix");
+    using IndexVectorType = typename BlockSparseMatrixType::IndexVectorType;
+    CSCMatrix const& P    = GP.Pattern();
+    BlockSparseMatrixType A(
+        P.rows(),
+        Eigen::Map<IndexVectorType const>(P.outerIndexPtr(), P.outerSize() + 1),
+        Eigen::Map<IndexVectorType const>(P.innerIndexPtr(), P.nonZeros()),
+        MatrixX::Zero(BlockSize, BlockSize * P.nonZeros()));
+    ToMatrix(std::forward<FBlock>(fBlock), A);
+    return A;
+}
+
+template <int BlockSize>
+template <class FBlock>
+inline void
+BlockSparsityPattern<BlockSize>::ToMatrix(FBlock&& fBlock, BlockSparseMatrixType& A) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockSparsityPattern.ToMatrixInPlace");
+    CSCMatrix const& P              = GP.Pattern();
+    bool const bIsPatternCompatible = A.BlockRows() == P.cols() and A.BlockCols() == P.rows() and
+                                      A.NonZeroBlocks() == P.nonZeros() and
+                                      A.B.cols() == BlockSize * P.nonZeros();
+    if (not bIsPatternCompatible)
+    {
+        std::string const what = fmt::format(
+            "Expected {}x{} block matrix with {} non-zero blocks in this sparsity pattern, but got "
+            "{}x{} block matrix with {} non-zero blocks",
+            P.cols(),
+            P.rows(),
+            P.nonZeros(),
+            A.BlockRows(),
+            A.BlockCols(),
+            A.NonZeroBlocks());
+        throw std::invalid_argument(what);
+    }
+    GP.ForEachUniqueNonZero([&](Index u, std::span<Index const> ks) {
+        BlockType Bu = BlockType::Zero();
+        for (auto k : ks)
+            Bu += fBlock(k);
+        A.Block(u) = Bu;
+    });
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_BLOCK_SPARSITY_PATTERN_H
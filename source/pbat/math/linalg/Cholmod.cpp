@@ -1,6 +1,9 @@
 #include "Cholmod.h"
 // clang-format off
 #ifdef PBAT_USE_SUITESPARSE
+#include "pbat/common/Serialization.h"
+#include "pbat/profiling/Profiling.h"
+
 #include <fmt/core.h>
 #include <string>
 // clang-format on
@@ -9,43 +12,313 @@ namespace pbat {
 namespace math {
 namespace linalg {
 
-Cholmod::Cholmod() : mCholmodCommon{}, mCholmodL(NULL)
+Cholmod::Cholmod() : Cholmod(Settings{}) {}
+
+Cholmod::Cholmod(Settings const& settings)
+    : mCholmodCommon{},
+      mCholmodL(NULL),
+      mCholmodY(NULL),
+      mCholmodE(NULL),
+      mSingleB(),
+      mSingleX(),
+      mSettings(),
+      mAnalyzedStorage(ESparseStorage::SymmetricLowerTriangular),
+      mAnalyzedRows(0),
+      mAnalyzedP(),
+      mAnalyzedI(),
+      mStagedUpdates(),
+      mStagedDowndates(),
+      mStagedUpdateRank(0),
+      mStagedDowndateRank(0)
 {
+    // Validate before cholmod_start, since the destructor does not run if the constructor throws
+    CheckSettings(settings);
     cholmod_start(&mCholmodCommon);
+    Configure(settings);
+}
+
+void Cholmod::CheckSettings(Settings const& settings)
+{
+#if !PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+    if (settings.ePrecision == EPrecision::Single)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Single precision factors require CHOLMOD >= 5, but CHOLMOD {}.{}.{} is linked",
+            CHOLMOD_MAIN_VERSION,
+            CHOLMOD_SUB_VERSION,
+            CHOLMOD_SUBSUB_VERSION));
+    }
+#else
+    static_cast<void>(settings);
+#endif // !PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+}
+
+void Cholmod::Configure(Settings const& settings)
+{
+    CheckSettings(settings);
+    Deallocate();
+    mSettings                   = settings;
+    mCholmodCommon.supernodal   = static_cast<int>(settings.eFactorization);
+    mCholmodCommon.nthreads_max = settings.nThreads;
+    auto const useOrdering      = [this](int ordering) {
+        mCholmodCommon.nmethods           = 1;
+        mCholmodCommon.method[0].ordering = ordering;
+        mCholmodCommon.postorder          = 1 /*TRUE*/;
+    };
+    switch (settings.eOrdering)
+    {
+        case EOrdering::Automatic: mCholmodCommon.nmethods = 0; break;
+        case EOrdering::Natural: useOrdering(CHOLMOD_NATURAL); break;
+        case EOrdering::Amd: useOrdering(CHOLMOD_AMD); break;
+        case EOrdering::Metis: useOrdering(CHOLMOD_METIS); break;
+        case EOrdering::NestedDissection: useOrdering(CHOLMOD_NESDIS); break;
+    }
+}
+
+void Cholmod::Analyze(SparsityPattern const& GP, ESparseStorage storage)
+{
+    Analyze(GP.Pattern(), storage);
+}
+
+void Cholmod::Analyze(cholmod_sparse& cholmod_A, std::int32_t* perm)
+{
+    Deallocate();
+    mCholmodL = cholmod_analyze_p(&cholmod_A, perm, NULL, 0, &mCholmodCommon);
+    if (mCholmodL == NULL)
+        throw std::runtime_error("Symbolic analysis of Cholesky factor failed");
+    auto const* p    = static_cast<std::int32_t const*>(cholmod_A.p);
+    auto const* i    = static_cast<std::int32_t const*>(cholmod_A.i);
+    auto const ncols = static_cast<Eigen::Index>(cholmod_A.ncol);
+    mAnalyzedStorage = static_cast<ESparseStorage>(cholmod_A.stype);
+    mAnalyzedRows    = static_cast<Index>(cholmod_A.nrow);
+    mAnalyzedP       = Eigen::Map<IndexVectorType const>(p, ncols + 1);
+    mAnalyzedI       = Eigen::Map<IndexVectorType const>(i, p[ncols]);
+}
+
+bool Cholmod::Factorize(cholmod_sparse& cholmod_A)
+{
+    // CHOLMOD factorizes in A's precision, i.e. single precision factors require single precision
+    // copies of A's values
+#if PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+    Eigen::VectorXf singleValues{};
+    if (mSettings.ePrecision == EPrecision::Single)
+    {
+        auto const nnz     = static_cast<Eigen::Index>(cholmod_A.nzmax);
+        auto const* values = static_cast<Scalar const*>(cholmod_A.x);
+        singleValues       = Eigen::Map<VectorX const>(values, nnz).cast<float>();
+        cholmod_A.x        = singleValues.data();
+        cholmod_A.dtype    = CHOLMOD_SINGLE;
+    }
+#endif // PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+    int const ec = cholmod_factorize(&cholmod_A, mCholmodL, &mCholmodCommon);
+    return ec == 1 and mCholmodCommon.status == CHOLMOD_OK;
+}
+
+bool Cholmod::ApplyStagedUpdates()
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.Cholmod.ApplyStagedUpdates");
+    if (mSettings.ePrecision != EPrecision::Double)
+        throw std::runtime_error("Cholesky factor updates require double precision factors");
+    if (mCholmodL == NULL)
+        throw std::runtime_error("Cholesky factor updates require a numerical factorization");
+    bool const bIsUpdated = UpdateDowndate(true, mStagedUpdates, mStagedUpdateRank) and
+                            UpdateDowndate(false, mStagedDowndates, mStagedDowndateRank);
+    mStagedUpdates.clear();
+    mStagedDowndates.clear();
+    mStagedUpdateRank   = 0;
+    mStagedDowndateRank = 0;
+    return bIsUpdated;
+}
+
+bool Cholmod::UpdateDowndate(bool bIsUpdate, std::vector<TripletType> const& triplets, Index rank)
+{
+    if (rank == 0)
+        return true;
+    // Permute rows of the update by the factor's fill-reducing ordering, i.e. row i of the update
+    // becomes row iperm(i)
+    auto const n     = static_cast<Eigen::Index>(mCholmodL->n);
+    auto const* perm = static_cast<std::int32_t const*>(mCholmodL->Perm);
+    IndexVectorType iperm(n);
+    for (Eigen::Index k = 0; k < n; ++k)
+        iperm(perm[k]) = static_cast<std::int32_t>(k);
+    std::vector<TripletType> permuted{};
+    permuted.reserve(triplets.size());
+    for (TripletType const& t : triplets)
+    {
+        if (t.row() < 0 or t.row() >= n)
+        {
+            throw std::invalid_argument(fmt::format(
+                "Expected update row indices in [0,{}), but got {}",
+                n,
+                t.row()));
+        }
+        permuted.emplace_back(iperm(t.row()), t.col(), t.value());
+    }
+    CSCMatrix PU(n, rank);
+    PU.setFromTriplets(permuted.begin(), permuted.end());
+    cholmod_sparse cholmod_PU{};
+    ToCholmodView(PU, ESparseStorage::Unsymmetric, cholmod_PU);
+    int const ec = cholmod_updown(
+        bIsUpdate ? 1 /*TRUE == update*/ : 0 /*FALSE == downdate*/,
+        &cholmod_PU,
+        mCholmodL,
+        &mCholmodCommon);
+    return ec == 1 and mCholmodCommon.status == CHOLMOD_OK;
 }
 
 MatrixX Cholmod::Solve(Eigen::Ref<MatrixX const> const& B) const
 {
-    if (mCholmodL->n != static_cast<size_t>(B.rows()))
+    MatrixX X{};
+    Solve(B, X);
+    return X;
+}
+
+void Cholmod::Solve(Eigen::Ref<MatrixX const> const& B, MatrixX& X) const
+{
+    if (mCholmodL == NULL or mCholmodL->n != static_cast<size_t>(B.rows()))
     {
         std::string const what = fmt::format(
             "Expected right-hand side B to have {} rows, but got {} instead",
-            mCholmodL->n,
+            mCholmodL == NULL ? size_t{0} : mCholmodL->n,
             B.rows());
         throw std::invalid_argument(what);
     }
 
+    if (mSettings.ePrecision == EPrecision::Single)
+    {
+        mSingleB = B.cast<float>();
+        mSingleX.resize(B.rows(), B.cols());
+        SolveSingle();
+        X = mSingleX.cast<Scalar>();
+        return;
+    }
+
     cholmod_dense cholmod_B{};
     cholmod_B.nrow  = static_cast<size_t>(B.rows());
     cholmod_B.ncol  = static_cast<size_t>(B.cols());
-    cholmod_B.nzmax = static_cast<size_t>(B.size());
-    cholmod_B.d     = static_cast<size_t>(B.rows());
+    cholmod_B.nzmax = static_cast<size_t>(B.outerStride() * B.cols());
+    cholmod_B.d     = static_cast<size_t>(B.outerStride());
     cholmod_B.x     = const_cast<Scalar*>(B.data());
     cholmod_B.xtype = CHOLMOD_REAL;
     cholmod_B.dtype = CHOLMOD_DOUBLE;
 
-    cholmod_dense* cholmod_X = cholmod_solve(
+    // Solve directly into X's memory, which CHOLMOD reuses since its dimensions match the solution
+    X.resize(B.rows(), B.cols());
+    cholmod_dense cholmod_X{};
+    cholmod_X.nrow            = static_cast<size_t>(X.rows());
+    cholmod_X.ncol            = static_cast<size_t>(X.cols());
+    cholmod_X.nzmax           = static_cast<size_t>(X.size());
+    cholmod_X.d               = static_cast<size_t>(X.rows());
+    cholmod_X.x               = X.data();
+    cholmod_X.xtype           = CHOLMOD_REAL;
+    cholmod_X.dtype           = CHOLMOD_DOUBLE;
+    cholmod_dense* pcholmod_X = &cholmod_X;
+
+    int const ec = cholmod_solve2(
         CHOLMOD_A,
         mCholmodL,
         &cholmod_B,
+        NULL,
+        &pcholmod_X,
+        NULL,
+        &mCholmodY,
+        &mCholmodE,
         const_cast<cholmod_common*>(&mCholmodCommon));
+    if (ec != 1 or pcholmod_X != &cholmod_X)
+        throw std::runtime_error("Cholesky solve failed");
+}
 
-    MatrixX X = Eigen::Map<MatrixX const>(
-        static_cast<Scalar*>(cholmod_X->x),
-        static_cast<Eigen::Index>(mCholmodL->n),
-        B.cols());
-    cholmod_free_dense(&cholmod_X, const_cast<cholmod_common*>(&mCholmodCommon));
-    return X;
+void Cholmod::SolveSingle() const
+{
+#if PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+    cholmod_dense cholmod_B{};
+    cholmod_B.nrow  = static_cast<size_t>(mSingleB.rows());
+    cholmod_B.ncol  = static_cast<size_t>(mSingleB.cols());
+    cholmod_B.nzmax = static_cast<size_t>(mSingleB.size());
+    cholmod_B.d     = static_cast<size_t>(mSingleB.rows());
+    cholmod_B.x     = mSingleB.data();
+    cholmod_B.xtype = CHOLMOD_REAL;
+    cholmod_B.dtype = CHOLMOD_SINGLE;
+
+    cholmod_dense cholmod_X{};
+    cholmod_X.nrow            = static_cast<size_t>(mSingleX.rows());
+    cholmod_X.ncol            = static_cast<size_t>(mSingleX.cols());
+    cholmod_X.nzmax           = static_cast<size_t>(mSingleX.size());
+    cholmod_X.d               = static_cast<size_t>(mSingleX.rows());
+    cholmod_X.x               = mSingleX.data();
+    cholmod_X.xtype           = CHOLMOD_REAL;
+    cholmod_X.dtype           = CHOLMOD_SINGLE;
+    cholmod_dense* pcholmod_X = &cholmod_X;
+
+    int const ec = cholmod_solve2(
+        CHOLMOD_A,
+        mCholmodL,
+        &cholmod_B,
+        NULL,
+        &pcholmod_X,
+        NULL,
+        &mCholmodY,
+        &mCholmodE,
+        const_cast<cholmod_common*>(&mCholmodCommon));
+    if (ec != 1 or pcholmod_X != &cholmod_X)
+        throw std::runtime_error("Cholesky solve failed");
+#else
+    throw std::runtime_error("Single precision solves require CHOLMOD >= 5");
+#endif // PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+}
+
+void Cholmod::Serialize(std::ostream& os) const
+{
+    if (mCholmodL == NULL)
+        throw std::runtime_error("Cannot serialize a Cholmod object without symbolic analysis");
+    using common::WriteBinary;
+    WriteBinary(os, static_cast<std::int32_t>(mAnalyzedStorage));
+    WriteBinary(os, static_cast<std::int64_t>(mAnalyzedRows));
+    WriteBinary(os, mAnalyzedP);
+    WriteBinary(os, mAnalyzedI);
+    auto const* perm = static_cast<std::int32_t const*>(mCholmodL->Perm);
+    WriteBinary(
+        os,
+        Eigen::Map<IndexVectorType const>(perm, static_cast<Eigen::Index>(mCholmodL->n)));
+}
+
+void Cholmod::Deserialize(std::istream& is)
+{
+    using common::ReadBinary;
+    std::int32_t storage{};
+    std::int64_t nrows{};
+    IndexVectorType P{}, I{}, perm{};
+    ReadBinary(is, storage);
+    ReadBinary(is, nrows);
+    ReadBinary(is, P);
+    ReadBinary(is, I);
+    ReadBinary(is, perm);
+    bool const bIsValid = P.size() > 0 and I.size() == P(P.size() - 1) and
+                          perm.size() == static_cast<Eigen::Index>(nrows);
+    if (not bIsValid)
+        throw std::runtime_error("Invalid Cholmod symbolic analysis in binary stream");
+    // Analyze a pattern-only view of the stored sparsity, with the stored fill-reducing ordering
+    cholmod_sparse cholmod_A{};
+    cholmod_A.nrow   = static_cast<size_t>(nrows);
+    cholmod_A.ncol   = static_cast<size_t>(P.size() - 1);
+    cholmod_A.nzmax  = static_cast<size_t>(I.size());
+    cholmod_A.p      = P.data();
+    cholmod_A.i      = I.data();
+    cholmod_A.nz     = NULL;
+    cholmod_A.x      = NULL;
+    cholmod_A.z      = NULL;
+    cholmod_A.stype  = storage;
+    cholmod_A.itype  = CHOLMOD_INT;
+    cholmod_A.xtype  = CHOLMOD_PATTERN;
+    cholmod_A.sorted = 1 /*TRUE*/;
+    cholmod_A.packed = 1 /*TRUE*/;
+    auto const nmethods               = mCholmodCommon.nmethods;
+    auto const ordering               = mCholmodCommon.method[0].ordering;
+    mCholmodCommon.nmethods           = 1;
+    mCholmodCommon.method[0].ordering = CHOLMOD_GIVEN;
+    Analyze(cholmod_A, perm.data());
+    mCholmodCommon.nmethods           = nmethods;
+    mCholmodCommon.method[0].ordering = ordering;
 }
 
 Cholmod::~Cholmod()
@@ -60,13 +333,35 @@ void Cholmod::Deallocate()
     {
         cholmod_free_factor(&mCholmodL, &mCholmodCommon);
     }
+    if (mCholmodY != NULL)
+    {
+        cholmod_free_dense(&mCholmodY, &mCholmodCommon);
+    }
+    if (mCholmodE != NULL)
+    {
+        cholmod_free_dense(&mCholmodE, &mCholmodCommon);
+    }
+    mSingleB.resize(0, 0);
+    mSingleX.resize(0, 0);
+    mStagedUpdates.clear();
+    mStagedDowndates.clear();
+    mStagedUpdateRank   = 0;
+    mStagedDowndateRank = 0;
+    mAnalyzedRows = 0;
+    mAnalyzedP.resize(0);
+    mAnalyzedI.resize(0);
 }
 
 } // namespace linalg
 } // namespace math
 } // namespace pbat
 
+    #include "BlockSparseMatrix.h"
+    #include "IterativeRefinement.h"
+
     #include <doctest/doctest.h>
+    #include <sstream>
+    #include <vector>
 
 TEST_CASE("[math][linalg] Cholmod")
 {
@@ -112,6 +407,129 @@ TEST_CASE("[math][linalg] Cholmod")
         Scalar const error      = (X - Xcomputed).squaredNorm();
         CHECK_LE(error, zero);
     }
+    SUBCASE("Can refactorize matrices with the analyzed sparsity pattern")
+    {
+        LLT.Analyze(A);
+        CHECK(LLT.IsAnalyzed(A));
+        CSCMatrix A2 = A;
+        A2.coeffs() *= 2.;
+        bool const bFactorized = LLT.Refactorize(A2);
+        CHECK(bFactorized);
+        MatrixX const Xcomputed = LLT.Solve(B);
+        Scalar const error      = (0.5 * X - Xcomputed).squaredNorm();
+        CHECK_LE(error, zero);
+        CSCMatrix const D = MatrixX::Identity(n, n).sparseView();
+        CHECK_FALSE(LLT.IsAnalyzed(D));
+        CHECK_THROWS_AS(LLT.Refactorize(D), std::invalid_argument);
+    }
+    SUBCASE("Can factorize matrices assembled into a sparsity pattern")
+    {
+        std::vector<Index> rows{}, cols{};
+        std::vector<Scalar> values{};
+        for (auto j = 0; j < A.outerSize(); ++j)
+        {
+            for (CSCMatrix::InnerIterator it(A, j); it; ++it)
+            {
+                // Split every non-zero into 2 duplicates
+                for (auto d = 0; d < 2; ++d)
+                {
+                    rows.push_back(it.row());
+                    cols.push_back(it.col());
+                    values.push_back(0.5 * it.value());
+                }
+            }
+        }
+        math::linalg::SparsityPattern const GP(n, n, rows, cols);
+        LLT.Analyze(GP);
+        CSCMatrix H = GP.ToMatrix(values);
+        CHECK(LLT.Refactorize(H));
+        MatrixX Xcomputed{};
+        LLT.Solve(B, Xcomputed);
+        Scalar const error = (X - Xcomputed).squaredNorm();
+        CHECK_LE(error, zero);
+    }
+    SUBCASE("Can solve with supernodal factorization and fixed ordering")
+    {
+        math::linalg::Cholmod::Settings settings{};
+        settings.eFactorization = math::linalg::Cholmod::EFactorization::Supernodal;
+        settings.eOrdering      = math::linalg::Cholmod::EOrdering::Amd;
+        math::linalg::Cholmod LLTs(settings);
+        bool const bFactorized = LLTs.Compute(A);
+        CHECK(bFactorized);
+        MatrixX Xcomputed{};
+        LLTs.Solve(B, Xcomputed);
+        LLTs.Solve(B, Xcomputed);
+        Scalar const error = (X - Xcomputed).squaredNorm();
+        CHECK_LE(error, zero);
+    }
+    SUBCASE("Can serialize symbolic analysis")
+    {
+        LLT.Analyze(A);
+        std::stringstream ss{std::ios::in | std::ios::out | std::ios::binary};
+        LLT.Serialize(ss);
+        math::linalg::Cholmod LLTr{};
+        LLTr.Deserialize(ss);
+        CHECK(LLTr.IsAnalyzed(A));
+        bool const bFactorized = LLTr.Refactorize(A);
+        CHECK(bFactorized);
+        MatrixX const Xcomputed = LLTr.Solve(B);
+        Scalar const error      = (X - Xcomputed).squaredNorm();
+        CHECK_LE(error, zero);
+    }
+    SUBCASE("Can solve with single precision factors and iterative refinement")
+    {
+        math::linalg::Cholmod::Settings settings{};
+        settings.ePrecision = math::linalg::Cholmod::EPrecision::Single;
+    #if !PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+        CHECK_THROWS_AS(math::linalg::Cholmod{settings}, std::invalid_argument);
+    #else
+        math::linalg::Cholmod LLTs(settings);
+        // Well-conditioned system, such that refinement contracts quickly
+        MatrixX const Adense   = R.transpose() * R + Scalar(n) * MatrixX::Identity(n, n);
+        CSCMatrix const Afull  = Adense.sparseView();
+        CSCMatrix const Alower = Afull.triangularView<Eigen::Lower>();
+        MatrixX const Bw       = Adense * X;
+        CHECK(LLTs.Compute(Alower));
+        MatrixX const Xsingle = LLTs.Solve(Bw);
+        CHECK_LE((X - Xsingle).norm() / X.norm(), 1e-4);
+        math::linalg::BlockSparseMatrix<1> const Aop(Afull);
+        math::linalg::KrylovSettings refinement{};
+        refinement.rtol = 1e-13;
+        MatrixX Xrefined{};
+        auto const result = math::linalg::IterativeRefinement(Aop, Bw, Xrefined, LLTs, refinement);
+        CHECK(result.IsConverged());
+        CHECK_LE((X - Xrefined).norm() / X.norm(), 1e-11);
+        CHECK_THROWS_AS(LLTs.Update(Alower), std::runtime_error);
+    #endif // !PBAT_CHOLMOD_HAS_SINGLE_PRECISION
+    }
+    SUBCASE("Can apply batched low-rank updates and downdates")
+    {
+        CHECK(LLT.Compute(A));
+        // Pin and unpin some rows by diagonal penalties, and add a sparse coupling
+        Scalar constexpr mu = 10.;
+        MatrixX Aupdated    = CSCMatrix(A.selfadjointView<Eigen::Lower>());
+        for (Index i : {1, 4, 7})
+        {
+            LLT.StageUpdate(IndexVector<1>{i}, Vector<1>{std::sqrt(mu)});
+            Aupdated(i, i) += mu;
+        }
+        Vector<2> const w{1., -2.};
+        LLT.StageUpdate(IndexVector<2>{2, 8}, w);
+        Aupdated(2, 2) += w(0) * w(0);
+        Aupdated(2, 8) += w(0) * w(1);
+        Aupdated(8, 2) += w(0) * w(1);
+        Aupdated(8, 8) += w(1) * w(1);
+        // Downdates are applied after updates, i.e. a staged pin can be removed in the same batch
+        LLT.StageDowndate(IndexVector<1>{4}, Vector<1>{std::sqrt(mu)});
+        Aupdated(4, 4) -= mu;
+        CHECK_EQ(LLT.StagedRank(), 5);
+        CHECK(LLT.ApplyStagedUpdates());
+        CHECK_EQ(LLT.StagedRank(), 0);
+        MatrixX const Bupdated  = Aupdated * X;
+        MatrixX const Xcomputed = LLT.Solve(Bupdated);
+        Scalar const error      = (X - Xcomputed).squaredNorm();
+        CHECK_LE(error, 1e-12);
+    }
     SUBCASE("Can downdate Cholesky factors")
     {
         CSCMatrix const U      = zero * MatrixX::Random(n, m).sparseView();
@@ -6,10 +6,23 @@
 
 #include "pbat/Aliases.h"
 #include "PhysicsBasedAnimationToolkitExport.h"
+#include "SparsityPattern.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <exception>
+#include <istream>
+#include <ostream>
 #include <suitesparse/cholmod.h>
 #include <type_traits>
+#include <vector>
+
+// Single precision factors require CHOLMOD >= 5
+#if defined(CHOLMOD_MAIN_VERSION) && CHOLMOD_MAIN_VERSION >= 5
+    #define PBAT_CHOLMOD_HAS_SINGLE_PRECISION 1
+#else
+    #define PBAT_CHOLMOD_HAS_SINGLE_PRECISION 0
+#endif
 // clang-format on
 
 namespace pbat {
@@ -32,13 +45,104 @@ class Cholmod
         SymmetricUpperTriangular = 1
     };
 
+    /**
+     * @brief Numerical factorization strategy
+     */
+    enum class EFactorization {
+        Simplicial = CHOLMOD_SIMPLICIAL, ///< Up-looking (left-looking) simplicial factorization
+        Automatic  = CHOLMOD_AUTO, ///< Simplicial or supernodal, depending on the factor's density
+        Supernodal = CHOLMOD_SUPERNODAL ///< Supernodal factorization using (multithreaded) BLAS
+    };
+
+    /**
+     * @brief Fill-reducing ordering of the symbolic analysis
+     */
+    enum class EOrdering {
+        Automatic, ///< AMD, then METIS if AMD's fill is high (CHOLMOD's default strategy)
+        Natural,   ///< No permutation
+        Amd,       ///< Approximate minimum degree
+        Metis,     ///< METIS nested dissection
+        NestedDissection ///< CHOLMOD's nested dissection (METIS bisection and constrained AMD)
+    };
+
+    /**
+     * @brief Floating point precision of the numerical factor
+     */
+    enum class EPrecision {
+        Double, ///< Factorize and solve in double precision
+        Single  ///< Factorize and solve in single precision (requires CHOLMOD >= 5), which halves
+                ///< the factor's memory footprint. Solutions are only accurate to single precision,
+                ///< see IterativeRefinement() to recover double precision accuracy.
+    };
+
+    /**
+     * @brief Factorization settings
+     */
+    struct Settings
+    {
+        EFactorization eFactorization{EFactorization::Automatic}; ///< Factorization strategy
+        EOrdering eOrdering{EOrdering::Automatic};                 ///< Fill-reducing ordering
+        EPrecision ePrecision{EPrecision::Double};                 ///< Factor precision
+        int nThreads{0}; ///< Maximum number of threads of CHOLMOD's parallel regions, or 0 for
+                         ///< CHOLMOD's default. Supernodal factorization is further parallelized
+                         ///< by the linked BLAS/LAPACK.
+    };
+
     PBAT_API Cholmod();
+    /**
+     * @brief Construct a new Cholmod object with the given settings
+     * @param settings Factorization settings
+     */
+    PBAT_API explicit Cholmod(Settings const& settings);
+
+    Cholmod(Cholmod const&)            = delete;
+    Cholmod& operator=(Cholmod const&) = delete;
+
+    /**
+     * @brief Changes the factorization settings
+     *
+     * Discards the current symbolic analysis and factorization.
+     *
+     * @param settings Factorization settings
+     * @throw std::invalid_argument if single precision is requested, but the linked CHOLMOD
+     * predates version 5
+     */
+    PBAT_API void Configure(Settings const& settings);
+    /**
+     * @brief Current factorization settings
+     * @return Factorization settings
+     */
+    Settings const& GetSettings() const { return mSettings; }
 
     template <class Derived>
     void Analyze(
         Eigen::SparseCompressedBase<Derived> const& A,
         ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular);
+    /**
+     * @brief Computes the symbolic analysis (i.e. fill-reducing ordering and factor structure) of
+     * all matrices with the sparsity pattern GP
+     *
+     * Matrices assembled into GP's pattern (see SparsityPattern::ToMatrix()) can then be
+     * factorized by Refactorize() without further analysis.
+     *
+     * @param GP Sparsity pattern
+     * @param storage Which part of the pattern stores the matrix
+     */
+    PBAT_API void Analyze(
+        SparsityPattern const& GP,
+        ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular);
 
+    /**
+     * @brief Numerically factorizes A
+     *
+     * Reuses the current symbolic analysis if A has the analyzed sparsity pattern, and analyzes A
+     * otherwise.
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param A Sparse matrix
+     * @param storage Which part of A stores the matrix
+     * @return True if A was successfully factorized
+     */
     template <class Derived>
     bool Factorize(
         Eigen::SparseCompressedBase<Derived> const& A,
@@ -49,51 +153,217 @@ class Cholmod
         Eigen::SparseCompressedBase<Derived> const& A,
         ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular);
 
+    /**
+     * @brief Numerically factorizes A, whose sparsity pattern must be the analyzed one
+     *
+     * Only the numerical factorization is computed, i.e. the fill-reducing ordering and factor
+     * structure of the last Analyze() are reused.
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param A Sparse matrix with the analyzed sparsity pattern
+     * @return True if A was successfully factorized
+     * @throw std::invalid_argument if A's sparsity pattern is not the analyzed one
+     */
     template <class Derived>
-    bool Update(Eigen::SparseCompressedBase<Derived> const& U);
+    bool Refactorize(Eigen::SparseCompressedBase<Derived> const& A);
+
+    /**
+     * @brief Checks if A has the analyzed sparsity pattern
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param A Sparse matrix
+     * @param storage Which part of A stores the matrix
+     * @return True if A's symbolic analysis is the current one
+     */
+    template <class Derived>
+    bool IsAnalyzed(
+        Eigen::SparseCompressedBase<Derived> const& A,
+        ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular) const;
 
+    /**
+     * @brief Updates the factorization of A to that of \f$ \mathbf{A} + \mathbf{U}\mathbf{U}^T \f$
+     *
+     * Stages the columns of U and applies them, together with previously staged updates and
+     * downdates, by ApplyStagedUpdates().
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param U `n x k` sparse update
+     * @return True if the factorization was successfully updated
+     * @throw std::runtime_error if the factor is stored in single precision
+     */
+    template <class Derived>
+    bool Update(Eigen::SparseCompressedBase<Derived> const& U);
+    /**
+     * @brief Downdates the factorization of A to that of \f$ \mathbf{A} - \mathbf{U}\mathbf{U}^T
+     * \f$
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param U `n x k` sparse downdate
+     * @return True if the factorization was successfully downdated
+     * @throw std::runtime_error if the factor is stored in single precision
+     */
     template <class Derived>
     bool Downdate(Eigen::SparseCompressedBase<Derived> const& U);
+    /**
+     * @brief Stages the rank-1 update \f$ \mathbf{w}\mathbf{w}^T \f$ of the factorized matrix
+     *
+     * Constraint rows (e.g. contact normals or Dirichlet pins) are typically staged one at a time,
+     * and applied all at once by ApplyStagedUpdates().
+     *
+     * @tparam TDerivedI Eigen integer vector type
+     * @tparam TDerivedW Eigen vector type
+     * @param rows Row indices of w's non-zeros
+     * @param w Non-zero values of w
+     */
+    template <class TDerivedI, class TDerivedW>
+    void StageUpdate(
+        Eigen::DenseBase<TDerivedI> const& rows,
+        Eigen::DenseBase<TDerivedW> const& w);
+    /**
+     * @brief Stages the rank-1 downdate \f$ -\mathbf{w}\mathbf{w}^T \f$ of the factorized matrix
+     *
+     * @tparam TDerivedI Eigen integer vector type
+     * @tparam TDerivedW Eigen vector type
+     * @param rows Row indices of w's non-zeros
+     * @param w Non-zero values of w
+     */
+    template <class TDerivedI, class TDerivedW>
+    void StageDowndate(
+        Eigen::DenseBase<TDerivedI> const& rows,
+        Eigen::DenseBase<TDerivedW> const& w);
+    /**
+     * @brief Applies all staged updates as a single multiple-rank update, then all staged
+     * downdates as a single multiple-rank downdate, and clears them
+     *
+     * Staged vectors are permuted by the fill-reducing ordering when they are assembled, such that
+     * a batch costs one pass over the factor's affected columns, regardless of its rank. Applying
+     * updates before downdates keeps intermediate matrices positive definite whenever the final
+     * matrix is.
+     *
+     * @return True if the factorization was successfully updated. The factorization is invalid
+     * otherwise.
+     * @throw std::runtime_error if the factor is stored in single precision or if there is no
+     * factorization
+     */
+    PBAT_API bool ApplyStagedUpdates();
+    /**
+     * @brief Number of staged rank-1 updates and downdates
+     * @return Rank of the staged batch
+     */
+    Index StagedRank() const { return mStagedUpdateRank + mStagedDowndateRank; }
 
+    /**
+     * @brief Solves A X = B for all columns of B at once
+     * @param B `n x k` right-hand sides
+     * @return `n x k` solutions
+     * @note Not thread-safe, since solves share this solver's workspaces
+     */
     PBAT_API MatrixX Solve(Eigen::Ref<MatrixX const> const& B) const;
+    /**
+     * @brief Solves A X = B for all columns of B at once, into caller-owned X
+     *
+     * Solver workspaces persist across calls, such that repeated solves with the same number of
+     * right-hand sides do not allocate. Concurrent solves on the same Cholmod instance therefore
+     * race on these workspaces, and must be serialized by the caller (or use separate instances).
+     *
+     * @param B `n x k` right-hand sides
+     * @param X `n x k` solutions, resized if necessary. Must not alias B.
+     */
+    PBAT_API void Solve(Eigen::Ref<MatrixX const> const& B, MatrixX& X) const;
+
+    /**
+     * @brief Write the symbolic analysis (analyzed sparsity pattern and fill-reducing ordering) to
+     * a binary stream
+     *
+     * @param os Output stream
+     * @pre Analyze() has been called
+     */
+    PBAT_API void Serialize(std::ostream& os) const;
+    /**
+     * @brief Read a symbolic analysis written by Serialize from a binary stream
+     *
+     * The stored fill-reducing ordering is reused as is, skipping its (expensive) recomputation.
+     * Only the factor structure is recomputed from it.
+     *
+     * @param is Input stream
+     */
+    PBAT_API void Deserialize(std::istream& is);
 
     PBAT_API ~Cholmod();
 
   private:
+    using IndexVectorType = Eigen::Vector<std::int32_t, Eigen::Dynamic>;
+    using TripletType     = Eigen::Triplet<Scalar, std::int32_t>;
+
     template <class Derived>
     void ToCholmodView(
         Eigen::SparseCompressedBase<Derived> const& A,
         ESparseStorage storage,
         cholmod_sparse& cholmod_A) const;
 
+    /**
+     * @brief Symbolic analysis of the matrix held by cholmod_A, and record of its sparsity pattern
+     *
+     * @param cholmod_A Matrix to analyze
+     * @param perm Fill-reducing ordering to use, or NULL to compute it
+     */
+    PBAT_API void Analyze(cholmod_sparse& cholmod_A, std::int32_t* perm);
+    PBAT_API bool Factorize(cholmod_sparse& cholmod_A);
+    /**
+     * @brief Applies the multiple-rank update (or downdate) given by the columns of staged
+     * triplets, in original row indices
+     */
+    PBAT_API bool UpdateDowndate(
+        bool bIsUpdate,
+        std::vector<TripletType> const& triplets,
+        Index rank);
+    /**
+     * @brief Throws std::invalid_argument if settings are not supported by the linked CHOLMOD
+     * @param settings Factorization settings
+     */
+    PBAT_API static void CheckSettings(Settings const& settings);
+    /**
+     * @brief Solves into mSingleX for right-hand sides mSingleB with a single precision factor
+     */
+    PBAT_API void SolveSingle() const;
+
     PBAT_API void Deallocate();
 
     cholmod_common mCholmodCommon;
     cholmod_factor* mCholmodL;
+    mutable cholmod_dense* mCholmodY;          ///< Persistent solve workspace
+    mutable cholmod_dense* mCholmodE;          ///< Persistent solve workspace
+    mutable Eigen::MatrixXf mSingleB;          ///< Persistent single precision right-hand sides
+    mutable Eigen::MatrixXf mSingleX;          ///< Persistent single precision solutions
+    Settings mSettings;                        ///< Factorization settings
+    ESparseStorage mAnalyzedStorage;           ///< Storage of the analyzed matrix
+    Index mAnalyzedRows;                       ///< Number of rows of the analyzed matrix
+    IndexVectorType mAnalyzedP;                ///< Outer indices of the analyzed matrix
+    IndexVectorType mAnalyzedI;                ///< Inner indices of the analyzed matrix
+    std::vector<TripletType> mStagedUpdates;   ///< Non-zeros of staged update vectors
+    std::vector<TripletType> mStagedDowndates; ///< Non-zeros of staged downdate vectors
+    Index mStagedUpdateRank;                   ///< Number of staged update vectors
+    Index mStagedDowndateRank;                 ///< Number of staged downdate vectors
 };
 
 template <class Derived>
 inline void Cholmod::Analyze(Eigen::SparseCompressedBase<Derived> const& A, ESparseStorage storage)
 {
-    Deallocate();
     cholmod_sparse cholmod_A{};
     ToCholmodView(A, storage, cholmod_A);
-    mCholmodL = cholmod_analyze(&cholmod_A, &mCholmodCommon);
-    if (mCholmodL == NULL)
-        throw std::runtime_error("Symbolic analysis of Cholesky factor failed");
+    Analyze(cholmod_A, NULL);
 }
 
 template <class Derived>
 inline bool
 Cholmod::Factorize(Eigen::SparseCompressedBase<Derived> const& A, ESparseStorage storage)
 {
-    if (mCholmodL == NULL)
+    if (not IsAnalyzed(A, storage))
         Analyze(A, storage);
 
-    cholmod_sparse cholmod_A;
+    cholmod_sparse cholmod_A{};
     ToCholmodView(A, storage, cholmod_A);
-    int const ec = cholmod_factorize(&cholmod_A, mCholmodL, &mCholmodCommon);
-    return ec == 1;
+    return Factorize(cholmod_A);
 }
 
 template <class Derived>
@@ -102,43 +372,81 @@ inline bool Cholmod::Compute(Eigen::SparseCompressedBase<Derived> const& A, ESpa
     return Factorize(A, storage);
 }
 
+template <class Derived>
+inline bool Cholmod::Refactorize(Eigen::SparseCompressedBase<Derived> const& A)
+{
+    if (not IsAnalyzed(A, mAnalyzedStorage))
+    {
+        throw std::invalid_argument(
+            "Numerical refactorization requires a matrix with the analyzed sparsity pattern, see "
+            "Analyze()");
+    }
+    cholmod_sparse cholmod_A{};
+    ToCholmodView(A, mAnalyzedStorage, cholmod_A);
+    return Factorize(cholmod_A);
+}
+
+template <class Derived>
+inline bool
+Cholmod::IsAnalyzed(Eigen::SparseCompressedBase<Derived> const& A, ESparseStorage storage) const
+{
+    if (mCholmodL == NULL or storage != mAnalyzedStorage or A.innerSize() != mAnalyzedRows or
+        A.outerSize() + 1 != mAnalyzedP.size() or A.nonZeros() != mAnalyzedI.size() or
+        not A.isCompressed())
+        return false;
+    auto const* p = A.outerIndexPtr();
+    auto const* i = A.innerIndexPtr();
+    return std::equal(p, p + mAnalyzedP.size(), mAnalyzedP.data()) and
+           std::equal(i, i + mAnalyzedI.size(), mAnalyzedI.data());
+}
+
 template <class Derived>
 inline bool Cholmod::Update(Eigen::SparseCompressedBase<Derived> const& U)
 {
-    cholmod_sparse cholmod_U{};
-    ToCholmodView(U, ESparseStorage::Unsymmetric, cholmod_U);
-    cholmod_sparse* cholmod_PU = cholmod_submatrix(
-        &cholmod_U,
-        static_cast<std::int32_t*>(mCholmodL->Perm) /*Fill-reducing permutation*/,
-        static_cast<long long>(mCholmodL->n) /*Number of rows*/,
-        NULL /*No column permutation*/,
-        -1 /*all columns*/,
-        1 /*TRUE*/,
-        1 /*TRUE*/,
-        &mCholmodCommon);
-    int const ec = cholmod_updown(1 /*TRUE == update*/, cholmod_PU, mCholmodL, &mCholmodCommon);
-    cholmod_free_sparse(&cholmod_PU, &mCholmodCommon);
-    return ec == 1 /*success*/;
+    for (Index j = 0; j < U.outerSize(); ++j)
+    {
+        auto const begin = U.outerIndexPtr()[j];
+        auto const end   = U.outerIndexPtr()[j + 1];
+        auto const k     = static_cast<Eigen::Index>(end - begin);
+        StageUpdate(
+            Eigen::Map<IndexVectorType const>(U.innerIndexPtr() + begin, k),
+            Eigen::Map<VectorX const>(U.valuePtr() + begin, k));
+    }
+    return ApplyStagedUpdates();
 }
 
 template <class Derived>
 inline bool Cholmod::Downdate(Eigen::SparseCompressedBase<Derived> const& U)
 {
-    // NOTE: Implementation copied from Update, except that FALSE is passed to cholmod_update(...)
-    cholmod_sparse cholmod_U{};
-    ToCholmodView(U, ESparseStorage::Unsymmetric, cholmod_U);
-    cholmod_sparse* cholmod_PU = cholmod_submatrix(
-        &cholmod_U,
-        static_cast<std::int32_t*>(mCholmodL->Perm) /*Fill-reducing permutation*/,
-        static_cast<long long>(mCholmodL->n) /*Number of rows*/,
-        NULL /*No column permutation*/,
-        -1 /*all columns*/,
-        1 /*TRUE*/,
-        1 /*TRUE*/,
-        &mCholmodCommon);
-    int const ec = cholmod_updown(0 /*FALSE == downdate*/, cholmod_PU, mCholmodL, &mCholmodCommon);
-    cholmod_free_sparse(&cholmod_PU, &mCholmodCommon);
-    return ec == 1 /*success*/;
+    for (Index j = 0; j < U.outerSize(); ++j)
+    {
+        auto const begin = U.outerIndexPtr()[j];
+        auto const end   = U.outerIndexPtr()[j + 1];
+        auto const k     = static_cast<Eigen::Index>(end - begin);
+        StageDowndate(
+            Eigen::Map<IndexVectorType const>(U.innerIndexPtr() + begin, k),
+            Eigen::Map<VectorX const>(U.valuePtr() + begin, k));
+    }
+    return ApplyStagedUpdates();
+}
+
+template <class TDerivedI, class TDerivedW>
+inline void
+Cholmod::StageUpdate(Eigen::DenseBase<TDerivedI> const& rows, Eigen::DenseBase<TDerivedW> const& w)
+{
+    auto const col = static_cast<std::int32_t>(mStagedUpdateRank++);
+    for (Index k = 0; k < rows.size(); ++k)
+        mStagedUpdates.emplace_back(static_cast<std::int32_t>(rows(k)), col, w(k));
+}
+
+template <class TDerivedI, class TDerivedW>
+inline void Cholmod::StageDowndate(
+    Eigen::DenseBase<TDerivedI> const& rows,
+    Eigen::DenseBase<TDerivedW> const& w)
+{
+    auto const col = static_cast<std::int32_t>(mStagedDowndateRank++);
+    for (Index k = 0; k < rows.size(); ++k)
+        mStagedDowndates.emplace_back(static_cast<std::int32_t>(rows(k)), col, w(k));
 }
 
 template <class Derived>
@@ -159,6 +467,7 @@ inline void Cholmod::ToCholmodView(
     cholmod_A.stype  = static_cast<std::int32_t>(storage);
     cholmod_A.itype  = CHOLMOD_INT;
     cholmod_A.xtype  = CHOLMOD_REAL;
+    cholmod_A.dtype  = CHOLMOD_DOUBLE;
     cholmod_A.sorted = 1 /*TRUE*/;
     cholmod_A.packed = 1 /*TRUE*/;
 }
@@ -170,4 +479,4 @@ inline void Cholmod::ToCholmodView(
     // clang-format off
 #endif // PBAT_MATH_LINALG_CHOLMOD_H
 #endif // PBAT_USE_SUITESPARSE
-// clang-format on
\ No newline at end of file
+// clang-format on
@@ -0,0 +1,128 @@
+#include "ConjugateGradient.h"
+
+#include "BlockSparseMatrix.h"
+
+#include <cmath>
+#include <Eigen/Cholesky>
+#include <doctest/doctest.h>
+#include <unsupported/Eigen/KroneckerProduct>
+
+TEST_CASE("[math][linalg] ConjugateGradient")
+{
+    using namespace pbat;
+    // 1D Laplacian with Dirichlet boundaries, shifted to be well-conditioned
+    auto constexpr n = 50;
+    auto constexpr m = 3;
+    MatrixX Adense   = MatrixX::Zero(n, n);
+    Adense.diagonal().setConstant(Scalar(2.1));
+    Adense.diagonal(1).setConstant(Scalar(-1));
+    Adense.diagonal(-1).setConstant(Scalar(-1));
+    CSCMatrix const A = Adense.sparseView();
+    math::linalg::BlockSparseMatrix<1> const Aop(A);
+    MatrixX const B = MatrixX::Random(n, m);
+    math::linalg::KrylovSettings settings{};
+    settings.rtol = 1e-10;
+    auto const checkSolution = [&](MatrixX const& X, math::linalg::KrylovResult const& result) {
+        CHECK(result.IsConverged());
+        REQUIRE_EQ(X.rows(), n);
+        REQUIRE_EQ(X.cols(), m);
+        for (auto j = 0; j < m; ++j)
+        {
+            CHECK_LE((B.col(j) - A * X.col(j)).norm(), 1e-10 * B.col(j).norm());
+            CHECK_LE(result.residuals(j), 1e-10 * B.col(j).norm());
+        }
+    };
+    SUBCASE("Unpreconditioned")
+    {
+        MatrixX X{};
+        settings.bStoreResidualHistory = true;
+        auto const result = math::linalg::ConjugateGradient(
+            Aop,
+            B,
+            X,
+            math::linalg::IdentityPreconditioner{},
+            settings);
+        checkSolution(X, result);
+        // In exact arithmetic, CG converges in at most n iterations
+        CHECK_LE(result.iterations.maxCoeff(), n);
+        REQUIRE_EQ(result.residualHistory.rows(), result.iterations.maxCoeff() + 1);
+        for (auto j = 0; j < m; ++j)
+        {
+            CHECK_LE(std::abs(result.residualHistory(0, j) - B.col(j).norm()), 1e-10);
+            CHECK_EQ(result.residualHistory(result.iterations(j), j), result.residuals(j));
+        }
+    }
+    SUBCASE("Warm start")
+    {
+        MatrixX X         = Adense.llt().solve(B);
+        auto const result = math::linalg::ConjugateGradient(
+            Aop,
+            B,
+            X,
+            math::linalg::IdentityPreconditioner{},
+            settings);
+        CHECK(result.IsConverged());
+        CHECK_EQ(result.iterations.maxCoeff(), 0);
+    }
+    SUBCASE("Jacobi")
+    {
+        MatrixX X{};
+        auto const result = math::linalg::ConjugateGradient(
+            Aop,
+            B,
+            X,
+            math::linalg::JacobiPreconditioner(A),
+            settings);
+        checkSolution(X, result);
+    }
+    SUBCASE("Incomplete Cholesky")
+    {
+        // Tridiagonal matrices have no fill, i.e. the preconditioner is exact
+        MatrixX X{};
+        auto const result = math::linalg::ConjugateGradient(
+            Aop,
+            B,
+            X,
+            math::linalg::IncompleteCholeskyPreconditioner(A),
+            settings);
+        checkSolution(X, result);
+        CHECK_LE(result.iterations.maxCoeff(), 2);
+    }
+    SUBCASE("Block Jacobi")
+    {
+        // Nodal 3x3 blocks coupled along a chain, as in vector-valued FEM systems
+        auto constexpr kDims  = 3;
+        auto constexpr nNodes = n / 2;
+        Matrix<kDims, kDims> const K   = Matrix<kDims, kDims>::Random();
+        Matrix<kDims, kDims> const Kii = K.transpose() * K;
+        Matrix<kDims, kDims> const I   = Matrix<kDims, kDims>::Identity();
+        MatrixX const T                = Adense.topLeftCorner(nNodes, nNodes);
+        MatrixX const Ad               = MatrixX(Eigen::kroneckerProduct(T, I)) +
+                           MatrixX(Eigen::kroneckerProduct(MatrixX::Identity(nNodes, nNodes), Kii));
+        CSCMatrix const A3             = Ad.sparseView();
+        math::linalg::BlockSparseMatrix<1> const A3op(A3);
+        MatrixX const B3 = MatrixX::Random(kDims * nNodes, m);
+        MatrixX X{};
+        auto const result = math::linalg::ConjugateGradient(
+            A3op,
+            B3,
+            X,
+            math::linalg::BlockJacobiPreconditioner<kDims>(A3),
+            settings);
+        CHECK(result.IsConverged());
+        CHECK_LE((B3 - A3 * X).norm(), 1e-10 * B3.norm() * std::sqrt(Scalar(m)));
+    }
+    SUBCASE("Iteration budget")
+    {
+        MatrixX X{};
+        settings.maxIterations = 2;
+        auto const result      = math::linalg::ConjugateGradient(
+            Aop,
+            B,
+            X,
+            math::linalg::IdentityPreconditioner{},
+            settings);
+        CHECK_FALSE(result.IsConverged());
+        CHECK_EQ(result.iterations.maxCoeff(), 2);
+    }
+}
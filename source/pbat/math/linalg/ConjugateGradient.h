@@ -0,0 +1,115 @@
+/**
+ * @file ConjugateGradient.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Preconditioned conjugate gradient solver for matrix-free linear operators
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_MATH_LINALG_CONJUGATEGRADIENT_H
+#define PBAT_MATH_LINALG_CONJUGATEGRADIENT_H
+
+#include "Krylov.h"
+#include "Preconditioners.h"
+#include "pbat/Aliases.h"
+#include "pbat/math/LinearOperator.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <exception>
+#include <fmt/core.h>
+#include <string>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Solves \f$ \mathbf{A} \mathbf{X} = \mathbf{B} \f$ for symmetric positive definite
+ * \f$ \mathbf{A} \f$ by preconditioned conjugate gradients
+ *
+ * All right-hand sides are iterated in lock-step, such that each iteration applies A and M once to
+ * the block of unconverged columns. A is only accessed through Apply, i.e. it need not be
+ * assembled.
+ *
+ * @tparam TLinearOperator Linear operator type
+ * @tparam TPreconditioner Preconditioner type
+ * @param A `n x n` symmetric positive definite linear operator
+ * @param B `n x k` right-hand sides
+ * @param X `n x k` initial guess (i.e. warm start), or empty for a zero initial guess. Overwritten
+ * by the solution.
+ * @param M Symmetric positive definite preconditioner
+ * @param settings Solver settings
+ * @return Convergence telemetry. Columns whose curvature \f$ \mathbf{p}^T \mathbf{A} \mathbf{p} \f$
+ * is not positive terminate without converging.
+ */
+template <CLinearOperator TLinearOperator, CPreconditioner TPreconditioner = IdentityPreconditioner>
+KrylovResult ConjugateGradient(
+    TLinearOperator const& A,
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X,
+    TPreconditioner const& M       = TPreconditioner{},
+    KrylovSettings const& settings = KrylovSettings{});
+
+template <CLinearOperator TLinearOperator, CPreconditioner TPreconditioner>
+inline KrylovResult ConjugateGradient(
+    TLinearOperator const& A,
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X,
+    TPreconditioner const& M,
+    KrylovSettings const& settings)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.ConjugateGradient");
+    Index const n = A.InputDimensions();
+    if (A.OutputDimensions() != n)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected square linear operator, but got {}x{}",
+            A.OutputDimensions(),
+            n));
+    }
+    detail::KrylovBlock block(B, X, n, settings);
+    // R = B - A X
+    MatrixX R = B;
+    {
+        MatrixX AX = MatrixX::Zero(n, B.cols());
+        A.Apply(X, AX);
+        R -= AX;
+    }
+    MatrixX Z{}, P{}, Q{};
+    VectorX rz{}, pq{}, alpha{};
+    auto const bNoBreakdown = [](Index) {
+        return false;
+    };
+    if (not block.Monitor(0, R.colwise().norm().transpose(), bNoBreakdown, R))
+        return block.Result();
+    M.Solve(R, Z);
+    P  = Z;
+    rz = detail::ColwiseDot(R, Z);
+    for (Index iter = 1;; ++iter)
+    {
+        Q.setZero(n, P.cols());
+        A.Apply(P, Q);
+        pq    = detail::ColwiseDot(P, Q);
+        alpha = (pq.array() > Scalar(0)).select(rz.array() / pq.array(), Scalar(0)).matrix();
+        for (Index j = 0; j < block.Active(); ++j)
+            X.col(block.Column(j)) += alpha(j) * P.col(j);
+        R -= Q * alpha.asDiagonal();
+        auto const bIsBrokenDown = [&](Index j) {
+            return not(pq(j) > Scalar(0));
+        };
+        if (not block.Monitor(iter, R.colwise().norm().transpose(), bIsBrokenDown, R, P, rz))
+            break;
+        M.Solve(R, Z);
+        VectorX const rzNext = detail::ColwiseDot(R, Z);
+        P                    = Z + P * rzNext.cwiseQuotient(rz).asDiagonal();
+        rz                   = rzNext;
+    }
+    return block.Result();
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_CONJUGATEGRADIENT_H
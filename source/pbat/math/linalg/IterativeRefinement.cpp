@@ -0,0 +1,88 @@
+#include "IterativeRefinement.h"
+
+#include "BlockSparseMatrix.h"
+#include "ConjugateGradient.h"
+#include "SparseLdlt.h"
+
+#include <doctest/doctest.h>
+#include <vector>
+
+TEST_CASE("[math][linalg] IterativeRefinement")
+{
+    using namespace pbat;
+    // Arrange
+    // Shifted graph Laplacian of a regular grid
+    Index constexpr nx = 31;
+    Index constexpr ny = 23;
+    Index constexpr n  = nx * ny;
+    Index constexpr m  = 4;
+    std::vector<Eigen::Triplet<Scalar, CSCMatrix::StorageIndex>> triplets{};
+    for (Index j = 0; j < ny; ++j)
+    {
+        for (Index i = 0; i < nx; ++i)
+        {
+            auto const v = static_cast<CSCMatrix::StorageIndex>(j * nx + i);
+            triplets.emplace_back(v, v, Scalar(4.01));
+            if (i + 1 < nx)
+            {
+                triplets.emplace_back(v, v + 1, Scalar(-1));
+                triplets.emplace_back(v + 1, v, Scalar(-1));
+            }
+            if (j + 1 < ny)
+            {
+                triplets.emplace_back(v, v + nx, Scalar(-1));
+                triplets.emplace_back(v + nx, v, Scalar(-1));
+            }
+        }
+    }
+    CSCMatrix A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    math::linalg::BlockSparseMatrix<1> const Aop(A);
+    MatrixX const Xexact = MatrixX::Random(n, m);
+    MatrixX const B      = A * Xexact;
+    auto const error     = [&](MatrixX const& X) {
+        return (X - Xexact).norm() / Xexact.norm();
+    };
+
+    math::linalg::SparseLdlt::Settings ldltSettings{};
+    ldltSettings.ePrecision = math::linalg::SparseLdlt::EPrecision::Single;
+    math::linalg::SparseLdlt LDLT(ldltSettings);
+    REQUIRE(LDLT.Compute(A));
+    // A single precision factor alone only yields single precision accuracy
+    Scalar const singlePrecisionError = error(LDLT.Solve(B));
+    CHECK_GT(singlePrecisionError, Scalar(1e-10));
+    CHECK_LT(singlePrecisionError, Scalar(1e-3));
+
+    math::linalg::KrylovSettings settings{};
+    settings.rtol                  = 1e-13;
+    settings.bStoreResidualHistory = true;
+    SUBCASE("Iterative refinement recovers double precision accuracy")
+    {
+        MatrixX X{};
+        auto const result = math::linalg::IterativeRefinement(Aop, B, X, LDLT, settings);
+        CHECK(result.IsConverged());
+        CHECK_LE(result.iterations.maxCoeff(), 6);
+        CHECK_LE(error(X), Scalar(1e-11));
+        // Residuals contract geometrically
+        for (auto j = 0; j < m; ++j)
+            for (auto k = 0; k < result.iterations(j); ++k)
+                CHECK_LT(result.residualHistory(k + 1, j), result.residualHistory(k, j));
+    }
+    SUBCASE("Single precision factor preconditions conjugate gradients")
+    {
+        MatrixX X{};
+        auto const result = math::linalg::ConjugateGradient(Aop, B, X, LDLT, settings);
+        CHECK(result.IsConverged());
+        CHECK_LE(result.iterations.maxCoeff(), 6);
+        CHECK_LE(error(X), Scalar(1e-11));
+    }
+    SUBCASE("Stagnation is reported as non-convergence")
+    {
+        MatrixX X{};
+        settings.rtol     = 0;
+        auto const result = math::linalg::IterativeRefinement(Aop, B, X, LDLT, settings);
+        CHECK_FALSE(result.IsConverged());
+        CHECK_LT(result.iterations.maxCoeff(), settings.maxIterations);
+        CHECK_LE(error(X), Scalar(1e-11));
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * @file IterativeRefinement.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Mixed precision iterative refinement of approximate direct solves
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_MATH_LINALG_ITERATIVEREFINEMENT_H
+#define PBAT_MATH_LINALG_ITERATIVEREFINEMENT_H
+
+#include "Krylov.h"
+#include "Preconditioners.h"
+#include "pbat/Aliases.h"
+#include "pbat/math/LinearOperator.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <exception>
+#include <fmt/core.h>
+#include <string>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Solves \f$ \mathbf{A} \mathbf{X} = \mathbf{B} \f$ by iterative refinement of an
+ * approximate solver S
+ *
+ * Each iteration corrects \f$ \mathbf{X} \leftarrow \mathbf{X} + \mathbf{S}(\mathbf{B} -
+ * \mathbf{A}\mathbf{X}) \f$, where residuals are computed with the double precision operator A.
+ * With a single precision factorization S of A (e.g. SparseLdlt or Cholmod with
+ * `EPrecision::Single`), the error contracts by roughly \f$ \kappa(\mathbf{A}) \epsilon_{single}
+ * \f$ per iteration, i.e. double precision accuracy is reached in a few iterations as long as
+ * \f$ \kappa(\mathbf{A}) \ll 10^7 \f$. Columns whose residual stops decreasing are reported as not
+ * converged. For worse conditioned systems, use S as preconditioner of ConjugateGradient() instead.
+ *
+ * @tparam TLinearOperator Linear operator type
+ * @tparam TSolver Approximate solver type
+ * @param A `n x n` linear operator
+ * @param B `n x k` right-hand sides
+ * @param X `n x k` initial guess (i.e. warm start), or empty for a zero initial guess. Overwritten
+ * by the solution.
+ * @param S Approximate solver of A, e.g. a low precision factorization of A
+ * @param settings Solver settings
+ * @return Convergence telemetry
+ */
+template <CLinearOperator TLinearOperator, CPreconditioner TSolver>
+KrylovResult IterativeRefinement(
+    TLinearOperator const& A,
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X,
+    TSolver const& S,
+    KrylovSettings const& settings = KrylovSettings{});
+
+template <CLinearOperator TLinearOperator, CPreconditioner TSolver>
+inline KrylovResult IterativeRefinement(
+    TLinearOperator const& A,
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X,
+    TSolver const& S,
+    KrylovSettings const& settings)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.IterativeRefinement");
+    Index const n = A.InputDimensions();
+    if (A.OutputDimensions() != n)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected square linear operator, but got {}x{}",
+            A.OutputDimensions(),
+            n));
+    }
+    detail::KrylovBlock block(B, X, n, settings);
+    // R = B - A X
+    MatrixX R = B;
+    {
+        MatrixX AX = MatrixX::Zero(n, B.cols());
+        A.Apply(X, AX);
+        R -= AX;
+    }
+    VectorX rnorm           = R.colwise().norm().transpose();
+    auto const bNoBreakdown = [](Index) {
+        return false;
+    };
+    if (not block.Monitor(0, rnorm, bNoBreakdown, R))
+        return block.Result();
+    MatrixX D{}, Xa{}, AXa{};
+    for (Index iter = 1;; ++iter)
+    {
+        S.Solve(R, D);
+        // Residuals are recomputed from the refined solution, since recursively updated residuals
+        // keep decreasing even once the solution stops improving
+        Index const k = block.Active();
+        Xa.resize(n, k);
+        for (Index j = 0; j < k; ++j)
+        {
+            Index const c = block.Column(j);
+            X.col(c) += D.col(j);
+            Xa.col(j) = X.col(c);
+            R.col(j)  = B.col(c);
+        }
+        AXa.setZero(n, k);
+        A.Apply(Xa, AXa);
+        R -= AXa;
+        VectorX const rnormNext  = R.colwise().norm().transpose();
+        auto const bIsStagnating = [&](Index j) {
+            return not(rnormNext(j) < rnorm(j));
+        };
+        if (not block.Monitor(iter, rnormNext, bIsStagnating, R))
+            break;
+        rnorm = R.colwise().norm().transpose();
+    }
+    return block.Result();
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_ITERATIVEREFINEMENT_H
@@ -0,0 +1,229 @@
+/**
+ * @file Krylov.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Settings, convergence telemetry and shared machinery of Krylov subspace solvers
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_MATH_LINALG_KRYLOV_H
+#define PBAT_MATH_LINALG_KRYLOV_H
+
+#include "pbat/Aliases.h"
+
+#include <algorithm>
+#include <exception>
+#include <fmt/core.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Krylov solver settings
+ *
+ * Right-hand side \f$ \mathbf{b} \f$ has converged once its residual satisfies
+ * \f$ |\mathbf{b} - \mathbf{A}\mathbf{x}| \leq \max(\text{rtol} |\mathbf{b}|, \text{atol}) \f$.
+ */
+struct KrylovSettings
+{
+    Index maxIterations{1000};          ///< Maximum number of iterations per right-hand side
+    Scalar rtol{1e-8};                  ///< Residual tolerance relative to the right-hand side
+    Scalar atol{0};                     ///< Absolute residual tolerance
+    bool bStoreResidualHistory{false}; ///< Record residual norms of every iteration
+};
+
+/**
+ * @brief Convergence telemetry of a Krylov solve with `k` right-hand sides
+ */
+struct KrylovResult
+{
+    using BoolVectorX = Eigen::Vector<bool, Eigen::Dynamic>;
+
+    IndexVectorX iterations; ///< `k` iterations per right-hand side
+    VectorX residuals;       ///< `k` residual norms at termination
+    BoolVectorX converged;   ///< `k` convergence flags
+    MatrixX residualHistory; ///< `|# iterations + 1| x k` residual norms per iteration (NaN after
+                             ///< termination), or empty if not requested
+
+    /**
+     * @brief Checks if all right-hand sides converged
+     * @return True if all right-hand sides converged
+     */
+    bool IsConverged() const { return converged.all(); }
+};
+
+namespace detail {
+
+/**
+ * @brief Iterates a Krylov method over all columns of B at once
+ *
+ * Right-hand sides are solved in lock-step, such that each iteration applies the operator and
+ * preconditioner to all active columns in a single (blocked) product. Converged columns are
+ * removed from the working set by compacting the method's state.
+ */
+class KrylovBlock
+{
+  public:
+    /**
+     * @brief Construct a new block of right-hand sides
+     *
+     * @param B `n x k` right-hand sides
+     * @param X `n x k` initial guess, or empty for a zero initial guess
+     * @param n Operator dimensions
+     * @param settings Solver settings
+     */
+    KrylovBlock(
+        Eigen::Ref<MatrixX const> const& B,
+        MatrixX& X,
+        Index n,
+        KrylovSettings const& settings);
+    /**
+     * @brief Number of active right-hand sides
+     * @return Number of active right-hand sides
+     */
+    Index Active() const { return static_cast<Index>(mCols.size()); }
+    /**
+     * @brief Right-hand side of active column j
+     * @param j Active column
+     * @return Index of the right-hand side
+     */
+    Index Column(Index j) const { return mCols[static_cast<std::size_t>(j)]; }
+    /**
+     * @brief Records residual norms of active columns and deactivates converged or broken down
+     * columns, compacting the columns of all given state matrices and per-column scalars
+     *
+     * @tparam FBreakdown Callable bool(Index j) flagging breakdowns of active column j
+     * @tparam TStates Eigen matrices with one column per active column, or vectors with one
+     * coefficient per active column
+     * @param iter Current iteration
+     * @param rnorm Residual norms of active columns
+     * @param fBreakdown Breakdown predicate
+     * @param states State to compact
+     * @return True if some column is still active and the iteration budget is not exhausted
+     */
+    template <class FBreakdown, class... TStates>
+    bool Monitor(
+        Index iter,
+        Eigen::Ref<VectorX const> const& rnorm,
+        FBreakdown fBreakdown,
+        TStates&... states);
+    /**
+     * @brief Convergence telemetry
+     * @return Convergence telemetry, trimmed to the iterations performed
+     */
+    KrylovResult Result();
+
+  private:
+    KrylovSettings mSettings;
+    std::vector<Index> mCols; ///< Right-hand side of each active column
+    VectorX mTolerance;       ///< `k` residual tolerances
+    KrylovResult mResult;
+    Index mIterations; ///< Iterations performed by the block
+};
+
+inline KrylovBlock::KrylovBlock(
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X,
+    Index n,
+    KrylovSettings const& settings)
+    : mSettings(settings), mCols(), mTolerance(), mResult(), mIterations(0)
+{
+    if (B.rows() != n)
+    {
+        throw std::invalid_argument(
+            fmt::format("Expected right-hand sides with {} rows, but got {}", n, B.rows()));
+    }
+    Index const k = B.cols();
+    if (X.size() == 0)
+        X.setZero(n, k);
+    if (X.rows() != n or X.cols() != k)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected initial guess of dimensions {}x{}, but got {}x{}",
+            n,
+            k,
+            X.rows(),
+            X.cols()));
+    }
+    mCols.resize(static_cast<std::size_t>(k));
+    for (Index j = 0; j < k; ++j)
+        mCols[static_cast<std::size_t>(j)] = j;
+    mTolerance = (mSettings.rtol * B.colwise().norm().transpose()).cwiseMax(mSettings.atol);
+    mResult.iterations.setZero(k);
+    mResult.residuals.setZero(k);
+    mResult.converged.setConstant(k, false);
+    if (mSettings.bStoreResidualHistory)
+    {
+        mResult.residualHistory.setConstant(
+            mSettings.maxIterations + 1,
+            k,
+            std::numeric_limits<Scalar>::quiet_NaN());
+    }
+}
+
+template <class FBreakdown, class... TStates>
+inline bool KrylovBlock::Monitor(
+    Index iter,
+    Eigen::Ref<VectorX const> const& rnorm,
+    FBreakdown fBreakdown,
+    TStates&... states)
+{
+    mIterations = std::max(mIterations, iter);
+    std::vector<Index> keep{};
+    keep.reserve(mCols.size());
+    for (Index j = 0; j < Active(); ++j)
+    {
+        Index const c = Column(j);
+        mResult.iterations(c) = iter;
+        mResult.residuals(c)  = rnorm(j);
+        if (mSettings.bStoreResidualHistory)
+            mResult.residualHistory(iter, c) = rnorm(j);
+        mResult.converged(c) = rnorm(j) <= mTolerance(c);
+        if (not mResult.converged(c) and not fBreakdown(j))
+            keep.push_back(j);
+    }
+    if (keep.size() < mCols.size())
+    {
+        auto const compact = [&keep]<class TState>(TState& state) {
+            if constexpr (TState::ColsAtCompileTime == 1)
+                state = state(keep).eval();
+            else
+                state = state(Eigen::placeholders::all, keep).eval();
+        };
+        (compact(states), ...);
+        std::vector<Index> cols(keep.size());
+        for (std::size_t j = 0; j < keep.size(); ++j)
+            cols[j] = mCols[static_cast<std::size_t>(keep[j])];
+        mCols = std::move(cols);
+    }
+    return not mCols.empty() and iter < mSettings.maxIterations;
+}
+
+inline KrylovResult KrylovBlock::Result()
+{
+    if (mSettings.bStoreResidualHistory)
+        mResult.residualHistory.conservativeResize(mIterations + 1, Eigen::NoChange);
+    return mResult;
+}
+
+/**
+ * @brief Column-wise dot products of A and B
+ */
+template <class TDerivedA, class TDerivedB>
+inline VectorX
+ColwiseDot(Eigen::MatrixBase<TDerivedA> const& A, Eigen::MatrixBase<TDerivedB> const& B)
+{
+    return A.cwiseProduct(B).colwise().sum().transpose();
+}
+
+} // namespace detail
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_KRYLOV_H
@@ -18,8 +18,17 @@
 namespace pbat::math::linalg {
 } // namespace pbat::math::linalg
 
+#include "BlockSparseMatrix.h"
+#include "BlockSparsityPattern.h"
 #include "Cholmod.h"
+#include "ConjugateGradient.h"
+#include "IterativeRefinement.h"
+#include "Krylov.h"
+#include "Minres.h"
+#include "MultigridPreconditioner.h"
+#include "Preconditioners.h"
 #include "SelectionMatrix.h"
+#include "SparseLdlt.h"
 #include "SparsityPattern.h"
 #include "mini/Mini.h"
 
@@ -0,0 +1,100 @@
+#include "Minres.h"
+
+#include "BlockSparseMatrix.h"
+
+#include <Eigen/Cholesky>
+#include <Eigen/Eigenvalues>
+#include <doctest/doctest.h>
+
+TEST_CASE("[math][linalg] Minres")
+{
+    using namespace pbat;
+    auto constexpr n = 40;
+    auto constexpr m = 3;
+    MatrixX const B  = MatrixX::Random(n, m);
+    math::linalg::KrylovSettings settings{};
+    settings.rtol          = 1e-10;
+    settings.maxIterations = 4 * n;
+    auto const checkSolution = [&](MatrixX const& A,
+                                   MatrixX const& X,
+                                   math::linalg::KrylovResult const& result) {
+        CHECK(result.IsConverged());
+        REQUIRE_EQ(X.rows(), n);
+        REQUIRE_EQ(X.cols(), m);
+        for (auto j = 0; j < m; ++j)
+        {
+            // The recurrence residual estimate may drift slightly from the true residual
+            CHECK_LE((B.col(j) - A * X.col(j)).norm(), 1e-8 * B.col(j).norm());
+        }
+    };
+    SUBCASE("Symmetric positive definite")
+    {
+        MatrixX Adense = MatrixX::Zero(n, n);
+        Adense.diagonal().setConstant(Scalar(2.1));
+        Adense.diagonal(1).setConstant(Scalar(-1));
+        Adense.diagonal(-1).setConstant(Scalar(-1));
+        CSCMatrix const A = Adense.sparseView();
+        math::linalg::BlockSparseMatrix<1> const Aop(A);
+        SUBCASE("Unpreconditioned")
+        {
+            MatrixX X{};
+            auto const result = math::linalg::Minres(
+                Aop,
+                B,
+                X,
+                math::linalg::IdentityPreconditioner{},
+                settings);
+            checkSolution(Adense, X, result);
+        }
+        SUBCASE("Jacobi")
+        {
+            MatrixX X{};
+            auto const result = math::linalg::Minres(
+                Aop,
+                B,
+                X,
+                math::linalg::JacobiPreconditioner(A),
+                settings);
+            checkSolution(Adense, X, result);
+        }
+        SUBCASE("Warm start")
+        {
+            MatrixX X         = Adense.llt().solve(B);
+            auto const result = math::linalg::Minres(
+                Aop,
+                B,
+                X,
+                math::linalg::IdentityPreconditioner{},
+                settings);
+            CHECK(result.IsConverged());
+            CHECK_EQ(result.iterations.maxCoeff(), 0);
+        }
+    }
+    SUBCASE("Symmetric indefinite")
+    {
+        // Shifting the Laplacian's spectrum past 0 yields an indefinite (but non-singular) system,
+        // on which CG is not applicable
+        MatrixX Adense = MatrixX::Zero(n, n);
+        Adense.diagonal().setConstant(Scalar(2) - Scalar(0.55));
+        Adense.diagonal(1).setConstant(Scalar(-1));
+        Adense.diagonal(-1).setConstant(Scalar(-1));
+        Eigen::SelfAdjointEigenSolver<MatrixX> eigs(Adense);
+        REQUIRE_LT(eigs.eigenvalues().minCoeff(), Scalar(0));
+        REQUIRE_GT(eigs.eigenvalues().maxCoeff(), Scalar(0));
+        CSCMatrix const A = Adense.sparseView();
+        math::linalg::BlockSparseMatrix<1> const Aop(A);
+        MatrixX X{};
+        settings.bStoreResidualHistory = true;
+        auto const result              = math::linalg::Minres(
+            Aop,
+            B,
+            X,
+            math::linalg::IdentityPreconditioner{},
+            settings);
+        checkSolution(Adense, X, result);
+        // MINRES minimizes the residual over growing Krylov subspaces, i.e. residuals are monotone
+        for (auto j = 0; j < m; ++j)
+            for (auto k = 0; k < result.iterations(j); ++k)
+                CHECK_LE(result.residualHistory(k + 1, j), result.residualHistory(k, j) + 1e-12);
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * @file Minres.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Preconditioned MINRES solver for matrix-free symmetric linear operators
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_MATH_LINALG_MINRES_H
+#define PBAT_MATH_LINALG_MINRES_H
+
+#include "Krylov.h"
+#include "Preconditioners.h"
+#include "pbat/Aliases.h"
+#include "pbat/math/LinearOperator.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <exception>
+#include <fmt/core.h>
+#include <string>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Solves \f$ \mathbf{A} \mathbf{X} = \mathbf{B} \f$ for symmetric (possibly indefinite)
+ * \f$ \mathbf{A} \f$ by preconditioned MINRES @cite paige1975solution
+ *
+ * All right-hand sides are iterated in lock-step, such that each iteration applies A and M once to
+ * the block of unconverged columns. Residual norms are MINRES' recurrence estimates
+ * \f$ |\mathbf{r}_0| \prod_i |s_i| \f$, where \f$ s_i \f$ are the sines of the Givens
+ * rotations, which avoids an additional operator application per iteration.
+ *
+ * @tparam TLinearOperator Linear operator type
+ * @tparam TPreconditioner Preconditioner type
+ * @param A `n x n` symmetric linear operator
+ * @param B `n x k` right-hand sides
+ * @param X `n x k` initial guess (i.e. warm start), or empty for a zero initial guess. Overwritten
+ * by the solution.
+ * @param M Symmetric positive definite preconditioner
+ * @param settings Solver settings
+ * @return Convergence telemetry. Columns whose Lanczos process breaks down terminate without
+ * converging.
+ */
+template <CLinearOperator TLinearOperator, CPreconditioner TPreconditioner = IdentityPreconditioner>
+KrylovResult Minres(
+    TLinearOperator const& A,
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X,
+    TPreconditioner const& M       = TPreconditioner{},
+    KrylovSettings const& settings = KrylovSettings{});
+
+template <CLinearOperator TLinearOperator, CPreconditioner TPreconditioner>
+inline KrylovResult Minres(
+    TLinearOperator const& A,
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X,
+    TPreconditioner const& M,
+    KrylovSettings const& settings)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.Minres");
+    Index const n = A.InputDimensions();
+    if (A.OutputDimensions() != n)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected square linear operator, but got {}x{}",
+            A.OutputDimensions(),
+            n));
+    }
+    detail::KrylovBlock block(B, X, n, settings);
+    // Preconditioned Lanczos vectors V, W = M^{-1} V
+    MatrixX Vnext = B;
+    {
+        MatrixX AX = MatrixX::Zero(n, B.cols());
+        A.Apply(X, AX);
+        Vnext -= AX;
+    }
+    VectorX rnorm = Vnext.colwise().norm().transpose();
+
+    auto const bNoBreakdown = [](Index) {
+        return false;
+    };
+    if (not block.Monitor(0, rnorm, bNoBreakdown, Vnext, rnorm))
+        return block.Result();
+    Index const k = Vnext.cols();
+    MatrixX Wnext{};
+    M.Solve(Vnext, Wnext);
+    VectorX betaNext = detail::ColwiseDot(Vnext, Wnext).cwiseMax(Scalar(0)).cwiseSqrt();
+    VectorX betaOne  = betaNext;
+    // Givens rotations of the tridiagonal Lanczos matrix' QR factorization
+    VectorX c     = VectorX::Ones(k);
+    VectorX cPrev = VectorX::Ones(k);
+    VectorX s     = VectorX::Zero(k);
+    VectorX sPrev = VectorX::Zero(k);
+    VectorX eta   = VectorX::Ones(k);
+    MatrixX V     = MatrixX::Zero(n, k);
+    MatrixX Vprev = MatrixX::Zero(n, k);
+    MatrixX W     = MatrixX::Zero(n, k);
+    // Search directions
+    MatrixX D      = MatrixX::Zero(n, k);
+    MatrixX Dprev  = MatrixX::Zero(n, k);
+    MatrixX Dprev2 = MatrixX::Zero(n, k);
+    VectorX alpha{}, beta{}, r1{};
+    for (Index iter = 1;; ++iter)
+    {
+        // Lanczos step
+        beta = betaNext;
+        Vprev.swap(V);
+        V = Vnext * beta.cwiseInverse().asDiagonal();
+        W = Wnext * beta.cwiseInverse().asDiagonal();
+        Vnext.noalias() = -(Vprev * beta.asDiagonal());
+        A.Apply(W, Vnext);
+        alpha = detail::ColwiseDot(Vnext, W);
+        Vnext -= V * alpha.asDiagonal();
+        M.Solve(Vnext, Wnext);
+        betaNext = detail::ColwiseDot(Vnext, Wnext).cwiseMax(Scalar(0)).cwiseSqrt();
+        // Apply previous rotations to the new column of the tridiagonal matrix, and eliminate its
+        // sub-diagonal with a new rotation
+        VectorX const r2    = s.cwiseProduct(alpha) + c.cwiseProduct(cPrev).cwiseProduct(beta);
+        VectorX const r3    = sPrev.cwiseProduct(beta);
+        VectorX const r1hat = c.cwiseProduct(alpha) - cPrev.cwiseProduct(s).cwiseProduct(beta);
+        // New rotation
+        r1    = (r1hat.array().square() + betaNext.array().square()).sqrt().matrix();
+        cPrev = c;
+        sPrev = s;
+        c     = r1hat.cwiseQuotient(r1);
+        s     = betaNext.cwiseQuotient(r1);
+        // Update search directions and solution
+        Dprev2.swap(Dprev);
+        Dprev.swap(D);
+        D = (W - Dprev * r2.asDiagonal() - Dprev2 * r3.asDiagonal()) *
+            r1.cwiseInverse().asDiagonal();
+        VectorX const step = betaOne.cwiseProduct(c).cwiseProduct(eta);
+        for (Index j = 0; j < block.Active(); ++j)
+            if (r1(j) > Scalar(0))
+                X.col(block.Column(j)) += step(j) * D.col(j);
+        rnorm = rnorm.cwiseProduct(s.cwiseAbs());
+        eta   = -s.cwiseProduct(eta);
+        auto const bIsBrokenDown = [&](Index j) {
+            return not(r1(j) > Scalar(0)) or not(betaNext(j) > Scalar(0));
+        };
+        if (not block.Monitor(
+                iter,
+                rnorm,
+                bIsBrokenDown,
+                Vnext,
+                Wnext,
+                V,
+                W,
+                D,
+                Dprev,
+                Dprev2,
+                betaNext,
+                betaOne,
+                c,
+                cPrev,
+                s,
+                sPrev,
+                eta,
+                rnorm))
+            break;
+    }
+    return block.Result();
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_MINRES_H
@@ -0,0 +1,104 @@
+/**
+ * @file MultigridPreconditioner.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Galerkin multigrid V-cycle preconditioner
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_MATH_LINALG_MULTIGRIDPRECONDITIONER_H
+#define PBAT_MATH_LINALG_MULTIGRIDPRECONDITIONER_H
+
+#include "PhysicsBasedAnimationToolkitExport.h"
+#include "SparseLdlt.h"
+#include "pbat/Aliases.h"
+
+#include <vector>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Multigrid V-cycle settings
+ */
+struct MultigridSettings
+{
+    Index nSmoothingIters{2};            ///< Pre- and post-smoothing Jacobi sweeps per level
+    Scalar omega{Scalar(2) / Scalar(3)}; ///< Jacobi damping factor
+};
+
+/**
+ * @brief Multigrid preconditioner applying one V-cycle per solve
+ *
+ * Given prolongation operators \f$ \mathbf{P}_l \f$ from level \f$ l+1 \f$ to level \f$ l \f$,
+ * coarse operators are Galerkin projections \f$ \mathbf{A}_{l+1} = \mathbf{P}_l^T \mathbf{A}_l
+ * \mathbf{P}_l \f$. Levels are smoothed by damped Jacobi, and the coarsest level is solved
+ * exactly by SparseLdlt. Since pre- and post-smoothing sweeps are symmetric, the V-cycle is a
+ * symmetric positive definite preconditioner for symmetric positive definite \f$ \mathbf{A} \f$,
+ * i.e. it is suitable for ConjugateGradient() and Minres().
+ *
+ * Geometric hierarchies obtain \f$ \mathbf{P}_l \f$ by interpolating coarse mesh shape functions
+ * at fine mesh nodes, e.g. sim::vbd::multigrid::Level::ProlongationMatrix() for VBD's cage
+ * meshes.
+ */
+class MultigridPreconditioner
+{
+  public:
+    using Settings = MultigridSettings; ///< V-cycle settings
+
+    MultigridPreconditioner() = default;
+    /**
+     * @brief Construct a multigrid hierarchy of A
+     *
+     * @param A `n x n` symmetric positive definite sparse matrix, with both triangles stored
+     * @param P Prolongations from coarse to fine levels, finest first, i.e. P[0] has n rows
+     * @param settings V-cycle settings
+     * @throw std::invalid_argument if prolongation dimensions are inconsistent
+     * @throw std::runtime_error if the coarsest operator cannot be factorized
+     */
+    PBAT_API MultigridPreconditioner(
+        CSCMatrix const& A,
+        std::vector<CSCMatrix> P,
+        Settings const& settings = Settings{});
+
+    /**
+     * @brief Applies one V-cycle with zero initial guess to all columns of R
+     *
+     * @param R `n x k` residuals
+     * @param Z `n x k` preconditioned residuals
+     */
+    PBAT_API void Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const;
+
+    /**
+     * @brief Number of levels, including the finest
+     * @return Number of levels
+     */
+    Index Levels() const { return static_cast<Index>(mA.size()); }
+    /**
+     * @brief Galerkin operator of level l
+     * @param l Level, 0 being the finest
+     * @return Level l's operator
+     */
+    CSCMatrix const& Operator(Index l) const { return mA[static_cast<std::size_t>(l)]; }
+
+  private:
+    /**
+     * @brief Solves level l's problem A_l X = B approximately, starting from X = 0
+     */
+    void VCycle(std::size_t l, MatrixX const& B, MatrixX& X) const;
+    void Smooth(std::size_t l, MatrixX const& B, MatrixX& X) const;
+
+    Settings mSettings;
+    std::vector<CSCMatrix> mA;  ///< Galerkin operators, finest first
+    std::vector<CSCMatrix> mP;  ///< Prolongations, finest first
+    std::vector<VectorX> mDinv; ///< Inverse diagonals of smoothed levels
+    SparseLdlt mCoarseSolver;   ///< Factorization of the coarsest operator
+};
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_MULTIGRIDPRECONDITIONER_H
@@ -0,0 +1,136 @@
+#include "Preconditioners.h"
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+JacobiPreconditioner::JacobiPreconditioner(Eigen::Ref<VectorX const> const& D)
+    : mDinv(D.size())
+{
+    for (auto i = 0; i < D.size(); ++i)
+    {
+        Scalar const d = std::abs(D(i));
+        mDinv(i)       = d > std::numeric_limits<Scalar>::min() ? Scalar(1) / d : Scalar(1);
+    }
+}
+
+JacobiPreconditioner::JacobiPreconditioner(CSCMatrix const& A)
+    : JacobiPreconditioner(VectorX(A.diagonal()))
+{
+    if (A.rows() != A.cols())
+    {
+        throw std::invalid_argument(
+            fmt::format("Expected square matrix, but got {}x{}", A.rows(), A.cols()));
+    }
+}
+
+void JacobiPreconditioner::Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.JacobiPreconditioner.Solve");
+    if (R.rows() != mDinv.size())
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected residuals with {} rows, but got {}",
+            mDinv.size(),
+            R.rows()));
+    }
+    Z = mDinv.asDiagonal() * R;
+}
+
+IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(
+    CSCMatrix const& A,
+    Scalar initialShift)
+    : mIC()
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.IncompleteCholeskyPreconditioner.Construct");
+    mIC.setInitialShift(initialShift);
+    mIC.compute(A);
+    if (mIC.info() != Eigen::Success)
+        throw std::runtime_error("Incomplete Cholesky factorization failed");
+}
+
+void IncompleteCholeskyPreconditioner::Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.IncompleteCholeskyPreconditioner.Solve");
+    Z = mIC.solve(R);
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#include <Eigen/Cholesky>
+#include <doctest/doctest.h>
+
+TEST_CASE("[math][linalg] Preconditioners")
+{
+    using namespace pbat;
+    auto constexpr kDims  = 3;
+    auto constexpr nNodes = 6;
+    auto constexpr n      = kDims * nNodes;
+    auto constexpr m      = 2;
+    Scalar constexpr zero = 1e-12;
+    // Block tridiagonal SPD matrix with coupled nodal blocks
+    Matrix<kDims, kDims> const K = Matrix<kDims, kDims>::Random();
+    Matrix<kDims, kDims> const Kii =
+        K.transpose() * K + Scalar(4) * Matrix<kDims, kDims>::Identity();
+    MatrixX Adense = MatrixX::Zero(n, n);
+    for (auto i = 0; i < nNodes; ++i)
+    {
+        Adense.block<kDims, kDims>(i * kDims, i * kDims) = Kii;
+        if (i + 1 < nNodes)
+        {
+            Adense.block<kDims, kDims>(i * kDims, (i + 1) * kDims) =
+                -Matrix<kDims, kDims>::Identity();
+            Adense.block<kDims, kDims>((i + 1) * kDims, i * kDims) =
+                -Matrix<kDims, kDims>::Identity();
+        }
+    }
+    CSCMatrix const A = Adense.sparseView();
+    MatrixX const R   = MatrixX::Random(n, m);
+    MatrixX Z{};
+
+    CHECK(math::linalg::CPreconditioner<math::linalg::IdentityPreconditioner>);
+    CHECK(math::linalg::CPreconditioner<math::linalg::JacobiPreconditioner>);
+    CHECK(math::linalg::CPreconditioner<math::linalg::BlockJacobiPreconditioner<kDims>>);
+    CHECK(math::linalg::CPreconditioner<math::linalg::IncompleteCholeskyPreconditioner>);
+    SUBCASE("Identity")
+    {
+        math::linalg::IdentityPreconditioner const M{};
+        M.Solve(R, Z);
+        CHECK_LE((Z - R).norm(), zero);
+    }
+    SUBCASE("Jacobi")
+    {
+        math::linalg::JacobiPreconditioner const M(A);
+        M.Solve(R, Z);
+        MatrixX const ZExpected = Adense.diagonal().cwiseInverse().asDiagonal() * R;
+        CHECK_LE((Z - ZExpected).norm(), zero);
+    }
+    SUBCASE("Block Jacobi")
+    {
+        math::linalg::BlockJacobiPreconditioner<kDims> const M(A);
+        M.Solve(R, Z);
+        REQUIRE_EQ(Z.rows(), n);
+        REQUIRE_EQ(Z.cols(), m);
+        for (auto i = 0; i < nNodes; ++i)
+        {
+            Matrix<kDims, m> const Zi = Kii.inverse() * R.block<kDims, m>(i * kDims, 0);
+            CHECK_LE((Z.block<kDims, m>(i * kDims, 0) - Zi).norm(), zero);
+        }
+    }
+    SUBCASE("Incomplete Cholesky")
+    {
+        // Scalar tridiagonal matrices have no fill, such that the incomplete factorization is
+        // exact
+        MatrixX Tdense = MatrixX::Zero(n, n);
+        Tdense.diagonal().setConstant(Scalar(4));
+        Tdense.diagonal(1).setConstant(Scalar(-1));
+        Tdense.diagonal(-1).setConstant(Scalar(-1));
+        CSCMatrix const T = Tdense.sparseView();
+        math::linalg::IncompleteCholeskyPreconditioner const M(T);
+        M.Solve(R, Z);
+        MatrixX const ZExpected = Tdense.llt().solve(R);
+        CHECK_LE((Z - ZExpected).norm(), 1e-10);
+    }
+}
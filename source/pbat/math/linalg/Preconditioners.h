@@ -0,0 +1,218 @@
+/**
+ * @file Preconditioners.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Preconditioners for Krylov solvers
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_MATH_LINALG_PRECONDITIONERS_H
+#define PBAT_MATH_LINALG_PRECONDITIONERS_H
+
+#include "BlockSparseMatrix.h"
+#include "PhysicsBasedAnimationToolkitExport.h"
+#include "pbat/Aliases.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/LU>
+#include <cmath>
+#include <concepts>
+#include <exception>
+#include <fmt/core.h>
+#include <limits>
+#include <string>
+#include <tbb/parallel_for.h>
+#include <utility>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Concept for (symmetric positive definite) preconditioners \f$ \mathbf{M} \f$ of Krylov
+ * solvers
+ *
+ * `Solve(R, Z)` overwrites Z with \f$ \mathbf{M}^{-1} \mathbf{R} \f$, resizing Z if necessary,
+ * for all columns of R at once.
+ */
+template <class T>
+concept CPreconditioner = requires(T const t)
+{
+    {t.Solve(MatrixX{}, std::declval<MatrixX&>())};
+};
+
+/**
+ * @brief No preconditioning, i.e. \f$ \mathbf{M} = \mathbf{I} \f$
+ */
+struct IdentityPreconditioner
+{
+    void Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const { Z = R; }
+};
+
+/**
+ * @brief Jacobi preconditioner \f$ \mathbf{M} = |\text{diag}(\mathbf{A})| \f$
+ *
+ * Absolute values keep \f$ \mathbf{M} \f$ positive definite for symmetric indefinite systems
+ * (e.g. for MINRES). Zero diagonal entries are left unscaled.
+ */
+class JacobiPreconditioner
+{
+  public:
+    JacobiPreconditioner() = default;
+    /**
+     * @brief Construct a Jacobi preconditioner from the diagonal of A
+     * @param D `n` diagonal of A
+     */
+    PBAT_API explicit JacobiPreconditioner(Eigen::Ref<VectorX const> const& D);
+    /**
+     * @brief Construct a Jacobi preconditioner from a square sparse matrix A
+     * @param A Square sparse matrix
+     */
+    PBAT_API explicit JacobiPreconditioner(CSCMatrix const& A);
+
+    PBAT_API void Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const;
+
+  private:
+    VectorX mDinv; ///< Inverse absolute diagonal
+};
+
+/**
+ * @brief Block Jacobi preconditioner, i.e. \f$ \mathbf{M} \f$ is the block diagonal of
+ * \f$ \mathbf{A} \f$ with `Dims x Dims` blocks
+ *
+ * For vector-valued FEM problems (e.g. elasticity), the nodal blocks capture the coupling between
+ * a node's coordinates, which scalar Jacobi ignores. Singular blocks fall back to (scalar) Jacobi.
+ *
+ * @tparam Dims Block size, i.e. number of coordinates per node
+ */
+template <int Dims = 3>
+class BlockJacobiPreconditioner
+{
+  public:
+    static auto constexpr kDims = Dims; ///< Block size
+
+    BlockJacobiPreconditioner() = default;
+    /**
+     * @brief Construct a block Jacobi preconditioner from the diagonal blocks of A
+     * @param A Square block sparse matrix
+     */
+    explicit BlockJacobiPreconditioner(BlockSparseMatrix<kDims> const& A);
+    /**
+     * @brief Construct a block Jacobi preconditioner from the diagonal blocks of A
+     * @param A Square sparse matrix whose dimensions are multiples of kDims
+     */
+    explicit BlockJacobiPreconditioner(CSCMatrix const& A)
+        : BlockJacobiPreconditioner(BlockSparseMatrix<kDims>(A))
+    {
+    }
+
+    void Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const;
+
+  private:
+    MatrixX mDinv; ///< `kDims x |kDims * # blocks|` inverse diagonal blocks
+};
+
+/**
+ * @brief Incomplete Cholesky preconditioner \f$ \mathbf{M} = \mathbf{L} \mathbf{L}^T \approx
+ * \mathbf{A} \f$ of symmetric positive definite matrices
+ *
+ * Delegates to Eigen's limited memory incomplete Cholesky factorization of the AMD ordered and
+ * diagonally scaled matrix, i.e. L keeps as many non-zeros per column as A, and the diagonal is
+ * shifted until the factorization succeeds.
+ */
+class IncompleteCholeskyPreconditioner
+{
+  public:
+    IncompleteCholeskyPreconditioner() = default;
+    /**
+     * @brief Construct an incomplete Cholesky preconditioner of A
+     *
+     * @param A Symmetric positive definite sparse matrix, of which only the lower triangle is read
+     * @param initialShift Initial diagonal shift, increased until the factorization succeeds
+     * @throw std::runtime_error if the factorization fails
+     */
+    PBAT_API explicit IncompleteCholeskyPreconditioner(
+        CSCMatrix const& A,
+        Scalar initialShift = Scalar(1e-3));
+
+    PBAT_API void Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const;
+
+  private:
+    using FactorizationType = Eigen::
+        IncompleteCholesky<Scalar, Eigen::Lower, Eigen::AMDOrdering<CSCMatrix::StorageIndex>>;
+    FactorizationType mIC;
+};
+
+template <int Dims>
+inline BlockJacobiPreconditioner<Dims>::BlockJacobiPreconditioner(
+    BlockSparseMatrix<kDims> const& A)
+    : mDinv()
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockJacobiPreconditioner.Construct");
+    if (A.BlockRows() != A.BlockCols())
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected square block sparse matrix, but got {}x{} blocks",
+            A.BlockRows(),
+            A.BlockCols()));
+    }
+    Index const nBlocks = A.BlockRows();
+    mDinv.setZero(kDims, kDims * nBlocks);
+    tbb::parallel_for(Index(0), nBlocks, [&](Index bi) {
+        Matrix<kDims, kDims> Aii = Matrix<kDims, kDims>::Zero();
+        for (auto k = A.ptr(bi); k < A.ptr(bi + 1); ++k)
+            if (A.adj(k) == bi)
+                Aii = A.Block(k);
+        Matrix<kDims, kDims> Ainv;
+        bool bIsInvertible{false};
+        Scalar constexpr kZero = std::numeric_limits<Scalar>::min();
+        if constexpr (kDims <= 4)
+        {
+            Scalar determinant{};
+            Aii.computeInverseAndDetWithCheck(Ainv, determinant, bIsInvertible, kZero);
+        }
+        else
+        {
+            auto const LU = Aii.fullPivLu();
+            bIsInvertible = LU.isInvertible();
+            if (bIsInvertible)
+                Ainv = LU.inverse();
+        }
+        if (not bIsInvertible)
+        {
+            Ainv.setZero();
+            for (auto d = 0; d < kDims; ++d)
+                Ainv(d, d) = std::abs(Aii(d, d)) > kZero ? Scalar(1) / std::abs(Aii(d, d)) :
+                                                           Scalar(1);
+        }
+        mDinv.template block<kDims, kDims>(0, bi * kDims) = Ainv;
+    });
+}
+
+template <int Dims>
+inline void
+BlockJacobiPreconditioner<Dims>::Solve(Eigen::Ref<MatrixX const> const& R, MatrixX& Z) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.BlockJacobiPreconditioner.Solve");
+    Index const nBlocks = mDinv.cols() / kDims;
+    if (R.rows() != kDims * nBlocks)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected residuals with {} rows, but got {}",
+            kDims * nBlocks,
+            R.rows()));
+    }
+    Z.resize(R.rows(), R.cols());
+    tbb::parallel_for(Index(0), nBlocks, [&](Index bi) {
+        Z.middleRows<kDims>(bi * kDims) =
+            mDinv.template block<kDims, kDims>(0, bi * kDims) * R.middleRows<kDims>(bi * kDims);
+    });
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_PRECONDITIONERS_H
@@ -1,8 +1,11 @@
 #ifndef PBAT_MATH_LINALG_SELECTION_MATRIX_H
 #define PBAT_MATH_LINALG_SELECTION_MATRIX_H
 
+#include "BlockSparseMatrix.h"
 #include "pbat/Aliases.h"
 
+#include <utility>
+
 namespace pbat {
 namespace math {
 namespace linalg {
@@ -27,6 +30,40 @@ CSCMatrix SelectionMatrix(Eigen::DenseBase<TDerivedC> const& C, Index n = Index(
     return S;
 }
 
+/**
+ * @brief Construct the block selection matrix \f$ \mathbf{S} \otimes \mathbf{I}_d \f$, where S
+ * is SelectionMatrix(C, n), i.e. the selection of all columns C of a \f$ d \times n \f$ matrix
+ * of nodal vectors
+ *
+ * @tparam Dims Dimensionality d of nodal vectors
+ * @tparam TDerivedC Eigen dense expression type of selected columns
+ * @param C Selected columns
+ * @param n Number of columns to select from. If negative, max(C)+1.
+ * @return Block sparse selection matrix with `d x d` identity blocks
+ */
+template <int Dims, class TDerivedC>
+BlockSparseMatrix<Dims>
+BlockSelectionMatrix(Eigen::DenseBase<TDerivedC> const& C, Index n = Index(-1))
+{
+    using BlockSparseMatrixType = BlockSparseMatrix<Dims>;
+    using IndexVectorType       = typename BlockSparseMatrixType::IndexVectorType;
+    using StorageIndex          = typename BlockSparseMatrixType::StorageIndex;
+    if (n < 0)
+        n = C.maxCoeff() + 1;
+    // Block rows of S are the n selectable columns, such that we gather selections per row
+    IndexVectorType ptr = IndexVectorType::Zero(n + 1);
+    for (auto c = 0; c < C.size(); ++c)
+        ++ptr(C(c) + 1);
+    for (auto i = 0; i < n; ++i)
+        ptr(i + 1) += ptr(i);
+    IndexVectorType adj(C.size());
+    IndexVectorType offset = ptr.head(n);
+    for (auto c = 0; c < C.size(); ++c)
+        adj(offset(C(c))++) = static_cast<StorageIndex>(c);
+    MatrixX B = Matrix<Dims, Dims>::Identity().replicate(1, C.size());
+    return BlockSparseMatrixType(C.size(), std::move(ptr), std::move(adj), std::move(B));
+}
+
 } // namespace linalg
 } // namespace math
 } // namespace pbat
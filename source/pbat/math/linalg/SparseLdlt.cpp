@@ -0,0 +1,610 @@
+#include "SparseLdlt.h"
+
+#include "pbat/profiling/Profiling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <vector>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+SparseLdlt::SparseLdlt() : SparseLdlt(Settings{}) {}
+
+SparseLdlt::SparseLdlt(Settings const& settings)
+    : mSettings(),
+      mAnalyzedStorage(ESparseStorage::SymmetricLowerTriangular),
+      mAnalyzedRows(0),
+      mAnalyzedP(),
+      mAnalyzedI(),
+      mIsAnalyzed(false),
+      mIsFactorized(false),
+      mND(),
+      mCp(),
+      mCi(),
+      mCmap(),
+      mEtree(),
+      mLp(),
+      mLi(),
+      mLx(),
+      mD(),
+      mLxSingle(),
+      mDSingle()
+{
+    Configure(settings);
+}
+
+void SparseLdlt::Configure(Settings const& settings)
+{
+    mSettings     = settings;
+    mIsAnalyzed   = false;
+    mIsFactorized = false;
+}
+
+void SparseLdlt::Analyze(SparsityPattern const& GP, ESparseStorage storage)
+{
+    Analyze(GP.Pattern(), storage);
+}
+
+MatrixX SparseLdlt::Solve(Eigen::Ref<MatrixX const> const& B) const
+{
+    MatrixX X{};
+    Solve(B, X);
+    return X;
+}
+
+void SparseLdlt::Solve(Eigen::Ref<MatrixX const> const& B, MatrixX& X) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.SparseLdlt.Solve");
+    if (not mIsFactorized)
+        throw std::runtime_error("Solve requires a successful numerical factorization");
+    Index const n = mAnalyzedRows;
+    if (B.rows() != n)
+    {
+        throw std::invalid_argument(
+            fmt::format("Expected right-hand sides with {} rows, but got {}", n, B.rows()));
+    }
+    if (mSettings.ePrecision == EPrecision::Single)
+        Solve(mLxSingle, mDSingle, B, X);
+    else
+        Solve(mLx, mD, B, X);
+}
+
+template <class TFactorScalar>
+void SparseLdlt::Solve(
+    Eigen::Vector<TFactorScalar, Eigen::Dynamic> const& Lx,
+    Eigen::Vector<TFactorScalar, Eigen::Dynamic> const& D,
+    Eigen::Ref<MatrixX const> const& B,
+    MatrixX& X) const
+{
+    Index const n = mAnalyzedRows;
+    // Row-major storage makes each substitution step an axpy over all right-hand sides
+    using RowMajorMatrixX = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    Index const k         = B.cols();
+    RowMajorMatrixX Y(n, k);
+    for (Index i = 0; i < n; ++i)
+        Y.row(i) = B.row(mND.perm(i));
+    auto const solve = [&](Index c, Index nc) {
+        auto Yc = Y.middleCols(c, nc);
+        for (Index j = 0; j < n; ++j)
+            for (Index p = mLp(j); p < mLp(j + 1); ++p)
+                Yc.row(mLi(p)) -= static_cast<Scalar>(Lx(p)) * Yc.row(j);
+        for (Index j = 0; j < n; ++j)
+            Yc.row(j) /= static_cast<Scalar>(D(j));
+        for (Index j = n - 1; j >= 0; --j)
+            for (Index p = mLp(j); p < mLp(j + 1); ++p)
+                Yc.row(j) -= static_cast<Scalar>(Lx(p)) * Yc.row(mLi(p));
+    };
+    Index constexpr kBlockSize = 8;
+    if (mSettings.bParallel and k > kBlockSize)
+    {
+        tbb::parallel_for(
+            tbb::blocked_range<Index>(0, k, kBlockSize),
+            [&](tbb::blocked_range<Index> const& r) { solve(r.begin(), r.end() - r.begin()); });
+    }
+    else
+    {
+        solve(0, k);
+    }
+    X.resize(n, k);
+    for (Index i = 0; i < n; ++i)
+        X.row(mND.perm(i)) = Y.row(i);
+}
+
+void SparseLdlt::Analyze()
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.SparseLdlt.Analyze");
+    mIsAnalyzed   = false;
+    mIsFactorized = false;
+    Index const n = mAnalyzedRows;
+    // Keep the analyzed triangle
+    bool const bIsLower   = mAnalyzedStorage == ESparseStorage::SymmetricLowerTriangular;
+    auto const isInStored = [bIsLower](Index i, Index j) {
+        return bIsLower ? i >= j : i <= j;
+    };
+    // Order the adjacency graph of A by nested dissection
+    IndexVectorX ptr = IndexVectorX::Zero(n + 1);
+    for (Index j = 0; j < n; ++j)
+    {
+        for (Index p = mAnalyzedP(j); p < mAnalyzedP(j + 1); ++p)
+        {
+            Index const i = mAnalyzedI(p);
+            if (i == j or not isInStored(i, j))
+                continue;
+            ++ptr(i + 1);
+            ++ptr(j + 1);
+        }
+    }
+    std::partial_sum(ptr.begin(), ptr.end(), ptr.begin());
+    IndexVectorX adj(ptr(n));
+    IndexVectorX fill = ptr.head(n);
+    for (Index j = 0; j < n; ++j)
+    {
+        for (Index p = mAnalyzedP(j); p < mAnalyzedP(j + 1); ++p)
+        {
+            Index const i = mAnalyzedI(p);
+            if (i == j or not isInStored(i, j))
+                continue;
+            adj(fill(i)++) = j;
+            adj(fill(j)++) = i;
+        }
+    }
+    mND = graph::NestedDissectionOrdering(ptr, adj, mSettings.ordering);
+    // Permuted upper triangle C of A, such that column k of C holds row k of L's pattern
+    mCp.setZero(n + 1);
+    for (Index j = 0; j < n; ++j)
+    {
+        for (Index p = mAnalyzedP(j); p < mAnalyzedP(j + 1); ++p)
+        {
+            Index const i = mAnalyzedI(p);
+            if (isInStored(i, j))
+                ++mCp(std::max(mND.iperm(i), mND.iperm(j)) + 1);
+        }
+    }
+    std::partial_sum(mCp.begin(), mCp.end(), mCp.begin());
+    mCi.resize(mCp(n));
+    mCmap.resize(mCp(n));
+    fill = mCp.head(n);
+    for (Index j = 0; j < n; ++j)
+    {
+        for (Index p = mAnalyzedP(j); p < mAnalyzedP(j + 1); ++p)
+        {
+            Index const i = mAnalyzedI(p);
+            if (not isInStored(i, j))
+                continue;
+            Index const pi = mND.iperm(i);
+            Index const pj = mND.iperm(j);
+            Index const q  = fill(std::max(pi, pj))++;
+            mCi(q)         = std::min(pi, pj);
+            mCmap(q)       = p;
+        }
+    }
+    // Elimination tree and column counts of L
+    mEtree.setConstant(n, Index(-1));
+    IndexVectorX flag(n);
+    IndexVectorX Lnz = IndexVectorX::Zero(n);
+    for (Index k = 0; k < n; ++k)
+    {
+        flag(k) = k;
+        for (Index q = mCp(k); q < mCp(k + 1); ++q)
+        {
+            for (Index i = mCi(q); flag(i) != k; i = mEtree(i))
+            {
+                if (mEtree(i) < 0)
+                    mEtree(i) = k;
+                ++Lnz(i);
+                flag(i) = k;
+            }
+        }
+    }
+    mLp.resize(n + 1);
+    mLp(0) = 0;
+    std::partial_sum(Lnz.begin(), Lnz.end(), mLp.begin() + 1);
+    mLi.resize(mLp(n));
+    bool const bIsSingle = mSettings.ePrecision == EPrecision::Single;
+    mLx.resize(bIsSingle ? 0 : mLp(n));
+    mD.resize(bIsSingle ? 0 : n);
+    mLxSingle.resize(bIsSingle ? mLp(n) : 0);
+    mDSingle.resize(bIsSingle ? n : 0);
+    mIsAnalyzed = true;
+}
+
+bool SparseLdlt::Factorize(Scalar const* values)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.SparseLdlt.Factorize");
+    mIsFactorized = (mSettings.ePrecision == EPrecision::Single) ?
+                        Factorize(values, mLxSingle, mDSingle) :
+                        Factorize(values, mLx, mD);
+    return mIsFactorized;
+}
+
+template <class TFactorScalar>
+bool SparseLdlt::Factorize(
+    Scalar const* values,
+    Eigen::Vector<TFactorScalar, Eigen::Dynamic>& Lx,
+    Eigen::Vector<TFactorScalar, Eigen::Dynamic>& D)
+{
+    Index const n = mAnalyzedRows;
+    struct Workspace
+    {
+        VectorX y;            ///< Sparse accumulator of row k of L
+        IndexVectorX flag;    ///< flag(i) == k if i is in row k's pattern
+        IndexVectorX pattern; ///< Row k's pattern, in topological order
+    };
+    tbb::enumerable_thread_specific<Workspace> workspaces([n]() {
+        return Workspace{VectorX::Zero(n), IndexVectorX::Constant(n, Index(-1)), IndexVectorX(n)};
+    });
+    IndexVectorX Lnz = IndexVectorX::Zero(n);
+    std::atomic<bool> bIsSingular{false};
+    // Pivots are compared against the scale of the matrix, since round-off leaves the pivots of
+    // numerically singular matrices small, but rarely exactly zero
+    Scalar maxAbsDiagonal{0};
+    for (Index k = 0; k < n; ++k)
+        for (Index q = mCp(k); q < mCp(k + 1); ++q)
+            if (mCi(q) == k)
+                maxAbsDiagonal = std::max(maxAbsDiagonal, std::abs(values[mCmap(q)]));
+    Scalar constexpr kMinPivotTolerance =
+        Scalar(100) * static_cast<Scalar>(std::numeric_limits<TFactorScalar>::epsilon());
+    Scalar const minAbsPivot =
+        std::max(mSettings.pivotTolerance, kMinPivotTolerance) * maxAbsDiagonal;
+    // Row k of L only depends on rows of its subtree in the dissection tree, such that rows of
+    // sibling subtrees, which are disjoint ranges of the ordering, can be computed concurrently
+    auto const factorizeRows = [&](Index begin, Index end) {
+        Workspace& w = workspaces.local();
+        for (Index k = begin; k < end; ++k)
+        {
+            Index top = n;
+            w.flag(k) = k;
+            for (Index q = mCp(k); q < mCp(k + 1); ++q)
+            {
+                Index i = mCi(q);
+                w.y(i) += values[mCmap(q)];
+                Index len{0};
+                for (; w.flag(i) != k; i = mEtree(i))
+                {
+                    w.pattern(len++) = i;
+                    w.flag(i)        = k;
+                }
+                while (len > 0)
+                    w.pattern(--top) = w.pattern(--len);
+            }
+            Scalar dk = w.y(k);
+            w.y(k)    = Scalar(0);
+            for (; top < n; ++top)
+            {
+                Index const i  = w.pattern(top);
+                Scalar const y = w.y(i);
+                w.y(i)         = Scalar(0);
+                Index const pe = mLp(i) + Lnz(i);
+                for (Index p = mLp(i); p < pe; ++p)
+                    w.y(mLi(p)) -= static_cast<Scalar>(Lx(p)) * y;
+                // Entries are rounded to the factor's precision once, and subsequent rows are
+                // eliminated with the rounded entries
+                auto const lki = static_cast<TFactorScalar>(y / static_cast<Scalar>(D(i)));
+                dk -= static_cast<Scalar>(lki) * y;
+                mLi(pe) = k;
+                Lx(pe)  = lki;
+                ++Lnz(i);
+            }
+            D(k) = static_cast<TFactorScalar>(dk);
+            if (not(std::abs(static_cast<Scalar>(D(k))) > minAbsPivot))
+                bIsSingular.store(true, std::memory_order_relaxed);
+        }
+    };
+    // Separators' diagonal blocks are dense, such that their rows are eliminated as one supernodal
+    // panel. Each panel row first gathers its Schur complement w.r.t. the separator's (already
+    // factorized) subtrees by the up-looking sparse solve restricted to columns of those subtrees.
+    // The dense Schur complement is then factorized in double precision by a blocked right-looking
+    // LDLT, whose panel solves and trailing updates are BLAS-3 kernels, and finally rounded to the
+    // factor's precision and scattered into L's structure.
+    using BoolMatrixX = Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic>;
+    auto const factorizePanel = [&](Index begin, Index end) {
+        Workspace& w  = workspaces.local();
+        Index const m = end - begin;
+        MatrixX S     = MatrixX::Zero(m, m);
+        BoolMatrixX P = BoolMatrixX::Constant(m, m, false);
+        for (Index k = begin; k < end; ++k)
+        {
+            Index top = n;
+            w.flag(k) = k;
+            for (Index q = mCp(k); q < mCp(k + 1); ++q)
+            {
+                Index i = mCi(q);
+                w.y(i) += values[mCmap(q)];
+                Index len{0};
+                for (; w.flag(i) != k; i = mEtree(i))
+                {
+                    w.pattern(len++) = i;
+                    w.flag(i)        = k;
+                }
+                while (len > 0)
+                    w.pattern(--top) = w.pattern(--len);
+            }
+            Scalar dk = w.y(k);
+            w.y(k)    = Scalar(0);
+            // Columns of the panel are ancestors of the subtrees' columns, such that eliminating
+            // subtree columns first preserves the pattern's topological order
+            for (Index t = top; t < n; ++t)
+            {
+                Index const i = w.pattern(t);
+                if (i >= begin)
+                    continue;
+                Scalar const y = w.y(i);
+                w.y(i)         = Scalar(0);
+                Index const pe = mLp(i) + Lnz(i);
+                for (Index p = mLp(i); p < pe; ++p)
+                    w.y(mLi(p)) -= static_cast<Scalar>(Lx(p)) * y;
+                auto const lki = static_cast<TFactorScalar>(y / static_cast<Scalar>(D(i)));
+                dk -= static_cast<Scalar>(lki) * y;
+                mLi(pe) = k;
+                Lx(pe)  = lki;
+                ++Lnz(i);
+            }
+            for (Index t = top; t < n; ++t)
+            {
+                Index const i = w.pattern(t);
+                if (i < begin)
+                    continue;
+                S(k - begin, i - begin) = w.y(i);
+                P(k - begin, i - begin) = true;
+                w.y(i)                  = Scalar(0);
+            }
+            S(k - begin, k - begin) = dk;
+        }
+        Index constexpr kBlockSize = 64;
+        for (Index b = 0; b < m; b += kBlockSize)
+        {
+            Index const nb = std::min(kBlockSize, m - b);
+            Index const nr = m - b - nb;
+            auto S11       = S.block(b, b, nb, nb);
+            for (Index j = 0; j < nb; ++j)
+            {
+                Index const nt   = nb - j - 1;
+                VectorX const wj = S11.col(j).tail(nt);
+                S11.col(j).tail(nt) /= S11(j, j);
+                S11.bottomRightCorner(nt, nt).template triangularView<Eigen::Lower>() -=
+                    S11.col(j).tail(nt) * wj.transpose();
+            }
+            if (nr == 0)
+                continue;
+            auto S21 = S.block(b + nb, b, nr, nb);
+            S11.template triangularView<Eigen::UnitLower>()
+                .transpose()
+                .template solveInPlace<Eigen::OnTheRight>(S21);
+            MatrixX const W21 = S21;
+            S21               = W21 * S11.diagonal().cwiseInverse().asDiagonal();
+            S.block(b + nb, b + nb, nr, nr).template triangularView<Eigen::Lower>() -=
+                S21 * W21.transpose();
+        }
+        for (Index k = begin; k < end; ++k)
+        {
+            for (Index i = begin; i < k; ++i)
+            {
+                if (not P(k - begin, i - begin))
+                    continue;
+                Index const pe = mLp(i) + Lnz(i);
+                mLi(pe)        = k;
+                Lx(pe)         = static_cast<TFactorScalar>(S(k - begin, i - begin));
+                ++Lnz(i);
+            }
+            D(k) = static_cast<TFactorScalar>(S(k - begin, k - begin));
+            if (not(std::abs(static_cast<Scalar>(D(k))) > minAbsPivot))
+                bIsSingular.store(true, std::memory_order_relaxed);
+        }
+    };
+    auto const factorizeSubtree = [&](auto&& self, Index t) -> void {
+        // Leaves have an empty children range, i.e. their rows are [sep, end)
+        Index const left  = mND.children(0, t);
+        Index const right = mND.children(1, t);
+        if (left >= 0 and mSettings.bParallel)
+        {
+            tbb::parallel_invoke([&]() { self(self, left); }, [&]() { self(self, right); });
+        }
+        else if (left >= 0)
+        {
+            self(self, left);
+            self(self, right);
+        }
+        Index const begin   = mND.nodes(2, t);
+        Index const end     = mND.nodes(3, t);
+        bool const bIsPanel = left >= 0 and end - begin >= mSettings.minPanelSize;
+        if (bIsPanel)
+            factorizePanel(begin, end);
+        else
+            factorizeRows(begin, end);
+    };
+    if (n > 0)
+        factorizeSubtree(factorizeSubtree, Index(0));
+    return not bIsSingular.load();
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#include <doctest/doctest.h>
+
+TEST_CASE("[math][linalg] SparseLdlt")
+{
+    using namespace pbat;
+    // Arrange
+    // Shifted graph Laplacian of a regular grid
+    Index constexpr nx   = 19;
+    Index constexpr ny   = 13;
+    Index constexpr n    = nx * ny;
+    Index constexpr m    = 11;
+    Scalar constexpr zero = 1e-10;
+    std::vector<Eigen::Triplet<Scalar, CSCMatrix::StorageIndex>> triplets{};
+    for (Index j = 0; j < ny; ++j)
+    {
+        for (Index i = 0; i < nx; ++i)
+        {
+            auto const v = static_cast<CSCMatrix::StorageIndex>(j * nx + i);
+            triplets.emplace_back(v, v, Scalar(4.5));
+            if (i + 1 < nx)
+            {
+                triplets.emplace_back(v, v + 1, Scalar(-1));
+                triplets.emplace_back(v + 1, v, Scalar(-1));
+            }
+            if (j + 1 < ny)
+            {
+                triplets.emplace_back(v, v + nx, Scalar(-1));
+                triplets.emplace_back(v + nx, v, Scalar(-1));
+            }
+        }
+    }
+    CSCMatrix Afull(n, n);
+    Afull.setFromTriplets(triplets.begin(), triplets.end());
+    CSCMatrix const A = Afull.triangularView<Eigen::Lower>();
+    MatrixX const X   = MatrixX::Random(n, m);
+    MatrixX const B   = Afull * X;
+
+    math::linalg::SparseLdlt::Settings settings{};
+    settings.ordering.leafSize = 8;
+    math::linalg::SparseLdlt LDLT(settings);
+    auto const error = [&](MatrixX const& Xcomputed) {
+        return (X - Xcomputed).norm() / X.norm();
+    };
+    SUBCASE("Can solve SPD linear systems with multiple right-hand sides")
+    {
+        CHECK(LDLT.Compute(A));
+        CHECK_GT(LDLT.Ordering().nodes.cols(), 1);
+        CHECK_LE(error(LDLT.Solve(B)), zero);
+        // Single right-hand side
+        MatrixX x{};
+        LDLT.Solve(B.col(0), x);
+        CHECK_LE((x - X.col(0)).norm() / X.col(0).norm(), zero);
+    }
+    SUBCASE("Lower, upper, full and row-major storage yield the same solution")
+    {
+        CHECK(LDLT.Compute(Afull));
+        CHECK_LE(error(LDLT.Solve(B)), zero);
+        CSCMatrix const Aupper = Afull.triangularView<Eigen::Upper>();
+        using ESparseStorage = math::linalg::SparseLdlt::ESparseStorage;
+        CHECK(LDLT.Compute(Aupper, ESparseStorage::SymmetricUpperTriangular));
+        CHECK_LE(error(LDLT.Solve(B)), zero);
+        CSRMatrix const Arow = A;
+        CHECK(LDLT.Compute(Arow));
+        CHECK_LE(error(LDLT.Solve(B)), zero);
+    }
+    SUBCASE("Sequential factorization matches parallel factorization")
+    {
+        CHECK(LDLT.Compute(A));
+        MatrixX const Xparallel = LDLT.Solve(B);
+        settings.bParallel      = false;
+        LDLT.Configure(settings);
+        CHECK(LDLT.Compute(A));
+        CHECK_LE((LDLT.Solve(B) - Xparallel).norm(), zero * Xparallel.norm());
+    }
+    SUBCASE("Symbolic analysis is reused for matrices with the same sparsity pattern")
+    {
+        LDLT.Analyze(A);
+        CHECK(LDLT.IsAnalyzed(A));
+        IndexVectorX const perm = LDLT.Ordering().perm;
+        CSCMatrix A2            = A;
+        A2.coeffs() *= Scalar(2);
+        CHECK(LDLT.Factorize(A2));
+        CHECK(LDLT.IsAnalyzed(A2));
+        CHECK((LDLT.Ordering().perm.array() == perm.array()).all());
+        CHECK_LE(error(Scalar(2) * LDLT.Solve(B)), zero);
+        // Changing the sparsity pattern triggers a new analysis
+        CSCMatrix const Adiag = CSCMatrix(A.diagonal().asDiagonal());
+        CHECK_FALSE(LDLT.IsAnalyzed(Adiag));
+        CHECK(LDLT.Factorize(Adiag));
+        CHECK(LDLT.IsAnalyzed(Adiag));
+        CHECK_EQ(LDLT.NonZeros(), 0);
+        MatrixX const Xdiag = LDLT.Solve(B);
+        CHECK_LE((Xdiag - (B.array().colwise() / A.diagonal().array()).matrix()).norm(), zero);
+    }
+    SUBCASE("Single precision factors solve to single precision accuracy")
+    {
+        settings.ePrecision = math::linalg::SparseLdlt::EPrecision::Single;
+        LDLT.Configure(settings);
+        CHECK(LDLT.Compute(A));
+        Scalar const singleError = error(LDLT.Solve(B));
+        CHECK_LE(singleError, Scalar(1e-5));
+        CHECK_GT(singleError, zero * Scalar(1e-3));
+        settings.ePrecision = math::linalg::SparseLdlt::EPrecision::Double;
+        LDLT.Configure(settings);
+    }
+    SUBCASE("Supernodal separator panels match row by row elimination")
+    {
+        // Graph Laplacian of a regular 3D grid, whose top separator spans several panel blocks
+        Index constexpr nz = 12;
+        Index constexpr n3 = nz * nz * nz;
+        std::vector<Eigen::Triplet<Scalar, CSCMatrix::StorageIndex>> triplets3{};
+        for (Index k = 0; k < nz; ++k)
+        {
+            for (Index j = 0; j < nz; ++j)
+            {
+                for (Index i = 0; i < nz; ++i)
+                {
+                    auto const v = static_cast<CSCMatrix::StorageIndex>((k * nz + j) * nz + i);
+                    triplets3.emplace_back(v, v, Scalar(6.5));
+                    if (i + 1 < nz)
+                        triplets3.emplace_back(v + 1, v, Scalar(-1));
+                    if (j + 1 < nz)
+                        triplets3.emplace_back(v + nz, v, Scalar(-1));
+                    if (k + 1 < nz)
+                        triplets3.emplace_back(v + nz * nz, v, Scalar(-1));
+                }
+            }
+        }
+        CSCMatrix A3(n3, n3);
+        A3.setFromTriplets(triplets3.begin(), triplets3.end());
+        MatrixX const X3 = MatrixX::Random(n3, m);
+        MatrixX const B3 = A3.selfadjointView<Eigen::Lower>() * X3;
+        settings.minPanelSize = std::numeric_limits<Index>::max();
+        LDLT.Configure(settings);
+        CHECK(LDLT.Compute(A3));
+        MatrixX const Xrows = LDLT.Solve(B3);
+        Index const nnz     = LDLT.NonZeros();
+        settings.minPanelSize = 1;
+        LDLT.Configure(settings);
+        CHECK(LDLT.Compute(A3));
+        MatrixX const Xpanels = LDLT.Solve(B3);
+        CHECK_EQ(LDLT.NonZeros(), nnz);
+        CHECK_GT(LDLT.Ordering().nodes(3, 0) - LDLT.Ordering().nodes(2, 0), 64);
+        CHECK_LE((Xpanels - X3).norm() / X3.norm(), zero);
+        CHECK_LE((Xpanels - Xrows).norm() / Xrows.norm(), zero);
+        // Panels of the 2D grid's separators
+        CHECK(LDLT.Compute(A));
+        CHECK_LE(error(LDLT.Solve(B)), zero);
+    }
+    SUBCASE("Symmetric indefinite quasi-definite systems are solvable")
+    {
+        CSCMatrix Aindefinite = A;
+        for (Index k = 0; k < n; k += 3)
+            Aindefinite.coeffRef(k, k) = Scalar(-4.5) - Scalar(4);
+        MatrixX const Bindefinite = Aindefinite.selfadjointView<Eigen::Lower>() * X;
+        CHECK(LDLT.Compute(Aindefinite));
+        CHECK((LDLT.D().array() < Scalar(0)).any());
+        CHECK_LE((LDLT.Solve(Bindefinite) - X).norm() / X.norm(), zero);
+    }
+    SUBCASE("Singular matrices are detected")
+    {
+        CSCMatrix Asingular(3, 3);
+        Asingular.insert(0, 0) = Scalar(1);
+        Asingular.insert(1, 1) = Scalar(0);
+        Asingular.insert(2, 2) = Scalar(1);
+        Asingular.makeCompressed();
+        CHECK_FALSE(LDLT.Compute(Asingular));
+        CHECK_THROWS_AS(LDLT.Solve(MatrixX::Ones(3, 1)), std::runtime_error);
+        // The grid's graph Laplacian is singular, but round-off leaves its last pivot non-zero
+        CSCMatrix Alaplacian  = A;
+        Alaplacian.diagonal() = Scalar(4.5) * VectorX::Ones(n) - Afull * VectorX::Ones(n);
+        CHECK_FALSE(LDLT.Compute(Alaplacian));
+        settings.ePrecision = math::linalg::SparseLdlt::EPrecision::Single;
+        LDLT.Configure(settings);
+        CHECK_FALSE(LDLT.Compute(Alaplacian));
+    }
+}
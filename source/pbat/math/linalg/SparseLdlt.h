@@ -0,0 +1,315 @@
+/**
+ * @file SparseLdlt.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Native sparse LDLT factorization with nested dissection ordering
+ * @date 2025-02-11
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_MATH_LINALG_SPARSELDLT_H
+#define PBAT_MATH_LINALG_SPARSELDLT_H
+
+#include "PhysicsBasedAnimationToolkitExport.h"
+#include "SparsityPattern.h"
+#include "pbat/Aliases.h"
+#include "pbat/graph/NestedDissection.h"
+
+#include <algorithm>
+#include <exception>
+#include <fmt/core.h>
+#include <string>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+
+/**
+ * @brief Sparse \f$ \mathbf{P} \mathbf{A} \mathbf{P}^T = \mathbf{L} \mathbf{D} \mathbf{L}^T \f$
+ * factorization of symmetric (quasi-definite) matrices, without external dependencies
+ *
+ * The fill-reducing ordering \f$ \mathbf{P} \f$ is a nested dissection (see
+ * graph::NestedDissectionOrdering()). The symbolic analysis (ordering, elimination tree and
+ * factor structure) is reused by subsequent factorizations of matrices with the analyzed sparsity
+ * pattern. The numerical factorization is the up-looking row algorithm @cite davis2005ldl,
+ * which eliminates disjoint subtrees of the dissection tree in parallel.
+ *
+ * Rows of leaves and small separators are eliminated one sparse triangular solve at a time. The
+ * diagonal block of each large separator (see Settings::minPanelSize) is dense, and is thus
+ * eliminated as a supernodal panel: the separator's Schur complement w.r.t. its subtrees is
+ * gathered by sparse row solves, and then factorized densely with blocked BLAS-3 panel solves and
+ * trailing updates. Off-diagonal blocks of separators, i.e. their couplings to ancestor
+ * separators, remain sparse, such that factorizations of large 3D meshes are still slower than
+ * Cholmod's fully supernodal factorization.
+ *
+ * Provides a subset of Cholmod's interface, such that it can replace Cholmod when SuiteSparse is
+ * not available.
+ *
+ * The factor can be stored in single precision, which halves its memory footprint and the
+ * bandwidth of factorizations and solves. Elimination still accumulates in double precision, but
+ * solutions are then only accurate to single precision, and double precision accuracy is
+ * recovered by IterativeRefinement() against the double precision matrix.
+ */
+class SparseLdlt
+{
+  public:
+    /**
+     * @brief Which triangle of the input matrix stores the symmetric matrix. Entries of the other
+     * triangle are ignored.
+     */
+    enum class ESparseStorage { SymmetricLowerTriangular, SymmetricUpperTriangular };
+    /**
+     * @brief Floating point precision of the stored factor
+     */
+    enum class EPrecision { Double, Single };
+
+    /**
+     * @brief Factorization settings
+     */
+    struct Settings
+    {
+        graph::NestedDissectionOptions ordering{}; ///< Fill-reducing ordering options
+        EPrecision ePrecision{EPrecision::Double}; ///< Precision of the stored factor
+        bool bParallel{true}; ///< Factorize disjoint subtrees and solve right-hand sides in
+                              ///< parallel
+        Scalar pivotTolerance{1e-12}; ///< The matrix is considered singular if any pivot's
+                                      ///< magnitude is at most pivotTolerance times the largest
+                                      ///< diagonal magnitude of the matrix. Raised to 100 times
+                                      ///< the factor's machine epsilon if smaller.
+        Index minPanelSize{32}; ///< Separators of the dissection tree with at least minPanelSize
+                                ///< rows are factorized as dense supernodal panels
+    };
+
+    PBAT_API SparseLdlt();
+    /**
+     * @brief Construct a new SparseLdlt object with the given settings
+     * @param settings Factorization settings
+     */
+    PBAT_API explicit SparseLdlt(Settings const& settings);
+
+    /**
+     * @brief Changes the factorization settings
+     *
+     * Discards the current symbolic analysis and factorization.
+     *
+     * @param settings Factorization settings
+     */
+    PBAT_API void Configure(Settings const& settings);
+    /**
+     * @brief Current factorization settings
+     * @return Factorization settings
+     */
+    Settings const& GetSettings() const { return mSettings; }
+
+    /**
+     * @brief Computes the symbolic analysis of all matrices with A's sparsity pattern
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param A Square sparse matrix
+     * @param storage Which triangle of A stores the matrix
+     */
+    template <class Derived>
+    void Analyze(
+        Eigen::SparseCompressedBase<Derived> const& A,
+        ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular);
+    /**
+     * @brief Computes the symbolic analysis of all matrices with the sparsity pattern GP
+     *
+     * @param GP Sparsity pattern
+     * @param storage Which triangle of the pattern stores the matrix
+     */
+    PBAT_API void Analyze(
+        SparsityPattern const& GP,
+        ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular);
+    /**
+     * @brief Numerically factorizes A
+     *
+     * Reuses the current symbolic analysis if A has the analyzed sparsity pattern, and analyzes A
+     * otherwise.
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param A Square sparse matrix
+     * @param storage Which triangle of A stores the matrix
+     * @return True if A was successfully factorized, i.e. no pivot was numerically zero w.r.t.
+     * Settings::pivotTolerance
+     */
+    template <class Derived>
+    bool Factorize(
+        Eigen::SparseCompressedBase<Derived> const& A,
+        ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular);
+
+    template <class Derived>
+    bool Compute(
+        Eigen::SparseCompressedBase<Derived> const& A,
+        ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular);
+    /**
+     * @brief Checks if A has the analyzed sparsity pattern
+     *
+     * @tparam Derived Eigen sparse matrix type
+     * @param A Sparse matrix
+     * @param storage Which triangle of A stores the matrix
+     * @return True if A's symbolic analysis is the current one
+     */
+    template <class Derived>
+    bool IsAnalyzed(
+        Eigen::SparseCompressedBase<Derived> const& A,
+        ESparseStorage storage = ESparseStorage::SymmetricLowerTriangular) const;
+
+    PBAT_API MatrixX Solve(Eigen::Ref<MatrixX const> const& B) const;
+    /**
+     * @brief Solves A X = B for all columns of B at once, into caller-owned X
+     *
+     * Substitutions are vectorized across right-hand sides, and blocks of right-hand sides are
+     * solved in parallel.
+     *
+     * @param B `n x k` right-hand sides
+     * @param X `n x k` solutions, resized if necessary. Must not alias B.
+     */
+    PBAT_API void Solve(Eigen::Ref<MatrixX const> const& B, MatrixX& X) const;
+
+    /**
+     * @brief Fill-reducing ordering and dissection tree of the symbolic analysis
+     * @return Nested dissection of the analyzed matrix
+     */
+    graph::NestedDissection const& Ordering() const { return mND; }
+    /**
+     * @brief Number of strictly lower triangular non-zeros of the factor L
+     * @return Number of non-zeros
+     */
+    Index NonZeros() const { return mLp.size() > 0 ? mLp(mLp.size() - 1) : Index(0); }
+    /**
+     * @brief Diagonal D of the factorization
+     * @return `|# rows|` vector
+     */
+    VectorX D() const
+    {
+        return mSettings.ePrecision == EPrecision::Single ? VectorX(mDSingle.cast<Scalar>()) : mD;
+    }
+
+  private:
+    /**
+     * @brief Storage of the column-major view of Derived's compressed arrays
+     */
+    template <class Derived>
+    static ESparseStorage ColumnMajorStorage(ESparseStorage storage);
+    /**
+     * @brief Symbolic analysis of the recorded pattern mAnalyzedP, mAnalyzedI
+     */
+    PBAT_API void Analyze();
+    /**
+     * @brief Numerical factorization of the analyzed pattern's values
+     * @param values Non-zero values of a matrix with the analyzed sparsity pattern
+     */
+    PBAT_API bool Factorize(Scalar const* values);
+    /**
+     * @brief Numerical factorization into factor values of type TFactorScalar
+     */
+    template <class TFactorScalar>
+    bool Factorize(
+        Scalar const* values,
+        Eigen::Vector<TFactorScalar, Eigen::Dynamic>& Lx,
+        Eigen::Vector<TFactorScalar, Eigen::Dynamic>& D);
+    /**
+     * @brief Solves A X = B with factor values of type TFactorScalar
+     */
+    template <class TFactorScalar>
+    void Solve(
+        Eigen::Vector<TFactorScalar, Eigen::Dynamic> const& Lx,
+        Eigen::Vector<TFactorScalar, Eigen::Dynamic> const& D,
+        Eigen::Ref<MatrixX const> const& B,
+        MatrixX& X) const;
+
+    Settings mSettings;              ///< Factorization settings
+    ESparseStorage mAnalyzedStorage; ///< Storage of the analyzed matrix
+    Index mAnalyzedRows;             ///< Number of rows of the analyzed matrix
+    IndexVectorX mAnalyzedP;         ///< Column-major outer indices of the analyzed matrix
+    IndexVectorX mAnalyzedI;         ///< Column-major inner indices of the analyzed matrix
+    bool mIsAnalyzed;                ///< True if mAnalyzedP, mAnalyzedI have been analyzed
+    bool mIsFactorized;              ///< True if the last numerical factorization succeeded
+
+    graph::NestedDissection mND; ///< Fill-reducing ordering and dissection tree
+    IndexVectorX mCp;            ///< Column pointers of the permuted upper triangle C of A
+    IndexVectorX mCi;            ///< Row indices of C
+    IndexVectorX mCmap;          ///< Maps non-zeros of C to the analyzed matrix's non-zeros
+    IndexVectorX mEtree;         ///< Elimination tree of C, -1 at roots
+    IndexVectorX mLp;            ///< Column pointers of L
+    IndexVectorX mLi;            ///< Row indices of L
+    VectorX mLx;                 ///< Strictly lower triangular values of L
+    VectorX mD;                  ///< Diagonal D
+    Eigen::VectorXf mLxSingle;   ///< Single precision mLx, used instead of mLx in single precision
+    Eigen::VectorXf mDSingle;    ///< Single precision mD, used instead of mD in single precision
+};
+
+template <class Derived>
+inline SparseLdlt::ESparseStorage SparseLdlt::ColumnMajorStorage(ESparseStorage storage)
+{
+    // The row-major lower triangle is the column-major upper triangle
+    if constexpr (Derived::IsRowMajor)
+    {
+        return (storage == ESparseStorage::SymmetricLowerTriangular) ?
+                   ESparseStorage::SymmetricUpperTriangular :
+                   ESparseStorage::SymmetricLowerTriangular;
+    }
+    else
+    {
+        return storage;
+    }
+}
+
+template <class Derived>
+inline void
+SparseLdlt::Analyze(Eigen::SparseCompressedBase<Derived> const& A, ESparseStorage storage)
+{
+    if (A.rows() != A.cols())
+    {
+        throw std::invalid_argument(
+            fmt::format("Expected square matrix, but got {}x{}", A.rows(), A.cols()));
+    }
+    if (not A.isCompressed())
+        throw std::invalid_argument("Expected sparse matrix in compressed storage");
+    auto const* p    = A.outerIndexPtr();
+    auto const* i    = A.innerIndexPtr();
+    mAnalyzedStorage = ColumnMajorStorage<Derived>(storage);
+    mAnalyzedRows    = A.innerSize();
+    mAnalyzedP.resize(A.outerSize() + 1);
+    mAnalyzedI.resize(A.nonZeros());
+    std::copy(p, p + mAnalyzedP.size(), mAnalyzedP.data());
+    std::copy(i, i + mAnalyzedI.size(), mAnalyzedI.data());
+    Analyze();
+}
+
+template <class Derived>
+inline bool
+SparseLdlt::Factorize(Eigen::SparseCompressedBase<Derived> const& A, ESparseStorage storage)
+{
+    if (not IsAnalyzed(A, storage))
+        Analyze(A, storage);
+    return Factorize(A.valuePtr());
+}
+
+template <class Derived>
+inline bool
+SparseLdlt::Compute(Eigen::SparseCompressedBase<Derived> const& A, ESparseStorage storage)
+{
+    return Factorize(A, storage);
+}
+
+template <class Derived>
+inline bool
+SparseLdlt::IsAnalyzed(Eigen::SparseCompressedBase<Derived> const& A, ESparseStorage storage) const
+{
+    if (not mIsAnalyzed or ColumnMajorStorage<Derived>(storage) != mAnalyzedStorage or
+        A.innerSize() != mAnalyzedRows or A.outerSize() + 1 != mAnalyzedP.size() or
+        A.nonZeros() != mAnalyzedI.size() or not A.isCompressed())
+        return false;
+    auto const* p = A.outerIndexPtr();
+    auto const* i = A.innerIndexPtr();
+    return std::equal(p, p + mAnalyzedP.size(), mAnalyzedP.data()) and
+           std::equal(i, i + mAnalyzedI.size(), mAnalyzedI.data());
+}
+
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_SPARSELDLT_H
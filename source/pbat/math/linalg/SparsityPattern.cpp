@@ -13,7 +13,10 @@ bool SparsityPattern::IsEmpty() const
 } // namespace math
 } // namespace pbat
 
+#include <algorithm>
 #include <doctest/doctest.h>
+#include <exception>
+#include <random>
 #include <ranges>
 #include <vector>
 
@@ -51,4 +54,57 @@ TEST_CASE("[math][linalg] SparsityPattern")
     Scalar const error    = (Adense - Aexpected).norm() / Aexpected.norm();
     Scalar constexpr zero = 1e-15;
     CHECK_LE(error, zero);
+
+    // In-place assembly reuses the caller's matrix
+    CSCMatrix Ain = A;
+    std::vector<Scalar> nonZerosIn(nonZeros.size(), 2.);
+    Scalar const* const valuesBefore = Ain.valuePtr();
+    sparsityPattern.ToMatrix(nonZerosIn, Ain);
+    CHECK_EQ(Ain.valuePtr(), valuesBefore);
+    Scalar const errorIn = (Ain.toDense() - 2. * Aexpected).norm() / Aexpected.norm();
+    CHECK_LE(errorIn, zero);
+    CSCMatrix Aincompatible(nRows, nCols);
+    CHECK_THROWS_AS(sparsityPattern.ToMatrix(nonZerosIn, Aincompatible), std::invalid_argument);
+    CSCMatrix Apermuted = A;
+    Apermuted.innerIndexPtr()[0] = 3; // Same column counts, but different row indices
+    CHECK_THROWS_AS(sparsityPattern.ToMatrix(nonZerosIn, Apermuted), std::invalid_argument);
+
+    // Larger randomized pattern (with empty columns and many duplicates) matches Eigen's assembly
+    auto constexpr nRowsLarge = 97;
+    auto constexpr nColsLarge = 113;
+    auto constexpr nNonZeros  = 5000;
+    std::mt19937 rng{0};
+    std::uniform_int_distribution<Index> rowDistribution(0, nRowsLarge - 1);
+    std::uniform_int_distribution<Index> colDistribution(0, nColsLarge / 2);
+    std::uniform_real_distribution<Scalar> valueDistribution(-1., 1.);
+    std::vector<Index> rowIndicesLarge(nNonZeros), colIndicesLarge(nNonZeros);
+    std::vector<Scalar> nonZerosLarge(nNonZeros);
+    std::vector<Eigen::Triplet<Scalar, Index>> triplets{};
+    triplets.reserve(nNonZeros);
+    for (auto k = 0; k < nNonZeros; ++k)
+    {
+        rowIndicesLarge[k] = rowDistribution(rng);
+        colIndicesLarge[k] = 2 * colDistribution(rng);
+        nonZerosLarge[k]   = valueDistribution(rng);
+        triplets.emplace_back(rowIndicesLarge[k], colIndicesLarge[k], nonZerosLarge[k]);
+    }
+    math::linalg::SparsityPattern const sparsityPatternLarge(
+        nRowsLarge,
+        nColsLarge,
+        rowIndicesLarge,
+        colIndicesLarge);
+    CSCMatrix const Alarge = sparsityPatternLarge.ToMatrix(nonZerosLarge);
+    CSCMatrix AlargeExpected(nRowsLarge, nColsLarge);
+    AlargeExpected.setFromTriplets(triplets.begin(), triplets.end());
+    CHECK_EQ(Alarge.nonZeros(), AlargeExpected.nonZeros());
+    CHECK(std::equal(
+        Alarge.outerIndexPtr(),
+        Alarge.outerIndexPtr() + nColsLarge + 1,
+        AlargeExpected.outerIndexPtr()));
+    CHECK(std::equal(
+        Alarge.innerIndexPtr(),
+        Alarge.innerIndexPtr() + Alarge.nonZeros(),
+        AlargeExpected.innerIndexPtr()));
+    Scalar const errorLarge = (Alarge.toDense() - AlargeExpected.toDense()).norm();
+    CHECK_LE(errorLarge, 1e-12);
 }
@@ -3,16 +3,19 @@
 
 #include "PhysicsBasedAnimationToolkitExport.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <fmt/core.h>
+#include <limits>
 #include <pbat/Aliases.h>
 #include <pbat/common/Concepts.h>
 #include <pbat/profiling/Profiling.h>
-#include <range/v3/action/sort.hpp>
-#include <range/v3/range/conversion.hpp>
-#include <range/v3/view/iota.hpp>
-#include <range/v3/view/unique.hpp>
 #include <ranges>
+#include <span>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_scan.h>
+#include <tbb/parallel_sort.h>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -44,11 +47,48 @@ class SparsityPattern
     template <common::CArithmeticRange TNonZeroRange>
     CSCMatrix ToMatrix(TNonZeroRange&& nonZeros) const;
 
+    /**
+     * @brief Assembles non-zeros into a caller-owned matrix with this sparsity pattern, in-place
+     * and in parallel
+     *
+     * Every unique non-zero of Ain sums its gathered (triplet/duplicate) non-zeros on a single
+     * thread, such that assembly needs neither atomics nor allocations.
+     *
+     * @tparam TNonZeroRange Range of non-zero values
+     * @param nonZeros Non-zero values, ordered as the row and column indices passed to Compute
+     * @param Ain Compressed matrix with this sparsity pattern, e.g. as returned by ToMatrix
+     */
+    template <common::CArithmeticRange TNonZeroRange>
+    void ToMatrix(TNonZeroRange&& nonZeros, CSCMatrix& Ain) const;
+
+    /**
+     * @brief Calls f on every unique non-zero and its (triplet/duplicate) non-zeros, in parallel
+     *
+     * Every unique non-zero is visited by a single thread, such that f may write to per unique
+     * non-zero storage without synchronization.
+     *
+     * @tparam Func Callable with signature `void(Index u, std::span<Index const> k)`
+     * @param f Function receiving unique non-zero u and the indices k of its (triplet/duplicate)
+     * non-zeros, ordered as the row and column indices passed to Compute
+     */
+    template <class Func>
+    void ForEachUniqueNonZero(Func&& f) const;
+
+    /**
+     * @brief Compressed column sparsity pattern, whose i-th stored non-zero is unique non-zero i
+     * @return Sparsity pattern matrix with zero non-zero values
+     */
+    CSCMatrix const& Pattern() const { return A; }
+
     PBAT_API bool IsEmpty() const;
 
   private:
     std::vector<Index> ij; ///< Maps (triplet/duplicate) non-zero index k to its corresponding index
                            ///< into the unique non-zero list
+    std::vector<Index> ijptr; ///< Unique non-zero u's (triplet/duplicate) non-zeros are
+                              ///< ijinv[ijptr[u]:ijptr[u+1]]
+    std::vector<Index> ijinv; ///< Inverse of ij, i.e. gathers (triplet/duplicate) non-zeros of
+                              ///< unique non-zeros
     CSCMatrix A;           ///< Sparsity pattern + unique non-zeros
 };
 
@@ -78,13 +118,7 @@ inline void SparsityPattern::Compute(
     TColIndexRange&& colIndices)
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.SparsityPattern.Compute");
-    namespace srng   = std::ranges;
-    namespace sviews = std::views;
-    namespace rng    = ranges;
-    namespace views  = rng::views;
-
-    A = CSCMatrix(nRows, nCols);
-    ij.resize(srng::size(rowIndices), Index{0});
+    namespace srng = std::ranges;
 
     auto const [rowMin, rowMax] = srng::minmax_element(rowIndices);
     auto const [colMin, colMax] = srng::minmax_element(colIndices);
@@ -115,42 +149,103 @@ inline void SparsityPattern::Compute(
             nColIndices);
         throw std::invalid_argument(what);
     }
+    using SparseIndex = typename CSCMatrix::StorageIndex;
+    if (nRows > std::numeric_limits<SparseIndex>::max() or
+        nCols > std::numeric_limits<SparseIndex>::max())
+    {
+        std::string const what = fmt::format(
+            "Expected (nRows,nCols) representable by sparse storage indices, but got ({},{})",
+            nRows,
+            nCols);
+        throw std::invalid_argument(what);
+    }
     auto rows = srng::data(rowIndices);
     auto cols = srng::data(colIndices);
 
-    auto const indexPair = [&](Index s) {
-        return std::make_pair(cols[s], rows[s]);
+    // Sort (triplet/duplicate) non-zeros by packed 64-bit (col,row) keys, breaking ties by
+    // non-zero index, such that the sorted order is deterministic
+    struct KeyIndexPair
+    {
+        std::uint64_t key;
+        Index k;
+        bool operator<(KeyIndexPair const& rhs) const
+        {
+            return key < rhs.key or (key == rhs.key and k < rhs.k);
+        }
+    };
+    auto const numNonZeroIndices = static_cast<Index>(nRowIndices);
+    std::vector<KeyIndexPair> sorted(nRowIndices);
+    tbb::parallel_for(Index{0}, numNonZeroIndices, [&](Index k) {
+        auto const kk = static_cast<std::size_t>(k);
+        sorted[kk]    = {
+            (static_cast<std::uint64_t>(cols[kk]) << 32) | static_cast<std::uint64_t>(rows[kk]),
+            k};
+    });
+    tbb::parallel_sort(sorted.begin(), sorted.end());
+    auto const colOf = [](std::uint64_t key) {
+        return static_cast<Index>(key >> 32);
     };
-    auto const less = [&](Index lhs, Index rhs) {
-        return indexPair(lhs) < indexPair(rhs);
+    auto const rowOf = [](std::uint64_t key) {
+        return static_cast<Index>(key & 0xFFFFFFFFULL);
     };
-    auto const equal = [&](Index lhs, Index rhs) {
-        return indexPair(lhs) == indexPair(rhs);
+    auto const isUniqueHead = [&](std::size_t s) {
+        return s == 0 or sorted[s].key != sorted[s - 1].key;
     };
-    auto const numNonZeroIndices = static_cast<Index>(nRowIndices);
-    // NOTE: Bottleneck is the sort
-    auto const sortedNonZeroIndices = views::iota(Index{0}, numNonZeroIndices) |
-                                      rng::to<std::vector>() | rng::actions::sort(less);
-    auto const sortedUniqueNonZeroIndices =
-        sortedNonZeroIndices | views::unique(equal) | rng::to<std::vector>();
 
-    IndexVectorX cc = IndexVectorX::Zero(nCols);
-    for (auto u : sortedUniqueNonZeroIndices)
-        ++cc[cols[u]];
+    // Unique non-zero index of each sorted non-zero, via parallel prefix sum over unique heads
+    std::vector<Index> uniqueIndex(nRowIndices);
+    tbb::parallel_scan(
+        tbb::blocked_range<std::size_t>(0, nRowIndices),
+        Index{0},
+        [&](tbb::blocked_range<std::size_t> const& r, Index sum, bool bIsFinalScan) {
+            for (auto s = r.begin(); s < r.end(); ++s)
+            {
+                sum += static_cast<Index>(isUniqueHead(s));
+                if (bIsFinalScan)
+                    uniqueIndex[s] = sum - 1;
+            }
+            return sum;
+        },
+        [](Index lhs, Index rhs) { return lhs + rhs; });
+    auto const numUniqueNonZeros =
+        numNonZeroIndices > 0 ? uniqueIndex[nRowIndices - 1] + 1 : Index{0};
 
-    for (auto k = 0, u = 0; k < numNonZeroIndices; ++k)
-    {
-        // NOTE: Yes, the casting is just absurd here... otherwise code
-        // doesn't compile with agressive warnings on signed/unsigned mismatch
-        auto const s                    = sortedNonZeroIndices[static_cast<std::size_t>(k)];
-        auto const uu                   = sortedUniqueNonZeroIndices[static_cast<std::size_t>(u)];
-        bool const bIsSameEntry         = equal(s, uu);
-        ij[static_cast<std::size_t>(s)] = static_cast<Index>(bIsSameEntry ? u : ++u);
-    }
-    A.reserve(cc);
-    for (auto s : sortedUniqueNonZeroIndices)
-        A.insert(rows[s], cols[s]) = 0.;
-    A.makeCompressed();
+    // Map non-zeros to unique non-zeros, and gather each unique non-zero's duplicates, which are
+    // contiguous and sorted by non-zero index
+    ij.resize(nRowIndices);
+    ijinv.resize(nRowIndices);
+    ijptr.resize(static_cast<std::size_t>(numUniqueNonZeros) + 1);
+    ijptr.back() = numNonZeroIndices;
+    tbb::parallel_for(Index{0}, numNonZeroIndices, [&](Index si) {
+        auto const s                              = static_cast<std::size_t>(si);
+        auto const u                              = uniqueIndex[s];
+        ij[static_cast<std::size_t>(sorted[s].k)] = u;
+        ijinv[s]                                  = sorted[s].k;
+        if (isUniqueHead(s))
+            ijptr[static_cast<std::size_t>(u)] = si;
+    });
+
+    // Construct the compressed column storage directly. Every unique non-zero u fills the
+    // column pointers of the columns in (col(u-1), col(u)], such that each is written once.
+    auto const uniqueCol = [&](Index u) {
+        return u < 0 ? Index{-1} :
+                       colOf(sorted[static_cast<std::size_t>(ijptr[static_cast<std::size_t>(u)])]
+                                 .key);
+    };
+    A = CSCMatrix(nRows, nCols);
+    A.resizeNonZeros(numUniqueNonZeros);
+    SparseIndex* outer = A.outerIndexPtr();
+    SparseIndex* inner = A.innerIndexPtr();
+    Scalar* values     = A.valuePtr();
+    tbb::parallel_for(Index{0}, numUniqueNonZeros, [&](Index u) {
+        auto const key = sorted[static_cast<std::size_t>(ijptr[static_cast<std::size_t>(u)])].key;
+        for (auto c = uniqueCol(u - 1) + 1; c <= colOf(key); ++c)
+            outer[c] = static_cast<SparseIndex>(u);
+        inner[u]  = static_cast<SparseIndex>(rowOf(key));
+        values[u] = Scalar{0};
+    });
+    for (auto c = uniqueCol(numUniqueNonZeros - 1) + 1; c <= nCols; ++c)
+        outer[c] = static_cast<SparseIndex>(numUniqueNonZeros);
 }
 
 template <common::CArithmeticRange TNonZeroRange>
@@ -170,12 +265,72 @@ CSCMatrix SparsityPattern::ToMatrix(TNonZeroRange&& nonZeros) const
     }
 
     CSCMatrix Acpy{A};
-    Scalar* values = Acpy.valuePtr();
-    for (auto k = 0ULL; k < nnz; ++k)
-        values[ij[k]] += nonZeros[k];
+    ToMatrix(std::forward<TNonZeroRange>(nonZeros), Acpy);
     return Acpy;
 }
 
+template <common::CArithmeticRange TNonZeroRange>
+void SparsityPattern::ToMatrix(TNonZeroRange&& nonZeros, CSCMatrix& Ain) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.math.linalg.SparsityPattern.ToMatrixInPlace");
+    static_assert(
+        std::is_same_v<Scalar, std::ranges::range_value_t<TNonZeroRange>>,
+        "Only Scalar non-zero values are accepted");
+
+    namespace rng  = std::ranges;
+    auto const nnz = rng::size(nonZeros);
+    if (nnz != ij.size())
+    {
+        std::string const what = fmt::format("Expected {} non zeros, got {}", ij.size(), nnz);
+        throw std::invalid_argument(what);
+    }
+    bool const bIsPatternCompatible = Ain.isCompressed() and Ain.rows() == A.rows() and
+                                      Ain.cols() == A.cols() and
+                                      Ain.nonZeros() == A.nonZeros() and
+                                      std::equal(
+                                          A.outerIndexPtr(),
+                                          A.outerIndexPtr() + A.outerSize() + 1,
+                                          Ain.outerIndexPtr()) and
+                                      std::equal(
+                                          A.innerIndexPtr(),
+                                          A.innerIndexPtr() + A.nonZeros(),
+                                          Ain.innerIndexPtr());
+    if (not bIsPatternCompatible)
+    {
+        std::string const what = fmt::format(
+            "Expected compressed {}x{} matrix with the {} non-zeros of this sparsity pattern, "
+            "but got {}x{} matrix with {} non-zeros",
+            A.rows(),
+            A.cols(),
+            A.nonZeros(),
+            Ain.rows(),
+            Ain.cols(),
+            Ain.nonZeros());
+        throw std::invalid_argument(what);
+    }
+
+    Scalar* values = Ain.valuePtr();
+    ForEachUniqueNonZero([&](Index u, std::span<Index const> ks) {
+        Scalar value{0};
+        for (auto k : ks)
+            value += nonZeros[static_cast<std::size_t>(k)];
+        values[u] = value;
+    });
+}
+
+template <class Func>
+inline void SparsityPattern::ForEachUniqueNonZero(Func&& f) const
+{
+    if (ijptr.empty())
+        return;
+    auto const numUnique = static_cast<Index>(ijptr.size()) - 1;
+    tbb::parallel_for(Index{0}, numUnique, [&](Index u) {
+        auto const begin = static_cast<std::size_t>(ijptr[static_cast<std::size_t>(u)]);
+        auto const end   = static_cast<std::size_t>(ijptr[static_cast<std::size_t>(u) + 1]);
+        f(u, std::span<Index const>(ijinv.data() + begin, end - begin));
+    });
+}
+
 } // namespace linalg
 } // namespace math
 } // namespace pbat
@@ -297,6 +297,7 @@ class MatrixMatrixPredicate
 };
 
 template <class /*CMatrix*/ TLhsMatrix, class /*CMatrix*/ TRhsMatrix>
+    requires CMatrix<std::remove_cvref_t<TLhsMatrix>>
 PBAT_HOST_DEVICE auto operator+(TLhsMatrix&& A, TRhsMatrix&& B)
 {
     using LhsMatrixType = std::remove_cvref_t<TLhsMatrix>;
@@ -314,6 +315,7 @@ PBAT_HOST_DEVICE auto operator+(TLhsMatrix&& A, TRhsMatrix&& B)
 }
 
 template <class /*CMatrix*/ TLhsMatrix, class /*CMatrix*/ TRhsMatrix>
+    requires CMatrix<std::remove_cvref_t<TLhsMatrix>>
 PBAT_HOST_DEVICE auto operator+=(TLhsMatrix&& A, TRhsMatrix&& B)
 {
     using RhsMatrixType = std::remove_cvref_t<TRhsMatrix>;
@@ -329,6 +331,7 @@ PBAT_HOST_DEVICE auto operator+=(TLhsMatrix&& A, TRhsMatrix&& B)
 }
 
 template <class /*CMatrix*/ TLhsMatrix, class /*CMatrix*/ TRhsMatrix>
+    requires CMatrix<std::remove_cvref_t<TLhsMatrix>>
 PBAT_HOST_DEVICE auto operator-(TLhsMatrix&& A, TRhsMatrix&& B)
 {
     using LhsMatrixType = std::remove_cvref_t<TLhsMatrix>;
@@ -348,6 +351,7 @@ PBAT_HOST_DEVICE auto operator-(TLhsMatrix&& A, TRhsMatrix&& B)
 }
 
 template <class /*CMatrix*/ TLhsMatrix, class /*CMatrix*/ TRhsMatrix>
+    requires CMatrix<std::remove_cvref_t<TLhsMatrix>>
 PBAT_HOST_DEVICE auto operator-=(TLhsMatrix&& A, TRhsMatrix&& B)
 {
     using RhsMatrixType = std::remove_cvref_t<TRhsMatrix>;
@@ -35,6 +35,7 @@ namespace pbat::math::linalg::mini {
 #include "Scale.h"
 #include "Stack.h"
 #include "SubMatrix.h"
+#include "Svd.h"
 #include "Transpose.h"
 #include "UnaryOperations.h"
 
@@ -0,0 +1,97 @@
+#include "Svd.h"
+
+#include "Eigen.h"
+#include "pbat/Aliases.h"
+
+#include <Eigen/Geometry>
+#include <Eigen/LU>
+#include <cmath>
+#include <doctest/doctest.h>
+#if __has_include(<experimental/simd>)
+    #include <experimental/simd>
+#endif
+
+TEST_CASE("[math][linalg][mini] Svd")
+{
+    using namespace pbat::math::linalg::mini;
+    using ScalarType      = pbat::Scalar;
+    using MatrixType      = pbat::Matrix<3, 3>;
+    ScalarType const zero = 1e-10;
+    auto const checkSvd   = [&](MatrixType const& A,
+                              MatrixType const& U,
+                              pbat::Vector<3> const& sigma,
+                              MatrixType const& V) {
+        ScalarType const scale = std::max(A.norm(), ScalarType(1));
+        CHECK_LE((U * sigma.asDiagonal() * V.transpose() - A).norm(), zero * scale);
+        CHECK_LE((U.transpose() * U - MatrixType::Identity()).norm(), zero);
+        CHECK_LE((V.transpose() * V - MatrixType::Identity()).norm(), zero);
+        CHECK_LE(std::abs(U.determinant() - ScalarType(1)), zero);
+        CHECK_LE(std::abs(V.determinant() - ScalarType(1)), zero);
+        CHECK_GE(sigma(0), std::abs(sigma(1)) - zero * scale);
+        CHECK_GE(sigma(1), std::abs(sigma(2)) - zero * scale);
+        CHECK_GE(sigma(1), -zero * scale);
+    };
+    // Generic, inverted, rank-deficient, repeated singular values and zero matrices
+    MatrixType As[6];
+    As[0] = MatrixType::Random();
+    As[1] = MatrixType::Random();
+    As[1].col(0) *= -1.;
+    As[2] = MatrixType::Random();
+    As[2].col(2) = As[2].col(0) + As[2].col(1);
+    As[3] = MatrixType::Identity();
+    As[4] = 2. * Eigen::Quaternion<ScalarType>::UnitRandom().toRotationMatrix();
+    As[5] = MatrixType::Zero();
+    SUBCASE("Svd")
+    {
+        for (auto const& A : As)
+        {
+            SMatrix<ScalarType, 3, 3> U, V;
+            SVector<ScalarType, 3> sigma;
+            Svd<8>(FromEigen(A), U, sigma, V);
+            checkSvd(A, ToEigen(U), ToEigen(sigma), ToEigen(V));
+            CHECK_LE(
+                std::abs(sigma(0) * sigma(1) * sigma(2) - A.determinant()),
+                zero * std::max(A.norm(), ScalarType(1)));
+        }
+    }
+    SUBCASE("Polar")
+    {
+        for (auto const& A : As)
+        {
+            SMatrix<ScalarType, 3, 3> R, S;
+            Polar<8>(FromEigen(A), R, S);
+            MatrixType const Re = ToEigen(R);
+            MatrixType const Se = ToEigen(S);
+            CHECK_LE((Re * Se - A).norm(), zero * std::max(A.norm(), ScalarType(1)));
+            CHECK_LE((Re.transpose() * Re - MatrixType::Identity()).norm(), zero);
+            CHECK_LE(std::abs(Re.determinant() - ScalarType(1)), zero);
+            CHECK_LE((Se - Se.transpose()).norm(), zero * std::max(A.norm(), ScalarType(1)));
+        }
+    }
+#if __has_include(<experimental/simd>)
+    SUBCASE("SIMD lanes")
+    {
+        auto constexpr kLanes = 4;
+        using LaneType        = std::experimental::fixed_size_simd<ScalarType, kLanes>;
+        SMatrix<LaneType, 3, 3> A{};
+        for (auto k = 0; k < 9; ++k)
+            A[k] = LaneType([&](auto l) { return As[l](k); });
+        SMatrix<LaneType, 3, 3> U, V;
+        SVector<LaneType, 3> sigma;
+        Svd<8>(A, U, sigma, V);
+        for (auto l = 0; l < kLanes; ++l)
+        {
+            MatrixType Ul, Vl;
+            pbat::Vector<3> sigmal;
+            for (auto k = 0; k < 9; ++k)
+            {
+                Ul(k) = U[k][l];
+                Vl(k) = V[k][l];
+            }
+            for (auto k = 0; k < 3; ++k)
+                sigmal(k) = sigma[k][l];
+            checkSvd(As[l], Ul, sigmal, Vl);
+        }
+    }
+#endif
+}
@@ -0,0 +1,308 @@
+#ifndef PBAT_MATH_LINALG_MINI_SVD_H
+#define PBAT_MATH_LINALG_MINI_SVD_H
+
+#include "Api.h"
+#include "Concepts.h"
+#include "Matrix.h"
+#include "pbat/HostDevice.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace pbat {
+namespace math {
+namespace linalg {
+namespace mini {
+namespace detail {
+namespace svd {
+
+// All control flow is resolved at compile time, and data-dependent decisions are selects, such
+// that scalars may be SIMD lanes (e.g. std::experimental::simd), whose comparisons yield masks.
+
+template <class TMask, class TScalar>
+PBAT_HOST_DEVICE TScalar Select(TMask const& mask, TScalar const& a, TScalar const& b)
+{
+    if constexpr (std::is_same_v<TMask, bool>)
+    {
+        return mask ? a : b;
+    }
+    else
+    {
+        TScalar c = b;
+        where(mask, c) = a;
+        return c;
+    }
+}
+
+/**
+ * Smallest value whose square is a normalized floating point number
+ */
+template <class TScalar>
+PBAT_HOST_DEVICE auto TinyValue()
+{
+    using namespace std;
+    if constexpr (std::is_floating_point_v<TScalar>)
+        return sqrt(std::numeric_limits<TScalar>::min());
+    else
+        return sqrt(std::numeric_limits<typename TScalar::value_type>::min());
+}
+
+template <class TScalar>
+struct Quaternion
+{
+    TScalar w = TScalar(1);
+    TScalar v[3]{TScalar(0), TScalar(0), TScalar(0)};
+};
+
+/**
+ * Right-multiplies q by the rotation (ch, sh) of the (P,Q) plane, i.e. the rotation mapping e_P to
+ * c e_P + s e_Q, where c = ch^2 - sh^2, s = 2 ch sh. Its axis is e_P x e_Q = sign * e_K.
+ */
+template <int P, int Q, class TScalar>
+PBAT_HOST_DEVICE void Rotate(Quaternion<TScalar>& q, TScalar const& ch, TScalar const& sh)
+{
+    auto constexpr K       = 3 - P - Q;
+    auto constexpr bCyclic = (P + 1) % 3 == Q;
+    TScalar const r        = bCyclic ? sh : -sh;
+    TScalar const w        = q.w;
+    TScalar const vP       = q.v[P];
+    TScalar const vQ       = q.v[Q];
+    TScalar const vK       = q.v[K];
+    // q * (ch, r e_K) = (w ch - r v_K, w r e_K + ch v + r v x e_K)
+    q.w    = ch * w - r * vK;
+    q.v[K] = ch * vK + r * w;
+    if constexpr (bCyclic)
+    {
+        q.v[P] = ch * vP + r * vQ;
+        q.v[Q] = ch * vQ - r * vP;
+    }
+    else
+    {
+        q.v[P] = ch * vP - r * vQ;
+        q.v[Q] = ch * vQ + r * vP;
+    }
+}
+
+template <class TScalar>
+PBAT_HOST_DEVICE SMatrix<TScalar, 3, 3> ToRotationMatrix(Quaternion<TScalar> const& q)
+{
+    TScalar const x = q.v[0];
+    TScalar const y = q.v[1];
+    TScalar const z = q.v[2];
+    TScalar const w = q.w;
+    TScalar const s = TScalar(2) / (w * w + x * x + y * y + z * z);
+    SMatrix<TScalar, 3, 3> R{};
+    R(0, 0) = TScalar(1) - s * (y * y + z * z);
+    R(1, 0) = s * (x * y + w * z);
+    R(2, 0) = s * (x * z - w * y);
+    R(0, 1) = s * (x * y - w * z);
+    R(1, 1) = TScalar(1) - s * (x * x + z * z);
+    R(2, 1) = s * (y * z + w * x);
+    R(0, 2) = s * (x * z + w * y);
+    R(1, 2) = s * (y * z - w * x);
+    R(2, 2) = TScalar(1) - s * (x * x + y * y);
+    return R;
+}
+
+/**
+ * One Jacobi conjugation S <- Q^T S Q of the symmetric matrix S, with Q the approximate Givens
+ * rotation of the (P,Q) plane annihilating S(P,Q)
+ */
+template <int P, int Q, class TScalar>
+PBAT_HOST_DEVICE void JacobiConjugation(SMatrix<TScalar, 3, 3>& S, Quaternion<TScalar>& q)
+{
+    using namespace std;
+    auto constexpr K = 3 - P - Q;
+    // Approximate half-angle of the Givens rotation, falling back to pi/8 when inaccurate
+    auto constexpr kGamma    = 5.828427124746190; // (sqrt(8) + 3)^2
+    auto constexpr kCStar    = 0.923879532511287; // cos(pi/8)
+    auto constexpr kSStar    = 0.382683432365090; // sin(pi/8)
+    TScalar ch               = TScalar(2) * (S(P, P) - S(Q, Q));
+    TScalar sh               = S(P, Q);
+    auto const bIsAccurate   = TScalar(kGamma) * sh * sh < ch * ch;
+    TScalar const w          = TScalar(1) / sqrt(ch * ch + sh * sh);
+    ch                       = Select(bIsAccurate, w * ch, TScalar(kCStar));
+    sh                       = Select(bIsAccurate, w * sh, TScalar(kSStar));
+    TScalar const c          = ch * ch - sh * sh;
+    TScalar const s          = TScalar(2) * ch * sh;
+    TScalar const Spp        = S(P, P);
+    TScalar const Sqq        = S(Q, Q);
+    TScalar const Spq        = S(P, Q);
+    TScalar const Spk        = S(P, K);
+    TScalar const Sqk        = S(Q, K);
+    S(P, P)                  = c * c * Spp + TScalar(2) * c * s * Spq + s * s * Sqq;
+    S(Q, Q)                  = s * s * Spp - TScalar(2) * c * s * Spq + c * c * Sqq;
+    S(P, Q)                  = c * s * (Sqq - Spp) + (c * c - s * s) * Spq;
+    S(Q, P)                  = S(P, Q);
+    S(P, K)                  = c * Spk + s * Sqk;
+    S(K, P)                  = S(P, K);
+    S(Q, K)                  = c * Sqk - s * Spk;
+    S(K, Q)                  = S(Q, K);
+    Rotate<P, Q>(q, ch, sh);
+}
+
+/**
+ * Swaps columns I and J of B and V if column I of B has smaller norm than column J, negating one
+ * of them to preserve det(V) = 1
+ */
+template <int I, int J, class TScalar>
+PBAT_HOST_DEVICE void
+SortColumns(SMatrix<TScalar, 3, 3>& B, SMatrix<TScalar, 3, 3>& V, TScalar (&rho)[3])
+{
+    auto const bSwap = rho[I] < rho[J];
+    for (auto r = 0; r < 3; ++r)
+    {
+        TScalar const bi = B(r, I);
+        TScalar const bj = B(r, J);
+        B(r, I)          = Select(bSwap, bj, bi);
+        B(r, J)          = Select(bSwap, -bi, bj);
+        TScalar const vi = V(r, I);
+        TScalar const vj = V(r, J);
+        V(r, I)          = Select(bSwap, vj, vi);
+        V(r, J)          = Select(bSwap, -vi, vj);
+    }
+    TScalar const rhoI = rho[I];
+    rho[I]             = Select(bSwap, rho[J], rhoI);
+    rho[J]             = Select(bSwap, rhoI, rho[J]);
+}
+
+/**
+ * One Givens QR step B <- Q^T B, with Q the rotation of the (P,Q) plane annihilating B(Q,P)
+ */
+template <int P, int Q, class TScalar>
+PBAT_HOST_DEVICE void QRGivens(SMatrix<TScalar, 3, 3>& B, Quaternion<TScalar>& q)
+{
+    using namespace std;
+    TScalar const bp       = B(P, P);
+    TScalar const bq       = B(Q, P);
+    TScalar const rho      = sqrt(bp * bp + bq * bq);
+    TScalar const eps      = TinyValue<TScalar>();
+    TScalar sh             = Select(rho > eps, bq, TScalar(0));
+    TScalar ch             = abs(bp) + max(rho, eps);
+    // tan(theta) = bq / (rho + bp), which cancels catastrophically for bp < 0
+    auto const bIsNegative = bp < TScalar(0);
+    TScalar const chs      = ch;
+    ch                     = Select(bIsNegative, sh, chs);
+    sh                     = Select(bIsNegative, chs, sh);
+    TScalar const w        = TScalar(1) / sqrt(ch * ch + sh * sh);
+    ch *= w;
+    sh *= w;
+    TScalar const c = ch * ch - sh * sh;
+    TScalar const s = TScalar(2) * ch * sh;
+    for (auto j = 0; j < 3; ++j)
+    {
+        TScalar const bpj = B(P, j);
+        TScalar const bqj = B(Q, j);
+        B(P, j)           = c * bpj + s * bqj;
+        B(Q, j)           = c * bqj - s * bpj;
+    }
+    Rotate<P, Q>(q, ch, sh);
+}
+
+} // namespace svd
+} // namespace detail
+
+/**
+ * @brief Rotation variant singular value decomposition A = U diag(sigma) V^T of a 3x3 matrix
+ * \cite mcadams2011svd
+ *
+ * U and V are rotations (det = 1), singular values are sorted by decreasing magnitude and only
+ * sigma(2) may be negative (when det(A) < 0). The symmetric eigenproblem of A^T A is solved by a
+ * fixed number of approximate Jacobi sweeps, whose rotations are accumulated in a quaternion, and U
+ * results from a Givens QR decomposition of A V. There are no data-dependent branches, such that
+ * the scalar type may be a SIMD lane type.
+ *
+ * @tparam kSweeps Number of Jacobi sweeps. 4 sweeps reach single precision accuracy, while double
+ * precision accuracy typically requires 6 to 8 sweeps.
+ * @tparam TMatrix Input matrix type
+ * @param A 3x3 matrix
+ * @param U Left singular vectors
+ * @param sigma Singular values
+ * @param V Right singular vectors
+ */
+template <int kSweeps = 4, class /*CMatrix*/ TMatrix>
+PBAT_HOST_DEVICE void
+Svd(TMatrix const& A,
+    SMatrix<typename TMatrix::ScalarType, 3, 3>& U,
+    SVector<typename TMatrix::ScalarType, 3>& sigma,
+    SMatrix<typename TMatrix::ScalarType, 3, 3>& V)
+{
+    PBAT_MINI_CHECK_CMATRIX(TMatrix);
+    static_assert(TMatrix::kRows == 3 and TMatrix::kCols == 3, "Svd only valid for 3x3 matrices");
+    using namespace std;
+    using ScalarType = typename TMatrix::ScalarType;
+    using namespace detail::svd;
+    // Eigen decomposition of A^T A = V diag(sigma^2) V^T
+    SMatrix<ScalarType, 3, 3> S{};
+    for (auto j = 0; j < 3; ++j)
+        for (auto i = 0; i < 3; ++i)
+            S(i, j) = A(0, i) * A(0, j) + A(1, i) * A(1, j) + A(2, i) * A(2, j);
+    Quaternion<ScalarType> qV{};
+    for (auto sweep = 0; sweep < kSweeps; ++sweep)
+    {
+        JacobiConjugation<0, 1>(S, qV);
+        JacobiConjugation<1, 2>(S, qV);
+        JacobiConjugation<2, 0>(S, qV);
+    }
+    V = ToRotationMatrix(qV);
+    // B = A V, with columns sorted by decreasing norm
+    SMatrix<ScalarType, 3, 3> B{};
+    for (auto j = 0; j < 3; ++j)
+        for (auto i = 0; i < 3; ++i)
+            B(i, j) = A(i, 0) * V(0, j) + A(i, 1) * V(1, j) + A(i, 2) * V(2, j);
+    ScalarType rho[3];
+    for (auto j = 0; j < 3; ++j)
+        rho[j] = B(0, j) * B(0, j) + B(1, j) * B(1, j) + B(2, j) * B(2, j);
+    SortColumns<0, 1>(B, V, rho);
+    SortColumns<0, 2>(B, V, rho);
+    SortColumns<1, 2>(B, V, rho);
+    // B = U R, where R is diagonal up to round-off
+    Quaternion<ScalarType> qU{};
+    QRGivens<0, 1>(B, qU);
+    QRGivens<0, 2>(B, qU);
+    QRGivens<1, 2>(B, qU);
+    U        = ToRotationMatrix(qU);
+    sigma(0) = B(0, 0);
+    sigma(1) = B(1, 1);
+    sigma(2) = B(2, 2);
+}
+
+/**
+ * @brief Rotation variant polar decomposition A = R S of a 3x3 matrix, where R = U V^T is a
+ * rotation and S = V diag(sigma) V^T is symmetric
+ *
+ * @tparam kSweeps Number of Jacobi sweeps
+ * @tparam TMatrix Input matrix type
+ * @param A 3x3 matrix
+ * @param R Rotation
+ * @param S Symmetric stretch
+ */
+template <int kSweeps = 4, class /*CMatrix*/ TMatrix>
+PBAT_HOST_DEVICE void Polar(
+    TMatrix const& A,
+    SMatrix<typename TMatrix::ScalarType, 3, 3>& R,
+    SMatrix<typename TMatrix::ScalarType, 3, 3>& S)
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    SMatrix<ScalarType, 3, 3> U{};
+    SVector<ScalarType, 3> sigma{};
+    SMatrix<ScalarType, 3, 3> V{};
+    Svd<kSweeps>(A, U, sigma, V);
+    for (auto j = 0; j < 3; ++j)
+    {
+        for (auto i = 0; i < 3; ++i)
+        {
+            R(i, j) = U(i, 0) * V(j, 0) + U(i, 1) * V(j, 1) + U(i, 2) * V(j, 2);
+            S(i, j) = sigma(0) * V(i, 0) * V(j, 0) + sigma(1) * V(i, 1) * V(j, 1) +
+                      sigma(2) * V(i, 2) * V(j, 2);
+        }
+    }
+}
+
+} // namespace mini
+} // namespace linalg
+} // namespace math
+} // namespace pbat
+
+#endif // PBAT_MATH_LINALG_MINI_SVD_H
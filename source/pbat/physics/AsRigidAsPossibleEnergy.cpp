@@ -0,0 +1,47 @@
+#include "AsRigidAsPossibleEnergy.h"
+
+#include "HyperElasticity.h"
+
+#include <Eigen/LU>
+#include <Eigen/QR>
+#include <doctest/doctest.h>
+#include <pbat/common/ConstexprFor.h>
+#include <pbat/math/linalg/mini/Eigen.h>
+
+TEST_CASE("[physics] AsRigidAsPossibleEnergy")
+{
+    using namespace pbat;
+    namespace mini = pbat::math::linalg::mini;
+    common::ForValues<1, 2, 3>([]<auto Dims>() {
+        using mini::FromEigen;
+        using mini::ToEigen;
+        physics::AsRigidAsPossibleEnergy<Dims> psi{};
+        Scalar constexpr Y      = 1e6;
+        Scalar constexpr nu     = 0.45;
+        auto const [mu, lambda] = physics::LameCoefficients(Y, nu);
+        Scalar constexpr zero   = 1e-9;
+        // Rotated stretch
+        Matrix<Dims, Dims> R =
+            Eigen::HouseholderQR<Matrix<Dims, Dims>>(Matrix<Dims, Dims>::Random()).householderQ();
+        if (R.determinant() < Scalar(0))
+            R.col(0) *= Scalar(-1);
+        if constexpr (Dims == 1)
+            R(0, 0) = Scalar(1);
+        Vector<Dims> const s           = Vector<Dims>::Ones() + 0.3 * Vector<Dims>::Random();
+        Matrix<Dims, Dims> const F     = R * s.asDiagonal();
+        Vector<Dims * Dims> const vecF = F.reshaped();
+        auto const vecFmini            = FromEigen(vecF);
+        mini::SVector<Scalar, Dims * Dims> gF;
+        mini::SMatrix<Scalar, Dims * Dims, Dims * Dims> HF;
+        Scalar const ePsi         = psi.eval(vecFmini, mu, lambda);
+        Scalar const ePsiFromHess = psi.evalWithGradAndHessian(vecFmini, mu, lambda, gF, HF);
+        Scalar const ePsiExpected = mu * (s.array() - Scalar(1)).square().sum();
+        CHECK_LE(std::abs(ePsi - ePsiExpected), zero * mu);
+        CHECK_LE(std::abs(ePsiFromHess - ePsiExpected), zero * mu);
+        Matrix<Dims, Dims> const gFExpected = Scalar(2) * mu * (F - R);
+        CHECK_LE((ToEigen(gF) - gFExpected.reshaped()).norm(), zero * mu);
+        Matrix<Dims * Dims, Dims * Dims> const HFExpected =
+            Scalar(2) * mu * Matrix<Dims * Dims, Dims * Dims>::Identity();
+        CHECK_LE((ToEigen(HF) - HFExpected).norm(), zero * mu);
+    });
+}
@@ -0,0 +1,257 @@
+/**
+ * @file AsRigidAsPossibleEnergy.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief As-rigid-as-possible hyperelastic energy
+ * @date 2025-02-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_PHYSICS_ASRIGIDASPOSSIBLEENERGY_H
+#define PBAT_PHYSICS_ASRIGIDASPOSSIBLEENERGY_H
+
+#include "CorotationalEnergy.h"
+#include "pbat/HostDevice.h"
+#include "pbat/math/linalg/mini/Matrix.h"
+
+namespace pbat {
+namespace physics {
+
+/**
+ * @brief As-rigid-as-possible hyperelastic energy
+ *
+ * \f[
+ * \Psi(\mathbf{F}) = \mu || \mathbf{F} - \mathbf{R} ||_F^2 ,
+ * \f]
+ * where \f$ \mathbf{R} \f$ is the rotation of the polar decomposition of \f$ \mathbf{F} \f$. The
+ * energy ignores \f$ \lambda \f$. Its gradient is \f$ 2 \mu (\mathbf{F} - \mathbf{R}) \f$ and its
+ * (fixed rotation) hessian is the constant \f$ 2 \mu \mathbf{I} \f$.
+ *
+ * @tparam Dims Dimension of the space
+ */
+template <int Dims>
+struct AsRigidAsPossibleEnergy
+{
+  public:
+    template <class TScalar, int M, int N>
+    using SMatrix = pbat::math::linalg::mini::SMatrix<TScalar, M, N>; ///< Scalar matrix type
+
+    template <class TScalar, int M>
+    using SVector = pbat::math::linalg::mini::SVector<TScalar, M>; ///< Scalar vector type
+
+    static auto constexpr kDims = Dims; ///< Dimension of the space
+
+    /**
+     * @brief Evaluate the elastic energy
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @return Energy
+     */
+    template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+    PBAT_HOST_DEVICE typename TMatrix::ScalarType
+    eval(TMatrix const& F, typename TMatrix::ScalarType mu, typename TMatrix::ScalarType lambda)
+        const;
+
+    /**
+     * @brief Evaluate the elastic energy gradient
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @return Energy gradient
+     */
+    template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+    PBAT_HOST_DEVICE SVector<typename TMatrix::ScalarType, Dims * Dims>
+    grad(TMatrix const& F, typename TMatrix::ScalarType mu, typename TMatrix::ScalarType lambda)
+        const;
+
+    /**
+     * @brief Evaluate the (fixed rotation) elastic energy hessian
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @return Energy hessian
+     */
+    template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+    PBAT_HOST_DEVICE SMatrix<typename TMatrix::ScalarType, Dims * Dims, Dims * Dims>
+    hessian(TMatrix const& F, typename TMatrix::ScalarType mu, typename TMatrix::ScalarType lambda)
+        const;
+
+    /**
+     * @brief Evaluate the elastic energy and its gradient
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @param gF Gradient w.r.t. F
+     * @return Energy and its gradient
+     */
+    template <
+        math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF>
+    PBAT_HOST_DEVICE typename TMatrix::ScalarType evalWithGrad(
+        TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        typename TMatrix::ScalarType lambda,
+        TMatrixGF& gF) const;
+
+    /**
+     * @brief Evaluate the elastic energy with its gradient and (fixed rotation) hessian
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @param gF Gradient w.r.t. F
+     * @param HF Hessian w.r.t. F
+     * @return Energy and its gradient and hessian
+     */
+    template <
+        math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+    PBAT_HOST_DEVICE typename TMatrix::ScalarType evalWithGradAndHessian(
+        TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        typename TMatrix::ScalarType lambda,
+        TMatrixGF& gF,
+        TMatrixHF& HF) const;
+
+    /**
+     * @brief Evaluate the elastic energy gradient and (fixed rotation) hessian
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @param gF Gradient w.r.t. F
+     * @param HF Hessian w.r.t. F
+     */
+    template <
+        math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+    PBAT_HOST_DEVICE void gradAndHessian(
+        TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        typename TMatrix::ScalarType lambda,
+        TMatrixGF& gF,
+        TMatrixHF& HF) const;
+};
+
+template <int Dims>
+template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+PBAT_HOST_DEVICE typename TMatrix::ScalarType AsRigidAsPossibleEnergy<Dims>::eval(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    [[maybe_unused]] typename TMatrix::ScalarType lambda) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    auto const R     = PolarRotation<Dims>(F);
+    ScalarType ed2{0};
+    for (auto k = 0; k < Dims * Dims; ++k)
+    {
+        auto const dk = F[k] - R[k];
+        ed2 += dk * dk;
+    }
+    return mu * ed2;
+}
+
+template <int Dims>
+template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+PBAT_HOST_DEVICE AsRigidAsPossibleEnergy<Dims>::SVector<typename TMatrix::ScalarType, Dims * Dims>
+AsRigidAsPossibleEnergy<Dims>::grad(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    SVector<ScalarType, Dims * Dims> G;
+    evalWithGrad(F, mu, lambda, G);
+    return G;
+}
+
+template <int Dims>
+template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+PBAT_HOST_DEVICE
+    AsRigidAsPossibleEnergy<Dims>::SMatrix<typename TMatrix::ScalarType, Dims * Dims, Dims * Dims>
+    AsRigidAsPossibleEnergy<Dims>::hessian(
+        [[maybe_unused]] TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        [[maybe_unused]] typename TMatrix::ScalarType lambda) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    SMatrix<ScalarType, Dims * Dims, Dims * Dims> H;
+    for (auto j = 0; j < Dims * Dims; ++j)
+        for (auto i = 0; i < Dims * Dims; ++i)
+            H(i, j) = (i == j) ? ScalarType(2) * mu : ScalarType(0);
+    return H;
+}
+
+template <int Dims>
+template <
+    math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF>
+PBAT_HOST_DEVICE typename TMatrix::ScalarType AsRigidAsPossibleEnergy<Dims>::evalWithGrad(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    [[maybe_unused]] typename TMatrix::ScalarType lambda,
+    TMatrixGF& gF) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    auto const R     = PolarRotation<Dims>(F);
+    ScalarType ed2{0};
+    for (auto k = 0; k < Dims * Dims; ++k)
+    {
+        auto const dk = F[k] - R[k];
+        ed2 += dk * dk;
+        gF[k] = ScalarType(2) * mu * dk;
+    }
+    return mu * ed2;
+}
+
+template <int Dims>
+template <
+    math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+PBAT_HOST_DEVICE typename TMatrix::ScalarType AsRigidAsPossibleEnergy<Dims>::evalWithGradAndHessian(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda,
+    TMatrixGF& gF,
+    TMatrixHF& HF) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    for (auto j = 0; j < Dims * Dims; ++j)
+        for (auto i = 0; i < Dims * Dims; ++i)
+            HF(i, j) = (i == j) ? ScalarType(2) * mu : ScalarType(0);
+    return evalWithGrad(F, mu, lambda, gF);
+}
+
+template <int Dims>
+template <
+    math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+PBAT_HOST_DEVICE void AsRigidAsPossibleEnergy<Dims>::gradAndHessian(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda,
+    TMatrixGF& gF,
+    TMatrixHF& HF) const
+{
+    evalWithGradAndHessian(F, mu, lambda, gF, HF);
+}
+
+} // namespace physics
+} // namespace pbat
+
+#endif // PBAT_PHYSICS_ASRIGIDASPOSSIBLEENERGY_H
@@ -0,0 +1,70 @@
+#include "CorotationalEnergy.h"
+
+#include "HyperElasticity.h"
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/LU>
+#include <Eigen/QR>
+#include <doctest/doctest.h>
+#include <pbat/common/ConstexprFor.h>
+#include <pbat/math/linalg/mini/Eigen.h>
+
+TEST_CASE("[physics] CorotationalEnergy")
+{
+    using namespace pbat;
+    namespace mini = pbat::math::linalg::mini;
+    common::ForValues<1, 2, 3>([]<auto Dims>() {
+        using mini::FromEigen;
+        using mini::ToEigen;
+        physics::CorotationalEnergy<Dims> psi{};
+        Scalar constexpr Y      = 1e6;
+        Scalar constexpr nu     = 0.45;
+        auto const [mu, lambda] = physics::LameCoefficients(Y, nu);
+        Scalar const scale      = mu + lambda;
+        Scalar constexpr zero   = 1e-9;
+        // Random rotation
+        Matrix<Dims, Dims> R =
+            Eigen::HouseholderQR<Matrix<Dims, Dims>>(Matrix<Dims, Dims>::Random()).householderQ();
+        if (R.determinant() < Scalar(0))
+            R.col(0) *= Scalar(-1);
+        if constexpr (Dims == 1)
+            R(0, 0) = Scalar(1);
+        // Rigid deformations are at rest
+        Vector<Dims * Dims> const vecR = R.reshaped();
+        auto const vecRmini            = FromEigen(vecR);
+        mini::SVector<Scalar, Dims * Dims> gF;
+        Scalar const ePsiRigid = psi.evalWithGrad(vecRmini, mu, lambda, gF);
+        CHECK_LE(std::abs(ePsiRigid), zero * scale);
+        CHECK_LE(ToEigen(gF).norm(), zero * scale);
+        // Rotated stretch
+        Vector<Dims> const s = Vector<Dims>::Ones() + 0.3 * Vector<Dims>::Random();
+        Matrix<Dims, Dims> const F  = R * s.asDiagonal();
+        Vector<Dims * Dims> const vecF = F.reshaped();
+        auto const vecFmini            = FromEigen(vecF);
+        Scalar const ePsi              = psi.eval(vecFmini, mu, lambda);
+        Scalar const ePsiExpected      = mu * (s.array() - Scalar(1)).square().sum() +
+                                    Scalar(0.5) * lambda * (s.sum() - Dims) * (s.sum() - Dims);
+        CHECK_LE(std::abs(ePsi - ePsiExpected), zero * scale);
+        // Gradient matches central finite differences of the energy
+        mini::SMatrix<Scalar, Dims * Dims, Dims * Dims> HF;
+        Scalar const ePsiFromHess = psi.evalWithGradAndHessian(vecFmini, mu, lambda, gF, HF);
+        CHECK_LE(std::abs(ePsiFromHess - ePsiExpected), zero * scale);
+        Scalar constexpr h = 1e-6;
+        Vector<Dims * Dims> gFfd{};
+        for (auto k = 0; k < Dims * Dims; ++k)
+        {
+            Vector<Dims * Dims> Fp = vecF, Fm = vecF;
+            Fp(k) += h;
+            Fm(k) -= h;
+            gFfd(k) =
+                (psi.eval(FromEigen(Fp), mu, lambda) - psi.eval(FromEigen(Fm), mu, lambda)) /
+                (2 * h);
+        }
+        CHECK_LE((ToEigen(gF) - gFfd).norm(), 1e-6 * scale);
+        // Fixed rotation hessian is symmetric positive definite
+        Matrix<Dims * Dims, Dims * Dims> const HFe = ToEigen(HF);
+        CHECK_LE((HFe - HFe.transpose()).norm(), zero * scale);
+        Eigen::SelfAdjointEigenSolver<Matrix<Dims * Dims, Dims * Dims>> eigs(HFe);
+        CHECK_GE(eigs.eigenvalues().minCoeff(), Scalar(2) * mu * (1 - zero));
+    });
+}
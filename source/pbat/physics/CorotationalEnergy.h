@@ -0,0 +1,350 @@
+/**
+ * @file CorotationalEnergy.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Corotational linear hyperelastic energy
+ * @date 2025-02-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_PHYSICS_COROTATIONALENERGY_H
+#define PBAT_PHYSICS_COROTATIONALENERGY_H
+
+#include "pbat/HostDevice.h"
+#include "pbat/math/linalg/mini/Matrix.h"
+#include "pbat/math/linalg/mini/Svd.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace pbat {
+namespace physics {
+namespace detail {
+namespace corotational {
+
+template <class TScalar>
+struct ValueType
+{
+    using type = TScalar;
+};
+
+template <class TScalar>
+    requires requires { typename TScalar::value_type; }
+struct ValueType<TScalar>
+{
+    using type = typename TScalar::value_type;
+};
+
+} // namespace corotational
+} // namespace detail
+
+/**
+ * @brief Rotation factor \f$ \mathbf{R} \f$ of the (rotation variant) polar decomposition
+ * \f$ \mathbf{F} = \mathbf{R} \mathbf{S} \f$, i.e. the rotation maximizing
+ * \f$ \text{tr}(\mathbf{R}^T \mathbf{F}) \f$
+ *
+ * @tparam Dims Dimension of the space
+ * @tparam TMatrix Vectorized deformation gradient type
+ * @param F Vectorized deformation gradient
+ * @return Vectorized (column-major) rotation
+ */
+template <int Dims, class TMatrix>
+PBAT_HOST_DEVICE math::linalg::mini::SVector<typename TMatrix::ScalarType, Dims * Dims>
+PolarRotation(TMatrix const& F)
+{
+    using namespace std;
+    using ScalarType = typename TMatrix::ScalarType;
+    math::linalg::mini::SVector<ScalarType, Dims * Dims> R{};
+    if constexpr (Dims == 1)
+    {
+        R[0] = ScalarType(1);
+    }
+    else if constexpr (Dims == 2)
+    {
+        // R = [c -s; s c] maximizes c (F_00 + F_11) + s (F_10 - F_01). The tiny offset picks the
+        // identity when F has no rotational part (i.e. F = 0), without branching.
+        using ValueType = typename detail::corotational::ValueType<ScalarType>::type;
+        auto const a    = F[0] + F[3] + ScalarType(sqrt(numeric_limits<ValueType>::min()));
+        auto const b    = F[1] - F[2];
+        auto const n    = sqrt(a * a + b * b);
+        R[0]            = a / n;
+        R[1]            = b / n;
+        R[2]            = -R[1];
+        R[3]            = R[0];
+    }
+    else
+    {
+        math::linalg::mini::SMatrix<ScalarType, 3, 3> Fm{};
+        for (auto k = 0; k < 9; ++k)
+            Fm[k] = F[k];
+        math::linalg::mini::SMatrix<ScalarType, 3, 3> Rm{}, Sm{};
+        math::linalg::mini::Polar<8>(Fm, Rm, Sm);
+        for (auto k = 0; k < 9; ++k)
+            R[k] = Rm[k];
+    }
+    return R;
+}
+
+/**
+ * @brief Corotational linear hyperelastic energy
+ *
+ * \f[
+ * \Psi(\mathbf{F}) = \mu || \mathbf{F} - \mathbf{R} ||_F^2 + \frac{\lambda}{2} \left(
+ * \text{tr}(\mathbf{R}^T \mathbf{F}) - d \right)^2 ,
+ * \f]
+ * where \f$ \mathbf{R} \f$ is the rotation of the polar decomposition of \f$ \mathbf{F} \f$.
+ * The gradient \f$ 2 \mu (\mathbf{F} - \mathbf{R}) + \lambda (\text{tr}(\mathbf{R}^T \mathbf{F})
+ * - d) \mathbf{R} \f$ is exact, while the hessian \f$ 2 \mu \mathbf{I} + \lambda \text{vec}(\mathbf{R})
+ * \text{vec}(\mathbf{R})^T \f$ treats \f$ \mathbf{R} \f$ as constant, such that it is symmetric
+ * positive definite by construction and needs no projection.
+ *
+ * @tparam Dims Dimension of the space
+ */
+template <int Dims>
+struct CorotationalEnergy
+{
+  public:
+    template <class TScalar, int M, int N>
+    using SMatrix = pbat::math::linalg::mini::SMatrix<TScalar, M, N>; ///< Scalar matrix type
+
+    template <class TScalar, int M>
+    using SVector = pbat::math::linalg::mini::SVector<TScalar, M>; ///< Scalar vector type
+
+    static auto constexpr kDims = Dims; ///< Dimension of the space
+
+    /**
+     * @brief Evaluate the elastic energy
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @return Energy
+     */
+    template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+    PBAT_HOST_DEVICE typename TMatrix::ScalarType
+    eval(TMatrix const& F, typename TMatrix::ScalarType mu, typename TMatrix::ScalarType lambda)
+        const;
+
+    /**
+     * @brief Evaluate the elastic energy gradient
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @return Energy gradient
+     */
+    template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+    PBAT_HOST_DEVICE SVector<typename TMatrix::ScalarType, Dims * Dims>
+    grad(TMatrix const& F, typename TMatrix::ScalarType mu, typename TMatrix::ScalarType lambda)
+        const;
+
+    /**
+     * @brief Evaluate the (fixed rotation) elastic energy hessian
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @return Energy hessian
+     */
+    template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+    PBAT_HOST_DEVICE SMatrix<typename TMatrix::ScalarType, Dims * Dims, Dims * Dims>
+    hessian(TMatrix const& F, typename TMatrix::ScalarType mu, typename TMatrix::ScalarType lambda)
+        const;
+
+    /**
+     * @brief Evaluate the elastic energy and its gradient
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @param gF Gradient w.r.t. F
+     * @return Energy and its gradient
+     */
+    template <
+        math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF>
+    PBAT_HOST_DEVICE typename TMatrix::ScalarType evalWithGrad(
+        TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        typename TMatrix::ScalarType lambda,
+        TMatrixGF& gF) const;
+
+    /**
+     * @brief Evaluate the elastic energy with its gradient and (fixed rotation) hessian
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @param gF Gradient w.r.t. F
+     * @param HF Hessian w.r.t. F
+     * @return Energy and its gradient and hessian
+     */
+    template <
+        math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+    PBAT_HOST_DEVICE typename TMatrix::ScalarType evalWithGradAndHessian(
+        TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        typename TMatrix::ScalarType lambda,
+        TMatrixGF& gF,
+        TMatrixHF& HF) const;
+
+    /**
+     * @brief Evaluate the elastic energy gradient and (fixed rotation) hessian
+     *
+     * @tparam TMatrix Matrix type
+     * @param F Deformation gradient
+     * @param mu First Lame coefficient
+     * @param lambda Second Lame coefficient
+     * @param gF Gradient w.r.t. F
+     * @param HF Hessian w.r.t. F
+     */
+    template <
+        math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+        math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+    PBAT_HOST_DEVICE void gradAndHessian(
+        TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        typename TMatrix::ScalarType lambda,
+        TMatrixGF& gF,
+        TMatrixHF& HF) const;
+};
+
+template <int Dims>
+template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+PBAT_HOST_DEVICE typename TMatrix::ScalarType CorotationalEnergy<Dims>::eval(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    auto const R     = PolarRotation<Dims>(F);
+    ScalarType ed2{0};
+    ScalarType trRTF{0};
+    for (auto k = 0; k < Dims * Dims; ++k)
+    {
+        auto const dk = F[k] - R[k];
+        ed2 += dk * dk;
+        trRTF += R[k] * F[k];
+    }
+    auto const eh = trRTF - ScalarType(Dims);
+    return mu * ed2 + ScalarType(0.5) * lambda * eh * eh;
+}
+
+template <int Dims>
+template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+PBAT_HOST_DEVICE CorotationalEnergy<Dims>::SVector<typename TMatrix::ScalarType, Dims * Dims>
+CorotationalEnergy<Dims>::grad(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    SVector<ScalarType, Dims * Dims> G;
+    evalWithGrad(F, mu, lambda, G);
+    return G;
+}
+
+template <int Dims>
+template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+PBAT_HOST_DEVICE
+    CorotationalEnergy<Dims>::SMatrix<typename TMatrix::ScalarType, Dims * Dims, Dims * Dims>
+    CorotationalEnergy<Dims>::hessian(
+        TMatrix const& F,
+        typename TMatrix::ScalarType mu,
+        typename TMatrix::ScalarType lambda) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    SVector<ScalarType, Dims * Dims> G;
+    SMatrix<ScalarType, Dims * Dims, Dims * Dims> H;
+    gradAndHessian(F, mu, lambda, G, H);
+    return H;
+}
+
+template <int Dims>
+template <
+    math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF>
+PBAT_HOST_DEVICE typename TMatrix::ScalarType CorotationalEnergy<Dims>::evalWithGrad(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda,
+    TMatrixGF& gF) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    auto const R     = PolarRotation<Dims>(F);
+    ScalarType ed2{0};
+    ScalarType trRTF{0};
+    for (auto k = 0; k < Dims * Dims; ++k)
+    {
+        auto const dk = F[k] - R[k];
+        ed2 += dk * dk;
+        trRTF += R[k] * F[k];
+    }
+    auto const eh = trRTF - ScalarType(Dims);
+    for (auto k = 0; k < Dims * Dims; ++k)
+        gF[k] = ScalarType(2) * mu * (F[k] - R[k]) + lambda * eh * R[k];
+    return mu * ed2 + ScalarType(0.5) * lambda * eh * eh;
+}
+
+template <int Dims>
+template <
+    math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+PBAT_HOST_DEVICE typename TMatrix::ScalarType CorotationalEnergy<Dims>::evalWithGradAndHessian(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda,
+    TMatrixGF& gF,
+    TMatrixHF& HF) const
+{
+    using ScalarType = typename TMatrix::ScalarType;
+    auto const R     = PolarRotation<Dims>(F);
+    ScalarType ed2{0};
+    ScalarType trRTF{0};
+    for (auto k = 0; k < Dims * Dims; ++k)
+    {
+        auto const dk = F[k] - R[k];
+        ed2 += dk * dk;
+        trRTF += R[k] * F[k];
+    }
+    auto const eh = trRTF - ScalarType(Dims);
+    for (auto k = 0; k < Dims * Dims; ++k)
+        gF[k] = ScalarType(2) * mu * (F[k] - R[k]) + lambda * eh * R[k];
+    for (auto j = 0; j < Dims * Dims; ++j)
+    {
+        for (auto i = 0; i < Dims * Dims; ++i)
+            HF(i, j) = lambda * R[i] * R[j];
+        HF(j, j) += ScalarType(2) * mu;
+    }
+    return mu * ed2 + ScalarType(0.5) * lambda * eh * eh;
+}
+
+template <int Dims>
+template <
+    math::linalg::mini::CReadableVectorizedMatrix TMatrix,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixGF,
+    math::linalg::mini::CWriteableVectorizedMatrix TMatrixHF>
+PBAT_HOST_DEVICE void CorotationalEnergy<Dims>::gradAndHessian(
+    TMatrix const& F,
+    typename TMatrix::ScalarType mu,
+    typename TMatrix::ScalarType lambda,
+    TMatrixGF& gF,
+    TMatrixHF& HF) const
+{
+    evalWithGradAndHessian(F, mu, lambda, gF, HF);
+}
+
+} // namespace physics
+} // namespace pbat
+
+#endif // PBAT_PHYSICS_COROTATIONALENERGY_H
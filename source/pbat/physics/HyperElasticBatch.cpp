@@ -0,0 +1,73 @@
+#include "HyperElasticBatch.h"
+
+#include "AsRigidAsPossibleEnergy.h"
+#include "CorotationalEnergy.h"
+#include "SaintVenantKirchhoffEnergy.h"
+#include "StableNeoHookeanEnergy.h"
+
+#include <doctest/doctest.h>
+#include <pbat/common/ConstexprFor.h>
+#include <pbat/math/linalg/mini/Eigen.h>
+
+TEST_CASE("[physics] HyperElasticBatch")
+{
+    using namespace pbat;
+    namespace mini          = pbat::math::linalg::mini;
+    Scalar constexpr Y      = 1e6;
+    Scalar constexpr nu     = 0.45;
+    auto const [mu, lambda] = physics::LameCoefficients(Y, nu);
+    Scalar constexpr zero   = 1e-10;
+    // Batched evaluation must match lane by lane evaluation
+    auto const checkBatch = [&]<int W>(auto const& Psi) {
+        using EnergyType     = std::remove_cvref_t<decltype(Psi)>;
+        auto constexpr kDims = EnergyType::kDims * EnergyType::kDims;
+        Matrix<W, kDims> F   = Matrix<W, kDims>::Random();
+        for (auto l = 0; l < W; ++l)
+            F.row(l) += Matrix<EnergyType::kDims, EnergyType::kDims>::Identity()
+                            .reshaped()
+                            .transpose();
+        Vector<W> const mus     = mu * (Vector<W>::Ones() + 0.1 * Vector<W>::Random());
+        Vector<W> const lambdas = lambda * (Vector<W>::Ones() + 0.1 * Vector<W>::Random());
+        Vector<W> psi, psiFromGrad, psiFromHess;
+        Matrix<W, kDims> gF, gFFromHess;
+        Matrix<W, kDims * kDims> HF;
+        physics::EvalBatch(Psi, F, mus, lambdas, psi);
+        physics::EvalWithGradBatch(Psi, F, mus, lambdas, psiFromGrad, gF);
+        physics::EvalWithGradAndHessianBatch(Psi, F, mus, lambdas, psiFromHess, gFFromHess, HF);
+        for (auto l = 0; l < W; ++l)
+        {
+            Vector<kDims> const vecF = F.row(l).transpose();
+            mini::SVector<Scalar, kDims> gFExpected;
+            mini::SMatrix<Scalar, kDims, kDims> HFExpected;
+            Scalar const psiExpected = Psi.evalWithGradAndHessian(
+                mini::FromEigen(vecF),
+                mus(l),
+                lambdas(l),
+                gFExpected,
+                HFExpected);
+            Scalar const scale = std::max(std::abs(psiExpected), Scalar(1));
+            CHECK_LE(std::abs(psi(l) - psiExpected), zero * scale);
+            CHECK_LE(std::abs(psiFromGrad(l) - psiExpected), zero * scale);
+            CHECK_LE(std::abs(psiFromHess(l) - psiExpected), zero * scale);
+            Vector<kDims> const gFExpectedEigen = mini::ToEigen(gFExpected);
+            CHECK_LE(
+                (gF.row(l).transpose() - gFExpectedEigen).norm(),
+                zero * gFExpectedEigen.norm());
+            CHECK_LE(
+                (gFFromHess.row(l).transpose() - gFExpectedEigen).norm(),
+                zero * gFExpectedEigen.norm());
+            Vector<kDims * kDims> const HFExpectedEigen = mini::ToEigen(HFExpected).reshaped();
+            CHECK_LE(
+                (HF.row(l).transpose() - HFExpectedEigen).norm(),
+                zero * HFExpectedEigen.norm());
+        }
+    };
+    common::ForValues<4, 8, 16>([&]<auto W>() {
+        checkBatch.template operator()<W>(physics::StableNeoHookeanEnergy<2>{});
+        checkBatch.template operator()<W>(physics::StableNeoHookeanEnergy<3>{});
+        checkBatch.template operator()<W>(physics::SaintVenantKirchhoffEnergy<3>{});
+        checkBatch.template operator()<W>(physics::CorotationalEnergy<2>{});
+        checkBatch.template operator()<W>(physics::CorotationalEnergy<3>{});
+        checkBatch.template operator()<W>(physics::AsRigidAsPossibleEnergy<3>{});
+    });
+}
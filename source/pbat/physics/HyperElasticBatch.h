@@ -0,0 +1,211 @@
+/**
+ * @file HyperElasticBatch.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Lane-batched (SIMD) evaluation of hyper elastic energy densities
+ *
+ * Batches are structure-of-arrays blocks of `W` deformation gradients, i.e. `W x d^2` column-major
+ * matrices whose row `l` stores the vectorized deformation gradient of lane `l`, such that each
+ * component is contiguous across lanes. The generated energy expressions are evaluated once for
+ * all lanes, using `std::experimental::fixed_size_simd` registers of the compiled-for instruction
+ * set as scalars. Without `<experimental/simd>`, lanes are evaluated one by one.
+ *
+ * @date 2025-02-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_PHYSICS_HYPERELASTICBATCH_H
+#define PBAT_PHYSICS_HYPERELASTICBATCH_H
+
+#include "HyperElasticity.h"
+#include "pbat/Aliases.h"
+#include "pbat/math/linalg/mini/Matrix.h"
+
+#if not defined(__CUDACC__) and __has_include(<experimental/simd>)
+    #include <experimental/simd>
+    #define PBAT_PHYSICS_HAS_SIMD_BATCH
+#endif
+
+namespace pbat {
+namespace physics {
+
+namespace detail {
+
+#if defined(PBAT_PHYSICS_HAS_SIMD_BATCH)
+
+template <int W>
+using BatchScalar = std::experimental::fixed_size_simd<Scalar, W>;
+
+template <int W, int N>
+math::linalg::mini::SMatrix<BatchScalar<W>, N, 1> LoadBatch(Matrix<W, N> const& A)
+{
+    math::linalg::mini::SMatrix<BatchScalar<W>, N, 1> B{};
+    for (auto k = 0; k < N; ++k)
+        B[k].copy_from(A.col(k).data(), std::experimental::element_aligned);
+    return B;
+}
+
+template <int W>
+BatchScalar<W> LoadLanes(Vector<W> const& a)
+{
+    return BatchScalar<W>(a.data(), std::experimental::element_aligned);
+}
+
+template <int W, int N, class TMatrix>
+void StoreBatch(TMatrix const& B, Matrix<W, N>& A)
+{
+    for (auto k = 0; k < N; ++k)
+        B[k].copy_to(A.col(k).data(), std::experimental::element_aligned);
+}
+
+#else
+
+template <int N, class TDerived>
+math::linalg::mini::SMatrix<Scalar, N, 1> LoadLane(Eigen::DenseBase<TDerived> const& row)
+{
+    math::linalg::mini::SMatrix<Scalar, N, 1> a{};
+    for (auto k = 0; k < N; ++k)
+        a[k] = row(k);
+    return a;
+}
+
+#endif // PBAT_PHYSICS_HAS_SIMD_BATCH
+
+} // namespace detail
+
+/**
+ * @brief Evaluate the energy densities of a batch of deformation gradients
+ *
+ * @tparam TEnergy Hyper elastic energy type
+ * @tparam W Number of lanes
+ * @param Psi Hyper elastic energy density
+ * @param F `W x d^2` structure-of-arrays vectorized deformation gradients
+ * @param mu `W x 1` first Lame coefficients
+ * @param lambda `W x 1` second Lame coefficients
+ * @param psi `W x 1` output energy densities
+ */
+template <CHyperElasticEnergy TEnergy, int W>
+void EvalBatch(
+    TEnergy const& Psi,
+    Matrix<W, TEnergy::kDims * TEnergy::kDims> const& F,
+    Vector<W> const& mu,
+    Vector<W> const& lambda,
+    Vector<W>& psi)
+{
+    auto constexpr kDims = TEnergy::kDims * TEnergy::kDims;
+#if defined(PBAT_PHYSICS_HAS_SIMD_BATCH)
+    auto const vecF = detail::LoadBatch<W, kDims>(F);
+    auto const psiF = Psi.eval(vecF, detail::LoadLanes<W>(mu), detail::LoadLanes<W>(lambda));
+    psiF.copy_to(psi.data(), std::experimental::element_aligned);
+#else
+    for (auto l = 0; l < W; ++l)
+        psi(l) = Psi.eval(detail::LoadLane<kDims>(F.row(l)), mu(l), lambda(l));
+#endif
+}
+
+/**
+ * @brief Evaluate the energy densities and their gradients of a batch of deformation gradients
+ *
+ * @tparam TEnergy Hyper elastic energy type
+ * @tparam W Number of lanes
+ * @param Psi Hyper elastic energy density
+ * @param F `W x d^2` structure-of-arrays vectorized deformation gradients
+ * @param mu `W x 1` first Lame coefficients
+ * @param lambda `W x 1` second Lame coefficients
+ * @param psi `W x 1` output energy densities
+ * @param gF `W x d^2` output structure-of-arrays gradients w.r.t. F
+ */
+template <CHyperElasticEnergy TEnergy, int W>
+void EvalWithGradBatch(
+    TEnergy const& Psi,
+    Matrix<W, TEnergy::kDims * TEnergy::kDims> const& F,
+    Vector<W> const& mu,
+    Vector<W> const& lambda,
+    Vector<W>& psi,
+    Matrix<W, TEnergy::kDims * TEnergy::kDims>& gF)
+{
+    auto constexpr kDims = TEnergy::kDims * TEnergy::kDims;
+#if defined(PBAT_PHYSICS_HAS_SIMD_BATCH)
+    using BatchType = detail::BatchScalar<W>;
+    auto const vecF = detail::LoadBatch<W, kDims>(F);
+    math::linalg::mini::SVector<BatchType, kDims> gradPsiF{};
+    auto const psiF = Psi.evalWithGrad(
+        vecF,
+        detail::LoadLanes<W>(mu),
+        detail::LoadLanes<W>(lambda),
+        gradPsiF);
+    psiF.copy_to(psi.data(), std::experimental::element_aligned);
+    detail::StoreBatch<W, kDims>(gradPsiF, gF);
+#else
+    for (auto l = 0; l < W; ++l)
+    {
+        math::linalg::mini::SVector<Scalar, kDims> gradPsiF{};
+        psi(l) = Psi.evalWithGrad(detail::LoadLane<kDims>(F.row(l)), mu(l), lambda(l), gradPsiF);
+        for (auto k = 0; k < kDims; ++k)
+            gF(l, k) = gradPsiF[k];
+    }
+#endif
+}
+
+/**
+ * @brief Evaluate the energy densities, their gradients and hessians of a batch of deformation
+ * gradients
+ *
+ * @tparam TEnergy Hyper elastic energy type
+ * @tparam W Number of lanes
+ * @param Psi Hyper elastic energy density
+ * @param F `W x d^2` structure-of-arrays vectorized deformation gradients
+ * @param mu `W x 1` first Lame coefficients
+ * @param lambda `W x 1` second Lame coefficients
+ * @param psi `W x 1` output energy densities
+ * @param gF `W x d^2` output structure-of-arrays gradients w.r.t. F
+ * @param HF `W x d^4` output structure-of-arrays (column-major vectorized) hessians w.r.t. F
+ */
+template <CHyperElasticEnergy TEnergy, int W>
+void EvalWithGradAndHessianBatch(
+    TEnergy const& Psi,
+    Matrix<W, TEnergy::kDims * TEnergy::kDims> const& F,
+    Vector<W> const& mu,
+    Vector<W> const& lambda,
+    Vector<W>& psi,
+    Matrix<W, TEnergy::kDims * TEnergy::kDims>& gF,
+    Matrix<W, TEnergy::kDims * TEnergy::kDims * TEnergy::kDims * TEnergy::kDims>& HF)
+{
+    auto constexpr kDims = TEnergy::kDims * TEnergy::kDims;
+#if defined(PBAT_PHYSICS_HAS_SIMD_BATCH)
+    using BatchType = detail::BatchScalar<W>;
+    auto const vecF = detail::LoadBatch<W, kDims>(F);
+    math::linalg::mini::SVector<BatchType, kDims> gradPsiF{};
+    math::linalg::mini::SMatrix<BatchType, kDims, kDims> hessPsiF{};
+    auto const psiF = Psi.evalWithGradAndHessian(
+        vecF,
+        detail::LoadLanes<W>(mu),
+        detail::LoadLanes<W>(lambda),
+        gradPsiF,
+        hessPsiF);
+    psiF.copy_to(psi.data(), std::experimental::element_aligned);
+    detail::StoreBatch<W, kDims>(gradPsiF, gF);
+    detail::StoreBatch<W, kDims * kDims>(hessPsiF, HF);
+#else
+    for (auto l = 0; l < W; ++l)
+    {
+        math::linalg::mini::SVector<Scalar, kDims> gradPsiF{};
+        math::linalg::mini::SMatrix<Scalar, kDims, kDims> hessPsiF{};
+        psi(l) = Psi.evalWithGradAndHessian(
+            detail::LoadLane<kDims>(F.row(l)),
+            mu(l),
+            lambda(l),
+            gradPsiF,
+            hessPsiF);
+        for (auto k = 0; k < kDims; ++k)
+            gF(l, k) = gradPsiF[k];
+        for (auto k = 0; k < kDims * kDims; ++k)
+            HF(l, k) = hessPsiF[k];
+    }
+#endif
+}
+
+} // namespace physics
+} // namespace pbat
+
+#endif // PBAT_PHYSICS_HYPERELASTICBATCH_H
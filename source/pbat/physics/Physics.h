@@ -10,8 +10,12 @@
 #ifndef PBAT_PHYSICS_PHYSICS_H
 #define PBAT_PHYSICS_PHYSICS_H
 
+#include "AsRigidAsPossibleEnergy.h"
+#include "CorotationalEnergy.h"
+#include "HyperElasticBatch.h"
 #include "HyperElasticity.h"
 #include "SaintVenantKirchhoffEnergy.h"
+#include "SpdProjection.h"
 #include "StableNeoHookeanEnergy.h"
 
 #endif // PBAT_PHYSICS_PHYSICS_H
\ No newline at end of file
@@ -13,12 +13,13 @@ TEST_CASE("[physics] SaintVenantKirchhoffEnergy")
     common::ForValues<1, 2, 3>([]<auto Dims>() {
         using mini::FromEigen;
         physics::SaintVenantKirchhoffEnergy<Dims> psi{};
-        Matrix<Dims, Dims> const F = Matrix<Dims, Dims>::Identity();
-        Scalar constexpr Y         = 1e6;
-        Scalar constexpr nu        = 0.45;
-        auto const [mu, lambda]    = physics::LameCoefficients(Y, nu);
-        auto vecF                  = FromEigen(F.reshaped());
-        Scalar const ePsi          = psi.eval(vecF, mu, lambda);
+        Matrix<Dims, Dims> const F      = Matrix<Dims, Dims>::Identity();
+        Scalar constexpr Y              = 1e6;
+        Scalar constexpr nu             = 0.45;
+        auto const [mu, lambda]         = physics::LameCoefficients(Y, nu);
+        Vector<Dims * Dims> const vecFe = F.reshaped();
+        auto vecF                       = FromEigen(vecFe);
+        Scalar const ePsi               = psi.eval(vecF, mu, lambda);
         mini::SVector<Scalar, Dims * Dims> gF;
         Scalar const ePsiFromGrad = psi.evalWithGrad(vecF, mu, lambda, gF);
         gF.SetZero();
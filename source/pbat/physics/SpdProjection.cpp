@@ -0,0 +1,65 @@
+#include "SpdProjection.h"
+
+#include "HyperElasticity.h"
+#include "SaintVenantKirchhoffEnergy.h"
+#include "StableNeoHookeanEnergy.h"
+
+#include <Eigen/Eigenvalues>
+#include <doctest/doctest.h>
+#include <pbat/math/linalg/mini/Eigen.h>
+
+TEST_CASE("[physics] SpdProjection")
+{
+    using namespace pbat;
+    namespace mini          = pbat::math::linalg::mini;
+    Scalar constexpr Y      = 1e6;
+    Scalar constexpr nu     = 0.45;
+    auto const [mu, lambda] = physics::LameCoefficients(Y, nu);
+    using HessianType       = Matrix<9, 9>;
+    // Reference projection clamps the eigenvalues of the exact hessian
+    auto const projectExactHessian = [&](auto const& Psi, Matrix<3, 3> const& F) {
+        Vector<9> const vecF = F.reshaped();
+        auto const HF        = Psi.hessian(mini::FromEigen(vecF), mu, lambda);
+        Eigen::SelfAdjointEigenSolver<HessianType> eigs(HessianType{mini::ToEigen(HF)});
+        Vector<9> const sigma = eigs.eigenvalues().cwiseMax(Scalar(0));
+        return HessianType{
+            eigs.eigenvectors() * sigma.asDiagonal() * eigs.eigenvectors().transpose()};
+    };
+    // Rest, stretched, compressed, sheared and inverted deformation gradients
+    Matrix<3, 3> Fs[5];
+    Fs[0] = Matrix<3, 3>::Identity();
+    Fs[1] = Vector<3>{1.5, 1.2, 0.8}.asDiagonal();
+    Fs[2] = Vector<3>{0.3, 0.5, 0.4}.asDiagonal();
+    Fs[3] << 1., 0.7, -0.2, 0.1, 0.9, 0.4, -0.3, 0.2, 1.1;
+    Fs[4] = Vector<3>{-0.5, 1.1, 0.9}.asDiagonal();
+    // Projected hessians may vanish (e.g. SVK under strong compression), so errors are measured
+    // relative to the hessian's scale rather than its norm
+    Scalar const scale    = mu + lambda;
+    Scalar constexpr zero = 1e-10;
+    for (auto const& F : Fs)
+    {
+        for (auto k = 0; k < 2; ++k)
+        {
+            Matrix<3, 3> const R  = Eigen::Quaternion<Scalar>::UnitRandom().toRotationMatrix();
+            Matrix<3, 3> const RF = (k == 0) ? F : Matrix<3, 3>{R * F};
+            Vector<9> const vecRF = RF.reshaped();
+            auto vecF             = mini::FromEigen(vecRF);
+            // Stable Neo-Hookean's analytic eigensystem yields the exact projection
+            physics::StableNeoHookeanEnergy<3> snh{};
+            HessianType const HsnhExpected = projectExactHessian(snh, RF);
+            auto const Hsnh                = physics::SpdHessian(snh, vecF, mu, lambda);
+            Scalar const snhError =
+                (mini::ToEigen(Hsnh) - HsnhExpected).norm() / scale;
+            CHECK_LE(snhError, zero);
+            // Generic projection
+            physics::SaintVenantKirchhoffEnergy<3> svk{};
+            HessianType const HsvkExpected = projectExactHessian(svk, RF);
+            auto const Hsvk                = physics::SpdHessian(svk, vecF, mu, lambda);
+            Scalar const svkError =
+                (mini::ToEigen(Hsvk) - HsvkExpected).norm() / scale;
+            CHECK_LE(svkError, zero);
+            Eigen::SelfAdjointEigenSolver<HessianType> eigs(HessianType{mini::ToEigen(Hsvk)});
+            CHECK_GE(eigs.eigenvalues().minCoeff(), -zero * scale);
+        }
+    }
+}
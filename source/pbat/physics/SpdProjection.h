@@ -0,0 +1,183 @@
+/**
+ * @file SpdProjection.h
+ * @author Quoc-Minh Ton-That (tonthat.quocminh@gmail.com)
+ * @brief Positive semi-definite projections of hyper elastic energy density hessians
+ * @date 2025-02-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef PBAT_PHYSICS_SPDPROJECTION_H
+#define PBAT_PHYSICS_SPDPROJECTION_H
+
+#include "AsRigidAsPossibleEnergy.h"
+#include "CorotationalEnergy.h"
+#include "HyperElasticity.h"
+#include "StableNeoHookeanEnergy.h"
+#include "pbat/Aliases.h"
+#include "pbat/math/linalg/mini/Eigen.h"
+#include "pbat/math/linalg/mini/Matrix.h"
+#include "pbat/math/linalg/mini/Svd.h"
+
+#include <Eigen/Eigenvalues>
+#include <array>
+#include <cmath>
+
+namespace pbat {
+namespace physics {
+
+/**
+ * @brief Hessian of the energy density w.r.t. the (vectorized) deformation gradient, projected to
+ * the nearest positive semi-definite matrix
+ *
+ * Clamps the negative eigenvalues of the \f$ d^2 \times d^2 \f$ hessian to 0. Element hessians
+ * \f$ \frac{\partial \mathbf{F}}{\partial \mathbf{x}_e}^T \frac{\partial^2 \Psi}{\partial
+ * \mathbf{F}^2} \frac{\partial \mathbf{F}}{\partial \mathbf{x}_e} \f$ of a projected hessian are
+ * positive semi-definite, such that projecting in deformation gradient space is much cheaper than
+ * projecting element hessians.
+ *
+ * @tparam TEnergy Hyper elastic energy type
+ * @tparam TMatrix Vectorized deformation gradient type
+ * @param Psi Hyper elastic energy density
+ * @param F Vectorized deformation gradient
+ * @param mu First Lame coefficient
+ * @param lambda Second Lame coefficient
+ * @return `d^2 x d^2` positive semi-definite hessian
+ */
+template <CHyperElasticEnergy TEnergy, math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+math::linalg::mini::SMatrix<Scalar, TEnergy::kDims * TEnergy::kDims, TEnergy::kDims * TEnergy::kDims>
+SpdHessian(TEnergy const& Psi, TMatrix const& F, Scalar mu, Scalar lambda)
+{
+    auto constexpr kDims = TEnergy::kDims * TEnergy::kDims;
+    using HessianType    = Matrix<kDims, kDims>;
+    auto HF              = Psi.hessian(F, mu, lambda);
+    Eigen::SelfAdjointEigenSolver<HessianType> eigs(HessianType{math::linalg::mini::ToEigen(HF)});
+    if ((eigs.eigenvalues().array() >= Scalar(0)).all())
+        return HF;
+    Vector<kDims> const sigma = eigs.eigenvalues().cwiseMax(Scalar(0));
+    HessianType const HFplus =
+        eigs.eigenvectors() * sigma.asDiagonal() * eigs.eigenvectors().transpose();
+    HF = math::linalg::mini::FromEigen(HFplus);
+    return HF;
+}
+
+/**
+ * @brief Hessian of the Stable Neo-Hookean energy density w.r.t. the (vectorized) deformation
+ * gradient, projected to the nearest positive semi-definite matrix using its analytic
+ * eigensystem \cite smith2019analytic
+ *
+ * With the rotation variant SVD \f$ \mathbf{F} = \mathbf{U} \Sigma \mathbf{V}^T \f$, the
+ * hessian's eigenvectors are \f$ \text{vec}(\mathbf{U} \mathbf{Q}_i \mathbf{V}^T) \f$, for 3
+ * twist and 3 flip matrices \f$ \mathbf{Q}_i \f$ of closed-form eigenvalues, and 3 diagonal
+ * scaling matrices whose eigenvalues are those of a \f$ 3 \times 3 \f$ symmetric matrix.
+ *
+ * @tparam TMatrix Vectorized deformation gradient type
+ * @param Psi Stable Neo-Hookean energy density
+ * @param F Vectorized deformation gradient
+ * @param mu First Lame coefficient
+ * @param lambda Second Lame coefficient
+ * @return `9 x 9` positive semi-definite hessian
+ */
+template <math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+math::linalg::mini::SMatrix<Scalar, 9, 9> SpdHessian(
+    [[maybe_unused]] StableNeoHookeanEnergy<3> const& Psi,
+    TMatrix const& F,
+    Scalar mu,
+    Scalar lambda)
+{
+    namespace mini = math::linalg::mini;
+    mini::SMatrix<Scalar, 3, 3> Fm{};
+    for (auto i = 0; i < 9; ++i)
+        Fm[i] = F[i];
+    // Rotation variant SVD, i.e. reflections are absorbed by the smallest singular value
+    mini::SMatrix<Scalar, 3, 3> Um{};
+    mini::SVector<Scalar, 3> sm{};
+    mini::SMatrix<Scalar, 3, 3> Vm{};
+    mini::Svd<8>(Fm, Um, sm, Vm);
+    Matrix<3, 3> const U = mini::ToEigen(Um);
+    Matrix<3, 3> const V = mini::ToEigen(Vm);
+    Vector<3> const s    = mini::ToEigen(sm);
+    // \Psi = \frac{\mu}{2} (I_C - 3) + \frac{\lambda}{2} (J - \alpha)^2 has hessian
+    // \mu I + \lambda g_J g_J^T + \lambda (J - \alpha) H_J
+    Scalar const J     = s.prod();
+    Scalar const alpha = Scalar(1) + mu / lambda;
+    Scalar const kJ    = lambda * (J - alpha);
+    Matrix<9, 9> HF    = Matrix<9, 9>::Zero();
+    auto const addEigenPair = [&](Scalar ev, Matrix<3, 3> const& Q) {
+        if (ev <= Scalar(0))
+            return;
+        Vector<9> const q = (U * Q * V.transpose()).reshaped();
+        HF += ev * q * q.transpose();
+    };
+    // Twist and flip eigenpairs of the off-diagonal entries (i,j),(j,i), where k is the remaining
+    // axis
+    Scalar const invSqrt2 = Scalar(1) / std::sqrt(Scalar(2));
+    std::array<std::array<int, 3>, 3> constexpr ijk{{{1, 2, 0}, {0, 2, 1}, {0, 1, 2}}};
+    for (auto const& [i, j, k] : ijk)
+    {
+        Matrix<3, 3> T = Matrix<3, 3>::Zero();
+        T(i, j)        = invSqrt2;
+        T(j, i)        = -invSqrt2;
+        addEigenPair(mu + kJ * s(k), T);
+        T(j, i) = invSqrt2;
+        addEigenPair(mu - kJ * s(k), T);
+    }
+    // Scaling eigenpairs of the diagonal entries
+    Vector<3> const gJ{s(1) * s(2), s(0) * s(2), s(0) * s(1)};
+    Matrix<3, 3> HJ{};
+    // clang-format off
+    HJ << Scalar(0),      s(2),      s(1),
+               s(2), Scalar(0),      s(0),
+               s(1),      s(0), Scalar(0);
+    // clang-format on
+    Matrix<3, 3> const A = mu * Matrix<3, 3>::Identity() + lambda * gJ * gJ.transpose() + kJ * HJ;
+    Eigen::SelfAdjointEigenSolver<Matrix<3, 3>> eigs(A);
+    for (auto d = 0; d < 3; ++d)
+        addEigenPair(eigs.eigenvalues()(d), eigs.eigenvectors().col(d).asDiagonal());
+    mini::SMatrix<Scalar, 9, 9> HFplus{};
+    HFplus = mini::FromEigen(HF);
+    return HFplus;
+}
+
+/**
+ * @brief Hessian of the corotational energy density w.r.t. the (vectorized) deformation gradient,
+ * which is positive definite by construction
+ *
+ * @tparam Dims Dimension of the space
+ * @tparam TMatrix Vectorized deformation gradient type
+ * @param Psi Corotational energy density
+ * @param F Vectorized deformation gradient
+ * @param mu First Lame coefficient
+ * @param lambda Second Lame coefficient
+ * @return `d^2 x d^2` positive definite hessian
+ */
+template <int Dims, math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+math::linalg::mini::SMatrix<Scalar, Dims * Dims, Dims * Dims>
+SpdHessian(CorotationalEnergy<Dims> const& Psi, TMatrix const& F, Scalar mu, Scalar lambda)
+{
+    return Psi.hessian(F, mu, lambda);
+}
+
+/**
+ * @brief Hessian of the as-rigid-as-possible energy density w.r.t. the (vectorized) deformation
+ * gradient, which is positive definite by construction
+ *
+ * @tparam Dims Dimension of the space
+ * @tparam TMatrix Vectorized deformation gradient type
+ * @param Psi As-rigid-as-possible energy density
+ * @param F Vectorized deformation gradient
+ * @param mu First Lame coefficient
+ * @param lambda Second Lame coefficient
+ * @return `d^2 x d^2` positive definite hessian
+ */
+template <int Dims, math::linalg::mini::CReadableVectorizedMatrix TMatrix>
+math::linalg::mini::SMatrix<Scalar, Dims * Dims, Dims * Dims>
+SpdHessian(AsRigidAsPossibleEnergy<Dims> const& Psi, TMatrix const& F, Scalar mu, Scalar lambda)
+{
+    return Psi.hessian(F, mu, lambda);
+}
+
+} // namespace physics
+} // namespace pbat
+
+#endif // PBAT_PHYSICS_SPDPROJECTION_H
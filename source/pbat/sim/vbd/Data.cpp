@@ -140,6 +140,12 @@ Data& Data::WithHessianDeterminantZeroUnder(Scalar zero)
     return *this;
 }
 
+Data& Data::WithElasticEnergy(std::vector<EElasticEnergy> const& psieIn)
+{
+    this->psie = psieIn;
+    return *this;
+}
+
 Data& Data::Construct(bool bValidate)
 {
     // Vertex data
@@ -173,6 +179,10 @@ Data& Data::Construct(bool bValidate)
     {
         rhoe.setConstant(E.cols(), Scalar(1e3));
     }
+    if (psie.empty())
+    {
+        psie.assign(static_cast<std::size_t>(E.cols()), EElasticEnergy::StableNeoHookean);
+    }
     VolumeMesh mesh{X, E};
     MatrixX detJe = fem::DeterminantOfJacobian<2>(mesh);
     MatrixX rhog  = rhoe.transpose().replicate(detJe.rows(), 1);
@@ -225,6 +235,19 @@ Data& Data::Construct(bool bValidate)
                 x.cols());
             throw std::invalid_argument(what);
         }
+        // clang-format off
+        bool const bPerElementQuantityDimensionsValid =
+            E.cols() == lame.cols() and
+            E.cols() == rhoe.size() and
+            static_cast<std::size_t>(E.cols()) == psie.size();
+        // clang-format on
+        if (not bPerElementQuantityDimensionsValid)
+        {
+            std::string const what = fmt::format(
+                "lame, rhoe and psie must have #elements={} columns (or entries)",
+                E.cols());
+            throw std::invalid_argument(what);
+        }
     }
     return *this;
 }
@@ -6,6 +6,8 @@
 #include "pbat/Aliases.h"
 #include "pbat/graph/Enums.h"
 
+#include <vector>
+
 namespace pbat {
 namespace sim {
 namespace vbd {
@@ -116,6 +118,13 @@ PBAT_API struct Data
      * @return
      */
     Data& WithHessianDeterminantZeroUnder(Scalar zero);
+    /**
+     * @brief Per-element elastic energy models, e.g. corotational or as-rigid-as-possible energies
+     * as a cheap level of detail for objects whose deformations matter less
+     * @param psie |#elems| elastic energy models
+     * @return
+     */
+    Data& WithElasticEnergy(std::vector<EElasticEnergy> const& psie);
     /**
      * @brief
      * @param bValidate Throw on detected ill-formed inputs
@@ -148,6 +157,7 @@ PBAT_API struct Data
     MatrixX GP;   ///< |#elem.nodes|x|#dims*#elems| shape function gradients at elems
     VectorX rhoe; ///< |#elems| mass densities
     MatrixX lame; ///< 2x|#elems| Lame coefficients
+    std::vector<EElasticEnergy> psie; ///< |#elems| elastic energy models
 
     IndexVectorX GVGp;      ///< |#verts+1| prefixes into GVGg
     IndexVectorX GVGe;      ///< |# of vertex-elems edges| element indices s.t.
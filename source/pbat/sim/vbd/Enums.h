@@ -13,6 +13,8 @@ enum class EInitializationStrategy {
     AdaptivePbat
 };
 
+enum class EElasticEnergy { StableNeoHookean, Corotational, AsRigidAsPossible };
+
 } // namespace vbd
 } // namespace sim
 } // namespace pbat
@@ -9,7 +9,10 @@
 #include "pbat/geometry/ClosestPointQueries.h"
 #include "pbat/geometry/IntersectionQueries.h"
 #include "pbat/math/linalg/mini/Mini.h"
+#include "pbat/physics/AsRigidAsPossibleEnergy.h"
+#include "pbat/physics/CorotationalEnergy.h"
 #include "pbat/physics/HyperElasticity.h"
+#include "pbat/physics/StableNeoHookeanEnergy.h"
 
 #include <cmath>
 #include <limits>
@@ -170,6 +173,64 @@ PBAT_HOST_DEVICE void AccumulateElasticGradient(
         [&]<auto k>() { gi += wg * GP(ilocal, k) * gF.template Slice<kDims, 1>(k * kDims, 0); });
 }
 
+template <
+    mini::CMatrix TMatrixGP,
+    mini::CMatrix TMatrixF,
+    mini::CMatrix TMatrixGI,
+    class IndexType,
+    class ScalarType = typename TMatrixGP::ScalarType>
+PBAT_HOST_DEVICE void AccumulateElasticGradient(
+    EElasticEnergy psie,
+    IndexType ilocal,
+    ScalarType wg,
+    TMatrixGP const& GP,
+    TMatrixF const& F,
+    ScalarType mu,
+    ScalarType lambda,
+    TMatrixGI& gi)
+{
+    auto constexpr kDims = TMatrixGP::kCols;
+    mini::SVector<ScalarType, kDims * kDims> gF;
+    if (psie == EElasticEnergy::StableNeoHookean)
+        gF = physics::StableNeoHookeanEnergy<kDims>{}.grad(F, mu, lambda);
+    else if (psie == EElasticEnergy::Corotational)
+        gF = physics::CorotationalEnergy<kDims>{}.grad(F, mu, lambda);
+    else
+        gF = physics::AsRigidAsPossibleEnergy<kDims>{}.grad(F, mu, lambda);
+    AccumulateElasticGradient(ilocal, wg, GP, gF, gi);
+}
+
+template <
+    mini::CMatrix TMatrixGP,
+    mini::CMatrix TMatrixF,
+    mini::CMatrix TMatrixGI,
+    mini::CMatrix TMatrixHI,
+    class IndexType,
+    class ScalarType = typename TMatrixGP::ScalarType>
+PBAT_HOST_DEVICE void AccumulateElasticDerivatives(
+    EElasticEnergy psie,
+    IndexType ilocal,
+    ScalarType wg,
+    TMatrixGP const& GP,
+    TMatrixF const& F,
+    ScalarType mu,
+    ScalarType lambda,
+    TMatrixGI& gi,
+    TMatrixHI& Hi)
+{
+    auto constexpr kDims = TMatrixGP::kCols;
+    mini::SVector<ScalarType, kDims * kDims> gF;
+    mini::SMatrix<ScalarType, kDims * kDims, kDims * kDims> HF;
+    if (psie == EElasticEnergy::StableNeoHookean)
+        physics::StableNeoHookeanEnergy<kDims>{}.gradAndHessian(F, mu, lambda, gF, HF);
+    else if (psie == EElasticEnergy::Corotational)
+        physics::CorotationalEnergy<kDims>{}.gradAndHessian(F, mu, lambda, gF, HF);
+    else
+        physics::AsRigidAsPossibleEnergy<kDims>{}.gradAndHessian(F, mu, lambda, gF, HF);
+    AccumulateElasticHessian(ilocal, wg, GP, HF, Hi);
+    AccumulateElasticGradient(ilocal, wg, GP, gF, gi);
+}
+
 template <
     mini::CMatrix TMatrixXT,
     mini::CMatrix TMatrixX,
@@ -0,0 +1,261 @@
+#include "Cages.h"
+
+#include "pbat/profiling/Profiling.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <exception>
+#include <fmt/format.h>
+#include <utility>
+#include <vector>
+
+namespace pbat {
+namespace sim {
+namespace vbd {
+namespace multigrid {
+
+namespace detail {
+
+/**
+ * @brief Freudenthal (Kuhn) decomposition of the unit cube into 6 positively oriented tetrahedra.
+ *
+ * Cube corners are indexed by the bits (x,y,z) -> x + 2y + 4z. Every tetrahedron walks from corner
+ * 0 to corner 7 along the cube's edges in one of the 6 possible axis orders, such that all cells
+ * share the same face diagonals and the decomposition is conforming across neighbouring cells.
+ */
+static std::array<std::array<Index, 4>, 6> FreudenthalTetrahedra()
+{
+    std::array<std::array<Index, 3>, 6> constexpr kPermutations{
+        {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+    std::array<std::array<Index, 4>, 6> T{};
+    auto const corner = [](Index c) {
+        return Vector<3>{Scalar(c & 1), Scalar((c >> 1) & 1), Scalar((c >> 2) & 1)};
+    };
+    for (std::size_t t = 0; t < kPermutations.size(); ++t)
+    {
+        auto const& p = kPermutations[t];
+        Index const a = Index(1) << p[0];
+        Index const b = a | (Index(1) << p[1]);
+        T[t]          = {Index(0), a, b, Index(7)};
+        Matrix<3, 3> D{};
+        D.col(0) = corner(T[t][1]) - corner(T[t][0]);
+        D.col(1) = corner(T[t][2]) - corner(T[t][0]);
+        D.col(2) = corner(T[t][3]) - corner(T[t][0]);
+        if (D.determinant() < Scalar(0))
+            std::swap(T[t][2], T[t][3]);
+    }
+    return T;
+}
+
+} // namespace detail
+
+VolumeMesh VoxelCage(
+    Eigen::Ref<MatrixX const> const& X,
+    Eigen::Ref<IndexMatrixX const> const& E,
+    Index resolution)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.VoxelCage");
+    if (resolution < 1)
+    {
+        throw std::invalid_argument(
+            fmt::format("Expected resolution >= 1, but got resolution={}", resolution));
+    }
+    if (X.rows() != 3 or E.rows() != 4 or X.cols() == 0 or E.cols() == 0)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected non-empty tetrahedral mesh with 3x|#verts| X and 4x|#elems| E, but got "
+            "X.shape={}x{} and E.shape={}x{}",
+            X.rows(),
+            X.cols(),
+            E.rows(),
+            E.cols()));
+    }
+    // Pad the mesh's bounding box, such that boundary vertices lie strictly inside the cage
+    Vector<3> const Xmin  = X.rowwise().minCoeff();
+    Vector<3> const Xmax  = X.rowwise().maxCoeff();
+    Scalar const extent   = (Xmax - Xmin).maxCoeff();
+    Scalar const pad      = Scalar(1e-3) * extent;
+    Vector<3> const lower = Xmin.array() - pad;
+    Scalar const h        = (extent + Scalar(2) * pad) / static_cast<Scalar>(resolution);
+    IndexVector<3> dims{};
+    for (auto d = 0; d < 3; ++d)
+    {
+        auto const nd = static_cast<Index>(std::ceil((Xmax(d) - lower(d) + pad) / h));
+        dims(d)       = std::max(nd, Index(1));
+    }
+    // Mark cells overlapping with the bounding box of any fine element. A small tolerance makes
+    // vertices lying on cell faces belong to all adjacent cells, such that the cage contains them
+    // in its interior.
+    auto const nCells = dims.prod();
+    std::vector<bool> bIsCellActive(static_cast<std::size_t>(nCells), false);
+    auto const cell = [&](Index i, Index j, Index k) {
+        return i + dims(0) * (j + dims(1) * k);
+    };
+    Scalar constexpr kTolerance = Scalar(1e-3);
+    for (Index e = 0; e < E.cols(); ++e)
+    {
+        Matrix<3, 4> const XE     = X(Eigen::placeholders::all, E.col(e));
+        Vector<3> const emin      = (XE.rowwise().minCoeff() - lower) / h;
+        Vector<3> const emax      = (XE.rowwise().maxCoeff() - lower) / h;
+        IndexVector<3> begin{}, end{};
+        for (auto d = 0; d < 3; ++d)
+        {
+            begin(d) = std::clamp(
+                static_cast<Index>(std::floor(emin(d) - kTolerance)),
+                Index(0),
+                dims(d) - 1);
+            end(d) = std::clamp(
+                static_cast<Index>(std::floor(emax(d) + kTolerance)),
+                Index(0),
+                dims(d) - 1);
+        }
+        for (Index k = begin(2); k <= end(2); ++k)
+            for (Index j = begin(1); j <= end(1); ++j)
+                for (Index i = begin(0); i <= end(0); ++i)
+                    bIsCellActive[static_cast<std::size_t>(cell(i, j, k))] = true;
+    }
+    // Compact grid vertices of active cells and tetrahedralize cells
+    IndexVector<3> const vdims = dims.array() + 1;
+    std::vector<Index> vmap(static_cast<std::size_t>(vdims.prod()), Index(-1));
+    auto const vertex = [&](Index i, Index j, Index k) {
+        return i + vdims(0) * (j + vdims(1) * k);
+    };
+    auto const nActiveCells =
+        static_cast<Index>(std::count(bIsCellActive.begin(), bIsCellActive.end(), true));
+    auto const T = detail::FreudenthalTetrahedra();
+    IndexMatrixX C(4, 6 * nActiveCells);
+    std::vector<Scalar> V{};
+    V.reserve(static_cast<std::size_t>(3 * 8 * nActiveCells));
+    Index nVertices{0}, c{0};
+    for (Index k = 0; k < dims(2); ++k)
+    {
+        for (Index j = 0; j < dims(1); ++j)
+        {
+            for (Index i = 0; i < dims(0); ++i)
+            {
+                if (not bIsCellActive[static_cast<std::size_t>(cell(i, j, k))])
+                    continue;
+                std::array<Index, 8> cv{};
+                for (Index b = 0; b < 8; ++b)
+                {
+                    Index const vi = i + (b & 1);
+                    Index const vj = j + ((b >> 1) & 1);
+                    Index const vk = k + ((b >> 2) & 1);
+                    Index& v       = vmap[static_cast<std::size_t>(vertex(vi, vj, vk))];
+                    if (v < 0)
+                    {
+                        v = nVertices++;
+                        V.push_back(lower(0) + static_cast<Scalar>(vi) * h);
+                        V.push_back(lower(1) + static_cast<Scalar>(vj) * h);
+                        V.push_back(lower(2) + static_cast<Scalar>(vk) * h);
+                    }
+                    cv[static_cast<std::size_t>(b)] = v;
+                }
+                for (auto const& t : T)
+                {
+                    for (auto m = 0; m < 4; ++m)
+                        C(m, c) = cv[static_cast<std::size_t>(t[static_cast<std::size_t>(m)])];
+                    ++c;
+                }
+            }
+        }
+    }
+    MatrixX const XC = Eigen::Map<MatrixX const>(V.data(), 3, nVertices);
+    return VolumeMesh(XC, C);
+}
+
+std::vector<VolumeMesh> VoxelCages(
+    Eigen::Ref<MatrixX const> const& X,
+    Eigen::Ref<IndexMatrixX const> const& E,
+    Index nLevels)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.VoxelCages");
+    if (nLevels < 0)
+    {
+        throw std::invalid_argument(
+            fmt::format("Expected nLevels >= 0, but got nLevels={}", nLevels));
+    }
+    std::vector<VolumeMesh> cages{};
+    if (nLevels == 0 or E.cols() == 0)
+        return cages;
+    // Average edge length of the fine mesh
+    std::array<std::pair<Index, Index>, 6> constexpr kEdges{
+        {{0, 1}, {1, 2}, {2, 0}, {0, 3}, {1, 3}, {2, 3}}};
+    Scalar hmean{0};
+    for (Index e = 0; e < E.cols(); ++e)
+        for (auto const& [a, b] : kEdges)
+            hmean += (X.col(E(b, e)) - X.col(E(a, e))).norm();
+    hmean /= static_cast<Scalar>(kEdges.size() * static_cast<std::size_t>(E.cols()));
+    Scalar const extent = (X.rowwise().maxCoeff() - X.rowwise().minCoeff()).maxCoeff();
+    // Finest cage cells span ~2 fine elements along each axis
+    auto resolution = static_cast<Index>(std::ceil(extent / (Scalar(2) * hmean)));
+    cages.reserve(static_cast<std::size_t>(nLevels));
+    for (Index l = 0; l < nLevels and resolution >= 2; ++l)
+    {
+        cages.push_back(VoxelCage(X, E, resolution));
+        resolution /= 2;
+    }
+    return cages;
+}
+
+} // namespace multigrid
+} // namespace vbd
+} // namespace sim
+} // namespace pbat
+
+#include "pbat/geometry/TetrahedralAabbHierarchy.h"
+#include "pbat/geometry/model/Cube.h"
+
+#include <doctest/doctest.h>
+
+TEST_CASE("[sim][vbd][multigrid] Cages")
+{
+    using namespace pbat;
+    using sim::vbd::VolumeMesh;
+    using sim::vbd::multigrid::VoxelCage;
+    using sim::vbd::multigrid::VoxelCages;
+    // Arrange
+    auto const [X, E] = geometry::model::Cube(geometry::model::EMesh::Tetrahedral, 2);
+
+    SUBCASE("Single cage embeds fine mesh")
+    {
+        // Act
+        Index constexpr kResolution = 3;
+        VolumeMesh const cage       = VoxelCage(X, E, kResolution);
+        // Assert
+        CHECK_EQ(cage.E.cols() % 6, 0);
+        CHECK_LE(cage.E.cols(), 6 * kResolution * kResolution * kResolution);
+        Scalar constexpr zero = 1e-10;
+        for (auto e = 0; e < cage.E.cols(); ++e)
+        {
+            Matrix<3, 3> D{};
+            for (auto d = 0; d < 3; ++d)
+                D.col(d) = cage.X.col(cage.E(d + 1, e)) - cage.X.col(cage.E(0, e));
+            CHECK_GT(D.determinant(), zero);
+        }
+        geometry::TetrahedralAabbHierarchy bvh(cage.X, cage.E);
+        IndexVectorX const ec = bvh.PrimitivesContainingPoints(X);
+        CHECK((ec.array() >= 0).all());
+        // Cage volume is close to the unit cube's volume
+        Scalar volume{0};
+        for (auto e = 0; e < cage.E.cols(); ++e)
+        {
+            Matrix<3, 3> D{};
+            for (auto d = 0; d < 3; ++d)
+                D.col(d) = cage.X.col(cage.E(d + 1, e)) - cage.X.col(cage.E(0, e));
+            volume += D.determinant() / Scalar(6);
+        }
+        CHECK_GE(volume, Scalar(1));
+    }
+    SUBCASE("Cage sequence is increasingly coarse")
+    {
+        // Act
+        std::vector<VolumeMesh> const cages = VoxelCages(X, E, 3);
+        // Assert
+        REQUIRE_FALSE(cages.empty());
+        CHECK_LE(cages.size(), 3ULL);
+        for (std::size_t l = 1; l < cages.size(); ++l)
+            CHECK_LT(cages[l].E.cols(), cages[l - 1].E.cols());
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef PBAT_SIM_VBD_MULTIGRID_CAGES_H
+#define PBAT_SIM_VBD_MULTIGRID_CAGES_H
+
+#include "PhysicsBasedAnimationToolkitExport.h"
+#include "pbat/Aliases.h"
+#include "pbat/sim/vbd/Mesh.h"
+
+#include <vector>
+
+namespace pbat {
+namespace sim {
+namespace vbd {
+namespace multigrid {
+
+/**
+ * @brief Computes an embedding voxel cage of the tetrahedral mesh (X,E)
+ *
+ * The cage is the union of all cells of a regular grid, spanning the mesh's bounding box with
+ * `resolution` cells along its longest axis, which overlap the bounding box of at least one
+ * tetrahedron of (X,E). Every grid cell is split into 6 tetrahedra using the Freudenthal (Kuhn)
+ * decomposition, which yields a conforming tetrahedral mesh. The cage thus contains every point of
+ * (X,E).
+ *
+ * @param X 3x|#verts| mesh vertex positions
+ * @param E 4x|#elems| mesh tetrahedra
+ * @param resolution Number of grid cells along the longest axis of the mesh's bounding box
+ * @return Embedding tetrahedral cage mesh
+ */
+PBAT_API VolumeMesh VoxelCage(
+    Eigen::Ref<MatrixX const> const& X,
+    Eigen::Ref<IndexMatrixX const> const& E,
+    Index resolution);
+
+/**
+ * @brief Computes a sequence of increasingly coarse embedding voxel cages of the tetrahedral mesh
+ * (X,E)
+ *
+ * The finest cage's resolution is chosen from the mesh's average edge length, such that a cage
+ * cell spans roughly 2 fine elements along each axis. Every subsequent cage halves the previous
+ * resolution, and coarsening stops early once a cage would have fewer than 2 cells along the
+ * longest axis.
+ *
+ * @param X 3x|#verts| mesh vertex positions
+ * @param E 4x|#elems| mesh tetrahedra
+ * @param nLevels Maximum number of cages to compute
+ * @return Cages ordered from finest to coarsest
+ */
+PBAT_API std::vector<VolumeMesh> VoxelCages(
+    Eigen::Ref<MatrixX const> const& X,
+    Eigen::Ref<IndexMatrixX const> const& E,
+    Index nLevels);
+
+} // namespace multigrid
+} // namespace vbd
+} // namespace sim
+} // namespace pbat
+
+#endif // PBAT_SIM_VBD_MULTIGRID_CAGES_H
@@ -0,0 +1,96 @@
+#include "Cycles.h"
+
+#include <algorithm>
+#include <exception>
+#include <fmt/format.h>
+#include <vector>
+
+namespace pbat {
+namespace sim {
+namespace vbd {
+namespace multigrid {
+
+namespace detail {
+
+static void Visit(std::vector<Index>& visits, Index l)
+{
+    if (visits.empty() or visits.back() != l)
+        visits.push_back(l);
+}
+
+static void VCycle(std::vector<Index>& visits, Index l, Index nLevels)
+{
+    for (Index k = l; k < nLevels; ++k)
+        Visit(visits, k);
+    for (Index k = nLevels - 2; k >= l; --k)
+        Visit(visits, k);
+}
+
+static void WCycle(std::vector<Index>& visits, Index l, Index nLevels)
+{
+    Visit(visits, l);
+    if (l + 1 == nLevels)
+        return;
+    WCycle(visits, l + 1, nLevels);
+    // The coarsest sub-cycle is a single visit, which gains nothing from being repeated
+    if (l + 2 < nLevels)
+        WCycle(visits, l + 1, nLevels);
+    Visit(visits, l);
+}
+
+static void FCycle(std::vector<Index>& visits, Index l, Index nLevels)
+{
+    Visit(visits, l);
+    if (l + 1 == nLevels)
+        return;
+    FCycle(visits, l + 1, nLevels);
+    VCycle(visits, l + 1, nLevels);
+    Visit(visits, l);
+}
+
+} // namespace detail
+
+IndexVectorX Cycle(ECycle eCycle, Index nLevels)
+{
+    if (nLevels < 0)
+    {
+        throw std::invalid_argument(
+            fmt::format("Expected nLevels >= 0, but got nLevels={}", nLevels));
+    }
+    std::vector<Index> visits{};
+    switch (eCycle)
+    {
+        case ECycle::V: detail::VCycle(visits, Index(-1), nLevels); break;
+        case ECycle::W: detail::WCycle(visits, Index(-1), nLevels); break;
+        case ECycle::F: detail::FCycle(visits, Index(-1), nLevels); break;
+    }
+    return Eigen::Map<IndexVectorX const>(visits.data(), static_cast<Index>(visits.size()));
+}
+
+} // namespace multigrid
+} // namespace vbd
+} // namespace sim
+} // namespace pbat
+
+#include <doctest/doctest.h>
+
+TEST_CASE("[sim][vbd][multigrid] Cycles")
+{
+    using namespace pbat;
+    using sim::vbd::multigrid::Cycle;
+    using sim::vbd::multigrid::ECycle;
+    auto const equals = [](IndexVectorX const& cycle, std::vector<Index> const& expected) {
+        return std::equal(cycle.begin(), cycle.end(), expected.begin(), expected.end());
+    };
+    CHECK(equals(Cycle(ECycle::V, 0), {-1}));
+    CHECK(equals(Cycle(ECycle::W, 0), {-1}));
+    CHECK(equals(Cycle(ECycle::F, 0), {-1}));
+    CHECK(equals(Cycle(ECycle::V, 1), {-1, 0, -1}));
+    CHECK(equals(Cycle(ECycle::W, 1), {-1, 0, -1}));
+    CHECK(equals(Cycle(ECycle::F, 1), {-1, 0, -1}));
+    CHECK(equals(Cycle(ECycle::V, 3), {-1, 0, 1, 2, 1, 0, -1}));
+    CHECK(equals(Cycle(ECycle::W, 2), {-1, 0, 1, 0, 1, 0, -1}));
+    CHECK(equals(Cycle(ECycle::W, 3), {-1, 0, 1, 2, 1, 2, 1, 0, 1, 2, 1, 2, 1, 0, -1}));
+    CHECK(equals(Cycle(ECycle::F, 2), {-1, 0, 1, 0, 1, 0, -1}));
+    CHECK(equals(Cycle(ECycle::F, 3), {-1, 0, 1, 2, 1, 2, 1, 0, 1, 2, 1, 0, -1}));
+}
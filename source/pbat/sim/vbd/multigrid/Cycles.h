@@ -0,0 +1,39 @@
+#ifndef PBAT_SIM_VBD_MULTIGRID_CYCLES_H
+#define PBAT_SIM_VBD_MULTIGRID_CYCLES_H
+
+#include "PhysicsBasedAnimationToolkitExport.h"
+#include "pbat/Aliases.h"
+
+namespace pbat {
+namespace sim {
+namespace vbd {
+namespace multigrid {
+
+/**
+ * @brief Multigrid cycle types
+ */
+enum class ECycle {
+    V, ///< Visits every level once on the way down to the coarsest level, and once on the way up
+    W, ///< Recursively visits the next coarser level's cycle twice
+    F  ///< Recursively visits the next coarser level's F-cycle, followed by its V-cycle
+};
+
+/**
+ * @brief Computes the ordered level visits of a standard multigrid cycle
+ *
+ * Levels are numbered as in Hierarchy::cycle, i.e. -1 is the root and nLevels-1 the coarsest
+ * level. Every cycle starts and ends at the root, and consecutive visits of the same level are
+ * merged into a single visit.
+ *
+ * @param eCycle Cycle type
+ * @param nLevels Number of coarse levels
+ * @return |#level visits| ordered array of levels to visit
+ */
+PBAT_API IndexVectorX Cycle(ECycle eCycle, Index nLevels);
+
+} // namespace multigrid
+} // namespace vbd
+} // namespace sim
+} // namespace pbat
+
+#endif // PBAT_SIM_VBD_MULTIGRID_CYCLES_H
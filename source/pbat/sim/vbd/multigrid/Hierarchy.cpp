@@ -1,41 +1,244 @@
 #include "Hierarchy.h"
 
+#include "Cages.h"
+#include "pbat/common/Serialization.h"
+#include "pbat/graph/Adjacency.h"
+#include "pbat/profiling/Profiling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <exception>
 #include <fmt/format.h>
+#include <fstream>
+#include <tuple>
+#include <utility>
 
 namespace pbat {
 namespace sim {
 namespace vbd {
 namespace multigrid {
 
+namespace detail {
+
+static void ConstructLevelsAndDefaults(Hierarchy& H, std::vector<VolumeMesh> cages)
+{
+    H.levels.reserve(cages.size());
+    for (VolumeMesh& cage : cages)
+        H.levels.push_back(Level(H.data, std::move(cage)));
+    // Reasonable defaults
+    Index const nLevels = static_cast<Index>(H.levels.size());
+    if (H.cycle.size() == 0)
+        H.cycle = Cycle(ECycle::V, nLevels);
+    if (H.siters.size() == 0)
+    {
+        // Block coordinate descent propagates information by ~1 element per sweep, and a coarse
+        // level's elements are wider than the root's by ~(#root verts / #level verts)^(1/3). We
+        // thus spend proportionally more (but cheaper) sweeps on coarser levels.
+        Index constexpr kRootIters = 2;
+        Index constexpr kMaxIters  = 20;
+        auto const nRootVerts      = static_cast<Scalar>(H.data.X.cols());
+        H.siters.resize(H.cycle.size());
+        for (Index k = 0; k < H.cycle.size(); ++k)
+        {
+            Index const l = H.cycle(k);
+            auto const nLevelVerts =
+                (l < 0) ? nRootVerts :
+                          static_cast<Scalar>(H.levels[static_cast<std::size_t>(l)].mesh.X.cols());
+            Scalar const ratio = std::cbrt(nRootVerts / std::max(nLevelVerts, Scalar(1)));
+            auto const iters   = static_cast<Index>(std::round(kRootIters * ratio));
+            H.siters(k)        = std::clamp(iters, kRootIters, kMaxIters);
+        }
+    }
+    if (H.siters.size() != H.cycle.size())
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected |#level visits|={} smoother iterations, but got {}",
+            H.cycle.size(),
+            H.siters.size()));
+    }
+    if (H.cycle.size() > 0 and (H.cycle.minCoeff() < Index(-1) or H.cycle.maxCoeff() >= nLevels))
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected cycle to visit levels in [-1,{}), but got levels in [{},{}]",
+            nLevels,
+            H.cycle.minCoeff(),
+            H.cycle.maxCoeff()));
+    }
+}
+
+} // namespace detail
+
 Hierarchy::Hierarchy(
     Data dataIn,
     std::vector<VolumeMesh> cages,
     IndexVectorX const& cycleIn,
     IndexVectorX const& sitersIn)
-    : data(std::move(dataIn)), levels(), cycle(cycleIn), siters(sitersIn)
+    : data(std::move(dataIn)),
+      levels(),
+      cycle(cycleIn),
+      siters(sitersIn),
+      ncycles(1),
+      rtol(0),
+      bDirectCoarseSolve(false),
+      bReuseCoarseFactorization(false),
+      HR(),
+      rActivityThreshold(0),
+      rStrainRates(),
+      rActivity(),
+      rAext(),
+      rAptr(),
+      rAadj()
 {
-    levels.reserve(cages.size());
-    for (VolumeMesh& cage : cages)
-        levels.push_back(Level(data, std::move(cage)));
-    // Reasonable defaults
-    if (cycle.size() == 0)
+    detail::ConstructLevelsAndDefaults(*this, std::move(cages));
+}
+
+Hierarchy::Hierarchy(
+    Data dataIn,
+    Index nLevels,
+    IndexVectorX const& cycleIn,
+    IndexVectorX const& sitersIn)
+    : data(std::move(dataIn)),
+      levels(),
+      cycle(cycleIn),
+      siters(sitersIn),
+      ncycles(1),
+      rtol(0),
+      bDirectCoarseSolve(false),
+      bReuseCoarseFactorization(false),
+      HR(),
+      rActivityThreshold(0),
+      rStrainRates(),
+      rActivity(),
+      rAext(),
+      rAptr(),
+      rAadj()
+{
+    detail::ConstructLevelsAndDefaults(*this, VoxelCages(data.X, data.E, nLevels));
+}
+
+namespace detail {
+
+static std::uint64_t constexpr kHierarchyMagic   = 0x5042415456424447; // "PBATVBDG"
+static std::uint32_t constexpr kHierarchyVersion = 3;
+
+} // namespace detail
+
+void Hierarchy::Save(std::filesystem::path const& path) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Hierarchy.Save");
+    std::ofstream ofs(path, std::ios::binary);
+    if (not ofs)
     {
-        // Standard v-cycle
-        Index nLevels = static_cast<Index>(levels.size());
-        cycle.resize(nLevels * 2 + 1);
-        Index k    = 0;
-        cycle(k++) = Index(-1);
-        for (Index l = 0; l < nLevels; ++l)
-            cycle(k++) = l;
-        for (Index l = 0; l < nLevels; ++l)
-            cycle(k++) = nLevels - l - 2;
+        throw std::invalid_argument(
+            fmt::format("Failed to open file {} for writing", path.string()));
     }
-    if (siters.size() == 0)
+    using common::WriteBinary;
+    WriteBinary(ofs, detail::kHierarchyMagic);
+    WriteBinary(ofs, detail::kHierarchyVersion);
+    WriteBinary(ofs, static_cast<std::int64_t>(data.X.cols()));
+    WriteBinary(ofs, static_cast<std::int64_t>(data.E.cols()));
+    WriteBinary(ofs, static_cast<std::int64_t>(levels.size()));
+    for (Level const& level : levels)
+        level.Serialize(ofs);
+    WriteBinary(ofs, cycle);
+    WriteBinary(ofs, siters);
+    WriteBinary(ofs, ncycles);
+    WriteBinary(ofs, rtol);
+    WriteBinary(ofs, bDirectCoarseSolve);
+    WriteBinary(ofs, bReuseCoarseFactorization);
+    WriteBinary(ofs, rActivityThreshold);
+    HR.Serialize(ofs);
+}
+
+Hierarchy Hierarchy::Load(Data dataIn, std::filesystem::path const& path)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Hierarchy.Load");
+    std::ifstream ifs(path, std::ios::binary);
+    if (not ifs)
     {
-        // TODO: Find better strategy for default iterations!
-        siters.setConstant(static_cast<Index>(cycle.size()), 5);
+        throw std::invalid_argument(
+            fmt::format("Failed to open file {} for reading", path.string()));
     }
+    using common::ReadBinary;
+    std::uint64_t magic{};
+    std::uint32_t version{};
+    ReadBinary(ifs, magic);
+    ReadBinary(ifs, version);
+    if (magic != detail::kHierarchyMagic or version != detail::kHierarchyVersion)
+    {
+        throw std::invalid_argument(fmt::format(
+            "File {} is not a multigrid hierarchy of version {}",
+            path.string(),
+            detail::kHierarchyVersion));
+    }
+    std::int64_t nFineVertices{}, nFineElements{}, nLevels{};
+    ReadBinary(ifs, nFineVertices);
+    ReadBinary(ifs, nFineElements);
+    ReadBinary(ifs, nLevels);
+    if (nFineVertices != dataIn.X.cols() or nFineElements != dataIn.E.cols())
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected hierarchy of root mesh with {} vertices and {} elements, but file {} stores "
+            "hierarchy of root mesh with {} vertices and {} elements",
+            dataIn.X.cols(),
+            dataIn.E.cols(),
+            path.string(),
+            nFineVertices,
+            nFineElements));
+    }
+    Hierarchy H(std::move(dataIn), std::vector<VolumeMesh>{});
+    H.levels.resize(static_cast<std::size_t>(nLevels));
+    for (Level& level : H.levels)
+        level.Deserialize(ifs);
+    ReadBinary(ifs, H.cycle);
+    ReadBinary(ifs, H.siters);
+    ReadBinary(ifs, H.ncycles);
+    ReadBinary(ifs, H.rtol);
+    ReadBinary(ifs, H.bDirectCoarseSolve);
+    ReadBinary(ifs, H.bReuseCoarseFactorization);
+    ReadBinary(ifs, H.rActivityThreshold);
+    H.HR.Deserialize(ifs);
+    return H;
+}
+
+bool Hierarchy::SetDirichletVertices(IndexVectorX const& dbcIn)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Hierarchy.SetDirichletVertices");
+    auto const nFineVertices = data.x.cols();
+    if (dbcIn.size() > 0 and (dbcIn.minCoeff() < 0 or dbcIn.maxCoeff() >= nFineVertices))
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected Dirichlet vertices in [0,{}), but got vertices in [{},{}]",
+            nFineVertices,
+            dbcIn.minCoeff(),
+            dbcIn.maxCoeff()));
+    }
+    Level::BoolVector bIsDirichlet = Level::BoolVector::Constant(nFineVertices, false);
+    bIsDirichlet(dbcIn).setConstant(true);
+    // Root level, as in Data::Construct
+    data.dbc.resize(bIsDirichlet.count());
+    for (Index i = 0, k = 0; i < nFineVertices; ++i)
+        if (bIsDirichlet(i))
+            data.dbc(k++) = i;
+    data.v(Eigen::placeholders::all, data.dbc).setZero();
+    data.aext(Eigen::placeholders::all, data.dbc).setZero();
+    std::tie(data.Pptr, data.Padj) = graph::MapToAdjacency(data.colors);
+    graph::RemoveEdges(data.Pptr, data.Padj, [&]([[maybe_unused]] Index p, Index v) {
+        return bIsDirichlet(v);
+    });
+    // Prioritized vertices refer to the previous partitions
+    rAptr.resize(0);
+    rAadj.resize(0);
+    // Coarse levels
+    bool bAreFactorizationsUpdated{true};
+    for (Level& level : levels)
+    {
+        bool const bIsUpdated = level.SetDirichletVertices(data, bIsDirichlet);
+        if (level.bReuseFactorization)
+            bAreFactorizationsUpdated = bAreFactorizationsUpdated and bIsUpdated;
+    }
+    return bAreFactorizationsUpdated;
 }
 
 } // namespace multigrid
@@ -43,6 +246,7 @@ Hierarchy::Hierarchy(
 } // namespace sim
 } // namespace pbat
 
+#include "Integrator.h"
 #include "pbat/geometry/model/Cube.h"
 
 #include <doctest/doctest.h>
@@ -53,6 +257,7 @@ TEST_CASE("[sim][vbd][multigrid] Hierarchy")
     using sim::vbd::Data;
     using sim::vbd::VolumeMesh;
     using sim::vbd::multigrid::Hierarchy;
+    using sim::vbd::multigrid::HyperReduction;
     // Arrange
     auto const [VR, CR]   = geometry::model::Cube(geometry::model::EMesh::Tetrahedral, 2);
     Data data             = Data().WithVolumeMesh(VR, CR).Construct();
@@ -64,4 +269,100 @@ TEST_CASE("[sim][vbd][multigrid] Hierarchy")
 
     // Assert
     CHECK_EQ(H.siters.size(), H.cycle.size());
+    CHECK((H.siters.array() > 0).all());
+
+    SUBCASE("Automatic cages")
+    {
+        // Act
+        Data rdata = Data().WithVolumeMesh(VR, CR).Construct();
+        Hierarchy HA{std::move(rdata), Index(2)};
+        // Assert
+        CHECK_FALSE(HA.levels.empty());
+        CHECK_LE(HA.levels.size(), 2ULL);
+        CHECK_EQ(HA.cycle.size(), 2 * static_cast<Index>(HA.levels.size()) + 1);
+        CHECK_EQ(HA.siters.size(), HA.cycle.size());
+        CHECK_EQ(HA.siters(0), HA.siters.minCoeff());
+    }
+    SUBCASE("Save and load")
+    {
+        // Arrange
+        bool bIsReduced{false};
+        H.ncycles                               = 3;
+        H.rtol                                  = Scalar(1e-3);
+        H.bDirectCoarseSolve                    = true;
+        H.bReuseCoarseFactorization             = true;
+        H.rActivityThreshold                    = Scalar(1e-2);
+        H.levels.back().bReuseFactorization     = true;
+        H.levels.back().nMaxFactorizationReuses = 7;
+        SUBCASE("Levels integrate all fine elements") {}
+        SUBCASE("Levels are hyper reduced")
+        {
+            bIsReduced = true;
+            H.HR       = HyperReduction(H, 5);
+            H.HR.ComputeLinearPolynomialErrors(H, MatrixX::Zero(3, H.data.X.cols()));
+            for (std::size_t l = 0; l < H.levels.size(); ++l)
+                H.levels[l].Reduce(H.data, H.HR, static_cast<Index>(l));
+        }
+        // Act
+        auto const path = std::filesystem::temp_directory_path() / "pbat.vbd.multigrid.hierarchy";
+        H.Save(path);
+        Data rdata   = Data().WithVolumeMesh(VR, CR).Construct();
+        Hierarchy HL = Hierarchy::Load(std::move(rdata), path);
+        std::filesystem::remove(path);
+        // Assert
+        REQUIRE_EQ(HL.levels.size(), H.levels.size());
+        CHECK(HL.cycle == H.cycle);
+        CHECK(HL.siters == H.siters);
+        CHECK_EQ(HL.ncycles, H.ncycles);
+        CHECK_EQ(HL.rtol, H.rtol);
+        CHECK_EQ(HL.bDirectCoarseSolve, H.bDirectCoarseSolve);
+        CHECK_EQ(HL.bReuseCoarseFactorization, H.bReuseCoarseFactorization);
+        CHECK_EQ(HL.rActivityThreshold, H.rActivityThreshold);
+        for (std::size_t l = 0; l < H.levels.size(); ++l)
+        {
+            CHECK(HL.levels[l].mesh.X == H.levels[l].mesh.X);
+            CHECK(HL.levels[l].mesh.E == H.levels[l].mesh.E);
+            CHECK(HL.levels[l].ecVE == H.levels[l].ecVE);
+            CHECK(HL.levels[l].NecVE == H.levels[l].NecVE);
+            CHECK(HL.levels[l].ilocalE == H.levels[l].ilocalE);
+            CHECK(HL.levels[l].GEptr == H.levels[l].GEptr);
+            CHECK(HL.levels[l].GEadj == H.levels[l].GEadj);
+            CHECK(HL.levels[l].GKadj == H.levels[l].GKadj);
+            CHECK(HL.levels[l].bIsDirichletVertex == H.levels[l].bIsDirichletVertex);
+            CHECK(HL.levels[l].GCFadj == H.levels[l].GCFadj);
+            CHECK(HL.levels[l].wgR == H.levels[l].wgR);
+            CHECK(HL.levels[l].GERptr == H.levels[l].GERptr);
+            CHECK(HL.levels[l].GERadj == H.levels[l].GERadj);
+            CHECK_EQ(HL.levels[l].GERptr.size() > 0, bIsReduced);
+            CHECK_EQ(HL.levels[l].bReuseFactorization, H.levels[l].bReuseFactorization);
+            CHECK_EQ(HL.levels[l].nMaxFactorizationReuses, H.levels[l].nMaxFactorizationReuses);
+        }
+        REQUIRE_EQ(HL.HR.C.size(), H.HR.C.size());
+        for (std::size_t l = 0; l < H.HR.C.size(); ++l)
+        {
+            CHECK(HL.HR.C[l] == H.HR.C[l]);
+            CHECK(HL.HR.wC[l] == H.HR.wC[l]);
+            CHECK(HL.HR.eC[l] == H.HR.eC[l]);
+            CHECK(HL.HR.Ep[l] == H.HR.Ep[l]);
+        }
+        CHECK_EQ(HL.HR.EpMax, H.HR.EpMax);
+    }
+    SUBCASE("Copies do not share factorizations")
+    {
+        // Arrange
+        H.bDirectCoarseSolve = true;
+        sim::vbd::multigrid::Integrator{}.Step(Scalar(1e-2), 1, H);
+        REQUIRE(H.levels.back().LLT);
+        // Act
+        Hierarchy HCopy                                = H;
+        std::vector<sim::vbd::multigrid::Level> levels = H.levels;
+        // Assert
+        CHECK(HCopy.levels.back().LLT);
+        CHECK_NE(HCopy.levels.back().LLT, H.levels.back().LLT);
+        CHECK_NE(levels.back().LLT, H.levels.back().LLT);
+        CHECK(HCopy.levels.back().HC.isApprox(H.levels.back().HC));
+        // Copies refactorize on their next solve
+        sim::vbd::multigrid::Integrator{}.Step(Scalar(1e-2), 1, HCopy);
+        CHECK((HCopy.data.x.array().isFinite()).all());
+    }
 }
@@ -1,10 +1,13 @@
 #ifndef PBAT_SIM_VBD_MULTIGRID_HIERARCHY_H
 #define PBAT_SIM_VBD_MULTIGRID_HIERARCHY_H
 
+#include "Cycles.h"
+#include "HyperReduction.h"
 #include "Level.h"
 #include "pbat/sim/vbd/Data.h"
 #include "pbat/sim/vbd/Mesh.h"
 
+#include <filesystem>
 #include <vector>
 
 namespace pbat {
@@ -14,18 +17,103 @@ namespace multigrid {
 
 struct Hierarchy
 {
+    /**
+     * @brief Construct a multigrid hierarchy from user-provided cage meshes
+     * @param data Root level problem
+     * @param cages Coarse cage meshes ordered from finest to coarsest
+     * @param cycle |#level visits| ordered array of levels to visit, e.g. as computed by Cycle.
+     * Defaults to a V-cycle.
+     * @param siters |#level visits| smoother iterations at each visit. Defaults to a level size
+     * dependent number of iterations.
+     */
     Hierarchy(
         Data data,
         std::vector<VolumeMesh> cages,
         IndexVectorX const& cycle  = {},
         IndexVectorX const& siters = {});
+    /**
+     * @brief Construct a multigrid hierarchy using automatically generated embedding voxel cages
+     * @param data Root level problem
+     * @param nLevels Maximum number of coarse levels
+     * @param cycle |#level visits| ordered array of levels to visit, e.g. as computed by Cycle.
+     * Defaults to a V-cycle.
+     * @param siters |#level visits| smoother iterations at each visit. Defaults to a level size
+     * dependent number of iterations.
+     */
+    Hierarchy(
+        Data data,
+        Index nLevels,
+        IndexVectorX const& cycle  = {},
+        IndexVectorX const& siters = {});
+    /**
+     * @brief Write this hierarchy's coarse levels, cycle, smoother iterations, solver settings and
+     * hyper reduction to a binary file
+     *
+     * Runtime state, i.e. the root problem, coarse hessian factorizations and strain rate
+     * prioritization history, is not written.
+     *
+     * @param path Output file path
+     */
+    void Save(std::filesystem::path const& path) const;
+    /**
+     * @brief Load a hierarchy written by Save, which was constructed from the same root level
+     * @param data Root level problem
+     * @param path Input file path
+     * @return Hierarchy with levels read from file
+     */
+    static Hierarchy Load(Data data, std::filesystem::path const& path);
+    /**
+     * @brief Pin or release root level vertices, updating the root problem and every coarse level
+     *
+     * The root level's Dirichlet vertices data.dbc are replaced by dbc, whose velocities and
+     * external accelerations are zeroed, and which are removed from the root's parallel vertex
+     * partitions. Released vertices rejoin the partitions, with zero velocity and external
+     * acceleration until set otherwise. Coarse levels then change their Dirichlet energies
+     * together, i.e. reused factorizations of coarse hessians receive one batched low-rank update
+     * per level (see Level::SetDirichletVertices). Strain rate prioritization is reset, such that
+     * the next time step smooths all free vertices.
+     *
+     * @param dbc Dirichlet constrained root level vertices
+     * @return true if every coarse level that reuses its factorization (see
+     * Level::bReuseFactorization) updated it, rather than invalidating it
+     */
+    bool SetDirichletVertices(IndexVectorX const& dbc);
 
     Data data;                 ///< Root level
     std::vector<Level> levels; ///< Coarse levels
     IndexVectorX cycle; ///< |#level visits| ordered array of levels to visit during the solve.
                         ///< Level -1 is the root, 0 the first coarse level, etc.
     IndexVectorX
-        siters; ///< |#cages+1| max smoother iterations at each level, starting from the root
+        siters; ///< |#level visits| max smoother iterations at each level visit in the cycle
+    Index ncycles{1}; ///< Max number of cycles per time step
+    Scalar rtol{0};   ///< Cycling stops early once the root level's residual falls below rtol
+                      ///< times its residual at the start of the time step. Every time step runs
+                      ///< ncycles cycles if rtol <= 0.
+    bool bDirectCoarseSolve{false}; ///< Visits of the coarsest level solve its problem with
+                                    ///< Newton's method and sparse direct linear solves, rather
+                                    ///< than smoothing it. See Level::Solve.
+    bool bReuseCoarseFactorization{false}; ///< Direct coarse solves reuse the coarsest level's
+                                           ///< factorization across Newton iterations and time
+                                           ///< steps, for at most
+                                           ///< Level::nMaxFactorizationReuses time steps. See
+                                           ///< Level::bReuseFactorization.
+    HyperReduction HR; ///< Coarse level elastic energy hyper reduction. Coarse levels integrate
+                       ///< all fine elements if HR is empty.
+
+    Scalar rActivityThreshold{0}; ///< Root level vertices whose adjacent elements' Green strain
+                                  ///< rates are all below this threshold are considered static
+                                  ///< and skipped by the root smoother. Strain rate prioritized
+                                  ///< smoothing is disabled if rActivityThreshold <= 0.
+    VectorX rStrainRates;         ///< |#fine elems| Frobenius norms of root level elements' Green
+                                  ///< strain rates over the last time step
+    VectorX rActivity; ///< |#fine verts| activities of root level vertices, i.e. their (woken)
+                       ///< adjacent elements' largest strain rates
+    MatrixX rAext;     ///< 3x|#fine verts| external accelerations of the last prioritization
+    IndexVectorX rAptr; ///< |#partitions+1| pointers into rAadj. Empty if strain rate
+                        ///< prioritized smoothing is disabled, or if no time step has been
+                        ///< taken yet, in which case all vertices are smoothed.
+    IndexVectorX rAadj; ///< Active vertices of each root level parallel vertex partition,
+                        ///< bucketed by decreasing strain rate activity
 };
 
 } // namespace multigrid
@@ -2,6 +2,7 @@
 
 #include "pbat/common/Eigen.h"
 #include "pbat/common/Indexing.h"
+#include "pbat/common/Serialization.h"
 #include "pbat/fem/ShapeFunctions.h"
 #include "pbat/geometry/TetrahedralAabbHierarchy.h"
 #include "pbat/graph/Adjacency.h"
@@ -14,7 +15,11 @@
 #include "pbat/sim/vbd/Mesh.h"
 #include "pbat/sim/vbd/multigrid/Hierarchy.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <fmt/format.h>
+#include <limits>
 #include <ranges>
 #include <tbb/parallel_for.h>
 #include <utility>
@@ -302,6 +307,87 @@ void HyperReduction::ComputeLinearPolynomialErrors(
             }
         });
     }
+    // Track the largest drift from u for which clusters within the error budget remain within it
+    uR   = u;
+    uTol = std::numeric_limits<Scalar>::infinity();
+    for (decltype(nLevels) l = 0; l < nLevels; ++l)
+    {
+        auto const nClusters = Ep[l].size();
+        for (Index c = 0; c < nClusters; ++c)
+        {
+            if (Ep[l](c) > EpMax)
+                continue;
+            Scalar const slack =
+                (std::sqrt(EpMax) - std::sqrt(Ep[l](c))) /
+                std::sqrt(static_cast<Scalar>(l + 1) * wC[l](c));
+            uTol = std::min(uTol, slack);
+        }
+    }
+}
+
+bool HyperReduction::IsStale(Eigen::Ref<MatrixX const> const& u) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.HyperReduction.IsStale");
+    if (uR.rows() != u.rows() or uR.cols() != u.cols())
+        return true;
+    MatrixX du          = u - uR;
+    du                  = du.colwise() - du.rowwise().mean();
+    Scalar const delta2 = du.colwise().squaredNorm().maxCoeff();
+    return not(delta2 <= uTol * uTol);
+}
+
+namespace detail {
+
+template <class TMatrix>
+static void WriteBinaryList(std::ostream& os, std::vector<TMatrix> const& As)
+{
+    common::WriteBinary(os, static_cast<std::int64_t>(As.size()));
+    for (auto const& A : As)
+        common::WriteBinary(os, A);
+}
+
+template <class TMatrix>
+static void ReadBinaryList(std::istream& is, std::vector<TMatrix>& As)
+{
+    std::int64_t n{};
+    common::ReadBinary(is, n);
+    if (n < 0)
+        throw std::runtime_error("Invalid list size in binary stream");
+    As.resize(static_cast<std::size_t>(n));
+    for (auto& A : As)
+        common::ReadBinary(is, A);
+}
+
+} // namespace detail
+
+void HyperReduction::Serialize(std::ostream& os) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.HyperReduction.Serialize");
+    detail::WriteBinaryList(os, C);
+    detail::WriteBinaryList(os, Cptr);
+    detail::WriteBinaryList(os, Cadj);
+    detail::WriteBinaryList(os, ApInvC);
+    detail::WriteBinaryList(os, bC);
+    detail::WriteBinaryList(os, wC);
+    detail::WriteBinaryList(os, eC);
+    detail::WriteBinaryList(os, up);
+    detail::WriteBinaryList(os, Ep);
+    common::WriteBinary(os, EpMax);
+}
+
+void HyperReduction::Deserialize(std::istream& is)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.HyperReduction.Deserialize");
+    detail::ReadBinaryList(is, C);
+    detail::ReadBinaryList(is, Cptr);
+    detail::ReadBinaryList(is, Cadj);
+    detail::ReadBinaryList(is, ApInvC);
+    detail::ReadBinaryList(is, bC);
+    detail::ReadBinaryList(is, wC);
+    detail::ReadBinaryList(is, eC);
+    detail::ReadBinaryList(is, up);
+    detail::ReadBinaryList(is, Ep);
+    common::ReadBinary(is, EpMax);
 }
 
 } // namespace multigrid
@@ -393,4 +479,28 @@ TEST_CASE("[sim][vbd][multigrid] HyperReduction")
             fComputeAndCheckVanishingError(u);
         }
     }
+    SUBCASE("Coarse levels integrate representative elements of clusters with small errors")
+    {
+        MatrixX const u = MatrixX::Zero(3, H.data.X.cols());
+        HR.ComputeLinearPolynomialErrors(H, u);
+        Scalar const expectedTotalVolume = H.data.wg.sum();
+        for (decltype(nLevels) l = 0; l < nLevels; ++l)
+        {
+            auto& level = H.levels[l];
+            level.Reduce(H.data, HR, static_cast<Index>(l));
+            auto const nActiveElements = (level.wgR.array() > Scalar(0)).count();
+            CHECK_EQ(nActiveElements, HR.wC[l].size());
+            CHECK_EQ(level.wgR.sum(), doctest::Approx(expectedTotalVolume));
+            CHECK_LE(level.GERadj.size(), level.GEadj.size());
+        }
+        // Clusters with large errors are integrated exactly
+        HR.EpMax = Scalar(-1);
+        for (decltype(nLevels) l = 0; l < nLevels; ++l)
+        {
+            auto& level = H.levels[l];
+            level.Reduce(H.data, HR, static_cast<Index>(l));
+            CHECK(level.wgR.isApprox(H.data.wg));
+            CHECK_EQ(level.GERadj.size(), level.GEadj.size());
+        }
+    }
 }
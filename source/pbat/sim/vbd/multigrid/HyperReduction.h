@@ -3,6 +3,8 @@
 
 #include "pbat/Aliases.h"
 
+#include <istream>
+#include <ostream>
 #include <vector>
 
 namespace pbat {
@@ -63,6 +65,30 @@ struct HyperReduction
      */
     void
     ComputeLinearPolynomialErrors(Hierarchy const& hierarchy, Eigen::Ref<MatrixX const> const& u);
+    /**
+     * @brief Check if the cluster errors of the last ComputeLinearPolynomialErrors call may no
+     * longer bound the errors of displacement u by EpMax.
+     *
+     * Linear polynomials reproduce translations, and cluster errors are quadratic in the
+     * displacement, such that a drift du = u - uR with |du_i - mean(du)| <= delta at every vertex
+     * changes a level l cluster's error to at most (sqrt(Ep) + sqrt((l+1) wC) delta)^2. This check
+     * thus costs O(#vertices), rather than the O(#elements x #levels) of recomputing the errors.
+     *
+     * @param u Current displacement field
+     * @return True if no errors were computed yet, or if delta exceeds uTol
+     */
+    bool IsStale(Eigen::Ref<MatrixX const> const& u) const;
+    /**
+     * @brief Write this hyper reduction's clustering, quadrature and error state to a binary
+     * stream
+     * @param os Output binary stream
+     */
+    void Serialize(std::ostream& os) const;
+    /**
+     * @brief Read a hyper reduction written by Serialize from a binary stream
+     * @param is Input binary stream
+     */
+    void Deserialize(std::istream& is);
 
     /**
      * @brief Hierarchical clustering of mesh elements
@@ -82,6 +108,8 @@ struct HyperReduction
     std::vector<MatrixX> up;      ///< |#levels| list of |#clusters| cluster polynomials
     std::vector<VectorX> Ep;      ///< |#levels| linear polynomial errors at each level
     Scalar EpMax{1e-6};           ///< Maximum allowable linear polynomial error in any cluster
+    MatrixX uR;                   ///< Displacement of the last ComputeLinearPolynomialErrors call
+    Scalar uTol{0}; ///< Largest drift from uR keeping clusters with Ep <= EpMax within EpMax
 };
 
 } // namespace multigrid
@@ -2,11 +2,17 @@
 
 #include "Hierarchy.h"
 #include "pbat/common/ArgSort.h"
-#include "pbat/physics/StableNeoHookeanEnergy.h"
 #include "pbat/profiling/Profiling.h"
 #include "pbat/sim/vbd/Kernels.h"
 #include "pbat/sim/vbd/multigrid/Smoother.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <exception>
+#include <fmt/format.h>
+#include <limits>
+#include <numeric>
 #include <tbb/parallel_for.h>
 
 namespace pbat {
@@ -14,32 +20,158 @@ namespace sim {
 namespace vbd {
 namespace multigrid {
 
-void Integrator::ComputeAndSortStrainRates(
-    [[maybe_unused]] Hierarchy& H,
-    [[maybe_unused]] Scalar sdt) const
+namespace detail {
+
+/**
+ * @brief Bucket active vertices of each partition by decreasing activity H.rActivity, where bucket
+ * b holds activities in [2^b, 2^(b+1)) * H.rActivityThreshold, using a counting sort per
+ * partition. The last bucket also holds all larger (including infinite) activities.
+ */
+static void SortActiveVertices(Hierarchy& H)
+{
+    auto const& data         = H.data;
+    auto const& activity     = H.rActivity;
+    Scalar const threshold   = H.rActivityThreshold;
+    Index constexpr kBuckets = 16;
+    auto const bucket        = [&](Index i) {
+        Scalar const r = activity(i) / threshold;
+        if (not(r < static_cast<Scalar>(Index(1) << (kBuckets - 1))))
+            return kBuckets - 1;
+        if (r < Scalar(2))
+            return Index(0);
+        return static_cast<Index>(std::floor(std::log2(r)));
+    };
+    auto const nPartitions = data.Pptr.size() - 1;
+    H.rAptr.setZero(nPartitions + 1);
+    tbb::parallel_for(Index(0), nPartitions, [&](Index p) {
+        Index nActive{0};
+        for (auto k = data.Pptr(p); k < data.Pptr(p + 1); ++k)
+            nActive += static_cast<Index>(activity(data.Padj(k)) >= threshold);
+        H.rAptr(p + 1) = nActive;
+    });
+    std::partial_sum(H.rAptr.begin(), H.rAptr.end(), H.rAptr.begin());
+    H.rAadj.resize(H.rAptr(nPartitions));
+    tbb::parallel_for(Index(0), nPartitions, [&](Index p) {
+        std::array<Index, kBuckets> offsets{};
+        for (auto k = data.Pptr(p); k < data.Pptr(p + 1); ++k)
+        {
+            Index const i = data.Padj(k);
+            if (activity(i) >= threshold)
+                ++offsets[static_cast<std::size_t>(kBuckets - 1 - bucket(i))];
+        }
+        Index offset = H.rAptr(p);
+        for (auto& o : offsets)
+        {
+            Index const count = o;
+            o                 = offset;
+            offset += count;
+        }
+        for (auto k = data.Pptr(p); k < data.Pptr(p + 1); ++k)
+        {
+            Index const i = data.Padj(k);
+            if (activity(i) >= threshold)
+                H.rAadj(offsets[static_cast<std::size_t>(kBuckets - 1 - bucket(i))]++) = i;
+        }
+    });
+}
+
+/**
+ * @brief Spread vertex activities to vertices sharing an element, i.e. each vertex takes the
+ * largest activity among its adjacent elements' vertices (and its own)
+ */
+static VectorX DilateActivity(Data const& data, VectorX const& activity)
+{
+    auto const nElements = data.E.cols();
+    VectorX elementActivity(nElements);
+    tbb::parallel_for(Index(0), nElements, [&](Index e) {
+        elementActivity(e) = activity(data.E.col(e)).maxCoeff();
+    });
+    auto const nVertices = data.x.cols();
+    VectorX dilated(nVertices);
+    tbb::parallel_for(Index(0), nVertices, [&](Index i) {
+        Scalar ai = activity(i);
+        for (auto n = data.GVGp(i); n < data.GVGp(i + 1); ++n)
+            ai = std::max(ai, elementActivity(data.GVGe(n)));
+        dilated(i) = ai;
+    });
+    return dilated;
+}
+
+} // namespace detail
+
+void Integrator::ComputeAndSortStrainRates(Hierarchy& H, Scalar sdt) const
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Integrator.ComputeAndSortStrainRates");
-    // auto nElements = H.data.E.cols();
-    // tbb::parallel_for(Index(0), nElements, [&](Index e) {
-    //     auto inds      = H.data.E(Eigen::placeholders::all, e);
-    //     auto xe        = H.data.x(Eigen::placeholders::all, inds);
-    //     auto GNe       = H.data.GP.block<4, 3>(0, 3 * e);
-    //     Matrix<3, 3> F = xe * GNe;
-    //     // E = 1/2 (F^T F - I)
-    //     Matrix<3, 3> E = F.transpose() * F;
-    //     E.diagonal().array() -= Scalar(1);
-    //     E *= Scalar(0.5);
-    //     auto GreenStrain       = H.data.mGreenStrains.block<3, 3>(0, 3 * e);
-    //     auto GreenStrainAtT    = H.data.mGreenStrainsAtT.block<3, 3>(0, 3 * e);
-    //     GreenStrainAtT         = GreenStrain;
-    //     GreenStrain            = E;
-    //     Matrix<3, 3> Edot      = (GreenStrain - GreenStrainAtT) / sdt;
-    //     H.data.mStrainRates(e) = Edot.norm();
-    // });
-    // std::sort(
-    //     H.data.mStrainRateOrder.begin(),
-    //     H.data.mStrainRateOrder.end(),
-    //     [&](Index ei, Index ej) { return H.data.mStrainRates(ei) < H.data.mStrainRates(ej); });
+    Scalar const threshold = H.rActivityThreshold;
+    if (threshold <= Scalar(0))
+    {
+        H.rStrainRates.resize(0);
+        H.rActivity.resize(0);
+        H.rAext.resize(0, 0);
+        H.rAptr.resize(0);
+        H.rAadj.resize(0);
+        return;
+    }
+    auto const& data = H.data;
+    // Green strain rates Edot = 1/2 (F^T F - Ft^T Ft) / sdt of the last time step
+    auto const nElements = data.E.cols();
+    H.rStrainRates.resize(nElements);
+    tbb::parallel_for(Index(0), nElements, [&](Index e) {
+        auto inds       = data.E(Eigen::placeholders::all, e);
+        auto GPe        = data.GP.block<4, 3>(0, 3 * e);
+        Matrix<3, 3> F  = data.x(Eigen::placeholders::all, inds).block<3, 4>(0, 0) * GPe;
+        Matrix<3, 3> Ft = data.xt(Eigen::placeholders::all, inds).block<3, 4>(0, 0) * GPe;
+        Matrix<3, 3> Edot = Scalar(0.5) * (F.transpose() * F - Ft.transpose() * Ft) / sdt;
+        H.rStrainRates(e) = Edot.norm();
+    });
+    // Vertex activity is the largest strain rate among adjacent elements
+    auto const nVertices = data.x.cols();
+    VectorX activity(nVertices);
+    tbb::parallel_for(Index(0), nVertices, [&](Index i) {
+        Scalar ai{0};
+        for (auto n = data.GVGp(i); n < data.GVGp(i + 1); ++n)
+        {
+            // Non-finite strain rates, e.g. of inverted or exploding elements, are maximally active
+            Scalar const ri = H.rStrainRates(data.GVGe(n));
+            ai = std::isfinite(ri) ? std::max(ai, ri) : std::numeric_limits<Scalar>::infinity();
+        }
+        activity(i) = ai;
+    });
+    // Resting vertices coupled to active vertices are pulled by their motion, and are thus woken
+    H.rActivity = detail::DilateActivity(data, activity);
+    H.rAext     = data.aext;
+    detail::SortActiveVertices(H);
+}
+
+void Integrator::WakeLoadedVertices(Hierarchy& H) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Integrator.WakeLoadedVertices");
+    bool const bIsPrioritized = H.rActivityThreshold > Scalar(0) and H.rAptr.size() > 0;
+    if (not bIsPrioritized)
+        return;
+    auto const& data     = H.data;
+    auto const nVertices = data.x.cols();
+    bool const bHasLoadHistory =
+        H.rActivity.size() == nVertices and H.rAext.rows() == data.aext.rows() and
+        H.rAext.cols() == nVertices;
+    if (not bHasLoadHistory)
+    {
+        // Without load history, all vertices are smoothed
+        H.rAptr.resize(0);
+        H.rAadj.resize(0);
+        return;
+    }
+    // Vertices whose external acceleration changed, and their neighbours, are maximally active
+    VectorX loads(nVertices);
+    tbb::parallel_for(Index(0), nVertices, [&](Index i) {
+        bool const bIsLoaded = (data.aext.col(i).array() != H.rAext.col(i).array()).any();
+        loads(i) = bIsLoaded ? std::numeric_limits<Scalar>::infinity() : Scalar(0);
+    });
+    if (not loads.array().isInf().any())
+        return;
+    H.rActivity = H.rActivity.cwiseMax(detail::DilateActivity(data, loads));
+    H.rAext     = data.aext;
+    detail::SortActiveVertices(H);
 }
 
 void Integrator::ComputeInertialTargetPositions(Hierarchy& H, Scalar sdt, Scalar sdt2) const
@@ -94,6 +226,32 @@ void Integrator::UpdateVelocity(Hierarchy& H, Scalar sdt) const
     });
 }
 
+bool Integrator::UpdateHyperReduction(Hierarchy& H) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Integrator.UpdateHyperReduction");
+    auto const nLevels     = H.levels.size();
+    bool const bHasReducer = not H.HR.C.empty();
+    if (not bHasReducer)
+        return false;
+    if (H.HR.C.size() != nLevels)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected hyper reduction with {} clustering levels, but got {}",
+            nLevels,
+            H.HR.C.size()));
+    }
+    MatrixX const u        = H.data.x - H.data.X;
+    bool const bIsReduced  = std::ranges::all_of(H.levels, [&](Level const& level) {
+        return level.wgR.size() == H.data.E.cols();
+    });
+    if (bIsReduced and not H.HR.IsStale(u))
+        return false;
+    H.HR.ComputeLinearPolynomialErrors(H, u);
+    for (std::size_t l = 0; l < nLevels; ++l)
+        H.levels[l].Reduce(H.data, H.HR, static_cast<Index>(l));
+    return true;
+}
+
 void Integrator::Step(Scalar dt, Index substeps, Hierarchy& H) const
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Integrator.Step");
@@ -101,30 +259,58 @@ void Integrator::Step(Scalar dt, Index substeps, Hierarchy& H) const
     using RootSmoother = pbat::sim::vbd::multigrid::Smoother;
     Scalar sdt         = dt / static_cast<Scalar>(substeps);
     Scalar sdt2        = sdt * sdt;
+    if (H.bDirectCoarseSolve and not H.levels.empty())
+        H.levels.back().bReuseFactorization = H.bReuseCoarseFactorization;
     for (Index s = 0; s < substeps; ++s)
     {
-        ComputeAndSortStrainRates(H, sdt);
         // Store previous positions
         H.data.xt = H.data.x;
         ComputeInertialTargetPositions(H, sdt, sdt2);
         InitializeBCD(H, sdt, sdt2);
+        UpdateHyperReduction(H);
+        WakeLoadedVertices(H);
         // Hierarchical solve
-        auto nLevelVisits = H.cycle.size();
-        for (auto c = 0; c < nLevelVisits; ++c)
+        bool const bIsResidualDriven = H.rtol > Scalar(0);
+        Scalar r0{0};
+        for (Index k = 0; k < H.ncycles; ++k)
         {
-            Index l     = H.cycle(c);
-            Index iters = H.siters(c);
-            if (l < 0)
+            if (bIsResidualDriven)
             {
-                RootSmoother{}.Apply(iters, sdt, H.data);
+                Scalar const r = RootSmoother{}.Residual(sdt, H.data);
+                if (k == 0)
+                    r0 = r;
+                else if (r <= H.rtol * r0)
+                    break;
             }
-            else
+            auto nLevelVisits = H.cycle.size();
+            for (auto c = 0; c < nLevelVisits; ++c)
             {
-                auto lStl = static_cast<std::size_t>(l);
-                H.levels[lStl].Smooth(sdt, iters, H.data);
+                Index l     = H.cycle(c);
+                Index iters = H.siters(c);
+                if (l < 0)
+                {
+                    bool const bIsPrioritized =
+                        H.rActivityThreshold > Scalar(0) and H.rAptr.size() > 0;
+                    if (bIsPrioritized)
+                        RootSmoother{}.Apply(iters, sdt, H.data, H.rAptr, H.rAadj);
+                    else
+                        RootSmoother{}.Apply(iters, sdt, H.data);
+                }
+                else
+                {
+                    auto lStl              = static_cast<std::size_t>(l);
+                    bool const bIsCoarsest = lStl + 1 == H.levels.size();
+                    bool const bIsSolved   = H.bDirectCoarseSolve and bIsCoarsest and
+                                           H.levels[lStl].Solve(sdt, iters, H.data);
+                    if (not bIsSolved)
+                        H.levels[lStl].Smooth(sdt, iters, H.data);
+                }
             }
         }
         UpdateVelocity(H, sdt);
+        // Prioritize the next time step's root smoothing by this time step's strain rates. The
+        // first time step has no strain rate history, and thus smooths all vertices.
+        ComputeAndSortStrainRates(H, sdt);
     }
 }
 
@@ -175,4 +361,177 @@ TEST_CASE("[sim][vbd][multigrid] Integrator")
     CHECK(bVerticesFallUnderGravity);
     bool const bVerticesOnlyFall = (dx.topRows(2).array().abs() < zero).all();
     CHECK(bVerticesOnlyFall);
+
+    SUBCASE("Direct coarse solves and residual driven W-cycles")
+    {
+        // Arrange
+        H.cycle              = sim::vbd::multigrid::Cycle(sim::vbd::multigrid::ECycle::W, 2);
+        H.siters             = IndexVectorX::Constant(H.cycle.size(), 2);
+        H.bDirectCoarseSolve = true;
+        H.ncycles            = 3;
+        H.rtol               = 1e-3;
+        // Act
+        mvbd.Step(dt, substeps, H);
+        // Assert
+        CHECK((H.data.x.array().isFinite()).all());
+        CHECK_EQ(H.levels.back().HC.rows(), 3 * VL2.cols());
+        CHECK_EQ(H.levels.back().GVVptr.size(), VL2.cols() + 1);
+    }
+    SUBCASE("Dirichlet vertex changes update the root and all coarse levels")
+    {
+        // Arrange
+        H.bDirectCoarseSolve        = true;
+        H.bReuseCoarseFactorization = true;
+        mvbd.Step(dt, substeps, H);
+        CHECK(H.levels.back().bReuseFactorization);
+        IndexVectorX dbc(2);
+        dbc << 1, 0;
+        // Act
+        bool const bIsUpdated = H.SetDirichletVertices(dbc);
+        // Assert
+#ifdef PBAT_USE_SUITESPARSE
+        CHECK(bIsUpdated);
+#else
+        CHECK_FALSE(bIsUpdated);
+#endif // PBAT_USE_SUITESPARSE
+        CHECK(H.data.dbc == IndexVectorX{{0, 1}});
+        CHECK_EQ(H.data.Padj.size(), H.data.x.cols() - 2);
+        CHECK_FALSE((H.data.Padj.array() <= 1).any());
+        CHECK_EQ(H.data.v.leftCols(2).squaredNorm(), Scalar(0));
+        CHECK_EQ(H.data.aext.leftCols(2).squaredNorm(), Scalar(0));
+        for (auto const& level : H.levels)
+        {
+            CHECK(level.bIsDirichletVertex.head(2).all());
+            CHECK_EQ(level.bIsDirichletVertex.count(), 2);
+        }
+        // Act
+        CHECK(H.SetDirichletVertices(IndexVectorX{}) == bIsUpdated);
+        mvbd.Step(dt, substeps, H);
+        // Assert
+        CHECK_EQ(H.data.dbc.size(), 0);
+        CHECK_EQ(H.data.Padj.size(), H.data.x.cols());
+        CHECK((H.data.x.array().isFinite()).all());
+    }
+    SUBCASE("Strain rate prioritized smoothing skips static vertices")
+    {
+        // Arrange
+        Scalar constexpr kThreshold = 1e-3;
+        H.rActivityThreshold        = kThreshold;
+        H.data.xt                   = H.data.x;
+        auto const i                = H.data.E(0, 0);
+        H.data.x(0, i) += Scalar(0.1);
+        // Act
+        mvbd.ComputeAndSortStrainRates(H, dt);
+        // Assert
+        REQUIRE_EQ(H.rStrainRates.size(), H.data.E.cols());
+        REQUIRE_EQ(H.rAptr.size(), H.data.Pptr.size());
+        Index const nActive = H.rAptr(H.rAptr.size() - 1);
+        CHECK_GT(nActive, 0);
+        CHECK_LT(nActive, H.data.x.cols());
+        CHECK((H.rAadj.array() == i).any());
+        for (auto p = 0; p + 1 < H.rAptr.size(); ++p)
+        {
+            for (auto k = H.rAptr(p); k < H.rAptr(p + 1); ++k)
+            {
+                Index const v = H.rAadj(k);
+                CHECK((H.data.Padj.segment(H.data.Pptr(p), H.data.Pptr(p + 1) - H.data.Pptr(p))
+                           .array() == v)
+                          .any());
+            }
+        }
+        // Act
+        H.data.x(0, i) -= Scalar(0.1);
+        mvbd.Step(dt, substeps, H);
+        // Assert
+        CHECK((H.data.x.array().isFinite()).all());
+        CHECK_EQ(H.rStrainRates.size(), H.data.E.cols());
+    }
+    SUBCASE("Strain rate prioritized smoothing smooths all vertices without strain rate history")
+    {
+        // Arrange
+        Hierarchy HP{
+            Data().WithVolumeMesh(VR, CR).Construct(),
+            {VolumeMesh(VL1, CL1), VolumeMesh(VL2, CL2)}};
+        Hierarchy HU{
+            Data().WithVolumeMesh(VR, CR).Construct(),
+            {VolumeMesh(VL1, CL1), VolumeMesh(VL2, CL2)}};
+        HP.rActivityThreshold = Scalar(1e-3);
+        // Act
+        mvbd.Step(dt, substeps, HP);
+        mvbd.Step(dt, substeps, HU);
+        // Assert
+        CHECK(HP.data.x.isApprox(HU.data.x));
+        CHECK_EQ(HP.rStrainRates.size(), HP.data.E.cols());
+        CHECK_EQ(HP.rAptr.size(), HP.data.Pptr.size());
+    }
+    SUBCASE("Non-finite strain rates are maximally active")
+    {
+        // Arrange
+        H.rActivityThreshold = Scalar(1e-3);
+        H.data.xt            = H.data.x;
+        auto const i         = H.data.E(0, 0);
+        H.data.x(0, i)       = std::numeric_limits<Scalar>::infinity();
+        // Act
+        mvbd.ComputeAndSortStrainRates(H, dt);
+        // Assert
+        CHECK((H.rAadj.array() == i).any());
+    }
+    SUBCASE("Strain rate prioritized smoothing wakes newly loaded resting regions")
+    {
+        // Arrange
+        H.rActivityThreshold = Scalar(1e-3);
+        H.data.xt            = H.data.x;
+        mvbd.ComputeAndSortStrainRates(H, dt);
+        REQUIRE_EQ(H.rAptr.size(), H.data.Pptr.size());
+        REQUIRE_EQ(H.rAptr(H.rAptr.size() - 1), 0);
+        auto const i = H.data.E(0, 0);
+        // Act
+        mvbd.WakeLoadedVertices(H);
+        bool const bIsUnloadedRegionWoken = H.rAptr(H.rAptr.size() - 1) > 0;
+        H.data.aext.col(i) += Vector<3>{Scalar(0), Scalar(0), Scalar(-10)};
+        mvbd.WakeLoadedVertices(H);
+        // Assert
+        CHECK_FALSE(bIsUnloadedRegionWoken);
+        Index const nActive = H.rAptr(H.rAptr.size() - 1);
+        CHECK_LT(nActive, H.data.x.cols());
+        for (auto n = H.data.GVGp(i); n < H.data.GVGp(i + 1); ++n)
+            for (auto j : H.data.E.col(H.data.GVGe(n)))
+                CHECK((H.rAadj.array() == j).any());
+        CHECK(H.rAext.isApprox(H.data.aext));
+        // Act
+        MatrixX const x0 = H.data.x;
+        mvbd.Step(dt, substeps, H);
+        // Assert
+        CHECK((H.data.x.array().isFinite()).all());
+        CHECK_LT(H.data.x(2, i) - x0(2, i), (H.data.x.row(2) - x0.row(2)).mean());
+    }
+    SUBCASE("Hyper reductions are only refreshed when cluster errors may exceed their budget")
+    {
+        // Arrange
+        H.HR = sim::vbd::multigrid::HyperReduction(H, 5);
+        REQUIRE(mvbd.UpdateHyperReduction(H));
+        CHECK_FALSE(mvbd.UpdateHyperReduction(H));
+        std::vector<VectorX> wgR{};
+        for (auto const& level : H.levels)
+            wgR.push_back(level.wgR);
+        // Act
+        // Translations are reproduced exactly by linear polynomials
+        H.data.x.colwise() += Vector<3>{Scalar(0.1), Scalar(-0.2), Scalar(0.3)};
+        bool const bIsTranslationRefreshed = mvbd.UpdateHyperReduction(H);
+        // Drifts within the error budget keep all accepted clusters accurate
+        REQUIRE(std::isfinite(H.HR.uTol));
+        H.data.x(0, H.data.E(0, 0)) += Scalar(0.5) * H.HR.uTol;
+        bool const bIsSmallDriftRefreshed = mvbd.UpdateHyperReduction(H);
+        // Assert
+        CHECK_FALSE(bIsTranslationRefreshed);
+        CHECK_FALSE(bIsSmallDriftRefreshed);
+        for (std::size_t l = 0; l < H.levels.size(); ++l)
+            CHECK(H.levels[l].wgR == wgR[l]);
+        // Act
+        H.data.x(0, H.data.E(0, 0)) += Scalar(4) * H.HR.uTol + Scalar(0.1);
+        bool const bIsLargeDriftRefreshed = mvbd.UpdateHyperReduction(H);
+        // Assert
+        CHECK(bIsLargeDriftRefreshed);
+        CHECK(H.HR.uR.isApprox(H.data.x - H.data.X));
+    }
 }
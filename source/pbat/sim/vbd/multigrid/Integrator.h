@@ -14,9 +14,51 @@ class Integrator
 {
   public:
     void Step(Scalar dt, Index substeps, Hierarchy& hierarchy) const;
+    /**
+     * @brief Compute root level elements' Green strain rates over the last time step and bucket
+     * each parallel vertex partition's active vertices by decreasing strain rate activity.
+     *
+     * A vertex's activity is the largest strain rate among its adjacent elements, where
+     * non-finite strain rates count as infinitely active. Resting vertices sharing an element
+     * with active vertices are woken, i.e. take their largest neighbour's activity. Vertices whose
+     * activity falls below H.rActivityThreshold are considered static and excluded. Does nothing
+     * if H.rActivityThreshold <= 0.
+     *
+     * Step calls this at the end of each time step, such that the next time step is prioritized
+     * by its predecessor's strain rates. Time steps without such history smooth all vertices.
+     *
+     * @param H Multigrid hierarchy
+     * @param sdt Time step
+     */
     void ComputeAndSortStrainRates(Hierarchy& H, Scalar sdt) const;
+    /**
+     * @brief Wake root level vertices whose external acceleration changed since the last
+     * ComputeAndSortStrainRates or WakeLoadedVertices call, and their neighbours.
+     *
+     * Strain rates only reflect the last time step's motion, such that resting regions receiving
+     * new loads would otherwise never be smoothed. Woken vertices are maximally active. Changes of
+     * Dirichlet vertices reset the prioritization instead (see Hierarchy::SetDirichletVertices).
+     * Does nothing if strain rate prioritized smoothing is disabled or has no history.
+     *
+     * Step calls this at the start of each time step.
+     *
+     * @param H Multigrid hierarchy
+     */
+    void WakeLoadedVertices(Hierarchy& H) const;
     void ComputeInertialTargetPositions(Hierarchy& H, Scalar sdt, Scalar sdt2) const;
     void InitializeBCD(Hierarchy& H, Scalar sdt, Scalar sdt2) const; 
+    /**
+     * @brief Refresh coarse level hyper reductions from the current linear polynomial errors of
+     * the displacement field, if H's hyper reduction is non-empty.
+     *
+     * The refresh costs O(#elements x #levels), and is thus skipped while the displacement's drift
+     * since the last refresh keeps every accepted cluster within the error budget H.HR.EpMax (see
+     * HyperReduction::IsStale). Changing H.HR.EpMax requires clearing H.HR.uR to force a refresh.
+     *
+     * @param H Multigrid hierarchy
+     * @return True if the hyper reductions were refreshed
+     */
+    bool UpdateHyperReduction(Hierarchy& H) const;
     void UpdateVelocity(Hierarchy& H, Scalar sdt) const; 
 
   private:
@@ -1 +0,0 @@
-#include "Kernels.h"
\ No newline at end of file
@@ -1,16 +1,30 @@
 #include "Level.h"
 
-#include "Kernels.h"
+#include "pbat/common/Indexing.h"
+#include "pbat/fem/DeformationGradient.h"
+#include "pbat/common/Serialization.h"
 #include "pbat/fem/ShapeFunctions.h"
 #include "pbat/geometry/TetrahedralAabbHierarchy.h"
 #include "pbat/graph/Adjacency.h"
 #include "pbat/graph/Color.h"
 #include "pbat/graph/Mesh.h"
+#include "pbat/math/linalg/Cholmod.h"
 #include "pbat/math/linalg/mini/Mini.h"
+#include "pbat/physics/AsRigidAsPossibleEnergy.h"
+#include "pbat/physics/CorotationalEnergy.h"
+#include "pbat/physics/SpdProjection.h"
 #include "pbat/physics/StableNeoHookeanEnergy.h"
 #include "pbat/profiling/Profiling.h"
+#include "pbat/sim/vbd/Kernels.h"
 
+#include <Eigen/SparseCholesky>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <fmt/format.h>
 #include <tbb/parallel_for.h>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -26,6 +40,88 @@ using pbat::math::linalg::mini::SVector;
 using pbat::math::linalg::mini::ToEigen;
 using pbat::math::linalg::mini::Zeros;
 
+namespace detail {
+
+template <std::size_t N>
+static void PushUnique(std::array<Index, N>& buffer, Index& n, Index value)
+{
+    auto const begin = buffer.begin();
+    auto const end   = begin + n;
+    if (std::find(begin, end, value) == end)
+        buffer[static_cast<std::size_t>(n++)] = value;
+}
+
+/**
+ * @brief Computes the compressed row adjacency of a bipartite graph between |nRows| row vertices
+ * and |nCols| column vertices, with two parallel passes (count, then fill) over column vertices.
+ *
+ * @tparam kMaxEdges Maximum number of edges incident to any column vertex
+ * @tparam FEdges Callable with signature `Index(Index j, std::array<Index,kMaxEdges>& rows,
+ * std::array<Index,kMaxEdges>& weights)` which writes the (unique) row vertices adjacent to column
+ * vertex j and the corresponding edge weights, and returns the number of such edges.
+ * @param nRows Number of row vertices
+ * @param nCols Number of column vertices
+ * @param fEdges Edge generator
+ * @return (ptr, adj, wadj) where row vertex i's adjacent column vertices (sorted) and edge weights
+ * are adj[ptr[i]:ptr[i+1]] and wadj[ptr[i]:ptr[i+1]]
+ */
+template <std::size_t kMaxEdges, class FEdges>
+static std::tuple<IndexVectorX, IndexVectorX, IndexVectorX>
+ParallelRowAdjacency(Index nRows, Index nCols, FEdges fEdges)
+{
+    using EdgeBuffer = std::array<Index, kMaxEdges>;
+    // Count row degrees
+    std::vector<std::atomic<Index>> counts(static_cast<std::size_t>(nRows));
+    tbb::parallel_for(Index(0), nCols, [&](Index j) {
+        EdgeBuffer rows{}, weights{};
+        Index const n = fEdges(j, rows, weights);
+        for (Index k = 0; k < n; ++k)
+            counts[static_cast<std::size_t>(rows[static_cast<std::size_t>(k)])].fetch_add(
+                Index(1),
+                std::memory_order_relaxed);
+    });
+    IndexVectorX ptr(nRows + 1);
+    ptr(0) = Index(0);
+    for (Index i = 0; i < nRows; ++i)
+    {
+        auto& count = counts[static_cast<std::size_t>(i)];
+        ptr(i + 1)  = ptr(i) + count.load(std::memory_order_relaxed);
+        // Reuse counts as insertion cursors
+        count.store(ptr(i), std::memory_order_relaxed);
+    }
+    // Fill edges
+    IndexVectorX adj(ptr(nRows));
+    IndexVectorX wadj(ptr(nRows));
+    tbb::parallel_for(Index(0), nCols, [&](Index j) {
+        EdgeBuffer rows{}, weights{};
+        Index const n = fEdges(j, rows, weights);
+        for (Index k = 0; k < n; ++k)
+        {
+            auto const ks = static_cast<std::size_t>(k);
+            Index const e = counts[static_cast<std::size_t>(rows[ks])].fetch_add(
+                Index(1),
+                std::memory_order_relaxed);
+            adj(e)  = j;
+            wadj(e) = weights[ks];
+        }
+    });
+    // Sort each row's adjacent vertices for deterministic traversal
+    tbb::parallel_for(Index(0), nRows, [&](Index i) {
+        auto const begin = ptr(i);
+        auto const end   = ptr(i + 1);
+        std::vector<std::pair<Index, Index>> edges{};
+        edges.reserve(static_cast<std::size_t>(end - begin));
+        for (auto e = begin; e < end; ++e)
+            edges.emplace_back(adj(e), wadj(e));
+        std::sort(edges.begin(), edges.end());
+        for (auto e = begin; e < end; ++e)
+            std::tie(adj(e), wadj(e)) = edges[static_cast<std::size_t>(e - begin)];
+    });
+    return {ptr, adj, wadj};
+}
+
+} // namespace detail
+
 Level::Level(Data const& data, VolumeMesh meshIn)
     : mesh(std::move(meshIn)),
       u(),
@@ -42,7 +138,20 @@ Level::Level(Data const& data, VolumeMesh meshIn)
       GKptr(),
       GKadj(),
       GKilocal(),
-      bIsDirichletVertex()
+      bIsDirichletVertex(),
+      GCFptr(),
+      GCFadj(),
+      GCFrank(),
+      GCFparent(),
+      wgR(),
+      GERptr(),
+      GERadj(),
+      GVVptr(),
+      GVVadj(),
+      HC(),
+      LLT(),
+      bReuseFactorization(false),
+      nMaxFactorizationReuses(4)
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.Construct");
 
@@ -55,6 +164,28 @@ Level::Level(Data const& data, VolumeMesh meshIn)
 
     geometry::TetrahedralAabbHierarchy cbvh(mesh.X, mesh.E);
 
+    // Kinetic energy
+    //
+    // Locate all fine vertices in the coarse mesh and evaluate coarse shape functions at them in a
+    // single batch. Fine element quantities below are gathered from these per-vertex quantities.
+    auto const nFineVertices    = data.X.cols();
+    auto const nFineElements    = data.E.cols();
+    Index const nCoarseVertices = mesh.X.cols();
+    Index const nCoarseElements = mesh.E.cols();
+    ecK                         = cbvh.PrimitivesContainingPoints(data.X);
+    NecK                        = fem::ShapeFunctionsAt(mesh, ecK, data.X);
+    std::tie(GKptr, GKadj, GKilocal) = detail::ParallelRowAdjacency<4>(
+        nCoarseVertices,
+        nFineVertices,
+        [&](Index vf, auto& vc, auto& ilocal) {
+            for (Index i = 0; i < 4; ++i)
+            {
+                vc[static_cast<std::size_t>(i)]     = mesh.E(i, ecK(vf));
+                ilocal[static_cast<std::size_t>(i)] = i;
+            }
+            return Index(4);
+        });
+
     // Elastic energy
     //
     // Objective:
@@ -63,73 +194,106 @@ Level::Level(Data const& data, VolumeMesh meshIn)
     // - (ec, Nec, ilocal) where Nec are ec's shape functions at vf and ilocal is vc's local vertex
     //   index in ec
     //
-    // 1. We first construct 4x|#fine elements| indices ecVE which contain, in each column,
+    // 1. We first gather 4x|#fine elements| indices ecVE which contain, in each column,
     //    the 4 coarse elements ec containing the 4 vertices of element ef.
-    // 2. We then construct 4x|4*#fine elements| coarse element shape functions at those vertices.
+    // 2. We then gather 4x|4*#fine elements| coarse element shape functions at those vertices.
     // 3. Then, we construct the graph (vc, ef) by traversing the graph with edge (ec, ef) if ec
     //    contains at least one fine vertex of ef.
     // 4. For each (vc,ef), we look at all 4 ec in the column ef of ecVE, and determine which local
     //    vertex index vc corresponds to, or set it to -1 if it doesn't apply.
-    auto const nFineElements = data.E.cols();
     ecVE.resize(4, nFineElements);
     NecVE.resize(4, 4 * nFineElements);
-    for (auto i = 0; i < 4; ++i)
-    {
-        auto ithVertexPositions = data.X(Eigen::placeholders::all, data.E.row(i));
-        ecVE.row(i)             = cbvh.PrimitivesContainingPoints(ithVertexPositions);
-        NecVE(Eigen::placeholders::all, Eigen::seqN(i, nFineElements, 4)) =
-            fem::ShapeFunctionsAt(mesh, ecVE.row(i), ithVertexPositions);
-    }
-    Index constexpr nVertexPerElement = 4;
-    std::vector<graph::WeightedEdge<Scalar, Index>> vc2ef{};
-    vc2ef.reserve(static_cast<std::size_t>(nFineElements * nVertexPerElement * nVertexPerElement));
-    for (auto ef = 0; ef < nFineElements; ++ef)
-        for (auto ec : ecVE.col(ef))
-            for (auto vc : mesh.E.col(ec))
-                vc2ef.push_back({vc, ef});
-    Index const nCoarseVertices = mesh.X.cols();
-    std::tie(GEptr, GEadj)      = graph::MatrixToAdjacency(graph::AdjacencyMatrixFromEdges(
-        vc2ef.begin(),
-        vc2ef.end(),
+    tbb::parallel_for(Index(0), nFineElements, [&](Index ef) {
+        for (Index i = 0; i < 4; ++i)
+        {
+            Index const vf        = data.E(i, ef);
+            ecVE(i, ef)           = ecK(vf);
+            NecVE.col(4 * ef + i) = NecK.col(vf);
+        }
+    });
+    std::tie(GEptr, GEadj, std::ignore) = detail::ParallelRowAdjacency<16>(
         nCoarseVertices,
-        nFineElements));
+        nFineElements,
+        [&](Index ef, auto& vc, [[maybe_unused]] auto& w) {
+            Index n{0};
+            for (auto ec : ecVE.col(ef))
+                for (auto v : mesh.E.col(ec))
+                    detail::PushUnique(vc, n, v);
+            return n;
+        });
     ilocalE.setConstant(4, GEadj.size(), Index(-1));
-    graph::ForEachEdge(GEptr, GEadj, [&](Index vc, Index ef, Index eid) {
-        for (Index vf = 0; vf < 4; ++vf)
+    tbb::parallel_for(Index(0), nCoarseVertices, [&](Index vc) {
+        for (auto eid = GEptr(vc); eid < GEptr(vc + 1); ++eid)
         {
-            Index ec = ecVE(vf, ef);
-            for (Index iclocal = 0; iclocal < 4; ++iclocal)
-                if (vc == mesh.E(iclocal, ec))
-                    ilocalE(vf, eid) = iclocal;
+            Index const ef = GEadj(eid);
+            for (Index vf = 0; vf < 4; ++vf)
+            {
+                Index ec = ecVE(vf, ef);
+                for (Index iclocal = 0; iclocal < 4; ++iclocal)
+                    if (vc == mesh.E(iclocal, ec))
+                        ilocalE(vf, eid) = iclocal;
+            }
         }
     });
 
-    // Kinetic energy
-    ecK                 = cbvh.PrimitivesContainingPoints(data.X);
-    NecK                = fem::ShapeFunctionsAt(mesh, ecK, data.X);
-    IndexMatrixX ilocal = IndexVector<4>{0, 1, 2, 3}.replicate(1, ecK.size());
-    G                   = graph::MeshAdjacencyMatrix(
-        mesh.E(Eigen::placeholders::all, ecK),
-        ilocal,
-        mesh.X.cols(),
-        true);
-    std::tie(GKptr, GKadj, GKilocal) = graph::MatrixToWeightedAdjacency(G);
-
     // Dirichlet energy
-    auto const nFineVertices = data.X.cols();
     bIsDirichletVertex.setConstant(nFineVertices, false);
     bIsDirichletVertex(data.dbc).setConstant(true);
 
     // Coarse element to fine element adjacency graph for hyper reduction
-    std::tie(GCFptr, GCFadj) = graph::MatrixToAdjacency(graph::MeshAdjacencyMatrix(
-        ecVE,
-        mesh.E.cols(),
-        true /*bVertexToElement*/,
-        true /*bHasDuplicates*/));
+    std::tie(GCFptr, GCFadj, std::ignore) = detail::ParallelRowAdjacency<4>(
+        nCoarseElements,
+        nFineElements,
+        [&](Index ef, auto& ec, [[maybe_unused]] auto& w) {
+            Index n{0};
+            for (auto e : ecVE.col(ef))
+                detail::PushUnique(ec, n, e);
+            return n;
+        });
     GCFrank.setZero(GCFadj.size());
     GCFparent.setZero(GCFadj.size());
 }
 
+static void AccumulateElasticEnergyDerivatives(
+    Data const& data,
+    const Level& level,
+    Index kg,
+    Scalar wg,
+    Scalar dt2,
+    SMatrix<Scalar, 3, 3>& Hu,
+    SVector<Scalar, 3>& gu)
+{
+    Index ef              = level.GEadj(kg);
+    IndexVector<4> ilocal = level.ilocalE.col(kg);
+    Scalar mug            = data.lame(0, ef);
+    Scalar lambdag        = data.lame(1, ef);
+    Matrix<4, 3> GNef     = data.GP.block<4, 3>(0, 3 * ef);
+    Matrix<4, 4> N        = level.NecVE.block<4, 4>(0, 4 * ef);
+    Matrix<3, 4> xe       = data.x(Eigen::placeholders::all, data.E.col(ef));
+    IndexMatrix<4, 4> ec  = level.mesh.E(Eigen::placeholders::all, level.ecVE.col(ef));
+    for (auto iflocal = 0; iflocal < 4; ++iflocal)
+    {
+        xe.col(iflocal) += level.u(Eigen::placeholders::all, ec.col(iflocal)) * N.col(iflocal);
+    }
+    // The coarse vertex displaces fine node p by N(ilocal(p),p) u, such that dF/du contracts the
+    // fine element's shape function gradients into a single effective row.
+    SMatrix<Scalar, 1, 3> GNu = Zeros<Scalar, 1, 3>();
+    for (auto p = 0; p < 4; ++p)
+        if (ilocal(p) >= 0)
+            GNu += N(ilocal(p), p) * FromEigen(GNef.row(p));
+    SMatrix<Scalar, 3, 3> F = FromEigen(xe) * FromEigen(GNef);
+    vbd::kernels::AccumulateElasticDerivatives(
+        data.psie[static_cast<std::size_t>(ef)],
+        0,
+        dt2 * wg,
+        GNu,
+        F,
+        mug,
+        lambdag,
+        gu,
+        Hu);
+}
+
 static void ComputeElasticEnergyDerivatives(
     Data const& data,
     const Level& level,
@@ -138,35 +302,28 @@ static void ComputeElasticEnergyDerivatives(
     SMatrix<Scalar, 3, 3>& Hu,
     SVector<Scalar, 3>& gu)
 {
-    auto gBegin = level.GEptr(i);
-    auto gEnd   = level.GEptr(i + 1);
-    for (auto kg = gBegin; kg < gEnd; ++kg)
+    bool const bIsHyperReduced = level.GERptr.size() > 0;
+    if (bIsHyperReduced)
     {
-        Index ef              = level.GEadj(kg);
-        IndexVector<4> ilocal = level.ilocalE.col(kg);
-        Scalar wg             = data.wg(ef);
-        Scalar mug            = data.lame(0, ef);
-        Scalar lambdag        = data.lame(1, ef);
-        Matrix<4, 3> GNef     = data.GP.block<4, 3>(0, 3 * ef);
-        Matrix<4, 4> N        = level.NecVE.block<4, 4>(0, 4 * ef);
-        Matrix<3, 4> xe       = data.x(Eigen::placeholders::all, data.E.col(ef));
-        IndexMatrix<4, 4> ec  = level.mesh.E(Eigen::placeholders::all, level.ecVE.col(ef));
-        for (auto iflocal = 0; iflocal < 4; ++iflocal)
+        // Only integrate active fine elements, with hyper reduced quadrature weights
+        auto rBegin = level.GERptr(i);
+        auto rEnd   = level.GERptr(i + 1);
+        for (auto kr = rBegin; kr < rEnd; ++kr)
         {
-            xe.col(iflocal) += level.u(Eigen::placeholders::all, ec.col(iflocal)) * N.col(iflocal);
+            Index kg = level.GERadj(kr);
+            Index ef = level.GEadj(kg);
+            AccumulateElasticEnergyDerivatives(data, level, kg, level.wgR(ef), dt2, Hu, gu);
+        }
+    }
+    else
+    {
+        auto gBegin = level.GEptr(i);
+        auto gEnd   = level.GEptr(i + 1);
+        for (auto kg = gBegin; kg < gEnd; ++kg)
+        {
+            Index ef = level.GEadj(kg);
+            AccumulateElasticEnergyDerivatives(data, level, kg, data.wg(ef), dt2, Hu, gu);
         }
-        using kernels::AccumulateElasticEnergy;
-        AccumulateElasticEnergy(
-            physics::StableNeoHookeanEnergy<3>{},
-            FromEigen(ilocal),
-            dt2 * wg,
-            mug,
-            lambdag,
-            FromEigen(xe),
-            FromEigen(GNef),
-            FromEigen(N),
-            gu,
-            Hu);
     }
 }
 
@@ -220,6 +377,34 @@ void Level::Prolong(Data& data) const
     });
 }
 
+CSCMatrix Level::ProlongationMatrix() const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.ProlongationMatrix");
+    auto const nFineVertices = ecK.size();
+    auto const nCageVertices = mesh.X.cols();
+    using StorageIndex       = CSCMatrix::StorageIndex;
+    std::vector<Eigen::Triplet<Scalar, StorageIndex>> triplets{};
+    triplets.reserve(static_cast<std::size_t>(3 * 4 * nFineVertices));
+    for (Index i = 0; i < nFineVertices; ++i)
+    {
+        Index const ec = ecK(i);
+        for (auto a = 0; a < 4; ++a)
+        {
+            Index const v = mesh.E(a, ec);
+            for (auto d = 0; d < 3; ++d)
+            {
+                triplets.emplace_back(
+                    static_cast<StorageIndex>(3 * i + d),
+                    static_cast<StorageIndex>(3 * v + d),
+                    NecK(a, i));
+            }
+        }
+    }
+    CSCMatrix P(3 * nFineVertices, 3 * nCageVertices);
+    P.setFromTriplets(triplets.begin(), triplets.end());
+    return P;
+}
+
 void Level::Smooth(Scalar dt, Index iters, Data& data)
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.Smooth");
@@ -249,9 +434,608 @@ void Level::Smooth(Scalar dt, Index iters, Data& data)
     Prolong(data);
 }
 
-void Level::Reduce([[maybe_unused]] Data const& data)
+struct Level::Factorization
+{
+#ifdef PBAT_USE_SUITESPARSE
+    bool Compute(CSCMatrix const& A)
+    {
+        bIsFactorized =
+            mLLT.Factorize(A, math::linalg::Cholmod::ESparseStorage::SymmetricLowerTriangular);
+        nReuses = 0;
+        return bIsFactorized;
+    }
+    VectorX Solve(VectorX const& b) const { return mLLT.Solve(b).col(0); }
+    void StageUpdate(IndexVector<4> const& rows, Vector<4> const& w, bool bIsDowndate)
+    {
+        if (bIsDowndate)
+            mLLT.StageDowndate(rows, w);
+        else
+            mLLT.StageUpdate(rows, w);
+    }
+    bool ApplyStagedUpdates()
+    {
+        bIsFactorized = mLLT.ApplyStagedUpdates();
+        return bIsFactorized;
+    }
+
+    math::linalg::Cholmod mLLT{};
+#else
+    bool Compute(CSCMatrix const& A)
+    {
+        if (not bIsAnalyzed)
+        {
+            mLLT.analyzePattern(A);
+            bIsAnalyzed = true;
+        }
+        mLLT.factorize(A);
+        bIsFactorized = mLLT.info() == Eigen::Success;
+        nReuses       = 0;
+        return bIsFactorized;
+    }
+    VectorX Solve(VectorX const& b) const { return mLLT.solve(b); }
+    void StageUpdate(IndexVector<4> const&, Vector<4> const&, bool) {}
+    /**
+     * @brief Eigen's Cholesky factors cannot be updated, i.e. they are invalidated instead
+     */
+    bool ApplyStagedUpdates()
+    {
+        bIsFactorized = false;
+        return false;
+    }
+
+    Eigen::SimplicialLLT<CSCMatrix, Eigen::Lower> mLLT{};
+    bool bIsAnalyzed{false};
+#endif // PBAT_USE_SUITESPARSE
+    bool bIsFactorized{false}; ///< True if the last (re)factorization or update succeeded
+    Index nReuses{0};          ///< Number of Solve calls that reused the last factorization
+};
+
+Level::Level(Level const& other)
+    : mesh(other.mesh),
+      u(other.u),
+      colors(other.colors),
+      Pptr(other.Pptr),
+      Padj(other.Padj),
+      ecVE(other.ecVE),
+      NecVE(other.NecVE),
+      ilocalE(other.ilocalE),
+      GEptr(other.GEptr),
+      GEadj(other.GEadj),
+      ecK(other.ecK),
+      NecK(other.NecK),
+      GKptr(other.GKptr),
+      GKadj(other.GKadj),
+      GKilocal(other.GKilocal),
+      bIsDirichletVertex(other.bIsDirichletVertex),
+      GCFptr(other.GCFptr),
+      GCFadj(other.GCFadj),
+      GCFrank(other.GCFrank),
+      GCFparent(other.GCFparent),
+      wgR(other.wgR),
+      GERptr(other.GERptr),
+      GERadj(other.GERadj),
+      GVVptr(other.GVVptr),
+      GVVadj(other.GVVadj),
+      HC(other.HC),
+      LLT(other.LLT ? std::make_shared<Factorization>() : nullptr),
+      bReuseFactorization(other.bReuseFactorization),
+      nMaxFactorizationReuses(other.nMaxFactorizationReuses)
+{
+}
+
+Level& Level::operator=(Level const& other)
+{
+    if (this != &other)
+        *this = Level(other);
+    return *this;
+}
+
+namespace detail {
+
+/**
+ * @brief Invokes f with the 3D hyper elastic energy density of elastic energy model psie
+ */
+template <class Func>
+static void VisitElasticEnergy(EElasticEnergy psie, Func&& f)
+{
+    switch (psie)
+    {
+        case EElasticEnergy::StableNeoHookean: f(physics::StableNeoHookeanEnergy<3>{}); break;
+        case EElasticEnergy::Corotational: f(physics::CorotationalEnergy<3>{}); break;
+        case EElasticEnergy::AsRigidAsPossible: f(physics::AsRigidAsPossibleEnergy<3>{}); break;
+    }
+}
+
+/**
+ * @brief Adds the 3x3 block Hij to coarse vertex j's block in coarse vertex i's block column of
+ * level.HC
+ */
+static void AddHessianBlock(Level& level, Index i, Index j, SMatrix<Scalar, 3, 3> const& Hij)
+{
+    auto const* begin = level.GVVadj.data() + level.GVVptr(i);
+    auto const* end   = level.GVVadj.data() + level.GVVptr(i + 1);
+    auto const k      = static_cast<Index>(std::lower_bound(begin, end, j) - begin);
+    auto const* outer = level.HC.outerIndexPtr();
+    Scalar* values    = level.HC.valuePtr();
+    for (auto dc = 0; dc < 3; ++dc)
+    {
+        auto const col = 3 * i + dc;
+        for (auto dr = 0; dr < 3; ++dr)
+            values[outer[col] + 3 * k + dr] += Hij(dr, dc);
+    }
+}
+
+static void AccumulateElasticHessianAndGradient(
+    Data const& data,
+    Level& level,
+    Index i,
+    Index kg,
+    Scalar wg,
+    Scalar dt2,
+    bool bAssembleHessian,
+    SVector<Scalar, 3>& gu)
+{
+    using Element         = typename VolumeMesh::ElementType;
+    Index ef              = level.GEadj(kg);
+    IndexVector<4> ilocal = level.ilocalE.col(kg);
+    Scalar mug            = data.lame(0, ef);
+    Scalar lambdag        = data.lame(1, ef);
+    Matrix<4, 3> GNef     = data.GP.block<4, 3>(0, 3 * ef);
+    Matrix<4, 4> N        = level.NecVE.block<4, 4>(0, 4 * ef);
+    Matrix<3, 4> xe       = data.x(Eigen::placeholders::all, data.E.col(ef));
+    IndexMatrix<4, 4> ec  = level.mesh.E(Eigen::placeholders::all, level.ecVE.col(ef));
+    for (auto iflocal = 0; iflocal < 4; ++iflocal)
+    {
+        xe.col(iflocal) += level.u(Eigen::placeholders::all, ec.col(iflocal)) * N.col(iflocal);
+    }
+    SMatrix<Scalar, 4, 3> GNe = FromEigen(GNef);
+    SMatrix<Scalar, 3, 3> F   = FromEigen(xe) * GNe;
+    SVector<Scalar, 9> gF{};
+    SMatrix<Scalar, 9, 9> HF = Zeros<Scalar, 9, 9>();
+    VisitElasticEnergy(data.psie[static_cast<std::size_t>(ef)], [&](auto const& Psi) {
+        gF = Psi.grad(F, mug, lambdag);
+        // The hessian is projected to SPD per quadrature point, such that HC is SPD under
+        // compression
+        if (bAssembleHessian)
+            HF = physics::SpdHessian(Psi, F, mug, lambdag);
+    });
+    Scalar const w = dt2 * wg;
+    for (auto p = 0; p < 4; ++p)
+    {
+        if (ilocal(p) < 0)
+            continue;
+        Scalar const wNip = w * N(ilocal(p), p);
+        gu += wNip * fem::GradientSegmentWrtDofs<Element, 3>(gF, GNe, p);
+        if (not bAssembleHessian)
+            continue;
+        for (auto q = 0; q < 4; ++q)
+        {
+            SMatrix<Scalar, 3, 3> Hqp = fem::HessianBlockWrtDofs<Element, 3>(HF, GNe, q, p);
+            for (auto b = 0; b < 4; ++b)
+                AddHessianBlock(level, i, ec(b, q), (wNip * N(b, q)) * Hqp);
+        }
+    }
+}
+
+static void AccumulateKineticAndDirichletHessianAndGradient(
+    Data const& data,
+    Level& level,
+    Index i,
+    bool bAssembleHessian,
+    SVector<Scalar, 3>& gu)
+{
+    for (auto kg = level.GKptr(i); kg < level.GKptr(i + 1); ++kg)
+    {
+        Index vf                = level.GKadj(kg);
+        bool const bIsDirichlet = level.bIsDirichletVertex(vf);
+        Index ilocal            = level.GKilocal(kg);
+        Index ec                = level.ecK(vf);
+        SVector<Scalar, 4> Ne   = FromEigen(level.NecK.col(vf).head<4>());
+        SVector<Scalar, 3> xk   = FromEigen(data.x.col(vf).head<3>());
+        SMatrix<Scalar, 3, 4> ue =
+            FromEigen(level.u(Eigen::placeholders::all, level.mesh.E.col(ec)).block<3, 4>(0, 0));
+        SVector<Scalar, 3> x      = xk + ue * Ne;
+        Scalar mvf                = data.m(vf);
+        SVector<Scalar, 3> xtilde = FromEigen(data.xtilde.col(vf).head<3>());
+        gu += Ne(ilocal) * mvf * (x - xtilde);
+        Scalar k = mvf;
+        if (bIsDirichlet)
+        {
+            SVector<Scalar, 3> xD = FromEigen(data.X.col(vf).head<3>());
+            gu += Ne(ilocal) * data.muD * (x - xD);
+            k += data.muD;
+        }
+        if (not bAssembleHessian)
+            continue;
+        for (auto b = 0; b < 4; ++b)
+        {
+            SMatrix<Scalar, 3, 3> Hb = Zeros<Scalar, 3, 3>();
+            Diag(Hb) += Ne(ilocal) * Ne(b) * k;
+            AddHessianBlock(level, i, level.mesh.E(b, ec), Hb);
+        }
+    }
+}
+
+/**
+ * @brief Computes the fine elements whose elastic energies this level's gradient and hessian
+ * integrate, i.e. the hyper reduced elements if level is hyper reduced, and all elements otherwise
+ */
+static IndexVectorX ElasticElements(Data const& data, Level const& level)
+{
+    bool const bIsHyperReduced = level.GERptr.size() > 0;
+    std::vector<char> bIsElastic(static_cast<std::size_t>(data.E.cols()), false);
+    if (bIsHyperReduced)
+    {
+        for (Index kg : level.GERadj)
+            bIsElastic[static_cast<std::size_t>(level.GEadj(kg))] = true;
+    }
+    else
+    {
+        for (Index ef : level.GEadj)
+            bIsElastic[static_cast<std::size_t>(ef)] = true;
+    }
+    auto const nElastic = std::count(bIsElastic.begin(), bIsElastic.end(), true);
+    IndexVectorX elements(nElastic);
+    for (Index ef = 0, k = 0; ef < data.E.cols(); ++ef)
+        if (bIsElastic[static_cast<std::size_t>(ef)])
+            elements(k++) = ef;
+    return elements;
+}
+
+/**
+ * @brief Computes this level's energy, i.e. the root level's backward Euler objective (without
+ * damping) at the root positions prolonged by level.u, integrated with the same elements and
+ * quadrature weights as this level's gradient and hessian
+ * @param elements Fine elements computed by ElasticElements
+ */
+static Scalar
+Energy(Data const& data, Level const& level, IndexVectorX const& elements, Scalar dt2)
+{
+    bool const bIsHyperReduced = level.GERptr.size() > 0;
+    auto const nElements       = elements.size();
+    auto const nFineVertices   = data.x.cols();
+    VectorX Ee(nElements);
+    tbb::parallel_for(Index(0), nElements, [&](Index k) {
+        Index const ef       = elements(k);
+        Scalar const wg      = bIsHyperReduced ? level.wgR(ef) : data.wg(ef);
+        Matrix<4, 4> N       = level.NecVE.block<4, 4>(0, 4 * ef);
+        Matrix<3, 4> xe      = data.x(Eigen::placeholders::all, data.E.col(ef));
+        IndexMatrix<4, 4> ec = level.mesh.E(Eigen::placeholders::all, level.ecVE.col(ef));
+        for (auto iflocal = 0; iflocal < 4; ++iflocal)
+            xe.col(iflocal) += level.u(Eigen::placeholders::all, ec.col(iflocal)) * N.col(iflocal);
+        SMatrix<Scalar, 4, 3> GNe = FromEigen(data.GP.block<4, 3>(0, 3 * ef));
+        SMatrix<Scalar, 3, 3> F   = FromEigen(xe) * GNe;
+        VisitElasticEnergy(data.psie[static_cast<std::size_t>(ef)], [&](auto const& Psi) {
+            Ee(k) = dt2 * wg * Psi.eval(F, data.lame(0, ef), data.lame(1, ef));
+        });
+    });
+    VectorX Ev(nFineVertices);
+    tbb::parallel_for(Index(0), nFineVertices, [&](Index vf) {
+        auto uec          = level.u(Eigen::placeholders::all, level.mesh.E.col(level.ecK(vf)));
+        Vector<3> const x = data.x.col(vf) + uec * level.NecK.col(vf);
+        Scalar E          = Scalar(0.5) * data.m(vf) * (x - data.xtilde.col(vf)).squaredNorm();
+        if (level.bIsDirichletVertex(vf))
+            E += Scalar(0.5) * data.muD * (x - data.X.col(vf)).squaredNorm();
+        Ev(vf) = E;
+    });
+    return Ee.sum() + Ev.sum();
+}
+
+} // namespace detail
+
+bool Level::Solve(Scalar dt, Index iters, Data& data)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.Solve");
+    Index const nCoarseVertices = mesh.X.cols();
+    bool const bHasPattern      = GVVptr.size() == nCoarseVertices + 1;
+    if (not bHasPattern)
+    {
+        // Coarse vertices i,j are coupled if they belong to coarse elements containing vertices
+        // of a common fine element, or if they belong to the coarse element containing a fine
+        // vertex.
+        std::vector<std::vector<Index>> GVV(static_cast<std::size_t>(nCoarseVertices));
+        tbb::parallel_for(Index(0), nCoarseVertices, [&](Index i) {
+            auto& Gi = GVV[static_cast<std::size_t>(i)];
+            for (auto kg = GEptr(i); kg < GEptr(i + 1); ++kg)
+                for (auto ec : ecVE.col(GEadj(kg)))
+                    for (auto j : mesh.E.col(ec))
+                        Gi.push_back(j);
+            for (auto kg = GKptr(i); kg < GKptr(i + 1); ++kg)
+                for (auto j : mesh.E.col(ecK(GKadj(kg))))
+                    Gi.push_back(j);
+            std::sort(Gi.begin(), Gi.end());
+            Gi.erase(std::unique(Gi.begin(), Gi.end()), Gi.end());
+        });
+        GVVptr.resize(nCoarseVertices + 1);
+        GVVptr(0) = Index(0);
+        for (Index i = 0; i < nCoarseVertices; ++i)
+            GVVptr(i + 1) = GVVptr(i) + static_cast<Index>(GVV[static_cast<std::size_t>(i)].size());
+        GVVadj.resize(GVVptr(nCoarseVertices));
+        for (Index i = 0; i < nCoarseVertices; ++i)
+        {
+            auto const& Gi = GVV[static_cast<std::size_t>(i)];
+            std::copy(Gi.begin(), Gi.end(), GVVadj.begin() + GVVptr(i));
+        }
+        // Scalar sparsity pattern of HC, where each column stores its coupled vertices' 3 rows
+        // contiguously and in sorted order
+        HC = CSCMatrix(3 * nCoarseVertices, 3 * nCoarseVertices);
+        IndexVectorX nnz(3 * nCoarseVertices);
+        for (Index i = 0; i < nCoarseVertices; ++i)
+            nnz.segment<3>(3 * i).setConstant(3 * (GVVptr(i + 1) - GVVptr(i)));
+        HC.reserve(nnz);
+        for (Index i = 0; i < nCoarseVertices; ++i)
+            for (auto dc = 0; dc < 3; ++dc)
+                for (auto k = GVVptr(i); k < GVVptr(i + 1); ++k)
+                    for (auto dr = 0; dr < 3; ++dr)
+                        HC.insert(3 * GVVadj(k) + dr, 3 * i + dc) = Scalar(0);
+        HC.makeCompressed();
+        LLT = std::make_shared<Factorization>();
+    }
+    // Factorizations from previous calls are reused for a bounded number of calls, after which
+    // HC is refactorized at the current deformation
+    if (bReuseFactorization and LLT->bIsFactorized)
+    {
+        if (nMaxFactorizationReuses >= 0 and LLT->nReuses >= nMaxFactorizationReuses)
+            LLT->bIsFactorized = false;
+        else
+            ++LLT->nReuses;
+    }
+    u.setZero();
+    Scalar const dt2           = dt * dt;
+    bool const bIsHyperReduced = GERptr.size() > 0;
+    VectorX g(3 * nCoarseVertices);
+    // Newton steps are globalized by a backtracking line search on the Armijo condition
+    Scalar constexpr kArmijo            = 1e-4;
+    Scalar constexpr kBacktrack         = 0.5;
+    Index constexpr kMaxLineSearchIters = 20;
+    IndexVectorX const elements         = detail::ElasticElements(data, *this);
+    Scalar E                            = detail::Energy(data, *this, elements, dt2);
+    for (auto iter = 0; iter < iters; ++iter)
+    {
+        // Assemble hessian and gradient, one (race-free) block column per coarse vertex
+        bool const bAssembleHessian = not(bReuseFactorization and LLT->bIsFactorized);
+        if (bAssembleHessian)
+            std::fill(HC.valuePtr(), HC.valuePtr() + HC.nonZeros(), Scalar(0));
+        tbb::parallel_for(Index(0), nCoarseVertices, [&](Index i) {
+            SVector<Scalar, 3> gu = Zeros<Scalar, 3>();
+            if (bIsHyperReduced)
+            {
+                for (auto kr = GERptr(i); kr < GERptr(i + 1); ++kr)
+                {
+                    Index kg = GERadj(kr);
+                    detail::AccumulateElasticHessianAndGradient(
+                        data,
+                        *this,
+                        i,
+                        kg,
+                        wgR(GEadj(kg)),
+                        dt2,
+                        bAssembleHessian,
+                        gu);
+                }
+            }
+            else
+            {
+                for (auto kg = GEptr(i); kg < GEptr(i + 1); ++kg)
+                {
+                    detail::AccumulateElasticHessianAndGradient(
+                        data,
+                        *this,
+                        i,
+                        kg,
+                        data.wg(GEadj(kg)),
+                        dt2,
+                        bAssembleHessian,
+                        gu);
+                }
+            }
+            detail::AccumulateKineticAndDirichletHessianAndGradient(
+                data,
+                *this,
+                i,
+                bAssembleHessian,
+                gu);
+            g.segment<3>(3 * i) = ToEigen(gu);
+        });
+        // Newton step, rejected if the hessian is not positive definite
+        bool const bIsFactorized = bAssembleHessian ? LLT->Compute(HC) : LLT->bIsFactorized;
+        VectorX const du         = bIsFactorized ? VectorX(-LLT->Solve(g)) : VectorX{};
+        bool const bIsDescentDirection =
+            bIsFactorized and du.allFinite() and g.dot(du) < Scalar(0);
+        if (not bIsDescentDirection)
+        {
+            // Reused factorizations are recomputed by the next solve
+            LLT->bIsFactorized = false;
+            u.setZero();
+            return false;
+        }
+        Scalar const gdu = g.dot(du);
+        VectorX const u0 = u.reshaped();
+        Scalar alpha{1};
+        bool bHasSufficientDecrease{false};
+        for (Index ls = 0; ls < kMaxLineSearchIters and not bHasSufficientDecrease; ++ls)
+        {
+            u.reshaped()           = u0 + alpha * du;
+            Scalar const Ealpha    = detail::Energy(data, *this, elements, dt2);
+            bHasSufficientDecrease = Ealpha <= E + kArmijo * alpha * gdu;
+            if (bHasSufficientDecrease)
+                E = Ealpha;
+            else
+                alpha *= kBacktrack;
+        }
+        if (not bHasSufficientDecrease)
+        {
+            u.reshaped() = u0;
+            // A stale reused factorization may have produced a poor direction, such that we retry
+            // with a fresh factorization. Otherwise, u is (numerically) at a minimum.
+            if (not bAssembleHessian)
+            {
+                LLT->bIsFactorized = false;
+                continue;
+            }
+            break;
+        }
+    }
+    Prolong(data);
+    return true;
+}
+
+bool Level::SetDirichletVertices(Data const& data, BoolVector const& bIsDirichlet)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.SetDirichletVertices");
+    if (bIsDirichlet.size() != bIsDirichletVertex.size())
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected Dirichlet vertex mask of size {}, but got {}",
+            bIsDirichletVertex.size(),
+            bIsDirichlet.size()));
+    }
+    // The Dirichlet energy 1/2 muD |x + u N - d(x)|^2 of fine vertex vf contributes
+    // muD (N \otimes I_3)(N \otimes I_3)^T to HC, i.e. 3 rank-1 terms, one per dimension
+    bool const bUpdateFactorization = bReuseFactorization and LLT and LLT->bIsFactorized;
+    Scalar const sqrtMuD            = std::sqrt(data.muD);
+    Index nChanges{0};
+    for (Index vf = 0; vf < bIsDirichlet.size(); ++vf)
+    {
+        if (bIsDirichlet(vf) == bIsDirichletVertex(vf))
+            continue;
+        ++nChanges;
+        if (not bUpdateFactorization)
+            continue;
+        IndexVector<4> const vc = mesh.E.col(ecK(vf));
+        Vector<4> const w       = sqrtMuD * NecK.col(vf).head<4>();
+        for (auto d = 0; d < 3; ++d)
+            LLT->StageUpdate((3 * vc.array() + d).matrix(), w, not bIsDirichlet(vf));
+    }
+    bIsDirichletVertex = bIsDirichlet;
+    if (nChanges == 0)
+        return true;
+    if (not bUpdateFactorization)
+    {
+        if (LLT)
+            LLT->bIsFactorized = false;
+        return false;
+    }
+    return LLT->ApplyStagedUpdates();
+}
+
+void Level::Reduce(Data const& data, HyperReduction const& HR, Index l)
 {
     PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.Reduce");
+    auto const nClusterLevels = static_cast<Index>(HR.C.size());
+    if (l < 0 or l >= nClusterLevels)
+    {
+        throw std::invalid_argument(fmt::format(
+            "Expected clustering level 0 <= l < {}, but got l={}",
+            nClusterLevels,
+            l));
+    }
+    // Compute hyper reduced quadrature weights. Cluster errors accumulate their children's errors,
+    // such that the clusters with acceptable error containing a fine element form a prefix of its
+    // cluster hierarchy, and all fine elements of such a cluster agree on its representative.
+    auto const nFineElements = data.E.cols();
+    wgR.setZero(nFineElements);
+    tbb::parallel_for(Index(0), nFineElements, [&](Index e) {
+        Index c{e}, k{-1}, ck{-1};
+        for (Index j = 0; j <= l; ++j)
+        {
+            auto const jStl = static_cast<std::size_t>(j);
+            c               = HR.C[jStl](c);
+            if (HR.Ep[jStl](c) > HR.EpMax)
+                break;
+            k  = j;
+            ck = c;
+        }
+        if (k < 0)
+        {
+            wgR(e) = data.wg(e);
+            return;
+        }
+        auto const kStl = static_cast<std::size_t>(k);
+        if (HR.eC[kStl](ck) == e)
+            wgR(e) = HR.wC[kStl](ck);
+    });
+    // Coarse vertex -> active fine element adjacency graph
+    Index const nCoarseVertices = mesh.X.cols();
+    IndexVectorX counts(nCoarseVertices);
+    tbb::parallel_for(Index(0), nCoarseVertices, [&](Index i) {
+        Index count{0};
+        for (auto kg = GEptr(i); kg < GEptr(i + 1); ++kg)
+            count += static_cast<Index>(wgR(GEadj(kg)) > Scalar(0));
+        counts(i) = count;
+    });
+    GERptr = common::CumSum(counts);
+    GERadj.resize(GERptr(nCoarseVertices));
+    tbb::parallel_for(Index(0), nCoarseVertices, [&](Index i) {
+        Index kr = GERptr(i);
+        for (auto kg = GEptr(i); kg < GEptr(i + 1); ++kg)
+            if (wgR(GEadj(kg)) > Scalar(0))
+                GERadj(kr++) = kg;
+    });
+}
+
+void Level::Serialize(std::ostream& os) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.Serialize");
+    using common::WriteBinary;
+    WriteBinary(os, mesh.X);
+    WriteBinary(os, mesh.E);
+    WriteBinary(os, u);
+    WriteBinary(os, colors);
+    WriteBinary(os, Pptr);
+    WriteBinary(os, Padj);
+    WriteBinary(os, ecVE);
+    WriteBinary(os, NecVE);
+    WriteBinary(os, ilocalE);
+    WriteBinary(os, GEptr);
+    WriteBinary(os, GEadj);
+    WriteBinary(os, ecK);
+    WriteBinary(os, NecK);
+    WriteBinary(os, GKptr);
+    WriteBinary(os, GKadj);
+    WriteBinary(os, GKilocal);
+    WriteBinary(os, bIsDirichletVertex);
+    WriteBinary(os, GCFptr);
+    WriteBinary(os, GCFadj);
+    WriteBinary(os, GCFrank);
+    WriteBinary(os, GCFparent);
+    WriteBinary(os, wgR);
+    WriteBinary(os, GERptr);
+    WriteBinary(os, GERadj);
+    WriteBinary(os, bReuseFactorization);
+    WriteBinary(os, nMaxFactorizationReuses);
+}
+
+void Level::Deserialize(std::istream& is)
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Level.Deserialize");
+    using common::ReadBinary;
+    ReadBinary(is, mesh.X);
+    ReadBinary(is, mesh.E);
+    ReadBinary(is, u);
+    ReadBinary(is, colors);
+    ReadBinary(is, Pptr);
+    ReadBinary(is, Padj);
+    ReadBinary(is, ecVE);
+    ReadBinary(is, NecVE);
+    ReadBinary(is, ilocalE);
+    ReadBinary(is, GEptr);
+    ReadBinary(is, GEadj);
+    ReadBinary(is, ecK);
+    ReadBinary(is, NecK);
+    ReadBinary(is, GKptr);
+    ReadBinary(is, GKadj);
+    ReadBinary(is, GKilocal);
+    ReadBinary(is, bIsDirichletVertex);
+    ReadBinary(is, GCFptr);
+    ReadBinary(is, GCFadj);
+    ReadBinary(is, GCFrank);
+    ReadBinary(is, GCFparent);
+    ReadBinary(is, wgR);
+    ReadBinary(is, GERptr);
+    ReadBinary(is, GERadj);
+    ReadBinary(is, bReuseFactorization);
+    ReadBinary(is, nMaxFactorizationReuses);
 }
 
 } // namespace multigrid
@@ -267,6 +1051,7 @@ TEST_CASE("[sim][vbd][multigrid] Level")
 {
     using namespace pbat;
     using sim::vbd::Data;
+    using sim::vbd::EElasticEnergy;
     using sim::vbd::VolumeMesh;
     using sim::vbd::multigrid::Level;
 
@@ -289,4 +1074,64 @@ TEST_CASE("[sim][vbd][multigrid] Level")
     CHECK_EQ(level.ilocalE.cols(), level.GEadj.size());
     CHECK_EQ(level.bIsDirichletVertex.size(), VR.cols());
     CHECK_FALSE((level.ecVE.array() < 0).any());
+    // Assembled prolongation agrees with matrix-free prolongation
+    level.u.setRandom();
+    CSCMatrix const P = level.ProlongationMatrix();
+    CHECK_EQ(P.rows(), 3 * VR.cols());
+    CHECK_EQ(P.cols(), 3 * VL.cols());
+    MatrixX const x0 = data.x;
+    level.Prolong(data);
+    MatrixX const dx         = data.x - x0;
+    VectorX const dxExpected = P * level.u.reshaped();
+    CHECK_LE((dx.reshaped() - dxExpected).norm(), 1e-10);
+    // Dirichlet vertex changes update reused factorizations rather than invalidating them
+    data.x                    = x0;
+    data.xtilde               = x0;
+    level.bReuseFactorization = true;
+    Scalar constexpr dt       = 1e-2;
+    CHECK(level.Solve(dt, 2, data));
+    Level::BoolVector bIsDirichlet = level.bIsDirichletVertex;
+    bIsDirichlet(0)                = not bIsDirichlet(0);
+#ifdef PBAT_USE_SUITESPARSE
+    CHECK(level.SetDirichletVertices(data, bIsDirichlet));
+#else
+    CHECK_FALSE(level.SetDirichletVertices(data, bIsDirichlet));
+#endif // PBAT_USE_SUITESPARSE
+    CHECK(level.bIsDirichletVertex == bIsDirichlet);
+    CHECK(level.SetDirichletVertices(data, bIsDirichlet));
+    CHECK(level.Solve(dt, 2, data));
+    // Reused factorizations serve a bounded number of calls
+    level.nMaxFactorizationReuses = 1;
+    for (auto k = 0; k < 3; ++k)
+    {
+        CHECK(level.Solve(dt, 1, data));
+        CHECK_LE(level.LLT->nReuses, level.nMaxFactorizationReuses);
+    }
+    // Direct solves of compressed (i.e. indefinite elastic hessian) states succeed
+    level.bReuseFactorization = false;
+    data.x                    = Scalar(0.5) * data.X;
+    data.xtilde               = data.x;
+    CHECK(level.Solve(Scalar(1), 3, data));
+    CHECK(data.x.allFinite());
+    // Coarse levels integrate each fine element's own elastic energy model
+    for (auto ePsi : {EElasticEnergy::Corotational, EElasticEnergy::AsRigidAsPossible})
+    {
+        Data cdata =
+            Data()
+                .WithVolumeMesh(VR, CR)
+                .WithElasticEnergy(
+                    std::vector<EElasticEnergy>(static_cast<std::size_t>(CR.cols()), ePsi))
+                .Construct();
+        Level clevel(cdata, VolumeMesh(VL, CL));
+        cdata.x         = Scalar(0.5) * cdata.X;
+        cdata.xtilde    = cdata.X;
+        IndexVectorX const elements = sim::vbd::multigrid::detail::ElasticElements(cdata, clevel);
+        CHECK_EQ(elements.size(), cdata.E.cols());
+        Scalar const E0 = sim::vbd::multigrid::detail::Energy(cdata, clevel, elements, dt * dt);
+        CHECK(clevel.Solve(dt, 3, cdata));
+        clevel.u.setZero();
+        CHECK_LT(sim::vbd::multigrid::detail::Energy(cdata, clevel, elements, dt * dt), E0);
+        clevel.Smooth(dt, 2, cdata);
+        CHECK(cdata.x.allFinite());
+    }
 }
\ No newline at end of file
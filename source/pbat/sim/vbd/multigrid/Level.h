@@ -6,6 +6,10 @@
 #include "pbat/sim/vbd/Data.h"
 #include "pbat/sim/vbd/Mesh.h"
 
+#include <istream>
+#include <memory>
+#include <ostream>
+
 namespace pbat {
 namespace sim {
 namespace vbd {
@@ -13,17 +17,50 @@ namespace multigrid {
 
 struct Level
 {
+    using BoolVector = Eigen::Vector<bool, Eigen::Dynamic>;
+
+    /**
+     * @brief Construct an empty level, i.e. to be filled by Deserialize
+     */
+    Level() = default;
     /**
      * @brief
      * @param data
      * @param mesh
      */
     Level(Data const& data, VolumeMesh mesh);
+    /**
+     * @brief Copy a level, except for its factorization of HC
+     *
+     * Factorizations hold mutable (reused and updated) factor state, such that copies do not share
+     * it. A copy of a level with a factorization refactorizes HC on its next Solve.
+     *
+     * @param other Level to copy
+     */
+    Level(Level const& other);
+    Level(Level&&) noexcept = default;
+    /**
+     * @brief Copy a level, except for its factorization of HC. See Level(Level const&).
+     * @param other Level to copy
+     * @return This level
+     */
+    Level& operator=(Level const& other);
+    Level& operator=(Level&&) noexcept = default;
     /**
      * @brief
      * @param data
      */
     void Prolong(Data& data) const;
+    /**
+     * @brief Assemble the linear map from this level's coarse displacements to root displacements
+     *
+     * Vertex-major coordinates are used on both sides, i.e. `P * u.reshaped()` equals the
+     * displacement applied to the root's `data.x` by Prolong(). The matrix can be used to build
+     * algebraic (Galerkin) coarse operators, e.g. for math::linalg::MultigridPreconditioner.
+     *
+     * @return `3|#fine verts| x 3|#cage verts|` prolongation matrix
+     */
+    CSCMatrix ProlongationMatrix() const;
     /**
      * @brief
      * @param dt
@@ -32,11 +69,67 @@ struct Level
      */
     void Smooth(Scalar dt, Index iters, Data& data);
     /**
-     * @brief 
-     * 
-     * @param data 
+     * @brief Minimize this level's energy w.r.t. u with Newton's method, using sparse direct
+     * solves with the assembled hessian HC, then prolong u to the root level
+     *
+     * Elastic energy hessians are projected to SPD per quadrature point (see
+     * physics::SpdHessian), such that HC is SPD even under compression. Newton steps are
+     * globalized by a backtracking line search, and iterations stop early once no step decreases
+     * the energy sufficiently.
+     *
+     * HC's sparsity pattern and symbolic factorization are computed on the first call and reused
+     * by subsequent calls. If bReuseFactorization is set, HC is only assembled and factorized when
+     * no valid factorization exists, and subsequent Newton iterations and calls reuse it, i.e.
+     * Newton's method becomes a modified Newton method. A factorization is reused by at most
+     * nMaxFactorizationReuses subsequent calls, and is discarded early if its Newton step fails
+     * the line search.
+     *
+     * @param dt Time step
+     * @param iters Number of Newton iterations
+     * @param data Root level problem
+     * @return true if every Newton iteration's linear system could be solved. Otherwise, data is
+     * left untouched.
+     */
+    bool Solve(Scalar dt, Index iters, Data& data);
+    /**
+     * @brief Pin or release fine vertices, i.e. add or remove their Dirichlet energy
+     *
+     * The Dirichlet energy of a fine vertex contributes a rank 3 term to HC. If a reusable
+     * factorization of HC exists (see bReuseFactorization), the contributions of all pinned and
+     * released vertices are applied to it as one batched low-rank update and downdate, rather than
+     * refactorizing HC. The factorization is otherwise invalidated. Only this level changes, see
+     * Hierarchy::SetDirichletVertices to change the root problem and all levels together.
+     *
+     * @param data Root level problem
+     * @param bIsDirichlet |#fine verts| Dirichlet vertex mask
+     * @return true if HC's factorization remains valid, i.e. it was updated or no vertex changed
+     */
+    bool SetDirichletVertices(Data const& data, BoolVector const& bIsDirichlet);
+    /**
+     * @brief Hyper reduce this level's elastic energy
+     *
+     * Each fine element is assigned to the coarsest cluster, up to clustering level l, whose
+     * linear polynomial error does not exceed HR.EpMax. Only that cluster's representative element
+     * is then integrated, with the cluster's quadrature weight. Fine elements whose finest cluster
+     * exceeds the error threshold are integrated exactly.
+     *
+     * @param data Root level problem
+     * @param HR Hyper reduction of the hierarchy this level belongs to
+     * @param l Clustering level of HR to use for this level
+     * @pre HR.ComputeLinearPolynomialErrors has been called
+     */
+    void Reduce(Data const& data, HyperReduction const& HR, Index l);
+    /**
+     * @brief Write this level's coarse mesh, embedding structures and hyper reduction to a binary
+     * stream
+     * @param os Output binary stream
+     */
+    void Serialize(std::ostream& os) const;
+    /**
+     * @brief Read a level written by Serialize from a binary stream
+     * @param is Input binary stream
      */
-    void Reduce(Data const& data);
+    void Deserialize(std::istream& is);
 
     /**
      * Coarse mesh discretization
@@ -46,8 +139,6 @@ struct Level
     IndexVectorX colors;     ///< Coarse vertex graph coloring
     IndexVectorX Pptr, Padj; ///< Parallel vertex partitions
 
-    using BoolVector = Eigen::Vector<bool, Eigen::Dynamic>;
-
     /**
      * Elastic energy
      */
@@ -74,7 +165,29 @@ struct Level
      * Energy hyper reduction
      */
     IndexVectorX GCFptr, GCFadj, GCFrank, GCFparent; ///< Coarse element -> fine element adjacency graph
-    // HyperReduction HR; ///< Energy hyper reduction scheme
+    VectorX wgR; ///< |#fine elems| hyper reduced quadrature weights, 0 for inactive fine elements
+    IndexVectorX GERptr, GERadj; ///< Coarse vertex -> active fine element adjacency graph, where
+                                 ///< GERadj stores edge indices into GEadj. Empty if this level is
+                                 ///< not hyper reduced.
+
+    /**
+     * Direct solver
+     */
+    struct Factorization;
+    IndexVectorX GVVptr, GVVadj; ///< Coarse vertex -> coupled coarse vertex adjacency graph, i.e.
+                                 ///< the block sparsity pattern of HC. Computed by Solve.
+    CSCMatrix HC; ///< 3|#cage verts|x3|#cage verts| hessian of this level's energy w.r.t. u
+    std::shared_ptr<Factorization> LLT; ///< Sparse Cholesky factorization of HC, whose symbolic
+                                        ///< analysis is reused across solves. Owned by this level,
+                                        ///< i.e. never shared by copies.
+    bool bReuseFactorization{false}; ///< Solve reuses HC's numerical factorization across Newton
+                                     ///< iterations and calls, and Dirichlet vertex changes
+                                     ///< update it. See SetDirichletVertices.
+    Index nMaxFactorizationReuses{4}; ///< Maximum number of Solve calls, e.g. time steps, after
+                                      ///< the factorizing one that may reuse a factorization if
+                                      ///< bReuseFactorization is set. Bounds how far the reused
+                                      ///< elastic hessian lags behind the deformation. Negative
+                                      ///< values reuse factorizations indefinitely.
 };
 
 } // namespace multigrid
@@ -1,9 +1,10 @@
 #ifndef PBAT_SIM_VBD_MULTIGRID_MULTIGRID_H
 #define PBAT_SIM_VBD_MULTIGRID_MULTIGRID_H
 
+#include "Cages.h"
+#include "Cycles.h"
 #include "Hierarchy.h"
 #include "Integrator.h"
-#include "Kernels.h"
 #include "Level.h"
 #include "Prolongation.h"
 #include "Quadrature.h"
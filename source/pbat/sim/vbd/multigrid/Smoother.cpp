@@ -1,11 +1,11 @@
 #include "Smoother.h"
 
 #include "pbat/math/linalg/mini/Mini.h"
-#include "pbat/physics/StableNeoHookeanEnergy.h"
 #include "pbat/profiling/Profiling.h"
 #include "pbat/sim/vbd/Data.h"
 #include "pbat/sim/vbd/Kernels.h"
 
+#include <cmath>
 #include <tbb/parallel_for.h>
 
 namespace pbat {
@@ -13,13 +13,140 @@ namespace sim {
 namespace vbd {
 namespace multigrid {
 
-void Smoother::Apply(Index iters, Scalar dt, Data& data) const
+static void AccumulateVertexDerivatives(
+    Index i,
+    Scalar dt,
+    Scalar dt2,
+    Data const& data,
+    math::linalg::mini::SVector<Scalar, 3> const& xi,
+    math::linalg::mini::SMatrix<Scalar, 3, 3>& Hi,
+    math::linalg::mini::SVector<Scalar, 3>& gi)
+{
+    using namespace math::linalg;
+    using mini::FromEigen;
+    using namespace pbat::sim::vbd::kernels;
+
+    Index begin = data.GVGp(i);
+    Index end   = data.GVGp(i + 1);
+    // Elastic energy
+    for (auto n = begin; n < end; ++n)
+    {
+        auto ilocal                     = data.GVGilocal(n);
+        auto e                          = data.GVGe(n);
+        auto lamee                      = data.lame.col(e);
+        auto wg                         = data.wg(e);
+        auto Te                         = data.E.col(e);
+        mini::SMatrix<Scalar, 4, 3> GPe = FromEigen(data.GP.block<4, 3>(0, e * 3));
+        mini::SMatrix<Scalar, 3, 4> xe =
+            FromEigen(data.x(Eigen::placeholders::all, Te).block<3, 4>(0, 0));
+        mini::SMatrix<Scalar, 3, 3> Fe = xe * GPe;
+        AccumulateElasticDerivatives(
+            data.psie[static_cast<std::size_t>(e)],
+            ilocal,
+            wg,
+            GPe,
+            Fe,
+            lamee(0),
+            lamee(1),
+            gi,
+            Hi);
+    }
+    // Damping and inertia
+    Scalar m                         = data.m(i);
+    mini::SVector<Scalar, 3> xti     = FromEigen(data.xt.col(i).head<3>());
+    mini::SVector<Scalar, 3> xtildei = FromEigen(data.xtilde.col(i).head<3>());
+    AddDamping(dt, xti, xi, data.kD, gi, Hi);
+    AddInertiaDerivatives(dt2, m, xtildei, xi, gi, Hi);
+}
+
+static void AccumulateVertexGradient(
+    Index i,
+    Scalar dt,
+    Scalar dt2,
+    Data const& data,
+    math::linalg::mini::SVector<Scalar, 3> const& xi,
+    math::linalg::mini::SVector<Scalar, 3>& gi)
+{
+    using namespace math::linalg;
+    using mini::FromEigen;
+    using namespace pbat::sim::vbd::kernels;
+
+    // Rayleigh damping's gradient depends on the elastic hessian
+    bool const bHasDamping = data.kD > Scalar(0);
+    if (bHasDamping)
+    {
+        mini::SMatrix<Scalar, 3, 3> Hi = mini::Zeros<Scalar, 3, 3>();
+        AccumulateVertexDerivatives(i, dt, dt2, data, xi, Hi, gi);
+        return;
+    }
+    Index begin = data.GVGp(i);
+    Index end   = data.GVGp(i + 1);
+    // Elastic energy
+    for (auto n = begin; n < end; ++n)
+    {
+        auto ilocal                     = data.GVGilocal(n);
+        auto e                          = data.GVGe(n);
+        auto lamee                      = data.lame.col(e);
+        auto wg                         = data.wg(e);
+        auto Te                         = data.E.col(e);
+        mini::SMatrix<Scalar, 4, 3> GPe = FromEigen(data.GP.block<4, 3>(0, e * 3));
+        mini::SMatrix<Scalar, 3, 4> xe =
+            FromEigen(data.x(Eigen::placeholders::all, Te).block<3, 4>(0, 0));
+        mini::SMatrix<Scalar, 3, 3> Fe = xe * GPe;
+        AccumulateElasticGradient(
+            data.psie[static_cast<std::size_t>(e)],
+            ilocal,
+            wg,
+            GPe,
+            Fe,
+            lamee(0),
+            lamee(1),
+            gi);
+    }
+    // Inertia
+    mini::SVector<Scalar, 3> xtildei = FromEigen(data.xtilde.col(i).head<3>());
+    gi += (data.m(i) / dt2) * (xi - xtildei);
+}
+
+static void SmoothVertex(Index i, Scalar dt, Scalar dt2, Data& data)
 {
-    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Smoother.Apply");
-    Scalar const dt2 = dt * dt;
     using namespace math::linalg;
     using mini::FromEigen;
     using mini::ToEigen;
+    using pbat::sim::vbd::kernels::IntegratePositions;
+
+    mini::SMatrix<Scalar, 3, 3> Hi = mini::Zeros<Scalar, 3, 3>();
+    mini::SVector<Scalar, 3> gi    = mini::Zeros<Scalar, 3, 1>();
+    mini::SVector<Scalar, 3> xi    = FromEigen(data.x.col(i).head<3>());
+    AccumulateVertexDerivatives(i, dt, dt2, data, xi, Hi, gi);
+    IntegratePositions(gi, Hi, xi, data.detHZero);
+    data.x.col(i) = ToEigen(xi);
+}
+
+Scalar Smoother::Residual(Scalar dt, Data const& data) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Smoother.Residual");
+    using namespace math::linalg;
+    using mini::FromEigen;
+    Scalar const dt2 = dt * dt;
+    // Dirichlet vertices are excluded from the parallel vertex partitions, i.e. the smoother
+    // never reduces their gradient, such that only free vertices contribute to the residual
+    auto const nFreeVertices = data.Padj.size();
+    VectorX r2(nFreeVertices);
+    tbb::parallel_for(Index(0), nFreeVertices, [&](Index k) {
+        Index const i               = data.Padj(k);
+        mini::SVector<Scalar, 3> gi = mini::Zeros<Scalar, 3, 1>();
+        mini::SVector<Scalar, 3> xi = FromEigen(data.x.col(i).head<3>());
+        AccumulateVertexGradient(i, dt, dt2, data, xi, gi);
+        r2(k) = mini::SquaredNorm(gi);
+    });
+    return std::sqrt(r2.sum());
+}
+
+void Smoother::Apply(Index iters, Scalar dt, Data& data) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Smoother.Apply");
+    Scalar const dt2 = dt * dt;
     // Minimize Backward Euler, i.e. BDF1, objective
     for (auto k = 0; k < iters; ++k)
     {
@@ -29,44 +156,34 @@ void Smoother::Apply(Index iters, Scalar dt, Data& data) const
             Index const pBegin = data.Pptr(p);
             Index const pEnd   = data.Pptr(p + 1);
             tbb::parallel_for(pBegin, pEnd, [&](Index k) {
-                using namespace math::linalg;
-                using mini::FromEigen;
-                using mini::ToEigen;
-                using namespace pbat::sim::vbd::kernels;
+                Index i = data.Padj(k);
+                SmoothVertex(i, dt, dt2, data);
+            });
+        }
+    }
+}
 
-                Index i     = data.Padj(k);
-                Index begin = data.GVGp(i);
-                Index end   = data.GVGp(i + 1);
-                // Elastic energy
-                mini::SMatrix<Scalar, 3, 3> Hi = mini::Zeros<Scalar, 3, 3>();
-                mini::SVector<Scalar, 3> gi    = mini::Zeros<Scalar, 3, 1>();
-                for (auto n = begin; n < end; ++n)
-                {
-                    auto ilocal                     = data.GVGilocal(n);
-                    auto e                          = data.GVGe(n);
-                    auto lamee                      = data.lame.col(e);
-                    auto wg                         = data.wg(e);
-                    auto Te                         = data.E.col(e);
-                    mini::SMatrix<Scalar, 4, 3> GPe = FromEigen(data.GP.block<4, 3>(0, e * 3));
-                    mini::SMatrix<Scalar, 3, 4> xe =
-                        FromEigen(data.x(Eigen::placeholders::all, Te).block<3, 4>(0, 0));
-                    mini::SMatrix<Scalar, 3, 3> Fe = xe * GPe;
-                    physics::StableNeoHookeanEnergy<3> Psi{};
-                    mini::SVector<Scalar, 9> gF;
-                    mini::SMatrix<Scalar, 9, 9> HF;
-                    Psi.gradAndHessian(Fe, lamee(0), lamee(1), gF, HF);
-                    AccumulateElasticHessian(ilocal, wg, GPe, HF, Hi);
-                    AccumulateElasticGradient(ilocal, wg, GPe, gF, gi);
-                }
-                // Update vertex position
-                Scalar m                         = data.m(i);
-                mini::SVector<Scalar, 3> xti     = FromEigen(data.xt.col(i).head<3>());
-                mini::SVector<Scalar, 3> xtildei = FromEigen(data.xtilde.col(i).head<3>());
-                mini::SVector<Scalar, 3> xi      = FromEigen(data.x.col(i).head<3>());
-                AddDamping(dt, xti, xi, data.kD, gi, Hi);
-                AddInertiaDerivatives(dt2, m, xtildei, xi, gi, Hi);
-                IntegratePositions(gi, Hi, xi, data.detHZero);
-                data.x.col(i) = ToEigen(xi);
+void Smoother::Apply(
+    Index iters,
+    Scalar dt,
+    Data& data,
+    IndexVectorX const& Aptr,
+    IndexVectorX const& Aadj) const
+{
+    PBAT_PROFILE_NAMED_SCOPE("pbat.sim.vbd.multigrid.Smoother.ApplyPrioritized");
+    Scalar const dt2 = dt * dt;
+    // Minimize Backward Euler, i.e. BDF1, objective over active vertices
+    for (auto k = 0; k < iters; ++k)
+    {
+        auto const nPartitions = Aptr.size() - 1;
+        for (Index p = 0; p < nPartitions; ++p)
+        {
+            Index const pBegin  = Aptr(p);
+            Index const nActive = Aptr(p + 1) - pBegin;
+            Index const nVisits = (nActive * (iters - k) + iters - 1) / iters;
+            tbb::parallel_for(pBegin, pBegin + nVisits, [&](Index ka) {
+                Index i = Aadj(ka);
+                SmoothVertex(i, dt, dt2, data);
             });
         }
     }
@@ -13,7 +13,42 @@ namespace multigrid {
 
 struct Smoother
 {
+    /**
+     * @brief Minimize the root level's backward Euler objective with iters sweeps of parallel
+     * vertex block coordinate descent over all vertices
+     * @param iters Number of sweeps
+     * @param dt Time step
+     * @param root Root level problem
+     */
     void Apply(Index iters, Scalar dt, Data& root) const;
+    /**
+     * @brief Minimize the root level's backward Euler objective with iters sweeps of parallel
+     * vertex block coordinate descent over active vertices only
+     *
+     * Sweep k visits the leading ceil(n_p (iters - k) / iters) vertices of each partition p's n_p
+     * active vertices, such that the iteration budget is spent on the most active vertices.
+     * Inactive vertices retain their current positions.
+     *
+     * @param iters Number of sweeps
+     * @param dt Time step
+     * @param root Root level problem
+     * @param Aptr |#partitions+1| pointers into Aadj
+     * @param Aadj Active vertices of each parallel vertex partition, sorted by decreasing activity
+     */
+    void Apply(
+        Index iters,
+        Scalar dt,
+        Data& root,
+        IndexVectorX const& Aptr,
+        IndexVectorX const& Aadj) const;
+    /**
+     * @brief Computes the norm of the root level's backward Euler objective's gradient w.r.t.
+     * its free, i.e. non-Dirichlet, vertices
+     * @param dt Time step
+     * @param root Root level problem
+     * @return Residual norm
+     */
+    Scalar Residual(Scalar dt, Data const& root) const;
 };
 
 } // namespace multigrid
@@ -3,6 +3,7 @@
 #include "pbat/physics/HyperElasticity.h"
 
 #include <Eigen/LU>
+#include <algorithm>
 #include <exception>
 #include <fmt/format.h>
 #include <string>
@@ -112,6 +113,12 @@ Data& Data::WithClusterPartitions(
     return *this;
 }
 
+Data& Data::WithElasticConstraints(std::vector<EConstraint> const& ETin)
+{
+    this->ET = ETin;
+    return *this;
+}
+
 Data& Data::WithDirichletConstrainedVertices(IndexVectorX const& dbcIn)
 {
     this->dbc = dbcIn;
@@ -151,9 +158,15 @@ Data& Data::Construct(bool bValidate)
         lame.row(0).setConstant(lmu);
         lame.row(1).setConstant(llambda);
     }
+    if (ET.empty())
+    {
+        ET.assign(static_cast<std::size_t>(T.cols()), EConstraint::StableNeoHookean);
+    }
     DmInv.resize(3, 3 * T.cols());
-    auto snhConstraintId = static_cast<std::size_t>(EConstraint::StableNeoHookean);
+    auto snhConstraintId   = static_cast<std::size_t>(EConstraint::StableNeoHookean);
+    auto corotConstraintId = static_cast<std::size_t>(EConstraint::Corotational);
     alpha[snhConstraintId].resize(2 * T.cols());
+    alpha[corotConstraintId].resize(2 * T.cols());
     gammaSNH.resize(T.cols());
     tbb::parallel_for(Index(0), T.cols(), [&](Index t) {
         // Load vertex positions of element c
@@ -168,6 +181,10 @@ Data& Data::Construct(bool bValidate)
         auto alphat            = alpha[snhConstraintId].segment<2>(2 * t);
         auto lamet             = lame.col(t).segment<2>(0);
         alphat                 = Scalar(1) / (lamet * tetVolume).array();
+        // Corotational energy mu |F-R|^2 + lambda/2 (tr(R^T F) - 3)^2 has stiffnesses 2 mu, lambda
+        auto alphaCorott = alpha[corotConstraintId].segment<2>(2 * t);
+        alphaCorott(0)   = Scalar(1) / (Scalar(2) * lamet(0) * tetVolume);
+        alphaCorott(1)   = Scalar(1) / (lamet(1) * tetVolume);
         // Compute rest stability
         gammaSNH(t) = Scalar(1) + lamet(0) / lamet(1);
     });
@@ -176,6 +193,11 @@ Data& Data::Construct(bool bValidate)
         beta[snhConstraintId].setZero(2 * T.cols());
     }
     lambda[snhConstraintId].setZero(2 * T.cols());
+    if (beta[corotConstraintId].size() == 0)
+    {
+        beta[corotConstraintId].setZero(2 * T.cols());
+    }
+    lambda[corotConstraintId].setZero(2 * T.cols());
     // Set contact data
     auto collisionConstraintId = static_cast<std::size_t>(EConstraint::Collision);
     if (alpha[collisionConstraintId].size() == 0)
@@ -228,6 +250,19 @@ Data& Data::Construct(bool bValidate)
                 T.cols() * 3);
             throw std::invalid_argument(what);
         }
+        bool const bElasticConstraintsValid =
+            ET.size() == static_cast<std::size_t>(T.cols()) and
+            std::all_of(ET.begin(), ET.end(), [](EConstraint eConstraint) {
+                return eConstraint == EConstraint::StableNeoHookean or
+                       eConstraint == EConstraint::Corotational;
+            });
+        if (not bElasticConstraintsValid)
+        {
+            std::string const what = fmt::format(
+                "Expected ET.size()={0} with StableNeoHookean or Corotational constraint types",
+                T.cols());
+            throw std::invalid_argument(what);
+        }
         bool const bMultibodyContactSystemValid = BV.size() == x.cols() and muV.size() == V.size();
         if (not bMultibodyContactSystemValid)
         {
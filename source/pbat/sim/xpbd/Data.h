@@ -6,6 +6,7 @@
 #include "pbat/Aliases.h"
 
 #include <array>
+#include <vector>
 
 namespace pbat {
 namespace sim {
@@ -29,6 +30,14 @@ PBAT_API struct Data
     Data& WithActiveSetUpdateFrequency(Index frequency);
     Data& WithDamping(Eigen::Ref<VectorX> const& beta, EConstraint constraint);
     Data& WithCompliance(Eigen::Ref<VectorX> const& alpha, EConstraint constraint);
+    /**
+     * @brief Per-tetrahedron elastic constraint types, i.e. EConstraint::StableNeoHookean or
+     * EConstraint::Corotational, where corotational constraints are a cheaper material level of
+     * detail
+     * @param ET |#elements| elastic constraint types
+     * @return
+     */
+    Data& WithElasticConstraints(std::vector<EConstraint> const& ET);
     Data& WithPartitions(std::vector<Index> const& Pptr, std::vector<Index> const& Padj);
     /**
      * @brief
@@ -68,6 +77,7 @@ PBAT_API struct Data
     MatrixX lame;     ///< 2x|#quad.pts.| Lame coefficients
     MatrixX DmInv;    ///< 3x3x|#elements| array of material shape matrix inverses
     VectorX gammaSNH; ///< 1. + mu/lambda, where mu,lambda are Lame coefficients
+    std::vector<EConstraint> ET; ///< |#elements| elastic constraint type of each tetrahedron
 
     VectorX muV;                        ///< |#collision vertices| array of collision penalties
     Scalar muS{0.3};                    ///< Static friction coefficient
@@ -78,14 +88,17 @@ PBAT_API struct Data
         alpha; ///< Compliance
                ///< alpha[0] -> Stable Neo-Hookean constraint compliance
                ///< alpha[1] -> Collision penalty constraint compliance
+               ///< alpha[2] -> Corotational constraint compliance
     std::array<VectorX, static_cast<int>(EConstraint::NumberOfConstraintTypes)>
         beta; ///< Damping
               ///< beta[0] -> Stable Neo-Hookean constraint damping
               ///< beta[1] -> Collision penalty constraint damping
+              ///< beta[2] -> Corotational constraint damping
     std::array<VectorX, static_cast<int>(EConstraint::NumberOfConstraintTypes)>
         lambda; ///< "Lagrange" multipliers:
                 ///< lambda[0] -> Stable Neo-Hookean constraint multipliers
                 ///< lambda[1] -> Collision penalty constraint multipliers
+                ///< lambda[2] -> Corotational constraint multipliers
 
     IndexVectorX dbc; ///< Dirichlet constrained vertices
 
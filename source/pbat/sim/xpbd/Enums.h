@@ -5,7 +5,12 @@ namespace pbat {
 namespace sim {
 namespace xpbd {
 
-enum class EConstraint : int { StableNeoHookean = 0, Collision, NumberOfConstraintTypes };
+enum class EConstraint : int {
+    StableNeoHookean = 0,
+    Collision,
+    Corotational,
+    NumberOfConstraintTypes
+};
 
 } // namespace xpbd
 } // namespace sim
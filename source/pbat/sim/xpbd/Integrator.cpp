@@ -208,14 +208,16 @@ void Integrator::ProjectBlockNeoHookeanConstraint(Index c, Scalar dt, Scalar dt2
     using namespace math::linalg;
     using mini::FromEigen;
     using mini::ToEigen;
-    auto const& alphaSNH = data.alpha[static_cast<int>(EConstraint::StableNeoHookean)];
-    auto const& betaSNH  = data.beta[static_cast<int>(EConstraint::StableNeoHookean)];
-    auto& lambdaSNH      = data.lambda[static_cast<int>(EConstraint::StableNeoHookean)];
+    // Elements may use corotational constraints as a cheaper material level of detail
+    EConstraint const eConstraint = data.ET[static_cast<std::size_t>(c)];
+    auto const& alphaE            = data.alpha[static_cast<int>(eConstraint)];
+    auto const& betaE             = data.beta[static_cast<int>(eConstraint)];
+    auto& lambdaE                 = data.lambda[static_cast<int>(eConstraint)];
     // Gather constraint data
     auto vinds                       = data.T.col(c);
     mini::SVector<Scalar, 4> minvc   = FromEigen(data.minv(vinds).head<4>());
-    mini::SVector<Scalar, 2> atildec = FromEigen(alphaSNH.segment<2>(2 * c)) / dt2;
-    mini::SVector<Scalar, 2> betac   = FromEigen(betaSNH.segment<2>(2 * c));
+    mini::SVector<Scalar, 2> atildec = FromEigen(alphaE.segment<2>(2 * c)) / dt2;
+    mini::SVector<Scalar, 2> betac   = FromEigen(betaE.segment<2>(2 * c));
     mini::SVector<Scalar, 2> gammac{atildec(0) * betac(0) * dt, atildec(1) * betac(1) * dt};
     Scalar gammaSNHc                   = data.gammaSNH(c);
     mini::SMatrix<Scalar, 3, 3> DmInvc = FromEigen(data.DmInv.block<3, 3>(0, 3 * c));
@@ -223,11 +225,22 @@ void Integrator::ProjectBlockNeoHookeanConstraint(Index c, Scalar dt, Scalar dt2
         FromEigen(data.xt(Eigen::placeholders::all, vinds).block<3, 4>(0, 0));
     mini::SMatrix<Scalar, 3, 4> xc =
         FromEigen(data.x(Eigen::placeholders::all, vinds).block<3, 4>(0, 0));
-    mini::SVector<Scalar, 2> lambdac = FromEigen(lambdaSNH.segment<2>(2 * c));
+    mini::SVector<Scalar, 2> lambdac = FromEigen(lambdaE.segment<2>(2 * c));
     // Project constraints
-    kernels::ProjectBlockNeoHookean(minvc, DmInvc, gammaSNHc, atildec, gammac, xtc, lambdac, xc);
+    if (eConstraint == EConstraint::Corotational)
+        kernels::ProjectBlockCorotational(minvc, DmInvc, atildec, gammac, xtc, lambdac, xc);
+    else
+        kernels::ProjectBlockNeoHookean(
+            minvc,
+            DmInvc,
+            gammaSNHc,
+            atildec,
+            gammac,
+            xtc,
+            lambdac,
+            xc);
     // Update solution
-    lambdaSNH.segment<2>(2 * c)             = ToEigen(lambdac);
+    lambdaE.segment<2>(2 * c)             = ToEigen(lambdac);
     data.x(Eigen::placeholders::all, vinds) = ToEigen(xc);
 }
 
@@ -269,19 +282,25 @@ TEST_CASE("[sim][xpbd] Integrator")
 
     // Act
     using pbat::common::ToEigen;
+    using pbat::sim::xpbd::EConstraint;
     using pbat::sim::xpbd::Integrator;
-    Integrator xpbd{pbat::sim::xpbd::Data()
-                        .WithVolumeMesh(P, T)
-                        .WithSurfaceMesh(V, F)
-                        .WithPartitions(Pptr, Padj)
-                        .Construct()};
-    xpbd.Step(dt, iterations, substeps);
+    for (auto eConstraint : {EConstraint::StableNeoHookean, EConstraint::Corotational})
+    {
+        std::vector<EConstraint> const ET(static_cast<std::size_t>(T.cols()), eConstraint);
+        Integrator xpbd{pbat::sim::xpbd::Data()
+                            .WithVolumeMesh(P, T)
+                            .WithSurfaceMesh(V, F)
+                            .WithPartitions(Pptr, Padj)
+                            .WithElasticConstraints(ET)
+                            .Construct()};
+        xpbd.Step(dt, iterations, substeps);
 
-    // Assert
-    auto constexpr zero                  = ScalarType(1e-4);
-    pbat::MatrixX dx                     = xpbd.data.x - P;
-    bool const bVerticesFallUnderGravity = (dx.row(2).array() < ScalarType(0)).all();
-    CHECK(bVerticesFallUnderGravity);
-    bool const bVerticesOnlyFall = (dx.topRows(2).array().abs() < zero).all();
-    CHECK(bVerticesOnlyFall);
+        // Assert
+        auto constexpr zero                  = ScalarType(1e-4);
+        pbat::MatrixX dx                     = xpbd.data.x - P;
+        bool const bVerticesFallUnderGravity = (dx.row(2).array() < ScalarType(0)).all();
+        CHECK(bVerticesFallUnderGravity);
+        bool const bVerticesOnlyFall = (dx.topRows(2).array().abs() < zero).all();
+        CHECK(bVerticesOnlyFall);
+    }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "pbat/geometry/ClosestPointQueries.h"
 #include "pbat/geometry/IntersectionQueries.h"
 #include "pbat/math/linalg/mini/Mini.h"
+#include "pbat/physics/CorotationalEnergy.h"
 
 #include <algorithm>
 
@@ -43,6 +44,81 @@ PBAT_HOST_DEVICE mini::SVector<ScalarType, TMatrixXT::kRows> InitialPosition(
     return xt + dt * vt + dt2 * aext;
 }
 
+/**
+ * @brief Project a coupled pair of tetrahedron constraints as a 2x2 block system
+ *
+ * @tparam TMatrixMinv
+ * @tparam TMatrixGradC
+ * @tparam TMatrixAlphaT
+ * @tparam TMatrixGamma
+ * @tparam TMatrixXTC
+ * @tparam TMatrixL
+ * @tparam TMatrixXC
+ * @tparam ScalarType
+ *
+ * @param minvc 4x1 vector of tetrahedron particle inverse masses
+ * @param CD First constraint value
+ * @param gradCD 3x4 gradient of the first constraint
+ * @param CH Second constraint value
+ * @param gradCH 3x4 gradient of the second constraint
+ * @param atildec 2x1 compliances
+ * @param gammac 2x1 XPBD damping terms
+ * @param xtc 3x4 tetrahedron particle positions at time t
+ * @param lambdac 2x1 vector of XPBD Lagrange multipliers
+ * @param xc 3x4 current tetrahedron particle positions
+ */
+template <
+    mini::CMatrix TMatrixMinv,
+    mini::CMatrix TMatrixGradC,
+    mini::CMatrix TMatrixAlphaT,
+    mini::CMatrix TMatrixGamma,
+    mini::CMatrix TMatrixXTC,
+    mini::CMatrix TMatrixL,
+    mini::CMatrix TMatrixXC,
+    class ScalarType = typename TMatrixMinv::ScalarType>
+PBAT_HOST_DEVICE void ProjectCoupledConstraints(
+    TMatrixMinv const& minvc,
+    ScalarType CD,
+    TMatrixGradC const& gradCD,
+    ScalarType CH,
+    TMatrixGradC const& gradCH,
+    TMatrixAlphaT atildec,
+    TMatrixGamma gammac,
+    TMatrixXTC const& xtc,
+    TMatrixL& lambdac,
+    TMatrixXC& xc)
+{
+    using namespace mini;
+    // Construct 2x2 constraint block system
+    SVector<ScalarType, 2> b{
+        -(CD + atildec(0) * lambdac(0) + gammac(0) * Dot(gradCD, xc - xtc)),
+        -(CH + atildec(1) * lambdac(1) + gammac(1) * Dot(gradCH, xc - xtc))};
+    SVector<ScalarType, 2> D = Ones<ScalarType, 2, 1>() + gammac;
+    SMatrix<ScalarType, 2, 2> A{};
+    A(0, 0) =
+        D(0) * (minvc(0) * SquaredNorm(gradCD.Col(0)) + minvc(1) * SquaredNorm(gradCD.Col(1)) +
+                minvc(2) * SquaredNorm(gradCD.Col(2)) + minvc(3) * SquaredNorm(gradCD.Col(3))) +
+        atildec(0);
+    A(1, 1) =
+        D(1) * (minvc(0) * SquaredNorm(gradCH.Col(0)) + minvc(1) * SquaredNorm(gradCH.Col(1)) +
+                minvc(2) * SquaredNorm(gradCH.Col(2)) + minvc(3) * SquaredNorm(gradCH.Col(3))) +
+        atildec(1);
+    A(0, 1) =
+        (minvc(0) * Dot(gradCD.Col(0), gradCH.Col(0)) +
+         minvc(1) * Dot(gradCD.Col(1), gradCH.Col(1)) +
+         minvc(2) * Dot(gradCD.Col(2), gradCH.Col(2)) +
+         minvc(3) * Dot(gradCD.Col(3), gradCH.Col(3)));
+    A(1, 0) = A(0, 1);
+    A(0, 1) *= D(0);
+    A(1, 0) *= D(1);
+    // Project block constraint
+    SVector<ScalarType, 2> dlambda = Inverse(A) * b;
+    lambdac += dlambda;
+    pbat::common::ForRange<0, 4>([&]<auto i>() {
+        xc.Col(i) += minvc(i) * (dlambda(0) * gradCD.Col(i) + dlambda(1) * gradCH.Col(i));
+    });
+}
+
 /**
  * @brief Project coupled Stable Neo-Hookean constraints
  *
@@ -109,34 +185,76 @@ PBAT_HOST_DEVICE void ProjectBlockNeoHookean(
 #if defined(CUDART_VERSION)
     #pragma nv_diag_default 174
 #endif
-    // Construct 2x2 constraint block system
-    SVector<ScalarType, 2> b{
-        -(CD + atildec(0) * lambdac(0) + gammac(0) * Dot(gradCD, xc - xtc)),
-        -(CH + atildec(1) * lambdac(1) + gammac(1) * Dot(gradCH, xc - xtc))};
-    SVector<ScalarType, 2> D = Ones<ScalarType, 2, 1>() + gammac;
-    SMatrix<ScalarType, 2, 2> A{};
-    A(0, 0) =
-        D(0) * (minvc(0) * SquaredNorm(gradCD.Col(0)) + minvc(1) * SquaredNorm(gradCD.Col(1)) +
-                minvc(2) * SquaredNorm(gradCD.Col(2)) + minvc(3) * SquaredNorm(gradCD.Col(3))) +
-        atildec(0);
-    A(1, 1) =
-        D(1) * (minvc(0) * SquaredNorm(gradCH.Col(0)) + minvc(1) * SquaredNorm(gradCH.Col(1)) +
-                minvc(2) * SquaredNorm(gradCH.Col(2)) + minvc(3) * SquaredNorm(gradCH.Col(3))) +
-        atildec(1);
-    A(0, 1) =
-        (minvc(0) * Dot(gradCD.Col(0), gradCH.Col(0)) +
-         minvc(1) * Dot(gradCD.Col(1), gradCH.Col(1)) +
-         minvc(2) * Dot(gradCD.Col(2), gradCH.Col(2)) +
-         minvc(3) * Dot(gradCD.Col(3), gradCH.Col(3)));
-    A(1, 0) = A(0, 1);
-    A(0, 1) *= D(0);
-    A(1, 0) *= D(1);
-    // Project block constraint
-    SVector<ScalarType, 2> dlambda = Inverse(A) * b;
-    lambdac += dlambda;
-    pbat::common::ForRange<0, 4>([&]<auto i>() {
-        xc.Col(i) += minvc(i) * (dlambda(0) * gradCD.Col(i) + dlambda(1) * gradCH.Col(i));
-    });
+    ProjectCoupledConstraints(minvc, CD, gradCD, CH, gradCH, atildec, gammac, xtc, lambdac, xc);
+}
+
+/**
+ * @brief Project coupled corotational constraints
+ *
+ * Deviatoric and hydrostatic constraints \f$ C_D = || \mathbf{F} - \mathbf{R} ||_F \f$ and
+ * \f$ C_H = \text{tr}(\mathbf{R}^T \mathbf{F}) - 3 \f$, where \f$ \mathbf{R} \f$ is the
+ * rotation of the polar decomposition of \f$ \mathbf{F} \f$, are projected as a coupled block
+ * like the Stable Neo-Hookean constraints, but their gradients only need a polar decomposition
+ * and no cofactor matrix, and their energy is quadratic in \f$ \mathbf{F} \f$ for a fixed
+ * rotation.
+ *
+ * @tparam TMatrixMinv
+ * @tparam TMatrixDmInv
+ * @tparam TMatrixAlphA
+ * @tparam TMatrixGamma
+ * @tparam TMatrixXTC
+ * @tparam TMatrixL
+ * @tparam TMatrixXC
+ * @tparam ScalarType
+ *
+ * @param minvc 4x1 vector of tetrahedron particle inverse masses
+ * @param DmInv 3x3 matrix of tetrahedron shape matrix inverse
+ * @param atildec 2x1 Deviatoric and hydrostatic compliances
+ * @param gammac 2x1 XPBD damping terms
+ * @param xtc 3x4 tetrahedron particle positions at time t
+ * @param lambda 2x1 vector of XPBD Lagrange multipliers
+ * @param xc 3x4 current tetrahedron particle positions
+ */
+template <
+    mini::CMatrix TMatrixMinv,
+    mini::CMatrix TMatrixDmInv,
+    mini::CMatrix TMatrixAlphaT,
+    mini::CMatrix TMatrixGamma,
+    mini::CMatrix TMatrixXTC,
+    mini::CMatrix TMatrixL,
+    mini::CMatrix TMatrixXC,
+    class ScalarType = typename TMatrixMinv::ScalarType>
+PBAT_HOST_DEVICE void ProjectBlockCorotational(
+    TMatrixMinv const& minvc,
+    TMatrixDmInv const& DmInv,
+    TMatrixAlphaT atildec,
+    TMatrixGamma gammac,
+    TMatrixXTC const& xtc,
+    TMatrixL& lambdac,
+    TMatrixXC& xc)
+{
+    using namespace mini;
+#if defined(CUDART_VERSION)
+    #pragma nv_diag_suppress 174
+#endif
+    SMatrix<ScalarType, 3, 3> F = (xc.template Slice<3, 3>(0, 1) - Repeat<1, 3>(xc.Col(0))) * DmInv;
+    auto const vecR             = physics::PolarRotation<3>(F);
+    SMatrix<ScalarType, 3, 3> R{};
+    for (auto k = 0; k < 9; ++k)
+        R(k % 3, k / 3) = vecR[k];
+    SMatrix<ScalarType, 3, 3> FmR = F - R;
+    ScalarType CD                 = Norm(FmR);
+    SMatrix<ScalarType, 3, 4> gradCD{};
+    gradCD.template Slice<3, 3>(0, 1) = (FmR * DmInv.Transpose()) / (CD + ScalarType(1e-12));
+    gradCD.Col(0)                     = -(gradCD.Col(1) + gradCD.Col(2) + gradCD.Col(3));
+    ScalarType CH                     = Dot(R, F) - ScalarType(3);
+    SMatrix<ScalarType, 3, 4> gradCH{};
+    gradCH.template Slice<3, 3>(0, 1) = R * DmInv.Transpose();
+    gradCH.Col(0)                     = -(gradCH.Col(1) + gradCH.Col(2) + gradCH.Col(3));
+#if defined(CUDART_VERSION)
+    #pragma nv_diag_default 174
+#endif
+    ProjectCoupledConstraints(minvc, CD, gradCD, CH, gradCH, atildec, gammac, xtc, lambdac, xc);
 }
 
 /**